@@ -0,0 +1,4966 @@
+// Generated from templates/ by pack_templates; do not edit
+#include <cstddef>
+
+extern const unsigned char cppstarter_template_blob[] = {
+    67,80,84,66,1,0,0,0,10,0,0,0,72,0,0,0,112,7,0,0,
+    7,0,0,0,0,0,0,0,1,0,0,0,132,7,0,0,11,0,0,0,
+    1,0,0,0,4,0,0,0,199,7,0,0,7,0,0,0,5,0,0,0,
+    5,0,0,0,13,8,0,0,7,0,0,0,10,0,0,0,12,0,0,0,
+    238,8,0,0,15,0,0,0,22,0,0,0,5,0,0,0,64,9,0,0,
+    11,0,0,0,27,0,0,0,10,0,0,0,29,10,0,0,8,0,0,0,
+    37,0,0,0,7,0,0,0,159,10,0,0,10,0,0,0,44,0,0,0,
+    15,0,0,0,162,11,0,0,8,0,0,0,59,0,0,0,4,0,0,0,
+    216,11,0,0,14,0,0,0,63,0,0,0,9,0,0,0,119,7,0,0,
+    13,0,0,0,149,12,0,0,253,4,0,0,177,6,0,0,1,0,0,0,
+    143,7,0,0,8,0,0,0,146,17,0,0,131,5,0,0,115,9,0,0,
+    3,0,0,0,151,7,0,0,19,0,0,0,21,23,0,0,28,0,0,0,
+    28,0,0,0,0,0,0,0,170,7,0,0,17,0,0,0,49,23,0,0,
+    107,0,0,0,119,0,0,0,1,0,0,0,187,7,0,0,12,0,0,0,
+    156,23,0,0,139,0,0,0,152,0,0,0,3,0,0,0,206,7,0,0,
+    8,0,0,0,39,24,0,0,188,17,0,0,82,33,0,0,3,0,0,0,
+    214,7,0,0,9,0,0,0,227,41,0,0,129,6,0,0,154,9,0,0,
+    3,0,0,0,223,7,0,0,15,0,0,0,100,48,0,0,187,4,0,0,
+    31,6,0,0,3,0,0,0,238,7,0,0,12,0,0,0,31,53,0,0,
+    187,0,0,0,209,0,0,0,3,0,0,0,250,7,0,0,19,0,0,0,
+    218,53,0,0,117,1,0,0,33,2,0,0,1,0,0,0,20,8,0,0,
+    8,0,0,0,79,55,0,0,104,7,0,0,152,12,0,0,3,0,0,0,
+    28,8,0,0,19,0,0,0,183,62,0,0,0,5,0,0,204,7,0,0,
+    1,0,0,0,47,8,0,0,24,0,0,0,183,67,0,0,233,1,0,0,
+    46,2,0,0,1,0,0,0,71,8,0,0,20,0,0,0,160,69,0,0,
+    209,0,0,0,242,0,0,0,1,0,0,0,91,8,0,0,18,0,0,0,
+    113,70,0,0,92,12,0,0,234,23,0,0,1,0,0,0,109,8,0,0,
+    17,0,0,0,205,82,0,0,20,2,0,0,184,2,0,0,1,0,0,0,
+    126,8,0,0,21,0,0,0,225,84,0,0,32,4,0,0,35,6,0,0,
+    1,0,0,0,147,8,0,0,22,0,0,0,1,89,0,0,182,2,0,0,
+    2,5,0,0,1,0,0,0,169,8,0,0,12,0,0,0,183,91,0,0,
+    66,6,0,0,236,10,0,0,1,0,0,0,181,8,0,0,15,0,0,0,
+    249,97,0,0,235,4,0,0,73,9,0,0,1,0,0,0,196,8,0,0,
+    19,0,0,0,228,102,0,0,10,4,0,0,72,7,0,0,1,0,0,0,
+    215,8,0,0,23,0,0,0,238,106,0,0,172,7,0,0,105,16,0,0,
+    1,0,0,0,253,8,0,0,8,0,0,0,154,114,0,0,125,6,0,0,
+    210,11,0,0,3,0,0,0,5,9,0,0,9,0,0,0,23,121,0,0,
+    125,0,0,0,202,0,0,0,1,0,0,0,14,9,0,0,20,0,0,0,
+    148,121,0,0,49,0,0,0,65,0,0,0,1,0,0,0,34,9,0,0,
+    12,0,0,0,197,121,0,0,140,0,0,0,194,0,0,0,1,0,0,0,
+    46,9,0,0,18,0,0,0,81,122,0,0,87,0,0,0,119,0,0,0,
+    1,0,0,0,75,9,0,0,8,0,0,0,168,122,0,0,214,7,0,0,
+    172,13,0,0,3,0,0,0,83,9,0,0,27,0,0,0,126,130,0,0,
+    97,3,0,0,91,5,0,0,1,0,0,0,110,9,0,0,29,0,0,0,
+    223,133,0,0,106,2,0,0,53,3,0,0,1,0,0,0,139,9,0,0,
+    23,0,0,0,73,136,0,0,200,4,0,0,97,7,0,0,1,0,0,0,
+    162,9,0,0,18,0,0,0,17,141,0,0,110,3,0,0,229,6,0,0,
+    1,0,0,0,180,9,0,0,25,0,0,0,127,144,0,0,150,3,0,0,
+    236,5,0,0,1,0,0,0,205,9,0,0,12,0,0,0,21,148,0,0,
+    92,4,0,0,214,6,0,0,1,0,0,0,217,9,0,0,19,0,0,0,
+    113,152,0,0,246,5,0,0,4,12,0,0,1,0,0,0,236,9,0,0,
+    23,0,0,0,103,158,0,0,15,8,0,0,244,13,0,0,1,0,0,0,
+    3,10,0,0,26,0,0,0,118,166,0,0,253,4,0,0,33,10,0,0,
+    1,0,0,0,37,10,0,0,8,0,0,0,115,171,0,0,51,7,0,0,
+    103,12,0,0,3,0,0,0,45,10,0,0,13,0,0,0,166,178,0,0,
+    147,2,0,0,105,3,0,0,1,0,0,0,58,10,0,0,25,0,0,0,
+    57,181,0,0,11,7,0,0,83,10,0,0,1,0,0,0,83,10,0,0,
+    11,0,0,0,68,188,0,0,101,9,0,0,114,16,0,0,1,0,0,0,
+    94,10,0,0,23,0,0,0,169,197,0,0,137,8,0,0,146,14,0,0,
+    1,0,0,0,117,10,0,0,12,0,0,0,50,206,0,0,75,3,0,0,
+    175,5,0,0,1,0,0,0,129,10,0,0,30,0,0,0,125,209,0,0,
+    70,8,0,0,55,16,0,0,1,0,0,0,169,10,0,0,8,0,0,0,
+    195,217,0,0,231,7,0,0,49,13,0,0,3,0,0,0,177,10,0,0,
+    24,0,0,0,170,225,0,0,110,12,0,0,87,21,0,0,1,0,0,0,
+    201,10,0,0,21,0,0,0,24,238,0,0,84,3,0,0,61,5,0,0,
+    1,0,0,0,222,10,0,0,20,0,0,0,108,241,0,0,114,9,0,0,
+    247,15,0,0,1,0,0,0,242,10,0,0,14,0,0,0,222,250,0,0,
+    56,2,0,0,246,2,0,0,1,0,0,0,0,11,0,0,16,0,0,0,
+    22,253,0,0,11,4,0,0,204,5,0,0,1,0,0,0,16,11,0,0,
+    14,0,0,0,33,1,1,0,240,1,0,0,153,2,0,0,1,0,0,0,
+    30,11,0,0,19,0,0,0,17,3,1,0,254,0,0,0,92,1,0,0,
+    1,0,0,0,49,11,0,0,18,0,0,0,15,4,1,0,207,6,0,0,
+    8,12,0,0,1,0,0,0,67,11,0,0,18,0,0,0,222,10,1,0,
+    134,5,0,0,253,9,0,0,1,0,0,0,85,11,0,0,12,0,0,0,
+    100,16,1,0,104,2,0,0,1,4,0,0,1,0,0,0,97,11,0,0,
+    12,0,0,0,204,18,1,0,253,4,0,0,11,9,0,0,3,0,0,0,
+    109,11,0,0,14,0,0,0,201,23,1,0,183,12,0,0,45,22,0,0,
+    1,0,0,0,123,11,0,0,18,0,0,0,128,36,1,0,68,17,0,0,
+    125,37,0,0,1,0,0,0,141,11,0,0,21,0,0,0,196,53,1,0,
+    202,10,0,0,168,20,0,0,1,0,0,0,170,11,0,0,8,0,0,0,
+    142,64,1,0,211,5,0,0,254,9,0,0,3,0,0,0,178,11,0,0,
+    14,0,0,0,97,70,1,0,193,0,0,0,227,0,0,0,1,0,0,0,
+    192,11,0,0,12,0,0,0,34,71,1,0,145,1,0,0,105,2,0,0,
+    1,0,0,0,204,11,0,0,12,0,0,0,179,72,1,0,77,0,0,0,
+    84,0,0,0,1,0,0,0,230,11,0,0,8,0,0,0,0,73,1,0,
+    150,9,0,0,92,16,0,0,3,0,0,0,238,11,0,0,22,0,0,0,
+    150,82,1,0,200,2,0,0,129,3,0,0,1,0,0,0,4,12,0,0,
+    24,0,0,0,94,85,1,0,183,3,0,0,66,5,0,0,1,0,0,0,
+    28,12,0,0,23,0,0,0,21,89,1,0,213,3,0,0,245,4,0,0,
+    1,0,0,0,51,12,0,0,20,0,0,0,234,92,1,0,4,5,0,0,
+    95,9,0,0,1,0,0,0,71,12,0,0,22,0,0,0,238,97,1,0,
+    184,7,0,0,208,14,0,0,1,0,0,0,93,12,0,0,12,0,0,0,
+    166,105,1,0,15,10,0,0,114,19,0,0,1,0,0,0,105,12,0,0,
+    21,0,0,0,181,115,1,0,31,10,0,0,80,17,0,0,1,0,0,0,
+    126,12,0,0,23,0,0,0,212,125,1,0,154,5,0,0,4,11,0,0,
+    1,0,0,0,95,99,111,109,109,111,110,99,112,112,115,116,97,114,116,101,
+    114,46,109,107,99,111,110,115,111,108,101,95,97,112,112,77,97,107,101,102,
+    105,108,101,105,110,99,108,117,100,101,47,102,117,110,99,116,105,111,110,115,
+    46,104,115,114,99,47,102,117,110,99,116,105,111,110,115,46,99,112,112,115,
+    114,99,47,109,97,105,110,46,99,112,112,100,101,102,97,117,108,116,77,97,
+    107,101,102,105,108,101,82,69,65,68,77,69,46,109,100,99,112,112,115,116,
+    97,114,116,101,114,46,99,111,110,102,115,114,99,47,109,97,105,110,46,99,
+    112,112,116,101,115,116,115,47,116,101,115,116,95,109,97,116,104,46,99,112,
+    112,101,99,115,95,97,112,112,77,97,107,101,102,105,108,101,98,101,110,99,
+    104,47,98,101,110,99,104,95,101,99,115,46,99,112,112,105,110,99,108,117,
+    100,101,47,98,97,116,99,104,95,114,101,110,100,101,114,101,114,46,104,105,
+    110,99,108,117,100,101,47,99,111,109,112,111,110,101,110,116,115,46,104,105,
+    110,99,108,117,100,101,47,114,101,103,105,115,116,114,121,46,104,105,110,99,
+    108,117,100,101,47,115,121,115,116,101,109,115,46,104,105,110,99,108,117,100,
+    101,47,116,104,114,101,97,100,95,112,111,111,108,46,104,115,114,99,47,98,
+    97,116,99,104,95,114,101,110,100,101,114,101,114,46,99,112,112,115,114,99,
+    47,109,97,105,110,46,99,112,112,115,114,99,47,115,121,115,116,101,109,115,
+    46,99,112,112,115,114,99,47,116,104,114,101,97,100,95,112,111,111,108,46,
+    99,112,112,116,101,115,116,115,47,116,101,115,116,95,114,101,103,105,115,116,
+    114,121,46,99,112,112,108,105,98,114,97,114,121,95,112,114,111,106,101,99,
+    116,77,97,107,101,102,105,108,101,82,69,65,68,77,69,46,109,100,105,110,
+    99,108,117,100,101,47,111,112,101,114,97,116,105,111,110,115,46,104,115,114,
+    99,47,109,97,105,110,46,99,112,112,115,114,99,47,111,112,101,114,97,116,
+    105,111,110,115,46,99,112,112,111,112,101,110,103,108,50,95,97,112,112,77,
+    97,107,101,102,105,108,101,98,101,110,99,104,47,98,101,110,99,104,95,115,
+    104,97,112,101,95,98,97,116,99,104,46,99,112,112,105,110,99,108,117,100,
+    101,47,103,108,95,98,97,116,99,104,95,114,101,110,100,101,114,101,114,46,
+    104,112,112,105,110,99,108,117,100,101,47,115,104,97,112,101,95,98,97,116,
+    99,104,46,104,112,112,105,110,99,108,117,100,101,47,115,104,97,112,101,115,
+    46,104,112,112,115,114,99,47,103,108,95,98,97,116,99,104,95,114,101,110,
+    100,101,114,101,114,46,99,112,112,115,114,99,47,109,97,105,110,46,99,112,
+    112,115,114,99,47,115,104,97,112,101,95,98,97,116,99,104,46,99,112,112,
+    116,101,115,116,115,47,116,101,115,116,95,103,108,95,98,97,116,99,104,46,
+    99,112,112,116,101,115,116,115,47,116,101,115,116,95,115,104,97,112,101,95,
+    98,97,116,99,104,46,99,112,112,115,100,108,50,95,97,112,112,77,97,107,
+    101,102,105,108,101,105,110,99,108,117,100,101,47,97,112,112,46,104,105,110,
+    99,108,117,100,101,47,102,114,97,109,101,95,115,99,104,101,100,117,108,101,
+    114,46,104,115,114,99,47,97,112,112,46,99,112,112,115,114,99,47,102,114,
+    97,109,101,95,115,99,104,101,100,117,108,101,114,46,99,112,112,115,114,99,
+    47,109,97,105,110,46,99,112,112,116,101,115,116,115,47,116,101,115,116,95,
+    102,114,97,109,101,95,115,99,104,101,100,117,108,101,114,46,99,112,112,115,
+    101,114,118,101,114,95,97,112,112,77,97,107,101,102,105,108,101,98,101,110,
+    99,104,47,108,111,97,100,95,103,101,110,101,114,97,116,111,114,46,99,112,
+    112,105,110,99,108,117,100,101,47,98,117,102,102,101,114,95,112,111,111,108,
+    46,104,105,110,99,108,117,100,101,47,101,118,101,110,116,95,108,111,111,112,
+    46,104,105,110,99,108,117,100,101,47,104,116,116,112,46,104,105,110,99,108,
+    117,100,101,47,115,101,114,118,101,114,46,104,105,110,99,108,117,100,101,47,
+    116,97,115,107,46,104,115,114,99,47,98,117,102,102,101,114,95,112,111,111,
+    108,46,99,112,112,115,114,99,47,101,112,111,108,108,95,108,111,111,112,46,
+    99,112,112,115,114,99,47,101,118,101,110,116,95,108,111,111,112,46,99,112,
+    112,115,114,99,47,104,116,116,112,46,99,112,112,115,114,99,47,109,97,105,
+    110,46,99,112,112,115,114,99,47,115,101,114,118,101,114,46,99,112,112,115,
+    114,99,47,117,114,105,110,103,95,108,111,111,112,46,99,112,112,116,101,115,
+    116,115,47,116,101,115,116,95,115,101,114,118,101,114,46,99,112,112,115,102,
+    109,108,95,97,112,112,77,97,107,101,102,105,108,101,105,110,99,108,117,100,
+    101,47,103,97,109,101,46,104,115,114,99,47,103,97,109,101,46,99,112,112,
+    115,114,99,47,109,97,105,110,46,99,112,112,115,102,109,108,95,98,111,120,
+    50,100,95,97,112,112,77,97,107,101,102,105,108,101,105,110,99,108,117,100,
+    101,47,98,111,120,95,114,101,110,100,101,114,101,114,46,104,105,110,99,108,
+    117,100,101,47,104,101,97,100,108,101,115,115,95,98,101,110,99,104,46,104,
+    105,110,99,108,117,100,101,47,112,104,121,115,105,99,115,95,115,99,101,110,
+    101,46,104,115,114,99,47,98,111,120,95,114,101,110,100,101,114,101,114,46,
+    99,112,112,115,114,99,47,104,101,97,100,108,101,115,115,95,98,101,110,99,
+    104,46,99,112,112,115,114,99,47,109,97,105,110,46,99,112,112,115,114,99,
+    47,112,104,121,115,105,99,115,95,115,99,101,110,101,46,99,112,112,116,101,
+    115,116,115,47,116,101,115,116,95,104,101,97,100,108,101,115,115,46,99,112,
+    112,240,13,35,32,82,117,108,101,115,32,115,104,97,114,101,100,32,98,121,
+    32,116,104,101,32,77,97,107,101,102,105,24,0,241,32,116,104,97,116,32,
+    96,99,112,112,115,116,97,114,116,101,114,32,110,101,119,96,32,119,114,105,
+    116,101,115,46,32,73,110,99,108,117,100,101,32,105,116,10,35,32,111,110,
+    99,101,62,0,224,114,101,108,101,97,115,101,32,118,97,114,105,97,98,70,
+    0,241,19,101,120,105,115,116,44,32,119,105,116,104,32,80,82,79,70,73,
+    76,69,95,84,65,82,71,69,84,83,32,115,101,116,32,116,111,57,0,240,
+    0,116,97,114,103,101,116,115,10,35,32,97,32,112,114,111,130,0,241,4,
+    39,115,32,99,111,109,112,105,108,101,114,32,98,117,105,108,100,115,59,43,
+    0,18,105,122,0,16,114,40,0,244,24,118,105,100,101,115,32,68,69,80,
+    70,76,65,71,83,32,97,110,100,32,70,79,82,67,69,46,10,10,35,32,
+    61,61,61,32,84,117,110,101,100,32,151,0,3,90,0,101,32,40,109,97,
+    107,101,22,0,3,151,0,128,61,60,110,97,109,101,62,41,56,0,41,10,
+    35,250,0,68,116,117,110,101,251,0,1,132,0,118,102,97,115,116,101,115,
+    116,161,0,0,122,0,224,102,108,97,103,115,32,105,116,32,109,101,97,115,
+    117,84,1,64,116,111,10,35,167,0,0,207,0,34,115,47,96,0,68,46,
+    109,107,59,123,0,20,95,145,0,54,105,110,32,105,1,129,46,99,111,110,
+    102,32,105,115,106,0,147,100,101,102,97,117,108,116,46,10,166,0,243,8,
+    32,63,61,32,36,40,115,104,101,108,108,32,115,101,100,32,45,110,32,39,
+    115,47,94,226,0,5,81,0,141,42,61,32,42,47,47,112,39,87,0,243,
+    7,50,62,47,100,101,118,47,110,117,108,108,41,10,105,102,110,101,113,32,
+    40,36,40,93,0,67,41,44,41,10,95,1,6,183,0,6,30,0,240,8,
+    46,109,107,10,79,80,84,73,77,73,90,65,84,73,79,78,95,76,69,86,
+    69,76,32,145,0,3,65,0,17,95,136,1,14,89,0,64,95,67,88,88,
+    93,0,5,76,0,4,4,2,105,41,58,32,67,88,88,67,0,0,43,0,
+    99,10,101,110,100,105,102,6,0,3,203,1,51,80,114,101,16,2,131,100,
+    32,104,101,97,100,101,114,200,1,82,80,67,72,61,49,183,1,48,80,67,
+    72,33,1,144,48,10,80,67,72,95,77,65,88,13,0,32,49,54,13,2,
+    243,1,77,111,115,116,32,102,114,101,113,117,101,110,116,108,121,32,231,0,
+    131,100,32,115,121,115,116,101,109,82,0,65,115,32,111,102,119,1,242,3,
+    103,105,118,101,110,32,115,111,117,114,99,101,115,10,112,99,104,95,115,0,
+    17,115,171,0,2,127,1,248,10,103,114,101,112,32,45,104,111,32,39,94,
+    91,91,58,115,112,97,99,101,58,93,93,42,92,35,14,0,3,104,0,8,
+    19,0,231,60,91,94,62,93,42,62,39,32,36,40,49,41,32,145,1,48,
+    32,124,32,211,1,160,39,115,47,46,42,60,47,60,47,39,17,0,212,111,
+    114,116,32,124,32,117,110,105,113,32,45,99,17,0,81,45,114,110,32,124,
+    180,0,0,1,2,35,36,40,239,0,240,7,41,32,124,32,97,119,107,32,
+    39,123,112,114,105,110,116,32,36,36,50,125,39,41,255,0,49,79,110,101,
+    47,0,112,101,114,32,112,101,114,32,98,2,146,105,103,117,114,97,116,105,
+    111,110,87,3,2,190,2,49,97,114,101,227,3,128,116,101,110,32,105,110,
+    116,111,207,2,16,115,163,3,16,97,232,3,128,99,104,97,110,103,105,110,
+    103,35,1,66,109,32,114,101,151,3,0,14,0,81,32,46,103,99,104,128,
+    3,209,101,118,101,114,121,32,111,98,106,101,99,116,32,68,4,48,117,115,
+    101,23,3,50,46,10,35,242,0,21,61,31,4,242,0,32,112,114,101,102,
+    105,120,44,32,36,40,50,41,32,61,231,3,160,32,100,105,114,101,99,116,
+    111,114,121,24,0,16,51,24,0,3,136,1,0,16,0,16,52,16,0,1,
+    172,0,128,10,100,101,102,105,110,101,32,252,0,131,82,85,76,69,83,10,
+    105,102,206,2,112,67,72,41,44,49,41,10,96,1,16,95,31,0,49,71,
+    67,72,184,1,96,50,41,47,112,99,104,4,0,64,46,104,112,112,179,0,
+    6,36,0,1,186,2,67,32,61,32,45,178,1,1,148,0,0,43,0,0,
+    4,0,0,47,0,240,1,32,45,87,105,110,118,97,108,105,100,45,112,99,
+    104,10,10,180,0,0,28,0,0,4,0,0,32,0,18,58,123,4,240,0,
+    10,9,64,109,107,100,105,114,32,45,112,32,36,36,40,10,0,144,36,36,
+    64,41,10,9,64,101,99,44,2,49,47,47,32,191,0,247,33,58,32,36,
+    40,52,41,39,32,62,32,36,36,64,46,116,109,112,10,9,64,102,111,114,
+    32,104,32,105,110,32,36,40,102,111,114,101,97,99,104,32,104,44,36,40,
+    99,97,108,108,32,132,2,241,4,44,36,40,51,41,41,44,39,36,40,104,
+    41,39,41,59,32,100,111,32,92,0,37,34,35,188,0,80,36,36,36,104,
+    34,26,0,72,110,101,32,62,99,0,100,99,109,112,32,45,115,116,0,0,
+    8,0,144,32,38,38,32,114,109,32,45,102,13,0,0,137,0,101,32,124,
+    124,32,109,118,14,0,62,36,36,64,237,0,0,60,1,0,194,0,10,82,
+    1,80,10,9,36,36,40,192,3,1,220,0,0,255,0,4,155,5,146,41,
+    32,45,120,32,99,43,43,45,71,3,112,32,36,36,60,32,45,111,100,0,
+    47,10,10,114,1,6,35,46,100,2,4,96,101,110,100,101,102,10,240,57,
+    67,88,88,32,61,32,103,43,43,10,79,80,84,73,77,73,90,65,84,73,
+    79,78,95,76,69,86,69,76,32,61,32,45,79,50,10,10,83,82,67,32,
+    61,32,36,40,119,105,108,100,99,97,114,100,32,115,114,99,47,42,46,99,
+    112,112,41,10,73,78,67,76,85,68,69,83,44,0,240,20,73,105,110,99,
+    108,117,100,101,10,10,35,32,61,61,61,32,68,101,98,117,103,32,99,111,
+    110,102,105,103,117,114,97,116,105,111,110,24,0,145,10,68,66,71,95,70,
+    76,65,71,53,0,116,87,97,108,108,32,36,40,72,0,65,41,32,45,103,
+    33,0,49,79,66,74,117,0,129,112,97,116,115,117,98,115,116,117,0,16,
+    37,117,0,144,44,32,98,117,105,108,100,47,100,95,0,241,2,47,111,98,
+    106,47,37,46,111,44,32,36,40,83,82,67,41,41,61,0,89,66,73,78,
+    32,61,39,0,244,5,98,105,110,47,123,123,112,114,111,106,101,99,116,95,
+    110,97,109,101,125,125,168,0,127,82,101,108,101,97,115,101,170,0,0,63,
+    82,69,76,170,0,8,46,36,40,52,1,32,41,10,52,0,15,189,0,15,
+    18,114,116,0,14,191,0,0,63,0,8,191,0,4,41,0,15,193,0,5,
+    4,189,0,240,52,112,114,111,102,105,108,101,32,97,110,100,32,112,114,101,
+    99,111,109,112,105,108,101,100,32,104,101,97,100,101,114,32,114,117,108,101,
+    115,32,40,99,112,112,115,116,97,114,116,101,114,46,109,107,41,10,80,82,
+    79,70,73,76,69,95,84,65,82,71,69,84,144,1,35,36,40,129,0,34,
+    41,32,11,0,83,79,66,74,41,10,217,1,25,32,63,0,0,63,1,242,
+    13,76,105,110,107,32,108,105,98,114,97,114,105,101,115,10,76,73,66,83,
+    95,68,69,66,85,71,32,61,32,14,0,112,82,69,76,69,65,83,69,16,
+    0,176,10,35,32,69,109,105,116,32,46,100,32,171,0,240,2,115,32,110,
+    101,120,116,32,116,111,32,101,97,99,104,32,111,98,155,1,52,32,115,111,
+    179,0,176,101,100,105,116,115,32,116,114,105,103,103,193,0,4,211,0,85,
+    115,10,68,69,80,63,2,240,20,77,77,68,32,45,77,80,10,10,46,68,
+    69,70,65,85,76,84,95,71,79,65,76,32,58,61,32,97,108,108,10,36,
+    40,101,118,97,95,2,16,99,102,2,231,80,67,72,95,82,85,76,69,83,
+    44,68,66,71,44,69,2,18,44,60,2,53,44,36,40,155,2,63,41,41,
+    41,62,0,6,51,82,69,76,62,0,3,157,1,6,64,0,0,61,1,1,
+    156,0,0,64,0,98,10,97,108,108,58,32,85,0,102,66,73,78,41,10,
+    10,12,0,4,24,0,1,95,1,192,9,109,107,100,105,114,32,45,112,32,
+    36,40,9,0,160,36,64,41,10,9,36,40,67,88,88,134,1,6,148,0,
+    198,32,45,111,32,36,64,32,36,94,32,36,40,107,1,55,41,10,10,204,
+    0,4,82,2,22,58,49,3,3,131,0,0,255,0,95,71,67,72,41,10,
+    111,0,22,2,175,0,0,56,0,2,212,0,0,73,0,3,124,1,114,41,
+    32,45,99,32,36,60,146,0,35,10,10,9,1,0,214,0,0,3,1,4,
+    238,0,4,12,0,4,24,0,15,238,0,16,0,51,0,3,110,0,12,238,
+    0,3,75,2,5,240,0,3,117,0,15,242,0,3,0,72,0,0,186,0,
+    15,242,0,16,0,43,0,3,115,0,2,244,2,0,56,0,5,17,0,4,
+    110,2,11,242,0,20,45,20,3,2,37,1,144,79,66,74,58,46,111,61,
+    46,100,178,1,0,81,0,6,17,0,119,10,10,116,101,115,116,58,119,1,
+    8,175,1,63,98,105,110,236,1,4,16,73,55,0,16,115,98,1,11,48,
+    0,16,47,25,0,96,95,109,97,116,104,32,10,0,22,115,16,0,0,31,
+    5,79,10,9,46,47,49,0,6,160,10,10,118,97,108,103,114,105,110,100,
+    147,1,0,90,2,1,171,1,20,9,22,0,242,26,32,45,45,108,101,97,
+    107,45,99,104,101,99,107,61,102,117,108,108,32,45,45,116,114,97,99,107,
+    45,111,114,105,103,105,110,115,61,121,101,115,32,46,47,246,0,1,61,0,
+    74,10,114,117,110,78,0,13,31,0,19,45,171,1,0,39,0,0,29,1,
+    1,56,0,16,9,39,0,5,14,0,242,0,10,99,108,101,97,110,58,10,
+    9,114,109,32,45,114,102,189,5,245,20,10,10,104,101,108,112,58,10,9,
+    64,101,99,104,111,32,34,65,118,97,105,108,97,98,108,101,32,116,97,114,
+    103,101,116,115,58,34,28,0,16,32,242,3,20,32,1,0,48,45,32,66,
+    37,6,17,32,37,6,80,32,118,101,114,115,126,6,152,40,100,101,102,97,
+    117,108,116,41,55,0,3,156,0,1,58,0,4,55,0,164,111,112,116,105,
+    109,105,122,101,100,32,30,0,3,67,0,8,57,0,0,125,1,1,54,0,
+    98,32,32,32,45,32,67,114,5,1,129,5,50,114,117,110,155,1,8,47,
+    0,0,21,0,6,47,0,162,82,117,110,32,97,112,112,108,105,99,25,7,
+    35,105,110,172,0,75,109,111,100,101,55,0,4,63,1,63,32,45,32,55,
+    0,0,4,162,0,12,57,0,5,212,1,1,159,0,12,57,0,84,119,105,
+    116,104,32,35,0,8,112,0,1,136,1,3,168,0,112,45,32,82,101,109,
+    111,118,27,7,3,79,6,1,185,5,8,47,0,0,161,1,3,46,0,208,
+    32,45,32,83,104,111,119,32,116,104,105,115,32,24,0,6,40,0,6,10,
+    0,32,79,112,8,8,10,185,1,83,80,67,72,61,49,69,0,53,45,32,
+    80,190,6,243,6,32,116,104,101,32,109,111,115,116,32,102,114,101,113,117,
+    101,110,116,108,121,32,120,3,131,100,32,115,121,115,116,101,109,46,6,22,
+    115,98,0,35,32,32,215,6,16,61,231,7,0,52,1,2,108,7,19,32,
+    20,7,17,114,163,1,179,102,108,97,103,115,32,102,114,111,109,32,59,7,
+    32,115,47,48,0,56,46,109,107,39,7,241,9,32,116,117,110,101,41,34,
+    10,10,70,79,82,67,69,58,10,10,46,80,72,79,78,89,58,109,2,4,
+    122,1,1,9,2,0,223,1,53,114,117,110,172,1,4,92,1,18,32,81,
+    1,0,16,1,17,32,69,0,0,35,112,114,97,103,109,97,32,111,110,99,
+    101,10,10,118,111,105,100,32,103,114,101,101,116,40,41,59,10,245,5,35,
+    105,110,99,108,117,100,101,32,60,105,111,115,116,114,101,97,109,62,10,20,
+    0,240,34,34,102,117,110,99,116,105,111,110,115,46,104,34,10,10,118,111,
+    105,100,32,103,114,101,101,116,40,41,32,123,10,32,32,32,32,115,116,100,
+    58,58,99,111,117,116,32,60,60,32,34,71,28,0,20,32,53,0,176,32,
+    101,120,101,99,117,116,101,100,46,34,30,0,1,43,0,128,101,110,100,108,
+    59,10,125,10,245,5,35,105,110,99,108,117,100,101,32,60,105,111,115,116,
+    114,101,97,109,62,10,20,0,240,59,34,102,117,110,99,116,105,111,110,115,
+    46,104,34,10,10,105,110,116,32,109,97,105,110,40,41,32,123,10,32,32,
+    32,32,115,116,100,58,58,99,111,117,116,32,60,60,32,34,72,101,108,108,
+    111,32,102,114,111,109,32,123,123,112,114,111,106,101,99,116,95,110,97,109,
+    101,125,125,34,33,0,1,46,0,81,101,110,100,108,59,61,0,114,103,114,
+    101,101,116,40,41,13,0,1,18,0,192,114,101,116,117,114,110,32,48,59,
+    10,125,10,240,35,67,88,88,32,61,32,103,43,43,10,67,88,88,70,76,
+    65,71,83,32,61,32,45,115,116,100,61,99,43,43,49,55,10,79,80,84,
+    73,77,73,90,65,84,73,79,78,95,76,69,86,69,76,32,0,241,23,79,
+    50,10,83,82,67,32,61,32,36,40,119,105,108,100,99,97,114,100,32,115,
+    114,99,47,42,46,99,112,112,41,10,73,78,67,76,85,68,69,75,0,240,
+    20,73,105,110,99,108,117,100,101,10,10,35,32,61,61,61,32,68,101,98,
+    117,103,32,99,111,110,102,105,103,117,114,97,116,105,111,110,24,0,85,10,
+    68,66,71,95,128,0,244,11,87,97,108,108,32,45,87,101,120,116,114,97,
+    32,45,87,112,101,100,97,110,116,105,99,32,36,40,91,0,193,41,32,45,
+    103,32,45,68,68,69,66,85,71,60,0,49,79,66,74,144,0,129,112,97,
+    116,115,117,98,115,116,144,0,16,37,144,0,144,44,32,98,117,105,108,100,
+    47,100,122,0,241,2,47,111,98,106,47,37,46,111,44,32,36,40,83,82,
+    67,41,41,61,0,89,66,73,78,32,61,39,0,244,5,98,105,110,47,123,
+    123,112,114,111,106,101,99,116,95,110,97,109,101,125,125,195,0,127,82,101,
+    108,101,97,115,101,197,0,0,63,82,69,76,197,0,4,8,186,0,46,36,
+    40,86,1,82,41,32,45,68,78,206,0,0,69,0,15,206,0,15,18,114,
+    133,0,14,208,0,0,63,0,8,208,0,4,41,0,15,210,0,5,241,0,
+    76,105,98,114,97,114,105,101,115,10,76,73,66,83,95,132,0,50,32,61,
+    32,14,0,112,82,69,76,69,65,83,69,16,0,240,17,10,35,32,69,109,
+    105,116,32,46,100,32,102,105,108,101,115,32,110,101,120,116,32,116,111,32,
+    101,97,99,104,32,111,98,41,1,240,16,32,115,111,32,104,101,97,100,101,
+    114,32,101,100,105,116,115,32,116,114,105,103,103,101,114,32,114,101,99,111,
+    109,112,55,0,69,10,68,69,80,232,1,116,77,77,68,32,45,77,80,89,
+    1,161,70,97,115,116,45,108,105,110,107,32,172,1,64,32,112,114,111,107,
+    0,241,15,32,40,109,97,107,101,32,70,65,83,84,95,76,73,78,75,61,
+    49,32,91,83,72,65,82,69,68,61,49,93,41,62,2,243,4,35,32,83,
+    112,108,105,116,32,68,87,65,82,70,32,107,101,101,112,115,68,0,240,1,
+    105,110,102,111,32,111,117,116,32,111,102,32,116,104,101,32,95,0,17,59,
+    10,0,65,102,105,114,115,23,0,241,38,109,111,108,100,44,32,108,108,100,
+    32,97,110,100,10,35,32,103,111,108,100,32,116,104,97,116,32,105,115,32,
+    105,110,115,116,97,108,108,101,100,32,114,101,112,108,97,99,101,115,32,108,
+    100,46,98,102,45,0,244,7,32,119,114,105,116,101,115,32,97,32,46,103,
+    100,98,95,105,110,100,101,120,46,32,156,0,33,10,35,110,0,17,115,139,
+    2,96,32,40,119,105,116,104,137,0,64,109,97,105,110,152,2,105,41,32,
+    105,110,116,111,118,2,124,108,105,98,47,108,105,98,121,2,96,46,115,111,
+    44,10,35,93,1,97,97,32,111,110,101,45,21,1,144,99,104,97,110,103,
+    101,32,114,101,210,0,97,115,32,111,110,108,121,215,0,17,108,208,1,53,
+    121,46,10,48,1,98,32,63,61,32,48,10,150,0,2,12,0,0,109,3,
+    35,76,68,135,1,149,10,105,102,101,113,32,40,36,40,49,0,67,41,44,
+    49,41,63,0,48,68,32,58,230,3,1,44,1,161,119,111,114,100,32,36,
+    40,102,111,114,243,1,48,108,100,44,58,1,1,57,1,0,51,1,240,26,
+    44,36,40,115,104,101,108,108,32,36,40,67,88,88,41,32,45,102,117,115,
+    101,45,108,100,61,36,40,108,100,41,32,45,87,108,44,45,45,118,101,114,
+    115,243,3,241,9,62,47,100,101,118,47,110,117,108,108,32,50,62,38,49,
+    32,38,38,32,101,99,104,111,32,44,0,19,41,151,3,2,161,0,96,43,
+    61,32,45,103,115,223,1,168,45,100,119,97,114,102,10,105,102,110,177,0,
+    50,68,41,44,198,3,7,47,0,112,103,110,117,45,112,117,98,184,3,17,
+    115,226,3,5,238,0,8,151,0,2,241,0,20,68,156,0,65,103,100,98,
+    45,195,1,99,10,101,110,100,105,102,6,0,1,44,1,68,73,78,75,95,
+    148,3,0,17,0,69,79,66,74,41,56,1,2,90,1,1,53,1,0,28,
+    0,6,135,0,66,102,80,73,67,126,0,43,73,66,96,4,15,234,1,7,
+    3,49,0,7,113,0,105,102,105,108,116,101,114,41,2,0,198,4,1,72,
+    2,64,111,44,36,40,117,0,0,145,0,2,6,1,2,142,0,16,95,205,
+    3,16,32,187,1,0,30,0,51,76,73,66,229,0,240,3,114,112,97,116,
+    104,44,39,36,36,79,82,73,71,73,78,47,46,46,113,2,19,39,236,0,
+    3,164,5,21,80,175,3,20,100,207,3,2,131,3,240,3,80,67,72,61,
+    49,44,32,111,114,32,96,99,112,112,115,116,97,114,153,0,162,110,101,119,
+    32,45,45,112,99,104,96,141,3,48,80,67,72,103,2,221,123,123,112,99,
+    104,125,125,10,84,69,83,84,95,47,6,84,116,101,115,116,115,49,6,3,
+    120,0,82,85,110,105,116,121,232,0,3,244,3,114,85,78,73,84,89,61,
+    49,88,0,114,35,32,77,101,114,103,101,80,3,1,107,6,2,66,3,1,
+    37,0,242,0,95,66,65,84,67,72,69,83,32,116,114,97,110,115,108,89,
+    6,32,117,110,133,4,240,14,111,102,32,115,105,109,105,108,97,114,32,115,
+    105,122,101,10,35,32,40,98,121,32,100,101,102,97,117,108,116,81,3,112,
+    32,112,101,114,32,56,32,87,3,249,1,115,44,32,97,116,32,109,111,115,
+    116,32,52,44,32,97,115,233,0,1,72,6,242,0,96,32,100,111,101,115,
+    41,46,10,35,32,76,105,115,116,54,0,2,47,4,192,98,114,101,97,107,
+    32,119,104,101,110,32,109,170,0,209,100,32,40,97,110,111,110,121,109,111,
+    117,115,45,140,2,242,12,112,97,99,101,32,99,108,97,115,104,101,115,44,
+    32,109,97,99,114,111,115,41,10,35,32,105,110,32,198,0,33,69,88,59,
+    7,0,88,5,3,50,5,0,213,3,64,109,32,111,110,8,0,129,105,114,
+    32,111,119,110,46,10,44,0,0,100,1,18,48,11,0,5,253,0,16,63,
+    242,1,2,134,3,96,110,61,36,36,40,40,162,7,113,111,114,100,115,32,
+    36,40,53,0,0,137,1,240,9,41,41,32,47,32,56,32,41,41,59,32,
+    91,32,36,36,110,32,45,108,116,32,49,32,93,133,3,53,110,61,49,22,
+    0,68,103,116,32,52,22,0,35,52,59,160,3,51,36,110,41,116,0,4,
+    171,0,35,63,61,17,0,4,228,1,2,176,2,16,45,236,4,4,118,0,
+    3,44,0,36,41,44,118,7,112,10,35,32,83,111,117,114,79,5,240,2,
+    111,102,32,98,97,116,99,104,32,36,40,49,41,58,32,108,97,228,1,2,
+    88,1,17,32,120,4,2,230,1,2,189,5,32,103,104,57,2,2,49,0,
+    16,10,223,1,240,1,121,95,109,101,109,98,101,114,115,32,61,32,119,99,
+    32,45,37,8,6,234,0,240,31,32,124,32,103,114,101,112,32,45,118,32,
+    39,32,116,111,116,97,108,36,36,39,32,124,32,115,111,114,116,32,45,107,
+    49,44,49,110,114,32,45,107,50,32,124,32,97,119,107,39,0,36,110,61,
+    180,0,3,81,2,16,41,22,0,80,119,97,110,116,61,160,0,241,38,32,
+    39,123,32,98,101,115,116,32,61,32,49,59,32,102,111,114,32,40,105,32,
+    61,32,50,59,32,105,32,60,61,32,110,59,32,105,43,43,41,32,105,102,
+    32,40,108,111,97,100,91,105,93,32,60,32,10,0,0,54,0,36,93,41,
+    61,0,39,105,59,22,0,129,32,43,61,32,36,36,49,59,55,0,0,40,
+    0,64,32,61,61,32,115,0,212,41,32,112,114,105,110,116,32,36,36,50,
+    32,125,184,0,19,10,111,1,81,67,80,80,32,61,46,4,2,240,0,16,
+    79,2,9,16,10,255,7,8,16,0,4,221,5,1,20,0,1,164,4,1,
+    10,0,17,95,62,0,7,206,5,36,105,44,191,5,85,115,101,113,32,49,
+    48,2,4,6,1,33,41,44,254,2,17,47,116,1,2,6,0,81,95,36,
+    40,105,41,202,6,12,134,0,53,32,36,40,136,9,8,55,0,15,144,9,
+    11,5,153,0,44,41,41,199,0,15,81,0,18,4,234,8,0,29,5,3,
+    227,9,8,83,0,0,9,5,1,36,1,18,32,51,5,2,28,0,0,57,
+    5,8,94,0,0,199,10,15,167,0,11,2,223,2,5,33,1,12,219,2,
+    2,188,0,4,105,0,9,143,1,31,41,105,0,10,15,191,0,0,15,107,
+    0,14,2,169,6,20,10,179,2,82,67,80,80,41,58,65,5,2,163,1,
+    2,6,0,17,95,209,0,240,6,58,32,70,79,82,67,69,10,9,64,109,
+    107,100,105,114,32,45,112,32,36,40,9,0,96,36,64,41,10,9,64,204,
+    2,16,102,137,4,96,36,36,40,36,40,99,130,11,1,236,1,4,96,3,
+    48,44,36,42,50,4,34,100,111,9,4,35,34,35,217,11,80,32,92,34,
+    46,46,72,6,243,15,36,36,102,92,34,34,59,32,100,111,110,101,32,62,
+    32,36,64,46,116,109,112,10,9,64,99,109,112,32,45,115,16,0,48,32,
+    36,64,103,4,84,114,109,32,45,102,19,0,84,124,124,32,109,118,13,0,
+    36,36,64,14,10,208,66,101,110,99,104,109,97,114,107,115,32,40,98,12,
+    0,145,47,44,32,97,108,119,97,121,115,226,0,32,116,32,81,9,16,32,
+    97,1,1,114,7,2,36,6,80,66,69,78,67,72,229,4,1,252,6,5,
+    157,12,2,64,0,1,52,6,34,41,10,36,0,4,162,1,5,169,2,13,
+    250,1,2,53,0,7,78,2,2,143,1,16,45,217,4,0,45,0,1,129,
+    7,52,99,112,112,213,4,87,41,32,92,10,32,1,0,8,5,3,1,192,
+    0,1,135,1,4,143,12,6,94,0,2,10,0,3,178,2,2,157,0,32,
+    83,82,155,12,2,12,0,8,205,11,2,43,0,0,203,11,1,10,0,115,
+    95,114,117,110,110,101,114,210,0,112,65,82,71,83,32,63,61,64,1,4,
+    163,12,4,66,11,94,97,110,100,32,112,214,7,32,114,117,201,11,22,40,
+    204,7,240,4,46,109,107,41,10,80,82,79,70,73,76,69,95,84,65,82,
+    71,69,84,198,13,32,36,40,103,1,48,66,73,78,194,2,0,11,0,3,
+    54,3,0,11,0,9,71,3,5,178,0,0,41,0,2,13,0,0,43,0,
+    20,10,44,2,9,106,0,0,169,0,0,19,14,113,71,111,111,103,108,101,
+    84,86,5,193,61,61,10,35,32,79,110,99,101,32,97,32,234,5,3,58,
+    0,64,115,32,60,103,16,0,17,47,6,0,65,46,104,62,44,31,0,3,
+    66,8,0,185,11,10,102,11,52,10,35,32,159,1,66,41,32,97,114,248,
+    11,96,101,100,32,97,103,97,210,11,0,13,1,0,153,4,246,1,116,32,
+    97,114,99,104,105,118,101,115,32,102,114,111,109,32,160,0,64,39,115,10,
+    35,24,8,193,45,117,115,101,114,32,99,97,99,104,101,59,120,2,18,100,
+    131,0,0,28,12,1,116,11,17,97,229,11,2,164,6,224,105,116,46,10,
+    67,80,80,83,84,65,82,84,69,82,161,7,6,81,0,33,10,71,9,9,
+    53,68,73,82,11,10,1,204,0,6,207,10,2,184,7,2,176,6,49,108,
+    32,39,30,0,2,109,0,97,46,104,39,32,36,40,64,0,0,26,2,38,
+    32,50,63,11,0,253,10,1,25,0,101,82,85,78,78,69,82,251,2,1,
+    20,0,1,45,0,67,36,40,105,102,243,4,0,8,10,79,44,44,36,40,
+    201,2,13,2,180,9,3,177,0,34,69,80,3,2,3,15,0,48,73,82,
+    41,51,10,0,4,0,1,162,0,40,46,97,46,0,1,139,3,0,35,16,
+    167,105,115,121,115,116,101,109,32,36,40,56,0,3,205,1,152,32,45,112,
+    116,104,114,101,97,100,58,0,9,177,10,7,197,10,0,74,2,7,67,0,
+    3,57,11,3,123,0,10,95,0,8,28,0,17,95,255,1,22,97,107,0,
+    66,101,108,115,101,112,0,9,42,1,0,85,2,32,115,47,6,0,80,95,
+    109,97,116,104,207,6,4,13,11,208,46,68,69,70,65,85,76,84,95,71,
+    79,65,76,8,13,179,97,108,108,10,36,40,101,118,97,108,32,34,5,211,
+    80,67,72,95,82,85,76,69,83,44,68,66,71,34,7,1,188,14,3,20,
+    4,17,44,12,13,1,21,1,0,200,0,0,131,6,2,13,0,47,41,41,
+    74,0,6,51,82,69,76,74,0,3,18,6,15,76,0,3,0,124,3,15,
+    76,0,14,0,6,2,3,77,0,0,227,0,23,44,69,2,15,155,0,6,
+    48,32,45,73,44,0,0,51,10,0,63,0,18,95,125,1,5,107,0,67,
+    10,35,32,68,59,11,16,116,171,9,160,116,10,46,80,72,79,78,89,58,
+    32,51,6,129,99,108,101,97,110,32,114,117,4,0,19,45,193,0,1,171,
+    3,17,32,178,4,147,32,118,97,108,103,114,105,110,100,141,6,83,10,97,
+    108,108,58,158,2,0,96,4,0,20,4,2,35,18,0,159,3,99,100,32,
+    40,110,111,116,228,14,34,101,100,91,11,1,118,3,0,14,10,115,115,104,
+    97,114,101,100,32,241,14,33,32,99,17,15,16,100,89,1,0,104,1,0,
+    78,0,4,90,0,0,54,16,0,192,13,51,41,32,124,108,0,0,10,3,
+    15,10,7,4,1,179,1,0,174,1,4,18,19,0,12,0,0,82,0,2,
+    3,1,4,65,0,2,63,15,64,41,32,45,111,212,6,35,36,94,24,0,
+    11,186,2,0,214,2,2,84,17,0,100,7,16,101,227,14,24,34,224,0,
+    0,229,11,175,108,101,116,101,58,32,36,64,34,10,83,14,1,2,173,8,
+    0,176,0,0,206,0,7,186,3,4,25,0,2,42,14,0,91,11,0,165,
+    0,0,111,5,0,107,0,15,228,7,1,15,218,0,29,3,97,1,7,226,
+    0,8,207,0,3,124,8,1,168,1,10,93,19,17,58,140,5,16,37,76,
+    3,3,22,1,0,40,3,63,71,67,72,153,0,43,0,69,0,6,132,1,
+    3,71,18,17,41,243,11,18,60,135,1,34,10,10,21,1,6,148,6,4,
+    14,9,1,149,3,4,45,19,4,21,0,1,224,8,31,47,168,0,98,36,
+    35,32,163,7,1,64,1,19,10,42,3,0,227,1,0,217,3,0,189,2,
+    0,205,0,4,12,0,4,24,0,0,222,1,15,183,2,25,0,64,0,3,
+    51,1,12,198,1,3,219,19,0,147,1,2,151,2,9,145,0,27,32,153,
+    2,1,166,0,19,47,166,0,6,72,1,0,7,9,4,64,1,0,108,0,
+    0,163,1,15,232,1,29,0,56,0,3,164,0,2,104,8,0,69,0,5,
+    17,0,4,47,20,13,232,1,0,55,0,14,232,1,13,162,0,2,185,0,
+    10,234,1,0,59,0,0,101,0,15,170,0,82,37,35,32,201,10,0,24,
+    5,0,175,9,1,10,5,0,211,1,2,34,9,1,237,1,35,9,64,134,
+    1,98,117,110,110,105,110,103,46,5,1,254,10,182,46,46,46,34,10,9,
+    64,46,47,36,40,48,0,20,32,13,0,0,245,9,16,41,43,2,6,28,
+    0,6,90,0,15,47,2,65,18,10,82,1,1,196,0,15,9,2,0,15,
+    158,2,36,47,36,40,233,1,4,12,110,0,2,120,0,66,37,46,111,58,
+    35,1,2,191,3,15,118,0,36,33,45,73,79,0,0,165,4,15,79,4,
+    3,20,45,178,8,2,88,4,144,79,66,74,58,46,111,61,46,100,19,6,
+    0,70,2,9,17,0,2,130,1,6,19,0,0,204,6,21,65,95,10,113,
+    111,114,32,116,104,105,115,89,3,65,105,108,101,114,180,10,193,116,104,101,
+    115,101,32,102,108,97,103,115,44,94,10,0,144,18,32,99,101,121,10,16,
+    32,121,10,25,10,63,9,8,224,8,118,46,97,58,10,9,36,40,110,10,
+    33,41,32,20,9,34,32,45,66,23,8,57,0,80,32,45,45,102,101,98,
+    17,85,45,45,99,120,120,160,21,18,45,10,0,3,107,3,5,148,9,49,
+    10,35,32,140,11,3,222,7,0,12,8,4,49,5,2,70,5,0,127,12,
+    0,22,0,4,126,12,12,187,2,0,28,0,21,115,182,2,2,193,1,15,
+    58,0,3,3,76,2,15,29,0,2,0,198,2,1,128,8,6,175,9,0,
+    118,1,1,19,0,2,147,8,69,68,69,80,83,19,0,4,208,3,15,226,
+    7,65,10,16,9,0,106,0,3,52,1,3,79,9,2,143,0,3,20,0,
+    3,104,5,2,174,11,15,188,0,6,0,73,7,64,41,10,10,70,146,15,
+    16,58,41,2,20,86,24,9,3,119,1,4,40,9,0,7,1,0,216,7,
+    15,37,4,2,1,2,15,4,42,0,2,114,1,4,14,0,0,8,2,176,
+    101,97,107,45,99,104,101,99,107,61,102,105,23,240,13,45,45,116,114,97,
+    99,107,45,111,114,105,103,105,110,115,61,121,101,115,32,45,45,115,104,111,
+    119,45,108,43,0,96,107,105,110,100,115,61,198,9,0,108,4,5,117,0,
+    114,10,35,32,82,117,110,32,152,0,95,115,10,114,117,110,148,0,10,1,
+    205,1,1,204,2,18,100,146,0,1,186,4,6,78,0,52,114,117,110,24,
+    10,0,72,0,0,70,3,15,220,0,2,3,202,5,13,74,0,5,49,0,
+    80,10,35,32,67,108,110,10,2,154,0,17,10,123,10,36,58,10,142,2,
+    1,28,0,1,74,5,0,254,27,2,167,21,3,145,0,0,126,16,34,114,
+    102,90,0,0,124,1,67,72,101,108,112,224,0,86,10,104,101,108,112,69,
+    0,147,65,118,97,105,108,97,98,108,101,31,0,32,115,58,139,5,2,170,
+    5,17,32,241,10,3,240,15,49,45,32,66,103,0,2,254,0,4,230,24,
+    19,40,101,22,24,41,54,0,4,217,0,52,32,32,32,54,0,4,19,0,
+    3,56,0,9,46,0,35,117,110,99,0,5,46,0,48,97,110,100,74,6,
+    3,225,26,15,52,0,3,4,99,1,4,98,0,4,52,0,15,106,0,8,
+    0,183,3,3,107,0,12,54,0,0,27,0,24,115,150,0,2,55,5,1,
+    46,0,4,44,0,20,40,91,0,1,206,4,17,41,223,4,0,8,12,1,
+    43,0,1,201,6,8,65,0,5,167,2,0,5,1,51,82,117,110,205,0,
+    1,45,4,2,217,17,4,34,0,8,54,0,1,227,1,1,118,0,146,32,
+    45,32,82,101,109,111,118,101,198,1,2,223,1,8,43,0,0,200,1,2,
+    42,0,114,32,45,32,83,104,111,119,126,5,0,23,0,6,39,0,6,10,
+    0,32,79,112,138,30,10,223,1,1,238,24,2,68,0,38,45,32,20,25,
+    0,137,23,2,34,24,179,102,114,101,113,117,101,110,116,108,121,32,40,6,
+    35,100,32,247,14,2,6,29,9,52,1,1,173,8,32,61,49,81,0,18,
+    45,202,24,35,32,115,3,23,1,9,28,1,32,0,5,202,23,1,178,8,
+    14,205,24,6,178,0,0,72,0,7,4,0,82,40,115,107,105,112,7,1,
+    2,64,1,2,79,0,3,158,20,32,61,39,170,9,17,97,146,11,73,46,
+    46,46,39,145,2,2,7,27,2,89,29,24,45,73,29,32,44,32,225,27,
+    80,47,108,108,100,47,225,27,1,211,1,97,97,32,103,100,98,32,39,27,
+    1,255,22,2,241,2,1,184,1,9,238,0,2,8,13,1,239,0,48,45,
+    32,76,212,29,0,130,0,1,155,0,0,64,19,1,158,15,48,99,112,112,
+    99,25,35,97,32,105,12,4,202,13,68,40,102,97,115,246,13,25,115,171,
+    0,3,155,18,16,61,77,25,1,3,2,4,138,31,1,93,30,2,84,7,
+    1,128,2,2,207,17,3,255,18,32,115,47,48,0,71,46,109,107,32,235,
+    18,89,32,116,117,110,101,93,0,2,192,7,0,81,9,0,107,3,0,178,
+    19,0,183,2,34,32,111,27,2,144,44,32,101,46,103,46,32,39,45,127,
+    29,0,247,26,2,68,24,80,45,106,115,111,110,97,30,16,46,9,0,48,
+    39,34,10,243,44,35,32,123,123,112,114,111,106,101,99,116,95,110,97,109,
+    101,125,125,10,10,84,104,105,115,32,105,115,32,97,110,32,97,117,116,111,
+    109,97,116,105,99,97,108,108,121,32,103,101,110,101,114,97,116,101,100,32,
+    67,43,43,32,55,0,208,32,117,115,105,110,103,32,109,111,100,101,114,110,
+    25,0,240,58,49,55,32,115,116,97,110,100,97,114,100,115,46,10,10,35,
+    35,32,81,117,105,99,107,32,83,116,97,114,116,10,10,96,96,96,98,97,
+    115,104,10,35,32,66,117,105,108,100,32,97,110,100,32,114,117,110,32,100,
+    101,98,117,103,32,118,101,114,115,105,111,110,10,109,97,107,101,23,0,29,
+    10,40,0,125,114,101,108,101,97,115,101,42,0,19,45,25,0,0,50,0,
+    146,82,117,110,32,116,101,115,116,115,72,0,0,11,0,4,23,0,147,98,
+    101,110,99,104,109,97,114,107,28,0,1,16,0,0,29,0,242,14,77,101,
+    109,111,114,121,32,97,110,97,108,121,115,105,115,32,119,105,116,104,32,118,
+    97,108,103,114,105,110,100,72,0,5,14,0,49,96,96,96,217,0,2,194,
+    0,99,83,121,115,116,101,109,56,1,6,22,1,210,101,115,32,97,32,77,
+    97,107,101,102,105,108,101,79,0,160,116,104,101,32,102,111,108,108,111,119,
+    51,1,208,116,97,114,103,101,116,115,58,10,10,45,32,96,241,0,66,96,
+    32,111,114,10,0,115,32,97,108,108,96,32,45,35,1,10,27,1,3,45,
+    0,19,32,240,0,6,39,0,148,111,112,116,105,109,105,122,101,100,27,0,
+    5,36,1,5,51,0,38,117,110,47,0,31,97,121,1,2,7,43,0,4,
+    82,1,14,51,0,3,123,0,13,96,0,0,105,1,14,46,0,0,22,0,
+    20,115,228,0,17,32,113,1,14,37,0,1,23,0,1,152,1,6,43,1,
+    4,103,0,70,102,108,97,103,65,0,4,134,1,0,68,0,21,82,57,2,
+    17,98,77,2,1,181,1,26,109,202,1,5,122,0,65,99,108,101,97,0,
+    1,96,82,101,109,111,118,101,100,1,18,32,55,0,0,162,1,6,97,0,
+    64,104,101,108,112,93,0,243,0,83,104,111,119,32,97,118,97,105,108,97,
+    98,108,101,32,175,1,240,29,10,10,80,97,115,115,32,96,80,67,72,61,
+    49,96,32,40,111,114,32,115,101,116,32,96,112,99,104,32,61,32,116,114,
+    117,101,96,32,105,110,32,96,99,112,112,115,242,2,160,101,114,46,99,111,
+    110,102,96,32,102,221,1,6,22,0,2,123,0,208,96,41,10,116,111,32,
+    112,114,101,99,111,109,112,40,2,0,35,2,241,11,109,111,115,116,32,102,
+    114,101,113,117,101,110,116,108,121,32,105,110,99,108,117,100,101,100,32,115,
+    106,2,240,10,32,104,101,97,100,101,114,115,44,32,111,110,101,32,96,46,
+    103,99,104,96,32,112,101,114,10,104,0,146,105,103,117,114,97,116,105,111,
+    110,123,3,22,66,239,2,22,10,12,0,81,32,108,105,118,101,166,0,1,
+    119,1,33,47,96,134,3,64,117,115,101,32,127,0,115,98,117,110,100,108,
+    101,100,103,0,34,32,96,36,0,1,6,0,97,46,104,112,112,96,58,197,
+    3,96,99,112,112,10,115,116,28,4,241,4,32,118,111,105,100,32,98,109,
+    95,112,117,115,104,95,98,97,99,107,40,45,0,128,58,58,83,116,97,116,
+    101,38,15,4,145,116,101,41,32,123,10,32,32,32,7,1,16,40,88,4,
+    74,32,95,32,58,27,0,0,31,0,241,4,115,116,100,58,58,118,101,99,
+    116,111,114,60,105,110,116,62,32,118,59,55,0,0,28,0,0,66,1,242,
+    0,40,105,110,116,32,105,32,61,32,48,59,32,105,32,60,65,0,246,3,
+    46,114,97,110,103,101,40,48,41,59,32,43,43,105,41,32,118,46,139,0,
+    38,105,41,65,0,3,151,0,99,68,111,78,111,116,79,46,3,147,40,118,
+    46,100,97,116,97,40,41,40,0,17,125,111,0,0,218,0,242,7,101,46,
+    115,101,116,95,105,116,101,109,115,95,112,114,111,99,101,115,115,101,100,40,
+    26,0,32,105,116,10,5,139,105,111,110,115,40,41,32,42,134,0,184,41,
+    59,10,125,10,66,69,78,67,72,40,22,1,50,41,45,62,168,0,144,56,
+    44,32,52,48,57,54,41,59,13,5,33,10,10,252,3,4,24,3,0,80,
+    2,7,60,2,3,23,0,112,41,32,108,105,110,107,115,159,1,18,109,32,
+    3,208,101,118,101,114,121,32,96,115,114,99,47,96,32,192,2,112,32,101,
+    120,99,101,112,116,78,0,243,0,105,110,46,99,112,112,96,44,32,97,108,
+    119,97,121,115,162,5,0,219,1,9,82,3,98,46,32,69,97,99,104,98,
+    0,0,122,3,0,244,5,160,119,97,114,109,101,100,32,117,112,44,108,0,
+    32,110,10,53,0,5,236,0,64,32,99,111,117,126,1,113,115,32,99,97,
+    108,105,98,11,6,192,46,32,77,101,97,110,44,32,109,101,100,105,8,0,
+    49,112,57,57,77,2,96,115,116,100,100,101,118,151,2,21,32,64,0,240,
+    4,10,97,114,101,32,114,101,112,111,114,116,101,100,44,32,112,108,117,115,
+    29,0,48,109,115,47,109,6,96,100,32,98,121,116,101,12,0,64,119,104,
+    101,110,127,0,2,112,0,64,101,114,115,32,57,0,192,115,101,116,46,32,
+    85,115,101,102,117,108,10,235,4,240,8,111,110,115,58,32,96,45,45,102,
+    105,108,116,101,114,32,60,116,101,120,116,62,96,44,19,0,96,106,115,111,
+    110,32,60,22,1,3,17,0,163,115,97,109,112,108,101,115,32,60,110,17,
+    0,241,6,109,105,110,45,116,105,109,101,32,60,115,62,96,46,10,70,111,
+    114,32,101,120,37,0,19,58,130,5,1,44,2,17,32,198,1,117,95,65,
+    82,71,83,61,34,107,0,98,115,111,114,116,34,96,97,3,18,80,61,7,
+    177,32,83,116,114,117,99,116,117,114,101,10,213,1,12,86,7,192,47,10,
+    226,148,156,226,148,128,226,148,128,32,180,1,0,207,2,3,4,0,129,35,
+    32,83,111,117,114,99,101,198,1,23,115,40,0,3,247,3,21,47,40,0,
+    17,72,248,3,13,40,0,1,96,5,4,38,0,96,32,32,35,32,84,101,
+    64,4,56,105,108,101,78,0,1,208,0,8,38,0,7,15,4,2,176,3,
+    0,221,3,151,32,104,97,114,110,101,115,115,41,136,0,1,36,5,9,58,
+    0,1,108,5,161,97,114,116,105,102,97,99,116,115,32,207,3,21,45,30,
+    8,8,60,0,5,0,7,2,197,0,4,245,7,9,170,4,67,10,226,148,
+    148,27,1,148,82,69,65,68,77,69,46,109,100,47,0,1,140,8,0,201,
+    1,1,86,1,0,77,8,18,67,41,5,49,114,32,70,22,6,96,10,45,
+    32,42,42,68,60,8,32,42,42,15,2,241,20,87,97,108,108,32,45,87,
+    101,120,116,114,97,32,45,87,112,101,100,97,110,116,105,99,32,45,103,32,
+    45,68,68,69,66,85,71,96,51,0,18,82,71,8,15,53,0,1,103,79,
+    50,32,45,68,78,44,0,19,83,207,8,0,45,0,81,67,43,43,49,55,
+    253,7,192,68,101,112,101,110,100,101,110,99,105,101,115,195,7,146,71,67,
+    67,47,67,108,97,110,103,161,3,1,41,0,64,32,115,117,112,239,2,33,
+    10,45,10,8,67,10,45,32,86,82,8,34,32,40,196,2,49,97,108,44,
+    19,5,11,181,6,32,41,10,247,25,35,32,99,112,112,115,116,97,114,116,
+    101,114,32,112,114,111,106,101,99,116,32,115,101,116,116,105,110,103,115,44,
+    32,114,101,97,100,32,98,121,32,96,38,0,240,121,98,117,105,108,100,96,
+    32,97,110,100,32,114,101,108,97,116,101,100,32,99,111,109,109,97,110,100,
+    115,10,10,35,32,80,114,101,99,111,109,112,105,108,101,32,116,104,101,32,
+    109,111,115,116,32,102,114,101,113,117,101,110,116,108,121,32,105,110,99,108,
+    117,100,101,100,32,115,121,115,116,101,109,32,104,101,97,100,101,114,115,32,
+    40,111,110,101,32,46,103,99,104,32,112,101,114,32,99,111,110,102,105,103,
+    117,114,97,116,105,111,110,41,10,112,99,104,32,61,32,123,123,112,99,104,
+    95,101,110,97,98,108,101,100,125,125,109,0,241,25,77,101,114,103,101,32,
+    115,114,99,47,32,105,110,116,111,32,117,110,105,116,121,32,98,97,116,99,
+    104,101,115,32,102,111,114,32,101,118,101,114,121,32,180,0,45,32,40,199,
+    0,49,32,45,45,51,0,113,91,61,78,93,96,10,35,50,0,0,137,0,
+    1,48,0,34,41,46,80,0,20,95,80,0,161,61,32,48,32,109,97,107,
+    101,115,32,36,0,0,102,0,1,174,0,178,56,32,102,105,108,101,115,44,
+    32,97,116,240,0,67,52,59,10,35,60,0,33,101,120,240,0,98,32,108,
+    105,115,116,115,40,0,48,32,116,104,41,0,96,117,115,116,32,98,101,60,
+    1,0,45,1,64,100,32,111,110,49,1,145,105,114,32,111,119,110,46,10,
+    117,202,0,114,61,32,102,97,108,115,101,14,0,23,95,136,0,3,18,0,
+    4,94,0,16,61,13,1,144,70,97,115,116,45,108,105,110,107,201,1,0,
+    146,0,1,207,0,81,100,101,98,117,103,174,1,32,116,101,114,0,0,190,
+    1,31,115,11,1,3,20,102,65,0,240,6,96,41,58,10,35,32,45,103,
+    115,112,108,105,116,45,100,119,97,114,102,44,32,90,0,240,5,101,114,32,
+    61,32,97,117,116,111,124,109,111,108,100,124,108,108,100,124,103,9,0,144,
+    100,101,102,97,117,108,116,32,40,28,0,33,32,116,36,1,0,254,1,0,
+    82,0,241,19,101,115,116,10,35,32,105,110,115,116,97,108,108,101,100,41,
+    32,119,105,116,104,32,45,45,103,100,98,45,105,110,100,101,120,44,158,0,
+    1,22,0,0,48,0,16,95,105,0,112,95,115,104,97,114,101,100,18,1,
+    129,32,99,111,100,101,32,105,110,231,1,34,10,35,136,0,115,100,32,97,
+    115,32,97,32,38,0,162,108,105,98,114,97,114,121,32,115,111,92,1,16,
+    97,161,1,17,45,3,1,96,99,104,97,110,103,101,170,2,48,105,110,107,
+    185,1,33,108,121,36,0,37,46,10,108,0,20,32,102,1,0,121,0,5,
+    226,0,6,32,0,4,140,0,4,39,0,1,229,2,16,111,94,0,64,45,
+    103,117,105,204,2,113,111,112,116,105,109,105,122,174,2,10,91,1,243,17,
+    114,117,110,45,114,101,108,101,97,115,101,32,45,45,112,103,111,96,41,46,
+    10,35,32,112,103,111,95,116,114,97,105,110,24,2,1,12,0,241,4,105,
+    110,103,32,119,111,114,107,108,111,97,100,115,32,115,101,112,97,114,94,3,
+    208,98,121,32,39,59,39,58,32,115,104,101,108,108,48,2,2,108,3,241,
+    13,35,32,40,36,67,80,80,83,84,65,82,84,69,82,95,80,71,79,95,
+    66,73,78,65,82,89,32,105,115,56,1,0,115,1,80,114,117,109,101,110,
+    163,3,192,98,105,110,97,114,121,41,32,111,114,32,96,9,2,17,96,29,
+    2,96,116,104,101,10,35,32,16,0,242,2,32,115,117,105,116,101,46,32,
+    69,109,112,116,121,32,114,117,110,68,0,246,1,112,114,111,103,114,97,109,
+    32,105,116,115,101,108,102,46,10,185,0,17,61,12,0,53,108,116,111,63,
+    1,1,28,0,97,105,109,105,110,103,95,64,0,48,61,32,51,151,2,250,
+    1,80,101,114,102,111,114,109,97,110,99,101,32,103,97,116,101,33,1,65,
+    112,101,114,102,22,0,240,3,45,45,115,97,118,101,45,98,97,115,101,108,
+    105,110,101,124,45,45,71,4,162,97,114,101,32,60,110,97,109,101,62,57,
+    1,20,65,0,1,82,32,102,97,105,108,164,0,1,63,0,64,119,104,101,
+    110,166,0,112,32,109,101,100,105,97,110,4,1,48,109,111,114,132,4,32,
+    97,110,165,3,1,101,0,160,95,116,104,114,101,115,104,111,108,100,132,1,
+    209,101,114,99,101,110,116,32,115,108,111,119,101,114,132,2,0,179,2,112,
+    100,105,102,102,101,114,101,174,0,244,15,105,115,32,115,116,97,116,105,115,
+    116,105,99,97,108,108,121,32,115,105,103,110,105,102,105,99,97,110,116,46,
+    10,186,0,4,237,0,38,49,48,19,0,166,119,97,114,109,117,112,32,61,
+    32,49,20,0,5,124,0,64,32,61,32,53,25,1,19,82,24,2,33,112,
+    114,77,2,35,32,40,9,0,34,115,47,242,0,204,46,109,107,44,32,119,
+    114,105,116,116,101,110,133,5,160,116,117,110,101,96,41,32,117,115,101,160,
+    5,32,10,35,225,2,1,101,2,0,151,5,82,98,101,110,99,104,244,4,
+    64,115,44,32,96,179,4,4,32,0,21,96,129,5,4,235,1,179,107,101,
+    101,112,115,32,45,79,50,46,10,169,2,19,95,136,0,48,32,61,10,240,
+    15,35,105,110,99,108,117,100,101,32,60,105,111,115,116,114,101,97,109,62,
+    10,10,105,110,116,32,109,97,105,110,40,9,0,241,48,97,114,103,99,44,
+    32,99,104,97,114,42,32,97,114,103,118,91,93,41,32,123,10,32,32,32,
+    32,47,47,32,83,117,112,112,114,101,115,115,32,117,110,117,115,101,100,32,
+    112,97,114,97,109,101,116,101,114,32,119,97,114,110,105,110,103,115,42,0,
+    96,40,118,111,105,100,41,74,0,26,59,16,0,18,118,16,0,1,21,0,
+    240,24,115,116,100,58,58,99,111,117,116,32,60,60,32,34,72,101,108,108,
+    111,44,32,123,123,112,114,111,106,101,99,116,95,110,97,109,101,125,125,33,
+    34,30,0,1,43,0,66,101,110,100,108,63,0,192,114,101,116,117,114,110,
+    32,48,59,10,125,10,246,4,35,105,110,99,108,117,100,101,32,60,99,97,
+    115,115,101,114,116,62,10,19,0,241,25,105,111,115,116,114,101,97,109,62,
+    10,10,47,47,32,83,105,109,112,108,101,32,116,101,115,116,32,102,114,97,
+    109,101,119,111,114,107,10,118,111,105,100,20,0,242,5,95,98,97,115,105,
+    99,95,109,97,116,104,40,41,32,123,10,32,32,32,32,83,0,216,40,50,
+    32,43,32,50,32,61,61,32,52,41,59,24,0,80,53,32,42,32,51,24,
+    0,42,49,53,25,0,96,49,48,32,45,32,55,26,0,19,51,25,0,240,
+    4,115,116,100,58,58,99,111,117,116,32,60,60,32,34,226,156,147,32,66,
+    111,0,16,32,111,0,1,127,0,48,115,32,112,110,0,32,100,34,33,0,
+    1,46,0,245,2,101,110,100,108,59,10,125,10,10,105,110,116,32,109,97,
+    105,110,151,0,1,31,0,5,77,0,114,82,117,110,110,105,110,103,70,0,
+    60,46,46,46,66,0,0,201,0,1,182,0,51,116,114,121,216,0,0,19,
+    0,0,8,1,9,244,0,2,219,0,0,27,0,10,96,0,146,92,110,226,
+    156,133,32,65,108,108,98,0,3,168,0,31,33,103,0,1,0,61,0,130,
+    114,101,116,117,114,110,32,48,79,0,241,0,125,32,99,97,116,99,104,32,
+    40,99,111,110,115,116,32,90,0,196,101,120,99,101,112,116,105,111,110,38,
+    32,101,106,1,0,58,0,1,29,0,5,215,0,81,226,157,140,32,84,172,
+    1,113,97,105,108,101,100,58,32,113,0,139,101,46,119,104,97,116,40,41,
+    38,1,0,63,0,0,4,0,3,125,0,19,49,125,0,48,10,125,10,240,
+    56,67,88,88,32,61,32,103,43,43,10,79,80,84,73,77,73,90,65,84,
+    73,79,78,95,76,69,86,69,76,32,61,32,45,79,50,10,83,82,67,32,
+    61,32,36,40,119,105,108,100,99,97,114,100,32,115,114,99,47,42,46,99,
+    112,112,41,10,73,78,67,76,85,68,69,83,43,0,240,16,73,105,110,99,
+    108,117,100,101,10,10,35,32,83,70,77,76,32,108,105,110,107,105,110,103,
+    32,102,108,97,103,115,10,19,0,65,95,76,73,66,44,0,242,1,108,115,
+    102,109,108,45,103,114,97,112,104,105,99,115,32,45,16,0,100,119,105,110,
+    100,111,119,14,0,96,115,121,115,116,101,109,78,0,242,5,84,104,114,101,
+    97,100,80,111,111,108,32,114,117,110,115,32,116,104,101,32,30,0,177,115,
+    32,111,110,32,115,116,100,58,58,116,36,0,245,0,32,119,111,114,107,101,
+    114,115,10,84,72,82,69,65,68,112,0,18,112,31,0,0,77,0,241,21,
+    61,61,61,32,68,101,98,117,103,32,99,111,110,102,105,103,117,114,97,116,
+    105,111,110,32,61,61,61,10,68,66,71,95,70,76,65,71,164,0,116,87,
+    97,108,108,32,36,40,227,0,65,41,32,45,103,33,0,49,79,66,74,16,
+    1,129,112,97,116,115,117,98,115,116,16,1,16,37,16,1,144,44,32,98,
+    117,105,108,100,47,100,95,0,241,2,47,111,98,106,47,37,46,111,44,32,
+    36,40,83,82,67,41,41,61,0,89,66,73,78,32,61,39,0,240,6,98,
+    105,110,47,123,123,112,114,111,106,101,99,116,95,110,97,109,101,125,125,10,
+    40,1,112,95,68,69,66,85,71,32,123,1,5,60,1,71,41,32,36,40,
+    219,0,20,41,209,0,127,82,101,108,101,97,115,101,211,0,0,63,82,69,
+    76,211,0,8,46,36,40,247,1,32,41,10,52,0,15,230,0,15,18,114,
+    116,0,14,232,0,0,63,0,8,232,0,4,41,0,15,234,0,2,52,10,
+    35,32,189,0,240,52,112,114,111,102,105,108,101,32,97,110,100,32,112,114,
+    101,99,111,109,112,105,108,101,100,32,104,101,97,100,101,114,32,114,117,108,
+    101,115,32,40,99,112,112,115,116,97,114,116,101,114,46,109,107,41,10,80,
+    82,79,70,73,76,69,95,84,65,82,71,69,84,185,1,35,36,40,129,0,
+    0,45,1,0,11,0,83,79,66,74,41,10,157,2,25,32,63,0,2,104,
+    1,127,82,69,76,69,65,83,69,106,1,15,128,69,109,105,116,32,46,100,
+    32,166,0,240,2,115,32,110,101,120,116,32,116,111,32,101,97,99,104,32,
+    111,98,191,1,52,32,115,111,174,0,176,101,100,105,116,115,32,116,114,105,
+    103,103,188,0,4,206,0,85,115,10,68,69,80,99,2,240,20,77,77,68,
+    32,45,77,80,10,10,46,68,69,70,65,85,76,84,95,71,79,65,76,32,
+    58,61,32,97,108,108,10,36,40,101,118,97,131,2,16,99,138,2,231,80,
+    67,72,95,82,85,76,69,83,44,68,66,71,44,105,2,18,44,96,2,53,
+    44,36,40,191,2,63,41,41,41,62,0,6,51,82,69,76,62,0,3,152,
+    1,6,64,0,0,45,1,1,156,0,0,64,0,98,10,97,108,108,58,32,
+    85,0,102,66,73,78,41,10,10,12,0,4,24,0,1,90,1,192,9,109,
+    107,100,105,114,32,45,112,32,36,40,9,0,160,36,64,41,10,9,36,40,
+    67,88,88,129,1,6,148,0,198,32,45,111,32,36,64,32,36,94,32,36,
+    40,224,2,55,41,10,10,204,0,4,77,2,22,58,85,3,3,131,0,0,
+    255,0,95,71,67,72,41,10,111,0,22,2,175,0,0,56,0,2,212,0,
+    0,73,0,3,124,1,114,41,32,45,99,32,36,60,146,0,35,10,10,9,
+    1,0,214,0,0,3,1,4,238,0,4,12,0,4,24,0,15,238,0,16,
+    0,51,0,3,110,0,12,238,0,3,102,2,5,240,0,3,117,0,15,242,
+    0,3,0,72,0,0,186,0,15,242,0,16,0,43,0,3,115,0,2,250,
+    2,0,56,0,5,17,0,4,110,2,11,242,0,20,45,15,3,2,37,1,
+    144,79,66,74,58,46,111,61,46,100,178,1,0,81,0,6,17,0,0,98,
+    4,240,6,84,104,101,32,69,67,83,32,99,111,114,101,32,40,101,118,101,
+    114,121,116,104,218,5,128,98,117,116,32,109,97,105,110,253,4,1,183,3,
+    0,154,5,241,3,114,101,110,100,101,114,101,114,41,32,110,101,101,100,115,
+    32,110,111,15,6,48,44,10,35,31,3,0,34,0,85,116,101,115,116,115,
+    48,0,146,98,101,110,99,104,109,97,114,107,23,5,1,24,0,242,11,114,
+    117,110,32,119,105,116,104,111,117,116,32,97,32,100,105,115,112,108,97,121,
+    10,69,67,83,95,142,6,0,131,6,3,2,6,1,124,0,0,16,0,2,
+    227,5,80,95,112,111,111,108,20,0,32,10,10,103,0,23,58,48,2,8,
+    104,2,63,98,105,110,165,2,4,16,73,55,0,16,115,27,2,11,48,0,
+    16,47,25,0,160,95,114,101,103,105,115,116,114,121,32,14,0,26,115,20,
+    0,0,119,0,51,32,36,40,167,0,0,76,1,9,172,5,63,9,46,47,
+    83,0,10,241,1,10,10,69,78,84,73,84,73,69,83,32,63,61,32,49,
+    48,1,0,84,10,84,73,67,75,17,0,17,10,44,1,14,212,0,4,76,
+    2,10,214,0,0,201,1,3,9,2,34,45,111,93,1,23,47,42,0,17,
+    47,77,0,81,95,101,99,115,32,10,0,6,16,0,15,200,0,21,15,77,
+    0,3,36,36,40,199,0,1,2,1,0,191,0,176,41,10,10,118,97,108,
+    103,114,105,110,100,77,3,0,20,4,1,101,3,20,9,22,0,242,26,32,
+    45,45,108,101,97,107,45,99,104,101,99,107,61,102,117,108,108,32,45,45,
+    116,114,97,99,107,45,111,114,105,103,105,110,115,61,121,101,115,32,46,47,
+    176,2,1,61,0,74,10,114,117,110,78,0,13,31,0,19,45,162,0,0,
+    39,0,0,14,1,1,56,0,16,9,39,0,5,14,0,242,0,10,99,108,
+    101,97,110,58,10,9,114,109,32,45,114,102,39,1,240,0,10,10,104,101,
+    108,112,58,32,35,35,32,83,104,111,119,114,8,48,105,115,32,20,0,245,
+    13,10,9,64,101,99,104,111,32,34,65,118,97,105,108,97,98,108,101,32,
+    116,97,114,103,101,116,115,58,34,28,0,16,32,191,5,20,32,1,0,48,
+    45,32,66,22,8,17,32,22,8,80,32,118,101,114,115,111,8,152,40,100,
+    101,102,97,117,108,116,41,55,0,3,175,0,1,58,0,4,55,0,145,111,
+    112,116,105,109,105,122,101,100,131,3,97,97,112,112,108,105,99,178,8,8,
+    57,0,0,141,2,1,54,0,98,32,32,32,45,32,67,58,7,5,74,3,
+    0,116,3,0,192,3,0,38,0,51,115,32,40,145,3,1,159,3,41,101,
+    100,129,0,1,9,2,3,73,0,244,15,45,32,84,105,109,101,32,111,110,
+    101,32,109,111,118,101,109,101,110,116,32,116,105,99,107,32,111,118,101,114,
+    32,228,1,112,32,101,110,116,105,116,105,154,7,3,210,0,4,186,2,9,
+    89,0,0,209,3,3,88,0,108,32,45,32,82,117,110,206,0,51,32,105,
+    110,34,1,72,109,111,100,101,220,0,52,114,117,110,200,1,15,59,0,7,
+    4,58,1,12,61,0,5,97,2,1,25,1,0,120,0,2,135,1,7,72,
+    1,1,105,4,20,32,41,0,8,122,0,1,27,2,3,182,0,64,45,32,
+    82,101,7,1,1,219,1,5,155,8,2,10,8,248,0,97,110,100,32,100,
+    105,114,101,99,116,111,114,105,101,115,67,0,0,52,2,3,66,0,33,32,
+    45,77,2,51,32,116,104,76,2,6,40,0,6,10,0,32,79,112,141,10,
+    10,77,2,83,80,67,72,61,49,69,0,68,45,32,80,114,76,8,1,8,
+    11,243,1,109,111,115,116,32,102,114,101,113,117,101,110,116,108,121,32,217,
+    5,19,100,33,11,3,143,8,9,148,0,3,51,9,16,61,108,10,0,82,
+    1,2,200,9,19,32,213,0,17,114,55,2,1,180,11,99,32,102,114,111,
+    109,32,151,9,32,115,47,48,0,56,46,109,107,131,9,241,9,32,116,117,
+    110,101,41,34,10,10,70,79,82,67,69,58,10,10,46,80,72,79,78,89,
+    58,38,1,4,148,1,0,119,2,2,99,4,0,191,11,0,4,0,5,208,
+    1,4,118,1,18,32,107,1,1,46,1,1,75,0,0,240,97,47,47,32,
+    67,111,115,116,32,112,101,114,32,101,110,116,105,116,121,32,111,102,32,111,
+    110,101,32,109,111,118,101,109,101,110,116,32,116,105,99,107,32,111,118,101,
+    114,32,97,32,108,97,114,103,101,32,119,111,114,108,100,44,32,115,105,110,
+    103,108,101,45,116,104,114,101,97,100,101,100,10,47,47,32,97,110,100,32,
+    111,110,32,101,118,101,114,121,32,99,111,114,101,59,32,110,101,101,100,115,
+    32,110,111,32,83,70,77,76,58,37,0,241,10,32,32,109,97,107,101,32,
+    98,101,110,99,104,32,91,69,78,84,73,84,73,69,83,61,49,48,1,0,
+    113,93,32,91,84,73,67,75,16,0,247,7,93,10,35,105,110,99,108,117,
+    100,101,32,60,97,108,103,111,114,105,116,104,109,62,21,0,105,99,104,114,
+    111,110,111,18,0,104,115,116,100,108,105,98,19,0,122,105,111,109,97,110,
+    105,112,19,0,134,115,116,114,101,97,109,62,10,77,0,231,34,99,111,109,
+    112,111,110,101,110,116,115,46,104,34,24,0,138,114,101,103,105,115,116,114,
+    121,22,0,107,115,121,115,116,101,109,43,0,2,12,1,80,95,112,111,111,
+    108,46,0,0,238,0,144,66,101,115,116,45,111,102,45,96,72,1,124,115,
+    96,32,116,105,109,101,100,1,17,83,76,0,240,19,32,99,97,108,108,44,
+    32,105,110,32,110,97,110,111,115,101,99,111,110,100,115,10,115,116,97,116,
+    105,99,32,100,111,117,98,108,53,1,131,115,116,84,105,99,107,40,82,149,
+    0,36,38,32,159,0,0,58,0,2,174,1,65,115,44,32,84,149,1,98,
+    80,111,111,108,42,32,149,0,242,8,115,41,32,123,10,32,32,32,32,99,
+    111,110,115,116,32,66,111,117,110,100,115,32,98,7,0,224,61,32,123,49,
+    50,56,48,46,48,102,44,32,55,50,8,0,33,125,59,45,0,7,119,0,
+    114,32,61,32,49,101,51,48,24,0,100,102,111,114,32,40,105,30,2,66,
+    61,32,48,59,40,2,17,60,7,0,80,115,59,32,43,43,240,0,4,116,
+    0,6,120,0,242,3,97,117,116,111,32,115,116,97,114,116,32,61,32,115,
+    116,100,58,58,196,1,242,6,58,58,115,116,101,97,100,121,95,99,108,111,
+    99,107,58,58,110,111,119,40,41,108,0,0,61,0,4,142,2,2,42,1,
+    22,40,244,0,128,49,46,48,102,32,47,32,54,180,0,19,44,207,0,21,
+    44,243,0,6,65,0,53,98,101,115,114,0,64,109,105,110,40,16,0,26,
+    44,129,0,146,100,117,114,97,116,105,111,110,60,245,0,3,30,0,0,140,
+    1,47,62,40,170,0,13,34,32,45,213,0,147,41,46,99,111,117,110,116,
+    40,41,188,0,17,125,70,1,112,114,101,116,117,114,110,32,116,0,80,59,
+    10,125,10,10,57,1,65,109,97,105,110,66,1,244,3,97,114,103,99,44,
+    32,99,104,97,114,42,32,97,114,103,118,91,93,54,1,2,170,1,1,123,
+    0,98,115,105,122,101,95,116,163,3,80,105,101,115,32,61,43,0,114,99,
+    32,62,32,49,32,63,198,0,129,115,116,114,116,111,117,108,40,67,0,243,
+    4,49,93,44,32,110,117,108,108,112,116,114,44,32,49,48,41,32,58,32,
+    95,3,2,18,1,2,90,0,0,135,0,0,166,1,7,79,0,20,50,79,
+    0,66,97,116,111,105,76,0,35,50,93,63,0,33,59,10,205,0,4,122,
+    2,5,121,2,2,83,0,96,115,112,97,119,110,69,67,4,55,105,101,115,
+    161,1,1,86,4,78,105,101,115,44,99,2,3,36,1,6,172,2,4,184,
+    1,3,106,0,2,166,0,2,142,1,177,32,112,97,114,97,108,108,101,108,
+    32,61,72,1,1,5,3,6,7,2,132,116,105,99,107,115,44,32,38,236,
+    2,2,148,0,9,65,0,95,115,101,114,105,97,63,0,11,3,51,1,19,
+    41,128,0,1,122,1,118,99,111,117,116,32,60,60,123,1,69,60,60,32,
+    34,14,0,17,44,141,0,0,208,3,16,34,37,0,1,135,0,0,9,0,
+    18,34,8,3,49,58,92,110,24,0,1,74,0,80,102,105,120,101,100,29,
+    0,1,14,0,241,0,115,101,116,112,114,101,99,105,115,105,111,110,40,51,
+    41,91,1,0,234,2,2,4,0,1,101,0,35,32,49,17,1,0,20,0,
+    6,72,0,113,115,101,116,119,40,56,41,74,0,2,212,0,80,47,32,49,
+    101,54,16,0,80,34,32,109,115,47,133,0,62,32,32,34,82,0,3,2,
+    1,21,47,190,0,2,51,0,49,110,115,47,165,1,63,121,92,110,53,0,
+    0,49,34,32,32,123,0,3,90,1,16,46,138,2,17,40,125,0,19,34,
+    158,0,50,40,115,41,35,0,4,216,0,4,158,0,5,179,1,15,160,0,
+    20,7,48,0,1,145,0,0,233,2,1,9,1,5,162,0,49,32,32,40,
+    141,0,4,106,0,6,66,1,17,50,147,0,5,226,0,5,75,0,0,64,
+    0,83,120,41,92,110,34,212,1,241,5,47,47,32,85,115,101,32,116,104,
+    101,32,114,101,115,117,108,116,32,115,111,14,0,241,17,117,112,100,97,116,
+    101,115,32,99,97,110,110,111,116,32,98,101,32,111,112,116,105,109,105,122,
+    101,100,32,97,119,97,121,79,1,240,2,102,108,111,97,116,32,99,104,101,
+    99,107,115,117,109,32,61,32,119,4,2,108,2,4,140,2,160,46,101,97,
+    99,104,60,80,111,115,105,76,4,97,62,40,91,38,93,40,23,3,35,121,
+    44,123,5,4,28,0,51,38,32,112,38,0,54,41,32,123,85,0,37,43,
+    61,24,0,83,46,120,59,32,125,38,3,18,114,68,4,5,124,0,17,60,
+    124,0,192,32,63,32,49,32,58,32,48,59,10,125,10,247,27,35,112,114,
+    97,103,109,97,32,111,110,99,101,10,10,35,105,110,99,108,117,100,101,32,
+    60,83,70,77,76,47,71,114,97,112,104,105,99,115,46,104,112,112,62,30,
+    0,240,67,34,114,101,103,105,115,116,114,121,46,104,34,10,10,47,47,32,
+    68,114,97,119,115,32,101,118,101,114,121,32,101,110,116,105,116,121,32,119,
+    105,116,104,32,97,32,80,111,115,105,116,105,111,110,32,97,110,100,32,97,
+    32,84,105,110,116,32,97,115,32,97,32,115,109,97,108,108,32,115,113,117,
+    97,114,101,44,32,12,0,32,111,102,75,0,243,11,116,104,101,109,32,105,
+    110,32,111,110,101,32,100,114,97,119,32,99,97,108,108,58,32,116,104,101,
+    45,0,241,12,115,32,97,114,101,32,119,114,105,116,116,101,110,32,115,116,
+    114,97,105,103,104,116,32,102,114,111,109,38,0,96,112,97,99,107,101,100,
+    75,0,241,7,99,111,109,112,111,110,101,110,116,32,99,111,108,117,109,110,
+    115,32,105,110,116,111,90,0,241,22,118,101,114,116,101,120,32,97,114,114,
+    97,121,44,32,119,104,105,99,104,32,107,101,101,112,115,32,105,116,115,32,
+    115,116,111,114,97,103,101,84,0,0,73,0,145,102,114,97,109,101,32,116,
+    111,32,9,0,250,29,46,10,99,108,97,115,115,32,66,97,116,99,104,82,
+    101,110,100,101,114,101,114,32,123,10,112,117,98,108,105,99,58,10,32,32,
+    32,32,101,120,112,108,105,99,105,116,37,0,241,6,40,102,108,111,97,116,
+    32,115,105,122,101,32,61,32,50,46,48,102,41,59,10,48,0,161,47,47,
+    32,82,101,116,117,114,110,115,196,0,150,110,117,109,98,101,114,32,111,102,
+    3,1,129,115,32,105,115,115,117,101,100,47,0,129,117,110,115,105,103,110,
+    101,100,31,0,35,40,82,142,1,36,38,32,152,1,98,44,32,115,102,58,
+    58,156,0,145,84,97,114,103,101,116,38,32,116,8,0,0,113,0,114,112,
+    114,105,118,97,116,101,170,0,0,41,0,17,86,14,1,16,65,13,1,16,
+    32,26,1,81,105,99,101,115,59,105,0,2,177,0,144,104,97,108,102,59,
+    10,125,59,10,245,117,35,112,114,97,103,109,97,32,111,110,99,101,10,10,
+    35,105,110,99,108,117,100,101,32,60,99,115,116,100,105,110,116,62,10,10,
+    47,47,32,67,111,109,112,111,110,101,110,116,115,32,97,114,101,32,112,108,
+    97,105,110,32,100,97,116,97,59,32,98,101,104,97,118,105,111,117,114,32,
+    108,105,118,101,115,32,105,110,32,116,104,101,32,115,121,115,116,101,109,115,
+    10,10,115,116,114,117,99,116,32,80,111,115,105,116,105,111,110,32,123,10,
+    32,32,32,32,102,108,111,97,116,32,120,44,32,121,59,10,125,59,38,0,
+    142,86,101,108,111,99,105,116,121,38,0,0,53,0,248,5,32,47,47,32,
+    85,110,105,116,115,32,112,101,114,32,115,101,99,111,110,100,62,0,67,84,
+    105,110,116,58,0,241,8,115,116,100,58,58,117,105,110,116,56,95,116,32,
+    114,44,32,103,44,32,98,44,32,97,109,0,0,248,19,35,112,114,97,103,
+    109,97,32,111,110,99,101,10,10,35,105,110,99,108,117,100,101,32,60,97,
+    108,103,111,114,105,116,104,109,62,21,0,88,116,111,109,105,99,18,0,124,
+    99,115,116,100,100,101,102,19,0,56,105,110,116,19,0,104,108,105,109,105,
+    116,115,18,0,104,109,101,109,111,114,121,18,0,88,116,117,112,108,101,17,
+    0,240,61,118,101,99,116,111,114,62,10,10,47,47,32,65,110,32,101,110,
+    116,105,116,121,32,105,115,32,111,110,108,121,32,97,110,32,105,100,59,32,
+    105,116,115,32,100,97,116,97,32,108,105,118,101,115,32,105,110,32,111,110,
+    101,32,67,111,109,112,111,110,101,110,116,80,111,111,108,32,112,101,114,68,
+    0,20,99,21,0,242,8,32,116,121,112,101,46,32,73,100,115,32,111,102,
+    32,100,101,115,116,114,111,121,101,100,98,0,240,15,105,101,115,32,97,114,
+    101,32,114,101,117,115,101,100,44,32,115,111,32,100,111,32,110,111,116,32,
+    104,111,108,100,72,0,97,111,110,32,116,111,32,128,0,100,32,97,102,116,
+    101,114,67,0,160,105,110,103,32,105,116,46,10,117,115,10,0,18,69,176,
+    0,241,1,61,32,115,116,100,58,58,117,105,110,116,51,50,95,116,59,207,
+    0,128,84,104,101,32,112,97,114,116,128,0,48,97,32,112,165,0,32,116,
+    104,116,0,240,10,103,105,115,116,114,121,32,110,101,101,100,115,32,119,105,
+    116,104,111,117,116,32,107,110,111,119,82,0,0,35,0,10,197,0,112,10,
+    99,108,97,115,115,32,230,0,244,13,66,97,115,101,32,123,10,112,117,98,
+    108,105,99,58,10,32,32,32,32,118,105,114,116,117,97,108,32,126,32,0,
+    217,40,41,32,61,32,100,101,102,97,117,108,116,59,35,0,195,118,111,105,
+    100,32,114,101,109,111,118,101,40,185,0,2,112,1,0,50,0,66,48,59,
+    10,125,184,0,145,83,112,97,114,115,101,32,115,101,186,0,0,106,1,10,
+    144,0,32,46,32,218,0,5,20,0,2,74,1,176,112,97,99,107,101,100,
+    32,105,110,116,111,157,1,0,67,1,241,2,99,111,110,116,105,103,117,111,
+    117,115,32,99,111,108,117,109,110,236,0,244,3,32,110,111,32,103,97,112,
+    115,32,40,97,32,115,101,99,111,110,100,30,0,0,123,1,32,115,32,0,
+    1,48,111,119,110,11,1,2,157,0,0,75,0,209,111,102,32,101,97,99,
+    104,32,115,108,111,116,41,175,1,240,7,115,121,115,116,101,109,115,32,115,
+    116,114,101,97,109,32,116,104,114,111,117,103,104,62,0,17,109,32,2,129,
+    114,100,101,114,59,32,96,115,204,0,48,96,32,109,114,0,32,97,110,76,
+    0,2,86,0,0,222,1,0,87,2,0,82,0,48,46,32,82,21,1,48,
+    97,108,32,27,1,2,131,0,65,108,97,115,116,111,0,2,211,0,0,150,
+    0,240,1,104,111,108,101,46,10,116,101,109,112,108,97,116,101,32,60,97,
+    2,115,110,97,109,101,32,84,62,163,1,10,146,2,34,58,32,168,1,15,
+    186,1,5,16,98,18,2,0,37,1,76,97,105,110,115,145,1,113,99,111,
+    110,115,116,32,123,192,1,0,231,1,85,114,101,116,117,114,32,3,34,60,
+    32,217,0,163,46,115,105,122,101,40,41,32,38,38,17,0,18,91,222,0,
+    162,93,32,33,61,32,69,77,80,84,89,2,2,33,125,10,73,0,106,84,
+    38,32,97,100,100,107,0,69,44,32,84,32,204,1,23,41,114,0,66,105,
+    102,32,40,78,0,51,32,62,61,95,0,3,112,0,17,41,78,0,0,151,
+    0,0,4,0,3,139,0,33,114,101,141,0,3,51,0,66,43,32,49,44,
+    130,0,18,41,131,0,0,42,0,0,83,0,2,46,0,13,168,0,10,83,
+    0,3,238,0,5,152,0,42,115,91,55,0,35,93,32,114,3,0,177,1,
+    21,40,39,0,7,107,0,10,48,0,1,47,0,169,97,116,105,99,95,99,
+    97,115,116,60,173,3,18,62,230,0,52,105,101,115,222,0,6,177,0,1,
+    205,0,0,26,0,146,112,117,115,104,95,98,97,99,107,45,0,23,121,106,
+    0,5,126,0,38,115,46,38,0,1,98,0,11,157,0,7,52,0,13,224,
+    0,17,46,92,0,3,34,0,3,174,1,15,175,3,8,112,111,118,101,114,
+    114,105,100,12,4,0,88,1,0,4,0,0,92,1,21,33,78,2,1,185,
+    0,47,121,41,86,1,1,6,222,0,2,100,2,1,171,0,4,186,4,2,
+    243,2,4,239,1,4,166,1,12,51,0,3,61,4,1,36,3,21,61,82,
+    5,9,196,0,0,147,0,1,133,0,64,105,101,115,91,101,3,0,179,1,
+    0,49,0,8,76,0,3,192,5,6,33,0,1,140,0,10,55,1,19,115,
+    87,0,3,28,1,0,88,0,3,220,1,0,78,0,0,86,0,0,94,0,
+    6,86,0,4,117,0,66,46,112,111,112,178,1,7,58,0,8,172,1,15,
+    31,0,0,3,89,0,1,67,0,16,121,91,0,15,67,3,2,58,103,101,
+    116,67,3,77,41,32,123,32,210,1,12,178,2,35,59,32,215,1,33,47,
+    47,64,5,2,101,0,16,39,28,5,3,7,1,240,6,32,111,114,32,110,
+    117,108,108,112,116,114,46,32,67,104,101,99,107,115,32,96,221,0,144,96,
+    32,102,105,114,115,116,58,32,68,6,129,115,32,102,105,108,108,101,100,131,
+    3,32,47,47,237,4,0,157,4,16,115,137,4,2,84,0,32,32,111,253,
+    4,130,32,108,105,110,101,32,117,112,210,1,49,102,111,114,9,0,80,44,
+    32,97,110,100,38,5,81,110,32,106,111,105,102,5,68,116,104,101,109,77,
+    0,48,114,101,97,48,7,0,123,7,3,209,5,2,186,5,128,115,44,32,
+    110,101,118,101,114,58,0,3,11,4,113,32,97,114,114,97,121,46,58,0,
+    109,84,42,32,102,105,110,89,4,1,206,1,0,21,4,18,95,75,5,12,
+    94,4,0,220,0,38,32,60,64,2,0,43,0,2,205,4,1,201,0,7,
+    58,2,3,101,2,31,121,208,2,1,38,32,38,214,1,2,106,2,6,13,
+    2,5,150,1,33,110,116,101,5,1,88,0,74,121,41,32,63,53,0,1,
+    37,6,4,237,2,52,93,32,58,135,1,2,73,0,6,184,1,18,80,229,
+    6,1,96,1,17,58,80,1,33,32,105,50,8,2,52,6,5,136,0,0,
+    242,7,2,107,0,66,65,116,40,105,181,0,9,13,1,2,182,5,2,128,
+    3,15,60,2,0,3,137,4,0,51,2,0,240,2,3,111,3,5,82,0,
+    9,75,0,0,18,7,27,32,74,0,1,42,0,5,63,1,4,71,0,0,
+    254,5,46,116,40,61,0,15,129,0,0,3,72,1,4,179,2,3,138,4,
+    89,115,101,114,118,101,65,0,88,99,111,117,110,116,215,1,4,122,0,50,
+    46,114,101,46,0,2,34,0,2,73,1,0,204,0,5,36,1,31,115,35,
+    0,2,162,125,10,10,112,114,105,118,97,116,101,222,8,32,115,116,182,5,
+    2,224,0,74,101,120,112,114,104,9,2,97,6,1,221,5,178,100,58,58,
+    110,117,109,101,114,105,99,95,136,10,11,229,5,130,58,58,109,97,120,40,
+    41,59,9,7,1,5,1,2,123,10,11,40,0,3,222,2,2,177,0,8,
+    39,0,2,133,1,21,62,174,2,14,34,0,38,84,62,73,7,18,115,78,
+    9,2,186,9,35,82,101,242,9,10,186,9,2,82,0,96,32,99,114,101,
+    97,116,197,7,6,237,7,1,204,5,248,0,102,114,101,101,73,100,115,46,
+    101,109,112,116,121,40,41,102,1,2,73,1,0,33,8,3,68,0,1,119,
+    1,68,121,32,61,32,53,0,8,79,6,0,46,0,0,4,0,4,28,0,
+    15,25,5,1,0,32,0,16,97,94,11,4,6,3,114,32,61,32,116,114,
+    117,101,230,0,0,30,0,0,4,0,3,79,3,2,110,0,6,27,0,17,
+    125,5,4,0,33,0,1,67,0,7,7,7,0,67,0,7,127,5,3,64,
+    0,2,213,1,2,139,7,2,193,0,34,62,40,58,0,3,2,4,51,45,
+    32,49,54,0,3,124,3,1,129,2,3,196,11,13,124,5,5,126,0,1,
+    55,1,48,105,115,65,200,0,4,168,7,2,125,3,0,156,0,0,4,0,
+    2,129,0,6,186,0,0,23,5,18,40,61,3,1,236,1,240,0,117,110,
+    105,113,117,101,95,112,116,114,60,80,111,111,108,111,11,33,62,38,119,5,
+    19,32,126,5,12,135,1,0,116,0,0,151,5,10,104,0,0,108,0,0,
+    22,0,35,45,62,111,11,2,51,1,3,213,0,0,30,0,11,52,1,7,
+    119,1,71,102,97,108,115,120,1,5,182,1,15,130,8,3,3,33,1,1,
+    76,10,4,251,0,2,84,1,2,170,2,34,121,41,61,3,6,163,6,2,
+    139,0,57,32,60,32,115,1,34,38,38,16,0,4,137,0,4,53,4,1,
+    23,1,0,151,1,0,196,5,15,183,4,2,9,71,0,21,45,130,2,0,
+    52,0,32,40,41,71,0,1,160,1,15,55,11,3,0,10,1,0,151,4,
+    15,149,10,10,87,32,61,32,123,125,100,7,0,89,1,96,60,84,62,40,
+    41,46,205,10,2,207,0,18,44,25,4,10,59,8,31,41,127,0,17,1,
+    91,2,3,166,1,11,57,1,17,123,250,1,2,107,0,3,34,0,2,110,
+    0,15,88,0,17,1,146,1,45,104,97,217,11,5,110,5,6,199,0,12,
+    182,9,15,53,1,19,15,135,8,9,6,92,0,0,38,0,15,181,0,23,
+    9,193,12,35,60,84,252,2,24,40,245,2,7,46,3,0,227,1,118,95,
+    116,32,105,100,32,61,250,4,33,73,100,49,1,6,100,3,0,34,3,32,
+    105,100,68,12,0,150,0,5,101,11,1,22,2,0,0,2,0,4,0,2,
+    26,0,3,66,12,69,105,100,32,43,1,4,0,30,0,0,66,0,17,33,
+    35,0,74,91,105,100,93,106,3,5,23,0,4,6,6,82,109,97,107,101,
+    95,200,3,28,60,207,0,16,62,1,6,0,82,0,0,4,0,2,12,4,
+    24,32,141,4,12,48,0,69,38,62,40,42,97,0,3,189,3,3,113,3,
+    163,47,47,32,67,97,108,108,115,32,102,106,4,48,44,32,70,165,9,208,
+    38,44,32,82,101,115,116,38,46,46,46,41,32,95,4,0,55,9,19,121,
+    140,3,208,32,116,104,97,116,32,104,97,115,32,97,108,108,37,8,49,116,
+    104,101,8,1,38,47,47,65,1,112,115,44,32,119,97,108,107,1,15,1,
+    82,0,57,39,115,32,140,9,81,59,32,112,117,116,137,9,102,114,97,114,
+    101,115,116,58,0,4,75,0,1,46,10,225,46,32,102,32,109,97,121,32,
+    99,104,97,110,103,101,48,0,6,124,7,145,32,98,117,116,32,109,117,115,
+    116,244,16,48,97,100,100,124,10,2,227,2,51,32,97,110,214,9,15,179,
+    3,0,1,145,0,17,44,91,17,0,250,14,32,46,46,59,15,38,115,116,
+    18,0,49,32,70,62,134,0,1,86,3,0,179,15,104,40,70,38,38,32,
+    102,65,2,0,22,0,19,60,73,0,0,43,1,114,46,46,46,62,40,48,
+    44,108,3,1,24,0,0,219,3,0,92,2,93,40,41,44,32,102,119,1,
+    81,83,97,109,101,44,91,1,0,64,10,224,115,32,91,98,101,103,105,110,
+    44,32,101,110,100,41,84,1,1,67,0,1,88,11,1,116,16,0,72,18,
+    80,46,32,68,105,115,240,10,48,116,32,114,14,1,17,115,164,0,164,47,
+    47,32,116,111,117,99,104,32,100,29,0,1,41,3,49,105,101,115,98,16,
+    176,116,104,101,121,32,99,97,110,32,114,117,112,18,144,32,100,105,102,102,
+    101,114,101,110,124,1,4,40,11,21,99,191,1,2,231,1,0,45,2,112,
+    32,105,110,118,111,108,118,107,18,208,120,105,115,116,115,32,40,115,101,101,
+    32,84,104,52,0,0,85,6,241,0,58,58,112,97,114,97,108,108,101,108,
+    70,111,114,41,46,139,0,15,107,1,51,8,172,5,3,21,1,8,19,0,
+    93,101,110,100,44,32,143,1,10,244,2,1,61,1,96,62,38,32,108,101,
+    97,214,3,0,208,0,2,172,1,9,59,3,96,91,91,109,97,121,98,103,
+    3,0,63,19,34,93,93,125,5,1,220,19,11,116,3,0,225,1,16,62,
+    13,3,145,62,32,111,116,104,101,114,115,40,83,0,1,23,0,32,40,41,
+    37,3,6,41,4,32,101,110,115,0,1,178,0,65,109,105,110,40,175,0,
+    0,136,0,3,14,11,3,9,2,0,187,3,0,88,3,9,136,10,0,10,
+    2,49,32,61,32,245,0,18,59,153,11,0,88,12,80,100,59,32,43,43,
+    28,0,8,128,2,0,65,0,2,197,4,9,239,5,33,32,61,245,0,17,
+    46,4,2,65,121,65,116,40,56,0,6,158,0,0,55,0,13,248,0,2,
+    72,0,1,179,0,2,254,0,0,217,0,16,42,210,2,98,32,102,111,117,
+    110,100,165,0,63,103,101,116,23,1,2,34,62,40,20,1,33,41,46,62,
+    13,2,122,0,17,44,191,0,11,27,1,0,125,0,70,105,102,32,40,80,
+    0,1,105,0,33,62,40,102,0,1,0,18,0,76,1,10,27,5,0,53,
+    0,6,158,4,1,74,1,19,97,215,0,49,44,32,42,181,0,0,154,0,
+    9,74,0,0,70,0,6,244,0,2,165,8,15,148,11,4,1,65,0,0,
+    167,3,117,95,116,32,110,101,120,116,73,2,41,73,100,49,6,2,97,5,
+    2,35,2,17,97,91,22,2,115,11,2,59,0,17,62,60,0,39,40,48,
+    222,1,3,153,5,0,84,0,34,43,43,141,0,3,117,5,15,39,3,0,
+    18,84,112,4,8,101,0,2,89,0,6,23,5,15,144,0,3,7,187,1,
+    3,49,0,1,200,6,0,118,0,9,202,0,2,129,0,0,76,1,3,152,
+    0,34,105,100,19,0,3,148,0,1,7,1,9,75,12,15,68,10,0,17,
+    62,222,4,248,2,115,59,32,32,47,47,32,73,110,100,101,120,101,100,32,
+    98,121,164,0,1,54,7,1,13,4,8,82,0,0,70,8,18,62,154,9,
+    2,118,0,8,29,0,2,192,2,20,62,115,9,1,115,12,0,251,17,35,
+    112,114,97,103,109,97,32,111,110,99,101,10,10,35,105,110,99,108,117,100,
+    101,32,60,99,115,116,100,100,101,102,62,19,0,71,105,110,116,62,39,0,
+    198,34,114,101,103,105,115,116,114,121,46,104,34,42,0,192,34,116,104,114,
+    101,97,100,95,112,111,111,108,25,0,240,104,10,115,116,114,117,99,116,32,
+    66,111,117,110,100,115,32,123,10,32,32,32,32,102,108,111,97,116,32,119,
+    105,100,116,104,44,32,104,101,105,103,104,116,59,10,125,59,10,10,47,47,
+    32,67,114,101,97,116,101,115,32,96,99,111,117,110,116,96,32,101,110,116,
+    105,116,105,101,115,32,119,105,116,104,32,97,32,80,111,115,105,116,105,111,
+    110,44,32,86,101,108,111,99,105,116,121,32,97,110,100,32,84,105,110,116,
+    44,32,115,99,97,116,116,101,114,101,100,74,0,113,111,118,101,114,32,96,
+    98,121,0,18,96,63,0,192,114,97,110,100,111,109,32,100,105,114,101,99,
+    69,0,246,7,115,59,32,116,104,101,32,115,97,109,101,32,115,101,101,100,
+    32,103,105,118,101,115,20,0,243,2,119,111,114,108,100,10,118,111,105,100,
+    32,115,112,97,119,110,69,141,0,35,40,82,252,0,36,38,32,6,1,225,
+    44,32,115,116,100,58,58,115,105,122,101,95,116,32,189,0,20,44,246,0,
+    2,132,0,3,34,0,130,117,105,110,116,51,50,95,116,113,0,66,61,32,
+    49,41,249,0,32,77,111,123,0,82,101,118,101,114,121,245,0,18,121,180,
+    0,6,243,0,1,233,0,22,97,248,0,64,98,121,32,100,71,0,32,99,
+    111,91,1,33,97,110,246,0,0,108,0,161,99,101,115,32,105,116,32,111,
+    102,102,203,0,133,101,100,103,101,115,32,111,102,13,1,50,46,32,87,77,
+    1,2,173,1,16,32,173,1,1,42,0,66,112,97,99,107,61,1,4,103,
+    1,240,12,32,99,111,108,117,109,110,32,105,115,32,115,112,108,105,116,32,
+    105,110,116,111,32,99,104,117,110,107,40,1,242,4,97,116,32,114,117,110,
+    32,105,110,32,112,97,114,97,108,108,101,108,46,47,1,239,109,111,118,101,
+    109,101,110,116,83,121,115,116,101,109,48,1,2,2,6,2,45,100,116,39,
+    1,17,84,67,2,98,80,111,111,108,42,32,162,0,224,115,32,61,32,110,
+    117,108,108,112,116,114,41,59,10,247,16,35,112,114,97,103,109,97,32,111,
+    110,99,101,10,10,35,105,110,99,108,117,100,101,32,60,97,116,111,109,105,
+    99,62,18,0,249,3,99,111,110,100,105,116,105,111,110,95,118,97,114,105,
+    97,98,108,101,30,0,108,115,116,100,100,101,102,19,0,56,105,110,116,19,
+    0,64,102,117,110,99,67,0,40,97,108,22,0,88,109,117,116,101,120,17,
+    0,104,116,104,114,101,97,100,18,0,242,17,118,101,99,116,111,114,62,10,
+    10,47,47,32,70,105,120,101,100,32,115,101,116,32,111,102,32,119,111,114,
+    107,101,114,32,50,0,243,23,115,32,102,111,114,32,100,97,116,97,45,112,
+    97,114,97,108,108,101,108,32,108,111,111,112,115,46,32,84,104,101,32,99,
+    97,108,108,105,110,103,45,0,0,75,0,0,62,0,177,115,32,116,111,111,
+    44,32,115,111,32,84,119,0,243,2,80,111,111,108,40,49,41,32,115,116,
+    97,114,116,115,32,110,111,48,0,240,3,115,32,97,110,100,32,114,117,110,
+    115,32,101,118,101,114,121,116,104,76,0,215,105,110,108,105,110,101,46,10,
+    99,108,97,115,115,66,0,243,13,32,123,10,112,117,98,108,105,99,58,10,
+    32,32,32,32,47,47,32,48,32,117,115,101,115,32,111,110,101,81,0,196,
+    32,112,101,114,32,104,97,114,100,119,97,114,20,0,1,45,0,135,101,120,
+    112,108,105,99,105,116,79,0,147,40,117,110,115,105,103,110,101,100,60,0,
+    113,115,32,61,32,48,41,59,47,0,23,126,184,0,49,41,59,10,20,0,
+    7,19,0,72,99,111,110,115,75,0,178,38,41,32,61,32,100,101,108,101,
+    116,101,64,0,6,44,0,207,38,32,111,112,101,114,97,116,111,114,61,40,
+    55,0,10,1,100,0,5,147,0,114,115,105,122,101,40,41,32,50,0,128,
+    123,32,114,101,116,117,114,110,64,1,148,116,105,99,95,99,97,115,116,60,
+    43,0,32,62,40,114,1,66,101,114,115,46,52,0,130,41,32,43,32,49,
+    59,32,125,181,0,241,7,47,47,32,67,97,108,108,115,32,102,40,98,101,
+    103,105,110,44,32,101,110,100,41,212,1,0,92,0,224,101,99,117,116,105,
+    118,101,32,99,104,117,110,107,115,253,1,145,97,116,32,109,111,115,116,32,
+    96,19,0,145,96,32,105,110,100,105,99,101,115,158,0,128,47,47,32,99,
+    111,118,101,114,165,1,224,91,48,44,32,99,111,117,110,116,41,44,32,115,
+    112,92,2,16,32,27,0,68,32,97,108,108,80,1,18,44,222,1,1,187,
+    0,98,115,32,119,104,101,110,230,1,5,76,0,0,117,0,176,32,105,115,
+    32,100,111,110,101,46,32,67,15,0,32,115,32,185,1,241,5,104,97,110,
+    100,101,100,32,111,117,116,32,111,110,32,100,101,109,97,110,100,79,2,96,
+    117,110,101,118,101,110,241,1,161,115,32,98,97,108,97,110,99,101,46,79,
+    0,84,118,111,105,100,32,161,2,144,70,111,114,40,115,116,100,58,58,18,
+    1,34,95,116,168,0,41,44,32,19,0,0,109,0,0,194,0,0,201,1,
+    1,25,0,4,72,3,16,60,75,0,8,63,0,9,57,0,80,41,62,38,
+    32,102,18,2,114,112,114,105,118,97,116,101,139,2,0,51,0,3,55,3,
+    83,76,111,111,112,40,70,2,1,23,0,50,114,117,110,218,0,0,22,0,
+    1,172,0,1,111,0,2,126,3,17,60,12,0,2,106,3,19,62,66,0,
+    18,115,67,2,1,26,0,1,199,3,17,32,6,0,7,22,0,14,55,4,
+    67,32,119,97,107,123,2,1,56,0,15,34,0,0,0,101,1,3,202,2,
+    34,47,47,188,3,241,12,117,114,114,101,110,116,32,106,111,98,59,32,119,
+    114,105,116,116,101,110,32,117,110,100,101,114,32,96,115,0,208,96,32,98,
+    101,102,111,114,101,32,96,103,101,110,197,2,163,105,111,110,96,32,99,104,
+    97,110,103,18,2,0,68,2,18,116,89,1,15,64,1,21,16,42,112,0,
+    167,32,61,32,110,117,108,108,112,116,114,215,0,3,174,1,64,106,111,98,
+    67,89,2,0,143,3,15,30,0,3,0,188,1,71,32,61,32,49,30,0,
+    2,92,5,2,79,1,2,72,0,97,62,32,110,101,120,116,123,1,50,123,
+    48,125,43,0,4,52,3,81,32,98,117,115,121,96,0,0,73,4,6,4,
+    0,65,47,47,32,87,253,4,0,164,4,240,8,116,32,121,101,116,32,102,
+    105,110,105,115,104,101,100,32,119,105,116,104,32,116,104,101,191,0,6,199,
+    1,150,117,105,110,116,54,52,95,116,32,34,1,1,88,0,1,34,0,160,
+    98,111,111,108,32,115,116,111,112,112,50,3,192,61,32,102,97,108,115,101,
+    59,10,125,59,10,246,14,35,105,110,99,108,117,100,101,32,34,98,97,116,
+    99,104,95,114,101,110,100,101,114,101,114,46,104,34,10,10,29,0,161,99,
+    111,109,112,111,110,101,110,116,115,25,0,16,66,44,0,19,82,43,0,41,
+    58,58,15,0,240,30,40,102,108,111,97,116,32,115,105,122,101,41,32,58,
+    32,118,101,114,116,105,99,101,115,40,115,102,58,58,84,114,105,97,110,103,
+    108,101,115,41,44,32,104,97,108,102,40,38,0,249,7,32,47,32,50,46,
+    48,102,41,32,123,125,10,10,117,110,115,105,103,110,101,100,32,84,0,243,
+    3,58,58,100,114,97,119,40,82,101,103,105,115,116,114,121,38,32,114,10,
+    0,32,44,32,87,0,2,138,0,145,84,97,114,103,101,116,38,32,116,8,
+    0,244,1,41,32,123,10,32,32,32,32,47,47,32,84,119,111,32,116,122,
+    0,240,0,32,112,101,114,32,101,110,116,105,116,121,59,32,114,101,129,0,
+    241,23,40,41,32,111,110,108,121,32,97,108,108,111,99,97,116,101,115,32,
+    119,104,101,110,32,116,104,101,32,99,111,117,110,116,32,103,114,111,119,115,
+    78,0,4,206,0,19,46,58,0,4,136,0,243,3,46,112,111,111,108,60,
+    80,111,115,105,116,105,111,110,62,40,41,46,89,0,81,42,32,54,41,59,
+    59,0,80,115,116,100,58,58,22,0,35,95,116,87,0,50,61,32,48,27,
+    0,5,70,0,69,101,97,99,104,70,0,209,44,32,84,105,110,116,62,40,
+    91,38,93,40,69,177,0,132,44,32,99,111,110,115,116,32,104,0,51,38,
+    32,112,114,0,4,26,0,0,50,0,100,38,32,116,105,110,116,0,1,0,
+    4,1,2,54,0,0,42,1,112,67,111,108,111,114,32,99,6,0,16,40,
+    38,0,49,46,114,44,46,0,35,46,103,8,0,19,98,8,0,19,97,182,
+    0,10,63,0,243,6,86,101,99,116,111,114,50,102,32,99,111,114,110,101,
+    114,115,91,52,93,32,61,105,1,0,42,0,0,4,0,20,123,148,0,65,
+    46,120,32,45,230,1,21,44,167,0,35,46,121,19,0,33,125,44,20,1,
+    0,48,0,0,4,0,8,52,0,31,43,52,0,51,2,71,0,15,104,0,
+    8,15,156,0,0,13,52,0,18,125,160,1,0,163,0,0,62,1,244,1,
+    86,101,114,116,101,120,42,32,113,117,97,100,32,61,32,38,14,2,18,91,
+    39,2,70,42,32,54,93,49,0,0,37,0,32,91,48,32,1,6,59,0,
+    20,40,56,1,32,48,93,178,1,55,108,111,114,103,1,1,49,0,31,49,
+    49,0,4,31,49,49,0,5,31,50,49,0,4,31,50,49,0,5,31,51,
+    49,0,4,15,147,0,6,1,228,1,15,196,0,0,15,98,0,6,31,53,
+    98,0,4,31,51,147,0,0,33,43,43,60,1,2,55,1,19,125,14,1,
+    65,105,102,32,40,23,0,101,32,61,61,32,48,41,43,2,100,114,101,116,
+    117,114,110,54,3,4,126,1,4,140,3,2,50,0,6,113,3,2,8,4,
+    17,46,58,4,4,44,0,3,97,0,3,73,0,80,49,59,10,125,10,246,
+    15,35,105,110,99,108,117,100,101,32,60,83,70,77,76,47,71,114,97,112,
+    104,105,99,115,46,104,112,112,62,10,10,30,0,167,97,108,103,111,114,105,
+    116,104,109,62,21,0,123,99,115,116,100,108,105,98,19,0,72,114,105,110,
+    103,19,0,122,105,111,109,97,110,105,112,19,0,104,115,116,114,101,97,109,
+    99,0,246,3,34,98,97,116,99,104,95,114,101,110,100,101,114,101,114,46,
+    104,34,106,0,154,34,114,101,103,105,115,116,114,121,22,0,122,115,121,115,
+    116,101,109,115,21,0,176,116,104,114,101,97,100,95,112,111,111,108,25,0,
+    241,50,10,115,116,97,116,105,99,32,118,111,105,100,32,112,114,105,110,116,
+    85,115,97,103,101,40,99,111,110,115,116,32,99,104,97,114,42,32,112,114,
+    111,103,114,97,109,41,32,123,10,32,32,32,32,115,116,100,58,58,99,111,
+    117,116,32,60,60,32,34,47,0,48,58,32,34,13,0,3,41,0,0,11,
+    0,240,1,34,32,91,45,45,101,110,116,105,116,105,101,115,32,78,93,15,
+    0,2,123,0,0,14,0,49,92,110,34,75,0,0,79,0,2,4,0,0,
+    75,0,40,32,32,51,0,245,4,32,32,78,117,109,98,101,114,32,111,102,
+    32,109,111,118,105,110,103,32,80,0,255,0,40,100,101,102,97,117,108,116,
+    32,53,48,48,48,48,41,79,0,7,5,115,0,65,32,32,32,84,250,0,
+    163,115,32,102,111,114,32,116,104,101,32,31,1,20,32,77,0,224,58,32,
+    111,110,101,32,112,101,114,32,99,111,114,101,85,0,224,59,10,125,10,10,
+    105,110,116,32,109,97,105,110,40,9,0,83,97,114,103,99,44,23,1,105,
+    97,114,103,118,91,93,22,1,98,115,105,122,101,95,116,168,0,130,121,67,
+    111,117,110,116,32,61,164,0,17,59,240,0,146,117,110,115,105,103,110,101,
+    100,32,152,0,4,34,0,18,48,30,0,0,153,0,1,102,0,176,105,32,
+    61,32,49,59,32,105,32,60,32,113,0,84,59,32,43,43,105,104,0,0,
+    47,1,2,157,1,244,6,98,111,111,108,32,104,97,115,86,97,108,117,101,
+    32,61,32,105,32,43,32,49,51,0,1,111,0,0,44,0,65,105,102,32,
+    40,178,1,113,115,116,114,99,109,112,40,182,0,86,105,93,44,32,34,109,
+    1,165,34,41,32,61,61,32,48,32,38,38,80,0,8,111,0,0,71,0,
+    1,123,1,5,211,0,4,81,0,66,116,111,117,108,82,0,32,43,43,84,
+    0,194,110,117,108,108,112,116,114,44,32,49,48,41,212,0,0,60,0,127,
+    125,32,101,108,115,101,32,138,0,9,2,16,1,31,115,137,0,16,2,42,
+    0,4,58,1,2,190,2,100,95,99,97,115,116,60,93,1,18,62,240,0,
+    70,97,116,111,105,156,0,30,41,144,0,2,206,2,0,161,0,0,4,0,
+    7,252,2,1,35,1,39,48,93,50,0,0,33,0,98,114,101,116,117,114,
+    110,254,2,15,76,1,0,68,104,101,108,112,191,0,119,63,32,48,32,58,
+    32,49,2,1,1,143,1,33,125,10,7,0,2,190,1,130,66,111,117,110,
+    100,115,32,98,7,0,224,61,32,123,49,50,56,48,46,48,102,44,32,55,
+    50,8,0,18,125,62,0,81,115,102,58,58,82,244,3,129,87,105,110,100,
+    111,119,32,119,7,0,16,40,24,0,160,86,105,100,101,111,77,111,100,101,
+    40,60,0,1,57,0,131,41,44,32,34,69,67,83,34,188,0,2,45,0,
+    242,15,46,115,101,116,86,101,114,116,105,99,97,108,83,121,110,99,69,110,
+    97,98,108,101,100,40,116,114,117,101,41,59,149,0,19,82,66,4,20,32,
+    75,4,3,127,0,83,112,97,119,110,69,199,3,20,40,28,0,24,44,226,
+    2,19,44,196,0,3,115,0,2,102,3,16,80,156,2,2,171,1,34,115,
+    40,8,0,1,179,1,3,37,0,16,66,204,4,2,215,0,52,101,114,32,
+    212,4,3,139,0,211,47,47,32,85,112,100,97,116,101,32,97,110,100,29,
+    0,114,32,116,105,109,101,115,44,162,4,98,101,100,32,111,110,99,171,3,
+    97,115,101,99,111,110,100,88,1,0,19,1,177,67,108,111,99,107,32,102,
+    114,97,109,101,11,0,3,198,0,49,102,58,58,15,0,113,32,114,101,112,
+    111,114,116,12,0,6,27,0,97,84,105,109,101,32,117,115,0,0,11,0,
+    11,25,0,2,158,0,6,25,0,4,103,2,2,102,0,67,115,32,61,32,
+    191,3,5,25,0,131,100,114,97,119,67,97,108,108,28,0,1,157,0,115,
+    119,104,105,108,101,32,40,145,1,136,105,115,79,112,101,110,40,41,102,3,
+    0,191,0,112,69,118,101,110,116,32,101,6,0,2,134,0,0,121,2,10,
+    59,0,65,112,111,108,108,39,0,17,40,39,0,9,67,0,0,46,0,0,
+    102,3,1,26,0,80,46,116,121,112,101,216,3,5,89,0,1,5,1,65,
+    115,101,100,41,146,0,0,45,0,4,4,0,3,151,0,99,99,108,111,115,
+    101,40,164,1,0,28,0,3,178,2,0,11,0,0,70,0,1,56,1,32,
+    32,99,100,1,6,159,0,2,207,2,112,102,108,111,97,116,32,100,240,4,
+    1,29,4,70,109,105,110,40,135,1,225,46,114,101,115,116,97,114,116,40,
+    41,46,97,115,83,179,1,151,115,40,41,44,32,48,46,49,102,111,0,145,
+    109,111,118,101,109,101,110,116,83,185,6,7,111,2,36,100,116,102,2,50,
+    44,32,38,79,2,23,115,56,0,6,188,1,50,32,43,61,160,0,6,114,
+    0,3,86,2,0,196,0,5,231,0,56,101,97,114,231,0,6,177,1,35,
+    43,61,113,2,48,101,114,46,22,0,7,132,0,2,61,0,7,118,0,6,
+    25,2,6,118,0,160,103,101,116,69,108,97,112,115,101,100,49,2,8,100,
+    0,2,63,0,128,46,100,105,115,112,108,97,121,26,0,5,134,1,33,43,
+    43,42,1,22,115,84,1,0,197,1,7,171,2,28,46,87,0,64,32,62,
+    61,32,145,1,2,254,2,109,115,40,49,46,48,102,10,2,1,136,1,4,
+    168,7,1,13,0,80,102,105,120,101,100,158,7,1,14,0,238,115,101,116,
+    112,114,101,99,105,115,105,111,110,40,50,21,2,0,50,1,16,32,46,0,
+    4,247,3,16,46,223,6,32,40,41,19,0,18,34,2,4,0,220,7,34,
+    111,110,253,7,3,151,1,9,37,0,2,20,0,92,40,115,41,58,32,241,
+    7,2,94,0,1,96,0,18,34,192,1,2,71,0,2,12,0,0,62,1,
+    8,43,2,96,32,42,32,49,48,48,24,5,36,32,47,121,3,1,51,8,
+    47,109,115,89,0,9,19,32,206,1,2,91,0,6,177,1,15,91,0,50,
+    0,32,2,33,32,99,232,3,1,254,8,0,16,0,2,247,3,9,163,0,
+    17,47,221,1,54,92,110,34,223,1,0,252,0,6,232,0,20,32,116,2,
+    0,245,0,18,32,217,1,0,11,0,106,58,58,90,101,114,111,54,0,1,
+    76,0,0,88,4,6,109,0,5,128,4,0,86,0,0,4,0,8,57,2,
+    5,120,3,6,71,0,17,125,120,2,3,218,3,3,213,6,16,48,234,8,
+    0,245,7,35,105,110,99,108,117,100,101,32,34,115,121,115,116,101,109,115,
+    46,104,34,10,10,22,0,119,60,99,109,97,116,104,62,17,0,119,114,97,
+    110,100,111,109,62,36,0,162,34,99,111,109,112,111,110,101,110,116,61,0,
+    240,72,110,97,109,101,115,112,97,99,101,32,123,10,10,47,47,32,69,110,
+    116,105,116,105,101,115,32,112,101,114,32,112,97,114,97,108,108,101,108,32,
+    116,97,115,107,58,32,108,97,114,103,101,32,101,110,111,117,103,104,32,116,
+    104,97,116,32,104,97,110,100,105,110,103,32,111,117,116,32,97,32,99,104,
+    117,110,107,32,99,111,115,116,115,75,0,64,110,111,116,104,29,0,240,0,
+    110,101,120,116,32,116,111,32,112,114,111,99,101,115,115,19,0,149,105,116,
+    44,32,115,109,97,108,108,78,0,245,49,111,32,98,97,108,97,110,99,101,
+    32,97,99,114,111,115,115,32,116,104,114,101,97,100,115,10,99,111,110,115,
+    116,32,115,116,100,58,58,115,105,122,101,95,116,32,67,72,85,78,75,32,
+    61,32,49,54,51,56,52,59,10,10,125,32,47,47,32,200,0,196,10,10,
+    118,111,105,100,32,115,112,97,119,110,205,0,195,40,82,101,103,105,115,116,
+    114,121,38,32,114,10,0,25,44,83,0,241,0,99,111,117,110,116,44,32,
+    66,111,117,110,100,115,32,98,7,0,3,34,0,242,5,117,105,110,116,51,
+    50,95,116,32,115,101,101,100,41,32,123,10,32,32,32,60,0,130,109,116,
+    49,57,57,51,55,32,101,1,17,40,32,0,22,59,31,0,224,117,110,105,
+    102,111,114,109,95,114,101,97,108,95,100,127,0,255,16,105,98,117,116,105,
+    111,110,60,102,108,111,97,116,62,32,117,110,105,116,40,48,46,48,102,44,
+    32,49,46,48,102,41,60,0,0,58,105,110,116,59,0,241,8,105,110,116,
+    62,32,99,104,97,110,110,101,108,40,54,52,44,32,50,53,53,41,59,10,
+    118,0,4,219,0,160,46,112,111,111,108,60,80,111,115,105,110,0,207,62,
+    40,41,46,114,101,115,101,114,118,101,40,34,0,7,0,91,1,81,40,41,
+    32,43,32,10,1,3,139,0,10,47,0,143,86,101,108,111,99,105,116,121,
+    81,0,7,8,34,0,15,81,0,16,16,84,205,0,15,158,0,6,4,30,
+    0,15,73,0,2,88,102,111,114,32,40,20,2,162,105,32,61,32,48,59,
+    32,105,32,60,194,0,84,59,32,43,43,105,174,1,0,178,1,2,71,2,
+    1,17,2,48,121,32,101,229,2,53,121,32,61,14,2,131,46,99,114,101,
+    97,116,101,40,249,0,6,49,0,1,171,1,130,32,97,110,103,108,101,32,
+    61,178,1,2,239,1,226,41,32,42,32,54,46,50,56,51,49,56,53,51,
+    102,187,1,12,55,0,144,115,112,101,101,100,32,61,32,50,229,1,44,32,
+    43,63,0,16,56,23,0,6,58,0,5,110,1,66,97,100,100,40,162,0,
+    36,44,32,198,1,17,123,45,2,6,123,0,2,163,2,124,46,119,105,100,
+    116,104,44,89,0,3,29,0,119,104,101,105,103,104,116,125,212,0,15,99,
+    0,2,4,182,1,17,123,80,1,65,99,111,115,40,239,0,0,225,0,1,
+    193,0,3,8,3,59,115,105,110,25,0,15,90,0,14,0,195,1,209,123,
+    115,116,97,116,105,99,95,99,97,115,116,60,98,0,0,81,3,84,56,95,
+    116,62,40,199,2,3,214,0,16,41,105,0,15,44,0,22,1,242,2,0,
+    113,1,15,4,0,7,15,122,0,25,52,50,53,53,207,0,51,125,10,125,
+    68,4,145,109,111,118,101,109,101,110,116,83,109,5,15,69,4,2,2,32,
+    2,30,100,60,4,17,84,191,4,84,80,111,111,108,42,203,4,4,143,2,
+    208,97,117,116,111,32,115,116,101,112,32,61,32,91,59,0,2,176,1,34,
+    93,40,158,2,6,245,1,51,38,32,112,197,3,36,44,32,166,1,51,38,
+    32,118,136,3,4,79,0,0,1,1,4,40,0,85,46,120,32,43,61,34,
+    0,118,46,120,32,42,32,100,116,99,2,5,39,0,25,121,39,0,27,121,
+    39,0,69,105,102,32,40,43,0,64,120,32,60,32,169,2,53,32,124,124,
+    143,0,82,46,120,32,62,32,182,0,2,131,2,8,140,0,0,144,0,4,
+    164,0,102,46,120,32,61,32,45,14,0,6,139,0,0,38,0,7,100,0,
+    18,61,83,5,66,102,109,105,110,216,3,71,102,109,97,120,133,0,17,44,
+    132,0,42,41,44,118,0,6,79,0,21,125,16,2,9,189,0,31,121,189,
+    0,1,22,121,189,0,2,35,3,15,190,0,6,0,35,4,6,190,0,22,
+    121,111,0,9,190,0,0,38,0,1,218,2,15,190,0,5,28,121,190,0,
+    3,119,0,6,80,0,2,191,0,19,125,201,5,0,195,0,19,33,0,7,
+    8,156,0,5,191,3,69,101,97,99,104,225,5,6,28,2,32,62,40,86,
+    2,9,240,3,66,116,117,114,110,103,0,2,99,0,65,47,47,32,67,235,
+    4,96,32,98,111,116,104,32,42,6,240,10,115,32,98,101,102,111,114,101,
+    32,116,104,101,32,119,111,114,107,101,114,115,32,108,111,111,107,17,0,65,
+    109,32,117,112,91,1,5,124,0,0,51,0,20,60,142,2,20,62,50,5,
+    3,174,0,36,45,62,51,8,63,70,111,114,111,6,14,33,44,32,203,7,
+    82,44,32,91,38,93,246,1,0,237,5,128,95,116,32,98,101,103,105,110,
+    15,4,6,245,7,37,101,110,125,7,0,125,1,5,143,0,15,11,1,6,
+    3,68,0,48,101,110,100,73,0,35,101,112,23,1,0,230,3,32,125,10,
+    245,11,35,105,110,99,108,117,100,101,32,34,116,104,114,101,97,100,95,112,
+    111,111,108,46,104,34,10,10,26,0,225,60,97,108,103,111,114,105,116,104,
+    109,62,10,10,84,38,0,102,80,111,111,108,58,58,12,0,162,40,117,110,
+    115,105,103,110,101,100,32,70,0,211,115,41,32,123,10,32,32,32,32,105,
+    102,32,40,19,0,97,32,61,61,32,48,41,22,0,0,26,0,5,22,0,
+    210,32,115,116,100,58,58,109,97,120,40,49,117,44,13,0,2,28,0,241,
+    11,58,58,104,97,114,100,119,97,114,101,95,99,111,110,99,117,114,114,101,
+    110,99,121,40,41,41,59,69,0,70,102,111,114,32,120,0,164,105,32,61,
+    32,49,59,32,105,32,60,131,0,86,59,32,43,43,105,112,0,246,7,119,
+    111,114,107,101,114,115,46,101,109,112,108,97,99,101,95,98,97,99,107,40,
+    38,195,0,34,58,58,34,0,234,76,111,111,112,44,32,116,104,105,115,41,
+    59,10,125,241,0,22,126,47,0,20,40,226,0,2,232,0,0,210,0,1,
+    200,0,177,108,111,99,107,95,103,117,97,114,100,60,16,0,112,109,117,116,
+    101,120,62,32,23,0,17,40,12,0,3,190,0,2,49,0,210,111,112,112,
+    105,110,103,32,61,32,116,114,117,101,215,0,17,125,221,0,243,1,119,97,
+    107,101,46,110,111,116,105,102,121,95,97,108,108,40,54,0,1,244,0,1,
+    88,0,2,35,1,34,38,32,181,0,35,32,58,9,0,28,115,241,0,80,
+    46,106,111,105,110,63,0,134,125,10,10,118,111,105,100,32,195,0,225,58,
+    58,112,97,114,97,108,108,101,108,70,111,114,40,86,0,195,115,105,122,101,
+    95,116,32,99,111,117,110,116,140,1,4,19,0,81,104,117,110,107,44,156,
+    0,0,187,0,15,4,0,2,82,99,111,110,115,116,194,1,144,102,117,110,
+    99,116,105,111,110,60,116,0,8,92,0,9,86,0,84,41,62,38,32,102,
+    73,1,16,99,98,0,34,32,61,64,0,50,109,97,120,64,1,2,127,0,
+    33,62,40,30,0,51,44,32,49,9,1,0,88,2,2,251,0,1,210,1,
+    114,116,121,40,41,32,124,124,185,0,65,32,60,61,32,47,0,4,90,0,
+    0,173,0,0,49,0,1,215,0,40,32,62,134,2,0,27,0,66,102,40,
+    48,44,58,0,3,93,0,0,21,0,100,114,101,116,117,114,110,147,1,1,
+    248,0,15,234,1,40,130,106,111,98,32,61,32,38,102,80,0,0,96,0,
+    64,106,111,98,67,102,1,34,32,61,123,0,10,26,0,3,11,1,1,198,
+    0,6,26,0,83,110,101,120,116,67,27,0,22,48,23,0,65,98,117,115,
+    121,56,1,164,97,116,105,99,95,99,97,115,116,60,143,3,36,62,40,37,
+    1,0,72,1,5,59,3,0,129,0,128,43,43,103,101,110,101,114,97,166,
+    1,2,76,0,15,122,2,10,49,114,117,110,123,0,16,115,76,2,1,15,
+    1,1,49,2,112,117,110,105,113,117,101,95,223,2,2,176,1,1,228,2,
+    15,240,2,0,160,100,111,110,101,46,119,97,105,116,40,44,0,178,44,32,
+    91,116,104,105,115,93,32,123,32,105,1,18,32,197,0,99,61,32,48,59,
+    32,125,135,1,2,53,1,113,110,117,108,108,112,116,114,140,3,0,77,2,
+    9,193,2,7,150,0,3,113,4,1,34,3,40,59,59,251,1,7,151,2,
+    18,115,224,2,133,98,101,103,105,110,32,61,32,81,1,80,43,43,32,42,
+    32,147,1,0,94,1,2,14,1,0,36,1,0,53,2,2,44,0,33,62,
+    61,31,0,0,178,1,6,98,3,0,35,0,2,191,0,6,51,0,113,40,
+    42,106,111,98,41,40,54,0,3,236,2,50,109,105,110,16,0,33,32,43,
+    69,0,0,100,0,17,44,10,0,1,79,0,3,238,0,16,125,109,4,13,
+    225,0,2,191,1,0,148,4,5,113,4,2,120,1,176,105,110,116,54,52,
+    95,116,32,115,101,101,202,0,3,15,2,15,254,0,0,6,182,2,0,175,
+    0,2,61,0,15,181,1,21,0,50,0,0,4,0,1,142,4,8,189,1,
+    23,38,186,1,35,115,116,198,4,54,124,124,32,83,2,49,32,33,61,156,
+    0,6,207,1,0,73,0,0,4,0,0,85,1,4,52,0,10,76,1,0,
+    30,0,12,80,1,0,20,0,3,228,0,6,93,0,6,111,1,2,180,2,
+    0,37,0,7,11,2,33,59,10,161,2,0,22,0,1,240,0,0,114,2,
+    15,148,5,21,0,158,0,37,45,45,142,2,10,161,0,1,197,2,3,150,
+    5,48,111,110,101,11,3,0,101,0,0,187,1,0,241,11,47,47,32,84,
+    101,115,116,115,32,102,111,114,32,116,104,101,32,114,101,103,105,115,116,114,
+    121,44,14,0,241,0,116,104,114,101,97,100,32,112,111,111,108,32,97,110,
+    100,20,0,247,33,109,111,118,101,109,101,110,116,32,115,121,115,116,101,109,
+    59,32,110,101,101,100,115,32,110,111,32,83,70,77,76,10,35,105,110,99,
+    108,117,100,101,32,60,97,116,111,109,105,99,62,18,0,120,99,115,116,100,
+    108,105,98,19,0,136,105,111,115,116,114,101,97,109,20,0,134,118,101,99,
+    116,111,114,62,10,58,0,231,34,99,111,109,112,111,110,101,110,116,115,46,
+    104,34,24,0,4,175,0,10,22,0,2,154,0,11,43,0,2,204,0,16,
+    95,204,0,0,46,0,255,37,10,115,116,97,116,105,99,32,105,110,116,32,
+    102,97,105,108,117,114,101,115,32,61,32,48,59,10,10,35,100,101,102,105,
+    110,101,32,67,72,69,67,75,40,99,111,110,100,105,116,105,111,110,41,32,
+    1,0,36,32,92,10,57,0,64,100,111,32,123,8,0,15,4,0,49,2,
+    82,0,0,74,0,87,105,102,32,40,33,164,0,31,41,101,0,36,6,82,
+    0,0,86,0,240,6,115,116,100,58,58,99,101,114,114,32,60,60,32,95,
+    95,70,73,76,69,95,95,12,0,48,39,58,39,7,0,83,95,95,76,73,
+    78,19,0,101,34,58,32,34,32,35,38,1,154,32,34,92,110,34,59,32,
+    32,32,82,0,36,43,43,101,1,0,28,0,0,100,0,15,4,0,31,6,
+    82,0,31,125,61,0,31,15,50,0,2,2,82,0,196,125,32,119,104,105,
+    108,101,32,40,48,41,10,23,2,241,23,118,111,105,100,32,116,101,115,116,
+    82,101,109,111,118,97,108,75,101,101,112,115,67,111,108,117,109,110,115,80,
+    97,99,107,101,100,40,41,32,123,217,1,19,82,51,3,5,60,3,17,59,
+    23,0,245,1,99,111,110,115,116,32,69,110,116,105,116,121,32,97,32,61,
+    31,0,159,46,99,114,101,97,116,101,40,41,40,0,0,31,98,40,0,20,
+    31,99,40,0,7,5,19,3,161,97,100,100,40,97,44,32,80,111,115,191,
+    2,99,123,49,44,32,49,125,117,0,9,37,0,23,98,37,0,79,50,44,
+    32,50,37,0,2,23,99,37,0,64,51,44,32,51,37,0,1,232,0,5,
+    75,0,16,114,42,1,36,101,60,112,0,51,62,40,97,109,0,20,67,189,
+    3,70,80,111,111,108,32,0,51,38,32,112,155,0,24,115,206,0,0,161,
+    3,6,37,0,4,38,1,2,140,3,5,49,0,196,46,115,105,122,101,40,
+    41,32,61,61,32,50,102,0,1,174,3,21,33,143,0,55,104,97,115,71,
+    0,41,97,41,39,0,6,73,0,17,101,161,1,65,65,116,40,48,78,0,
+    64,99,41,59,32,21,5,242,3,104,101,32,108,97,115,116,32,115,108,111,
+    116,32,102,105,108,108,101,254,4,65,104,111,108,101,247,0,2,145,0,5,
+    110,0,55,103,101,116,110,0,64,99,41,46,120,156,0,70,51,32,38,38,
+    248,1,10,36,0,19,98,36,0,0,192,0,30,125,120,2,149,69,97,99,
+    104,74,111,105,110,115,62,1,31,115,114,2,13,1,182,3,2,61,5,18,
+    60,120,2,130,62,32,109,111,118,105,110,103,106,2,0,228,5,16,40,240,
+    4,17,105,233,4,196,32,105,32,60,32,49,48,59,32,43,43,105,204,2,
+    0,38,3,9,185,2,2,31,1,8,160,1,10,190,2,0,49,0,5,5,
+    1,0,114,2,2,49,0,7,45,2,176,102,108,111,97,116,40,105,41,44,
+    32,48,52,2,0,49,0,0,4,0,0,185,4,80,105,32,37,32,51,40,
+    1,24,48,128,0,0,30,0,15,83,0,2,128,86,101,108,111,99,105,116,
+    121,202,2,9,76,0,0,50,0,2,233,0,178,46,112,117,115,104,95,98,
+    97,99,107,40,137,0,3,246,1,0,34,0,17,125,184,1,2,6,0,15,
+    43,1,1,114,118,105,115,105,116,101,100,44,1,5,129,0,69,101,97,99,
+    104,218,1,36,44,32,132,0,98,62,40,91,38,93,40,102,1,18,32,107,
+    0,6,244,0,6,218,2,6,49,0,51,38,32,118,191,0,8,236,0,2,
+    70,2,4,142,2,2,53,2,2,49,1,2,84,0,16,41,65,2,4,57,
+    0,2,31,0,23,49,211,0,3,179,0,15,246,0,5,4,112,1,2,102,
+    0,3,45,0,0,112,1,2,45,1,63,41,59,10,121,2,0,113,68,101,
+    115,116,114,111,121,248,4,23,101,126,2,223,65,110,100,82,101,99,121,99,
+    108,101,115,73,100,140,2,14,9,69,2,31,97,64,2,7,5,104,1,0,
+    60,2,8,174,4,4,188,0,12,33,0,93,84,105,110,116,123,29,0,10,
+    149,2,5,52,0,18,100,204,0,6,138,4,11,36,4,139,105,115,65,108,
+    105,118,101,40,30,4,5,64,0,6,102,4,4,118,1,2,75,1,5,33,
+    0,12,173,4,7,152,4,16,48,187,1,10,41,0,0,188,0,56,62,40,
+    41,37,0,3,205,1,11,87,0,4,207,0,0,172,1,0,70,5,15,167,
+    1,0,240,15,80,97,114,97,108,108,101,108,70,111,114,67,111,118,101,114,
+    115,69,118,101,114,121,73,110,100,101,120,79,110,99,28,5,2,158,6,17,
+    84,195,9,0,122,5,18,32,2,9,51,115,40,52,117,0,8,5,3,1,
+    12,0,2,178,9,243,3,60,105,110,116,62,62,32,104,105,116,115,40,49,
+    48,48,48,48,51,48,0,5,64,4,82,114,111,117,110,100,68,4,2,11,
+    0,48,60,32,51,71,4,1,13,0,8,223,2,3,114,0,38,46,112,173,
+    0,16,40,88,0,3,2,1,32,44,32,96,0,32,44,32,75,3,1,129,
+    0,0,112,1,168,95,116,32,98,101,103,105,110,44,32,19,0,56,101,110,
+    100,89,0,0,208,3,1,143,0,8,36,0,0,215,4,1,59,0,17,59,
+    219,4,48,101,110,100,149,0,33,105,41,248,3,0,50,0,4,4,0,32,
+    43,43,133,0,50,91,105,93,236,3,0,23,0,4,82,2,2,31,4,17,
+    98,241,10,146,108,108,32,61,32,116,114,117,101,39,0,1,112,0,2,216,
+    2,1,118,0,7,46,1,145,38,32,99,111,117,110,116,32,58,54,1,6,
+    113,0,17,97,67,0,0,6,0,20,38,35,0,66,61,61,32,51,80,0,
+    2,244,1,63,97,108,108,136,3,3,4,225,1,19,77,112,11,213,77,97,
+    116,99,104,101,115,83,101,114,105,97,108,11,6,2,144,0,16,66,145,1,
+    50,115,32,98,7,0,192,61,32,123,49,48,48,46,48,102,44,32,53,7,
+    0,18,125,112,0,5,168,8,17,115,67,0,11,21,0,4,163,1,2,23,
+    0,81,115,112,97,119,110,222,4,66,105,101,115,40,49,0,0,78,0,67,
+    48,48,48,44,103,0,51,44,32,55,24,2,10,45,0,4,73,0,15,47,
+    0,6,15,146,2,0,13,98,2,66,116,105,99,107,97,2,1,10,0,65,
+    60,32,49,50,169,6,0,14,0,8,8,2,4,141,12,17,83,140,12,5,
+    169,0,68,48,46,49,102,168,0,3,165,0,0,229,1,11,46,0,6,170,
+    0,8,48,0,51,44,32,38,183,2,3,58,0,7,19,2,73,115,97,109,
+    101,20,2,1,41,2,90,105,110,115,105,100,24,0,2,50,1,25,46,61,
+    6,15,51,6,20,8,223,0,2,222,1,4,82,9,164,38,32,111,116,104,
+    101,114,32,61,32,186,0,26,46,83,8,3,52,6,2,195,1,0,241,0,
+    3,176,0,1,7,0,22,38,150,6,2,73,6,1,77,0,32,46,120,167,
+    4,5,129,6,16,121,114,4,2,25,0,22,121,71,0,5,225,0,3,9,
+    0,10,75,0,49,62,61,32,236,4,5,69,0,67,120,32,60,61,37,2,
+    107,46,119,105,100,116,104,99,0,3,49,0,13,151,3,5,16,10,39,46,
+    121,66,0,98,104,101,105,103,104,116,141,0,4,166,3,2,59,3,0,215,
+    0,3,164,1,2,17,0,2,159,0,2,79,3,0,232,8,69,109,97,105,
+    110,42,3,15,205,11,12,2,97,0,0,37,0,15,122,9,2,6,31,0,
+    15,32,7,21,6,50,0,4,202,3,15,171,5,6,14,43,0,15,245,3,
+    4,2,41,0,0,59,9,4,78,13,57,32,62,32,61,9,1,154,4,4,
+    186,13,5,37,0,209,60,60,32,34,32,99,104,101,99,107,40,115,41,239,
+    14,32,101,100,167,13,5,131,1,242,4,114,101,116,117,114,110,32,69,88,
+    73,84,95,70,65,73,76,85,82,69,108,0,2,253,2,2,86,0,48,111,
+    117,116,253,13,129,34,65,108,108,32,69,67,83,31,13,103,115,32,112,97,
+    115,115,78,0,8,74,0,112,83,85,67,67,69,83,83,103,8,0,244,95,
+    67,88,88,32,61,32,103,43,43,10,79,80,84,73,77,73,90,65,84,73,
+    79,78,95,76,69,86,69,76,32,61,32,45,79,50,10,35,32,83,111,117,
+    114,99,101,32,102,105,108,101,115,32,102,111,114,32,116,104,101,32,108,105,
+    98,114,97,114,121,58,32,97,108,108,32,101,120,99,101,112,116,32,109,97,
+    105,110,46,99,112,112,10,83,82,67,32,61,32,36,40,102,105,108,116,101,
+    114,45,111,117,116,32,115,114,99,47,32,0,193,44,32,36,40,119,105,108,
+    100,99,97,114,100,25,0,16,42,54,0,145,41,41,10,77,65,73,78,32,
+    61,19,0,4,44,0,144,10,73,78,67,76,85,68,69,83,143,0,240,20,
+    73,105,110,99,108,117,100,101,10,10,35,32,61,61,61,32,68,101,98,117,
+    103,32,99,111,110,102,105,103,117,114,97,116,105,111,110,24,0,145,10,68,
+    66,71,95,70,76,65,71,53,0,16,87,162,0,36,36,40,72,0,65,41,
+    32,45,103,33,0,49,79,66,74,165,0,114,112,97,116,115,117,98,115,163,
+    0,16,37,138,0,144,44,32,98,117,105,108,100,47,100,95,0,128,47,111,
+    98,106,47,37,46,111,181,0,81,83,82,67,41,41,61,0,89,76,73,66,
+    32,61,39,0,241,10,108,105,98,47,108,105,98,123,123,112,114,111,106,101,
+    99,116,95,110,97,109,101,125,125,46,97,48,0,17,66,217,0,8,87,0,
+    76,98,105,110,47,45,0,4,216,0,127,82,101,108,101,97,115,101,218,0,
+    0,63,82,69,76,218,0,8,46,36,40,199,1,32,41,10,52,0,15,237,
+    0,15,18,114,116,0,14,239,0,0,63,0,8,239,0,4,41,0,15,241,
+    0,7,0,50,0,8,241,0,4,50,0,15,243,0,5,4,239,0,48,112,
+    114,111,101,2,240,11,32,97,110,100,32,112,114,101,99,111,109,112,105,108,
+    101,100,32,104,101,97,100,101,114,32,114,117,129,2,240,15,40,99,112,112,
+    115,116,97,114,116,101,114,46,109,107,41,10,80,82,79,70,73,76,69,95,
+    84,65,82,71,69,84,242,1,35,36,40,129,0,34,41,32,11,0,52,79,
+    66,74,11,0,83,76,73,66,41,10,70,2,25,32,74,0,0,124,1,115,
+    69,109,105,116,32,46,100,235,2,240,0,110,101,120,116,32,116,111,32,101,
+    97,99,104,32,111,98,213,1,52,32,115,111,142,0,176,101,100,105,116,115,
+    32,116,114,105,103,103,156,0,4,174,0,85,115,10,68,69,80,124,2,240,
+    10,77,77,68,32,45,77,80,10,10,46,68,69,70,65,85,76,84,95,71,
+    79,65,76,32,58,61,55,3,176,10,36,40,101,118,97,108,32,36,40,99,
+    163,2,231,80,67,72,95,82,85,76,69,83,44,68,66,71,44,43,2,48,
+    44,36,40,121,2,53,44,36,40,216,2,63,41,41,41,62,0,6,51,82,
+    69,76,62,0,3,120,1,6,64,0,0,24,1,1,156,0,0,64,0,98,
+    10,97,108,108,58,32,85,0,64,66,73,78,41,1,1,0,85,3,16,66,
+    252,2,116,32,115,116,97,116,105,99,231,3,3,106,3,66,61,61,61,10,
+    49,0,0,72,1,4,61,0,0,95,1,208,10,9,109,107,100,105,114,32,
+    45,112,32,36,40,9,0,250,2,36,64,41,10,9,97,114,32,114,99,115,
+    32,36,64,32,36,94,95,0,253,0,116,101,115,116,32,101,120,101,99,117,
+    116,97,98,108,101,96,0,0,145,0,4,96,0,0,108,0,15,96,0,3,
+    80,36,40,67,88,88,219,1,6,25,1,49,32,45,111,112,0,16,40,76,
+    4,67,41,32,45,76,143,0,94,60,41,32,45,108,112,3,7,103,1,4,
+    250,2,17,58,128,4,1,9,4,3,30,1,0,154,1,79,71,67,72,41,
+    133,0,23,2,37,1,0,56,0,2,111,1,0,73,0,3,23,2,114,41,
+    32,45,99,32,36,60,168,0,10,21,1,11,116,1,4,23,3,0,118,1,
+    3,203,1,0,19,1,0,197,1,0,31,1,34,10,10,222,2,0,31,1,
+    4,24,0,15,139,1,49,8,119,0,2,98,0,0,110,0,4,98,0,0,
+    110,0,15,8,1,12,0,161,0,3,247,0,15,141,1,33,3,235,0,15,
+    143,1,3,0,92,0,0,87,1,15,143,1,16,0,43,0,3,135,0,2,
+    199,0,0,56,0,5,17,0,4,166,3,15,143,1,2,144,82,117,110,32,
+    117,110,105,116,32,167,2,177,115,32,40,101,120,97,109,112,108,101,41,93,
+    6,20,45,63,4,2,229,1,144,79,66,74,58,46,111,61,46,100,136,2,
+    0,116,0,6,17,0,32,10,10,64,0,23,58,47,1,8,111,2,95,98,
+    105,110,10,9,194,2,2,16,73,55,0,16,115,34,2,11,48,0,16,47,
+    25,0,82,95,109,97,116,104,154,0,6,16,0,0,183,6,79,10,9,46,
+    47,49,0,6,4,106,2,0,219,0,209,119,105,116,104,32,118,97,108,103,
+    114,105,110,100,212,0,4,13,0,0,230,1,0,76,3,0,242,1,36,10,
+    9,22,0,242,26,32,45,45,108,101,97,107,45,99,104,101,99,107,61,102,
+    117,108,108,32,45,45,116,114,97,99,107,45,111,114,105,103,105,110,115,61,
+    121,101,115,32,46,47,18,1,1,61,0,74,10,114,117,110,78,0,13,31,
+    0,19,45,234,1,0,39,0,0,57,1,1,56,0,16,9,39,0,5,14,
+    0,242,0,10,99,108,101,97,110,58,10,9,114,109,32,45,114,102,113,7,
+    240,7,10,10,104,101,108,112,58,32,35,35,32,83,104,111,119,115,32,116,
+    104,105,115,32,20,0,225,10,9,64,101,99,104,111,32,34,65,118,97,105,
+    108,89,4,149,116,97,114,103,101,116,115,58,34,28,0,16,32,124,5,20,
+    32,1,0,34,45,32,240,4,1,236,7,80,32,118,101,114,115,69,8,152,
+    40,100,101,102,97,117,108,116,41,55,0,3,175,0,1,58,0,4,55,0,
+    164,111,112,116,105,109,105,122,101,100,32,30,0,3,25,9,1,197,6,6,
+    225,4,8,72,0,0,197,1,1,69,0,98,32,32,32,45,32,67,230,6,
+    1,48,0,25,114,120,2,8,52,0,0,26,0,6,52,0,0,197,1,0,
+    33,9,8,66,5,50,105,110,32,196,0,75,109,111,100,101,59,0,4,106,
+    1,63,32,45,32,59,0,4,4,190,0,12,61,0,5,3,2,1,172,0,
+    0,61,0,2,101,0,6,218,0,25,32,78,2,8,121,0,1,188,1,3,
+    181,0,129,45,32,82,101,109,111,118,101,124,1,5,217,7,0,238,7,17,
+    115,250,0,184,100,105,114,101,99,116,111,114,105,101,115,67,0,0,213,1,
+    3,66,0,33,32,45,238,1,6,237,1,6,40,0,6,10,0,32,79,112,
+    4,10,10,238,1,83,80,67,72,61,49,69,0,53,45,32,80,88,8,1,
+    199,10,243,1,109,111,115,116,32,102,114,101,113,117,101,110,116,108,121,32,
+    220,3,131,100,32,115,121,115,116,101,109,237,7,9,148,0,3,113,8,16,
+    61,224,9,0,81,1,2,56,9,19,32,213,0,17,114,207,0,194,102,108,
+    97,103,115,32,102,114,111,109,32,112,213,8,32,115,47,48,0,71,46,109,
+    107,32,193,8,242,8,32,116,117,110,101,41,34,10,10,70,79,82,67,69,
+    58,10,10,46,80,72,79,78,89,85,11,4,147,1,1,47,2,0,0,2,
+    53,114,117,110,201,1,5,152,1,2,101,1,1,40,1,1,69,0,0,240,
+    69,35,35,32,71,101,110,101,114,97,116,101,32,115,116,97,116,105,99,32,
+    108,105,98,114,97,114,121,32,40,66,121,32,100,101,102,97,117,108,116,41,
+    10,10,96,96,96,98,97,115,104,10,99,109,97,107,101,32,45,68,67,77,
+    65,75,69,95,66,85,73,76,68,95,84,89,80,69,61,82,101,108,101,97,
+    115,101,32,46,46,44,0,40,10,10,90,0,95,100,121,110,97,109,91,0,
+    47,34,45,68,112,0,227,83,72,65,82,69,68,95,76,73,66,83,61,79,
+    78,114,0,0,241,7,35,112,114,97,103,109,97,32,111,110,99,101,10,10,
+    105,110,116,32,97,100,100,40,8,0,32,44,32,7,0,49,98,41,59,23,
+    0,140,115,117,98,116,114,97,99,116,28,0,0,245,5,35,105,110,99,108,
+    117,100,101,32,60,105,111,115,116,114,101,97,109,62,10,20,0,240,41,34,
+    111,112,101,114,97,116,105,111,110,115,46,104,34,10,10,105,110,116,32,109,
+    97,105,110,40,41,32,123,10,32,32,32,32,115,116,100,58,58,99,111,117,
+    116,32,60,60,32,34,53,32,43,32,51,32,61,32,34,14,0,144,97,100,
+    100,40,53,44,32,51,41,13,0,1,40,0,95,101,110,100,108,59,55,0,
+    2,22,45,55,0,143,115,117,98,116,114,97,99,116,60,0,6,1,65,0,
+    192,114,101,116,117,114,110,32,48,59,10,125,10,241,18,35,105,110,99,108,
+    117,100,101,32,34,111,112,101,114,97,116,105,111,110,115,46,104,34,10,10,
+    105,110,116,32,97,100,100,40,8,0,32,44,32,7,0,242,9,98,41,32,
+    123,10,32,32,32,32,114,101,116,117,114,110,32,97,32,43,32,98,59,10,
+    125,45,0,143,115,117,98,116,114,97,99,116,50,0,11,18,45,50,0,0,
+    240,56,67,88,88,32,61,32,103,43,43,10,79,80,84,73,77,73,90,65,
+    84,73,79,78,95,76,69,86,69,76,32,61,32,45,79,50,10,83,82,67,
+    32,61,32,36,40,119,105,108,100,99,97,114,100,32,115,114,99,47,42,46,
+    99,112,112,41,10,73,78,67,76,85,68,69,83,43,0,241,66,73,105,110,
+    99,108,117,100,101,10,10,35,32,76,105,98,114,97,114,105,101,115,32,102,
+    111,114,32,79,112,101,110,71,76,32,50,46,49,32,40,65,100,106,117,115,
+    116,32,97,99,99,111,114,100,105,110,103,32,116,111,32,121,111,117,114,32,
+    115,121,115,116,101,109,41,10,76,73,66,83,95,79,80,69,78,71,129,0,
+    160,108,71,76,32,45,108,103,108,102,119,88,0,241,21,61,61,61,32,68,
+    101,98,117,103,32,99,111,110,102,105,103,117,114,97,116,105,111,110,32,61,
+    61,61,10,68,66,71,95,70,76,65,71,141,0,116,87,97,108,108,32,36,
+    40,160,0,65,41,32,45,103,33,0,49,79,66,74,205,0,129,112,97,116,
+    115,117,98,115,116,205,0,16,37,205,0,144,44,32,98,117,105,108,100,47,
+    100,95,0,241,2,47,111,98,106,47,37,46,111,44,32,36,40,83,82,67,
+    41,41,61,0,89,66,73,78,32,61,39,0,242,5,98,105,110,47,123,123,
+    112,114,111,106,101,99,116,95,110,97,109,101,125,125,194,0,96,68,69,66,
+    85,71,32,56,1,7,209,0,20,41,196,0,127,82,101,108,101,97,115,101,
+    198,0,0,63,82,69,76,198,0,8,46,36,40,167,1,32,41,10,52,0,
+    15,217,0,15,18,114,116,0,14,219,0,0,63,0,8,219,0,4,41,0,
+    15,221,0,2,52,10,35,32,189,0,240,52,112,114,111,102,105,108,101,32,
+    97,110,100,32,112,114,101,99,111,109,112,105,108,101,100,32,104,101,97,100,
+    101,114,32,114,117,108,101,115,32,40,99,112,112,115,116,97,114,116,101,114,
+    46,109,107,41,10,80,82,79,70,73,76,69,95,84,65,82,71,69,84,172,
+    1,35,36,40,129,0,34,41,32,11,0,83,79,66,74,41,10,77,2,25,
+    32,63,0,2,91,1,127,82,69,76,69,65,83,69,93,1,2,128,69,109,
+    105,116,32,46,100,32,153,0,96,115,32,110,101,120,116,97,2,112,101,97,
+    99,104,32,111,98,165,1,52,32,115,111,161,0,176,101,100,105,116,115,32,
+    116,114,105,103,103,175,0,4,193,0,85,115,10,68,69,80,73,2,240,20,
+    77,77,68,32,45,77,80,10,10,46,68,69,70,65,85,76,84,95,71,79,
+    65,76,32,58,61,32,97,108,108,10,36,40,101,118,97,105,2,16,99,112,
+    2,231,80,67,72,95,82,85,76,69,83,44,68,66,71,44,79,2,18,44,
+    70,2,53,44,36,40,165,2,63,41,41,41,62,0,6,51,82,69,76,62,
+    0,3,139,1,6,64,0,0,43,1,1,156,0,0,64,0,98,10,97,108,
+    108,58,32,85,0,102,66,73,78,41,10,10,12,0,4,24,0,1,77,1,
+    192,9,109,107,100,105,114,32,45,112,32,36,40,9,0,160,36,64,41,10,
+    9,36,40,67,88,88,116,1,6,148,0,193,32,45,111,32,36,64,32,36,
+    94,32,36,40,183,2,1,198,2,55,41,10,10,204,0,4,64,2,22,58,
+    59,3,3,131,0,0,255,0,95,71,67,72,41,10,111,0,22,2,175,0,
+    0,56,0,2,212,0,0,73,0,3,124,1,114,41,32,45,99,32,36,60,
+    146,0,35,10,10,9,1,0,214,0,0,3,1,4,238,0,4,12,0,4,
+    24,0,15,238,0,16,0,51,0,3,110,0,12,238,0,3,89,2,5,240,
+    0,3,117,0,15,242,0,3,0,72,0,0,186,0,15,242,0,16,0,43,
+    0,3,115,0,2,226,2,0,56,0,5,17,0,4,110,2,11,242,0,20,
+    45,2,3,2,37,1,144,79,66,74,58,46,111,61,46,100,178,1,0,81,
+    0,6,17,0,0,85,4,243,4,83,104,97,112,101,66,97,116,99,104,32,
+    110,101,101,100,115,32,110,111,119,5,16,44,242,2,1,233,2,65,101,115,
+    116,115,173,3,247,13,98,101,110,99,104,109,97,114,107,32,114,117,110,32,
+    97,110,121,119,104,101,114,101,10,116,101,115,116,58,189,1,8,245,1,63,
+    98,105,110,50,2,4,16,73,55,0,16,115,168,1,11,48,0,16,47,25,
+    0,32,95,115,153,0,33,95,98,154,0,0,17,0,29,115,23,0,0,125,
+    5,1,76,2,7,43,0,0,20,0,79,10,9,46,47,83,0,13,0,251,
+    0,241,1,68,114,97,119,115,32,116,104,114,111,117,103,104,32,71,108,6,
+    1,241,80,82,101,110,100,101,114,101,114,32,105,110,116,111,32,97,110,32,
+    111,102,102,115,99,114,101,101,110,32,69,71,76,32,112,98,117,102,102,101,
+    114,59,32,119,111,114,107,115,10,35,32,119,105,116,104,111,117,116,32,97,
+    32,100,105,115,112,108,97,121,32,111,110,32,77,101,115,97,39,115,32,115,
+    111,102,116,119,97,114,101,32,114,97,115,116,101,114,105,122,101,114,44,1,
+    63,45,103,108,47,1,62,46,103,108,44,1,4,20,0,0,21,1,80,32,
+    92,10,9,9,129,7,4,21,0,35,95,114,234,0,1,30,0,0,26,0,
+    11,71,1,48,32,45,108,242,0,255,15,45,108,71,76,10,9,76,73,66,
+    71,76,95,65,76,87,65,89,83,95,83,79,70,84,87,65,82,69,61,49,
+    32,106,1,4,4,101,0,224,10,10,83,72,65,80,69,83,32,63,61,32,
+    49,48,1,0,82,10,70,82,65,77,17,0,65,50,48,48,10,82,2,14,
+    13,1,4,65,3,10,62,2,0,190,2,3,254,2,35,45,111,79,7,7,
+    42,0,17,47,77,0,9,57,2,1,18,0,14,24,0,15,243,0,5,6,
+    58,2,15,87,0,11,34,36,40,215,0,0,83,3,2,208,0,176,41,10,
+    10,118,97,108,103,114,105,110,100,83,4,0,26,5,1,107,4,20,9,22,
+    0,242,26,32,45,45,108,101,97,107,45,99,104,101,99,107,61,102,117,108,
+    108,32,45,45,116,114,97,99,107,45,111,114,105,103,105,110,115,61,121,101,
+    115,32,46,47,182,3,1,61,0,74,10,114,117,110,78,0,13,31,0,19,
+    45,169,0,0,39,0,0,31,1,1,56,0,16,9,39,0,5,14,0,242,
+    0,10,99,108,101,97,110,58,10,9,114,109,32,45,114,102,56,1,225,10,
+    10,104,101,108,112,58,32,35,35,32,83,104,111,7,3,48,105,115,32,20,
+    0,245,13,10,9,64,101,99,104,111,32,34,65,118,97,105,108,97,98,108,
+    101,32,116,97,114,103,101,116,115,58,34,28,0,16,32,197,6,20,32,1,
+    0,48,45,32,66,2,9,17,32,2,9,80,32,118,101,114,115,91,9,152,
+    40,100,101,102,97,117,108,116,41,55,0,3,175,0,1,58,0,4,55,0,
+    147,111,112,116,105,109,105,122,101,100,121,4,113,32,97,112,112,108,105,99,
+    161,9,8,60,0,0,6,4,1,57,0,98,32,32,32,45,32,67,54,8,
+    1,152,4,0,142,4,71,116,104,101,32,205,4,0,45,0,53,115,32,40,
+    206,4,1,222,4,41,101,100,141,0,0,36,0,49,45,103,108,84,0,109,
+    45,32,84,101,115,116,6,4,6,254,3,4,40,4,0,20,3,16,40,225,
+    3,2,3,4,1,20,8,73,108,101,115,115,90,0,1,120,2,1,88,0,
+    0,171,0,66,84,105,109,101,119,1,0,184,10,2,59,2,17,32,110,3,
+    36,115,32,38,1,3,31,3,184,41,32,112,101,114,32,102,114,97,109,101,
+    251,0,0,225,0,3,79,0,111,32,45,32,82,117,110,43,1,0,51,32,
+    105,110,130,1,60,109,111,100,62,0,4,40,2,15,62,0,10,4,157,1,
+    12,64,0,5,196,2,1,121,1,0,126,0,2,234,1,7,168,1,1,8,
+    5,20,32,41,0,8,187,0,1,126,2,3,188,0,129,45,32,82,101,109,
+    111,118,101,62,2,5,247,9,2,115,9,176,97,110,100,32,100,105,114,101,
+    99,116,111,0,12,8,67,0,0,151,2,3,66,0,33,32,45,176,2,51,
+    32,116,104,175,2,6,40,0,6,10,0,32,79,112,220,11,10,176,2,83,
+    80,67,72,61,49,69,0,68,45,32,80,114,181,9,16,32,56,2,243,1,
+    109,111,115,116,32,102,114,101,113,117,101,110,116,108,121,32,66,7,19,100,
+    92,12,1,228,1,54,101,114,115,98,0,35,32,32,143,10,16,61,187,11,
+    0,85,1,2,36,11,19,32,213,0,17,114,151,2,179,102,108,97,103,115,
+    32,102,114,111,109,32,243,10,32,115,47,48,0,56,46,109,107,223,10,241,
+    9,32,116,117,110,101,41,34,10,10,70,79,82,67,69,58,10,10,46,80,
+    72,79,78,89,58,38,1,4,148,1,0,172,2,16,32,5,0,0,177,2,
+    2,95,2,0,21,2,53,114,117,110,219,1,4,126,1,18,32,115,1,1,
+    54,1,1,83,0,0,240,12,47,47,32,67,111,115,116,32,111,102,32,98,
+    117,105,108,100,105,110,103,32,97,32,102,114,97,109,101,20,0,240,46,115,
+    104,97,112,101,115,32,111,110,32,116,104,101,32,67,80,85,44,32,119,105,
+    116,104,111,117,116,32,79,112,101,110,71,76,58,10,47,47,32,32,32,109,
+    97,107,101,32,98,101,110,99,104,32,91,83,72,65,80,69,83,61,49,48,
+    1,0,247,20,93,32,91,70,82,65,77,69,83,61,50,48,48,93,10,35,
+    105,110,99,108,117,100,101,32,60,97,108,103,111,114,105,116,104,109,62,21,
+    0,105,99,104,114,111,110,111,18,0,104,115,116,100,108,105,98,19,0,166,
+    105,111,115,116,114,101,97,109,62,10,58,0,17,34,169,0,240,7,95,98,
+    97,116,99,104,46,104,112,112,34,10,10,105,110,116,32,109,97,105,110,40,
+    9,0,240,17,97,114,103,99,44,32,99,104,97,114,42,32,97,114,103,118,
+    91,93,41,32,123,10,32,32,32,32,99,111,110,115,116,32,36,0,1,67,
+    0,48,115,32,61,33,0,241,3,99,32,62,32,49,32,63,32,115,116,100,
+    58,58,97,116,111,105,40,54,0,98,49,93,41,32,58,32,218,0,27,59,
+    63,0,1,52,1,7,63,0,30,50,63,0,17,50,63,0,81,50,48,48,
+    59,10,61,0,16,83,94,1,16,66,180,0,17,32,186,0,2,83,0,1,
+    116,0,224,115,105,122,101,95,116,32,118,101,114,116,105,99,101,87,0,18,
+    48,30,0,243,5,100,111,117,98,108,101,32,102,97,115,116,101,115,116,32,
+    61,32,49,101,51,27,0,65,102,111,114,32,238,0,1,139,0,83,32,61,
+    32,48,59,202,1,18,60,8,0,81,115,59,32,43,43,29,0,4,254,0,
+    6,2,1,144,97,117,116,111,32,115,116,97,114,84,0,1,131,0,2,141,
+    1,242,6,58,58,115,116,101,97,100,121,95,99,108,111,99,107,58,58,110,
+    111,119,40,41,139,0,0,61,0,1,184,0,104,46,99,108,101,97,114,23,
+    0,5,139,0,18,105,135,0,66,105,32,60,32,96,1,0,131,0,24,105,
+    127,0,0,70,0,2,133,1,225,102,108,111,97,116,32,120,32,61,32,40,
+    105,32,37,103,1,246,2,41,32,42,32,48,46,48,48,50,102,32,45,32,
+    49,46,48,102,122,0,12,56,0,18,121,56,0,17,47,56,0,15,63,0,
+    19,2,189,0,247,4,115,101,116,67,111,108,111,114,40,120,44,32,121,44,
+    32,48,46,53,102,225,0,0,103,0,34,105,102,146,0,33,50,41,183,1,
+    0,19,0,4,4,0,2,67,0,149,97,100,100,67,105,114,99,108,101,68,
+    0,123,48,49,102,44,32,49,54,73,0,79,101,108,115,101,67,0,7,89,
+    83,113,117,97,114,67,0,7,63,0,21,125,56,0,2,45,1,3,8,2,
+    96,115,101,99,111,110,100,32,2,9,180,1,146,100,117,114,97,116,105,111,
+    110,60,39,0,41,62,40,30,0,30,115,210,1,34,32,45,253,1,121,41,
+    46,99,111,117,110,116,204,1,5,107,2,1,69,0,67,109,105,110,40,126,
+    2,35,44,32,127,0,7,168,0,7,178,2,2,28,1,192,116,114,105,97,
+    110,103,108,101,115,40,41,46,214,2,4,91,0,18,125,4,3,1,84,0,
+    16,99,81,4,20,60,35,2,83,32,60,60,32,34,47,2,48,32,40,34,
+    15,0,5,86,0,1,27,0,4,14,0,82,41,32,112,101,114,219,2,48,
+    44,32,98,15,3,49,111,102,32,48,0,1,229,2,16,115,58,0,85,34,
+    58,92,110,34,60,1,2,183,1,1,69,0,3,41,0,3,221,0,16,42,
+    72,3,1,48,0,65,32,109,115,47,63,0,30,44,34,0,52,57,32,47,
+    152,0,1,68,0,64,110,115,47,115,196,3,50,92,110,34,153,2,192,114,
+    101,116,117,114,110,32,48,59,10,125,10,255,22,35,105,102,110,100,101,102,
+    32,71,76,95,66,65,84,67,72,95,82,69,78,68,69,82,69,82,95,72,
+    80,80,10,35,100,101,102,105,110,101,30,0,4,246,5,10,35,105,110,99,
+    108,117,100,101,32,60,71,76,47,103,108,46,104,62,10,20,0,240,18,34,
+    115,104,97,112,101,95,98,97,116,99,104,46,104,112,112,34,10,10,47,47,
+    32,85,112,108,111,97,100,115,32,97,32,83,31,0,16,66,30,0,240,34,
+    32,105,110,116,111,32,118,101,114,116,101,120,32,98,117,102,102,101,114,32,
+    111,98,106,101,99,116,115,32,97,110,100,32,100,114,97,119,115,32,105,116,
+    32,119,105,116,104,32,111,110,101,73,0,240,55,103,108,68,114,97,119,65,
+    114,114,97,121,115,32,112,101,114,32,112,114,105,109,105,116,105,118,101,32,
+    116,121,112,101,44,32,116,104,114,111,117,103,104,32,116,104,101,32,79,112,
+    101,110,71,76,32,50,46,49,32,102,105,120,101,100,45,102,117,110,99,116,
+    105,111,110,74,0,3,121,0,0,106,0,113,99,111,108,111,114,32,97,85,
+    0,81,46,32,78,101,101,170,0,241,33,99,117,114,114,101,110,116,32,99,
+    111,110,116,101,120,116,32,102,111,114,32,105,116,115,32,119,104,111,108,101,
+    32,108,105,102,101,116,105,109,101,46,10,99,108,97,115,115,32,71,108,213,
+    0,252,7,82,101,110,100,101,114,101,114,32,123,10,112,117,98,108,105,99,
+    58,10,32,32,32,30,0,49,40,41,59,23,0,27,126,54,0,0,24,0,
+    1,25,0,12,24,0,92,99,111,110,115,116,70,0,178,38,41,32,61,32,
+    100,101,108,101,116,101,79,0,11,54,0,207,38,32,111,112,101,114,97,116,
+    111,114,61,40,65,0,15,1,120,0,161,47,47,32,82,101,116,117,114,110,
+    115,65,1,64,110,117,109,98,150,1,17,102,141,1,241,5,32,99,97,108,
+    108,115,32,105,115,115,117,101,100,32,40,101,109,112,116,121,118,1,225,115,
+    32,97,114,101,32,115,107,105,112,112,101,100,41,73,0,49,105,110,116,52,
+    0,3,121,0,6,246,1,33,38,32,27,2,178,41,59,10,10,112,114,105,
+    118,97,116,101,34,1,0,49,0,160,115,117,98,109,105,116,40,71,76,117,
+    14,0,2,19,2,224,44,32,71,76,101,110,117,109,32,109,111,100,101,44,
+    141,1,241,0,115,116,32,115,116,100,58,58,118,101,99,116,111,114,60,119,
+    1,17,86,70,2,33,62,38,79,2,64,105,99,101,115,96,0,1,121,1,
+    8,76,0,240,22,115,91,50,93,59,32,32,47,47,32,84,114,105,97,110,
+    103,108,101,115,44,32,108,105,110,101,115,10,125,59,10,10,35,101,110,100,
+    105,102,31,0,15,23,3,3,0,253,16,35,105,102,110,100,101,102,32,83,
+    72,65,80,69,95,66,65,84,67,72,95,72,80,80,10,35,100,101,102,105,
+    110,101,24,0,247,4,10,35,105,110,99,108,117,100,101,32,60,99,115,116,
+    100,105,110,116,62,19,0,56,109,97,112,15,0,240,49,118,101,99,116,111,
+    114,62,10,10,47,47,32,73,110,116,101,114,108,101,97,118,101,100,32,118,
+    101,114,116,101,120,32,97,115,32,117,112,108,111,97,100,101,100,32,116,111,
+    32,116,104,101,32,71,80,85,58,32,112,111,115,105,116,105,111,110,44,19,
+    0,242,11,110,32,82,71,66,65,32,99,111,108,111,114,10,115,116,114,117,
+    99,116,32,66,97,116,99,104,86,69,0,241,2,123,10,32,32,32,32,102,
+    108,111,97,116,32,120,44,32,121,59,16,0,241,12,115,116,100,58,58,117,
+    105,110,116,56,95,116,32,114,44,32,103,44,32,98,44,32,97,59,10,125,
+    59,142,0,160,99,111,115,47,115,105,110,32,111,102,100,0,128,32,99,111,
+    114,110,101,114,115,15,0,240,25,97,32,114,101,103,117,108,97,114,32,112,
+    111,108,121,103,111,110,32,119,105,116,104,32,96,115,101,103,109,101,110,116,
+    115,96,32,115,105,100,101,115,44,212,0,243,3,99,111,109,112,117,116,101,
+    100,32,111,110,99,101,32,112,101,114,32,38,0,224,32,99,111,117,110,116,
+    32,105,110,115,116,101,97,100,87,0,243,27,111,110,32,101,118,101,114,121,
+    32,100,114,97,119,10,99,108,97,115,115,32,67,105,114,99,108,101,84,97,
+    98,108,101,115,32,123,10,112,117,98,108,105,99,58,192,0,1,233,0,98,
+    80,111,105,110,116,32,227,0,15,231,0,1,0,206,0,0,24,0,112,99,
+    111,110,115,116,32,115,245,0,2,116,1,17,60,58,0,112,62,38,32,103,
+    101,116,40,68,0,3,153,0,196,115,41,59,10,10,112,114,105,118,97,116,
+    101,106,0,191,100,58,58,109,97,112,60,105,110,116,44,67,0,0,49,62,
+    32,116,161,0,5,59,1,240,12,82,101,116,97,105,110,101,100,45,109,111,
+    100,101,32,115,104,97,112,101,32,108,105,115,116,46,32,83,12,0,176,115,
+    32,97,114,101,32,97,112,112,101,110,216,1,144,97,115,32,116,114,105,97,
+    110,103,228,0,160,40,111,114,32,108,105,110,101,115,41,62,1,197,105,110,
+    116,111,32,111,110,101,32,67,80,85,19,2,65,114,114,97,121,74,1,240,
+    11,112,114,105,109,105,116,105,118,101,32,116,121,112,101,44,32,115,111,32,
+    97,32,102,114,97,109,101,79,1,160,97,110,121,32,110,117,109,98,101,114,
+    74,0,34,111,102,136,0,176,115,32,105,115,32,115,117,98,109,105,116,150,
+    1,1,185,1,0,97,0,0,116,1,81,32,99,97,108,108,90,0,0,80,
+    0,80,32,40,115,101,101,59,0,33,71,108,77,2,16,82,174,0,241,5,
+    114,101,114,41,46,32,85,115,101,115,32,110,111,32,79,112,101,110,71,76,
+    121,0,208,105,116,32,99,97,110,32,98,101,32,116,101,115,90,0,240,0,
+    97,110,100,32,98,101,110,99,104,109,97,114,107,101,100,73,0,0,109,0,
+    241,13,111,117,116,32,97,32,99,111,110,116,101,120,116,46,32,99,108,101,
+    97,114,40,41,32,107,101,101,112,115,104,2,177,115,116,111,114,97,103,101,
+    32,102,111,114,16,0,66,110,101,120,116,213,0,19,46,20,2,1,68,1,
+    1,147,0,11,18,2,68,118,111,105,100,82,0,33,59,10,37,2,64,47,
+    47,32,67,23,3,0,17,1,0,61,3,1,140,1,65,115,32,97,100,121,
+    1,48,102,116,101,101,0,33,105,115,250,0,32,44,32,173,2,32,111,110,
+    195,2,161,32,105,110,32,91,48,44,32,49,93,71,0,1,90,0,49,115,
+    101,116,76,0,18,40,74,3,35,114,44,83,3,20,103,9,0,20,98,9,
+    0,128,97,32,61,32,49,46,48,102,74,2,0,124,2,64,47,47,32,83,
+    150,1,128,103,101,111,109,101,116,114,121,215,3,0,142,0,146,105,109,109,
+    101,100,105,97,116,101,41,2,64,102,117,110,99,213,3,16,115,126,0,2,
+    170,0,70,46,104,112,112,130,0,67,97,100,100,84,42,2,3,133,0,20,
+    120,115,0,20,121,9,0,82,115,105,122,101,41,226,3,1,182,0,159,97,
+    100,100,83,113,117,97,114,101,50,0,25,65,82,101,99,116,145,2,15,53,
+    0,6,84,119,105,100,116,104,116,0,107,104,101,105,103,104,116,118,0,2,
+    187,3,15,65,0,6,136,114,97,100,105,117,115,44,32,122,3,91,32,61,
+    32,51,50,71,0,53,76,105,110,187,0,20,49,113,0,21,121,10,0,37,
+    120,50,20,0,0,58,0,1,44,1,14,235,3,1,46,2,2,14,5,38,
+    62,38,110,3,32,40,41,138,2,181,115,116,32,123,32,114,101,116,117,114,
+    110,27,0,0,44,0,127,105,99,101,115,59,32,125,83,0,18,1,179,3,
+    14,79,0,0,23,0,8,75,0,10,88,4,1,160,1,2,233,5,24,40,
+    153,4,10,174,0,0,33,0,0,139,0,4,232,0,6,243,1,4,95,2,
+    15,60,0,5,14,206,0,1,204,0,15,47,0,6,9,174,0,6,43,0,
+    4,36,6,1,96,6,201,91,52,93,32,61,32,123,50,53,53,44,32,5,
+    0,18,125,116,2,2,246,1,3,177,5,17,99,190,5,18,115,24,5,112,
+    35,101,110,100,105,102,32,12,3,11,73,7,0,248,11,35,105,102,110,100,
+    101,102,32,83,72,65,80,69,83,95,72,80,80,10,35,100,101,102,105,110,
+    101,19,0,246,10,10,35,105,110,99,108,117,100,101,32,60,71,76,70,87,
+    47,103,108,102,119,51,46,104,62,10,25,0,241,53,34,115,104,97,112,101,
+    95,98,97,116,99,104,46,104,112,112,34,10,10,47,47,32,73,109,109,101,
+    100,105,97,116,101,45,109,111,100,101,32,104,101,108,112,101,114,115,58,32,
+    111,110,101,32,103,108,66,101,103,105,110,47,103,108,69,110,100,32,112,101,
+    114,32,67,0,48,46,32,70,126,0,208,102,111,114,32,97,32,104,97,110,
+    100,102,117,108,75,0,34,111,102,32,0,48,115,59,32,28,0,240,6,109,
+    97,110,121,44,32,97,100,100,32,116,104,101,109,32,116,111,32,97,32,83,
+    131,0,16,66,130,0,240,2,32,97,110,100,32,100,114,97,119,32,105,116,
+    32,119,105,116,104,66,0,33,71,108,28,0,241,2,82,101,110,100,101,114,
+    101,114,32,105,110,115,116,101,97,100,46,170,0,16,68,45,0,240,18,97,
+    32,116,114,105,97,110,103,108,101,32,99,101,110,116,101,114,101,100,32,97,
+    116,32,40,120,44,32,121,41,10,105,110,108,154,0,50,118,111,105,92,0,
+    19,84,44,0,162,40,102,108,111,97,116,32,120,44,32,9,0,20,121,9,
+    0,179,115,105,122,101,41,32,123,10,32,32,32,27,0,112,104,97,108,102,
+    32,61,32,25,0,129,32,47,32,50,46,48,102,59,30,0,18,103,12,1,
+    226,40,71,76,95,84,82,73,65,78,71,76,69,83,41,27,0,0,61,0,
+    161,103,108,86,101,114,116,101,120,50,102,139,0,48,32,43,32,73,0,15,
+    33,0,4,33,32,45,30,0,51,44,32,121,10,0,15,40,0,5,2,70,
+    0,13,40,0,1,144,1,88,40,41,59,10,125,25,1,95,115,113,117,97,
+    114,23,1,18,17,83,42,0,15,21,1,59,79,81,85,65,68,17,1,5,
+    3,230,0,13,200,0,12,57,1,3,54,1,15,40,0,25,2,34,1,15,
+    64,1,5,6,104,1,9,40,0,15,64,1,3,79,114,101,99,116,90,2,
+    22,20,82,45,0,15,70,1,6,84,119,105,100,116,104,104,2,107,104,101,
+    105,103,104,116,106,2,65,119,32,61,32,38,0,9,105,2,2,162,2,82,
+    104,104,32,61,32,54,0,9,30,0,7,135,2,15,114,1,13,19,119,72,
+    1,31,104,30,1,5,63,43,32,104,36,0,22,63,43,32,104,72,0,6,
+    19,45,72,0,7,36,0,15,98,1,3,95,99,105,114,99,108,162,2,18,
+    17,67,42,0,15,92,1,6,244,10,114,97,100,105,117,115,44,32,105,110,
+    116,32,115,101,103,109,101,110,116,115,32,61,32,51,50,98,1,114,115,116,
+    97,116,105,99,32,71,0,114,84,97,98,108,101,115,32,126,0,241,9,115,
+    59,32,47,47,32,71,76,32,99,97,108,108,115,32,99,111,109,101,32,102,
+    114,111,109,241,4,97,116,104,114,101,97,100,240,3,248,3,99,111,110,115,
+    116,32,115,116,100,58,58,118,101,99,116,111,114,60,77,0,176,58,58,80,
+    111,105,110,116,62,38,32,116,93,0,36,32,61,94,0,84,46,103,101,116,
+    40,147,0,3,121,1,7,180,1,4,59,4,67,95,70,65,78,30,0,12,
+    5,3,0,201,4,1,164,0,2,224,4,1,141,0,0,36,0,0,83,5,
+    16,40,241,0,181,105,32,61,32,48,59,32,105,32,60,61,253,0,84,59,
+    32,43,43,105,253,0,0,46,0,0,4,0,2,195,0,15,183,0,0,48,
+    38,32,112,190,0,34,32,61,190,0,69,91,105,32,37,74,0,22,93,212,
+    4,0,68,0,8,216,4,34,32,43,56,0,84,46,120,32,42,32,131,1,
+    21,121,22,0,21,121,22,0,7,218,0,17,125,192,0,8,15,2,96,35,
+    101,110,100,105,102,133,1,7,210,6,0,247,118,47,47,32,103,108,71,101,
+    110,66,117,102,102,101,114,115,32,97,110,100,32,102,114,105,101,110,100,115,
+    32,97,114,101,32,79,112,101,110,71,76,32,49,46,53,59,32,108,105,98,
+    71,76,32,101,120,112,111,114,116,115,32,116,104,101,109,32,100,105,114,101,
+    99,116,108,121,10,35,100,101,102,105,110,101,32,71,76,95,71,76,69,88,
+    84,95,80,82,79,84,79,84,89,80,69,83,10,10,35,105,110,99,108,117,
+    100,101,32,34,103,108,95,98,97,116,99,104,95,114,101,110,100,101,114,101,
+    114,46,104,112,112,34,34,0,198,60,71,76,47,103,108,101,120,116,46,104,
+    62,56,0,224,60,99,115,116,100,100,101,102,62,10,10,71,108,66,65,0,
+    19,82,64,0,43,58,58,17,0,137,40,41,32,123,10,32,32,32,215,0,
+    82,40,50,44,32,98,226,0,79,41,59,10,125,70,0,0,31,126,71,0,
+    7,99,68,101,108,101,116,101,33,1,13,74,0,75,105,110,116,32,60,0,
+    241,3,58,58,100,114,97,119,40,99,111,110,115,116,32,83,104,97,112,101,
+    179,0,33,38,32,251,0,6,160,0,243,20,69,110,97,98,108,101,67,108,
+    105,101,110,116,83,116,97,116,101,40,71,76,95,86,69,82,84,69,88,95,
+    65,82,82,65,89,41,59,202,0,15,42,0,2,89,67,79,76,79,82,41,
+    0,0,140,0,243,0,99,97,108,108,115,32,61,32,115,117,98,109,105,116,
+    40,246,0,64,91,48,93,44,156,1,162,84,82,73,65,78,71,76,69,83,
+    44,141,0,195,46,116,114,105,97,110,103,108,101,115,40,41,110,0,2,65,
+    0,29,43,66,0,18,49,66,0,54,76,73,78,62,0,55,108,105,110,58,
+    0,95,103,108,68,105,115,211,0,0,14,169,0,15,42,0,5,15,253,0,
+    2,66,66,105,110,100,126,1,0,32,1,1,25,1,163,95,66,85,70,70,
+    69,82,44,32,48,181,0,113,114,101,116,117,114,110,32,188,0,1,225,1,
+    0,11,1,13,151,1,3,20,1,48,71,76,117,31,0,2,27,1,0,23,
+    1,178,101,110,117,109,32,109,111,100,101,44,32,181,1,193,115,116,100,58,
+    58,118,101,99,116,111,114,60,188,1,244,2,86,101,114,116,101,120,62,38,
+    32,118,101,114,116,105,99,101,115,198,1,68,105,102,32,40,20,0,145,46,
+    101,109,112,116,121,40,41,41,182,1,0,132,2,3,151,0,20,48,200,1,
+    15,203,0,9,2,143,0,3,208,0,240,0,47,47,32,82,101,115,112,101,
+    99,105,102,121,105,110,103,109,3,242,12,32,119,104,111,108,101,32,115,116,
+    111,114,101,32,101,118,101,114,121,32,102,114,97,109,101,32,108,101,142,3,
+    144,32,100,114,105,118,101,114,32,104,196,3,49,111,117,116,134,0,240,16,
+    47,47,32,102,114,101,115,104,32,109,101,109,111,114,121,32,105,110,115,116,
+    101,97,100,32,111,102,32,119,97,105,116,92,0,49,102,111,114,96,0,130,
+    112,114,101,118,105,111,117,115,87,0,48,39,115,32,198,2,1,69,0,34,
+    103,108,128,1,78,68,97,116,97,132,1,5,255,0,144,115,105,122,101,40,
+    41,32,42,32,9,0,55,111,102,40,58,1,37,41,44,58,1,32,46,100,
+    70,0,16,41,120,1,195,95,83,84,82,69,65,77,95,68,82,65,87,249,
+    0,34,103,108,107,1,112,80,111,105,110,116,101,114,111,3,159,71,76,95,
+    70,76,79,65,84,44,88,0,2,1,161,0,0,108,1,8,4,0,33,114,
+    101,62,0,162,112,114,101,116,95,99,97,115,116,60,215,1,218,118,111,105,
+    100,42,62,40,111,102,102,115,101,116,161,0,68,44,32,120,41,2,3,116,
+    103,108,67,111,108,111,114,131,0,17,52,171,0,223,85,78,83,73,71,78,
+    69,68,95,66,89,84,69,139,0,23,15,138,0,33,23,114,138,0,178,68,
+    114,97,119,65,114,114,97,121,115,40,161,2,146,48,44,32,115,116,97,116,
+    105,99,217,0,32,71,76,109,1,38,105,62,133,2,0,16,0,21,40,66,
+    0,3,130,2,16,49,21,3,0,246,9,35,105,110,99,108,117,100,101,32,
+    60,71,76,70,87,47,103,108,102,119,51,46,104,62,10,24,0,166,105,111,
+    115,116,114,101,97,109,62,10,21,0,247,8,34,103,108,95,98,97,116,99,
+    104,95,114,101,110,100,101,114,101,114,46,104,112,112,34,33,0,82,115,104,
+    97,112,101,36,0,2,27,0,240,17,10,118,111,105,100,32,102,114,97,109,
+    101,98,117,102,102,101,114,95,115,105,122,101,95,99,97,108,108,98,97,99,
+    107,40,127,0,130,119,105,110,100,111,119,42,32,8,0,178,44,32,105,110,
+    116,32,119,105,100,116,104,11,0,244,15,104,101,105,103,104,116,41,32,123,
+    10,32,32,32,32,103,108,86,105,101,119,112,111,114,116,40,48,44,32,48,
+    44,42,0,3,38,0,80,59,10,125,10,10,65,0,84,109,97,105,110,40,
+    53,0,80,105,102,32,40,33,229,0,100,73,110,105,116,40,41,23,0,0,
+    80,0,240,20,115,116,100,58,58,99,101,114,114,32,60,60,32,34,70,97,
+    105,108,101,100,32,116,111,32,105,110,105,116,105,97,108,105,122,101,32,164,
+    0,65,92,110,34,59,128,0,0,52,0,146,114,101,116,117,114,110,32,45,
+    49,19,0,33,125,10,26,0,241,46,47,47,32,82,101,113,117,101,115,116,
+    32,79,112,101,110,71,76,32,50,46,49,32,40,102,111,114,32,99,111,109,
+    112,97,116,105,98,105,108,105,116,121,32,119,105,116,104,32,105,109,109,101,
+    100,105,97,116,101,32,109,111,100,101,41,66,0,0,162,0,17,87,13,1,
+    65,72,105,110,116,28,1,242,11,95,67,79,78,84,69,88,84,95,86,69,
+    82,83,73,79,78,95,77,65,74,79,82,44,32,50,41,124,0,15,51,0,
+    18,32,73,78,51,0,50,49,41,59,169,0,0,208,0,2,108,1,4,116,
+    1,48,32,61,32,73,0,98,67,114,101,97,116,101,130,0,112,40,56,48,
+    48,44,32,54,5,0,245,6,34,111,112,101,110,103,108,95,97,112,112,34,
+    44,32,110,117,108,108,112,116,114,9,0,3,137,0,1,99,1,2,86,0,
+    15,95,1,17,17,99,107,0,1,91,1,3,248,1,9,98,1,0,142,0,
+    163,84,101,114,109,105,110,97,116,101,40,99,0,15,123,1,7,0,47,0,
+    243,4,77,97,107,101,67,111,110,116,101,120,116,67,117,114,114,101,110,116,
+    40,143,0,6,42,1,70,83,101,116,70,139,2,84,83,105,122,101,67,137,
+    2,2,44,0,31,44,171,2,7,4,62,1,100,47,47,32,83,101,116,32,
+    2,35,32,118,142,2,16,32,216,2,1,198,1,0,126,2,3,191,2,2,
+    149,2,6,128,0,29,71,128,0,3,164,0,51,44,32,38,51,0,18,38,
+    52,0,3,243,0,15,57,3,7,4,176,0,3,55,0,5,54,0,1,131,
+    0,0,164,0,0,138,3,242,16,115,32,97,114,101,32,99,111,108,108,101,
+    99,116,101,100,32,111,110,32,116,104,101,32,67,80,85,32,101,97,99,104,
+    237,0,240,3,32,97,110,100,32,100,114,97,119,110,32,105,110,32,111,110,
+    101,32,158,3,4,72,0,244,9,112,101,114,32,112,114,105,109,105,116,105,
+    118,101,32,116,121,112,101,46,32,84,104,101,32,2,4,242,8,32,105,115,
+    32,115,99,111,112,101,100,32,115,111,32,116,104,97,116,32,105,116,115,32,
+    237,3,1,128,0,4,74,0,64,100,101,108,101,133,0,81,119,104,105,108,
+    101,136,0,18,99,175,1,225,32,115,116,105,108,108,32,101,120,105,115,116,
+    115,46,47,0,16,83,190,0,16,66,107,4,17,32,113,4,2,67,1,2,
+    2,4,0,7,2,33,71,108,29,0,19,82,135,4,5,142,0,3,226,2,
+    0,35,0,115,47,47,32,77,97,105,110,27,0,81,32,108,111,111,112,91,
+    0,0,28,0,2,131,0,2,19,4,2,239,2,179,83,104,111,117,108,100,
+    67,108,111,115,101,147,1,9,38,4,0,53,0,244,12,103,108,67,108,101,
+    97,114,40,71,76,95,67,79,76,79,82,95,66,85,70,70,69,82,95,66,
+    73,84,28,2,0,39,0,0,4,0,1,180,0,33,46,99,47,0,3,202,
+    1,0,23,0,0,4,0,2,27,0,161,115,101,116,67,111,108,111,114,40,
+    49,196,4,31,48,37,0,2,244,1,97,100,100,83,113,117,97,114,101,40,
+    48,46,48,102,44,32,6,0,47,53,102,112,0,3,5,85,0,48,48,44,
+    32,88,0,15,85,0,5,227,67,105,114,99,108,101,40,45,48,46,53,102,
+    44,32,7,0,61,48,46,50,87,0,4,228,1,16,46,30,2,17,40,186,
+    0,12,122,0,0,122,3,81,83,119,97,112,66,221,5,20,115,60,1,2,
+    176,1,0,240,0,0,4,0,0,37,0,168,80,111,108,108,69,118,101,110,
+    116,115,207,3,17,125,147,1,3,65,5,0,39,0,114,68,101,115,116,114,
+    111,121,149,1,10,78,0,0,31,0,9,20,4,1,60,0,18,114,140,5,
+    16,48,249,5,0,245,13,35,105,110,99,108,117,100,101,32,34,115,104,97,
+    112,101,95,98,97,116,99,104,46,104,112,112,34,10,10,28,0,183,60,97,
+    108,103,111,114,105,116,104,109,62,21,0,248,68,99,109,97,116,104,62,10,
+    10,110,97,109,101,115,112,97,99,101,32,123,10,10,115,116,100,58,58,117,
+    105,110,116,56,95,116,32,116,111,66,121,116,101,40,102,108,111,97,116,32,
+    99,111,109,112,111,110,101,110,116,41,32,123,10,32,32,32,32,114,101,116,
+    117,114,110,32,115,116,97,116,105,99,95,99,97,115,116,60,62,0,33,62,
+    40,14,0,101,99,108,97,109,112,40,61,0,245,25,44,32,48,46,48,102,
+    44,32,49,46,48,102,41,32,42,32,50,53,53,46,48,102,32,43,32,48,
+    46,53,102,41,59,10,125,10,10,125,32,47,47,32,149,0,129,10,10,99,
+    111,110,115,116,32,77,0,250,14,118,101,99,116,111,114,60,67,105,114,99,
+    108,101,84,97,98,108,101,115,58,58,80,111,105,110,116,62,38,32,22,0,
+    244,1,103,101,116,40,105,110,116,32,115,101,103,109,101,110,116,115,182,0,
+    8,72,0,4,58,0,16,116,74,0,49,32,61,32,8,0,36,115,91,51,
+    0,33,93,59,232,0,65,105,102,32,40,26,0,132,46,101,109,112,116,121,
+    40,41,75,0,0,5,1,2,25,0,132,114,101,115,101,114,118,101,40,58,
+    0,18,41,58,0,0,33,0,65,102,111,114,32,137,0,165,105,32,61,32,
+    48,59,32,105,32,60,148,0,88,59,32,43,43,105,78,0,0,49,0,2,
+    239,0,240,1,100,111,117,98,108,101,32,97,110,103,108,101,32,61,32,105,
+    43,1,182,46,48,32,42,32,77,95,80,73,32,47,67,0,1,163,0,0,
+    56,0,0,4,0,2,142,0,184,112,117,115,104,95,98,97,99,107,40,123,
+    157,1,1,199,1,4,150,1,49,111,115,40,92,0,57,41,41,44,194,1,
+    8,37,0,52,115,105,110,37,0,23,125,210,0,17,125,115,0,2,6,0,
+    3,4,2,1,120,0,1,189,1,96,118,111,105,100,32,83,139,2,16,66,
+    138,2,132,58,58,99,108,101,97,114,40,229,0,49,116,114,105,119,0,147,
+    86,101,114,116,105,99,101,115,46,31,0,2,48,1,78,108,105,110,101,26,
+    0,61,125,10,10,86,0,131,115,101,116,67,111,108,111,114,156,2,49,114,
+    44,32,185,0,36,32,103,9,0,20,98,9,0,20,97,123,0,16,99,48,
+    0,48,91,48,93,232,1,2,216,2,19,114,213,0,2,26,0,23,49,26,
+    0,25,103,26,0,23,50,26,0,25,98,26,0,23,51,26,0,18,97,190,
+    2,13,171,0,98,118,101,114,116,101,120,13,3,3,192,2,1,27,1,0,
+    233,0,80,101,120,62,38,32,33,0,0,12,1,4,178,0,20,120,9,0,
+    20,121,187,0,4,34,0,23,46,218,1,98,120,44,32,121,44,32,187,0,
+    36,48,93,10,0,21,49,10,0,21,50,10,0,32,51,93,190,1,15,70,
+    1,1,67,97,100,100,84,145,1,3,73,1,6,124,0,4,133,0,68,115,
+    105,122,101,136,0,2,100,1,112,104,97,108,102,32,61,32,25,0,114,32,
+    47,32,50,46,48,102,190,1,0,166,0,60,101,120,40,227,1,32,44,32,
+    171,0,48,32,43,32,56,0,3,62,1,15,43,0,7,33,32,45,40,0,
+    51,44,32,121,10,0,15,50,0,15,2,90,0,9,50,0,15,237,0,4,
+    84,83,113,117,97,114,208,4,15,235,0,11,113,97,100,100,82,101,99,116,
+    173,2,16,40,193,0,17,44,241,0,2,6,0,15,234,1,4,9,52,0,
+    2,44,1,14,101,0,84,119,105,100,116,104,93,1,85,104,101,105,103,104,
+    81,5,2,51,0,81,104,119,32,61,32,38,0,9,94,1,3,29,0,66,
+    104,32,61,32,54,0,9,30,0,116,47,47,32,84,119,111,32,124,1,241,
+    25,115,59,32,71,76,95,81,85,65,68,83,32,119,111,117,108,100,32,110,
+    101,101,100,32,105,116,115,32,111,119,110,32,100,114,97,119,32,99,97,108,
+    108,202,3,15,141,1,11,19,119,89,1,31,104,137,1,18,15,46,0,32,
+    63,43,32,104,92,0,16,63,45,32,104,92,0,78,3,138,0,15,61,2,
+    4,2,95,6,15,40,3,6,143,114,97,100,105,117,115,44,32,116,6,1,
+    0,66,6,4,27,6,81,32,60,32,51,41,120,1,0,177,5,2,64,5,
+    2,64,3,0,196,1,161,104,101,32,102,97,110,32,111,102,32,207,7,16,
+    115,202,7,128,44,32,117,110,114,111,108,108,193,1,198,110,116,111,32,115,
+    101,112,97,114,97,116,101,238,1,129,32,115,111,32,116,104,97,116,87,0,
+    65,47,47,32,99,32,7,16,115,68,0,102,114,101,32,116,104,101,242,1,
+    241,6,32,119,105,116,104,32,101,118,101,114,121,116,104,105,110,103,32,101,
+    108,115,101,56,0,2,120,6,8,31,7,2,242,0,12,103,7,1,236,5,
+    36,32,61,101,0,16,46,105,7,4,221,0,3,36,2,240,7,47,47,32,
+    87,114,105,116,116,101,110,32,116,104,114,111,117,103,104,32,97,32,112,167,
+    7,240,0,101,114,32,97,102,116,101,114,32,111,110,101,32,114,101,68,4,
+    240,6,58,32,116,104,105,115,32,108,111,111,112,32,100,111,109,105,110,97,
+    116,101,115,181,0,1,150,0,0,206,0,48,111,115,116,18,1,192,97,32,
+    102,114,97,109,101,32,102,117,108,108,16,0,3,230,0,1,39,0,7,189,
+    0,192,115,105,122,101,95,116,32,102,105,114,115,116,236,5,3,225,4,0,
+    111,5,0,102,5,16,46,32,0,19,40,169,0,4,48,3,5,29,0,2,
+    147,0,18,40,61,0,85,43,32,51,32,42,106,7,3,51,0,7,188,5,
+    79,42,32,111,117,99,0,2,130,100,97,116,97,40,41,32,43,133,0,2,
+    222,1,2,162,0,7,62,0,64,32,99,101,110,10,1,50,61,32,123,96,
+    4,15,204,5,20,2,79,0,15,87,8,26,2,124,0,15,207,1,0,48,
+    38,32,97,35,1,0,255,8,35,91,105,239,8,0,151,2,15,49,0,8,
+    22,98,49,0,117,32,43,32,49,32,61,61,34,1,128,32,63,32,48,32,
+    58,32,105,24,0,7,77,0,96,42,111,117,116,43,43,50,2,1,241,0,
+    2,192,0,0,102,0,5,25,0,180,123,120,32,43,32,97,46,120,32,42,
+    32,71,3,17,121,18,0,23,121,18,0,15,31,1,26,14,95,0,29,98,
+    95,0,47,98,46,95,0,38,16,125,168,10,13,234,7,101,97,100,100,76,
+    105,110,96,6,20,49,230,5,21,121,10,0,37,120,50,20,0,20,50,85,
+    7,3,127,5,8,252,8,131,44,32,120,49,44,32,121,49,115,2,15,34,
+    0,3,81,50,44,32,121,50,138,6,0,241,19,47,47,32,82,101,110,100,
+    101,114,115,32,97,32,83,104,97,112,101,66,97,116,99,104,32,116,104,114,
+    111,117,103,104,32,71,108,16,0,2,36,0,240,80,101,114,32,105,110,116,
+    111,32,97,110,32,111,102,102,115,99,114,101,101,110,32,69,71,76,10,47,
+    47,32,112,98,117,102,102,101,114,32,97,110,100,32,114,101,97,100,115,32,
+    116,104,101,32,112,105,120,101,108,115,32,98,97,99,107,46,32,82,117,110,
+    115,32,119,105,116,104,111,117,116,32,97,32,100,105,115,112,108,97,121,32,
+    111,110,32,77,101,115,97,39,115,71,0,240,16,115,111,102,116,119,97,114,
+    101,32,114,97,115,116,101,114,105,122,101,114,32,40,108,108,118,109,112,105,
+    112,101,41,58,35,0,254,20,32,32,109,97,107,101,32,116,101,115,116,45,
+    103,108,10,35,105,110,99,108,117,100,101,32,60,69,71,76,47,101,103,108,
+    46,104,62,21,0,58,101,120,116,24,0,120,99,115,116,100,108,105,98,43,
+    0,166,105,111,115,116,114,101,97,109,62,10,64,0,80,34,103,108,95,98,
+    18,1,33,95,114,39,1,240,6,101,114,46,104,112,112,34,10,10,115,116,
+    97,116,105,99,32,99,111,110,115,116,22,1,181,32,83,73,90,69,32,61,
+    32,54,52,59,29,0,255,29,105,110,116,32,102,97,105,108,117,114,101,115,
+    32,61,32,48,59,10,10,35,100,101,102,105,110,101,32,67,72,69,67,75,
+    40,99,111,110,100,105,116,105,111,110,41,32,1,0,36,32,92,10,57,0,
+    64,100,111,32,123,8,0,15,4,0,49,2,82,0,0,74,0,87,105,102,
+    32,40,33,164,0,31,41,101,0,36,6,82,0,0,86,0,240,6,115,116,
+    100,58,58,99,101,114,114,32,60,60,32,95,95,70,73,76,69,95,95,12,
+    0,48,39,58,39,7,0,83,95,95,76,73,78,19,0,101,34,58,32,34,
+    32,35,38,1,154,32,34,92,110,34,59,32,32,32,82,0,36,43,43,101,
+    1,0,28,0,0,100,0,15,4,0,31,6,82,0,31,125,61,0,31,15,
+    50,0,2,2,82,0,192,125,32,119,104,105,108,101,32,40,48,41,10,189,
+    2,192,65,32,100,101,115,107,116,111,112,32,71,76,61,2,64,116,101,120,
+    116,2,3,209,97,32,115,117,114,102,97,99,101,108,101,115,115,16,3,4,
+    32,3,64,44,32,105,102,76,3,148,114,101,32,105,115,32,111,110,101,123,
+    2,196,98,111,111,108,32,99,114,101,97,116,101,79,142,3,48,67,111,110,
+    82,0,65,40,41,32,123,25,2,243,2,97,117,116,111,32,103,101,116,80,
+    108,97,116,102,111,114,109,68,116,3,241,37,61,32,114,101,105,110,116,101,
+    114,112,114,101,116,95,99,97,115,116,60,80,70,78,69,71,76,71,69,84,
+    80,76,65,84,70,79,82,77,68,73,83,80,76,65,89,69,88,84,80,82,
+    79,67,62,40,81,0,0,235,0,243,4,101,103,108,71,101,116,80,114,111,
+    99,65,100,100,114,101,115,115,40,34,19,0,10,102,0,113,69,88,84,34,
+    41,41,59,56,0,52,69,71,76,124,0,4,248,3,31,61,153,0,0,1,
+    44,0,0,100,0,31,63,29,0,0,84,40,69,71,76,95,158,0,240,3,
+    95,83,85,82,70,65,67,69,76,69,83,83,95,77,69,83,65,44,138,4,
+    147,95,68,69,70,65,85,76,84,95,189,0,165,44,32,110,117,108,108,112,
+    116,114,41,90,0,34,58,32,173,0,3,143,0,1,85,0,11,54,0,3,
+    180,0,69,105,102,32,40,173,0,17,61,95,0,36,78,79,90,0,244,3,
+    32,124,124,32,33,101,103,108,73,110,105,116,105,97,108,105,122,101,44,0,
+    5,116,0,5,9,0,20,41,45,0,113,66,105,110,100,65,80,73,116,0,
+    182,79,80,69,78,71,76,95,65,80,73,41,157,0,225,114,101,116,117,114,
+    110,32,102,97,108,115,101,59,10,180,0,2,98,4,48,69,71,76,78,4,
+    242,6,99,111,110,102,105,103,65,116,116,114,105,98,117,116,101,115,91,93,
+    32,61,32,235,1,0,54,1,0,33,1,3,24,1,82,95,84,89,80,69,
+    20,1,178,80,66,85,70,70,69,82,95,66,73,84,17,0,167,82,69,78,
+    68,69,82,65,66,76,69,38,0,3,144,0,0,37,0,1,120,0,4,80,
+    0,64,82,69,68,95,220,4,50,44,32,56,62,0,90,71,82,69,69,78,
+    19,0,74,66,76,85,69,18,0,81,78,79,78,69,44,72,0,21,125,1,
+    2,17,67,189,0,0,246,2,53,102,105,103,22,0,2,215,0,50,117,110,
+    116,34,5,0,119,0,0,121,1,0,92,1,98,67,104,111,111,115,101,55,
+    0,6,94,1,12,4,1,50,44,32,38,19,0,49,44,32,49,12,0,49,
+    117,110,116,114,1,33,99,111,86,0,63,61,32,48,97,1,23,3,134,3,
+    12,98,1,0,89,1,97,87,73,68,84,72,44,232,5,2,9,1,104,72,
+    69,73,71,72,84,18,0,0,246,0,6,240,0,18,83,210,3,4,218,3,
+    32,32,61,122,2,17,67,177,3,18,80,46,7,3,34,0,12,220,0,20,
+    44,51,0,6,135,0,3,147,2,51,69,71,76,227,3,0,71,1,0,235,
+    3,8,86,0,3,27,0,14,79,0,0,191,0,166,78,79,95,67,79,78,
+    84,69,88,84,152,2,2,133,1,3,117,2,3,251,0,37,32,33,235,2,
+    3,75,2,53,32,38,38,110,0,6,29,0,3,77,0,49,32,38,38,231,
+    1,0,184,1,32,32,32,226,0,182,77,97,107,101,67,117,114,114,101,110,
+    116,138,0,3,93,0,5,218,0,20,44,82,0,65,41,59,10,125,26,5,
+    113,67,111,108,111,114,32,111,236,4,2,56,8,160,32,97,116,32,40,120,
+    44,32,121,41,46,0,160,117,110,116,101,100,32,102,114,111,109,14,5,196,
+    32,98,111,116,116,111,109,32,108,101,102,116,17,5,130,117,110,115,105,103,
+    110,101,100,62,0,16,40,89,2,33,120,44,156,7,20,121,16,5,5,35,
+    0,194,99,104,97,114,32,114,103,98,97,91,52,93,6,1,113,103,108,82,
+    101,97,100,80,177,8,1,118,0,1,79,2,161,49,44,32,71,76,95,82,
+    71,66,65,9,0,225,85,78,83,73,71,78,69,68,95,66,89,84,69,44,
+    65,0,3,154,1,3,69,1,1,83,0,32,48,93,201,6,65,49,54,32,
+    124,34,0,33,91,49,16,0,20,56,15,0,33,50,93,244,0,0,160,0,
+    69,109,97,105,110,173,5,1,247,2,15,209,5,5,4,194,0,0,104,1,
+    9,67,7,55,34,78,111,142,9,71,79,112,101,110,90,6,34,40,105,77,
+    6,32,39,115,191,4,192,32,105,110,115,116,97,108,108,101,100,63,41,74,
+    7,5,185,1,3,189,0,194,69,88,73,84,95,70,65,73,76,85,82,69,
+    21,1,17,125,35,0,2,112,0,0,182,9,68,60,60,32,34,12,10,0,
+    156,7,49,60,60,32,13,6,112,83,116,114,105,110,103,40,43,1,1,92,
+    4,48,69,82,41,3,1,66,39,92,110,39,73,0,244,0,103,108,86,105,
+    101,119,112,111,114,116,40,48,44,32,48,53,3,0,89,4,3,65,1,113,
+    103,108,67,108,101,97,114,7,2,3,36,0,74,48,44,32,49,30,0,0,
+    98,0,102,67,79,76,79,82,95,212,4,19,41,41,5,7,190,10,1,178,
+    9,2,121,0,1,11,0,66,46,115,101,116,89,0,17,49,125,0,19,48,
+    86,0,2,29,0,244,1,97,100,100,83,113,117,97,114,101,40,48,46,48,
+    102,44,32,6,0,41,53,102,39,0,5,68,0,0,151,0,45,44,32,68,
+    0,227,67,105,114,99,108,101,40,45,48,46,53,102,44,32,7,0,63,48,
+    46,50,70,0,7,0,73,0,9,99,0,163,97,100,100,76,105,110,101,40,
+    45,49,137,0,80,55,54,53,54,50,79,0,11,17,0,115,41,59,32,47,
+    47,32,84,165,11,0,106,11,96,109,105,100,100,108,101,64,3,98,114,111,
+    119,32,53,54,61,6,6,27,6,12,201,11,4,207,10,2,38,1,0,86,
+    2,2,147,10,4,24,0,97,46,100,114,97,119,40,33,1,99,41,32,61,
+    61,32,50,169,0,0,42,0,151,103,108,70,105,110,105,115,104,40,20,0,
+    2,62,0,1,13,2,97,69,114,114,111,114,40,54,0,179,71,76,95,78,
+    79,95,69,82,82,79,82,44,0,18,125,153,0,2,47,0,1,31,12,113,
+    40,51,50,44,32,51,50,48,0,130,48,120,102,102,48,48,48,48,224,0,
+    2,150,1,1,131,2,8,48,0,99,49,54,44,32,49,54,48,0,32,48,
+    48,50,0,2,48,0,2,130,1,13,48,0,70,56,44,32,53,47,0,0,
+    49,0,48,41,59,32,64,1,0,108,1,13,46,0,85,54,48,44,32,56,
+    93,0,3,141,0,0,46,0,162,66,97,99,107,103,114,111,117,110,100,195,
+    0,0,175,3,4,121,10,79,32,62,32,48,162,3,6,5,37,0,0,62,
+    3,145,32,99,104,101,99,107,40,115,41,26,12,47,101,100,136,3,39,48,
+    65,108,108,69,10,1,163,1,1,14,13,103,115,32,112,97,115,115,83,0,
+    8,215,3,112,83,85,67,67,69,83,83,122,4,0,248,50,47,47,32,84,
+    101,115,116,115,32,102,111,114,32,83,104,97,112,101,66,97,116,99,104,59,
+    32,110,101,101,100,115,32,110,111,32,79,112,101,110,71,76,32,99,111,110,
+    116,101,120,116,10,35,105,110,99,108,117,100,101,32,60,99,109,97,116,104,
+    62,17,0,104,115,116,100,108,105,98,19,0,166,105,111,115,116,114,101,97,
+    109,62,10,40,0,32,34,115,103,0,32,95,98,104,0,255,43,46,104,112,
+    112,34,10,10,115,116,97,116,105,99,32,105,110,116,32,102,97,105,108,117,
+    114,101,115,32,61,32,48,59,10,10,35,100,101,102,105,110,101,32,67,72,
+    69,67,75,40,99,111,110,100,105,116,105,111,110,41,32,1,0,36,32,92,
+    10,57,0,64,100,111,32,123,8,0,15,4,0,49,2,82,0,0,74,0,
+    87,105,102,32,40,33,164,0,31,41,101,0,36,6,82,0,0,86,0,240,
+    6,115,116,100,58,58,99,101,114,114,32,60,60,32,95,95,70,73,76,69,
+    95,95,12,0,48,39,58,39,7,0,83,95,95,76,73,78,19,0,101,34,
+    58,32,34,32,35,38,1,154,32,34,92,110,34,59,32,32,32,82,0,36,
+    43,43,101,1,0,28,0,0,100,0,15,4,0,31,6,82,0,31,125,61,
+    0,31,15,50,0,2,2,82,0,181,125,32,119,104,105,108,101,32,40,48,
+    41,23,2,241,11,118,111,105,100,32,116,101,115,116,82,101,99,116,97,110,
+    103,108,101,73,115,84,119,111,84,114,105,13,0,81,115,40,41,32,123,215,
+    1,6,192,2,17,32,94,2,17,59,22,0,1,11,0,248,3,46,115,101,
+    116,67,111,108,111,114,40,49,44,32,48,44,32,48,41,29,0,53,97,100,
+    100,92,0,114,40,48,46,48,102,44,32,6,0,17,50,12,0,67,49,46,
+    48,102,48,0,2,136,2,2,83,0,22,116,129,0,207,46,115,105,122,101,
+    40,41,32,61,61,32,54,42,0,0,243,0,108,105,110,101,115,40,41,46,
+    101,109,112,116,121,40,41,34,0,0,115,3,0,47,2,49,115,116,32,117,
+    3,178,86,101,114,116,101,120,38,32,118,32,58,192,0,23,46,98,0,4,
+    228,0,0,60,1,2,133,0,1,25,2,129,102,97,98,115,40,118,46,120,
+    123,0,0,168,0,72,32,38,38,32,26,0,17,121,26,0,52,48,46,53,
+    194,0,6,65,0,48,118,46,114,177,0,48,50,53,53,53,0,48,118,46,
+    103,14,0,18,48,12,0,23,98,12,0,16,97,12,0,51,50,53,53,183,
+    0,62,125,10,125,155,1,240,7,67,105,114,99,108,101,85,115,101,115,84,
+    97,98,108,101,65,110,100,67,108,111,115,245,0,15,156,1,16,50,97,100,
+    100,64,0,16,40,194,0,34,44,32,118,1,0,180,0,52,44,32,49,80,
+    1,241,3,99,111,110,115,116,32,97,117,116,111,38,32,118,101,114,116,105,
+    99,37,4,13,139,1,2,216,1,2,35,1,4,40,0,7,159,1,99,49,
+    54,32,42,32,51,203,0,15,130,1,9,4,60,0,8,121,1,2,132,0,
+    242,1,102,108,111,97,116,32,100,105,115,116,97,110,99,101,32,61,112,1,
+    80,104,121,112,111,116,139,1,50,32,45,32,199,0,81,118,46,121,32,45,
+    205,0,3,111,0,6,123,1,6,61,0,17,61,106,2,50,32,124,124,70,
+    0,1,208,1,5,30,0,32,45,32,5,1,117,41,32,60,32,49,101,45,
+    194,1,17,125,215,2,0,186,5,132,104,101,32,108,97,115,116,32,40,2,
+    241,17,32,101,110,100,115,32,119,104,101,114,101,32,116,104,101,32,102,105,
+    114,115,116,32,111,110,101,32,115,116,97,114,116,115,57,0,11,27,1,128,
+    98,97,99,107,40,41,46,120,229,1,4,244,0,81,91,49,93,46,120,9,
+    2,3,105,1,19,46,38,0,28,121,38,0,63,121,41,59,15,2,2,0,
+    107,3,80,115,65,110,100,76,250,2,255,5,65,99,99,117,109,117,108,97,
+    116,101,85,110,116,105,108,67,108,101,97,114,181,3,27,51,48,44,32,184,
+    3,6,201,2,2,250,1,52,97,100,100,9,4,16,40,216,3,51,44,32,
+    49,110,1,5,32,0,0,132,0,4,28,0,12,31,0,5,23,4,15,60,
+    0,4,100,83,113,117,97,114,101,62,0,3,90,0,2,66,1,2,96,0,
+    4,123,1,0,223,3,6,5,4,31,57,42,0,0,4,5,4,6,38,0,
+    31,50,38,0,0,7,80,0,50,91,48,93,148,3,3,162,3,13,113,0,
+    0,33,0,1,157,3,63,49,50,56,75,0,12,49,56,93,46,211,3,15,
+    75,0,6,19,56,108,0,0,25,5,1,39,2,2,236,2,1,75,4,0,
+    178,0,222,95,116,32,99,97,112,97,99,105,116,121,32,61,159,4,20,46,
+    29,0,19,40,137,0,2,173,0,18,99,235,1,8,148,3,2,25,0,7,
+    231,0,4,22,5,0,112,2,2,29,0,4,42,1,10,47,5,15,118,1,
+    5,6,122,0,0,157,2,4,14,0,2,152,2,0,82,8,69,109,97,105,
+    110,110,2,15,71,6,10,2,167,0,0,35,0,2,143,4,15,207,4,1,
+    7,36,0,15,228,2,16,2,46,0,0,25,8,4,115,7,72,32,62,32,
+    48,83,4,1,97,1,4,223,7,5,37,0,209,60,60,32,34,32,99,104,
+    101,99,107,40,115,41,20,9,32,101,100,204,7,1,154,1,0,71,4,242,
+    4,114,101,116,117,114,110,32,69,88,73,84,95,70,65,73,76,85,82,69,
+    108,0,2,29,4,2,86,0,48,111,117,116,34,8,81,34,65,108,108,32,
+    117,9,2,184,1,1,76,7,103,115,32,112,97,115,115,86,0,8,82,0,
+    112,83,85,67,67,69,83,83,219,3,0,241,117,67,88,88,32,61,32,103,
+    43,43,10,79,80,84,73,77,73,90,65,84,73,79,78,95,76,69,86,69,
+    76,32,61,32,45,79,50,10,83,82,67,32,61,32,36,40,119,105,108,100,
+    99,97,114,100,32,115,114,99,47,42,46,99,112,112,41,10,10,35,32,65,
+    117,116,111,109,97,116,105,99,97,108,108,121,32,103,101,116,32,102,108,97,
+    103,115,32,97,110,100,32,108,105,98,114,97,114,105,101,115,32,117,115,105,
+    110,103,32,115,100,108,50,45,99,111,110,102,105,103,10,83,68,76,95,67,
+    70,76,65,71,83,94,0,88,115,104,101,108,108,33,0,65,32,45,45,99,
+    74,0,17,41,43,0,111,76,73,66,83,32,32,43,0,6,208,108,105,98,
+    115,41,10,73,78,67,76,85,68,69,82,0,144,45,73,105,110,99,108,117,
+    100,101,164,0,162,61,61,61,32,68,101,98,117,103,32,125,0,244,1,117,
+    114,97,116,105,111,110,32,61,61,61,10,68,66,71,95,135,0,132,45,87,
+    97,108,108,32,36,40,72,0,70,41,32,36,40,168,0,65,41,32,45,103,
+    47,0,49,79,66,74,137,0,129,112,97,116,115,117,98,115,116,18,1,16,
+    37,18,1,144,44,32,98,117,105,108,100,47,100,109,0,144,47,111,98,106,
+    47,37,46,111,44,70,0,65,82,67,41,41,61,0,89,66,73,78,32,61,
+    39,0,240,6,98,105,110,47,123,123,112,114,111,106,101,99,116,95,110,97,
+    109,101,125,125,10,240,0,112,95,68,69,66,85,71,32,125,1,0,134,0,
+    0,19,0,1,115,1,0,207,0,127,82,101,108,101,97,115,101,209,0,0,
+    63,82,69,76,209,0,22,46,36,40,247,1,32,41,10,66,0,15,228,0,
+    15,18,114,130,0,14,230,0,0,63,0,8,230,0,4,41,0,15,232,0,
+    2,52,10,35,32,203,0,113,112,114,111,102,105,108,101,58,2,240,40,112,
+    114,101,99,111,109,112,105,108,101,100,32,104,101,97,100,101,114,32,114,117,
+    108,101,115,32,40,99,112,112,115,116,97,114,116,101,114,46,109,107,41,10,
+    80,82,79,70,73,76,69,95,84,65,82,71,69,84,250,1,35,36,40,129,
+    0,0,190,1,0,11,0,83,79,66,74,41,10,14,2,25,32,63,0,2,
+    102,1,126,82,69,76,69,65,83,69,104,1,128,69,109,105,116,32,46,100,
+    32,150,0,240,2,115,32,110,101,120,116,32,116,111,32,101,97,99,104,32,
+    111,98,173,1,52,32,115,111,158,0,176,101,100,105,116,115,32,116,114,105,
+    103,103,172,0,4,190,0,85,115,10,68,69,80,95,2,240,20,77,77,68,
+    32,45,77,80,10,10,46,68,69,70,65,85,76,84,95,71,79,65,76,32,
+    58,61,32,97,108,108,10,36,40,101,118,97,127,2,0,75,3,247,0,32,
+    80,67,72,95,82,85,76,69,83,44,68,66,71,44,87,2,165,44,36,40,
+    83,82,67,41,44,36,40,187,2,63,41,41,41,62,0,6,51,82,69,76,
+    62,0,3,136,1,6,64,0,0,29,1,1,156,0,0,64,0,98,10,97,
+    108,108,58,32,85,0,102,66,73,78,41,10,10,12,0,4,24,0,1,74,
+    1,192,9,109,107,100,105,114,32,45,112,32,36,40,9,0,160,36,64,41,
+    10,9,36,40,67,88,88,113,1,6,148,0,192,32,45,111,32,36,64,32,
+    36,94,32,36,40,187,2,2,206,2,55,41,10,10,204,0,4,61,2,22,
+    58,67,3,3,131,0,0,255,0,95,71,67,72,41,10,111,0,22,2,175,
+    0,0,56,0,2,212,0,0,73,0,3,124,1,114,41,32,45,99,32,36,
+    60,146,0,35,10,10,9,1,0,214,0,0,3,1,4,238,0,4,12,0,
+    4,24,0,15,238,0,16,0,51,0,3,110,0,12,238,0,3,86,2,5,
+    240,0,3,117,0,15,242,0,3,0,72,0,0,186,0,15,242,0,16,0,
+    43,0,3,115,0,2,234,2,0,56,0,5,17,0,4,110,2,11,242,0,
+    20,45,255,2,2,37,1,144,79,66,74,58,46,111,61,46,100,178,1,0,
+    81,0,6,17,0,0,47,5,240,11,84,104,101,32,102,114,97,109,101,32,
+    115,99,104,101,100,117,108,101,114,32,116,97,107,101,115,32,228,2,208,99,
+    108,111,99,107,32,97,115,32,97,32,112,97,38,0,64,116,101,114,44,10,
+    3,0,29,0,64,116,101,115,116,43,3,160,101,100,32,110,111,32,83,68,
+    76,10,18,0,23,58,198,1,8,254,1,63,98,105,110,59,2,4,16,73,
+    55,0,16,115,177,1,11,48,0,16,47,25,0,17,95,158,0,23,95,158,
+    0,0,119,0,15,27,0,2,0,150,5,1,93,2,11,51,0,0,24,0,
+    79,10,9,46,47,95,0,17,0,20,1,162,82,117,110,32,70,82,65,77,
+    69,83,27,1,241,4,115,32,119,105,116,104,111,117,116,32,97,32,100,105,
+    115,112,108,97,121,185,4,116,119,114,105,116,101,32,116,66,1,243,1,45,
+    116,105,109,101,32,104,105,115,116,111,103,114,97,109,10,67,0,112,63,61,
+    32,51,48,48,10,218,4,64,108,101,115,115,114,2,0,57,3,1,138,2,
+    16,9,236,5,242,5,86,73,68,69,79,68,82,73,86,69,82,61,100,117,
+    109,109,121,32,46,47,188,1,0,36,0,49,32,45,45,207,0,66,115,32,
+    36,40,82,0,16,41,47,7,35,115,118,88,6,1,29,0,16,95,123,0,
+    250,0,115,46,99,115,118,10,10,118,97,108,103,114,105,110,100,105,0,4,
+    22,0,249,23,32,45,45,108,101,97,107,45,99,104,101,99,107,61,102,117,
+    108,108,32,45,45,116,114,97,99,107,45,111,114,105,103,105,110,115,61,121,
+    101,115,130,0,90,10,10,114,117,110,78,0,8,161,0,1,31,0,19,45,
+    243,2,0,39,0,0,101,2,0,186,0,0,115,1,2,183,2,1,14,0,
+    242,0,10,99,108,101,97,110,58,10,9,114,109,32,45,114,102,191,0,240,
+    7,10,10,104,101,108,112,58,32,35,35,32,83,104,111,119,115,32,116,104,
+    105,115,32,20,0,245,13,10,9,64,101,99,104,111,32,34,65,118,97,105,
+    108,97,98,108,101,32,116,97,114,103,101,116,115,58,34,28,0,32,32,32,
+    197,7,19,32,1,0,48,45,32,66,146,7,17,32,146,7,80,32,118,101,
+    114,115,249,7,152,40,100,101,102,97,117,108,116,41,55,0,3,175,0,1,
+    57,0,4,55,0,144,111,112,116,105,109,105,122,101,100,204,2,129,50,32,
+    97,112,112,108,105,99,61,8,8,58,0,65,116,101,115,116,55,0,98,32,
+    32,32,45,32,67,185,6,1,15,2,54,114,117,110,13,2,8,79,3,0,
+    177,2,8,67,0,4,11,2,0,71,0,46,45,32,110,2,4,178,0,0,
+    56,2,17,41,124,2,0,146,0,30,95,40,2,56,97,110,100,88,0,0,
+    80,0,6,4,0,15,158,2,11,0,222,6,2,16,3,11,65,2,8,81,
+    0,0,210,0,4,81,0,2,169,0,57,83,68,76,26,1,51,32,105,110,
+    111,1,75,109,111,100,101,60,0,4,21,2,31,32,60,0,7,4,136,1,
+    12,62,0,5,175,2,1,102,1,0,35,1,2,213,1,7,149,1,2,25,
+    1,4,41,0,8,123,0,1,105,2,3,184,0,129,45,32,82,101,109,111,
+    118,101,41,2,5,103,8,2,230,7,176,97,110,100,32,100,105,114,101,99,
+    116,111,185,10,8,67,0,0,130,2,3,66,0,33,32,45,155,2,6,154,
+    2,6,40,0,6,10,0,32,79,112,101,10,10,155,2,83,80,67,72,61,
+    49,69,0,68,45,32,80,114,40,8,1,37,2,243,1,109,111,115,116,32,
+    102,114,101,113,117,101,110,116,108,121,32,181,5,131,100,32,115,121,115,116,
+    101,109,107,8,22,115,98,0,35,32,32,255,8,16,61,54,10,0,83,1,
+    2,148,9,19,32,213,0,17,114,132,2,1,70,11,99,32,102,114,111,109,
+    32,99,9,32,115,47,48,0,56,46,109,107,79,9,241,9,32,116,117,110,
+    101,41,34,10,10,70,79,82,67,69,58,10,10,46,80,72,79,78,89,58,
+    38,1,4,148,1,1,234,2,5,172,2,0,12,2,53,114,117,110,212,1,
+    4,121,1,18,32,110,1,1,49,1,1,78,0,0,248,15,35,112,114,97,
+    103,109,97,32,111,110,99,101,10,10,35,105,110,99,108,117,100,101,32,60,
+    83,68,76,46,104,62,18,0,240,33,115,116,114,105,110,103,62,10,10,115,
+    116,114,117,99,116,32,65,112,112,79,112,116,105,111,110,115,32,123,10,32,
+    32,32,32,105,110,116,32,102,114,97,109,101,115,32,61,32,48,59,19,0,
+    1,4,0,243,8,47,47,32,81,117,105,116,32,97,102,116,101,114,32,116,
+    104,105,115,32,109,97,110,121,44,0,241,6,59,32,48,32,114,117,110,115,
+    32,117,110,116,105,108,32,99,108,111,115,101,100,80,0,144,100,111,117,98,
+    108,101,32,102,112,80,0,52,54,48,46,83,0,64,47,47,32,70,103,0,
+    247,6,32,112,97,99,105,110,103,32,119,105,116,104,111,117,116,32,118,115,
+    121,110,99,79,0,67,99,97,112,112,75,0,66,98,111,111,108,32,0,115,
+    32,61,32,116,114,117,101,158,0,240,9,47,47,32,76,101,116,32,83,68,
+    76,95,82,101,110,100,101,114,80,114,101,115,101,110,116,91,0,19,101,161,
+    0,193,32,119,104,101,110,32,105,116,32,99,97,110,152,0,82,115,116,100,
+    58,58,14,1,129,32,99,115,118,80,97,116,104,79,0,4,152,0,240,31,
+    45,116,105,109,101,32,104,105,115,116,111,103,114,97,109,32,119,114,105,116,
+    116,101,110,32,104,101,114,101,32,111,110,32,101,120,105,116,10,125,59,10,
+    10,99,108,97,115,115,72,1,161,32,123,10,112,117,98,108,105,99,58,97,
+    0,113,101,120,112,108,105,99,105,99,1,23,40,103,1,19,111,111,1,97,
+    61,32,123,125,41,59,43,0,129,126,65,112,112,40,41,59,10,13,0,1,
+    230,0,64,105,110,105,116,18,0,0,123,1,64,118,111,105,100,93,1,0,
+    16,0,130,10,112,114,105,118,97,116,101,99,0,1,26,0,192,104,97,110,
+    100,108,101,69,118,101,110,116,115,35,0,5,51,0,115,117,112,100,97,116,
+    101,40,129,1,35,100,116,109,0,1,53,0,17,114,40,1,4,28,0,84,
+    97,108,112,104,97,128,0,14,171,0,2,165,0,0,95,1,145,87,105,110,
+    100,111,119,42,32,119,8,0,6,24,0,2,119,1,66,101,114,42,32,89,
+    0,34,101,114,28,0,1,204,0,119,114,117,110,110,105,110,103,18,0,2,
+    228,1,2,239,0,144,47,47,32,83,105,109,117,108,97,133,2,48,32,115,
+    116,221,0,240,7,32,116,104,101,32,112,114,101,118,105,111,117,115,32,97,
+    110,100,32,99,117,114,114,210,1,2,212,0,147,44,32,115,111,32,116,104,
+    97,116,111,0,33,40,41,58,1,32,47,47,222,1,0,194,2,240,1,101,
+    114,112,111,108,97,116,101,32,98,101,116,119,101,101,110,81,0,17,109,36,
+    0,3,14,1,4,93,0,18,88,150,0,3,22,0,3,102,0,10,21,0,
+    144,118,101,108,111,99,105,116,121,59,238,1,0,247,17,35,112,114,97,103,
+    109,97,32,111,110,99,101,10,10,35,105,110,99,108,117,100,101,32,60,99,
+    115,116,100,105,110,116,62,19,0,168,102,117,110,99,116,105,111,110,97,108,
+    22,0,104,115,116,114,105,110,103,18,0,240,71,118,101,99,116,111,114,62,
+    10,10,47,47,32,84,105,109,101,32,115,111,117,114,99,101,32,102,111,114,
+    32,70,114,97,109,101,83,99,104,101,100,117,108,101,114,46,32,65,112,112,
+    32,119,105,114,101,115,32,105,116,32,116,111,32,83,68,76,95,71,101,116,
+    80,101,114,102,111,114,109,97,110,99,101,67,111,117,110,116,101,114,44,78,
+    0,14,30,0,209,70,114,101,113,117,101,110,99,121,32,97,110,100,62,0,
+    240,18,68,101,108,97,121,59,32,116,101,115,116,115,32,117,115,101,32,97,
+    32,102,97,107,101,32,99,108,111,99,107,44,32,115,111,73,0,240,8,110,
+    111,116,104,105,110,103,32,104,101,114,101,32,100,101,112,101,110,100,115,32,
+    111,110,65,0,130,46,10,115,116,114,117,99,116,171,0,16,67,54,0,196,
+    32,123,10,32,32,32,32,115,116,100,58,58,5,1,17,60,14,0,240,1,
+    117,105,110,116,54,52,95,116,40,41,62,32,110,111,119,59,39,0,1,4,
+    0,51,47,47,32,185,0,102,32,116,105,99,107,115,65,0,4,51,0,36,
+    32,102,187,0,6,54,0,1,59,0,2,5,0,1,60,1,230,99,107,115,
+    32,112,101,114,32,115,101,99,111,110,100,68,0,5,133,0,96,118,111,105,
+    100,40,115,152,0,0,87,0,241,12,51,50,95,116,41,62,32,115,108,101,
+    101,112,77,115,59,32,47,47,32,77,97,121,32,111,118,101,114,20,0,48,
+    32,98,121,14,1,129,101,119,32,109,115,10,125,59,161,1,1,145,1,240,
+    16,32,116,105,109,101,115,32,111,102,32,116,104,101,32,108,97,115,116,32,
+    96,99,97,112,97,99,105,116,121,96,32,102,180,1,129,115,10,99,108,97,
+    115,115,32,48,0,241,0,83,116,97,116,115,32,123,10,112,117,98,108,105,
+    99,58,153,0,34,47,47,28,0,240,22,115,32,108,111,110,103,101,114,32,
+    116,104,97,110,32,49,46,53,32,120,32,96,110,111,109,105,110,97,108,80,
+    101,114,105,111,100,96,32,99,212,1,162,32,97,115,32,100,114,111,112,112,
+    101,218,0,6,90,0,2,210,0,116,115,105,122,101,95,116,32,136,0,153,
+    44,32,100,111,117,98,108,101,32,76,0,49,41,59,10,126,0,0,9,1,
+    131,32,114,101,99,111,114,100,40,40,0,2,53,1,20,115,34,0,1,38,
+    1,3,84,0,2,210,0,242,2,40,41,32,99,111,110,115,116,32,123,32,
+    114,101,116,117,114,110,152,0,80,59,32,125,32,32,60,1,33,73,110,15,
+    1,97,119,105,110,100,111,119,102,0,8,68,0,3,187,0,4,69,0,17,
+    59,33,0,3,123,0,164,112,101,114,99,101,110,116,105,108,101,141,0,19,
+    112,108,0,11,236,1,243,0,47,47,32,112,32,105,110,32,91,48,44,32,
+    49,93,59,233,1,2,46,2,3,76,0,52,109,97,120,100,0,6,169,0,
+    7,97,0,114,49,46,48,41,59,32,125,7,1,196,47,47,32,72,105,115,
+    116,111,103,114,97,109,207,1,2,192,0,0,102,0,192,49,32,109,115,32,
+    98,117,99,107,101,116,115,126,1,17,34,8,1,65,95,109,115,44,9,0,
+    130,115,34,32,108,105,110,101,115,203,0,33,47,47,254,0,1,13,2,2,
+    52,0,242,2,32,97,108,115,111,32,104,111,108,100,115,32,101,118,101,114,
+    121,68,3,64,115,108,111,119,203,3,17,82,68,1,193,115,32,102,97,108,
+    115,101,32,119,104,101,110,19,1,3,72,0,241,8,102,105,108,101,32,99,
+    97,110,110,111,116,32,98,101,32,119,114,105,116,116,101,110,46,35,0,65,
+    98,111,111,108,18,0,82,101,67,115,118,40,148,1,2,107,1,1,92,4,
+    181,38,32,112,97,116,104,44,32,105,110,116,190,0,68,61,32,53,48,83,
+    1,146,10,10,112,114,105,118,97,116,101,137,2,1,58,0,2,132,4,18,
+    60,68,1,145,62,32,115,97,109,112,108,101,115,126,1,64,47,47,32,82,
+    252,3,97,98,117,102,102,101,114,129,0,1,51,0,3,28,2,130,110,101,
+    120,116,32,61,32,48,6,1,8,26,0,2,182,2,5,27,0,2,92,0,
+    10,143,2,21,59,87,3,81,105,120,101,100,45,87,3,128,116,101,112,32,
+    108,111,111,112,101,3,146,105,110,103,46,32,69,97,99,104,85,3,113,44,
+    32,98,101,103,105,110,250,2,240,1,40,41,32,115,97,121,115,32,104,111,
+    119,32,109,97,110,121,167,4,240,1,117,112,100,97,116,101,40,100,116,41,
+    32,115,116,101,112,115,34,5,48,114,117,110,7,0,81,99,97,116,99,104,
+    162,1,96,115,105,109,117,108,97,153,5,32,32,117,77,5,112,116,104,32,
+    114,101,97,108,111,0,16,101,22,5,0,73,0,0,85,0,162,102,97,114,
+    32,98,101,116,119,101,101,216,2,1,218,1,145,116,119,111,32,115,116,97,
+    116,101,92,0,16,105,106,5,82,112,111,108,97,116,193,1,96,32,114,101,
+    110,100,101,224,5,16,46,70,0,52,101,110,100,171,0,161,116,104,101,110,
+    32,119,97,105,116,115,215,5,0,55,4,1,57,1,1,73,2,80,32,100,
+    101,97,100,75,2,162,58,32,97,32,99,111,97,114,115,101,149,4,32,32,
+    117,21,3,0,75,0,113,97,98,111,117,116,32,50,145,2,144,101,102,111,
+    114,101,32,105,116,44,207,0,112,110,32,115,112,105,110,110,161,1,18,111,
+    168,0,1,119,1,32,101,114,187,5,2,54,1,48,115,32,108,237,5,32,
+    111,110,73,0,0,99,1,128,32,105,110,115,116,101,97,100,242,2,80,100,
+    114,105,102,116,62,0,32,98,121,79,0,3,120,0,240,2,103,114,97,110,
+    117,108,97,114,105,116,121,46,32,87,105,116,104,8,5,0,215,4,0,95,
+    5,32,105,111,58,0,0,77,0,16,48,134,6,80,100,111,101,115,32,167,
+    2,0,223,0,240,14,32,40,118,115,121,110,99,39,100,32,112,114,101,115,
+    101,110,116,44,32,111,114,32,97,110,32,117,110,99,97,187,4,201,32,98,
+    101,110,99,104,109,97,114,107,41,46,35,5,4,228,6,11,39,5,23,115,
+    93,6,3,88,6,0,241,5,0,220,2,2,238,1,5,165,2,96,78,117,
+    109,98,101,114,212,0,16,102,77,2,10,2,2,19,110,146,4,0,60,0,
+    3,137,2,80,97,108,112,104,97,226,2,2,138,5,1,171,7,0,62,0,
+    17,97,58,0,97,32,115,105,110,99,101,19,1,1,249,1,48,111,110,101,
+    82,3,2,122,4,17,41,6,3,0,18,6,0,80,0,1,228,1,5,164,
+    7,17,40,15,0,2,8,7,3,68,7,3,113,0,2,176,0,69,82,97,
+    116,101,156,5,1,255,1,2,18,0,8,58,3,0,98,2,33,115,87,72,
+    5,100,32,61,32,54,48,48,149,5,1,92,0,9,5,3,2,119,3,1,
+    207,5,6,111,2,3,229,5,9,120,0,94,68,101,108,116,97,26,5,2,
+    149,0,64,83,116,101,112,21,5,0,207,0,2,80,4,1,106,0,1,184,
+    6,17,38,241,2,30,115,59,0,1,189,0,1,35,0,0,59,0,10,85,
+    4,3,123,0,3,84,6,2,161,6,0,115,7,66,54,52,95,116,226,7,
+    6,142,4,0,117,0,1,111,0,7,53,1,2,215,0,3,70,0,7,164,
+    0,1,121,1,1,43,1,5,78,0,1,135,0,2,42,7,17,59,136,6,
+    16,84,65,8,128,59,32,48,32,109,101,97,110,155,2,16,32,154,7,47,
+    110,103,60,0,0,0,219,1,1,123,0,11,194,4,5,93,0,4,154,3,
+    6,32,0,3,148,0,65,97,99,99,117,72,4,32,111,114,28,0,19,46,
+    0,5,1,155,5,146,115,116,97,114,116,101,100,32,61,220,5,2,204,0,
+    1,103,0,1,46,1,2,150,3,1,11,0,1,0,5,0,245,2,35,105,
+    110,99,108,117,100,101,32,34,97,112,112,46,104,34,10,17,0,151,60,99,
+    115,116,114,105,110,103,62,19,0,122,105,111,109,97,110,105,112,19,0,104,
+    115,116,114,101,97,109,20,0,150,117,116,105,108,105,116,121,62,10,59,0,
+    240,1,34,102,114,97,109,101,95,115,99,104,101,100,117,108,101,114,107,0,
+    240,30,10,110,97,109,101,115,112,97,99,101,32,123,10,10,47,47,32,70,
+    105,120,101,100,32,115,105,109,117,108,97,116,105,111,110,32,114,97,116,101,
+    59,32,114,101,110,100,101,139,0,241,2,32,114,117,110,115,32,97,116,32,
+    119,104,97,116,101,118,101,114,33,0,240,40,32,116,104,101,32,100,105,115,
+    112,108,97,121,32,97,108,108,111,119,115,10,99,111,110,115,116,32,100,111,
+    117,98,108,101,32,85,80,68,65,84,69,95,82,65,84,69,32,61,32,54,
+    48,46,48,59,10,10,70,144,0,145,67,108,111,99,107,32,115,100,108,9,
+    0,243,0,40,41,32,123,10,32,32,32,32,114,101,116,117,114,110,13,0,
+    0,17,0,68,91,93,32,123,22,0,241,44,115,116,97,116,105,99,95,99,
+    97,115,116,60,115,116,100,58,58,117,105,110,116,54,52,95,116,62,40,83,
+    68,76,95,71,101,116,80,101,114,102,111,114,109,97,110,99,101,67,111,117,
+    110,116,101,114,40,41,41,59,32,125,44,93,0,0,80,0,15,68,0,26,
+    198,70,114,101,113,117,101,110,99,121,40,41,41,67,0,53,91,93,40,126,
+    0,176,51,50,95,116,32,109,115,41,32,123,32,131,0,134,68,101,108,97,
+    121,40,109,115,116,0,181,125,59,10,125,10,10,125,32,47,47,32,116,1,
+    240,1,10,10,65,112,112,58,58,65,112,112,40,65,112,112,79,112,113,1,
+    50,115,32,111,8,0,17,41,171,0,20,58,15,0,2,107,0,84,109,111,
+    118,101,40,33,0,243,4,41,44,32,119,105,110,100,111,119,40,110,117,108,
+    108,112,116,114,41,44,169,1,40,101,114,19,0,244,5,117,110,110,105,110,
+    103,40,102,97,108,115,101,41,44,32,118,115,121,110,99,14,0,1,101,0,
+    246,12,32,32,112,114,101,118,105,111,117,115,88,40,51,53,48,46,48,41,
+    44,32,99,117,114,114,101,110,116,17,0,176,118,101,108,111,99,105,116,121,
+    40,50,48,34,0,51,32,123,125,191,0,16,126,192,0,4,184,1,2,253,
+    0,97,115,116,114,111,121,82,52,2,50,101,114,40,61,2,65,101,114,41,
+    59,110,0,7,35,0,18,87,191,0,2,198,0,7,31,0,97,81,117,105,
+    116,40,41,50,1,81,98,111,111,108,32,39,1,32,105,110,21,0,3,19,
+    2,49,105,102,32,236,1,16,73,21,0,0,82,0,244,0,73,78,73,84,
+    95,86,73,68,69,79,41,32,60,32,48,144,0,2,235,1,240,11,100,58,
+    58,99,101,114,114,32,60,60,32,34,83,68,76,32,99,111,117,108,100,32,
+    110,111,116,32,85,0,144,105,97,108,105,122,101,58,32,34,32,0,0,76,
+    0,160,71,101,116,69,114,114,111,114,40,41,18,0,1,228,1,66,101,110,
+    100,108,191,0,0,82,0,3,158,2,1,82,1,2,22,0,33,125,10,220,
+    0,2,202,0,33,32,61,5,2,99,67,114,101,97,116,101,228,0,1,31,
+    0,0,60,0,0,129,0,16,50,210,0,22,34,74,2,0,117,0,241,4,
+    87,73,78,68,79,87,80,79,83,95,67,69,78,84,69,82,69,68,44,70,
+    0,15,24,0,0,5,76,0,143,56,48,48,44,32,54,48,48,74,0,1,
+    97,95,83,72,79,87,78,43,0,34,41,59,158,0,0,53,1,18,33,163,
+    0,15,32,1,7,2,176,0,7,35,1,65,98,101,32,99,202,0,31,100,
+    35,1,50,2,24,4,98,85,105,110,116,51,50,140,2,100,70,108,97,103,
+    32,61,233,2,17,46,160,2,33,32,63,253,0,242,10,82,69,78,68,69,
+    82,69,82,95,80,82,69,83,69,78,84,86,83,89,78,67,32,58,32,48,
+    118,1,4,90,2,9,113,1,5,120,2,2,234,0,66,44,32,45,49,74,
+    1,5,77,0,96,65,67,67,69,76,69,141,4,54,68,32,124,132,0,3,
+    129,2,1,38,1,4,90,0,8,40,1,149,47,47,32,78,111,32,71,80,
+    85,102,3,128,44,32,101,46,103,46,32,117,29,5,1,176,0,1,129,2,
+    241,3,68,82,73,86,69,82,61,100,117,109,109,121,32,105,110,32,67,73,
+    134,1,0,253,1,4,87,0,15,177,0,28,143,83,79,70,84,87,65,82,
+    69,174,0,0,17,125,92,0,15,180,0,6,1,189,2,5,252,2,4,27,
+    1,15,222,1,71,130,47,47,32,84,114,117,115,116,86,1,161,32,111,110,
+    108,121,32,119,104,101,110,34,6,5,254,0,224,114,101,112,111,114,116,115,
+    32,105,116,32,97,110,100,28,0,193,114,101,32,105,115,32,97,32,114,101,
+    97,108,210,0,37,47,47,81,6,48,116,111,32,179,4,240,1,32,119,105,
+    116,104,59,32,111,116,104,101,114,119,105,115,101,55,0,21,32,206,6,16,
+    32,197,6,33,115,32,228,6,0,89,0,65,115,101,108,102,73,0,0,92,
+    3,4,248,0,146,73,110,102,111,32,105,110,102,111,63,2,2,139,2,144,
+    99,104,97,114,42,32,100,114,105,206,6,2,186,3,66,71,101,116,67,0,
+    5,97,86,105,100,101,111,68,28,0,0,145,4,0,196,1,2,160,2,5,
+    41,0,8,92,0,5,235,4,48,44,32,38,103,0,176,41,32,61,61,32,
+    48,32,38,38,32,40,15,0,129,46,102,108,97,103,115,32,38,43,2,5,
+    142,2,8,219,2,65,41,32,38,38,182,0,0,105,0,0,4,0,35,33,
+    40,153,0,49,38,38,32,204,1,99,115,116,114,99,109,112,22,0,49,44,
+    32,34,102,2,18,34,105,0,4,232,3,18,114,242,5,114,32,61,32,116,
+    114,117,101,236,0,3,179,4,2,17,0,112,125,10,10,118,111,105,100,134,
+    4,85,58,58,114,117,110,119,7,1,147,7,20,83,34,8,6,94,1,22,
+    40,161,7,24,44,205,7,3,78,6,117,32,63,32,48,46,48,32,173,6,
+    68,46,102,112,115,141,0,48,102,111,114,254,0,18,116,155,1,80,32,61,
+    32,48,59,69,8,0,147,6,1,25,1,3,206,6,19,46,186,1,1,49,
+    1,35,124,124,46,0,21,60,22,4,2,31,0,81,41,59,32,43,43,11,
+    0,8,153,3,2,200,1,10,188,0,33,58,58,16,0,96,32,116,105,109,
+    105,110,95,4,5,42,2,97,46,98,101,103,105,110,30,0,4,211,1,0,
+    106,1,200,104,97,110,100,108,101,69,118,101,110,116,115,24,0,5,192,0,
+    18,105,188,0,51,105,32,60,85,0,128,46,117,112,100,97,116,101,115,148,
+    0,24,105,144,0,0,79,0,2,28,0,22,40,118,0,2,17,0,80,68,
+    101,108,116,97,140,8,5,230,1,2,193,3,0,51,0,2,31,3,18,40,
+    178,0,99,46,97,108,112,104,97,147,4,0,30,0,6,74,0,57,101,110,
+    100,190,0,3,124,6,8,6,1,64,116,97,116,115,49,2,86,97,116,115,
+    32,61,199,1,16,46,246,8,5,222,0,1,80,2,69,99,111,117,116,230,
+    6,17,102,254,9,35,60,60,107,2,210,101,116,112,114,101,99,105,115,105,
+    111,110,40,51,144,8,0,138,0,2,4,0,0,76,7,66,76,97,115,116,
+    55,7,1,89,0,3,196,1,2,55,7,18,34,195,1,53,115,58,34,235,
+    0,6,57,0,88,32,32,112,53,48,58,0,240,6,112,101,114,99,101,110,
+    116,105,108,101,40,48,46,53,48,41,32,42,32,49,48,105,8,0,156,0,
+    79,34,32,109,115,70,0,4,47,57,57,70,0,6,47,57,57,70,0,21,
+    56,109,97,120,70,0,79,109,97,120,40,59,0,21,120,100,114,111,112,112,
+    101,100,63,0,3,19,0,31,40,49,1,0,18,40,60,4,82,63,32,34,
+    32,32,12,0,127,41,34,32,58,32,34,34,105,8,1,1,212,5,4,30,
+    3,224,99,115,118,80,97,116,104,46,101,109,112,116,121,40,39,4,34,32,
+    33,116,1,132,119,114,105,116,101,67,115,118,23,10,19,46,43,0,24,41,
+    146,2,2,235,1,4,3,9,21,67,255,8,1,61,0,2,189,0,11,106,
+    0,0,120,1,1,54,0,6,250,8,16,125,194,10,6,56,4,10,49,3,
+    3,152,9,0,110,5,1,68,3,32,32,101,74,3,2,124,4,82,119,104,
+    105,108,101,176,9,65,80,111,108,108,32,0,33,40,38,33,0,9,166,0,
+    0,242,0,1,22,0,80,46,116,121,112,101,60,5,0,79,0,72,81,85,
+    73,84,204,0,0,70,2,6,226,4,7,132,9,0,25,0,2,78,3,11,
+    170,0,2,123,3,19,40,140,12,36,100,116,78,0,241,12,47,47,32,71,
+    97,109,101,32,108,111,103,105,99,32,103,111,101,115,32,104,101,114,101,59,
+    32,100,116,142,6,81,108,119,97,121,115,103,6,2,25,3,65,115,116,101,
+    112,205,2,5,47,11,37,32,61,41,11,2,235,0,4,55,11,68,32,43,
+    61,32,50,11,82,32,42,32,100,116,31,0,0,226,0,5,35,0,17,60,
+    53,5,37,124,124,67,0,64,32,62,32,55,244,2,4,160,0,0,209,0,
+    5,69,0,52,61,32,45,12,0,2,76,0,0,30,0,5,76,0,6,136,
+    0,0,254,10,101,46,48,32,63,32,45,29,0,64,58,32,49,52,88,0,
+    37,32,45,107,0,2,67,0,11,40,1,3,129,4,3,40,1,2,129,4,
+    7,216,1,50,83,101,116,237,6,134,68,114,97,119,67,111,108,111,219,11,
+    70,44,32,51,48,4,0,51,50,53,53,185,4,0,192,1,2,52,0,70,
+    67,108,101,97,48,0,4,29,6,0,32,0,15,87,0,10,64,50,53,53,
+    44,10,4,3,5,0,6,90,0,48,47,47,32,135,0,99,32,98,101,116,
+    119,101,96,8,16,108,143,4,66,116,119,111,32,241,1,112,115,32,115,111,
+    32,109,111,86,13,48,32,115,116,203,1,101,115,109,111,111,116,104,145,8,
+    1,204,1,34,47,47,169,4,2,201,14,3,143,8,3,66,0,2,20,0,
+    97,100,105,102,102,101,114,45,0,2,100,5,3,33,1,54,120,32,61,57,
+    13,69,32,43,32,40,113,1,22,45,24,0,0,73,4,1,74,1,2,114,
+    1,0,241,0,96,82,101,99,116,32,114,5,0,48,61,32,123,154,0,5,
+    205,14,195,105,110,116,62,40,120,41,44,32,50,53,48,242,0,88,49,48,
+    48,32,125,60,0,0,108,10,64,70,105,108,108,70,0,8,112,8,0,81,
+    0,8,87,1,2,119,1,117,80,114,101,115,101,110,116,41,0,1,85,13,
+    0,244,16,35,105,110,99,108,117,100,101,32,34,102,114,97,109,101,95,115,
+    99,104,101,100,117,108,101,114,46,104,34,10,10,35,30,0,183,60,97,108,
+    103,111,114,105,116,104,109,62,21,0,88,99,109,97,116,104,17,0,241,33,
+    102,115,116,114,101,97,109,62,10,10,110,97,109,101,115,112,97,99,101,32,
+    123,10,10,47,47,32,76,111,110,103,101,115,116,32,114,101,97,108,32,116,
+    105,109,101,32,111,110,101,32,116,0,240,29,32,109,97,121,32,102,101,101,
+    100,32,105,110,116,111,32,116,104,101,32,115,105,109,117,108,97,116,105,111,
+    110,46,32,65,102,116,101,114,32,97,32,115,116,97,108,108,75,0,241,17,
+    40,97,32,98,114,101,97,107,112,111,105,110,116,44,32,97,32,100,114,97,
+    103,103,101,100,32,119,105,110,100,111,119,41,66,0,240,19,103,97,109,101,
+    32,115,108,111,119,115,32,100,111,119,110,32,105,110,115,116,101,97,100,32,
+    111,102,32,114,117,110,110,105,110,103,75,0,128,104,117,110,100,114,101,100,
+    115,23,0,241,17,117,112,100,97,116,101,115,32,116,111,32,99,97,116,99,
+    104,32,117,112,44,32,101,97,99,104,32,109,97,107,105,110,103,87,0,67,
+    110,101,120,116,182,0,32,108,97,152,0,241,27,115,116,105,108,108,46,10,
+    99,111,110,115,116,32,100,111,117,98,108,101,32,77,65,88,95,70,82,65,
+    77,69,95,84,73,77,69,32,61,32,48,46,50,53,59,7,1,241,0,72,
+    111,119,32,108,111,110,103,32,98,101,102,111,114,101,84,0,208,100,101,97,
+    100,108,105,110,101,32,101,110,100,70,133,1,224,40,41,32,115,116,111,112,
+    115,32,115,108,101,101,112,123,0,48,97,110,100,0,1,114,114,116,115,32,
+    115,112,105,191,0,2,115,0,245,18,115,116,100,58,58,117,105,110,116,54,
+    52,95,116,32,83,80,73,78,95,77,83,32,61,32,50,59,10,10,125,32,
+    47,47,32,137,1,33,10,10,93,0,118,83,116,97,116,115,58,58,12,0,
+    17,40,67,0,244,1,115,105,122,101,95,116,32,99,97,112,97,99,105,116,
+    121,44,204,0,242,13,110,111,109,105,110,97,108,80,101,114,105,111,100,41,
+    10,32,32,32,32,58,32,115,97,109,112,108,101,115,58,0,71,109,97,120,
+    60,67,0,38,62,40,68,0,89,49,41,41,44,32,66,0,25,40,14,0,
+    182,41,32,123,125,10,10,118,111,105,100,32,144,0,147,58,58,114,101,99,
+    111,114,100,40,78,1,161,115,101,99,111,110,100,115,41,32,123,126,0,3,
+    124,0,16,91,138,1,67,93,32,61,32,31,0,17,59,29,0,0,21,0,
+    65,32,61,32,40,8,0,100,43,32,49,41,32,37,173,0,16,46,226,0,
+    34,40,41,40,0,80,99,111,117,110,116,61,0,0,62,1,66,109,105,110,
+    40,17,0,75,43,32,49,44,48,0,103,41,59,10,125,10,10,224,0,9,
+    170,0,162,100,114,111,112,112,101,100,40,41,32,142,1,2,163,0,113,114,
+    101,116,117,114,110,32,53,0,1,89,0,67,95,105,102,40,184,0,134,46,
+    98,101,103,105,110,40,41,104,0,3,17,0,49,32,43,32,44,0,17,44,
+    201,0,0,104,1,13,4,0,110,91,116,104,105,115,93,24,1,20,32,113,
+    0,2,42,1,42,32,62,116,1,146,32,42,32,49,46,53,59,32,125,204,
+    0,3,87,1,8,113,1,164,112,101,114,99,101,110,116,105,108,101,93,0,
+    26,112,210,0,51,105,102,32,35,1,66,61,61,32,48,7,2,0,159,0,
+    3,121,0,50,48,46,48,88,1,1,243,0,114,118,101,99,116,111,114,60,
+    104,0,143,62,32,115,111,114,116,101,100,0,1,22,5,162,1,0,81,3,
+    1,80,0,18,115,155,2,65,114,97,110,107,179,1,154,97,116,105,99,95,
+    99,97,115,116,119,2,1,44,0,130,99,101,105,108,40,112,32,42,76,1,
+    25,41,77,0,128,97,117,116,111,32,110,116,104,69,0,1,148,0,4,140,
+    1,50,32,43,32,203,2,90,99,108,97,109,112,86,0,0,118,0,16,44,
+    23,2,1,157,1,83,41,32,45,32,49,85,0,1,112,0,194,110,116,104,
+    95,101,108,101,109,101,110,116,40,233,0,4,85,0,16,44,107,0,19,44,
+    254,0,84,46,101,110,100,40,142,0,3,53,1,65,42,110,116,104,93,2,
+    73,98,111,111,108,86,2,146,119,114,105,116,101,67,115,118,40,85,2,1,
+    105,0,208,115,116,114,105,110,103,38,32,112,97,116,104,44,41,5,138,32,
+    98,117,99,107,101,116,115,169,1,1,44,0,3,129,1,1,12,0,2,61,
+    1,178,62,32,104,105,115,116,111,103,114,97,109,234,0,67,109,97,120,40,
+    65,0,52,44,32,49,154,0,51,102,111,114,10,1,2,55,0,32,32,105,
+    189,4,82,59,32,105,32,60,81,1,84,59,32,43,43,105,138,3,0,1,
+    2,8,162,0,2,167,1,2,86,0,0,100,1,31,116,169,1,5,2,62,
+    4,48,91,105,93,154,2,83,48,48,48,46,48,83,1,0,82,0,37,43,
+    43,171,0,17,91,194,0,0,159,3,2,85,0,22,44,198,0,3,206,3,
+    1,143,1,18,93,124,2,33,125,10,58,3,1,52,0,19,111,137,6,32,
+    32,102,212,2,0,52,1,3,98,0,0,16,0,52,32,60,60,238,6,49,
+    109,115,44,131,6,66,115,92,110,34,70,0,13,3,1,34,109,115,4,1,
+    77,109,115,32,60,128,0,0,16,1,38,109,115,16,3,4,95,0,0,45,
+    0,80,60,32,39,44,39,108,0,6,208,0,48,109,115,93,17,0,66,39,
+    92,110,39,110,0,3,11,2,23,115,43,1,0,14,2,32,62,40,73,0,
+    2,175,3,2,168,3,4,150,7,4,185,5,4,16,0,17,40,31,0,112,
+    67,108,111,99,107,32,99,6,0,5,185,5,2,207,6,69,82,97,116,101,
+    19,0,1,235,0,2,18,0,1,38,1,3,229,1,0,126,0,34,115,87,
+    60,7,1,67,1,18,58,75,0,3,42,2,65,111,118,101,40,91,0,36,
+    41,41,156,4,2,92,0,178,83,116,101,112,40,49,46,48,32,47,32,17,
+    0,0,91,0,5,36,0,1,109,0,2,55,6,17,40,12,0,0,30,0,
+    128,32,62,32,48,46,48,32,63,205,6,10,198,3,4,195,6,129,62,40,
+    116,104,105,115,45,62,114,0,194,46,102,114,101,113,117,101,110,99,121,32,
+    47,118,7,0,69,0,90,41,32,58,32,48,104,0,1,213,6,23,40,201,
+    0,22,44,47,0,5,116,0,2,171,0,6,140,0,19,58,183,0,0,200,
+    0,2,138,6,2,179,4,3,140,3,4,99,1,35,58,58,99,6,2,16,
+    1,4,169,0,91,32,116,105,99,107,126,3,15,207,1,0,2,83,0,35,
+    62,40,46,0,18,47,91,1,6,217,0,1,2,4,1,197,1,22,83,113,
+    0,1,16,0,13,135,0,1,41,6,1,27,0,20,40,131,3,7,127,3,
+    5,152,0,83,110,111,119,32,61,103,0,52,110,111,119,243,6,0,195,5,
+    132,33,115,116,97,114,116,101,100,63,0,0,112,3,3,19,0,114,32,61,
+    32,116,114,117,101,151,2,0,24,0,65,108,97,115,116,109,0,102,32,61,
+    32,110,111,119,25,0,5,175,8,1,24,0,34,32,43,106,1,2,234,1,
+    6,38,0,3,11,1,48,123,48,44,242,1,18,125,25,0,3,163,3,2,
+    182,0,2,26,1,128,32,101,108,97,112,115,101,100,49,4,2,191,6,16,
+    40,193,0,37,45,32,128,0,3,186,3,5,16,0,8,144,0,1,205,1,
+    1,253,1,19,46,53,8,3,79,0,34,41,59,14,4,65,97,99,99,117,
+    75,10,82,111,114,32,43,61,147,7,0,81,4,3,39,0,27,44,172,9,
+    3,108,0,2,248,0,1,93,0,58,32,61,32,196,0,120,119,104,105,108,
+    101,32,40,89,0,42,62,61,74,2,1,69,3,0,68,1,8,37,0,24,
+    45,37,0,2,15,1,0,35,0,33,43,43,103,0,18,46,66,3,18,115,
+    25,0,17,125,66,0,2,25,0,136,97,108,112,104,97,32,61,32,76,0,
+    4,113,3,0,186,2,2,50,0,3,111,1,1,51,0,1,83,2,7,85,
+    9,6,88,2,7,97,10,2,170,8,0,21,2,1,52,0,2,191,1,31,
+    32,222,7,1,3,74,1,1,50,4,15,101,2,17,0,191,1,52,62,61,
+    32,39,2,8,108,2,96,47,47,32,77,105,115,238,1,48,105,116,58,4,
+    4,33,114,116,2,11,1,175,9,1,136,0,0,107,2,16,32,238,10,241,
+    1,103,105,118,101,32,105,116,32,97,32,102,117,108,108,32,112,128,10,4,
+    128,4,16,32,217,10,240,1,114,97,116,104,101,114,32,116,104,97,110,32,
+    114,117,115,104,40,11,0,60,12,96,102,111,108,108,111,119,14,0,1,82,
+    0,1,209,11,128,109,97,107,101,32,117,112,32,222,5,0,96,4,0,125,
+    12,1,100,1,0,131,1,4,170,0,2,89,2,15,209,2,11,2,110,1,
+    9,200,2,10,25,1,0,159,11,5,127,3,6,191,4,21,42,155,11,83,
+    47,32,49,48,48,47,9,0,127,1,5,126,0,17,45,252,0,17,62,225,
+    11,6,82,6,2,8,5,1,9,12,16,77,113,11,11,84,7,0,145,1,
+    123,51,50,95,116,62,40,40,73,0,18,45,73,0,3,99,7,29,32,121,
+    4,4,244,7,3,208,2,2,104,0,1,48,4,47,32,60,189,1,5,82,
+    83,112,105,110,32,68,1,17,101,161,3,16,32,240,13,66,116,99,104,58,
+    171,12,64,115,32,97,114,217,13,33,108,121,175,2,64,114,97,116,101,79,
+    13,129,97,32,102,101,119,32,109,115,114,1,2,220,2,5,173,0,42,43,
+    61,64,4,32,125,10,245,3,35,105,110,99,108,117,100,101,32,34,97,112,
+    112,46,104,34,10,10,18,0,154,60,99,115,116,100,108,105,98,62,19,0,
+    72,114,105,110,103,19,0,241,60,105,111,115,116,114,101,97,109,62,10,10,
+    115,116,97,116,105,99,32,118,111,105,100,32,112,114,105,110,116,85,115,97,
+    103,101,40,99,111,110,115,116,32,99,104,97,114,42,32,112,114,111,103,114,
+    97,109,41,32,123,10,32,32,32,32,115,116,100,58,58,99,111,117,116,32,
+    60,60,32,34,47,0,48,58,32,34,13,0,3,41,0,0,11,0,225,34,
+    32,91,45,45,102,114,97,109,101,115,32,78,93,13,0,20,112,10,0,129,
+    110,111,45,118,115,121,110,99,23,0,193,99,115,118,32,70,73,76,69,93,
+    92,110,34,95,0,0,99,0,2,4,0,0,95,0,38,32,32,71,0,243,
+    1,32,32,32,81,117,105,116,32,97,102,116,101,114,32,78,32,95,0,255,
+    22,40,119,105,116,104,32,83,68,76,95,86,73,68,69,79,68,82,73,86,
+    69,82,61,100,117,109,109,121,32,116,104,105,115,32,114,117,110,115,94,0,
+    5,2,106,0,3,6,0,0,73,0,0,216,0,175,97,32,100,105,115,112,
+    108,97,121,41,55,0,5,48,45,45,102,207,0,2,56,0,16,70,231,0,
+    193,32,114,97,116,101,32,116,111,32,112,97,99,8,0,4,77,0,1,235,
+    0,255,11,32,40,100,101,102,97,117,108,116,32,54,48,59,32,48,32,61,
+    32,117,110,99,97,112,112,101,100,99,0,8,4,40,1,64,32,32,32,80,
+    85,0,3,240,0,0,89,0,240,6,32,116,104,101,32,112,101,114,102,111,
+    114,109,97,110,99,101,32,99,111,117,110,22,1,127,105,110,115,116,101,97,
+    100,184,0,7,4,112,1,96,32,32,32,87,114,105,179,0,34,104,101,74,
+    1,161,45,116,105,109,101,32,104,105,115,116,239,1,0,204,0,0,153,1,
+    240,10,32,111,110,32,101,120,105,116,92,110,34,59,10,125,10,10,105,110,
+    116,32,109,97,105,110,40,9,0,83,97,114,103,99,44,39,2,100,97,114,
+    103,118,91,93,38,2,194,65,112,112,79,112,116,105,111,110,115,32,111,8,
+    0,17,59,223,1,65,102,111,114,32,59,0,176,105,32,61,32,49,59,32,
+    105,32,60,32,70,0,84,59,32,43,43,105,61,0,0,88,1,2,130,2,
+    244,6,98,111,111,108,32,104,97,115,86,97,108,117,101,32,61,32,105,32,
+    43,32,49,51,0,1,81,0,0,44,0,65,105,102,32,40,151,2,113,115,
+    116,114,99,109,112,40,139,0,84,105,93,44,32,34,62,2,165,34,41,32,
+    61,61,32,48,32,38,38,78,0,8,109,0,0,69,0,3,167,0,19,46,
+    103,1,18,61,233,2,66,97,116,111,105,80,0,82,43,43,105,93,41,197,
+    0,0,47,0,127,125,32,101,108,115,101,32,123,0,10,47,112,115,120,0,
+    25,54,112,115,32,117,0,31,102,117,0,37,4,54,2,3,122,0,15,230,
+    0,5,2,151,2,127,61,32,102,97,108,115,101,214,0,26,51,99,115,118,
+    92,0,15,78,1,17,144,99,115,118,80,97,116,104,32,61,230,1,32,118,
+    91,69,1,13,110,0,2,88,4,0,85,1,0,4,0,7,134,4,1,200,
+    1,24,48,118,1,0,33,0,98,114,101,116,117,114,110,159,1,15,241,1,
+    0,68,104,101,108,112,161,0,119,63,32,48,32,58,32,49,114,0,1,52,
+    2,33,125,10,7,0,131,65,112,112,32,97,112,112,40,250,1,3,221,1,
+    1,27,0,0,215,1,16,33,95,5,104,105,110,105,116,40,41,70,1,3,
+    127,0,3,85,0,17,125,47,0,0,42,0,98,114,117,110,40,41,59,90,
+    0,3,36,0,16,48,50,3,0,243,16,47,47,32,84,101,115,116,115,32,
+    102,111,114,32,70,114,97,109,101,83,99,104,101,100,117,108,101,114,32,97,
+    110,100,19,0,248,41,116,97,116,115,32,97,103,97,105,110,115,116,32,97,
+    32,102,97,107,101,32,99,108,111,99,107,59,32,110,101,101,100,115,32,110,
+    111,32,83,68,76,10,35,105,110,99,108,117,100,101,32,60,99,109,97,116,
+    104,62,17,0,92,115,116,100,105,111,18,0,56,108,105,98,19,0,120,102,
+    115,116,114,101,97,109,19,0,46,105,111,20,0,134,115,116,114,105,110,103,
+    62,10,95,0,32,34,102,187,0,36,95,115,188,0,255,41,46,104,34,10,
+    10,115,116,97,116,105,99,32,105,110,116,32,102,97,105,108,117,114,101,115,
+    32,61,32,48,59,10,10,35,100,101,102,105,110,101,32,67,72,69,67,75,
+    40,99,111,110,100,105,116,105,111,110,41,32,1,0,36,32,92,10,57,0,
+    64,100,111,32,123,8,0,15,4,0,49,2,82,0,0,74,0,87,105,102,
+    32,40,33,164,0,31,41,101,0,36,6,82,0,0,86,0,240,6,115,116,
+    100,58,58,99,101,114,114,32,60,60,32,95,95,70,73,76,69,95,95,12,
+    0,48,39,58,39,7,0,83,95,95,76,73,78,19,0,101,34,58,32,34,
+    32,35,38,1,154,32,34,92,110,34,59,32,32,32,82,0,36,43,43,101,
+    1,0,28,0,0,100,0,15,4,0,31,6,82,0,31,125,61,0,31,15,
+    50,0,2,2,82,0,240,8,125,32,119,104,105,108,101,32,40,48,41,10,
+    10,47,47,32,77,105,99,114,111,115,101,211,0,240,40,32,116,105,99,107,
+    115,46,32,69,118,101,114,121,32,114,101,97,100,32,97,100,118,97,110,99,
+    101,115,32,49,32,117,115,32,115,111,32,116,104,97,116,32,115,112,105,110,
+    110,105,110,103,32,109,97,107,101,115,70,0,240,26,112,114,111,103,114,101,
+    115,115,59,32,115,108,101,101,112,115,32,111,118,101,114,115,104,111,111,116,
+    32,98,121,32,49,32,109,115,32,108,105,107,101,32,97,87,0,37,108,32,
+    157,2,116,32,109,105,103,104,116,46,160,2,1,139,1,130,117,105,110,116,
+    54,52,95,116,143,0,3,167,2,3,193,2,1,151,3,16,67,111,3,1,
+    122,3,1,10,0,65,40,41,32,123,117,2,211,114,101,116,117,114,110,32,
+    123,91,93,32,123,32,13,0,1,211,0,145,43,43,59,32,125,44,32,49,
+    48,1,0,85,44,32,91,93,40,106,0,112,51,50,95,116,32,109,115,75,
+    2,1,44,0,225,32,43,61,32,40,109,115,32,43,32,49,41,32,42,52,
+    0,117,59,32,125,125,59,10,125,70,3,225,118,111,105,100,32,116,101,115,
+    116,80,97,99,101,115,147,0,245,1,115,84,111,84,104,101,84,97,114,103,
+    101,116,82,97,116,101,148,0,1,30,0,6,72,4,5,249,0,83,40,102,
+    97,107,101,191,0,98,44,32,54,48,46,48,6,0,33,41,59,203,0,0,
+    169,3,84,117,112,100,97,116,168,3,0,210,1,0,152,4,16,40,26,0,
+    1,226,3,1,25,1,18,32,11,0,145,60,32,49,50,49,59,32,43,43,
+    15,0,4,16,1,0,52,0,4,69,0,38,43,61,117,1,97,46,98,101,
+    103,105,110,154,0,51,40,41,46,34,0,2,120,0,0,51,0,5,7,1,
+    160,53,48,48,48,59,32,47,47,32,53,192,1,113,111,102,32,119,111,114,
+    107,159,0,0,39,0,5,203,0,67,46,101,110,100,77,0,2,69,0,17,
+    125,36,0,32,99,111,34,5,1,25,0,16,83,53,5,32,38,32,196,1,
+    40,115,32,137,0,1,18,0,19,40,244,0,2,130,4,1,19,0,17,46,
+    200,0,171,115,40,41,32,61,61,32,49,50,48,34,0,130,100,58,58,102,
+    97,98,115,40,44,0,241,8,112,101,114,99,101,110,116,105,108,101,40,48,
+    46,53,41,32,45,32,49,46,48,32,47,85,1,171,41,32,60,32,48,46,
+    48,48,48,49,67,0,128,97,116,115,46,109,97,120,40,33,0,6,47,0,
+    47,32,43,46,0,7,114,100,114,111,112,112,101,100,148,0,10,146,0,3,
+    67,1,180,32,62,61,32,49,49,57,32,38,38,32,18,0,20,60,191,0,
+    15,62,2,0,65,83,108,111,119,31,1,194,115,82,117,110,83,101,118,101,
+    114,97,108,85,244,1,181,65,110,100,67,111,117,110,116,65,115,68,118,0,
+    2,228,2,1,49,0,15,80,2,14,44,49,48,81,2,6,174,1,8,253,
+    1,17,59,170,1,6,28,0,12,202,1,0,109,2,4,203,0,1,47,6,
+    0,249,1,15,135,2,10,31,48,134,2,2,10,182,0,33,58,58,16,0,
+    64,32,116,105,109,69,4,8,17,2,14,157,0,0,114,0,2,26,2,2,
+    47,0,96,46,97,108,112,104,97,107,1,48,48,46,48,107,1,9,23,0,
+    16,60,252,1,3,235,1,0,58,0,4,189,0,35,43,61,110,0,15,239,
+    2,8,16,52,30,4,1,240,2,39,52,48,241,2,32,58,32,155,1,112,
+    121,32,100,101,97,100,108,42,7,145,105,115,32,109,105,115,115,101,100,61,
+    1,0,102,0,15,65,1,7,2,11,3,0,90,8,131,104,101,32,102,105,
+    114,115,116,178,3,240,19,119,97,115,32,112,97,99,101,100,32,116,111,32,
+    49,54,46,55,32,109,115,59,32,116,104,101,32,111,116,104,101,114,115,32,
+    116,89,8,1,137,0,53,44,32,52,80,2,65,101,97,99,104,119,0,2,
+    19,1,6,121,0,1,11,3,57,40,41,46,166,2,19,57,10,1,3,45,
+    0,21,116,56,3,5,28,8,4,55,0,9,68,3,16,57,68,3,64,48,
+    46,48,52,29,3,15,62,3,0,4,85,1,80,62,61,32,51,55,131,1,
+    4,17,0,111,60,61,32,51,56,41,43,5,2,33,85,110,238,0,1,249,
+    1,240,0,115,65,99,99,117,109,117,108,97,116,101,70,114,97,99,111,8,
+    96,97,108,83,116,101,112,241,3,15,231,2,32,36,48,46,143,3,6,16,
+    1,14,73,2,5,215,4,17,50,216,4,1,70,1,1,143,0,5,78,3,
+    4,152,2,2,168,1,15,151,2,11,15,78,0,23,3,92,7,15,79,0,
+    11,2,162,1,1,121,0,4,162,2,0,251,4,16,50,94,1,1,171,6,
+    1,240,4,2,32,0,2,1,3,33,45,32,237,4,1,223,4,11,221,4,
+    1,205,7,8,71,0,17,51,71,0,2,23,0,2,62,0,15,55,0,1,
+    5,21,2,2,207,1,83,68,101,108,116,97,238,4,17,46,64,5,15,196,
+    4,0,203,72,105,115,116,111,103,114,97,109,67,115,118,244,6,0,244,5,
+    2,243,5,48,40,52,44,151,3,4,147,5,2,117,4,1,70,4,114,100,
+    111,117,98,108,101,32,35,1,192,115,32,58,32,123,48,46,48,49,54,49,
+    44,135,5,49,49,54,53,8,0,48,51,51,48,8,0,2,13,0,81,49,
+    54,50,125,41,188,1,1,121,3,0,101,0,131,46,114,101,99,111,114,100,
+    40,70,0,17,41,195,3,21,84,112,3,241,1,111,110,101,32,102,97,108,
+    108,115,32,111,117,116,32,111,102,101,3,97,119,105,110,100,111,119,72,0,
+    2,123,1,1,9,3,9,119,6,27,52,61,3,0,50,6,9,94,3,31,
+    50,33,0,0,9,72,3,17,53,191,6,1,210,0,31,53,44,0,0,2,
+    127,6,33,61,61,201,1,33,59,10,141,0,2,53,7,1,242,1,2,218,
+    11,240,0,32,112,97,116,104,32,61,32,34,98,117,105,108,100,47,118,8,
+    17,95,29,7,36,95,104,123,1,82,46,99,115,118,34,85,1,8,204,0,
+    80,119,114,105,116,101,151,1,0,66,0,83,44,32,52,48,41,132,0,1,
+    94,0,19,105,96,12,32,32,102,56,7,0,35,0,8,30,0,3,124,0,
+    0,239,4,2,89,0,0,9,6,0,14,0,0,191,7,18,48,19,0,1,
+    71,0,48,103,101,116,23,0,16,40,70,0,32,44,32,11,0,3,71,0,
+    2,138,0,0,17,0,0,200,2,3,148,12,49,109,115,44,188,0,35,115,
+    34,38,0,3,139,10,15,75,0,5,8,201,8,64,105,102,32,40,79,0,
+    16,115,80,0,38,49,54,4,2,0,8,2,11,110,0,68,49,54,44,50,
+    99,0,0,31,0,9,60,0,47,51,51,60,0,10,79,51,51,44,49,60,
+    0,7,31,57,60,0,11,17,57,60,0,1,51,9,17,48,68,6,129,108,
+    97,110,100,115,32,105,110,117,2,177,108,97,115,116,32,98,117,99,107,101,
+    116,237,1,0,155,0,33,43,43,213,0,2,83,1,2,46,6,6,205,0,
+    1,236,0,21,52,221,4,0,192,5,112,114,101,109,111,118,101,40,177,1,
+    112,46,99,95,115,116,114,40,215,1,48,125,10,10,162,1,69,109,97,105,
+    110,134,3,0,43,2,15,161,10,9,2,115,0,0,38,0,15,137,8,27,
+    6,56,0,15,212,5,21,6,50,0,10,47,4,2,24,0,0,157,1,4,
+    47,13,72,32,62,32,48,245,1,1,25,2,4,155,13,5,37,0,209,60,
+    60,32,34,32,99,104,101,99,107,40,115,41,208,14,32,101,100,136,13,5,
+    85,1,3,252,11,194,69,88,73,84,95,70,65,73,76,85,82,69,108,0,
+    2,97,1,2,86,0,0,14,4,0,74,0,51,65,108,108,148,7,5,62,
+    6,1,221,11,0,160,7,0,230,7,5,90,0,8,86,0,112,83,85,67,
+    67,69,83,83,235,6,0,240,56,67,88,88,32,61,32,103,43,43,10,79,
+    80,84,73,77,73,90,65,84,73,79,78,95,76,69,86,69,76,32,61,32,
+    45,79,50,10,83,82,67,32,61,32,36,40,119,105,108,100,99,97,114,100,
+    32,115,114,99,47,42,46,99,112,112,41,10,73,78,67,76,85,68,69,83,
+    43,0,240,33,73,105,110,99,108,117,100,101,10,10,35,32,67,111,114,111,
+    117,116,105,110,101,115,32,40,99,111,95,97,119,97,105,116,41,32,110,101,
+    101,100,32,67,43,43,50,48,10,83,84,68,52,0,81,115,116,100,61,99,
+    17,0,245,65,10,35,32,79,110,101,32,115,116,100,58,58,116,104,114,101,
+    97,100,32,112,101,114,32,115,104,97,114,100,59,32,105,111,95,117,114,105,
+    110,103,32,105,115,32,117,115,101,100,32,116,104,114,111,117,103,104,32,114,
+    97,119,32,115,121,115,99,97,108,108,115,44,32,115,111,32,110,111,10,35,
+    32,108,105,98,47,0,0,117,0,209,101,100,10,84,72,82,69,65,68,95,
+    76,73,66,173,0,18,112,100,0,0,172,0,240,21,61,61,61,32,68,101,
+    98,117,103,32,99,111,110,102,105,103,117,114,97,116,105,111,110,32,61,61,
+    61,10,68,66,71,95,70,76,65,71,52,0,244,0,36,40,83,84,68,41,
+    32,45,87,97,108,108,32,36,40,251,0,65,41,32,45,103,40,0,49,79,
+    66,74,40,1,129,112,97,116,115,117,98,115,116,40,1,16,37,40,1,144,
+    44,32,98,117,105,108,100,47,100,102,0,241,2,47,111,98,106,47,37,46,
+    111,44,32,36,40,83,82,67,41,41,61,0,89,66,73,78,32,61,39,0,
+    240,6,98,105,110,47,123,123,112,114,111,106,101,99,116,95,110,97,109,101,
+    125,125,10,191,0,112,95,68,69,66,85,71,32,147,1,7,213,0,20,41,
+    203,0,127,82,101,108,101,97,115,101,205,0,0,63,82,69,76,205,0,15,
+    46,36,40,9,2,32,41,10,59,0,15,224,0,15,18,114,123,0,14,226,
+    0,0,63,0,8,226,0,4,41,0,15,228,0,2,52,10,35,32,196,0,
+    241,19,112,114,111,102,105,108,101,32,97,110,100,32,112,114,101,99,111,109,
+    112,105,108,101,100,32,104,101,97,100,101,114,32,114,117,108,97,2,242,13,
+    112,112,115,116,97,114,116,101,114,46,109,107,41,10,80,82,79,70,73,76,
+    69,95,84,65,82,71,69,84,186,1,3,129,0,64,41,32,36,40,11,0,
+    83,79,66,74,41,10,175,2,40,32,99,63,0,2,98,1,127,82,69,76,
+    69,65,83,69,100,1,2,128,69,109,105,116,32,46,100,32,153,0,240,2,
+    115,32,110,101,120,116,32,116,111,32,101,97,99,104,32,111,98,172,1,0,
+    134,2,3,161,0,176,101,100,105,116,115,32,116,114,105,103,103,175,0,4,
+    193,0,84,115,10,68,69,80,87,2,240,21,45,77,77,68,32,45,77,80,
+    10,10,46,68,69,70,65,85,76,84,95,71,79,65,76,32,58,61,32,97,
+    108,108,10,36,40,101,118,97,112,2,0,227,2,247,0,32,80,67,72,95,
+    82,85,76,69,83,44,68,66,71,44,86,2,18,44,77,2,53,44,36,40,
+    179,2,63,41,41,41,62,0,6,51,82,69,76,62,0,3,139,1,6,64,
+    0,0,32,1,1,156,0,0,64,0,98,10,97,108,108,58,32,85,0,102,
+    66,73,78,41,10,10,12,0,4,24,0,1,77,1,192,9,109,107,100,105,
+    114,32,45,112,32,36,40,9,0,160,36,64,41,10,9,36,40,67,88,88,
+    116,1,6,148,0,198,32,45,111,32,36,64,32,36,94,32,36,40,205,2,
+    55,41,10,10,204,0,4,64,2,22,58,66,3,3,131,0,0,255,0,95,
+    71,67,72,41,10,111,0,22,2,175,0,0,56,0,2,212,0,0,73,0,
+    3,124,1,114,41,32,45,99,32,36,60,146,0,35,10,10,9,1,0,214,
+    0,0,3,1,4,238,0,4,12,0,4,24,0,15,238,0,16,0,51,0,
+    3,110,0,12,238,0,3,89,2,5,240,0,3,117,0,15,242,0,3,0,
+    72,0,0,186,0,15,242,0,16,0,43,0,3,115,0,2,226,2,0,56,
+    0,5,17,0,4,110,2,11,242,0,20,45,2,3,2,37,1,144,79,66,
+    74,58,46,111,61,46,100,178,1,0,81,0,6,17,0,0,92,4,112,69,
+    118,101,114,121,116,104,133,5,241,10,98,117,116,32,109,97,105,110,40,41,
+    44,32,102,111,114,32,116,104,101,32,116,101,115,116,115,169,3,0,14,0,
+    244,7,108,111,97,100,32,103,101,110,101,114,97,116,111,114,10,83,69,82,
+    86,69,82,95,74,6,146,102,105,108,116,101,114,45,111,117,36,5,0,75,
+    0,2,39,5,2,197,2,1,203,4,242,9,83,101,114,118,101,115,32,111,
+    110,32,49,50,55,46,48,46,48,46,49,32,119,105,116,104,106,3,96,98,
+    97,99,107,101,110,7,6,240,3,101,32,107,101,114,110,101,108,32,115,117,
+    112,112,111,114,116,115,10,138,0,23,58,34,2,8,90,2,63,98,105,110,
+    151,2,4,16,73,55,0,16,115,13,2,11,48,0,16,47,25,0,32,95,
+    115,143,0,18,114,230,0,8,18,0,0,184,0,0,201,5,5,225,0,0,
+    61,1,9,151,5,63,9,46,47,82,0,8,128,10,10,67,79,78,78,69,
+    67,118,7,177,83,32,63,61,32,54,52,10,68,85,82,134,7,0,15,0,
+    144,53,10,66,65,67,75,69,78,68,13,0,174,97,117,116,111,10,98,101,
+    110,99,104,224,0,4,74,2,10,226,0,0,199,1,3,7,2,35,45,111,
+    95,6,7,42,0,16,47,168,1,21,95,168,1,17,32,92,0,11,21,0,
+    15,226,0,24,15,90,0,8,128,45,45,99,111,110,110,101,99,90,7,71,
+    115,32,36,40,246,0,160,41,32,45,45,115,101,99,111,110,100,25,0,4,
+    253,0,0,22,0,4,230,1,35,36,40,5,1,176,41,10,10,118,97,108,
+    103,114,105,110,100,144,3,0,87,4,1,168,3,20,9,22,0,242,26,32,
+    45,45,108,101,97,107,45,99,104,101,99,107,61,102,117,108,108,32,45,45,
+    116,114,97,99,107,45,111,114,105,103,105,110,115,61,121,101,115,32,46,47,
+    243,2,1,61,0,74,10,114,117,110,78,0,13,31,0,19,45,218,0,0,
+    39,0,0,83,1,1,56,0,16,9,39,0,5,14,0,242,0,10,99,108,
+    101,97,110,58,10,9,114,109,32,45,114,102,108,1,240,7,10,10,104,101,
+    108,112,58,32,35,35,32,83,104,111,119,115,32,116,104,105,115,32,20,0,
+    245,13,10,9,64,101,99,104,111,32,34,65,118,97,105,108,97,98,108,101,
+    32,116,97,114,103,101,116,115,58,34,28,0,16,32,2,6,20,32,1,0,
+    48,45,32,66,70,8,17,32,70,8,80,32,118,101,114,115,166,8,152,40,
+    100,101,102,97,117,108,116,41,55,0,3,175,0,1,58,0,4,55,0,162,
+    111,112,116,105,109,105,122,101,100,32,204,2,8,48,0,0,227,2,1,45,
+    0,98,32,32,32,45,32,67,103,7,1,205,3,49,114,117,110,223,3,2,
+    52,0,2,0,3,160,32,111,118,101,114,32,108,111,111,112,161,1,8,72,
+    0,1,64,2,3,73,0,48,45,32,76,5,4,0,14,4,3,61,0,1,
+    191,3,7,249,1,148,32,99,108,105,101,110,116,115,32,196,0,65,32,54,
+    52,41,81,4,4,5,2,20,32,24,2,5,34,0,26,53,232,0,35,117,
+    110,110,0,0,184,0,51,82,117,110,220,0,51,32,105,110,39,1,251,5,
+    109,111,100,101,32,40,67,116,114,108,43,67,32,115,116,111,112,115,32,105,
+    44,1,36,117,110,223,1,58,32,45,32,68,0,4,72,1,0,70,0,8,
+    232,0,5,111,2,1,48,1,0,52,0,2,149,1,8,233,0,4,36,0,
+    8,56,0,1,36,2,3,178,0,129,45,32,82,101,109,111,118,101,228,1,
+    5,218,8,2,86,8,248,0,97,110,100,32,100,105,114,101,99,116,111,114,
+    105,101,115,67,0,0,61,2,3,66,0,33,32,45,86,2,6,85,2,6,
+    40,0,6,10,0,33,79,112,115,3,9,86,2,3,78,3,16,61,85,10,
+    129,32,45,32,69,118,101,110,116,208,1,1,125,1,1,197,1,32,58,32,
+    109,4,22,44,121,11,134,111,114,32,101,112,111,108,108,90,0,16,32,142,
+    8,35,61,49,141,0,53,45,32,80,161,9,1,50,2,243,1,109,111,115,
+    116,32,102,114,101,113,117,101,110,116,108,121,32,109,6,16,100,175,11,51,
+    116,101,109,196,9,9,220,0,3,186,9,4,152,0,4,6,10,3,29,1,
+    17,114,145,2,179,102,108,97,103,115,32,102,114,111,109,32,30,10,32,115,
+    47,200,0,86,46,109,107,32,40,203,9,241,9,32,116,117,110,101,41,34,
+    10,10,70,79,82,67,69,58,10,10,46,80,72,79,78,89,58,110,1,4,
+    215,1,1,247,2,1,239,0,16,32,232,2,23,114,10,2,4,190,1,18,
+    32,179,1,1,118,1,1,75,0,0,240,25,47,47,32,67,108,111,115,101,
+    100,45,108,111,111,112,32,72,84,84,80,32,108,111,97,100,32,103,101,110,
+    101,114,97,116,111,114,32,111,118,101,114,32,30,0,240,5,98,97,99,107,
+    46,32,83,116,97,114,116,115,32,116,104,101,32,115,101,114,28,0,241,33,
+    105,110,32,116,104,105,115,10,47,47,32,112,114,111,99,101,115,115,32,111,
+    110,32,97,32,102,114,101,101,32,112,111,114,116,32,40,111,114,32,116,97,
+    114,103,101,116,115,32,45,45,19,0,241,14,111,102,32,111,110,101,32,97,
+    108,114,101,97,100,121,32,114,117,110,110,105,110,103,41,44,32,107,101,101,
+    112,76,0,209,45,45,99,111,110,110,101,99,116,105,111,110,115,23,0,120,
+    45,97,108,105,118,101,32,23,0,240,17,98,117,115,121,32,102,111,114,32,
+    45,45,115,101,99,111,110,100,115,44,32,101,97,99,104,32,115,101,110,100,
+    105,110,103,168,0,0,153,0,240,3,110,101,120,116,32,114,101,113,117,101,
+    115,116,32,97,115,32,115,111,163,0,2,199,0,240,18,112,114,101,118,105,
+    111,117,115,32,114,101,115,112,111,110,115,101,32,97,114,114,105,118,101,115,
+    44,32,97,110,100,32,114,101,177,0,1,147,0,3,65,0,81,115,47,115,
+    101,99,28,0,240,5,108,97,116,101,110,99,121,32,112,101,114,99,101,110,
+    116,105,108,101,115,58,111,0,240,20,32,32,109,97,107,101,32,98,101,110,
+    99,104,32,91,67,79,78,78,69,67,84,73,79,78,83,61,54,52,93,32,
+    91,68,85,82,65,15,0,248,24,61,53,93,32,91,66,65,67,75,69,78,
+    68,61,97,117,116,111,93,10,35,105,110,99,108,117,100,101,32,60,97,108,
+    103,111,114,105,116,104,109,62,21,0,169,114,112,97,47,105,110,101,116,46,
+    104,23,0,88,116,111,109,105,99,18,0,105,99,104,114,111,110,111,18,0,
+    107,115,116,100,108,105,98,19,0,72,114,105,110,103,19,0,122,105,111,109,
+    97,110,105,112,19,0,89,115,116,114,101,97,136,0,104,109,101,109,111,114,
+    121,38,0,48,110,101,116,152,0,58,47,105,110,155,0,4,24,0,58,116,
+    99,112,25,0,44,115,116,124,0,140,115,121,115,47,115,111,99,107,222,0,
+    32,116,104,37,2,8,109,0,106,117,110,105,115,116,100,80,0,134,118,101,
+    99,116,111,114,62,10,46,1,135,34,104,116,116,112,46,104,34,18,0,2,
+    179,2,0,20,0,48,10,117,115,32,2,210,67,108,111,99,107,32,61,32,
+    115,116,100,58,58,53,1,64,58,58,115,116,149,2,32,95,99,28,0,144,
+    59,10,10,115,116,97,116,105,99,120,2,34,115,116,41,0,2,188,0,241,
+    2,32,82,69,81,85,69,83,84,32,61,32,34,71,69,84,32,47,64,3,
+    242,6,47,49,46,49,92,114,92,110,72,111,115,116,58,32,49,50,55,46,
+    48,46,48,19,0,0,23,0,22,34,81,0,48,105,110,116,85,0,0,228,
+    2,49,84,111,40,130,0,129,117,105,110,116,49,54,95,116,56,3,112,41,
+    32,123,10,32,32,32,36,0,48,115,116,32,46,0,32,102,100,171,0,1,
+    35,1,242,8,40,65,70,95,73,78,69,84,44,32,83,79,67,75,95,83,
+    84,82,69,65,77,32,124,14,0,193,67,76,79,69,88,69,67,44,32,48,
+    41,59,67,0,0,87,1,128,97,100,100,114,95,105,110,32,8,0,0,165,
+    3,66,61,32,123,125,30,0,3,18,0,227,46,115,105,110,95,102,97,109,
+    105,108,121,32,61,32,96,0,14,34,0,0,15,3,144,32,61,32,104,116,
+    111,110,115,40,13,0,3,100,0,8,70,0,0,12,0,48,46,115,95,7,
+    0,3,43,0,208,108,40,73,78,65,68,68,82,95,76,79,79,80,244,2,
+    3,54,0,208,105,102,32,40,102,100,32,60,32,48,32,124,124,235,0,0,
+    15,1,244,7,40,102,100,44,32,114,101,105,110,116,101,114,112,114,101,116,
+    95,99,97,115,116,60,197,0,64,42,62,40,38,90,0,196,101,115,115,41,
+    44,32,115,105,122,101,111,102,214,0,16,41,74,0,4,57,1,0,61,1,
+    1,87,1,147,99,101,114,114,32,60,60,32,34,60,4,54,32,116,111,154,
+    1,32,58,34,27,0,16,112,169,4,0,35,0,145,32,102,97,105,108,101,
+    100,58,32,23,0,1,63,0,0,0,3,176,114,114,111,114,40,101,114,114,
+    110,111,41,47,0,66,39,92,110,39,27,1,5,101,0,99,101,120,105,116,
+    40,49,215,0,17,125,119,1,51,99,111,110,186,1,0,237,4,50,61,32,
+    49,51,0,48,115,101,116,204,0,49,111,112,116,233,0,245,15,73,80,80,
+    82,79,84,79,95,84,67,80,44,32,84,67,80,95,78,79,68,69,76,65,
+    89,44,32,38,111,110,101,226,0,51,111,110,101,93,0,208,114,101,116,117,
+    114,110,32,102,100,59,10,125,10,112,4,40,79,110,23,5,20,58,234,4,
+    97,44,32,119,97,105,116,32,5,0,176,5,85,119,104,111,108,101,230,4,
+    0,97,1,193,112,101,97,116,46,32,65,112,112,101,110,100,226,4,1,60,
+    5,243,3,114,111,117,110,100,32,116,114,105,112,32,105,110,32,110,97,110,
+    111,92,5,0,55,1,18,96,244,4,113,105,101,115,96,59,32,114,137,0,
+    112,115,32,102,97,108,115,101,246,5,16,101,39,1,20,46,50,3,64,98,
+    111,111,108,219,5,111,67,108,105,101,110,116,226,2,0,16,44,241,1,4,
+    85,3,17,97,197,4,16,60,53,0,66,62,38,32,100,251,0,0,151,3,
+    2,218,3,17,60,139,1,0,33,3,117,51,50,95,116,62,38,32,137,0,
+    4,239,1,6,110,1,1,40,3,3,236,1,40,84,111,165,2,242,2,99,
+    104,97,114,32,98,117,102,102,101,114,91,52,48,57,54,93,146,1,0,117,
+    0,32,32,111,9,4,66,116,114,117,101,20,0,224,119,104,105,108,101,32,
+    40,111,107,32,38,38,32,33,144,0,16,46,27,7,2,199,0,2,1,5,
+    244,0,95,111,114,100,101,114,95,114,101,108,97,120,101,100,41,137,0,0,
+    19,2,2,141,0,1,95,4,144,58,58,116,105,109,101,95,112,111,195,3,
+    16,115,64,7,32,32,61,119,7,131,99,107,58,58,110,111,119,40,214,1,
+    0,54,0,1,131,0,0,188,6,1,25,2,3,96,4,132,46,100,97,116,
+    97,40,41,44,112,4,16,46,243,2,0,16,0,240,0,77,83,71,95,78,
+    79,83,73,71,78,65,76,41,32,61,198,4,0,170,4,3,46,3,0,38,
+    0,68,95,116,62,40,70,0,0,16,0,39,40,41,109,0,1,81,1,0,
+    22,0,128,95,116,32,102,105,108,108,101,94,4,18,48,253,0,0,141,0,
+    9,1,1,4,29,7,130,76,101,110,103,116,104,40,123,68,1,19,44,57,
+    0,17,125,127,0,24,48,1,1,0,66,0,2,5,1,19,115,100,0,97,
+    114,101,99,101,105,118,102,0,65,114,101,99,118,227,0,2,71,0,35,32,
+    43,72,0,5,237,2,3,24,0,21,45,24,0,4,202,4,0,87,0,0,
+    4,0,1,42,1,5,82,0,39,62,32,184,0,0,31,0,3,208,0,32,
+    43,61,214,1,37,63,32,41,0,24,58,41,0,2,165,3,0,47,0,0,
+    134,4,49,111,107,41,181,3,0,16,0,0,4,0,5,96,2,96,46,112,
+    117,115,104,95,255,8,18,40,11,6,3,97,1,0,156,2,5,144,2,25,
+    40,60,0,0,64,0,1,95,1,4,83,6,64,100,117,114,97,202,8,7,
+    59,0,4,27,0,7,97,3,35,62,40,49,2,1,23,2,49,32,45,32,
+    46,2,148,41,46,99,111,117,110,116,40,41,189,1,2,184,0,16,99,185,
+    9,51,40,102,100,210,1,2,140,3,49,32,111,107,21,4,0,107,2,80,
+    109,97,105,110,40,9,0,96,97,114,103,99,44,32,251,2,132,42,32,97,
+    114,103,118,91,93,169,1,128,117,110,115,105,103,110,101,100,136,3,0,121,
+    5,1,108,9,66,61,32,54,52,6,2,80,100,111,117,98,108,233,9,1,
+    91,9,83,32,61,32,53,46,104,1,1,221,0,0,253,0,5,174,6,36,
+    32,61,91,1,17,83,24,10,32,79,112,240,0,50,115,32,111,8,0,2,
+    81,0,3,13,0,17,46,110,5,5,49,0,0,193,9,1,169,0,32,105,
+    32,36,5,128,32,105,32,43,32,49,32,60,172,0,32,99,59,14,0,52,
+    61,32,50,178,0,0,90,1,3,87,2,0,128,1,3,138,7,96,102,108,
+    97,103,32,61,49,0,51,118,91,105,212,3,0,42,0,0,216,1,2,28,
+    0,57,61,32,34,82,10,26,34,237,1,3,45,4,3,0,1,1,222,0,
+    98,109,97,120,40,49,44,241,7,81,97,116,111,105,40,59,1,1,156,0,
+    20,93,138,1,0,100,0,16,101,252,4,11,105,0,3,49,5,11,101,0,
+    3,22,0,0,196,7,0,188,0,73,97,116,111,102,85,0,2,36,1,15,
+    84,0,5,0,52,1,11,81,0,0,19,0,1,78,0,7,247,3,0,90,
+    0,4,153,1,18,62,173,4,15,190,0,29,2,113,9,27,115,109,0,4,
+    188,1,3,30,0,11,120,0,4,74,2,15,115,0,36,0,94,3,63,101,
+    110,100,115,0,4,3,30,0,255,0,32,61,32,112,97,114,115,101,66,97,
+    99,107,101,110,100,60,1,9,2,58,9,0,75,1,0,4,0,1,208,1,
+    5,5,8,83,85,115,97,103,101,224,7,1,212,1,32,48,93,211,7,57,
+    34,32,91,34,2,48,32,78,93,18,0,4,181,1,17,83,14,0,1,114,
+    1,100,78,32,124,32,45,45,8,1,68,78,32,45,45,161,0,134,78,65,
+    77,69,93,92,110,34,202,1,0,127,0,3,155,3,3,254,7,0,18,0,
+    2,194,3,33,125,10,53,4,1,158,0,178,117,110,105,113,117,101,95,112,
+    116,114,60,64,3,34,62,32,173,10,2,75,0,0,96,2,1,124,0,57,
+    61,61,32,103,5,2,37,0,1,141,1,48,100,58,58,119,12,18,95,75,
+    0,4,71,0,19,40,184,1,3,39,4,0,126,0,2,52,0,33,45,62,
+    94,4,8,127,6,2,98,0,3,121,0,32,45,62,15,0,8,31,0,1,
+    169,0,65,99,111,117,116,47,1,2,167,0,3,72,1,4,83,0,3,21,
+    1,17,40,37,9,34,34,32,15,0,16,40,168,9,2,79,9,1,27,4,
+    35,45,62,48,1,3,39,0,17,44,239,10,2,113,9,0,116,0,0,95,
+    0,6,97,9,8,38,1,8,36,8,1,35,8,17,40,123,8,3,220,0,
+    1,160,0,3,35,0,5,144,2,3,208,9,20,40,65,6,1,37,0,8,
+    83,8,8,12,0,0,57,3,1,95,8,22,62,95,8,23,40,28,4,8,
+    105,0,8,56,0,2,232,0,49,62,32,99,234,8,18,115,180,1,2,167,
+    4,3,210,5,15,3,8,18,1,9,5,4,186,0,16,32,14,5,16,48,
+    0,5,24,60,159,5,88,59,32,43,43,105,14,5,5,168,6,97,91,105,
+    93,46,114,101,138,1,32,40,49,68,1,35,49,54,176,0,0,245,1,3,
+    155,0,130,46,101,109,112,108,97,99,101,208,6,122,91,38,44,32,105,93,
+    32,46,3,0,108,2,67,33,114,117,110,183,9,0,146,1,17,44,109,1,
+    22,44,21,1,74,91,105,93,41,66,5,0,100,0,34,43,43,61,11,2,
+    0,1,0,18,0,19,125,130,0,2,241,2,1,124,1,82,116,104,105,115,
+    95,49,1,178,58,58,115,108,101,101,112,95,102,111,114,170,4,4,20,7,
+    4,47,7,33,60,100,130,6,35,62,40,134,3,4,120,5,0,142,9,54,
+    32,61,32,173,9,1,58,1,3,95,0,0,46,14,19,38,139,1,35,32,
+    58,9,0,22,115,174,0,2,10,1,84,46,106,111,105,110,222,2,2,171,
+    1,2,109,0,97,32,101,108,97,112,115,167,8,1,81,0,15,148,0,6,
+    3,218,1,15,172,7,3,2,3,1,1,141,1,17,114,150,1,16,116,108,
+    0,6,240,3,8,62,2,5,118,2,66,32,97,108,108,57,0,1,208,0,
+    2,150,0,0,25,16,182,38,32,115,97,109,112,108,101,115,32,58,132,1,
+    6,210,0,176,97,108,108,46,105,110,115,101,114,116,40,11,0,0,28,5,
+    0,26,13,2,51,0,64,46,98,101,103,234,0,20,44,68,0,17,46,32,
+    0,3,153,1,1,227,0,35,115,111,58,0,5,43,0,5,71,0,3,39,
+    0,0,20,2,1,20,0,89,109,112,116,121,40,234,10,1,66,0,5,93,
+    5,36,78,111,126,12,48,32,99,111,179,0,57,116,101,100,17,5,10,13,
+    5,2,24,2,6,233,0,7,75,17,163,32,61,32,91,38,97,108,108,93,
+    40,152,1,24,112,246,2,2,51,0,1,124,0,160,115,105,122,101,95,116,
+    32,114,97,110,193,11,13,163,9,2,31,0,97,62,40,112,32,42,32,31,
+    1,0,17,0,211,40,41,32,45,32,49,41,32,43,32,48,46,53,228,0,
+    0,176,2,3,158,0,64,97,108,108,91,80,0,132,93,32,47,32,49,48,
+    48,48,247,8,39,125,59,179,5,4,10,5,1,133,0,80,102,105,120,101,
+    100,117,3,1,14,0,230,115,101,116,112,114,101,99,105,115,105,111,110,40,
+    49,169,1,0,99,0,16,32,38,0,7,84,4,0,15,0,23,34,226,3,
+    6,46,5,4,137,2,1,151,14,19,115,106,5,0,134,1,3,194,0,1,
+    24,0,4,149,18,49,44,32,34,94,2,2,99,0,0,6,0,32,60,60,
+    80,2,3,46,12,37,32,47,216,2,9,55,0,0,204,18,47,92,110,59,
+    0,0,18,34,88,4,161,121,32,117,115,58,32,112,53,48,32,193,5,6,
+    234,18,83,40,48,46,53,48,231,5,63,32,112,57,32,0,1,23,57,32,
+    0,31,57,159,0,1,9,78,0,38,57,57,78,0,63,57,46,57,112,0,
+    0,22,57,35,0,50,109,97,120,33,0,0,15,1,0,78,6,37,40,41,
+    171,1,0,81,1,6,63,6,0,186,2,2,150,4,43,32,62,59,7,0,
+    43,9,4,185,2,3,35,0,1,28,1,6,157,1,51,40,115,41,64,6,
+    15,196,2,14,3,58,2,16,48,127,11,0,247,17,35,112,114,97,103,109,
+    97,32,111,110,99,101,10,10,35,105,110,99,108,117,100,101,32,60,99,115,
+    116,100,100,101,102,62,19,0,104,109,101,109,111,114,121,18,0,240,66,118,
+    101,99,116,111,114,62,10,10,47,47,32,70,105,120,101,100,45,115,105,122,
+    101,32,73,47,79,32,98,117,102,102,101,114,115,32,114,101,99,121,99,108,
+    101,100,32,116,104,114,111,117,103,104,32,97,32,102,114,101,101,32,108,105,
+    115,116,44,32,115,111,32,97,32,98,117,115,121,32,115,101,114,118,101,114,
+    73,0,241,1,115,116,111,112,115,32,97,108,108,111,99,97,116,105,110,103,
+    155,0,240,33,32,105,116,32,104,97,115,32,115,101,101,110,32,105,116,115,
+    32,112,101,97,107,32,110,117,109,98,101,114,32,111,102,32,99,111,110,110,
+    101,99,116,105,111,110,115,46,32,79,110,101,73,0,240,9,112,111,111,108,
+    32,112,101,114,32,101,118,101,110,116,32,108,111,111,112,59,32,110,111,116,
+    139,0,241,2,101,97,100,45,115,97,102,101,46,10,99,108,97,115,115,32,
+    66,175,0,16,80,50,0,240,9,123,10,112,117,98,108,105,99,58,10,32,
+    32,32,32,47,47,32,82,101,116,117,114,110,115,119,0,177,101,108,102,32,
+    116,111,32,116,104,101,32,94,0,225,119,104,101,110,32,100,101,115,116,114,
+    111,121,101,100,49,0,8,80,0,33,32,123,19,0,8,80,0,0,84,0,
+    2,109,0,18,40,7,0,0,116,0,17,38,78,0,242,11,44,32,115,116,
+    100,58,58,117,110,105,113,117,101,95,112,116,114,60,99,104,97,114,91,93,
+    62,32,122,1,49,41,32,58,40,0,32,40,38,124,0,35,41,44,23,0,
+    17,40,54,0,83,109,111,118,101,40,40,0,65,41,32,123,125,121,0,13,
+    109,0,251,14,38,38,32,111,116,104,101,114,41,32,110,111,101,120,99,101,
+    112,116,32,61,32,100,101,102,97,117,108,116,59,51,0,179,38,32,111,112,
+    101,114,97,116,111,114,61,171,0,49,38,38,41,47,0,70,108,101,116,101,
+    46,0,18,126,200,0,35,40,41,238,0,0,117,0,0,4,0,52,105,102,
+    32,145,0,5,90,0,0,24,0,0,4,0,0,193,0,159,45,62,114,101,
+    108,101,97,115,101,193,0,0,6,94,0,37,125,10,61,0,0,14,1,96,
+    42,32,100,97,116,97,108,0,33,32,114,151,1,3,5,1,134,46,103,101,
+    116,40,41,59,32,248,0,1,22,1,0,143,2,48,95,116,32,7,0,32,
+    40,41,37,2,68,115,116,32,123,58,0,2,133,0,2,169,2,64,83,105,
+    122,101,62,0,1,109,0,114,112,114,105,118,97,116,101,1,2,0,175,0,
+    2,226,0,0,170,1,17,42,130,1,6,159,0,1,102,0,15,178,1,6,
+    2,40,0,34,125,59,196,0,135,101,120,112,108,105,99,105,116,109,2,2,
+    251,0,0,159,0,35,95,116,51,3,0,138,0,128,32,61,32,49,54,51,
+    56,52,242,1,6,160,0,22,40,11,0,1,226,1,1,172,0,2,155,0,
+    163,32,97,99,113,117,105,114,101,40,41,108,0,1,152,0,3,88,0,3,
+    75,3,46,101,100,3,1,5,27,0,128,67,111,117,110,116,59,32,125,240,
+    2,68,69,118,101,114,128,3,3,213,2,9,79,0,142,118,97,105,108,97,
+    98,108,101,79,0,0,218,3,80,76,105,115,116,46,122,0,2,143,1,25,
+    10,77,1,89,118,111,105,100,32,247,1,15,60,1,6,49,41,32,123,42,
+    4,1,80,0,146,112,117,115,104,95,98,97,99,107,49,1,9,237,2,5,
+    183,1,8,165,0,6,43,1,2,132,1,8,28,0,10,245,0,71,32,61,
+    32,48,36,0,2,211,4,17,60,48,0,14,156,0,21,62,147,0,80,59,
+    10,125,59,10,247,16,35,112,114,97,103,109,97,32,111,110,99,101,10,10,
+    35,105,110,99,108,117,100,101,32,60,97,116,111,109,105,99,62,18,0,153,
+    99,111,114,111,117,116,105,110,101,21,0,104,115,116,100,100,101,102,19,0,
+    104,109,101,109,111,114,121,18,0,119,115,116,114,105,110,103,62,95,0,240,
+    32,34,98,117,102,102,101,114,95,112,111,111,108,46,104,34,10,10,101,110,
+    117,109,32,99,108,97,115,115,32,66,97,99,107,101,110,100,32,123,10,32,
+    32,32,32,65,117,116,111,44,9,0,160,32,32,32,47,47,32,105,111,95,
+    117,77,0,241,28,32,119,104,101,110,32,116,104,101,32,107,101,114,110,101,
+    108,32,97,108,108,111,119,115,32,105,116,44,32,111,116,104,101,114,119,105,
+    115,101,32,101,112,111,108,108,71,0,48,73,111,85,55,0,17,44,13,0,
+    16,69,23,0,244,10,44,10,125,59,10,10,47,47,32,80,97,114,115,101,
+    115,32,34,97,117,116,111,34,44,32,34,99,0,97,34,32,111,114,32,34,
+    67,0,96,34,59,32,116,104,114,96,0,246,6,115,116,100,58,58,105,110,
+    118,97,108,105,100,95,97,114,103,117,109,101,110,116,114,0,20,10,189,0,
+    16,112,85,0,3,13,0,113,40,99,111,110,115,116,32,59,0,2,11,1,
+    114,38,32,110,97,109,101,41,128,0,245,8,79,110,101,32,115,111,99,107,
+    101,116,32,111,112,101,114,97,116,105,111,110,32,97,32,111,1,246,10,32,
+    105,115,32,115,117,115,112,101,110,100,101,100,32,111,110,46,32,80,101,110,
+    100,105,110,103,47,0,80,115,32,97,114,101,204,0,240,8,107,101,112,116,
+    32,105,110,32,97,110,32,105,110,116,114,117,115,105,118,101,32,108,105,126,
+    0,97,111,32,116,104,97,116,51,1,240,1,108,111,111,112,32,99,97,110,
+    32,100,101,115,116,114,111,121,21,0,38,105,114,114,0,16,115,75,0,1,
+    97,1,245,8,105,116,32,115,104,117,116,115,32,100,111,119,110,46,10,115,
+    116,114,117,99,116,32,79,167,0,2,164,1,7,189,1,32,75,105,186,1,
+    240,6,32,65,99,99,101,112,116,44,32,82,101,97,100,44,32,87,114,105,
+    116,101,32,111,1,0,201,1,1,35,0,81,107,105,110,100,59,141,1,83,
+    105,110,116,32,102,12,0,98,118,111,105,100,42,32,28,2,2,30,0,2,
+    53,1,194,105,122,101,95,116,32,108,101,110,103,116,104,24,0,0,54,0,
+    176,114,101,115,117,108,116,32,61,32,48,59,88,0,13,4,0,160,47,47,
+    32,65,115,32,102,114,111,109,225,0,144,32,115,121,115,99,97,108,108,44,
+    215,1,97,45,101,114,114,110,111,128,0,1,98,0,5,109,1,242,1,95,
+    104,97,110,100,108,101,60,62,32,119,97,105,116,101,114,110,0,5,241,0,
+    254,0,42,32,112,114,101,118,32,61,32,110,117,108,108,112,116,31,0,48,
+    110,101,120,146,0,5,31,0,0,245,0,240,0,47,47,32,83,105,110,103,
+    108,101,45,116,104,114,101,97,198,1,32,101,118,55,2,1,136,1,1,150,
+    1,0,203,0,55,109,101,115,131,1,5,225,2,35,105,114,30,2,0,149,
+    1,6,33,2,240,10,99,111,109,112,108,101,116,101,115,46,32,67,114,101,
+    97,116,101,32,111,110,101,32,112,101,114,170,2,160,101,97,100,32,119,105,
+    116,104,32,69,104,0,113,76,111,111,112,58,58,99,38,0,144,40,41,59,
+    32,101,118,101,114,121,78,0,5,246,0,48,32,117,115,80,2,33,97,32,
+    146,0,160,109,117,115,116,32,114,117,110,32,111,98,3,33,97,116,22,0,
+    35,39,115,89,0,64,46,10,47,47,61,0,0,111,1,0,134,1,48,99,
+    108,105,204,0,96,61,32,99,111,95,97,53,1,1,47,0,33,46,97,2,
+    2,16,40,124,2,100,101,110,101,114,41,59,52,0,34,115,115,206,1,44,
+    110,32,51,0,0,28,1,18,40,79,0,19,44,5,2,32,44,32,46,0,
+    1,61,0,0,64,0,17,82,242,1,64,115,32,102,111,238,3,8,214,1,
+    80,115,44,32,101,120,116,2,2,230,2,81,101,114,114,111,114,22,3,210,
+    32,114,101,116,117,114,110,101,100,32,97,115,32,247,1,34,46,10,105,4,
+    5,29,1,163,32,123,10,112,117,98,108,105,99,58,18,2,1,230,2,16,
+    65,205,0,67,97,98,108,101,138,4,0,241,0,5,20,0,21,40,61,0,
+    17,38,240,0,22,44,21,3,37,58,58,226,2,32,44,32,34,1,72,102,
+    100,44,32,218,2,19,44,11,4,2,8,1,2,214,2,17,41,122,0,0,
+    99,0,0,4,0,17,58,84,0,16,40,142,1,23,41,126,0,0,27,0,
+    5,2,2,16,46,67,3,48,32,61,32,7,0,2,166,2,0,31,0,0,
+    4,0,6,35,0,69,102,100,32,61,93,3,0,27,0,0,4,0,6,31,
+    0,2,105,3,35,32,61,109,1,15,70,0,5,2,162,0,41,32,61,129,
+    3,0,74,0,37,125,10,182,0,11,15,1,6,75,0,5,59,3,6,174,
+    4,22,59,55,0,81,98,111,111,108,32,54,2,16,95,254,1,66,121,40,
+    41,32,45,5,35,110,111,207,1,19,123,193,1,149,32,102,97,108,115,101,
+    59,32,125,115,0,7,60,0,3,31,5,31,40,204,3,11,15,75,1,7,
+    0,234,1,73,101,114,32,61,245,3,0,226,0,0,4,0,2,65,2,32,
+    32,33,142,1,117,46,115,116,97,114,116,40,67,1,33,41,59,150,6,19,
+    67,141,3,244,1,100,32,105,110,108,105,110,101,58,32,100,111,32,110,111,
+    116,184,5,5,180,0,6,190,0,0,25,2,4,249,0,79,115,117,109,101,
+    250,0,8,5,110,0,16,46,39,4,36,108,116,5,1,0,92,4,0,161,
+    0,71,47,47,32,84,158,6,129,114,117,110,116,105,109,101,95,4,3,5,
+    71,4,35,32,98,87,7,160,105,115,32,117,110,97,118,97,105,108,220,2,
+    1,154,0,98,115,116,97,116,105,99,150,2,181,117,110,105,113,117,101,95,
+    112,116,114,60,212,1,35,62,32,61,4,19,66,68,0,4,76,0,20,61,
+    173,7,32,58,58,168,7,0,209,6,0,145,0,149,118,105,114,116,117,97,
+    108,32,126,66,0,28,40,27,0,2,230,1,81,99,104,97,114,42,12,7,
+    5,255,0,0,206,5,2,32,2,1,215,0,97,101,32,102,100,115,32,146,
+    4,192,98,101,32,110,111,110,45,98,108,111,99,107,174,4,19,40,99,4,
+    19,41,34,2,26,115,31,0,2,83,7,18,115,89,3,5,184,3,19,32,
+    53,0,0,127,1,5,156,4,21,32,101,2,109,123,42,116,104,105,115,205,
+    3,36,58,58,209,6,4,52,0,20,44,2,6,68,44,32,48,125,145,1,
+    6,102,0,0,205,2,16,40,100,0,15,252,3,18,7,227,3,3,109,2,
+    15,136,0,6,2,81,7,0,86,0,2,189,3,19,44,149,3,18,125,114,
+    3,2,96,2,6,136,0,16,119,122,7,5,137,0,2,117,1,15,139,4,
+    14,15,143,0,24,1,218,7,32,44,32,144,0,1,93,0,97,95,99,97,
+    115,116,60,98,0,34,62,40,162,0,29,41,163,0,1,116,2,96,47,47,
+    32,82,117,110,140,2,160,116,105,108,32,115,116,111,112,40,41,234,8,0,
+    163,7,33,101,100,35,0,0,71,0,0,136,6,5,61,2,176,47,47,32,
+    83,97,102,101,32,116,111,32,39,0,2,219,7,32,97,110,192,8,0,113,
+    1,6,53,0,2,79,0,3,104,4,17,66,107,10,83,80,111,111,108,38,
+    233,4,54,115,40,41,243,1,2,166,0,0,31,0,0,199,1,162,10,112,
+    114,111,116,101,99,116,101,100,12,6,14,194,2,98,47,47,32,66,101,103,
+    100,9,5,154,3,21,59,132,2,208,116,114,117,101,32,105,102,32,105,116,
+    32,97,108,150,0,36,121,32,171,7,48,100,32,40,149,7,1,167,0,38,
+    47,47,16,5,3,215,3,98,32,115,101,116,41,44,232,4,0,66,0,4,
+    55,0,161,40,41,32,119,105,108,108,32,98,101,246,0,129,101,100,32,108,
+    97,116,101,114,71,0,4,106,3,1,12,5,2,156,4,5,113,5,22,38,
+    98,0,17,41,37,9,5,87,3,16,66,67,3,16,32,39,4,32,108,32,
+    223,7,65,101,97,115,116,63,8,5,208,0,5,180,0,16,115,46,9,48,
+    119,97,107,160,4,35,105,115,129,0,2,70,11,36,47,47,38,0,0,142,
+    3,16,119,93,10,49,105,115,32,243,0,9,156,0,1,199,1,0,114,11,
+    27,40,135,0,97,82,101,99,111,114,100,198,7,2,217,4,80,32,97,110,
+    100,32,11,0,33,109,101,22,0,0,151,5,0,92,0,5,168,8,2,88,
+    0,52,111,105,100,122,0,47,101,40,239,0,1,2,119,7,0,73,0,36,
+    108,116,121,4,0,78,4,64,114,97,99,107,27,11,6,231,0,1,125,9,
+    49,100,105,100,173,5,4,113,1,3,197,5,6,109,0,51,97,100,100,115,
+    11,15,111,0,2,7,99,0,160,67,97,108,108,115,32,102,117,110,99,198,
+    11,7,46,0,82,41,32,102,111,114,122,9,16,32,202,11,0,215,0,5,
+    135,0,64,44,32,111,108,139,11,97,32,102,105,114,115,116,120,0,64,116,
+    101,109,112,231,1,96,32,60,116,121,112,101,46,12,35,32,70,86,0,17,
+    62,33,0,1,86,1,116,102,111,114,69,97,99,104,157,0,4,34,0,5,
+    129,0,8,242,6,0,128,0,6,145,0,22,42,29,2,36,32,61,146,0,
+    16,46,190,10,23,59,26,0,67,33,61,32,38,174,0,8,23,0,22,61,
+    35,0,32,45,62,52,0,2,101,5,0,251,5,0,4,0,5,255,0,21,
+    42,226,0,20,41,159,4,1,188,0,70,47,47,32,68,122,12,8,245,10,
+    32,115,116,234,2,3,248,1,17,59,52,1,0,228,13,3,112,6,34,39,
+    115,178,12,85,117,99,116,111,114,133,2,80,97,102,116,101,114,112,3,49,
+    104,97,115,73,4,16,112,237,9,98,108,108,32,73,47,79,195,10,52,101,
+    105,114,250,3,1,128,0,1,60,1,0,113,1,52,114,111,121,60,1,7,
+    197,1,1,244,3,16,102,153,2,16,97,182,13,1,154,4,1,73,5,64,
+    115,32,116,111,10,14,21,101,77,7,1,153,6,0,31,3,19,32,225,2,
+    66,111,110,32,105,194,1,0,254,5,0,26,0,194,70,100,59,10,10,112,
+    114,105,118,97,116,101,84,4,1,166,8,2,96,15,16,60,185,3,18,62,
+    182,0,65,105,110,103,123,229,8,3,204,5,5,218,2,4,159,1,11,230,
+    12,0,14,5,32,101,110,145,15,64,108,32,111,102,50,14,113,105,114,99,
+    117,108,97,114,241,13,1,233,0,6,251,4,3,0,1,1,231,4,0,249,
+    14,0,247,17,35,112,114,97,103,109,97,32,111,110,99,101,10,10,35,105,
+    110,99,108,117,100,101,32,60,99,115,116,100,100,101,102,62,19,0,240,71,
+    115,116,114,105,110,103,95,118,105,101,119,62,10,10,47,47,32,74,117,115,
+    116,32,101,110,111,117,103,104,32,72,84,84,80,47,49,46,49,32,102,111,
+    114,32,97,32,107,101,101,112,45,97,108,105,118,101,32,115,101,114,118,105,
+    99,101,32,97,110,100,32,105,116,115,32,108,111,97,100,32,103,101,110,101,
+    114,97,116,111,114,58,73,0,241,34,114,101,113,117,101,115,116,115,32,97,
+    114,101,32,116,97,107,101,110,32,116,111,32,101,110,100,32,97,116,32,116,
+    104,101,32,98,108,97,110,107,32,108,105,110,101,32,97,102,116,101,114,21,
+    0,183,104,101,97,100,101,114,115,32,40,110,111,69,0,145,32,98,111,100,
+    105,101,115,41,44,113,0,99,101,118,101,114,121,32,96,0,81,32,103,101,
+    116,115,59,0,241,5,115,97,109,101,32,115,109,97,108,108,32,114,101,115,
+    112,111,110,115,101,46,211,0,53,84,104,101,18,0,81,32,115,101,110,116,
+    137,0,8,69,0,247,4,10,101,120,116,101,114,110,32,99,111,110,115,116,
+    32,115,116,100,58,58,25,1,1,8,1,161,95,82,69,83,80,79,78,83,
+    69,59,84,0,240,2,78,117,109,98,101,114,32,111,102,32,99,111,109,112,
+    108,101,116,99,0,4,241,0,2,224,0,80,115,116,97,114,116,34,0,144,
+    96,100,97,116,97,96,59,32,96,95,0,176,117,109,101,100,96,32,105,115,
+    32,115,101,136,0,0,229,0,1,13,1,49,121,116,101,199,0,192,121,32,
+    115,112,97,110,46,32,80,105,112,101,28,1,20,100,233,0,2,73,1,242,
+    7,99,111,117,110,116,101,100,32,105,110,100,105,118,105,100,117,97,108,108,
+    121,46,10,178,0,97,105,122,101,95,116,32,34,0,19,82,125,1,18,40,
+    26,0,6,229,1,16,32,140,0,19,44,227,0,1,49,0,17,38,246,0,
+    0,151,0,18,41,219,0,96,76,101,110,103,116,104,185,0,0,153,0,7,
+    223,0,2,84,1,4,191,1,11,223,0,36,32,40,187,1,64,112,108,117,
+    115,215,0,131,67,111,110,116,101,110,116,45,80,0,17,98,226,0,32,111,
+    102,204,1,242,2,121,41,44,32,111,114,32,48,32,105,102,32,109,111,114,
+    101,32,29,0,0,42,2,105,110,101,101,100,101,100,210,0,4,206,1,2,
+    73,0,15,211,0,3,48,41,59,10,247,17,35,112,114,97,103,109,97,32,
+    111,110,99,101,10,10,35,105,110,99,108,117,100,101,32,60,99,115,116,100,
+    105,110,116,62,19,0,104,109,101,109,111,114,121,18,0,104,115,116,114,105,
+    110,103,18,0,104,116,104,114,101,97,100,18,0,119,118,101,99,116,111,114,
+    62,92,0,242,33,34,101,118,101,110,116,95,108,111,111,112,46,104,34,10,
+    10,115,116,114,117,99,116,32,83,101,114,118,101,114,79,112,116,105,111,110,
+    115,32,123,10,32,32,32,32,115,116,100,58,58,102,0,246,5,32,104,111,
+    115,116,32,61,32,34,49,50,55,46,48,46,48,46,49,34,59,36,0,192,
+    117,105,110,116,49,54,95,116,32,112,111,114,38,0,80,56,48,56,48,59,
+    66,0,241,4,32,32,47,47,32,48,32,112,105,99,107,115,32,97,32,102,
+    114,101,101,36,0,83,59,32,115,101,101,116,0,32,58,58,54,0,33,40,
+    41,79,0,146,117,110,115,105,103,110,101,100,32,203,0,68,115,32,61,32,
+    74,0,1,80,0,240,11,47,47,32,83,104,97,114,100,115,59,32,48,32,
+    117,115,101,115,32,111,110,101,32,112,101,114,32,22,0,67,119,97,114,101,
+    58,0,1,78,0,147,66,97,99,107,101,110,100,32,98,8,0,35,61,32,
+    18,0,240,25,58,58,65,117,116,111,59,10,125,59,10,10,47,47,32,75,
+    101,101,112,45,97,108,105,118,101,32,72,84,84,80,32,115,101,114,118,105,
+    99,101,32,115,85,0,147,101,100,32,97,99,114,111,115,115,90,0,114,115,
+    46,32,69,97,99,104,29,0,65,32,111,119,110,132,0,0,71,0,2,180,
+    0,81,32,40,112,105,110,195,0,224,111,32,97,32,99,111,114,101,41,44,
+    32,105,116,115,43,0,242,13,32,83,79,95,82,69,85,83,69,80,79,82,
+    84,32,108,105,115,116,101,110,101,114,32,111,110,32,116,104,111,0,32,101,
+    100,74,0,0,18,1,69,32,97,110,100,56,0,16,69,181,1,65,76,111,
+    111,112,22,0,240,7,98,117,102,102,101,114,115,46,32,84,104,101,32,107,
+    101,114,110,101,108,32,115,112,252,1,160,115,32,105,110,99,111,109,105,110,
+    103,71,0,98,99,111,110,110,101,99,211,1,5,196,0,21,101,120,0,82,
+    115,44,32,115,111,200,0,113,115,32,110,101,118,101,114,13,0,243,8,101,
+    32,115,116,97,116,101,32,111,114,32,108,111,99,107,115,46,10,99,108,97,
+    115,115,175,1,161,32,123,10,112,117,98,108,105,99,58,99,1,116,101,120,
+    112,108,105,99,105,65,2,26,40,72,2,18,111,80,2,18,41,44,2,18,
+    126,29,0,65,40,41,59,10,60,0,3,15,0,68,99,111,110,115,64,0,
+    178,38,41,32,61,32,100,101,108,101,116,101,52,0,2,36,0,207,38,32,
+    111,112,101,114,97,116,111,114,61,40,47,0,6,1,84,0,112,47,47,32,
+    66,105,110,100,173,1,7,233,0,1,54,1,82,115,116,97,114,116,25,0,
+    1,217,1,6,208,1,100,84,104,114,111,119,115,64,0,16,115,247,2,242,
+    2,114,117,110,116,105,109,101,95,101,114,114,111,114,32,119,104,101,163,1,
+    112,97,100,100,114,101,115,115,28,1,0,178,1,4,89,2,241,0,105,115,
+    32,117,110,97,118,97,105,108,97,98,108,101,46,74,0,64,118,111,105,100,
+    74,1,37,114,116,241,0,119,47,47,32,83,116,111,112,132,0,17,115,154,
+    0,48,99,108,111,203,2,0,130,1,38,121,32,181,1,248,5,59,32,115,
+    97,102,101,32,116,111,32,99,97,108,108,32,116,119,105,99,101,91,0,37,
+    111,112,90,0,1,180,0,9,135,3,32,40,41,74,0,241,9,115,116,32,
+    123,32,114,101,116,117,114,110,32,98,111,117,110,100,80,111,114,116,59,32,
+    125,71,0,12,109,3,14,51,0,0,9,2,132,105,99,95,99,97,115,116,
+    60,46,0,33,62,40,62,1,148,115,46,115,105,122,101,40,41,41,78,0,
+    2,152,1,84,99,104,97,114,42,113,3,4,81,0,162,59,10,10,112,114,
+    105,118,97,116,101,53,2,4,116,4,0,95,3,3,108,4,0,222,3,2,
+    197,0,165,110,105,113,117,101,95,112,116,114,60,245,2,32,62,32,175,4,
+    2,17,2,0,41,0,53,105,110,116,197,2,86,32,61,32,45,49,27,0,
+    1,68,0,3,137,3,2,7,0,2,28,0,0,234,3,0,59,0,2,80,
+    2,4,232,4,3,160,2,2,35,0,1,59,0,5,68,1,5,46,1,1,
+    131,4,1,48,1,1,33,0,2,82,5,17,60,134,4,17,62,48,3,33,
+    100,115,73,4,0,247,19,35,112,114,97,103,109,97,32,111,110,99,101,10,
+    10,35,105,110,99,108,117,100,101,32,60,99,111,114,111,117,116,105,110,101,
+    62,21,0,245,16,101,120,99,101,112,116,105,111,110,62,10,10,47,47,32,
+    70,105,114,101,45,97,110,100,45,102,111,114,103,101,116,32,52,0,240,12,
+    58,32,105,116,32,115,116,97,114,116,115,32,114,117,110,110,105,110,103,32,
+    97,115,32,115,111,111,110,8,0,240,1,105,116,32,105,115,32,99,97,108,
+    108,101,100,32,97,110,100,76,0,240,9,102,114,101,101,115,32,105,116,115,
+    32,111,119,110,32,102,114,97,109,101,32,119,104,101,110,74,0,240,1,102,
+    105,110,105,115,104,101,115,46,32,84,104,101,32,97,99,133,0,80,32,108,
+    111,111,112,61,0,96,32,101,118,101,114,121,67,0,96,99,111,110,110,101,
+    99,159,0,240,4,32,97,114,101,32,111,110,101,32,101,97,99,104,59,32,
+    110,111,116,104,131,0,32,119,97,96,0,241,5,102,111,114,32,116,104,101,
+    109,46,32,65,32,84,97,115,107,32,116,104,97,145,0,80,115,116,105,108,
+    108,73,0,148,115,117,115,112,101,110,100,101,100,130,0,128,115,32,69,118,
+    101,110,116,76,115,0,192,105,115,32,100,101,115,116,114,111,121,101,100,199,
+    0,6,13,0,32,98,121,88,0,1,153,0,130,46,10,115,116,114,117,99,
+    116,97,0,99,123,10,32,32,32,32,18,0,210,112,114,111,109,105,115,101,
+    95,116,121,112,101,32,26,0,0,30,0,1,138,0,242,7,103,101,116,95,
+    114,101,116,117,114,110,95,111,98,106,101,99,116,40,41,32,123,32,18,0,
+    97,32,123,125,59,32,125,74,0,0,48,0,83,115,116,100,58,58,169,0,
+    32,95,110,4,1,147,32,105,110,105,116,105,97,108,95,22,0,82,40,41,
+    32,110,111,178,1,15,69,0,24,63,102,105,110,67,0,26,67,118,111,105,
+    100,162,0,16,95,12,0,0,178,0,6,166,0,0,18,0,178,32,117,110,
+    104,97,110,100,108,101,100,95,142,0,48,105,111,110,38,0,17,32,195,0,
+    180,116,101,114,109,105,110,97,116,101,40,41,223,0,96,125,59,10,125,59,
+    10,241,12,35,105,110,99,108,117,100,101,32,34,98,117,102,102,101,114,95,
+    112,111,111,108,46,104,34,10,10,66,16,0,98,80,111,111,108,58,58,12,
+    0,18,32,7,0,2,19,0,244,21,97,99,113,117,105,114,101,40,41,32,
+    123,10,32,32,32,32,105,102,32,40,102,114,101,101,76,105,115,116,46,101,
+    109,112,116,121,40,41,28,0,0,32,0,241,2,43,43,97,108,108,111,99,
+    97,116,101,100,67,111,117,110,116,59,54,0,0,26,0,99,114,101,116,117,
+    114,110,93,0,242,32,40,42,116,104,105,115,44,32,115,116,100,58,58,109,
+    97,107,101,95,117,110,105,113,117,101,95,102,111,114,95,111,118,101,114,119,
+    114,105,116,101,60,99,104,97,114,91,93,62,40,181,0,98,83,105,122,101,
+    41,41,82,0,17,125,88,0,1,63,0,3,58,0,52,112,116,114,48,0,
+    147,32,109,101,109,111,114,121,32,61,96,0,54,111,118,101,181,0,84,98,
+    97,99,107,40,71,0,5,203,0,66,112,111,112,95,26,0,2,96,0,15,
+    174,0,8,0,78,0,2,97,0,0,70,0,32,125,10,245,10,35,105,110,
+    99,108,117,100,101,32,34,101,118,101,110,116,95,108,111,111,112,46,104,34,
+    10,10,25,0,135,60,99,101,114,114,110,111,62,18,0,153,115,116,100,101,
+    120,99,101,112,116,21,0,172,121,115,47,101,112,111,108,108,46,104,23,0,
+    106,115,111,99,107,101,116,24,0,96,117,110,105,115,116,100,20,0,240,69,
+    10,110,97,109,101,115,112,97,99,101,32,123,10,10,47,47,32,82,101,97,
+    100,105,110,101,115,115,45,98,97,115,101,100,32,98,97,99,107,101,110,100,
+    58,32,116,114,121,32,116,104,101,32,115,121,115,99,97,108,108,32,115,116,
+    114,97,105,103,104,116,32,97,119,97,121,44,32,97,110,100,32,111,110,108,
+    121,32,105,102,39,0,0,75,0,2,122,0,241,8,32,105,115,32,110,111,
+    116,32,114,101,97,100,121,32,119,97,105,116,32,102,111,114,32,174,0,209,
+    32,116,111,32,114,101,112,111,114,116,32,105,116,67,0,0,102,0,183,97,
+    103,97,105,110,46,32,69,97,99,104,71,0,240,52,104,97,115,32,97,116,
+    32,109,111,115,116,32,111,110,101,32,111,112,101,114,97,116,105,111,110,32,
+    112,101,110,100,105,110,103,44,32,97,114,109,101,100,32,119,105,116,104,32,
+    69,80,79,76,76,79,78,69,83,72,79,84,46,10,99,108,97,115,115,32,
+    69,33,1,240,0,76,111,111,112,32,58,32,112,117,98,108,105,99,32,69,
+    120,1,1,19,0,34,123,10,19,0,86,58,10,32,32,32,43,0,66,40,
+    41,32,58,172,0,49,70,100,40,180,0,145,95,99,114,101,97,116,101,49,
+    40,99,0,193,95,67,76,79,69,88,69,67,41,41,32,123,58,0,0,62,
+    0,50,105,102,32,44,0,117,70,100,32,60,32,48,41,25,0,0,29,0,
+    249,11,116,104,114,111,119,32,115,116,100,58,58,114,117,110,116,105,109,101,
+    95,101,114,114,111,114,40,34,95,0,165,32,102,97,105,108,101,100,34,41,
+    59,62,0,2,32,0,1,43,2,18,32,6,0,71,61,32,123,125,32,0,
+    0,205,0,17,46,26,0,50,115,32,61,3,1,44,73,78,32,0,247,3,
+    100,97,116,97,46,112,116,114,32,61,32,110,117,108,108,112,116,114,34,0,
+    0,34,1,68,95,99,116,108,191,0,18,44,70,0,241,4,95,67,84,76,
+    95,65,68,68,44,32,119,97,107,101,70,100,44,32,38,103,0,3,157,0,
+    33,125,10,164,0,21,126,97,1,160,40,41,32,111,118,101,114,114,105,100,
+    87,2,0,246,0,0,4,0,130,100,101,115,116,114,111,121,80,175,1,19,
+    40,61,0,0,26,0,84,99,108,111,115,101,116,0,3,24,0,3,85,0,
+    192,99,111,110,115,116,32,99,104,97,114,42,32,172,2,50,40,41,32,19,
+    0,6,97,0,130,32,114,101,116,117,114,110,32,65,1,242,0,34,59,32,
+    125,10,10,112,114,111,116,101,99,116,101,100,208,1,48,98,111,111,178,2,
+    84,97,114,116,40,79,56,2,22,38,67,2,15,175,0,2,2,103,0,32,
+    105,110,187,2,245,0,115,117,108,116,32,61,32,112,101,114,102,111,114,109,
+    40,124,2,3,172,0,0,196,0,0,245,1,33,114,101,41,0,232,33,61,
+    32,45,69,65,71,65,73,78,32,38,38,32,21,0,168,87,79,85,76,68,
+    66,76,79,67,75,48,2,0,63,0,5,83,0,19,46,48,0,19,61,57,
+    0,6,158,1,0,39,0,3,235,0,70,116,114,117,101,25,0,17,125,127,
+    1,0,31,0,31,97,157,0,4,52,97,100,100,119,1,5,105,0,7,188,
+    0,3,86,0,67,102,97,108,115,87,0,3,126,1,80,118,111,105,100,32,
+    21,2,15,210,1,3,13,146,2,102,115,91,49,50,56,93,154,0,6,68,
+    1,64,99,111,117,110,67,1,2,51,0,0,7,4,4,240,1,18,44,205,
+    2,167,115,44,32,49,50,56,44,32,45,49,153,0,0,42,4,16,40,131,
+    1,177,105,32,61,32,48,59,32,105,32,60,32,74,0,92,59,32,43,43,
+    105,68,1,86,97,117,116,111,42,214,1,245,0,32,61,32,115,116,97,116,
+    105,99,95,99,97,115,116,60,249,1,49,42,62,40,190,2,84,115,91,105,
+    93,46,15,3,7,117,0,0,73,1,0,206,1,22,33,43,1,7,221,3,
+    0,30,0,0,4,0,1,194,3,200,117,105,110,116,54,52,95,116,32,118,
+    97,108,146,1,0,33,0,0,4,0,240,22,91,91,109,97,121,98,101,95,
+    117,110,117,115,101,100,93,93,32,115,115,105,122,101,95,116,32,100,114,97,
+    105,110,101,100,32,61,32,58,58,26,5,21,40,89,3,1,74,0,32,44,
+    32,40,0,34,111,102,88,0,11,156,0,0,89,0,108,99,111,110,116,105,
+    110,115,0,6,9,2,3,36,0,48,115,116,32,62,1,5,83,2,4,193,
+    2,22,42,219,0,6,173,1,0,52,0,0,248,0,4,46,0,6,198,2,
+    35,124,124,141,2,32,32,61,21,0,7,198,2,5,122,2,0,61,0,0,
+    4,0,0,130,2,8,94,0,0,20,0,177,47,47,32,83,112,117,114,105,
+    111,117,115,65,4,41,117,112,55,0,73,101,108,115,101,17,0,0,52,0,
+    150,99,111,109,112,108,101,116,101,40,77,0,19,44,133,0,7,15,1,2,
+    241,0,1,240,3,82,105,118,97,116,101,238,3,2,246,1,1,250,0,4,
+    241,0,5,253,1,9,246,3,6,179,5,4,152,1,4,252,0,38,32,48,
+    24,1,118,115,119,105,116,99,104,32,246,3,88,46,107,105,110,100,125,2,
+    85,99,97,115,101,32,99,0,160,58,58,75,105,110,100,58,58,65,99,167,
+    7,2,147,0,0,211,0,0,4,0,5,96,0,17,97,29,0,23,52,85,
+    0,52,102,100,44,146,5,7,9,0,129,83,79,67,75,95,78,79,78,53,
+    4,49,32,124,32,16,0,4,117,6,6,164,0,0,92,0,86,98,114,101,
+    97,107,19,0,15,149,0,3,0,224,7,15,147,0,4,75,114,101,99,118,
+    144,0,5,39,2,134,46,98,117,102,102,101,114,44,94,3,167,46,108,101,
+    110,103,116,104,44,32,48,144,1,15,135,0,22,52,87,114,105,174,1,0,
+    52,0,0,4,0,5,27,1,79,115,101,110,100,136,0,32,207,77,83,71,
+    95,78,79,83,73,71,78,65,76,147,0,11,2,54,2,2,116,0,1,58,
+    6,3,123,0,113,60,32,48,32,63,32,45,115,9,41,32,58,61,4,82,
+    105,110,116,62,40,39,0,3,92,0,8,34,5,0,245,2,5,255,1,15,
+    98,2,4,2,249,4,1,121,4,2,241,4,31,32,190,7,10,7,1,1,
+    0,110,2,0,121,3,5,98,0,4,97,2,1,69,1,34,32,63,164,7,
+    82,79,85,84,32,58,11,0,82,73,78,41,32,124,11,0,18,79,3,9,
+    6,22,2,1,129,0,5,246,4,69,32,61,32,38,228,1,6,37,0,86,
+    47,47,32,65,32,191,9,144,114,101,103,105,115,116,101,114,101,227,9,161,
+    32,105,116,115,32,102,105,114,115,116,205,9,32,59,32,189,7,48,105,110,
+    103,194,9,36,117,110,43,0,69,115,32,105,116,212,3,0,85,4,2,255,
+    0,15,91,8,4,56,77,79,68,90,2,0,10,3,3,97,8,0,64,9,
+    0,69,7,2,148,1,154,61,61,32,69,78,79,69,78,84,83,9,15,92,
+    0,10,1,183,8,5,228,0,23,46,92,0,2,240,0,3,200,1,0,39,
+    5,1,72,0,193,70,100,59,10,125,59,10,10,125,32,47,47,114,8,16,
+    115,30,11,34,10,10,240,5,165,110,105,113,117,101,95,112,116,114,60,59,
+    10,34,62,32,18,10,8,254,8,2,89,4,3,87,7,1,58,0,48,109,
+    97,107,7,6,0,63,0,21,60,42,0,16,62,5,9,32,125,10,245,10,
+    35,105,110,99,108,117,100,101,32,34,101,118,101,110,116,95,108,111,111,112,
+    46,104,34,10,10,25,0,184,60,115,116,100,101,120,99,101,112,116,62,21,
+    0,49,121,115,47,50,0,72,102,100,46,104,25,0,81,117,110,105,115,116,
+    20,0,242,19,10,47,47,32,68,101,102,105,110,101,100,32,98,121,32,116,
+    104,101,32,98,97,99,107,101,110,100,115,32,40,101,112,111,108,108,110,0,
+    165,99,112,112,44,32,117,114,105,110,103,16,0,160,41,46,32,99,114,101,
+    97,116,101,85,23,0,64,76,111,111,112,77,0,241,15,116,104,114,111,119,
+    115,32,115,116,100,58,58,114,117,110,116,105,109,101,95,101,114,114,111,114,
+    32,119,104,101,110,97,0,241,3,107,101,114,110,101,108,32,114,101,102,117,
+    115,101,115,32,105,111,95,89,0,33,46,10,53,0,192,117,110,105,113,117,
+    101,95,112,116,114,60,69,238,0,0,89,0,19,62,106,0,16,69,145,0,
+    0,17,0,63,40,41,59,46,0,15,5,152,0,0,46,0,34,10,66,215,
+    0,99,32,112,97,114,115,101,13,0,98,40,99,111,110,115,116,173,0,32,
+    115,116,199,0,240,3,38,32,110,97,109,101,41,32,123,10,32,32,32,32,
+    105,102,32,40,16,0,177,32,61,61,32,34,97,117,116,111,34,41,24,0,
+    0,28,0,115,114,101,116,117,114,110,32,74,0,113,58,58,65,117,116,111,
+    59,30,0,9,54,0,4,222,0,15,58,0,8,33,73,111,170,0,15,61,
+    0,0,1,129,1,15,58,0,8,1,16,1,2,56,0,1,120,1,2,202,
+    0,244,10,105,110,118,97,108,105,100,95,97,114,103,117,109,101,110,116,40,
+    34,85,110,107,110,111,119,110,219,1,81,32,39,34,32,43,233,0,240,1,
+    32,43,32,34,39,32,40,101,120,112,101,99,116,101,100,32,228,0,21,44,
+    146,1,65,32,111,114,32,131,0,127,41,34,41,59,10,125,10,115,1,9,
+    5,172,1,34,58,58,22,2,19,40,26,1,4,117,0,4,84,1,131,115,
+    119,105,116,99,104,32,40,103,2,4,23,0,70,99,97,115,101,77,1,3,
+    19,1,17,58,80,1,7,110,1,2,91,0,1,47,1,4,7,2,0,30,
+    0,10,61,0,1,22,1,15,59,0,4,1,28,0,15,59,0,7,0,197,
+    1,6,58,0,82,98,114,101,97,107,95,1,17,125,138,0,38,47,47,28,
+    1,247,7,99,97,110,32,98,101,32,99,111,109,112,105,108,101,100,32,111,
+    117,116,32,111,102,225,2,112,44,32,100,105,115,97,98,28,0,196,98,121,
+    32,115,121,115,99,116,108,32,111,114,73,0,82,98,108,111,99,107,118,3,
+    48,115,101,99,71,0,225,32,105,110,32,99,111,110,116,97,105,110,101,114,
+    115,40,0,51,116,114,121,139,2,0,231,0,3,115,2,15,5,1,4,65,
+    125,32,99,97,90,1,7,213,2,9,130,3,20,38,108,1,13,76,0,13,
+    22,1,16,125,238,1,7,211,1,5,11,0,195,40,41,32,58,32,119,97,
+    107,101,70,100,40,91,4,241,3,40,48,44,32,69,70,68,95,78,79,78,
+    66,76,79,67,75,32,124,15,0,132,67,76,79,69,88,69,67,41,117,0,
+    0,22,3,2,57,0,70,32,60,32,48,72,3,7,185,2,9,174,0,18,
+    40,237,4,80,102,100,32,102,97,97,1,0,131,2,0,185,0,244,0,112,
+    101,110,100,105,110,103,46,112,114,101,118,32,61,32,15,0,131,110,101,120,
+    116,32,61,32,38,16,0,1,175,2,5,182,0,53,58,58,126,12,0,20,
+    40,145,0,98,99,108,111,115,101,40,147,0,2,223,2,85,118,111,105,100,
+    32,41,0,1,192,4,5,46,0,208,119,104,105,108,101,32,40,33,115,116,
+    111,112,112,128,0,81,108,111,97,100,40,178,4,246,6,109,101,109,111,114,
+    121,95,111,114,100,101,114,95,97,99,113,117,105,114,101,41,225,0,0,180,
+    4,0,130,4,60,125,10,10,97,0,0,77,0,5,98,0,0,13,0,1,
+    90,0,178,115,116,111,114,101,40,116,114,117,101,44,209,3,9,97,0,130,
+    114,101,108,101,97,115,101,41,152,2,7,236,1,242,1,117,105,110,116,54,
+    52,95,116,32,111,110,101,32,61,32,49,33,0,240,22,91,91,109,97,121,
+    98,101,95,117,110,117,115,101,100,93,93,32,115,115,105,122,101,95,116,32,
+    119,114,105,116,116,101,110,32,61,32,58,58,12,0,4,11,1,80,44,32,
+    38,111,110,122,0,80,105,122,101,111,102,77,0,15,29,1,3,66,97,100,
+    100,80,139,1,212,40,79,112,101,114,97,116,105,111,110,38,32,111,11,0,
+    4,102,1,5,17,0,12,177,1,0,192,1,2,163,0,6,35,0,13,197,
+    1,12,241,1,36,45,62,35,0,5,53,0,2,68,0,3,247,1,4,101,
+    0,23,38,31,0,15,120,1,0,0,110,3,79,108,101,116,101,186,0,2,
+    196,44,32,105,110,116,32,114,101,115,117,108,116,198,0,0,189,2,5,83,
+    0,1,101,0,4,26,0,0,162,0,10,26,0,5,164,0,6,23,0,0,
+    181,0,2,168,0,10,47,0,0,24,0,32,45,62,10,1,38,32,61,59,
+    1,1,96,0,15,47,0,1,13,41,0,0,64,0,162,32,61,32,110,117,
+    108,108,112,116,114,51,0,2,170,4,6,124,0,2,201,0,35,32,61,210,
+    0,2,37,0,6,31,0,112,119,97,105,116,101,114,46,38,0,47,109,101,
+    167,2,4,116,100,101,115,116,114,111,121,239,1,4,251,0,1,59,8,1,
+    26,0,243,7,105,110,103,32,97,32,99,111,114,111,117,116,105,110,101,32,
+    102,114,97,109,101,32,55,0,17,115,20,5,5,36,2,225,32,105,110,115,
+    105,100,101,32,105,116,44,32,115,111,230,4,224,47,47,32,117,110,108,105,
+    110,107,32,101,97,99,104,115,2,97,32,102,105,114,115,116,29,0,3,121,
+    3,4,225,1,1,243,0,22,33,233,3,4,141,0,0,89,1,5,100,0,
+    7,136,2,72,32,61,32,42,60,0,2,0,1,0,46,0,8,22,0,9,
+    127,1,0,99,0,6,39,0,6,43,1,0,24,0,5,174,1,6,105,4,
+    0,76,0,0,4,0,6,41,0,15,168,1,18,10,51,0,3,135,1,3,
+    51,1,0,136,1,0,32,0,0,135,5,0,245,4,35,105,110,99,108,117,
+    100,101,32,34,104,116,116,112,46,104,34,10,10,19,0,240,40,60,99,115,
+    116,100,108,105,98,62,10,10,99,111,110,115,116,32,115,116,100,58,58,115,
+    116,114,105,110,103,95,118,105,101,119,32,72,84,84,80,95,82,69,83,80,
+    79,78,83,69,32,61,10,32,32,32,32,34,21,0,242,1,47,49,46,49,
+    32,50,48,48,32,79,75,92,114,92,110,34,26,0,255,9,67,111,110,116,
+    101,110,116,45,84,121,112,101,58,32,116,101,120,116,47,112,108,97,105,110,
+    35,0,0,167,76,101,110,103,116,104,58,32,49,51,29,0,7,11,0,242,
+    3,72,101,108,108,111,44,32,119,111,114,108,100,92,110,34,59,10,10,157,
+    0,242,5,105,122,101,95,116,32,99,111,117,110,116,82,101,113,117,101,115,
+    116,115,40,26,0,7,183,0,83,100,97,116,97,44,206,0,1,49,0,32,
+    38,32,225,0,113,117,109,101,100,41,32,123,172,0,2,52,0,1,29,0,
+    2,78,0,81,32,61,32,48,59,27,0,4,43,0,6,18,0,67,102,111,
+    114,32,102,0,2,50,0,192,101,110,100,59,32,40,101,110,100,32,61,32,
+    109,0,112,46,102,105,110,100,40,34,192,0,0,4,0,38,34,44,112,0,
+    67,41,32,33,61,139,0,6,162,0,116,58,58,110,112,111,115,59,141,0,
+    0,87,1,7,118,0,0,88,0,50,43,32,52,142,0,0,28,0,33,43,
+    43,241,0,2,17,0,17,125,165,0,98,114,101,116,117,114,110,187,0,58,
+    59,10,125,31,1,130,114,101,115,112,111,110,115,101,101,1,3,186,0,6,
+    126,0,1,179,0,4,124,0,0,120,0,4,250,1,2,221,0,127,104,101,
+    97,100,101,114,69,221,0,6,18,41,136,0,71,105,102,32,40,43,0,15,
+    229,0,5,17,41,175,0,0,198,0,3,179,0,3,102,1,8,129,1,70,
+    98,111,100,121,110,1,8,146,0,7,181,0,2,108,0,20,115,114,1,162,
+    115,117,98,115,116,114,40,48,44,32,25,0,51,69,110,100,153,0,8,64,
+    0,2,210,0,64,102,105,101,108,171,1,2,42,0,19,115,174,1,4,174,
+    2,2,38,1,35,58,34,63,0,0,216,0,2,49,0,15,185,1,6,6,
+    212,0,3,186,0,2,205,0,99,116,114,116,111,117,108,21,1,32,115,46,
+    25,2,82,40,41,32,43,32,78,0,243,2,43,32,49,53,44,32,110,117,
+    108,108,112,116,114,44,32,49,48,112,0,14,175,0,118,116,111,116,97,108,
+    32,61,217,0,112,32,43,32,52,32,43,32,109,0,2,124,1,3,75,1,
+    0,98,0,178,46,115,105,122,101,40,41,32,62,61,32,56,0,19,63,8,
+    0,16,58,208,2,32,125,10,248,4,35,105,110,99,108,117,100,101,32,60,
+    99,115,105,103,110,97,108,62,10,19,0,91,116,100,108,105,98,19,0,72,
+    114,105,110,103,19,0,152,101,120,99,101,112,116,105,111,110,21,0,166,105,
+    111,115,116,114,101,97,109,62,10,80,0,241,61,34,115,101,114,118,101,114,
+    46,104,34,10,10,115,116,97,116,105,99,32,118,111,105,100,32,112,114,105,
+    110,116,85,115,97,103,101,40,99,111,110,115,116,32,99,104,97,114,42,32,
+    112,114,111,103,114,97,109,41,32,123,10,32,32,32,32,115,116,100,58,58,
+    99,111,117,116,32,60,60,32,34,47,0,48,58,32,34,13,0,3,41,0,
+    0,11,0,240,0,34,32,91,45,45,104,111,115,116,32,65,68,68,82,93,
+    14,0,97,112,111,114,116,32,78,11,0,115,116,104,114,101,97,100,115,14,
+    0,241,1,98,97,99,107,101,110,100,32,78,65,77,69,93,92,110,34,102,
+    0,0,106,0,2,4,0,0,102,0,39,32,32,78,0,1,23,0,255,30,
+    73,80,118,52,32,97,100,100,114,101,115,115,32,116,111,32,108,105,115,116,
+    101,110,32,111,110,32,40,100,101,102,97,117,108,116,32,49,50,55,46,48,
+    46,48,46,49,41,85,0,7,2,149,0,1,82,0,64,32,32,32,80,163,
+    0,5,64,0,255,9,56,48,56,48,59,32,48,32,112,105,99,107,115,32,
+    97,32,102,114,101,101,32,111,110,101,79,0,8,5,217,0,1,82,0,112,
+    83,104,97,114,100,115,44,52,0,242,1,32,101,118,101,110,116,32,108,111,
+    111,112,32,112,101,114,32,41,0,5,172,0,17,58,36,0,0,25,0,63,
+    99,111,114,97,0,9,8,44,1,192,32,32,97,117,116,111,44,32,105,111,
+    95,117,12,2,149,32,111,114,32,101,112,111,108,108,87,0,1,33,0,0,
+    175,0,224,59,10,125,10,10,105,110,116,32,109,97,105,110,40,9,0,83,
+    97,114,103,99,44,225,1,100,97,114,103,118,91,93,224,1,17,83,29,2,
+    17,79,74,2,50,115,32,111,8,0,17,59,149,1,51,116,114,121,5,2,
+    0,224,0,65,102,111,114,32,76,0,176,105,32,61,32,49,59,32,105,32,
+    60,32,87,0,84,59,32,43,43,105,78,0,0,41,0,0,4,0,2,81,
+    2,244,6,98,111,111,108,32,104,97,115,86,97,108,117,101,32,61,32,105,
+    32,43,32,49,55,0,1,99,0,0,44,0,0,4,0,65,105,102,32,40,
+    106,2,113,115,116,114,99,109,112,40,164,0,82,105,93,44,32,34,10,2,
+    165,34,41,32,61,61,32,48,32,38,38,80,0,12,115,0,0,71,0,3,
+    191,0,17,46,139,2,16,61,159,0,98,118,91,43,43,105,93,208,0,0,
+    34,0,0,4,0,127,125,32,101,108,115,101,32,116,0,9,0,41,2,15,
+    116,0,28,0,51,0,50,32,61,32,98,3,97,95,99,97,115,116,60,210,
+    0,146,117,105,110,116,49,54,95,116,62,225,0,66,97,116,111,105,223,0,
+    0,153,0,47,41,41,155,0,30,2,76,2,31,115,158,0,28,3,54,0,
+    11,161,0,143,117,110,115,105,103,110,101,100,156,0,53,3,176,2,15,156,
+    0,28,3,54,0,146,32,61,32,112,97,114,115,101,66,33,4,7,37,1,
+    15,36,1,2,2,159,4,0,208,1,4,4,0,7,209,4,1,64,2,43,
+    48,93,94,1,0,41,0,98,114,101,116,117,114,110,215,4,15,109,2,1,
+    52,101,108,112,191,0,123,63,32,48,32,58,32,49,126,0,5,184,2,37,
+    125,10,11,0,240,4,47,47,32,66,108,111,99,107,32,83,73,71,73,78,
+    84,32,97,110,100,11,0,112,84,69,82,77,32,105,110,14,4,36,114,121,
+    5,4,176,115,111,32,116,104,97,116,32,111,110,108,20,0,24,101,69,0,
+    245,10,115,105,103,119,97,105,116,40,41,32,98,101,108,111,119,32,115,101,
+    101,115,32,116,104,101,109,37,0,144,115,105,103,115,101,116,95,116,32,185,
+    1,54,97,108,115,157,0,211,115,105,103,101,109,112,116,121,115,101,116,40,
+    38,30,0,7,0,1,104,115,105,103,97,100,100,29,0,16,44,163,0,63,
+    73,78,84,37,0,15,0,200,0,7,38,0,18,112,77,2,244,5,95,115,
+    105,103,109,97,115,107,40,83,73,71,95,66,76,79,67,75,44,32,121,0,
+    182,44,32,110,117,108,108,112,116,114,41,59,38,1,2,107,4,18,32,143,
+    6,19,40,172,3,7,88,0,2,25,0,120,46,115,116,97,114,116,40,24,
+    0,9,131,6,243,1,123,123,112,114,111,106,101,99,116,95,110,97,109,101,
+    125,125,12,6,48,105,110,103,15,6,113,104,116,116,112,58,47,47,161,6,
+    3,98,0,2,14,4,96,60,60,32,39,58,39,173,6,3,103,0,0,176,
+    3,32,40,41,17,0,60,34,32,40,134,6,0,42,2,35,60,60,171,0,
+    18,46,240,0,20,115,46,0,2,15,0,66,40,115,41,44,9,7,3,81,
+    0,3,199,2,3,38,0,17,41,131,0,1,2,4,71,101,110,100,108,7,
+    1,0,144,5,2,160,1,73,32,61,32,48,193,1,1,253,1,6,68,1,
+    3,10,0,15,11,1,6,80,83,104,117,116,116,249,0,76,100,111,119,110,
+    112,0,0,195,0,0,4,0,3,158,0,68,115,116,111,112,85,1,131,125,
+    32,99,97,116,99,104,32,248,7,2,165,0,4,79,8,120,38,32,101,114,
+    114,111,114,95,5,1,33,0,65,99,101,114,114,46,1,16,69,31,0,3,
+    4,8,1,43,0,64,46,119,104,97,180,2,0,49,1,0,171,1,2,240,
+    0,0,124,0,0,4,0,3,113,3,3,71,3,17,125,202,2,3,20,0,
+    16,48,169,6,0,245,6,35,105,110,99,108,117,100,101,32,34,115,101,114,
+    118,101,114,46,104,34,10,10,21,0,184,60,97,108,103,111,114,105,116,104,
+    109,62,21,0,168,114,112,97,47,105,110,101,116,46,104,23,0,105,99,101,
+    114,114,110,111,18,0,104,115,116,114,105,110,103,19,0,121,105,111,115,116,
+    114,101,97,80,0,48,110,101,116,78,0,58,47,105,110,81,0,4,24,0,
+    58,116,99,112,25,0,122,112,116,104,114,101,97,100,21,0,76,115,99,104,
+    101,19,0,136,116,100,101,120,99,101,112,116,130,0,140,115,121,115,47,115,
+    111,99,107,191,0,81,117,110,105,115,116,65,0,6,235,0,80,34,104,116,
+    116,112,19,1,5,18,1,80,34,116,97,115,107,18,0,241,20,10,110,97,
+    109,101,115,112,97,99,101,32,123,10,10,47,47,32,67,108,111,115,101,115,
+    32,116,104,101,32,102,100,32,119,104,101,110,12,0,240,3,99,111,110,110,
+    101,99,116,105,111,110,39,115,32,99,111,114,111,117,237,0,241,18,32,102,
+    105,110,105,115,104,101,115,32,111,114,32,105,115,32,100,101,115,116,114,111,
+    121,101,100,10,99,108,97,115,115,32,83,161,0,243,8,32,123,10,112,117,
+    98,108,105,99,58,10,32,32,32,32,101,120,112,108,105,99,105,116,30,0,
+    224,40,105,110,116,32,102,100,41,32,58,32,102,100,40,9,0,33,123,125,
+    40,0,18,126,62,0,160,40,41,32,123,32,99,108,111,115,101,29,0,34,
+    59,32,29,0,3,28,0,68,99,111,110,115,73,0,193,38,41,32,61,32,
+    100,101,108,101,116,101,59,65,0,2,36,0,207,38,32,111,112,101,114,97,
+    116,111,114,61,40,47,0,6,130,10,112,114,105,118,97,116,101,162,0,2,
+    146,0,177,59,10,125,59,10,10,84,97,115,107,32,85,2,21,67,3,1,
+    242,3,40,69,118,101,110,116,76,111,111,112,38,32,108,111,111,112,44,32,
+    50,0,55,41,32,123,121,0,18,32,159,1,1,182,0,1,23,0,194,66,
+    117,102,102,101,114,80,111,111,108,58,58,12,0,129,32,105,110,112,117,116,
+    32,61,70,0,33,46,98,32,0,210,115,40,41,46,97,99,113,117,105,114,
+    101,40,41,201,0,2,45,0,9,57,0,63,111,117,116,58,0,17,241,9,
+    115,116,100,58,58,115,105,122,101,95,116,32,102,105,108,108,101,100,32,61,
+    32,48,59,10,144,0,116,102,111,114,32,40,59,59,182,0,0,156,1,2,
+    33,1,0,206,0,97,114,101,99,101,105,118,48,0,130,99,111,95,97,119,
+    97,105,116,166,0,0,179,2,48,40,102,100,244,0,195,112,117,116,46,100,
+    97,116,97,40,41,32,43,95,0,4,23,0,0,116,0,67,40,41,32,45,
+    23,0,3,201,0,0,99,0,69,105,102,32,40,93,0,81,60,61,32,48,
+    41,141,0,0,27,0,0,4,0,160,99,111,95,114,101,116,117,114,110,59,
+    14,0,36,32,32,147,2,66,100,32,98,121,138,2,96,108,105,101,110,116,
+    44,114,2,133,97,110,32,101,114,114,111,114,65,0,3,227,0,52,43,61,
+    32,98,0,3,235,0,0,76,0,8,12,1,0,232,0,33,117,109,222,0,
+    18,48,100,1,12,34,0,243,2,114,101,113,117,101,115,116,115,32,61,32,
+    99,111,117,110,116,82,16,0,33,40,123,180,1,3,248,0,19,44,224,0,
+    52,125,44,32,83,0,13,235,0,4,72,0,99,61,32,48,32,38,38,49,
+    0,50,32,61,61,253,1,18,46,42,1,15,5,1,14,242,7,72,101,97,
+    100,101,114,115,32,108,97,114,103,101,114,32,116,104,97,110,32,97,32,51,
+    2,2,207,1,0,194,0,240,5,47,47,32,65,110,115,119,101,114,32,101,
+    118,101,114,121,32,99,111,109,112,17,3,19,32,207,0,245,18,44,32,112,
+    105,112,101,108,105,110,101,100,32,111,110,101,115,32,105,110,32,97,115,32,
+    102,101,119,32,119,114,105,116,101,115,75,1,32,47,47,25,0,0,7,4,
+    3,107,2,2,107,0,102,32,97,108,108,111,119,39,0,80,119,104,105,108,
+    101,209,1,3,230,0,56,62,32,48,80,2,0,148,0,8,120,1,98,108,
+    101,110,103,116,104,132,2,0,28,0,4,4,0,2,139,2,4,166,0,65,
+    115,32,62,32,44,1,3,47,0,243,0,43,32,72,84,84,80,95,82,69,
+    83,80,79,78,83,69,51,1,66,32,60,61,32,156,0,3,17,0,67,59,
+    32,45,45,232,0,28,115,133,0,0,105,0,1,137,0,115,109,101,109,99,
+    112,121,40,57,0,5,190,2,2,106,0,27,44,105,0,2,31,0,12,22,
+    0,3,178,1,6,56,2,0,93,0,0,4,0,2,69,0,59,32,43,61,
+    71,0,2,49,0,10,48,0,2,199,4,0,54,0,0,4,0,1,0,1,
+    1,160,0,0,44,0,96,95,116,32,115,101,110,24,4,34,48,59,10,0,
+    34,60,32,92,0,9,173,3,0,57,0,0,4,0,0,122,2,17,116,131,
+    4,0,196,1,49,116,101,110,180,2,8,180,3,0,24,0,0,63,5,20,
+    44,49,1,2,217,0,33,32,43,94,0,19,44,93,0,33,32,45,15,0,
+    7,193,2,0,94,0,0,4,0,0,180,3,0,68,0,0,92,0,14,179,
+    3,0,34,0,0,4,0,6,187,3,5,70,2,0,23,0,0,4,0,1,
+    207,0,33,43,61,101,2,63,116,101,110,11,1,5,25,125,202,2,228,75,
+    101,101,112,32,97,32,112,97,114,116,105,97,108,29,2,16,32,44,1,0,
+    152,2,80,110,101,120,116,32,142,4,5,110,0,1,65,1,138,109,101,109,
+    109,111,118,101,40,167,3,8,14,0,37,32,43,173,3,4,192,3,37,32,
+    45,19,0,7,255,0,3,79,4,16,45,3,4,32,110,115,48,4,2,185,
+    0,51,125,10,125,25,6,32,97,99,152,7,6,26,6,31,115,27,6,3,
+    132,108,105,115,116,101,110,101,114,150,2,0,195,0,15,122,5,6,16,102,
+    164,5,10,116,5,2,103,0,21,40,71,0,2,135,0,0,89,1,0,154,
+    1,0,49,0,240,3,61,32,45,69,67,79,78,78,65,66,79,82,84,69,
+    68,32,124,124,191,7,16,61,23,0,76,73,78,84,82,95,4,83,110,116,
+    105,110,117,39,7,7,71,0,30,60,190,3,193,47,47,32,79,117,116,32,
+    111,102,32,102,100,231,7,240,14,109,101,109,111,114,121,58,32,114,101,116,
+    114,121,105,110,103,32,97,116,32,111,110,99,101,32,119,111,117,108,86,4,
+    117,108,121,32,115,112,105,110,150,1,0,96,0,1,154,1,0,90,9,82,
+    32,60,60,32,34,207,0,160,32,102,97,105,108,101,100,58,32,34,21,0,
+    1,34,0,49,115,116,114,209,5,32,40,45,8,8,0,43,0,128,44,32,
+    110,111,32,108,111,110,244,4,2,55,0,102,105,110,103,92,110,34,2,1,
+    0,95,0,15,122,2,0,6,96,3,6,31,3,118,111,110,101,32,61,32,
+    49,60,0,48,115,101,116,165,7,49,111,112,116,210,6,240,17,73,80,80,
+    82,79,84,79,95,84,67,80,44,32,84,67,80,95,78,79,68,69,76,65,
+    89,44,32,38,111,110,101,44,32,156,3,32,111,102,57,5,7,37,2,12,
+    28,8,2,17,8,35,102,100,35,0,1,44,2,0,81,7,83,111,112,101,
+    110,76,8,2,3,137,8,4,244,0,177,105,110,103,38,32,104,111,115,116,
+    44,32,19,0,212,117,105,110,116,49,54,95,116,32,112,111,114,116,52,2,
+    0,169,0,80,97,100,100,114,95,179,5,80,100,100,114,101,115,156,6,34,
+    123,125,206,0,0,26,0,254,9,101,115,115,46,115,105,110,95,102,97,109,
+    105,108,121,32,61,32,65,70,95,73,78,69,84,34,0,0,88,0,144,32,
+    61,32,104,116,111,110,115,40,13,0,3,173,0,0,78,2,0,196,10,99,
+    95,112,116,111,110,40,63,0,17,44,155,0,184,46,99,95,115,116,114,40,
+    41,44,32,38,108,0,0,12,0,102,41,32,33,61,32,49,99,2,82,116,
+    104,114,111,119,202,0,130,114,117,110,116,105,109,101,95,214,1,224,34,73,
+    110,118,97,108,105,100,32,73,80,118,52,32,59,0,0,197,0,65,39,34,
+    32,43,99,0,115,32,43,32,34,39,34,41,179,7,6,183,1,0,224,2,
+    4,77,9,5,148,0,225,83,79,67,75,95,83,84,82,69,65,77,32,124,
+    32,14,0,132,78,79,78,66,76,79,67,75,16,0,167,67,76,79,69,88,
+    69,67,44,32,48,223,0,48,102,100,32,230,2,5,158,2,15,173,0,6,
+    1,138,1,2,250,11,32,40,34,125,1,38,101,116,178,2,0,241,8,4,
+    33,0,2,220,0,1,54,12,19,41,105,0,6,188,0,9,115,2,11,111,
+    2,64,83,79,76,95,185,0,255,1,69,84,44,32,83,79,95,82,69,85,
+    83,69,65,68,68,82,111,2,6,15,64,0,16,79,80,79,82,84,64,0,
+    6,0,223,1,48,98,105,110,102,11,240,4,44,32,114,101,105,110,116,101,
+    114,112,114,101,116,95,99,97,115,116,60,228,0,0,148,1,52,42,62,40,
+    227,1,21,41,244,2,0,25,0,64,101,115,115,41,61,1,0,93,4,2,
+    139,4,1,54,3,80,83,79,77,65,88,124,4,1,29,0,4,175,2,2,
+    151,3,0,158,11,0,253,2,1,36,1,32,32,61,175,9,34,110,111,144,
+    2,1,33,0,5,215,11,15,144,1,15,130,34,67,97,110,110,111,116,32,
+    122,0,72,32,111,110,32,56,2,16,58,13,0,1,146,1,32,116,111,169,
+    2,50,105,110,103,217,2,0,85,2,0,99,4,21,43,98,0,0,121,0,
+    15,4,0,2,1,63,0,5,131,4,1,179,0,4,209,1,2,78,4,2,
+    153,10,64,32,102,100,59,1,6,1,47,0,5,171,3,149,108,111,99,97,
+    108,80,111,114,116,208,12,2,12,12,4,86,1,15,183,3,3,0,30,0,
+    84,108,101,110,95,116,131,7,20,61,101,4,3,113,1,2,44,1,18,103,
+    168,4,0,172,13,1,115,1,15,188,1,20,18,38,53,8,3,149,2,3,
+    190,0,99,110,116,111,104,115,40,95,0,1,48,4,16,112,102,4,1,211,
+    0,240,8,47,47,32,66,101,115,116,32,101,102,102,111,114,116,58,32,97,
+    32,115,104,97,114,100,110,10,112,116,32,115,116,97,121,115,120,1,0,212,
+    2,240,3,99,111,114,101,32,107,101,101,112,115,32,105,116,115,32,99,97,
+    99,6,14,241,5,119,97,114,109,10,118,111,105,100,32,112,105,110,84,111,
+    67,111,114,101,40,39,1,2,234,14,34,38,32,8,0,112,44,32,117,110,
+    115,105,103,133,10,0,72,0,4,51,2,226,99,112,117,95,115,101,116,95,
+    116,32,99,112,117,115,250,0,160,67,80,85,95,90,69,82,79,40,38,20,
+    0,3,202,0,0,21,0,64,83,69,84,40,61,0,34,32,37,106,4,99,
+    109,97,120,40,49,117,65,5,2,103,0,32,58,58,189,0,240,3,119,97,
+    114,101,95,99,111,110,99,117,114,114,101,110,99,121,40,41,196,4,7,78,
+    0,3,135,15,0,123,0,32,97,102,209,14,98,116,121,95,110,112,40,68,
+    0,224,46,110,97,116,105,118,101,95,104,97,110,100,108,101,255,4,3,5,
+    6,0,65,0,36,44,32,150,0,64,125,10,10,125,171,12,0,162,1,1,
+    78,15,49,10,10,83,137,16,34,58,58,8,0,18,40,7,0,146,79,112,
+    116,105,111,110,115,32,111,8,0,0,245,14,3,11,0,2,40,1,1,186,
+    8,3,18,0,86,41,41,32,123,125,72,0,18,126,66,0,0,15,15,1,
+    203,2,64,115,116,111,112,33,14,34,125,10,114,1,2,31,0,117,58,58,
+    115,116,97,114,116,38,0,2,138,4,7,111,1,17,117,88,10,3,99,0,
+    18,46,229,0,2,112,11,20,63,150,0,5,22,0,31,58,91,1,31,2,
+    182,1,66,116,114,121,32,255,2,0,105,3,80,98,111,117,110,100,27,3,
+    37,32,61,99,0,0,116,2,2,44,0,0,34,0,1,102,2,64,115,46,
+    114,101,93,1,17,40,112,13,3,235,1,0,30,0,1,46,9,16,83,204,
+    1,19,38,144,2,18,58,8,0,13,230,11,1,72,0,18,46,34,4,33,
+    101,114,111,0,7,117,7,4,245,0,2,106,7,5,150,0,7,106,0,0,
+    110,0,5,24,0,1,151,15,4,213,3,10,90,0,33,41,59,153,14,1,
+    212,0,33,48,58,151,14,48,111,116,104,159,13,65,106,111,105,110,16,0,
+    81,102,105,114,115,116,169,1,0,85,0,0,4,0,3,67,0,101,111,111,
+    112,32,61,32,66,16,148,58,58,99,114,101,97,116,101,40,158,0,100,98,
+    97,99,107,101,110,63,8,0,57,0,2,125,4,196,125,32,99,97,116,99,
+    104,32,40,46,46,46,50,3,0,30,0,4,8,2,0,12,0,0,4,0,
+    1,209,6,2,91,1,3,79,11,1,64,1,5,3,2,17,105,126,13,66,
+    32,105,32,60,217,14,88,59,32,43,43,105,81,0,9,106,1,19,61,106,
+    1,50,91,105,93,84,0,0,99,0,2,202,0,2,60,2,34,32,61,37,
+    2,2,14,0,49,40,91,38,29,0,23,93,255,1,0,50,0,2,187,9,
+    8,40,11,17,42,40,0,18,46,46,9,3,12,0,3,30,9,11,145,1,
+    3,29,0,128,111,111,112,45,62,114,117,110,244,2,0,83,0,0,4,0,
+    23,125,43,0,7,114,4,0,43,2,3,197,2,51,44,32,105,36,0,1,
+    137,9,1,156,4,6,42,3,0,66,3,3,170,0,1,37,1,9,251,0,
+    15,101,2,1,70,105,102,32,40,144,0,6,243,8,0,141,0,6,24,0,
+    40,45,62,149,1,2,191,1,15,96,0,29,2,80,1,16,46,80,2,32,
+    97,98,122,4,15,109,0,1,7,37,0,8,23,1,6,138,0,0,83,3,
+    48,101,116,40,176,2,17,32,179,2,18,68,162,19,2,225,19,150,115,117,
+    115,112,101,110,100,101,100,210,19,33,115,44,108,19,0,216,11,83,116,104,
+    101,105,114,120,9,6,241,15,7,2,1,3,175,1,46,32,62,197,17,1,
+    216,7,3,135,0,3,39,0,5,135,1,5,44,1,112,115,46,99,108,101,
+    97,114,186,0,50,125,10,10,170,4,100,99,104,97,114,42,32,162,1,3,
+    12,3,33,40,41,158,13,19,116,171,1,3,201,6,1,95,0,244,4,115,
+    46,101,109,112,116,121,40,41,32,63,32,34,110,111,110,101,34,32,184,1,
+    129,46,102,114,111,110,116,40,41,100,2,32,45,62,155,5,2,107,0,0,
+    245,10,35,105,110,99,108,117,100,101,32,34,101,118,101,110,116,95,108,111,
+    111,112,46,104,34,10,10,25,0,183,60,97,108,103,111,114,105,116,104,109,
+    62,21,0,105,99,101,114,114,110,111,18,0,104,115,116,114,105,110,103,19,
+    0,160,108,105,110,117,120,47,105,111,95,117,26,0,40,46,104,28,0,74,
+    112,111,108,108,18,0,152,115,116,100,101,120,99,101,112,116,39,0,14,85,
+    0,139,115,121,115,47,109,109,97,110,61,0,159,121,115,47,115,111,99,107,
+    101,116,24,0,0,76,121,115,99,97,110,0,96,117,110,105,115,116,100,45,
+    0,241,54,10,110,97,109,101,115,112,97,99,101,32,123,10,10,47,47,32,
+    82,105,110,103,32,101,110,116,114,105,101,115,59,32,101,118,101,114,121,32,
+    99,111,110,110,101,99,116,105,111,110,32,104,97,115,32,97,116,32,109,111,
+    115,116,32,111,110,101,32,111,112,101,114,97,26,0,224,105,110,32,102,108,
+    105,103,104,116,44,32,97,110,100,75,0,161,116,104,101,32,99,111,109,112,
+    108,101,33,0,0,7,1,241,40,32,105,115,32,116,119,105,99,101,32,116,
+    104,105,115,32,115,105,122,101,10,99,111,110,115,116,32,117,110,115,105,103,
+    110,101,100,32,82,73,78,71,95,69,78,84,82,73,69,83,32,61,32,52,
+    48,57,54,59,154,0,208,117,115,101,114,95,100,97,116,97,32,111,102,32,
+    92,0,113,114,101,97,100,32,111,110,12,0,64,119,97,107,101,174,0,86,
+    110,116,102,100,59,150,0,64,115,32,117,115,108,0,179,101,105,114,32,97,
+    100,100,114,101,115,115,112,0,240,12,115,116,100,58,58,117,105,110,116,54,
+    52,95,116,32,87,65,75,69,95,84,65,71,32,61,32,48,59,188,0,96,
+    83,101,116,32,105,110,62,0,3,116,0,49,102,111,114,105,0,0,187,1,
+    240,5,32,116,104,97,116,32,112,114,101,99,101,100,101,115,32,114,101,116,
+    114,121,55,1,38,97,110,122,0,15,103,0,2,67,80,79,76,76,103,0,
+    17,49,103,0,9,212,0,240,3,99,97,110,99,101,108,32,114,101,113,117,
+    101,115,116,115,59,32,110,127,1,24,32,86,0,241,0,39,115,32,40,116,
+    104,101,121,32,97,114,101,32,97,108,50,1,31,41,107,0,2,84,67,65,
+    78,67,69,109,0,176,50,59,10,10,105,110,116,32,105,111,85,134,1,101,
+    83,101,116,117,112,40,114,1,3,238,1,36,44,32,173,2,146,95,112,97,
+    114,97,109,115,42,32,8,0,112,41,32,123,10,32,32,32,232,0,242,7,
+    117,114,110,32,115,116,97,116,105,99,95,99,97,115,116,60,105,110,116,62,
+    40,115,99,2,101,40,95,95,78,82,95,68,0,16,115,101,0,20,44,75,
+    2,20,44,76,0,73,41,59,10,125,141,0,96,69,110,116,101,114,40,158,
+    0,54,102,100,44,7,2,103,115,117,98,109,105,116,17,0,119,119,97,105,
+    116,70,111,114,18,0,95,102,108,97,103,115,157,0,35,16,101,117,0,32,
+    44,32,114,0,4,105,0,5,96,0,1,87,0,210,44,32,110,117,108,108,
+    112,116,114,44,32,48,41,180,0,69,47,47,32,67,206,2,213,45,98,97,
+    115,101,100,32,98,97,99,107,101,110,134,2,53,114,97,119,69,1,19,32,
+    23,1,145,115,32,40,110,111,32,108,105,98,8,4,32,41,46,94,2,20,
+    79,54,3,17,115,201,1,161,113,117,101,117,101,100,32,97,115,32,141,0,
+    32,115,115,106,3,3,150,1,0,77,3,161,32,104,97,110,100,101,100,32,
+    116,111,131,2,144,107,101,114,110,101,108,32,105,110,75,0,0,133,3,5,
+    116,1,1,215,0,80,32,112,101,114,32,203,4,66,32,105,116,101,157,3,
+    208,44,32,119,104,105,99,104,32,97,108,115,111,32,233,0,32,115,32,208,
+    2,6,157,3,145,115,46,10,99,108,97,115,115,32,32,2,240,0,76,111,
+    111,112,32,58,32,112,117,98,108,105,99,32,69,28,5,1,19,0,34,123,
+    10,19,0,17,58,15,2,5,43,0,20,40,132,1,0,37,2,5,140,0,
+    2,60,2,3,247,1,97,32,61,32,123,125,59,55,0,0,37,0,0,133,
+    2,74,70,100,32,61,145,2,8,250,3,50,44,32,38,65,0,22,41,54,
+    0,67,105,102,32,40,58,0,69,60,32,48,41,78,0,0,82,0,97,116,
+    104,114,111,119,32,213,3,225,114,117,110,116,105,109,101,95,101,114,114,111,
+    114,40,19,0,2,73,5,37,40,34,157,0,1,157,2,210,32,102,97,105,
+    108,101,100,58,32,34,41,32,43,60,0,50,115,116,114,55,0,1,226,5,
+    0,249,1,5,102,0,32,115,113,27,5,99,83,105,122,101,32,61,214,0,
+    247,0,46,115,113,95,111,102,102,46,97,114,114,97,121,32,43,22,0,4,
+    189,1,17,42,227,4,37,111,102,109,3,7,207,0,31,99,81,0,0,18,
+    99,81,0,70,99,113,101,115,80,0,61,99,113,95,80,0,5,202,0,56,
+    99,113,101,84,0,1,76,5,230,98,111,111,108,32,115,105,110,103,108,101,
+    77,97,112,175,0,209,102,101,97,116,117,114,101,115,32,38,32,73,79,110,
+    1,250,1,70,69,65,84,95,83,73,78,71,76,69,95,77,77,65,80,109,
+    1,5,67,0,10,108,1,9,10,1,9,198,0,1,109,1,70,109,97,120,
+    40,35,0,38,44,32,34,0,7,169,0,2,33,0,105,32,61,32,109,97,
+    112,46,0,3,153,0,112,79,70,70,95,83,81,95,165,0,7,54,0,2,
+    75,0,39,32,61,221,0,35,63,32,75,0,17,58,75,0,2,34,0,0,
+    166,1,20,44,228,0,0,75,0,29,67,75,0,64,115,113,101,115,39,0,
+    6,30,1,31,115,103,1,9,25,115,103,1,0,61,0,0,134,0,8,10,
+    5,3,233,7,114,95,115,113,101,42,62,40,215,0,2,99,0,9,138,0,
+    73,83,81,69,83,88,2,139,97,117,116,111,42,32,115,113,80,0,99,99,
+    104,97,114,42,62,27,1,7,3,1,48,115,113,72,247,6,80,61,32,114,
+    101,105,197,4,66,112,114,101,116,140,5,4,208,5,1,54,0,6,62,2,
+    3,164,2,73,104,101,97,100,71,0,95,84,97,105,108,32,71,0,30,73,
+    116,97,105,108,71,0,143,77,97,115,107,32,61,32,42,143,0,28,0,200,
+    3,89,95,109,97,115,107,77,0,18,69,120,8,15,148,1,1,6,154,2,
+    148,47,47,32,83,108,111,116,32,105,8,8,2,127,3,113,97,108,119,97,
+    121,115,32,208,8,1,118,6,65,121,32,105,59,9,0,34,105,101,103,5,
+    16,117,178,5,133,105,110,32,111,114,100,101,114,216,3,2,128,1,2,68,
+    0,15,15,1,30,1,55,0,7,195,0,0,86,5,5,236,3,33,32,105,
+    79,8,115,32,105,32,60,32,115,113,220,0,90,59,32,43,43,105,80,3,
+    1,69,0,48,91,105,93,16,5,6,231,0,83,108,111,99,97,108,165,1,
+    48,42,115,113,10,0,43,59,10,182,0,31,99,54,2,4,2,6,3,7,
+    152,0,31,99,54,2,17,38,99,113,54,2,3,137,4,11,54,2,17,99,
+    135,0,15,54,2,12,15,71,0,0,11,54,2,47,99,113,54,2,17,15,
+    72,0,0,15,54,2,1,1,44,5,15,185,1,0,8,34,5,63,42,62,
+    40,78,0,0,0,58,0,24,41,84,1,115,114,109,87,97,107,101,40,56,
+    1,18,125,110,1,24,126,232,6,112,111,118,101,114,114,105,100,45,11,0,
+    118,6,0,4,0,115,47,47,32,84,104,101,32,149,7,243,3,109,97,121,
+    32,115,116,105,108,108,32,119,114,105,116,101,32,105,110,181,7,241,4,99,
+    111,114,111,117,116,105,110,101,115,39,32,98,117,102,102,101,114,115,219,7,
+    0,33,0,5,214,1,48,47,47,32,201,10,96,86,97,108,117,101,32,199,
+    6,16,108,241,7,38,105,114,87,10,20,115,82,11,96,101,32,40,99,108,
+    111,162,5,0,35,0,16,32,26,1,56,32,102,100,74,0,32,97,108,28,
+    8,208,100,111,101,115,32,110,111,116,32,115,116,111,112,43,0,16,109,12,
+    8,17,108,21,11,1,54,0,2,28,3,194,109,97,112,112,101,100,41,44,
+    32,115,111,32,136,10,9,75,0,112,110,100,32,114,101,97,112,98,11,64,
+    114,121,116,104,237,10,176,98,101,102,111,114,101,32,102,114,101,101,15,0,
+    48,97,110,121,144,3,37,105,116,56,0,84,100,114,97,105,110,77,1,0,
+    42,1,232,100,101,115,116,114,111,121,80,101,110,100,105,110,103,26,0,52,
+    109,117,110,49,5,32,44,32,93,5,0,154,5,3,135,1,0,58,0,0,
+    250,7,2,212,2,51,32,33,61,241,5,10,68,3,3,66,0,2,37,0,
+    15,116,6,4,3,36,0,2,48,6,0,104,0,4,209,7,7,106,0,0,
+    84,1,19,101,102,8,3,23,0,3,8,2,2,167,12,1,151,5,1,101,
+    4,32,40,41,24,13,0,7,13,5,20,2,4,34,11,5,104,8,242,0,
+    34,59,32,125,10,10,112,114,111,116,101,99,116,101,100,56,9,2,158,7,
+    85,116,97,114,116,40,8,10,22,38,226,1,47,41,32,101,2,0,133,112,
+    114,101,112,97,114,101,40,111,13,3,156,0,0,29,1,52,97,100,100,83,
+    1,15,31,0,1,48,114,101,116,182,11,82,102,97,108,115,101,94,4,3,
+    209,0,80,118,111,105,100,32,207,12,31,40,115,0,2,2,240,0,4,85,
+    6,65,32,116,111,83,146,11,54,32,61,32,154,4,37,45,32,154,4,0,
+    138,0,0,4,0,242,2,95,95,97,116,111,109,105,99,95,115,116,111,114,
+    101,95,110,40,187,4,22,44,54,0,247,3,44,32,95,95,65,84,79,77,
+    73,67,95,82,69,76,69,65,83,69,205,0,0,234,1,3,166,12,2,25,
+    12,0,217,2,53,70,100,44,128,0,53,44,32,49,80,7,241,9,69,78,
+    84,69,82,95,71,69,84,69,86,69,78,84,83,41,32,60,32,48,32,38,
+    38,32,189,9,0,42,2,90,69,73,78,84,82,41,2,15,41,10,28,2,
+    82,11,15,41,10,26,5,51,1,0,61,5,0,27,7,2,125,5,2,124,
+    1,0,35,1,12,90,1,2,137,7,5,57,1,114,108,111,97,100,95,110,
+    40,108,5,7,45,1,104,65,67,81,85,73,82,45,1,1,110,6,33,59,
+    32,104,0,48,33,61,32,102,5,0,95,6,0,16,0,8,147,11,6,116,
+    0,8,20,5,48,32,99,113,202,10,0,5,5,16,91,50,0,50,32,38,
+    32,152,5,22,93,170,0,0,58,0,112,47,47,32,72,97,110,100,59,4,
+    32,32,115,120,7,0,244,12,19,32,254,3,132,114,101,115,117,109,105,110,
+    103,97,12,0,255,4,1,206,12,32,32,109,29,4,69,119,111,114,107,16,
+    4,0,77,0,5,229,0,4,30,2,2,28,1,18,44,196,0,16,43,220,
+    1,15,29,2,8,0,66,0,0,33,2,70,99,113,101,46,58,15,37,61,
+    61,191,15,12,246,0,0,49,0,26,97,214,5,0,19,0,4,4,0,115,
+    99,111,110,116,105,110,117,23,3,4,22,0,25,125,178,0,2,31,8,5,
+    89,3,15,252,6,1,5,198,3,1,103,6,8,155,0,52,38,32,126,243,
+    15,7,228,2,0,105,0,14,199,0,37,38,32,43,0,9,129,0,0,46,
+    0,4,255,3,21,42,136,0,32,41,59,24,0,4,4,0,0,184,17,144,
+    101,97,100,121,32,110,111,119,58,134,4,41,114,121,68,0,84,101,108,115,
+    101,32,115,0,0,1,12,170,61,61,32,45,69,65,71,65,73,78,30,3,
+    0,81,0,3,109,0,95,80,111,108,108,40,113,0,1,0,128,9,36,111,
+    109,242,6,65,115,32,100,111,96,6,0,87,14,0,142,17,178,79,95,78,
+    79,78,66,76,79,67,75,32,148,18,29,115,139,0,9,17,0,0,115,0,
+    3,137,14,23,101,112,0,0,196,5,87,101,46,114,101,115,57,1,2,154,
+    1,1,82,5,82,105,118,97,116,101,80,5,0,200,4,17,42,253,11,1,
+    127,12,97,115,105,122,101,95,116,120,13,112,44,32,111,102,102,95,116,6,
+    0,56,115,101,116,29,2,3,52,0,80,101,109,111,114,121,133,12,0,126,
+    6,5,241,15,0,66,0,210,44,32,80,82,79,84,95,82,69,65,68,32,
+    124,12,0,240,1,87,82,73,84,69,44,32,77,65,80,95,83,72,65,82,
+    69,25,0,0,13,0,96,80,79,80,85,76,65,27,0,64,114,105,110,103,
+    172,4,48,111,102,102,112,0,6,72,3,0,123,1,19,109,109,0,17,61,
+    66,0,104,70,65,73,76,69,68,147,0,1,8,1,59,108,111,115,126,6,
+    0,23,0,0,4,0,15,184,4,6,5,109,6,83,32,109,109,97,112,212,
+    14,29,34,54,1,0,68,0,3,11,6,2,138,0,2,158,0,3,12,6,
+    113,47,47,32,78,101,120,116,206,7,12,133,16,146,121,44,32,99,108,101,
+    97,114,101,94,8,5,68,4,144,115,113,101,38,32,110,101,120,116,218,10,
+    26,121,5,16,56,102,32,40,38,6,5,247,3,3,220,4,2,197,12,15,
+    220,4,0,32,32,61,223,7,0,81,0,37,105,101,219,17,0,187,0,0,
+    4,0,193,47,47,32,70,117,108,108,58,32,108,101,116,143,4,3,116,9,
+    0,80,5,80,117,109,101,32,119,150,19,49,105,115,32,129,4,2,173,0,
+    0,55,0,0,4,0,0,35,0,7,100,20,15,205,6,21,0,59,0,5,
+    188,0,4,179,4,15,209,6,27,0,67,0,15,209,6,12,16,48,100,18,
+    2,143,1,0,46,0,2,230,2,0,10,0,10,107,1,0,4,16,0,173,
+    2,0,32,9,21,91,94,1,97,43,43,32,38,32,115,81,11,7,185,5,
+    1,10,3,129,109,101,109,115,101,116,40,38,57,0,65,44,32,48,44,21,
+    3,33,111,102,21,13,23,121,34,2,3,24,2,1,40,0,2,136,0,3,
+    23,2,0,39,3,0,232,20,1,124,8,5,231,4,24,38,173,8,2,27,
+    20,15,174,0,7,7,33,2,2,91,0,0,43,0,1,106,0,32,46,102,
+    2,18,5,210,4,60,46,102,100,33,0,7,228,5,14,239,14,1,227,0,
+    4,193,21,53,62,40,38,73,0,7,217,0,118,115,119,105,116,99,104,32,
+    55,9,88,46,107,105,110,100,118,3,85,99,97,115,101,32,218,0,160,58,
+    58,75,105,110,100,58,58,65,99,139,23,2,95,4,0,176,0,0,4,0,
+    2,180,0,80,111,112,99,111,100,56,7,4,168,16,134,80,95,65,67,67,
+    69,80,84,188,0,6,45,0,17,97,71,0,17,95,81,20,118,32,61,32,
+    83,79,67,75,29,5,18,124,16,0,122,67,76,79,69,88,69,67,63,0,
+    86,98,114,101,97,107,19,0,15,165,0,3,51,82,101,97,82,10,0,114,
+    0,0,4,0,15,163,0,6,70,82,69,67,86,79,0,6,43,0,0,19,
+    23,15,210,6,1,11,92,1,5,91,1,18,46,186,12,7,98,1,6,76,
+    0,59,108,101,110,195,16,4,9,9,23,62,128,1,107,108,101,110,103,116,
+    104,65,0,15,239,0,18,16,87,80,13,15,147,1,20,79,83,69,78,68,
+    240,0,136,2,168,1,53,109,115,103,27,2,202,77,83,71,95,78,79,83,
+    73,71,78,65,76,185,0,11,28,1,2,29,4,15,159,3,0,1,175,7,
+    5,201,2,15,163,3,53,15,239,2,0,1,166,8,39,65,68,96,1,2,
+    207,0,15,206,3,14,0,107,12,49,51,50,95,107,27,54,115,32,61,69,
+    4,1,149,3,0,250,5,5,191,0,4,136,3,1,244,1,33,32,63,26,
+    9,81,79,85,84,32,58,10,0,38,73,78,35,1,2,124,0,15,41,4,
+    36,0,218,7,3,146,25,2,82,0,8,88,1,2,6,15,2,64,22,4,
+    103,4,1,16,26,72,68,97,116,97,67,4,15,166,5,3,15,248,4,8,
+    15,85,1,0,98,65,83,89,78,67,95,180,25,2,139,0,6,89,3,1,
+    89,1,44,45,49,23,0,3,188,3,0,251,0,0,146,0,12,31,0,0,
+    24,0,2,46,27,34,61,32,88,0,0,121,26,2,38,0,3,231,0,0,
+    209,24,1,115,26,18,115,216,15,6,146,1,0,251,26,2,205,27,1,164,
+    16,0,219,9,19,115,144,16,65,101,97,99,104,6,28,67,112,111,115,116,
+    19,8,85,47,47,32,105,116,154,16,65,105,111,110,59,159,7,6,243,16,
+    0,52,26,113,121,32,115,117,115,112,101,201,24,0,185,12,12,14,16,1,
+    21,10,1,113,6,3,57,16,22,32,91,6,64,47,47,32,69,120,0,0,
+    63,0,0,109,16,5,145,4,1,138,0,96,101,105,116,104,101,114,131,0,
+    81,101,108,102,32,111,10,0,1,217,14,6,199,0,17,44,94,0,0,84,
+    1,33,47,47,211,0,15,64,28,9,0,165,28,3,78,20,51,97,114,109,
+    228,0,0,60,0,4,209,4,65,32,105,110,70,235,28,55,32,61,32,152,
+    1,48,102,111,114,166,0,4,141,15,132,91,116,104,105,115,44,32,38,45,
+    0,31,93,239,15,4,6,231,0,0,100,0,2,170,8,0,118,12,4,177,
+    28,15,161,5,16,15,253,6,2,1,78,0,1,224,1,16,40,44,2,40,
+    101,115,75,11,14,29,0,7,13,3,11,159,5,36,43,43,195,0,2,63,
+    2,0,60,0,23,125,36,0,3,42,3,4,68,29,23,41,83,19,116,119,
+    104,105,108,101,32,40,64,0,72,32,62,32,48,59,3,0,74,0,2,241,
+    0,5,91,1,15,155,9,93,63,102,32,40,159,9,12,15,112,16,43,0,
+    227,0,2,96,9,7,23,1,0,21,0,5,242,0,1,125,15,50,61,32,
+    42,11,15,6,99,1,0,37,0,12,29,1,15,43,16,38,0,77,0,0,
+    118,3,31,40,47,16,19,0,47,0,0,181,12,15,30,16,0,7,122,15,
+    24,33,91,4,14,73,14,0,69,0,36,45,45,252,1,10,217,0,2,200,
+    6,0,34,0,0,4,0,13,100,11,2,12,1,2,23,16,7,39,12,14,
+    48,18,2,72,0,3,209,4,1,62,4,5,240,15,7,64,4,15,163,5,
+    49,0,11,14,6,196,0,2,120,6,1,155,5,0,178,21,44,70,100,27,
+    0,0,115,3,15,186,3,17,0,62,0,1,240,21,7,81,3,2,93,0,
+    18,108,81,9,86,105,122,101,111,102,23,22,12,104,0,8,232,5,4,130,
+    3,2,36,0,3,21,1,0,90,31,2,153,14,52,32,61,32,71,6,0,
+    42,1,0,117,26,0,2,21,36,32,61,236,30,2,56,0,2,28,0,2,
+    74,21,12,28,0,1,25,10,19,115,98,15,8,192,28,18,48,60,0,8,
+    32,0,2,66,0,0,202,21,17,32,86,33,0,233,1,8,32,0,0,200,
+    12,10,30,0,8,167,1,0,158,0,16,101,39,8,3,151,15,2,96,0,
+    5,34,0,64,99,113,101,42,194,18,13,34,0,4,87,3,0,64,0,3,
+    42,27,9,66,0,8,32,0,0,84,25,12,226,0,6,32,0,2,132,2,
+    15,32,0,9,15,64,0,9,3,148,13,6,251,0,4,89,0,3,102,19,
+    15,25,0,0,5,36,26,15,28,0,0,5,240,13,1,28,0,0,75,1,
+    1,4,0,0,25,7,17,110,172,35,4,167,13,33,100,44,142,17,50,97,
+    108,108,192,31,114,115,104,101,100,32,121,101,151,23,1,127,1,5,205,8,
+    5,123,2,1,84,0,145,10,125,59,10,10,125,32,47,47,222,22,16,115,
+    19,36,34,10,10,49,0,165,110,105,113,117,101,95,112,116,114,60,12,32,
+    136,62,32,99,114,101,97,116,101,29,25,2,201,6,2,237,4,2,79,31,
+    97,109,97,107,101,95,117,63,0,21,60,42,0,16,62,250,23,32,125,10,
+    241,15,47,47,32,84,101,115,116,115,32,102,111,114,32,116,104,101,32,72,
+    84,84,80,32,102,114,97,109,105,110,103,44,18,0,241,0,98,117,102,102,
+    101,114,32,112,111,111,108,32,97,110,100,20,0,128,115,101,114,118,101,114,
+    32,111,5,0,240,13,108,111,111,112,98,97,99,107,10,47,47,32,119,105,
+    116,104,32,101,97,99,104,32,101,118,101,110,116,32,28,0,16,32,29,0,
+    247,11,101,110,100,10,35,105,110,99,108,117,100,101,32,60,97,114,112,97,
+    47,105,110,101,116,46,104,62,23,0,105,99,104,114,111,110,111,18,0,107,
+    115,116,100,108,105,98,19,0,72,114,105,110,103,19,0,136,105,111,115,116,
+    114,101,97,109,20,0,48,110,101,116,97,0,58,47,105,110,100,0,152,115,
+    116,100,101,120,99,101,112,116,45,0,44,115,116,83,0,140,115,121,115,47,
+    115,111,99,107,163,0,104,116,104,114,101,97,100,60,0,96,117,110,105,115,
+    116,100,101,0,6,202,0,18,34,52,1,16,95,52,1,55,46,104,34,25,
+    0,74,104,116,116,112,18,0,2,75,1,0,20,0,255,37,10,115,116,97,
+    116,105,99,32,105,110,116,32,102,97,105,108,117,114,101,115,32,61,32,48,
+    59,10,10,35,100,101,102,105,110,101,32,67,72,69,67,75,40,99,111,110,
+    100,105,116,105,111,110,41,32,1,0,36,32,92,10,57,0,64,100,111,32,
+    123,8,0,15,4,0,49,2,82,0,0,74,0,87,105,102,32,40,33,164,
+    0,31,41,101,0,36,6,82,0,0,86,0,240,6,115,116,100,58,58,99,
+    101,114,114,32,60,60,32,95,95,70,73,76,69,95,95,12,0,48,39,58,
+    39,7,0,83,95,95,76,73,78,19,0,101,34,58,32,34,32,35,38,1,
+    154,32,34,92,110,34,59,32,32,32,82,0,36,43,43,101,1,0,28,0,
+    0,100,0,15,4,0,31,6,82,0,31,125,61,0,31,15,50,0,2,2,
+    82,0,196,125,32,119,104,105,108,101,32,40,48,41,10,23,2,97,99,111,
+    110,115,116,32,8,1,2,176,2,241,2,32,82,69,81,85,69,83,84,32,
+    61,32,34,71,69,84,32,47,189,3,242,6,47,49,46,49,92,114,92,110,
+    72,111,115,116,58,32,49,50,55,46,48,46,48,19,0,0,23,0,37,34,
+    59,81,0,240,3,118,111,105,100,32,116,101,115,116,67,111,117,110,116,82,
+    101,113,117,10,4,241,15,72,97,110,100,108,101,115,80,105,112,101,108,105,
+    110,101,100,65,110,100,80,97,114,116,105,97,108,40,41,32,123,56,2,2,
+    132,0,96,105,122,101,95,116,32,150,0,66,117,109,101,100,169,2,0,211,
+    0,4,164,2,7,84,0,69,40,34,34,44,42,0,149,41,32,61,61,32,
+    48,32,38,38,18,0,1,17,0,33,41,59,92,0,15,62,0,1,4,232,
+    0,21,43,242,0,22,43,242,0,12,90,0,27,50,73,0,34,110,115,159,
+    0,84,61,32,50,32,42,65,0,123,46,115,105,122,101,40,41,43,0,8,
+    178,0,3,116,0,171,46,115,117,98,115,116,114,40,48,44,59,0,95,32,
+    45,32,49,41,213,0,17,30,125,112,1,245,14,82,101,115,112,111,110,115,
+    101,76,101,110,103,116,104,87,97,105,116,115,70,111,114,84,104,101,66,111,
+    100,121,102,1,0,90,1,10,240,1,19,114,56,0,16,40,165,5,153,95,
+    82,69,83,80,79,78,83,69,197,0,4,35,0,2,91,0,20,40,15,0,
+    1,116,1,4,13,0,15,253,0,1,4,28,0,11,56,0,52,32,43,32,
+    26,0,15,67,0,37,7,66,1,4,75,0,3,129,0,1,67,1,1,87,
+    0,31,48,196,0,17,7,73,0,53,49,48,41,56,0,15,96,1,0,17,
+    66,178,6,194,80,111,111,108,82,101,99,121,99,108,101,115,18,0,21,115,
+    92,1,2,16,0,0,34,0,1,216,6,51,40,54,52,130,0,242,6,99,
+    104,97,114,42,32,102,105,114,115,116,32,61,32,110,117,108,108,112,116,114,
+    154,2,2,252,2,0,226,2,6,62,0,34,58,58,12,0,65,32,97,32,
+    61,74,0,147,46,97,99,113,117,105,114,101,40,80,0,15,47,0,4,31,
+    98,47,0,8,4,125,0,104,97,46,100,97,116,97,73,0,2,28,3,20,
+    97,63,1,53,61,61,32,184,0,0,104,0,2,31,0,1,116,6,161,97,
+    108,108,111,99,97,116,101,100,40,40,1,16,50,110,3,2,25,0,130,118,
+    97,105,108,97,98,108,101,25,0,4,121,1,23,125,124,3,15,40,0,1,
+    4,85,3,2,238,0,0,56,1,6,250,0,79,103,97,105,110,207,0,4,
+    15,146,0,32,19,49,57,1,2,59,0,16,97,93,0,3,8,1,0,38,
+    4,1,28,1,242,13,41,59,32,47,47,32,77,111,115,116,32,114,101,99,
+    101,110,116,108,121,32,114,101,108,101,97,115,101,100,187,1,22,10,21,2,
+    0,77,7,161,99,111,110,110,101,99,116,84,111,40,186,4,212,117,105,110,
+    116,49,54,95,116,32,112,111,114,116,212,4,2,110,3,0,46,0,16,102,
+    204,4,2,252,7,244,8,40,65,70,95,73,78,69,84,44,32,83,79,67,
+    75,95,83,84,82,69,65,77,44,32,54,1,0,37,0,128,97,100,100,114,
+    95,105,110,32,8,0,130,101,115,115,32,61,32,123,125,48,2,3,18,0,
+    227,46,115,105,110,95,102,97,109,105,108,121,32,61,32,81,0,14,34,0,
+    0,140,0,144,32,61,32,104,116,111,110,115,40,13,0,3,8,1,8,70,
+    0,0,12,0,48,46,115,95,7,0,3,43,0,243,2,108,40,73,78,65,
+    68,68,82,95,76,79,79,80,66,65,67,75,54,0,0,132,7,3,246,0,
+    244,7,40,102,100,44,32,114,101,105,110,116,101,114,112,114,101,116,95,99,
+    97,115,116,60,187,0,64,42,62,40,38,80,0,96,101,115,115,41,44,32,
+    22,5,36,111,102,204,0,84,41,32,60,32,48,32,1,0,97,2,131,99,
+    108,111,115,101,40,102,100,101,0,0,19,0,146,114,101,116,117,114,110,32,
+    45,49,210,0,2,72,2,3,21,0,48,102,100,59,137,1,240,2,47,47,
+    32,82,101,97,100,115,32,117,110,116,105,108,32,96,99,110,6,165,96,32,
+    99,111,109,112,108,101,116,101,97,4,241,2,115,32,104,97,118,101,32,97,
+    114,114,105,118,101,100,59,32,114,91,0,228,115,32,104,111,119,32,109,97,
+    110,121,32,100,105,100,12,7,0,168,1,0,137,9,4,74,5,32,115,40,
+    18,0,0,234,0,0,8,0,1,98,0,4,185,0,1,243,1,3,49,7,
+    0,47,2,1,93,0,1,239,2,0,43,0,4,147,4,0,185,1,18,48,
+    196,0,0,3,4,194,32,99,104,117,110,107,91,52,48,57,54,93,22,0,
+    3,144,7,6,48,0,41,60,32,103,0,0,13,1,2,68,2,16,115,70,
+    1,48,95,116,32,21,3,65,114,101,99,118,129,1,1,80,0,5,97,1,
+    3,14,0,4,72,2,0,60,0,0,178,1,113,110,32,60,61,32,48,41,
+    157,0,0,20,0,0,4,0,82,98,114,101,97,107,131,0,0,15,0,4,
+    194,0,131,46,97,112,112,101,110,100,40,74,0,2,58,10,3,219,1,66,
+    116,100,58,58,132,0,71,62,40,110,41,173,1,0,228,11,2,3,3,2,
+    31,0,33,32,108,129,6,50,59,32,40,9,0,37,32,61,141,1,5,8,
+    6,32,99,101,49,1,64,41,41,32,33,138,10,53,32,43,43,2,1,10,
+    168,0,5,153,0,131,101,114,97,115,101,40,48,44,93,0,3,127,0,9,
+    25,2,5,67,0,1,32,2,2,188,0,21,32,142,8,17,83,92,12,195,
+    65,110,115,119,101,114,115,79,118,101,114,76,97,12,132,40,66,97,99,107,
+    101,110,100,81,12,2,126,7,32,116,32,177,1,100,42,32,110,97,109,101,
+    244,1,2,67,0,32,79,112,36,11,50,115,32,111,8,0,2,69,1,3,
+    13,0,64,46,112,111,114,226,5,3,244,1,4,22,0,2,223,11,0,13,
+    2,26,50,47,0,3,196,12,36,32,61,125,0,2,31,0,2,105,0,18,
+    32,196,11,19,40,70,0,3,243,0,70,116,114,121,32,52,6,2,35,0,
+    100,46,115,116,97,114,116,212,5,128,125,32,99,97,116,99,104,32,45,11,
+    4,219,9,16,114,38,3,161,109,101,95,101,114,114,111,114,38,32,7,0,
+    4,215,0,0,1,2,1,207,2,64,99,111,117,116,245,10,176,34,83,107,
+    105,112,112,105,110,103,32,34,15,0,0,3,1,0,8,0,1,0,11,34,
+    60,60,61,0,112,46,119,104,97,116,40,41,24,0,66,39,92,110,39,184,
+    0,0,74,0,2,96,3,2,16,0,2,159,1,2,116,5,3,170,0,0,
+    33,1,18,40,247,1,3,209,0,3,31,0,1,95,2,99,116,114,99,109,
+    112,40,43,0,3,29,1,51,40,41,44,134,1,0,225,9,49,41,59,10,
+    201,2,53,47,47,32,76,10,35,32,114,101,10,112,32,111,110,32,111,110,
+    101,2,10,48,110,101,99,167,1,1,44,0,2,65,3,0,152,3,1,233,
+    5,36,32,61,33,0,0,187,5,1,23,2,1,184,1,11,185,9,2,44,
+    0,16,62,59,3,2,206,0,2,71,0,1,42,1,3,249,3,20,112,206,
+    10,36,32,61,200,9,24,32,78,10,3,238,9,2,63,0,3,232,0,0,
+    95,3,1,91,0,37,44,32,63,0,3,139,6,8,18,0,0,75,3,0,
+    250,0,17,48,106,7,2,205,2,3,137,3,0,27,0,70,95,116,62,40,
+    63,0,0,18,0,36,40,41,148,3,2,105,0,10,200,4,3,114,0,17,
+    51,78,0,23,51,69,1,20,65,61,1,248,11,32,115,112,108,105,116,32,
+    97,99,114,111,115,115,32,119,114,105,116,101,115,32,109,97,107,101,115,155,
+    15,65,119,97,105,116,213,15,0,95,0,91,105,110,101,115,115,98,1,80,
+    115,101,99,111,110,235,6,3,40,6,15,99,1,10,3,45,0,7,100,1,
+    2,188,0,16,115,37,1,2,29,0,6,33,11,2,183,8,64,44,32,49,
+    48,43,7,0,183,7,20,49,234,4,1,148,1,97,116,104,105,115,95,116,
+    73,15,178,58,58,115,108,101,101,112,95,102,111,114,153,4,17,99,3,16,
+    114,58,58,109,105,108,108,105,89,0,74,115,40,50,48,50,1,15,118,0,
+    8,33,32,43,119,0,3,208,1,4,42,9,17,45,21,0,15,162,1,8,
+    15,48,0,0,10,115,0,0,70,1,6,109,6,2,153,0,49,44,32,49,
+    166,1,0,179,8,1,93,1,0,77,17,34,104,101,131,8,4,186,2,194,
+    105,111,110,32,105,115,32,115,116,105,108,108,40,4,98,100,32,97,102,116,
+    101,110,17,2,73,0,81,32,99,97,109,101,92,17,65,119,101,110,116,75,
+    0,2,107,7,2,31,0,10,127,3,0,114,1,3,37,2,4,182,0,4,
+    113,1,4,16,0,17,115,221,12,4,125,1,15,147,2,2,10,43,0,15,
+    236,0,9,3,108,0,14,235,0,50,83,116,111,124,4,1,172,0,0,103,
+    5,39,101,110,246,0,17,115,209,0,164,105,115,32,105,100,101,109,112,111,
+    116,218,0,3,52,4,68,115,116,111,112,8,5,0,193,5,88,32,98,121,
+    116,101,128,3,2,59,7,0,137,11,48,44,32,38,29,0,49,44,32,49,
+    211,0,1,36,7,2,42,0,1,122,0,17,40,162,0,3,37,1,11,94,
+    0,48,125,10,10,78,4,69,109,97,105,110,252,11,15,242,14,26,2,104,
+    0,0,51,0,4,254,1,2,26,7,13,181,13,6,41,0,6,36,11,13,
+    126,12,6,37,0,2,57,6,15,229,6,8,176,58,58,69,112,111,108,108,
+    44,32,34,101,8,0,19,34,224,0,0,138,0,15,60,0,16,48,73,111,
+    85,210,18,112,44,32,34,105,111,95,117,11,0,4,65,0,0,104,8,4,
+    248,16,42,32,62,224,9,1,158,3,4,100,17,5,37,0,209,60,60,32,
+    34,32,99,104,101,99,107,40,115,41,153,18,82,101,100,92,110,34,204,0,
+    6,73,6,210,32,69,88,73,84,95,70,65,73,76,85,82,69,29,0,2,
+    86,6,2,86,0,4,178,6,20,65,7,3,17,114,123,16,103,115,32,112,
+    97,115,115,81,0,2,150,6,2,77,0,112,83,85,67,67,69,83,83,38,
+    8,0,240,56,67,88,88,32,61,32,103,43,43,10,79,80,84,73,77,73,
+    90,65,84,73,79,78,95,76,69,86,69,76,32,61,32,45,79,50,10,83,
+    82,67,32,61,32,36,40,119,105,108,100,99,97,114,100,32,115,114,99,47,
+    42,46,99,112,112,41,10,73,78,67,76,85,68,69,83,43,0,240,16,73,
+    105,110,99,108,117,100,101,10,10,35,32,83,70,77,76,32,108,105,110,107,
+    105,110,103,32,102,108,97,103,115,10,19,0,65,95,76,73,66,44,0,242,
+    1,108,115,102,109,108,45,103,114,97,112,104,105,99,115,32,45,16,0,100,
+    119,105,110,100,111,119,14,0,96,115,121,115,116,101,109,78,0,241,21,61,
+    61,61,32,68,101,98,117,103,32,99,111,110,102,105,103,117,114,97,116,105,
+    111,110,32,61,61,61,10,68,66,71,95,70,76,65,71,87,0,116,87,97,
+    108,108,32,36,40,150,0,65,41,32,45,103,33,0,49,79,66,74,195,0,
+    129,112,97,116,115,117,98,115,116,195,0,16,37,195,0,144,44,32,98,117,
+    105,108,100,47,100,95,0,241,2,47,111,98,106,47,37,46,111,44,32,36,
+    40,83,82,67,41,41,61,0,89,66,73,78,32,61,39,0,240,6,98,105,
+    110,47,123,123,112,114,111,106,101,99,116,95,110,97,109,101,125,125,10,219,
+    0,112,95,68,69,66,85,71,32,46,1,5,239,0,20,41,194,0,127,82,
+    101,108,101,97,115,101,196,0,0,63,82,69,76,196,0,8,46,36,40,155,
+    1,32,41,10,52,0,15,215,0,15,18,114,116,0,14,217,0,0,63,0,
+    8,217,0,4,41,0,15,219,0,2,52,10,35,32,189,0,240,52,112,114,
+    111,102,105,108,101,32,97,110,100,32,112,114,101,99,111,109,112,105,108,101,
+    100,32,104,101,97,100,101,114,32,114,117,108,101,115,32,40,99,112,112,115,
+    116,97,114,116,101,114,46,109,107,41,10,80,82,79,70,73,76,69,95,84,
+    65,82,71,69,84,170,1,35,36,40,129,0,34,41,32,11,0,83,79,66,
+    74,41,10,65,2,25,32,63,0,2,89,1,127,82,69,76,69,65,83,69,
+    91,1,0,128,69,109,105,116,32,46,100,32,151,0,240,2,115,32,110,101,
+    120,116,32,116,111,32,101,97,99,104,32,111,98,161,1,52,32,115,111,159,
+    0,176,101,100,105,116,115,32,116,114,105,103,103,173,0,4,191,0,85,115,
+    10,68,69,80,69,2,240,20,77,77,68,32,45,77,80,10,10,46,68,69,
+    70,65,85,76,84,95,71,79,65,76,32,58,61,32,97,108,108,10,36,40,
+    101,118,97,101,2,16,99,108,2,231,80,67,72,95,82,85,76,69,83,44,
+    68,66,71,44,75,2,18,44,66,2,53,44,36,40,161,2,63,41,41,41,
+    62,0,6,51,82,69,76,62,0,3,137,1,6,64,0,0,41,1,1,156,
+    0,0,64,0,98,10,97,108,108,58,32,85,0,102,66,73,78,41,10,10,
+    12,0,4,24,0,1,75,1,192,9,109,107,100,105,114,32,45,112,32,36,
+    40,9,0,160,36,64,41,10,9,36,40,67,88,88,114,1,6,148,0,198,
+    32,45,111,32,36,64,32,36,94,32,36,40,194,2,55,41,10,10,204,0,
+    4,62,2,22,58,55,3,3,131,0,0,255,0,95,71,67,72,41,10,111,
+    0,22,2,175,0,0,56,0,2,212,0,0,73,0,3,124,1,114,41,32,
+    45,99,32,36,60,146,0,35,10,10,9,1,0,214,0,0,3,1,4,238,
+    0,4,12,0,4,24,0,15,238,0,16,0,51,0,3,110,0,12,238,0,
+    3,87,2,5,240,0,3,117,0,15,242,0,3,0,72,0,0,186,0,15,
+    242,0,16,0,43,0,3,115,0,2,224,2,0,56,0,5,17,0,4,110,
+    2,11,242,0,20,45,0,3,2,37,1,144,79,66,74,58,46,111,61,46,
+    100,178,1,0,81,0,6,17,0,119,10,10,116,101,115,116,58,119,1,8,
+    175,1,63,98,105,110,236,1,4,16,73,55,0,16,115,98,1,11,48,0,
+    16,47,25,0,96,95,109,97,116,104,32,10,0,22,115,16,0,0,37,5,
+    79,10,9,46,47,49,0,6,160,10,10,118,97,108,103,114,105,110,100,147,
+    1,0,90,2,1,171,1,20,9,22,0,242,26,32,45,45,108,101,97,107,
+    45,99,104,101,99,107,61,102,117,108,108,32,45,45,116,114,97,99,107,45,
+    111,114,105,103,105,110,115,61,121,101,115,32,46,47,246,0,1,61,0,74,
+    10,114,117,110,78,0,13,31,0,19,45,171,1,0,39,0,0,29,1,1,
+    56,0,16,9,39,0,5,14,0,242,0,10,99,108,101,97,110,58,10,9,
+    114,109,32,45,114,102,195,5,240,7,10,10,104,101,108,112,58,32,35,35,
+    32,83,104,111,119,115,32,116,104,105,115,32,20,0,245,13,10,9,64,101,
+    99,104,111,32,34,65,118,97,105,108,97,98,108,101,32,116,97,114,103,101,
+    116,115,58,34,28,0,16,32,5,4,20,32,1,0,48,45,32,66,62,6,
+    17,32,62,6,80,32,118,101,114,115,151,6,152,40,100,101,102,97,117,108,
+    116,41,55,0,3,175,0,1,58,0,4,55,0,146,111,112,116,105,109,105,
+    122,101,100,48,7,97,97,112,112,108,105,99,219,6,8,58,0,0,145,1,
+    1,55,0,98,32,32,32,45,32,67,114,5,1,129,5,50,114,117,110,175,
+    1,8,47,0,0,21,0,6,47,0,61,82,117,110,93,0,51,32,105,110,
+    178,0,75,109,111,100,101,60,0,4,88,1,63,32,45,32,60,0,5,4,
+    203,0,12,62,0,5,242,1,1,169,0,0,62,0,2,24,1,7,216,0,
+    100,32,119,105,116,104,32,41,0,8,123,0,1,172,1,3,184,0,129,45,
+    32,82,101,109,111,118,101,108,1,5,99,6,2,225,5,248,0,97,110,100,
+    32,100,105,114,101,99,116,111,114,105,101,115,67,0,0,197,1,3,66,0,
+    33,32,45,222,1,6,221,1,6,40,0,6,10,0,32,79,112,70,8,10,
+    222,1,83,80,67,72,61,49,69,0,53,45,32,80,226,6,243,6,32,116,
+    104,101,32,109,111,115,116,32,102,114,101,113,117,101,110,116,108,121,32,176,
+    3,34,100,32,171,8,3,102,6,9,148,0,3,251,6,16,61,37,8,0,
+    83,1,2,144,7,19,32,213,0,17,114,199,1,1,32,9,99,32,102,114,
+    111,109,32,95,7,32,115,47,48,0,56,46,109,107,75,7,241,9,32,116,
+    117,110,101,41,34,10,10,70,79,82,67,69,58,10,10,46,80,72,79,78,
+    89,58,38,1,4,148,1,1,45,2,0,3,2,53,114,117,110,203,1,4,
+    112,1,18,32,101,1,1,40,1,1,69,0,0,241,53,35,112,114,97,103,
+    109,97,32,111,110,99,101,10,10,35,105,110,99,108,117,100,101,32,60,83,
+    70,77,76,47,71,114,97,112,104,105,99,115,46,104,112,112,62,10,10,99,
+    108,97,115,115,32,71,97,109,101,32,123,10,112,117,98,108,105,99,58,10,
+    32,32,32,19,0,49,40,41,59,12,0,128,118,111,105,100,32,114,117,110,
+    16,0,130,10,112,114,105,118,97,116,101,38,0,1,26,0,208,112,114,111,
+    99,101,115,115,69,118,101,110,116,115,36,0,0,64,0,1,26,0,105,117,
+    112,100,97,116,101,19,0,96,114,101,110,100,101,114,19,0,1,91,0,81,
+    115,102,58,58,82,19,0,129,87,105,110,100,111,119,32,119,7,0,2,120,
+    0,0,29,0,208,67,105,114,99,108,101,83,104,97,112,101,32,115,6,0,
+    80,59,10,125,59,10,240,10,35,105,110,99,108,117,100,101,32,34,103,97,
+    109,101,46,104,34,10,10,71,97,109,101,58,58,6,0,240,28,40,41,32,
+    58,32,119,105,110,100,111,119,40,115,102,58,58,86,105,100,101,111,77,111,
+    100,101,40,56,48,48,44,32,54,48,48,41,44,32,34,83,70,77,76,32,
+    47,0,250,16,34,41,32,123,10,32,32,32,32,115,104,97,112,101,46,115,
+    101,116,82,97,100,105,117,115,40,53,48,46,102,41,59,27,0,145,70,105,
+    108,108,67,111,108,111,114,90,0,1,10,0,124,58,58,71,114,101,101,110,
+    42,0,240,2,80,111,115,105,116,105,111,110,40,51,55,53,46,102,44,32,
+    50,7,0,161,41,59,10,125,10,10,118,111,105,100,123,0,100,58,58,114,
+    117,110,40,128,0,114,119,104,105,108,101,32,40,186,0,148,46,105,115,79,
+    112,101,110,40,41,30,0,0,162,0,227,112,114,111,99,101,115,115,69,118,
+    101,110,116,115,40,114,0,0,25,0,104,117,112,100,97,116,101,18,0,100,
+    114,101,110,100,101,114,18,0,27,125,119,0,11,73,0,4,1,1,49,102,
+    58,58,92,0,32,32,101,98,0,2,251,0,10,150,0,65,112,111,108,108,
+    35,0,17,40,35,0,9,158,0,50,105,102,32,22,0,144,46,116,121,112,
+    101,32,61,61,32,126,1,1,46,0,145,58,58,67,108,111,115,101,100,41,
+    78,1,0,178,0,0,4,0,3,234,0,16,99,27,0,15,170,0,5,4,
+    218,0,3,163,0,33,47,47,57,1,187,32,108,111,103,105,99,32,104,101,
+    114,101,218,0,4,248,0,3,48,0,5,99,0,37,101,97,13,1,3,20,
+    0,81,100,114,97,119,40,244,1,3,73,1,4,24,0,96,105,115,112,108,
+    97,121,145,0,32,125,10,240,26,35,105,110,99,108,117,100,101,32,34,103,
+    97,109,101,46,104,34,10,10,105,110,116,32,109,97,105,110,40,41,32,123,
+    10,32,32,32,32,71,97,109,101,32,31,0,17,59,15,0,0,10,0,98,
+    46,114,117,110,40,41,16,0,1,21,0,192,114,101,116,117,114,110,32,48,
+    59,10,125,10,240,56,67,88,88,32,61,32,103,43,43,10,79,80,84,73,
+    77,73,90,65,84,73,79,78,95,76,69,86,69,76,32,61,32,45,79,50,
+    10,83,82,67,32,61,32,36,40,119,105,108,100,99,97,114,100,32,115,114,
+    99,47,42,46,99,112,112,41,10,73,78,67,76,85,68,69,83,43,0,240,
+    16,73,105,110,99,108,117,100,101,10,10,35,32,83,70,77,76,32,108,105,
+    110,107,105,110,103,32,102,108,97,103,115,10,19,0,65,95,76,73,66,44,
+    0,242,1,108,115,102,109,108,45,103,114,97,112,104,105,99,115,32,45,16,
+    0,100,119,105,110,100,111,119,14,0,96,115,121,115,116,101,109,78,0,91,
+    66,111,120,50,68,79,0,86,66,79,88,50,68,80,0,80,98,111,120,50,
+    100,44,0,240,35,84,104,101,32,104,101,97,100,108,101,115,115,32,98,101,
+    110,99,104,109,97,114,107,32,115,116,101,112,115,32,119,111,114,108,100,115,
+    32,111,110,32,115,116,100,58,58,116,104,114,101,97,100,22,0,166,107,101,
+    114,115,10,84,72,82,69,65,84,0,18,112,31,0,0,85,0,243,1,67,
+    111,109,98,105,110,101,100,32,108,105,98,114,97,114,121,211,0,52,65,76,
+    76,130,0,37,36,40,224,0,70,41,32,36,40,158,0,0,14,0,7,89,
+    0,16,41,79,0,241,21,61,61,61,32,68,101,98,117,103,32,99,111,110,
+    102,105,103,117,114,97,116,105,111,110,32,61,61,61,10,68,66,71,95,70,
+    76,65,71,39,1,116,87,97,108,108,32,36,40,102,1,65,41,32,45,103,
+    33,0,49,79,66,74,147,1,129,112,97,116,115,117,98,115,116,147,1,16,
+    37,147,1,144,44,32,98,117,105,108,100,47,100,95,0,241,2,47,111,98,
+    106,47,37,46,111,44,32,36,40,83,82,67,41,41,61,0,89,66,73,78,
+    32,61,39,0,240,6,98,105,110,47,123,123,112,114,111,106,101,99,116,95,
+    110,97,109,101,125,125,10,171,1,112,95,68,69,66,85,71,32,254,1,4,
+    236,0,5,193,0,127,82,101,108,101,97,115,101,195,0,0,63,82,69,76,
+    195,0,8,46,36,40,106,2,32,41,10,52,0,15,214,0,15,18,114,116,
+    0,14,216,0,0,63,0,8,216,0,4,41,0,15,218,0,2,52,10,35,
+    32,189,0,241,8,112,114,111,102,105,108,101,32,97,110,100,32,112,114,101,
+    99,111,109,112,105,108,101,100,66,2,240,24,101,114,32,114,117,108,101,115,
+    32,40,99,112,112,115,116,97,114,116,101,114,46,109,107,41,10,80,82,79,
+    70,73,76,69,95,84,65,82,71,69,84,169,1,35,36,40,129,0,0,238,
+    1,0,11,0,83,79,66,74,41,10,16,3,25,32,63,0,2,88,1,126,
+    82,69,76,69,65,83,69,90,1,128,69,109,105,116,32,46,100,32,150,0,
+    240,2,115,32,110,101,120,116,32,116,111,32,101,97,99,104,32,111,98,159,
+    1,52,32,115,111,158,0,176,101,100,105,116,115,32,116,114,105,103,103,172,
+    0,4,190,0,85,115,10,68,69,80,67,2,240,20,77,77,68,32,45,77,
+    80,10,10,46,68,69,70,65,85,76,84,95,71,79,65,76,32,58,61,32,
+    97,108,108,10,36,40,101,118,97,99,2,16,99,106,2,231,80,67,72,95,
+    82,85,76,69,83,44,68,66,71,44,73,2,18,44,64,2,53,44,36,40,
+    159,2,63,41,41,41,62,0,6,51,82,69,76,62,0,3,136,1,6,64,
+    0,0,29,1,1,156,0,0,64,0,98,10,97,108,108,58,32,85,0,102,
+    66,73,78,41,10,10,12,0,4,24,0,1,74,1,192,9,109,107,100,105,
+    114,32,45,112,32,36,40,9,0,160,36,64,41,10,9,36,40,67,88,88,
+    113,1,6,148,0,198,32,45,111,32,36,64,32,36,94,32,36,40,192,2,
+    55,41,10,10,204,0,4,61,2,22,58,53,3,3,131,0,0,255,0,95,
+    71,67,72,41,10,111,0,22,2,175,0,0,56,0,2,212,0,0,73,0,
+    3,124,1,114,41,32,45,99,32,36,60,146,0,35,10,10,9,1,0,214,
+    0,0,3,1,4,238,0,4,12,0,4,24,0,15,238,0,16,0,51,0,
+    3,110,0,12,238,0,3,86,2,5,240,0,3,117,0,15,242,0,3,0,
+    72,0,0,186,0,15,242,0,16,0,43,0,3,115,0,2,234,2,0,56,
+    0,5,17,0,4,110,2,11,242,0,20,45,255,2,2,37,1,144,79,66,
+    74,58,46,111,61,46,100,178,1,0,81,0,6,17,0,0,19,5,0,183,
+    5,66,115,99,101,110,139,3,24,116,197,5,194,114,101,112,111,114,116,32,
+    110,101,101,100,32,10,6,129,98,117,116,32,110,111,32,119,47,6,16,44,
+    18,3,0,49,0,114,116,101,115,116,115,10,35,218,4,1,210,3,242,16,
+    114,117,110,32,119,105,116,104,111,117,116,32,97,32,100,105,115,112,108,97,
+    121,10,72,69,65,68,76,69,83,83,95,217,6,0,206,6,129,112,104,121,
+    115,105,99,115,95,130,0,0,71,5,1,28,2,4,71,6,17,95,71,6,
+    0,23,0,32,10,10,101,0,23,58,33,2,8,89,2,63,98,105,110,150,
+    2,4,16,73,55,0,16,115,12,2,11,48,0,16,47,25,0,20,95,105,
+    0,16,32,14,0,26,115,20,0,0,119,0,56,32,36,40,181,0,0,66,
+    1,8,97,6,3,62,7,5,78,7,41,36,40,113,6,63,9,46,47,118,
+    0,10,160,10,10,118,97,108,103,114,105,110,100,134,2,0,77,3,1,158,
+    2,20,9,22,0,242,26,32,45,45,108,101,97,107,45,99,104,101,99,107,
+    61,102,117,108,108,32,45,45,116,114,97,99,107,45,111,114,105,103,105,110,
+    115,61,121,101,115,32,46,47,233,1,1,61,0,74,10,114,117,110,78,0,
+    13,31,0,19,45,158,2,0,39,0,0,16,2,1,56,0,16,9,39,0,
+    5,14,0,0,73,8,32,116,114,201,7,241,8,109,111,100,101,58,32,100,
+    114,111,112,32,66,79,68,73,69,83,32,98,111,120,101,115,230,1,193,112,
+    114,105,110,116,32,102,114,97,109,101,44,232,7,1,22,0,81,100,114,97,
+    119,45,214,4,99,115,116,97,116,115,10,55,0,145,63,61,32,50,48,48,
+    48,10,115,88,0,15,124,0,7,160,32,45,45,98,111,100,105,101,115,32,
+    205,7,0,114,0,1,249,6,44,72,101,90,8,128,58,32,87,79,82,76,
+    68,83,70,8,1,92,8,26,102,162,0,145,102,111,114,32,84,73,67,75,
+    83,155,0,38,115,44,185,2,19,10,57,0,82,63,61,32,52,10,35,0,
+    116,63,61,32,54,48,48,10,16,2,15,159,0,10,4,37,0,15,170,0,
+    0,51,32,45,45,234,8,34,36,40,101,0,16,41,179,1,48,105,99,107,
+    207,0,1,107,0,242,2,41,10,10,99,108,101,97,110,58,10,9,114,109,
+    32,45,114,102,55,3,0,139,3,16,67,232,1,51,32,105,102,237,8,0,
+    4,1,225,97,114,101,32,105,110,115,116,97,108,108,101,100,10,9,2,241,
+    0,45,100,101,112,115,58,10,9,64,101,99,104,111,32,34,53,0,0,237,
+    9,242,8,100,101,112,101,110,100,101,110,99,105,101,115,46,46,46,34,10,
+    9,64,112,107,103,45,233,8,170,32,45,45,101,120,105,115,116,115,32,0,
+    10,50,38,38,32,71,0,50,226,156,147,60,10,149,102,111,117,110,100,34,
+    32,124,124,25,0,18,151,25,0,66,110,111,116,32,29,0,15,90,0,4,
+    1,10,10,25,32,82,0,2,54,4,2,54,0,10,83,0,2,26,0,9,
+    84,0,2,137,0,35,73,102,108,4,53,105,115,32,31,0,86,32,118,105,
+    97,32,206,0,240,1,44,32,105,116,32,109,105,103,104,116,32,115,116,105,
+    108,108,3,2,16,107,57,1,5,43,1,18,32,196,10,240,13,45,119,105,
+    100,101,34,10,10,104,101,108,112,58,32,35,35,32,83,104,111,119,115,32,
+    116,104,105,115,32,20,0,5,70,1,240,3,65,118,97,105,108,97,98,108,
+    101,32,116,97,114,103,101,116,115,58,64,1,2,146,0,16,32,177,7,20,
+    32,1,0,48,45,32,66,232,9,17,32,232,9,80,32,118,101,114,115,65,
+    10,152,40,100,101,102,97,117,108,116,41,55,0,3,104,3,1,58,0,4,
+    55,0,145,111,112,116,105,109,105,122,101,100,85,1,18,43,7,1,97,97,
+    112,112,108,105,99,139,10,8,64,0,0,149,4,1,61,0,98,32,32,32,
+    45,32,67,35,9,1,100,3,0,96,5,0,122,5,1,55,5,193,32,100,
+    101,116,101,114,109,105,110,105,115,109,30,0,5,161,2,3,193,5,0,72,
+    0,24,115,89,0,0,63,0,6,89,0,71,82,117,110,32,130,0,51,32,
+    105,110,221,0,0,252,3,11,55,0,4,60,4,63,32,45,32,55,0,0,
+    4,241,0,12,57,0,2,244,3,2,114,0,2,57,0,4,42,0,1,32,
+    5,1,43,6,10,189,3,4,80,1,1,52,4,17,41,214,0,2,110,4,
+    0,62,1,41,110,103,206,0,5,239,0,1,39,1,75,83,116,101,112,26,
+    4,5,77,0,59,52,41,32,22,4,21,32,28,0,65,54,48,48,41,137,
+    0,56,111,117,116,245,0,2,182,0,4,6,0,19,97,252,6,34,59,32,
+    143,0,0,222,12,240,7,32,112,101,114,99,101,110,116,105,108,101,115,44,
+    32,116,104,114,111,117,103,104,112,250,6,49,110,100,32,166,1,152,116,97,
+    116,101,32,104,97,115,104,89,0,5,230,5,1,183,0,0,78,1,2,83,
+    2,8,139,1,0,68,7,20,32,41,0,8,61,0,6,10,4,1,27,2,
+    4,57,4,0,11,13,1,45,1,3,88,2,8,62,4,9,63,0,0,130,
+    4,3,212,0,129,45,32,82,101,109,111,118,101,230,2,5,136,11,2,7,
+    11,235,97,110,100,32,100,105,114,101,99,116,111,114,105,101,118,1,35,108,
+    112,66,0,33,32,45,88,3,6,87,3,6,107,0,6,10,0,32,79,112,
+    106,13,10,88,3,2,27,6,32,61,78,72,0,179,45,32,78,117,109,98,
+    101,114,32,111,102,99,6,0,171,1,98,39,109,97,107,101,32,64,2,17,
+    39,218,0,2,18,0,4,244,1,22,39,97,0,112,32,32,80,67,72,61,
+    49,76,0,1,82,1,36,80,114,152,11,1,133,1,48,109,111,115,172,6,
+    147,101,113,117,101,110,116,108,121,32,37,9,19,100,42,4,3,219,11,9,
+    227,0,3,111,12,16,61,152,13,0,241,2,2,4,13,19,32,36,1,17,
+    114,143,0,1,99,15,99,32,102,114,111,109,32,211,12,32,115,47,48,0,
+    56,46,109,107,191,12,241,9,32,116,117,110,101,41,34,10,10,70,79,82,
+    67,69,58,10,10,46,80,72,79,78,89,58,117,1,4,13,3,0,168,3,
+    16,32,156,3,53,114,117,110,105,3,2,252,0,1,159,0,16,108,145,7,
+    4,14,2,17,32,70,6,1,198,4,23,32,14,2,1,96,0,0,248,27,
+    35,112,114,97,103,109,97,32,111,110,99,101,10,10,35,105,110,99,108,117,
+    100,101,32,60,83,70,77,76,47,71,114,97,112,104,105,99,115,46,104,112,
+    112,62,30,0,104,118,101,99,116,111,114,19,0,241,29,34,112,104,121,115,
+    105,99,115,95,115,99,101,110,101,46,104,34,10,10,47,47,32,68,114,97,
+    119,115,32,101,118,101,114,121,32,98,111,100,121,32,111,102,32,97,32,35,
+    0,240,23,32,119,105,116,104,32,111,110,101,32,100,114,97,119,32,99,97,
+    108,108,46,32,69,97,99,104,32,98,111,120,32,111,119,110,115,32,115,105,
+    120,69,0,240,52,118,101,114,116,105,99,101,115,32,40,116,119,111,32,116,
+    114,105,97,110,103,108,101,115,41,32,97,116,32,97,32,102,105,120,101,100,
+    32,111,102,102,115,101,116,59,32,117,112,100,97,116,101,40,41,32,114,101,
+    119,114,105,116,101,115,32,116,104,101,105,114,71,0,240,8,112,111,115,105,
+    116,105,111,110,115,32,105,110,32,112,108,97,99,101,32,102,114,111,109,33,
+    0,241,27,32,66,111,120,50,68,32,116,114,97,110,115,102,111,114,109,115,
+    44,32,115,111,32,110,111,116,104,105,110,103,32,105,115,32,97,108,108,111,
+    99,97,116,101,100,73,0,229,101,114,32,102,114,97,109,101,46,32,84,104,
+    101,32,159,0,160,103,111,32,116,104,114,111,117,103,104,228,0,240,14,116,
+    114,101,97,109,101,100,32,115,102,58,58,86,101,114,116,101,120,66,117,102,
+    102,101,114,32,119,104,101,110,117,0,0,75,0,245,14,100,114,105,118,101,
+    114,32,115,117,112,112,111,114,116,115,32,105,116,44,32,111,116,104,101,114,
+    119,105,115,101,78,0,55,116,104,101,71,0,240,6,65,114,114,97,121,32,
+    100,105,114,101,99,116,108,121,46,10,99,108,97,115,115,194,0,248,16,82,
+    101,110,100,101,114,101,114,32,123,10,112,117,98,108,105,99,58,10,32,32,
+    32,32,101,120,112,108,105,99,105,116,35,0,194,40,99,111,110,115,116,32,
+    115,116,100,58,58,204,1,160,60,66,111,120,66,111,100,121,62,38,169,1,
+    97,105,101,115,41,59,10,63,0,128,47,47,32,83,108,101,101,112,10,1,
+    163,97,110,100,32,115,116,97,116,105,99,37,0,80,32,107,101,101,112,205,
+    0,117,105,114,32,108,97,115,116,13,1,1,59,0,68,118,111,105,100,146,
+    1,15,113,0,26,97,82,101,116,117,114,110,188,1,112,32,110,117,109,98,
+    101,114,57,2,5,40,2,129,115,32,105,115,115,117,101,100,101,0,129,117,
+    110,115,105,103,110,101,100,71,2,16,40,110,1,2,8,1,145,84,97,114,
+    103,101,116,38,32,116,8,0,0,206,0,114,112,114,105,118,97,116,101,22,
+    1,1,156,0,1,35,2,65,66,111,120,40,9,1,226,115,105,122,101,95,
+    116,32,105,110,100,101,120,44,32,177,0,3,22,1,0,21,1,16,120,68,
+    0,0,81,1,0,100,0,2,210,1,2,139,1,4,1,2,17,59,144,0,
+    6,30,0,3,240,1,17,98,247,1,2,29,0,130,98,111,111,108,32,117,
+    115,101,27,0,80,59,10,125,59,10,247,17,35,112,114,97,103,109,97,32,
+    111,110,99,101,10,10,35,105,110,99,108,117,100,101,32,60,99,115,116,100,
+    105,110,116,62,19,0,240,66,118,101,99,116,111,114,62,10,10,47,47,32,
+    83,116,101,112,115,32,105,110,100,101,112,101,110,100,101,110,116,32,80,104,
+    121,115,105,99,115,83,99,101,110,101,32,119,111,114,108,100,115,32,119,105,
+    116,104,111,117,116,32,97,32,119,105,110,100,111,119,44,32,102,111,114,32,
+    109,101,97,115,117,114,105,110,103,73,0,18,112,55,0,248,1,32,99,111,
+    115,116,32,111,110,32,109,97,99,104,105,110,101,60,0,177,100,105,115,112,
+    108,97,121,32,97,110,100,64,0,241,21,98,97,116,99,104,32,115,105,109,
+    117,108,97,116,105,111,110,115,46,10,115,116,114,117,99,116,32,72,101,97,
+    100,108,101,115,115,79,112,24,0,164,32,123,10,32,32,32,32,105,110,116,
+    145,0,64,61,32,49,59,19,0,103,32,32,47,47,32,73,190,0,48,98,
+    50,87,179,0,165,32,105,110,115,116,97,110,99,101,115,58,0,178,116,105,
+    99,107,115,32,61,32,54,48,48,59,0,241,2,47,47,32,70,105,120,101,
+    100,32,49,47,54,48,32,115,32,115,11,1,50,112,101,114,101,0,5,57,
+    0,80,98,111,100,105,101,58,0,34,49,48,59,0,158,47,47,32,66,111,
+    120,101,115,32,44,0,96,116,104,114,101,97,100,45,0,6,101,0,115,87,
+    111,114,107,101,114,32,27,0,193,59,32,48,32,117,115,101,115,32,111,110,
+    101,65,0,131,104,97,114,100,119,97,114,101,33,0,76,10,125,59,10,7,
+    1,99,82,101,112,111,114,116,6,1,82,115,116,100,58,58,195,1,17,60,
+    12,0,240,2,117,105,110,116,54,52,95,116,62,32,104,97,115,104,101,115,
+    59,20,1,177,70,105,110,97,108,32,115,116,97,116,101,23,0,1,107,0,
+    1,206,1,1,216,0,1,57,0,3,69,0,113,100,111,117,98,108,101,62,
+    0,1,113,83,101,99,111,110,100,115,33,1,129,47,47,32,69,118,101,114,
+    121,25,0,81,32,111,102,32,101,14,0,1,69,0,129,44,32,115,111,114,
+    116,101,100,77,0,2,65,0,83,32,119,97,108,108,64,0,113,32,61,32,
+    48,46,48,59,30,0,1,107,0,244,0,115,105,122,101,95,116,32,100,121,
+    110,97,109,105,99,66,82,1,3,37,1,0,177,0,29,80,120,1,3,49,
+    1,0,76,0,33,59,10,75,0,3,105,0,180,112,101,114,99,101,110,116,
+    105,108,101,40,18,0,129,41,32,99,111,110,115,116,59,16,2,33,79,102,
+    179,0,3,140,0,216,44,32,112,32,105,110,32,91,48,44,32,49,93,71,
+    0,65,98,111,100,121,255,2,50,80,101,114,44,0,25,40,71,0,10,173,
+    0,34,120,32,65,2,18,120,30,2,49,115,32,47,241,0,81,32,116,105,
+    109,101,86,0,247,3,98,111,111,108,32,100,101,116,101,114,109,105,110,105,
+    115,116,105,99,79,0,2,172,2,0,232,0,2,83,1,1,69,1,16,32,
+    114,3,16,100,157,0,130,116,104,101,32,115,97,109,101,177,1,1,3,2,
+    182,47,47,32,79,110,101,32,116,97,115,107,188,1,243,17,44,32,116,97,
+    107,101,110,32,102,114,111,109,32,97,32,115,104,97,114,101,100,32,113,117,
+    101,117,101,32,98,121,32,96,51,1,16,96,164,0,82,107,101,114,115,46,
+    194,1,0,160,3,2,114,0,130,105,115,32,98,117,105,108,116,66,0,6,
+    119,0,0,237,3,0,212,1,129,32,116,104,101,105,114,32,102,62,2,2,
+    79,2,192,32,109,117,115,116,32,97,103,114,101,101,59,73,0,80,99,111,
+    109,112,97,246,3,0,44,0,2,92,2,177,97,99,114,111,115,115,32,114,
+    117,110,115,221,3,5,252,3,48,99,104,101,117,3,244,2,114,101,112,114,
+    111,100,117,99,105,98,105,108,105,116,121,46,10,224,3,3,217,2,52,114,
+    117,110,18,0,17,40,200,1,12,1,4,50,38,32,111,10,4,228,41,59,
+    10,10,118,111,105,100,32,112,114,105,110,116,53,0,2,71,0,15,59,0,
+    12,18,44,35,2,5,91,0,2,53,0,49,38,32,114,93,3,48,41,59,
+    10,247,33,35,112,114,97,103,109,97,32,111,110,99,101,10,10,35,105,110,
+    99,108,117,100,101,32,60,83,70,77,76,47,71,114,97,112,104,105,99,115,
+    47,67,111,108,111,114,46,104,112,112,62,35,0,97,98,111,120,50,100,47,
+    6,0,56,46,104,62,61,0,120,99,115,116,100,105,110,116,45,0,241,50,
+    118,101,99,116,111,114,62,10,10,47,47,32,80,105,120,101,108,115,32,112,
+    101,114,32,66,111,120,50,68,32,109,101,116,101,114,10,99,111,110,115,116,
+    101,120,112,114,32,102,108,111,97,116,32,83,67,65,76,69,32,61,32,51,
+    48,46,48,102,59,58,0,240,51,79,110,101,32,98,111,120,45,115,104,97,
+    112,101,100,32,98,111,100,121,46,32,84,104,101,32,115,99,101,110,101,32,
+    107,101,101,112,115,32,116,104,101,109,32,105,110,32,97,32,99,111,110,116,
+    105,103,117,111,117,115,32,97,114,114,97,121,32,115,111,30,0,0,132,0,
+    240,2,114,101,110,100,101,114,101,114,32,99,97,110,32,119,97,108,107,25,
+    0,1,55,0,240,4,111,114,100,101,114,32,97,110,100,32,103,105,118,101,
+    32,101,97,99,104,116,0,208,32,97,32,102,105,120,101,100,32,115,108,111,
+    116,95,0,48,105,116,115,73,0,98,118,101,114,116,101,120,96,0,128,46,
+    10,115,116,114,117,99,116,215,0,208,66,111,100,121,32,123,10,32,32,32,
+    32,98,50,13,0,17,42,175,0,19,59,18,0,240,7,86,101,99,50,32,
+    104,97,108,102,69,120,116,101,110,116,115,59,32,47,47,32,77,8,1,17,
+    115,34,0,65,115,102,58,58,118,1,32,32,99,124,1,241,5,59,10,125,
+    59,10,10,99,108,97,115,115,32,80,104,121,115,105,99,115,83,243,0,145,
+    123,10,112,117,98,108,105,99,58,54,0,65,47,47,32,65,246,0,241,0,
+    97,105,110,101,114,32,111,102,32,103,114,111,117,110,100,207,0,48,116,119,
+    111,234,0,113,108,115,46,32,87,105,116,213,0,241,3,67,111,117,110,116,
+    32,61,61,32,48,32,97,32,115,105,110,103,108,96,1,4,76,0,145,100,
+    114,111,112,115,32,111,110,116,55,1,3,76,0,161,59,32,111,116,104,101,
+    114,119,105,115,44,0,2,67,0,112,115,109,97,108,108,101,114,41,1,16,
+    101,109,1,148,101,32,115,116,97,99,107,101,100,75,0,32,105,110,201,0,
+    225,117,109,110,115,32,97,98,111,118,101,32,105,116,46,28,0,8,206,0,
+    18,40,249,1,82,119,105,100,116,104,37,2,19,44,12,2,100,104,101,105,
+    103,104,116,20,0,48,105,110,116,106,0,1,123,0,49,41,59,10,72,0,
+    0,251,0,96,100,118,97,110,99,101,202,1,211,32,119,111,114,108,100,32,
+    98,121,32,111,110,101,185,1,177,49,47,54,48,32,115,32,115,116,101,112,
+    50,0,65,118,111,105,100,14,0,23,40,68,0,176,70,78,86,45,49,97,
+    32,104,97,115,104,63,1,81,101,118,101,114,121,185,1,225,39,115,32,112,
+    111,115,105,116,105,111,110,44,32,97,42,1,0,36,2,176,118,101,108,111,
+    99,105,116,105,101,115,44,21,2,1,103,2,1,94,0,49,47,47,32,74,
+    2,178,46,32,73,100,101,110,116,105,99,97,108,166,2,2,130,0,0,191,
+    2,20,105,25,0,34,108,121,113,0,16,116,202,2,50,97,109,101,26,1,
+    208,115,116,100,58,58,117,105,110,116,54,52,95,116,80,1,128,116,101,72,
+    97,115,104,40,41,226,1,38,115,116,248,0,80,66,111,100,105,101,248,2,
+    64,97,116,32,109,92,1,17,40,183,0,145,116,104,105,110,103,32,98,117,
+    116,17,1,0,12,3,1,22,2,17,41,159,0,1,93,0,225,115,105,122,
+    101,95,116,32,100,121,110,97,109,105,99,79,1,11,94,0,1,148,3,17,
+    32,45,0,2,194,3,64,60,66,111,120,206,2,32,62,38,22,1,52,105,
+    101,115,49,0,144,32,123,32,114,101,116,117,114,110,154,1,226,101,115,59,
+    32,125,10,10,112,114,105,118,97,116,101,156,2,1,111,1,114,97,100,100,
+    66,111,120,40,18,3,209,84,121,112,101,32,116,121,112,101,44,32,98,50,
+    17,3,6,98,1,3,17,0,7,34,3,43,44,32,20,3,4,182,1,49,
+    98,50,87,237,1,1,243,1,2,96,3,15,177,0,1,3,152,0,0,73,
+    3,0,247,106,35,105,110,99,108,117,100,101,32,34,98,111,120,95,114,101,
+    110,100,101,114,101,114,46,104,34,10,10,110,97,109,101,115,112,97,99,101,
+    32,123,10,10,47,47,32,84,119,111,32,116,114,105,97,110,103,108,101,115,
+    32,112,101,114,32,98,111,120,58,32,99,111,114,110,101,114,115,32,48,45,
+    49,45,50,32,97,110,100,32,48,45,50,45,51,10,99,111,110,115,116,32,
+    105,110,116,32,86,69,82,84,73,67,69,83,95,80,69,82,95,66,79,88,
+    32,61,32,54,59,32,0,160,67,79,82,78,69,82,95,79,70,95,42,0,
+    48,69,88,91,7,0,8,49,0,241,0,93,32,61,32,123,48,44,32,49,
+    44,32,50,44,32,48,6,0,165,51,125,59,10,10,125,32,47,47,32,168,
+    0,99,10,10,66,111,120,82,195,0,39,58,58,13,0,18,40,141,0,244,
+    35,115,116,100,58,58,118,101,99,116,111,114,60,66,111,120,66,111,100,121,
+    62,38,32,98,111,100,105,101,115,41,10,32,32,32,32,58,32,118,101,114,
+    116,105,99,101,115,40,115,102,58,58,84,239,0,19,44,38,0,157,46,115,
+    105,122,101,40,41,32,42,213,0,33,41,44,65,0,140,32,32,98,117,102,
+    102,101,114,63,0,0,78,0,113,86,101,114,116,101,120,66,32,0,133,58,
+    58,83,116,114,101,97,109,55,0,50,117,115,101,26,0,1,58,0,10,43,
+    0,241,1,105,115,65,118,97,105,108,97,98,108,101,40,41,41,10,123,106,
+    0,240,35,47,47,32,67,111,108,111,114,115,32,110,101,118,101,114,32,99,
+    104,97,110,103,101,59,32,112,111,115,105,116,105,111,110,115,32,97,114,101,
+    32,119,114,105,116,116,101,110,32,102,111,114,32,39,0,16,121,201,0,180,
+    121,32,111,110,99,101,32,104,101,114,101,75,0,0,184,1,241,0,97,102,
+    116,101,114,119,97,114,100,115,32,111,110,108,121,52,0,2,29,1,177,32,
+    116,104,97,116,32,109,111,118,101,100,49,0,0,78,0,17,40,78,1,0,
+    16,1,208,95,116,32,105,32,61,32,48,59,32,105,32,60,96,0,51,105,
+    101,115,41,1,114,59,32,43,43,105,41,32,178,0,0,97,1,1,58,0,
+    0,21,2,18,118,50,0,61,118,32,60,75,1,0,53,0,18,118,144,1,
+    0,51,0,0,4,0,4,150,1,47,91,105,123,1,0,112,32,43,32,118,
+    93,46,99,13,1,35,32,61,128,0,35,91,105,18,0,17,59,177,0,0,
+    68,0,0,11,1,100,101,66,111,120,40,105,206,1,66,91,105,93,41,32,
+    0,17,125,38,0,69,105,102,32,40,136,1,6,129,0,5,19,0,0,94,
+    0,1,190,1,132,46,99,114,101,97,116,101,40,151,0,66,46,103,101,116,
+    179,1,179,67,111,117,110,116,40,41,41,32,38,38,10,2,64,46,117,112,
+    100,44,0,20,38,45,0,32,91,48,118,0,135,125,10,10,118,111,105,100,
+    32,166,2,35,58,58,43,0,15,174,2,17,2,83,1,1,79,1,15,137,
+    1,34,0,236,0,2,221,1,0,43,1,193,98,111,100,121,45,62,73,115,
+    65,119,97,107,100,2,0,49,1,4,4,0,15,57,1,28,0,251,0,4,
+    236,0,13,25,1,70,32,62,32,48,90,1,2,44,3,15,34,1,7,123,
+    117,110,115,105,103,110,101,38,1,80,100,114,97,119,40,81,3,2,236,3,
+    145,84,97,114,103,101,116,38,32,116,8,0,4,31,3,0,224,0,15,134,
+    0,7,40,61,61,135,0,130,114,101,116,117,114,110,32,48,12,2,0,58,
+    0,5,243,1,6,172,0,2,95,0,17,46,125,0,2,184,0,3,60,2,
+    50,101,108,115,71,3,0,48,1,8,38,0,4,127,0,3,40,0,3,102,
+    0,63,49,59,10,252,1,2,5,102,1,9,207,1,98,110,100,101,120,44,
+    32,17,2,3,179,4,0,178,4,20,120,231,0,32,47,47,66,2,241,4,
+    50,68,32,103,105,118,101,115,32,116,104,101,32,99,101,110,116,101,114,138,
+    5,64,114,111,116,97,12,4,193,32,105,110,32,109,101,116,101,114,115,59,
+    32,20,0,18,101,42,0,2,187,5,1,252,2,33,47,47,16,4,112,32,
+    114,97,116,104,101,114,241,3,208,110,32,116,104,114,111,117,103,104,32,97,
+    110,32,111,1,147,84,114,97,110,115,102,111,114,109,253,5,33,100,121,58,
+    0,2,157,0,37,98,50,31,0,53,38,32,116,42,0,0,144,3,34,120,
+    46,95,2,53,71,101,116,36,0,19,40,21,1,2,61,0,166,102,108,111,
+    97,116,32,99,120,32,61,59,0,194,46,112,46,120,32,42,32,83,67,65,
+    76,69,153,1,9,44,0,27,121,44,0,31,121,44,0,8,9,43,0,62,
+    113,46,99,79,0,27,115,35,0,30,115,35,0,16,104,158,0,255,0,98,
+    111,120,46,104,97,108,102,69,120,116,101,110,116,115,162,0,9,16,104,162,
+    0,12,48,0,7,166,0,7,60,1,0,93,1,32,86,101,151,6,36,50,
+    102,80,7,33,91,52,246,6,1,38,0,0,89,2,8,36,0,241,2,40,
+    99,120,32,43,32,99,32,42,32,45,104,120,32,45,32,115,10,0,115,121,
+    44,32,99,121,32,43,14,0,6,34,0,21,121,100,6,17,32,199,1,4,
+    106,0,6,70,0,15,69,0,4,31,104,68,0,34,24,104,136,0,5,67,
+    0,31,104,134,0,15,6,204,0,9,67,0,0,23,0,2,237,0,5,68,
+    0,0,251,7,6,20,1,0,85,7,150,42,32,113,117,97,100,32,61,32,
+    102,5,16,105,59,3,15,46,6,0,18,93,219,1,1,58,5,15,137,6,
+    27,0,99,0,68,91,118,93,46,98,7,37,32,61,173,1,13,195,8,48,
+    118,93,93,232,3,0,245,14,35,105,110,99,108,117,100,101,32,34,104,101,
+    97,100,108,101,115,115,95,98,101,110,99,104,46,104,34,10,10,29,0,184,
+    60,97,108,103,111,114,105,116,104,109,62,21,0,88,116,111,109,105,99,18,
+    0,105,99,104,114,111,110,111,18,0,72,109,97,116,104,17,0,168,102,117,
+    110,99,116,105,111,110,97,108,22,0,122,105,111,109,97,110,105,112,19,0,
+    89,115,116,114,101,97,114,0,88,109,117,116,101,120,37,0,119,116,104,114,
+    101,97,100,62,171,0,225,34,112,104,121,115,105,99,115,95,115,99,101,110,
+    101,199,0,242,17,110,97,109,101,115,112,97,99,101,32,123,10,10,117,115,
+    105,110,103,32,67,108,111,99,107,32,61,32,115,116,100,58,58,182,0,160,
+    58,58,115,116,101,97,100,121,95,99,28,0,241,8,59,10,10,100,111,117,
+    98,108,101,32,115,101,99,111,110,100,115,83,105,110,99,101,40,56,0,250,
+    17,58,58,116,105,109,101,95,112,111,105,110,116,32,115,116,97,114,116,41,
+    10,123,10,32,32,32,32,114,101,116,117,114,110,86,0,64,100,117,114,97,
+    241,0,18,60,80,0,20,62,68,0,115,110,111,119,40,41,32,45,65,0,
+    245,3,46,99,111,117,110,116,40,41,59,10,125,10,10,125,32,47,47,32,
+    182,0,5,138,0,19,72,162,1,242,4,82,101,112,111,114,116,58,58,112,
+    101,114,99,101,110,116,105,108,101,40,92,0,147,32,112,41,32,99,111,110,
+    115,116,143,0,146,105,102,32,40,115,116,101,112,83,195,0,145,46,101,109,
+    112,116,121,40,41,41,172,0,7,176,0,65,48,46,48,59,20,0,1,61,
+    0,2,191,0,193,115,105,122,101,95,116,32,105,110,100,101,120,41,1,161,
+    97,116,105,99,95,99,97,115,116,60,53,1,2,32,0,33,62,40,13,0,
+    152,99,101,105,108,40,112,32,42,32,110,0,0,34,0,66,40,41,41,41,
+    91,0,5,27,1,5,143,0,17,91,59,0,57,109,105,110,164,0,2,54,
+    0,18,44,133,0,58,109,97,120,110,0,1,143,0,64,44,32,49,41,58,
+    1,33,49,93,46,1,3,252,0,12,30,1,194,98,111,100,121,83,116,101,
+    112,115,80,101,114,1,1,26,40,30,1,3,146,0,66,119,97,108,108,32,
+    0,241,8,115,32,62,32,48,46,48,32,63,32,100,121,110,97,109,105,99,
+    66,111,100,105,101,115,215,0,6,254,0,2,111,0,0,249,0,5,202,0,
+    18,46,181,0,72,41,32,47,32,78,0,16,58,78,0,1,163,0,92,98,
+    111,111,108,32,161,0,223,100,101,116,101,114,109,105,110,105,115,116,105,99,
+    156,0,3,1,34,1,64,97,100,106,97,232,1,243,7,95,102,105,110,100,
+    40,104,97,115,104,101,115,46,98,101,103,105,110,40,41,44,32,16,0,48,
+    101,110,100,14,0,1,49,0,249,5,110,111,116,95,101,113,117,97,108,95,
+    116,111,60,62,40,41,41,32,61,61,40,0,1,148,0,10,143,0,68,32,
+    114,117,110,18,0,18,40,7,2,4,15,0,32,79,112,191,2,66,115,38,
+    32,111,9,0,4,237,2,4,32,0,2,143,2,33,32,114,150,2,4,237,
+    1,0,162,2,18,46,158,3,52,115,32,61,59,0,5,18,0,32,62,32,
+    103,1,3,81,0,4,22,0,1,131,2,0,151,2,15,4,0,14,21,58,
+    31,2,51,40,49,117,44,2,2,109,0,240,6,58,58,104,97,114,100,119,
+    97,114,101,95,99,111,110,99,117,114,114,101,110,99,244,2,15,153,0,4,
+    1,49,1,0,132,2,2,191,0,4,139,0,3,84,0,68,109,97,120,40,
+    165,0,112,119,111,114,108,100,115,44,124,2,9,76,0,3,129,1,33,114,
+    101,5,2,10,46,0,49,41,59,10,213,0,1,102,0,17,97,47,5,176,
+    60,105,110,116,62,32,110,101,120,116,87,81,0,35,40,48,32,3,1,35,
+    0,1,224,4,144,32,114,101,115,117,108,116,115,77,237,4,2,107,0,242,
+    5,97,117,116,111,32,119,111,114,107,101,114,32,61,32,91,38,93,40,41,
+    32,114,4,0,43,1,1,59,0,100,118,101,99,116,111,114,101,4,1,137,
+    3,18,115,61,0,2,35,0,181,101,112,115,46,114,101,115,101,114,118,101,
+    211,0,83,116,105,99,107,115,128,0,0,38,0,80,102,111,114,32,40,213,
+    4,1,236,0,38,32,61,167,0,48,43,43,59,128,0,69,108,100,32,60,
+    204,1,1,37,0,20,115,24,0,9,45,0,8,158,0,0,89,0,18,80,
+    148,5,16,83,147,5,17,32,153,5,163,40,56,48,48,46,48,102,44,32,
+    54,8,0,4,57,1,17,98,116,3,7,149,0,0,64,0,0,87,4,112,
+    115,46,99,108,101,97,114,35,5,0,19,0,4,4,0,5,180,0,0,205,
+    0,97,32,61,32,48,59,32,10,0,6,168,0,0,15,0,80,115,59,32,
+    43,43,9,0,12,154,0,0,71,0,2,239,2,15,219,5,4,34,32,61,
+    45,6,33,58,58,177,5,6,83,1,0,58,0,0,4,0,1,207,0,16,
+    46,162,0,12,155,0,1,30,0,0,130,4,185,46,112,117,115,104,95,98,
+    97,99,107,40,78,6,2,60,6,11,236,0,18,125,51,2,0,61,0,0,
+    4,0,1,221,1,0,146,6,98,95,103,117,97,114,100,15,5,1,40,2,
+    32,62,32,23,0,24,40,46,2,11,75,0,3,212,2,2,162,2,17,91,
+    176,1,16,93,204,5,0,135,1,172,46,115,116,97,116,101,72,97,115,104,
+    183,0,3,54,0,10,4,5,18,61,183,1,19,46,22,0,20,67,174,6,
+    0,163,0,4,4,0,3,57,0,0,11,1,3,81,5,143,46,105,110,115,
+    101,114,116,40,26,0,0,5,177,4,0,153,2,5,206,4,0,60,0,33,
+    115,46,28,0,7,204,0,17,125,69,3,19,125,77,3,15,175,1,31,1,
+    68,1,3,33,3,1,12,0,2,44,4,16,62,211,2,51,107,101,114,40,
+    3,5,74,2,163,105,32,61,32,49,59,32,105,32,60,213,4,4,22,4,
+    0,69,2,22,105,62,7,2,145,3,16,115,87,7,66,108,97,99,101,225,
+    1,2,21,0,3,189,0,2,13,0,48,40,41,59,209,7,128,84,104,101,
+    32,99,97,108,108,128,8,2,129,0,83,32,105,115,32,97,133,0,65,32,
+    116,111,111,231,0,1,135,0,7,166,0,35,38,32,45,0,19,58,42,0,
+    22,115,130,0,2,26,0,48,46,106,111,12,6,2,155,2,3,107,1,8,
+    136,6,26,61,196,8,2,118,2,3,77,1,1,105,0,47,115,111,164,1,
+    3,5,151,1,3,85,0,0,158,1,4,218,1,8,164,1,3,74,7,2,
+    38,0,1,93,6,170,118,111,105,100,32,112,114,105,110,116,38,6,15,91,
+    6,12,18,44,191,8,11,43,7,19,38,135,1,4,121,6,2,1,2,1,
+    20,5,16,109,93,6,36,91,93,0,9,3,94,3,53,41,32,123,139,9,
+    2,251,8,80,32,42,32,49,48,106,4,50,59,32,125,40,1,1,249,0,
+    114,99,111,117,116,32,60,60,78,6,85,102,105,120,101,100,14,0,230,115,
+    101,116,112,114,101,99,105,115,105,111,110,40,51,115,1,2,237,2,22,60,
+    95,4,1,87,3,16,115,56,0,16,34,161,1,144,108,100,40,115,41,32,
+    120,32,34,18,0,2,18,1,4,53,3,3,79,8,82,60,60,32,34,32,
+    231,4,0,40,0,1,245,1,2,86,0,0,6,0,7,90,0,0,176,4,
+    3,89,0,2,11,0,41,111,110,87,0,2,254,1,4,34,0,1,10,11,
+    110,40,115,41,92,110,34,83,0,33,34,32,154,8,0,97,0,0,4,0,
+    8,157,0,8,42,2,1,155,0,31,115,66,0,5,0,255,1,69,32,112,
+    53,48,66,0,36,109,115,218,3,7,139,10,96,48,46,53,48,41,41,254,
+    0,63,34,32,109,76,0,12,31,57,76,0,14,31,57,76,0,23,31,57,
+    152,0,13,47,57,57,152,0,20,63,109,97,120,76,0,11,63,49,46,48,
+    152,0,13,1,96,2,9,69,2,31,48,69,2,0,32,34,32,222,3,137,
+    111,117,103,104,112,117,116,32,222,1,15,192,10,2,1,161,1,0,26,0,
+    16,45,141,1,47,115,47,96,1,8,49,97,116,101,245,9,3,86,0,1,
+    144,0,48,104,101,120,153,1,1,12,0,113,115,101,116,119,40,49,54,170,
+    1,4,17,0,143,102,105,108,108,40,39,48,39,170,0,0,4,234,1,2,
+    77,6,0,244,4,0,75,12,99,32,63,32,48,32,58,160,3,19,46,28,
+    0,48,102,114,111,203,12,6,90,0,56,100,101,99,119,0,2,102,0,31,
+    32,102,0,9,12,28,11,179,63,32,34,34,32,58,32,34,32,32,40,112,
+    3,161,68,73,86,69,82,71,69,68,41,34,104,0,64,39,92,110,39,122,
+    4,0,240,21,35,105,110,99,108,117,100,101,32,60,83,70,77,76,47,71,
+    114,97,112,104,105,99,115,46,104,112,112,62,32,47,47,32,70,111,114,32,
+    26,0,35,32,103,26,0,38,10,10,51,0,138,99,115,116,100,108,105,98,
+    62,19,0,72,114,105,110,103,19,0,122,105,111,109,97,110,105,112,19,0,
+    119,115,116,114,101,97,109,62,78,0,246,1,34,98,111,120,95,114,101,110,
+    100,101,114,101,114,46,104,34,85,0,250,0,34,104,101,97,100,108,101,115,
+    115,95,98,101,110,99,104,28,0,208,112,104,121,115,105,99,115,95,115,99,
+    101,110,101,27,0,241,56,10,110,97,109,101,115,112,97,99,101,32,123,10,
+    10,118,111,105,100,32,112,114,105,110,116,85,115,97,103,101,40,99,111,110,
+    115,116,32,99,104,97,114,42,32,112,114,111,103,114,97,109,41,10,123,10,
+    32,32,32,32,115,116,100,58,58,99,111,117,116,32,60,60,32,34,47,0,
+    48,58,32,34,13,0,3,41,0,0,11,0,241,2,34,32,91,45,45,98,
+    111,100,105,101,115,32,78,93,92,110,34,59,0,0,63,0,2,4,0,0,
+    59,0,2,10,0,15,59,0,0,36,45,45,202,0,9,70,0,0,13,0,
+    144,119,111,114,108,100,115,32,87,93,13,0,114,116,105,99,107,115,32,84,
+    12,0,143,104,114,101,97,100,115,32,74,109,0,11,3,116,0,16,32,63,
+    0,255,0,101,120,112,101,99,116,45,104,97,115,104,32,72,69,88,57,0,
+    6,6,201,0,3,62,0,243,13,83,116,114,101,115,115,32,109,111,100,101,
+    58,32,100,114,111,112,32,78,32,98,111,120,101,115,32,97,110,70,1,207,
+    32,102,114,97,109,101,32,116,105,109,101,44,254,0,10,3,83,0,1,7,
+    0,3,164,1,81,32,115,116,101,112,59,0,1,80,0,255,8,100,114,97,
+    119,32,99,97,108,108,115,32,101,118,101,114,121,32,115,101,99,111,110,100,
+    86,0,5,7,61,1,1,85,0,178,32,78,111,32,119,105,110,100,111,119,
+    58,89,0,35,87,32,69,1,37,111,102,184,0,239,40,100,101,102,97,117,
+    108,116,32,49,48,48,48,41,91,0,5,2,80,0,7,6,0,98,102,111,
+    114,32,84,32,135,1,5,67,0,178,54,48,48,41,32,111,110,32,74,32,
+    116,148,1,98,44,32,116,104,101,110,94,2,15,91,0,22,1,4,1,240,
+    4,108,97,116,101,110,99,121,32,112,101,114,99,101,110,116,105,108,101,115,
+    77,0,129,114,111,117,103,104,112,117,116,31,1,32,97,32,193,1,15,88,
+    0,22,32,111,102,142,0,207,32,102,105,110,97,108,32,115,116,97,116,101,
+    59,0,5,41,45,45,33,2,240,1,32,32,69,120,105,116,32,119,105,116,
+    104,32,49,32,117,110,105,3,12,75,0,1,139,0,240,1,101,115,32,116,
+    111,32,72,92,110,34,59,10,125,10,10,125,31,4,5,108,3,176,10,10,
+    105,110,116,32,109,97,105,110,40,9,0,83,97,114,103,99,44,103,3,100,
+    97,114,103,118,91,93,102,3,0,30,0,225,98,111,100,121,67,111,117,110,
+    116,32,61,32,48,59,66,3,85,98,111,111,108,32,30,3,114,61,32,102,
+    97,108,115,101,27,0,34,72,101,254,3,117,79,112,116,105,111,110,115,38,
+    0,3,16,0,2,37,0,8,216,3,2,223,0,48,101,100,72,1,3,146,
+    61,32,110,117,108,108,112,116,114,40,0,0,218,1,1,162,0,176,105,32,
+    61,32,49,59,32,105,32,60,32,173,0,114,59,32,43,43,105,41,32,10,
+    4,0,10,2,2,81,0,2,151,0,244,0,97,115,86,97,108,117,101,32,
+    61,32,105,32,43,32,49,51,0,1,185,0,0,44,0,65,105,102,32,40,
+    62,4,113,115,116,114,99,109,112,40,242,0,84,105,93,44,32,34,99,3,
+    160,34,41,32,61,61,32,48,32,38,38,75,1,1,78,0,8,109,0,0,
+    69,0,23,98,21,1,1,77,0,66,97,116,111,105,75,0,82,43,43,105,
+    93,41,192,0,0,42,0,127,125,32,101,108,115,101,32,118,0,9,4,74,
+    1,3,120,0,12,108,0,4,31,0,99,32,61,32,116,114,117,104,1,15,
+    91,0,20,2,101,3,3,89,0,15,209,0,9,4,101,0,3,168,1,18,
+    46,57,0,34,32,61,105,5,15,222,0,41,1,153,3,15,130,0,32,1,
+    56,0,15,129,0,50,2,1,4,15,131,0,33,2,58,0,15,133,0,49,
+    2,231,2,1,231,5,15,137,0,16,2,46,0,5,21,3,1,163,2,0,
+    88,2,13,87,2,6,3,3,0,17,2,7,59,7,1,51,0,24,48,137,
+    2,0,33,0,98,114,101,116,117,114,110,212,1,15,255,2,0,68,104,101,
+    108,112,158,0,119,63,32,48,32,58,32,49,114,0,1,66,3,33,125,10,
+    7,0,116,47,47,32,45,45,45,32,238,3,17,32,236,7,116,109,97,114,
+    107,58,32,110,234,5,16,44,11,0,2,36,8,48,105,110,103,48,0,1,
+    59,0,0,10,3,4,110,2,8,235,2,0,24,0,6,87,3,65,62,32,
+    48,41,47,0,0,183,0,0,4,0,4,51,0,4,161,2,3,215,7,37,
+    61,32,52,0,6,171,0,0,75,0,12,48,0,3,209,2,108,60,32,49,
+    32,124,124,151,4,18,46,109,2,56,60,32,49,146,0,0,119,0,1,221,
+    3,65,99,101,114,114,80,8,35,45,45,71,0,0,99,7,34,45,45,54,
+    0,241,3,109,117,115,116,32,98,101,32,97,116,32,108,101,97,115,116,32,
+    49,118,5,0,62,0,4,4,0,3,120,1,13,78,1,0,32,0,2,188,
+    4,4,74,1,130,82,101,112,111,114,116,32,114,7,0,84,61,32,114,117,
+    110,27,0,27,40,211,0,7,101,4,1,249,1,4,40,0,2,67,0,12,
+    46,0,19,44,84,0,7,54,0,0,39,1,18,33,106,0,250,1,46,100,
+    101,116,101,114,109,105,110,105,115,116,105,99,40,41,124,1,14,191,0,0,
+    59,0,9,165,2,37,38,38,86,2,104,116,111,117,108,108,40,30,0,20,
+    44,215,5,131,44,32,49,54,41,32,33,61,140,0,16,46,53,7,175,101,
+    115,46,102,114,111,110,116,40,41,124,1,11,16,83,39,7,0,145,5,225,
+    104,32,100,105,102,102,101,114,115,32,102,114,111,109,254,6,4,109,0,2,
+    199,9,4,14,0,1,83,6,0,228,9,15,144,1,26,3,237,0,3,235,
+    6,3,240,2,2,165,1,1,97,6,0,13,11,55,115,115,32,121,2,32,
+    32,62,25,7,1,174,2,3,24,3,1,133,11,85,83,101,116,117,112,247,
+    2,81,115,102,58,58,82,49,11,17,87,8,9,3,15,9,16,40,24,0,
+    240,0,86,105,100,101,111,77,111,100,101,40,56,48,48,44,32,188,8,49,
+    44,32,34,69,0,211,43,32,66,111,120,50,68,32,68,101,109,111,34,188,
+    1,192,47,47,32,76,105,109,105,116,32,70,80,83,230,7,48,54,48,32,
+    42,7,240,0,115,109,111,111,116,104,101,114,32,115,105,109,117,108,97,128,
+    7,35,59,32,174,0,0,38,10,0,76,2,212,115,32,117,110,116,104,114,
+    111,116,116,108,101,100,178,0,113,115,111,32,116,104,97,116,74,1,6,50,
+    10,36,32,105,135,2,65,115,32,105,115,29,0,226,114,101,97,108,32,99,
+    111,115,116,32,111,102,32,97,94,10,1,69,0,2,219,9,80,46,115,101,
+    116,70,114,10,65,114,97,116,101,162,0,19,40,127,0,17,63,77,4,73,
+    54,48,41,59,63,4,2,219,0,10,40,1,18,80,35,12,16,83,34,12,
+    17,32,40,12,0,21,1,49,46,48,102,24,1,1,8,0,5,242,3,3,
+    16,1,50,66,111,120,90,1,50,101,114,32,112,4,49,101,114,40,59,0,
+    18,46,38,4,43,40,41,121,0,3,60,11,0,122,9,1,241,2,34,115,
+    44,25,10,112,101,100,32,111,110,99,101,235,9,3,225,10,9,192,1,82,
+    67,108,111,99,107,247,0,1,11,0,2,114,4,0,194,1,1,15,0,3,
+    214,2,1,12,0,6,27,0,66,84,105,109,101,52,0,0,10,0,11,24,
+    0,0,97,10,6,23,0,144,117,110,115,105,103,110,101,100,32,110,11,17,
+    67,109,11,5,116,9,5,28,0,1,162,1,0,128,2,3,162,2,0,139,
+    3,2,103,1,6,181,3,25,115,30,13,19,83,16,2,34,110,103,32,3,
+    10,27,1,113,46,115,105,122,101,40,41,224,4,0,77,5,64,105,101,115,
+    92,54,10,1,217,1,3,208,2,96,77,97,105,110,32,103,76,12,54,108,
+    111,111,212,2,115,119,104,105,108,101,32,40,254,1,100,105,115,79,112,101,
+    110,60,4,6,154,6,0,32,1,80,69,118,101,110,116,58,12,34,110,116,
+    2,1,0,250,4,10,63,0,65,112,111,108,108,39,0,32,40,101,45,0,
+    7,131,4,6,75,0,0,54,0,0,240,0,1,34,0,80,46,116,121,112,
+    101,170,9,5,97,0,134,58,58,67,108,111,115,101,100,9,1,0,49,0,
+    0,4,0,3,163,0,16,99,31,0,19,40,55,2,0,24,0,3,223,3,
+    0,11,0,3,235,0,97,85,112,100,97,116,101,239,2,2,159,2,1,242,
+    5,5,7,2,0,42,0,0,112,0,1,229,1,1,203,12,1,10,0,6,
+    213,0,2,93,1,0,216,1,8,104,0,0,16,0,0,232,1,32,32,43,
+    82,9,33,101,112,53,0,176,46,103,101,116,69,108,97,112,115,101,100,28,
+    0,0,48,0,1,117,1,0,100,0,3,142,0,2,216,2,32,32,40,17,
+    2,16,41,64,1,32,114,121,164,1,233,121,32,105,110,32,111,110,101,32,
+    98,97,116,99,104,157,0,4,1,3,33,46,117,201,0,14,8,3,0,94,
+    0,0,4,0,5,19,1,49,101,97,114,134,4,112,67,111,108,111,114,40,
+    49,130,4,1,5,0,96,50,53,48,41,41,59,57,12,81,67,108,101,97,
+    114,19,1,2,53,0,2,128,12,165,108,105,103,104,116,32,98,108,117,101,
+    182,0,0,167,0,2,184,2,16,43,228,5,3,31,16,0,22,0,3,37,
+    2,7,123,1,2,75,0,137,46,100,105,115,112,108,97,121,253,0,1,227,
+    2,0,19,1,0,47,1,1,13,0,2,48,1,112,114,101,115,116,97,114,
+    116,44,0,0,194,0,0,4,0,33,43,43,32,0,22,115,129,1,0,32,
+    2,2,16,3,0,240,10,2,223,6,2,63,0,12,111,1,64,32,62,61,
+    32,204,1,2,203,14,111,115,40,49,46,48,102,133,6,4,3,105,16,1,
+    88,3,80,102,105,120,101,100,47,3,1,14,0,238,115,101,116,112,114,101,
+    99,105,115,105,111,110,40,50,122,2,0,165,0,16,32,46,0,17,34,169,
+    0,2,130,3,1,11,0,0,225,0,65,46,97,115,83,73,15,81,115,40,
+    41,32,42,249,14,82,46,48,102,32,47,49,4,17,115,56,0,60,32,109,
+    115,185,16,2,85,0,2,87,0,0,12,17,34,101,112,88,0,4,103,2,
+    15,87,0,50,0,183,1,3,243,15,1,89,17,0,16,0,2,221,1,9,
+    159,0,17,47,205,0,15,162,0,11,17,40,65,0,1,41,0,3,212,0,
+    2,12,0,0,229,15,6,186,1,0,214,0,1,24,0,0,26,1,1,117,
+    11,36,101,112,11,0,48,102,58,58,11,0,106,58,58,90,101,114,111,51,
+    0,6,152,0,20,61,55,1,5,54,5,0,83,0,0,4,0,8,7,2,
+    15,70,2,0,17,125,194,2,3,13,4,6,1,8,32,125,10,245,13,35,
+    105,110,99,108,117,100,101,32,34,112,104,121,115,105,99,115,95,115,99,101,
+    110,101,46,104,34,10,10,28,0,183,60,97,108,103,111,114,105,116,104,109,
+    62,21,0,89,99,109,97,116,104,17,0,243,88,115,116,114,105,110,103,62,
+    10,10,110,97,109,101,115,112,97,99,101,32,123,10,10,47,47,32,83,105,
+    109,117,108,97,116,105,111,110,32,115,101,116,116,105,110,103,115,58,32,54,
+    48,32,115,116,101,112,115,32,112,101,114,32,115,101,99,111,110,100,10,99,
+    111,110,115,116,32,102,108,111,97,116,32,84,73,77,69,95,83,84,69,80,
+    32,61,32,49,46,48,102,32,47,32,54,48,46,48,102,59,38,0,248,12,
+    105,110,116,32,86,69,76,79,67,73,84,89,95,73,84,69,82,65,84,73,
+    79,78,83,32,61,32,56,35,0,64,80,79,83,73,25,0,10,35,0,51,
+    51,59,10,71,0,245,13,115,102,58,58,67,111,108,111,114,32,80,65,76,
+    69,84,84,69,91,93,32,61,32,123,10,32,32,32,32,28,0,232,40,50,
+    51,48,44,32,53,55,44,32,55,48,41,44,24,0,201,52,49,44,32,50,
+    53,48,44,32,50,51,56,26,0,112,49,54,56,44,32,50,49,5,0,75,
+    50,48,41,44,80,0,201,54,57,44,32,49,50,51,44,32,49,53,55,55,
+    0,187,50,52,52,44,32,49,54,50,44,32,57,25,0,16,51,46,0,242,
+    15,57,54,44,32,49,48,54,41,44,10,125,59,10,10,98,50,86,101,99,
+    50,32,116,111,77,101,116,101,114,115,40,57,1,35,120,44,66,1,50,121,
+    41,10,200,0,114,114,101,116,117,114,110,32,47,0,212,40,120,32,47,32,
+    83,67,65,76,69,44,32,121,11,0,181,41,59,10,125,10,10,125,32,47,
+    47,32,189,1,50,10,10,80,20,2,16,83,19,2,40,58,58,14,0,3,
+    107,0,180,119,105,100,116,104,80,105,120,101,108,115,117,0,100,104,101,105,
+    103,104,116,20,0,0,165,1,145,98,111,120,67,111,117,110,116,41,4,1,
+    131,58,32,119,111,114,108,100,40,141,0,0,210,1,128,44,32,57,46,56,
+    102,41,41,126,0,243,24,80,111,115,105,116,105,118,101,32,89,32,112,111,
+    105,110,116,115,32,100,111,119,110,119,97,114,100,115,44,32,97,115,32,105,
+    110,32,83,70,77,76,217,0,8,48,2,64,119,97,108,108,43,2,0,82,
+    0,16,59,75,0,209,72,97,108,102,45,116,104,105,99,107,110,101,115,58,
+    0,17,112,170,0,1,135,0,8,58,0,152,102,108,111,111,114,89,32,61,
+    32,188,0,65,32,45,32,53,75,0,13,47,0,143,108,101,102,116,32,61,
+    32,50,30,0,3,16,114,255,0,55,32,61,32,27,1,36,32,45,45,0,
+    1,76,0,242,3,47,47,32,79,110,101,32,115,116,97,116,105,99,32,98,
+    111,100,121,3,3,240,25,105,100,101,44,32,112,108,117,115,32,116,104,101,
+    32,98,111,120,101,115,59,32,114,101,115,101,114,118,101,32,117,112,32,102,
+    114,111,110,116,32,115,111,31,0,4,73,0,241,27,97,114,114,97,121,32,
+    110,101,118,101,114,32,114,101,97,108,108,111,99,97,116,101,115,32,119,104,
+    105,108,101,32,105,116,32,105,115,32,102,105,108,108,101,100,50,0,1,85,
+    0,19,46,84,0,228,40,51,32,43,32,115,116,100,58,58,109,97,120,40,
+    166,1,113,44,32,49,41,41,59,10,47,0,240,18,47,47,32,45,45,45,
+    32,67,111,110,116,97,105,110,101,114,58,32,103,114,111,117,110,100,32,97,
+    110,100,32,116,119,111,32,116,1,54,115,32,40,203,0,64,105,101,115,41,
+    52,0,1,63,0,2,100,1,5,69,3,112,32,103,114,101,101,110,40,45,
+    3,16,49,5,0,65,53,48,41,59,40,0,162,97,100,100,66,111,120,40,
+    98,50,95,73,0,86,66,111,100,121,44,214,2,8,74,1,97,47,32,50,
+    46,48,102,108,2,71,111,114,89,41,38,0,18,40,121,1,32,45,32,159,
+    1,36,41,32,41,0,0,162,0,34,41,44,123,0,15,111,0,19,0,64,
+    0,4,97,0,3,71,0,8,104,0,0,81,0,14,31,0,1,219,0,15,
+    96,0,19,1,168,0,14,66,0,5,197,3,15,97,0,11,1,49,1,53,
+    105,102,32,176,1,99,32,60,61,32,48,41,177,4,0,181,4,6,78,1,
+    127,100,121,110,97,109,105,99,79,1,16,32,49,48,205,2,8,231,0,1,
+    222,2,18,44,184,2,8,161,4,83,58,58,82,101,100,233,0,0,110,0,
+    2,91,4,2,200,1,25,125,54,2,48,83,116,114,119,3,80,109,111,100,
+    101,58,206,2,1,4,4,0,9,0,17,101,140,3,213,108,111,111,115,101,
+    32,99,111,108,117,109,110,115,51,2,1,45,6,32,122,101,227,2,3,43,
+    0,1,240,2,129,97,116,44,32,111,110,99,101,63,6,64,108,101,100,44,
+    33,0,17,121,218,2,224,32,97,98,111,117,116,32,104,97,108,102,32,111,
+    102,24,0,1,35,1,68,47,47,32,99,183,2,16,59,22,0,82,32,103,
+    97,112,115,185,2,144,104,101,32,111,102,102,115,101,116,49,0,0,59,3,
+    80,121,32,111,116,104,66,3,97,111,119,32,109,97,107,127,0,20,109,71,
+    0,64,116,117,109,98,76,3,96,110,115,116,101,97,100,51,0,112,108,97,
+    110,100,105,110,103,143,4,18,111,201,3,49,99,107,46,47,0,2,242,2,
+    2,135,5,98,105,110,110,101,114,76,44,4,0,84,2,33,32,43,47,3,
+    2,43,1,13,41,0,16,87,74,5,53,32,61,32,199,2,0,7,2,69,
+    41,32,45,32,71,0,15,57,0,4,17,72,112,5,32,32,61,244,5,0,
+    198,4,31,45,102,0,4,98,115,105,100,101,32,61,240,3,97,99,108,97,
+    109,112,40,251,3,81,115,113,114,116,40,100,0,2,130,0,18,42,113,0,
+    3,86,0,80,42,32,48,46,53,122,7,4,30,4,65,41,44,32,52,129,
+    3,17,52,49,2,14,148,0,0,247,7,0,28,1,33,61,32,113,0,104,
+    42,32,49,46,53,102,39,0,0,18,6,4,246,1,3,143,0,0,127,4,
+    35,49,44,17,5,184,95,99,97,115,116,60,105,110,116,62,40,152,0,36,
+    45,32,90,0,2,218,3,0,226,3,3,18,0,5,175,4,80,102,111,114,
+    32,40,96,0,160,105,32,61,32,48,59,32,105,32,60,69,2,1,121,2,
+    88,59,32,43,43,105,39,3,2,130,1,0,46,0,128,114,111,119,32,61,
+    32,105,32,50,2,1,142,2,2,175,0,0,222,2,6,37,0,2,179,0,
+    1,40,0,20,37,182,2,12,40,0,2,248,1,16,120,37,0,5,252,1,
+    21,43,184,0,51,42,32,40,69,0,17,43,86,1,80,41,32,43,32,40,
+    124,0,85,37,32,50,32,63,39,0,17,47,97,1,55,32,58,32,97,1,
+    6,139,0,2,99,0,28,121,239,1,22,32,31,1,18,42,85,0,3,100,
+    0,6,163,0,15,23,4,13,72,120,44,32,121,1,4,1,191,1,2,108,
+    1,18,44,204,1,2,13,0,37,41,44,41,9,99,105,32,37,32,54,93,
+    13,4,16,125,65,8,88,118,111,105,100,32,40,8,32,58,58,228,9,20,
+    40,137,8,1,251,7,101,46,83,116,101,112,40,223,9,31,44,198,9,1,
+    47,44,32,184,9,0,2,165,8,1,183,2,141,117,105,110,116,54,52,95,
+    116,109,0,144,97,116,101,72,97,115,104,40,41,255,3,50,115,116,10,1,
+    9,10,52,0,64,104,97,115,104,42,8,242,7,52,54,57,53,57,56,49,
+    48,51,57,51,52,54,54,53,54,48,51,55,117,108,108,51,1,112,97,117,
+    116,111,32,109,105,205,1,32,91,38,49,0,19,93,243,8,88,118,97,108,
+    117,101,73,2,241,12,117,110,115,105,103,110,101,100,32,99,104,97,114,32,
+    98,121,116,101,115,91,115,105,122,101,111,102,32,44,0,18,93,81,0,0,
+    196,1,1,135,0,113,109,101,109,99,112,121,40,41,0,49,44,32,38,36,
+    0,0,98,1,6,50,0,3,82,1,0,50,0,1,211,2,14,98,0,34,
+    32,58,105,0,8,136,0,0,47,0,0,169,0,49,32,94,61,29,0,6,
+    119,0,5,26,0,245,1,42,61,32,49,48,57,57,53,49,49,54,50,56,
+    50,49,49,238,0,0,34,0,17,125,194,4,18,125,55,0,1,120,0,2,
+    254,2,48,66,111,120,66,6,16,38,75,3,0,120,0,0,152,8,8,120,
+    0,2,38,0,2,207,9,49,38,32,112,192,9,64,111,110,32,61,48,0,
+    16,46,222,8,82,45,62,71,101,116,216,9,55,111,110,40,221,0,10,58,
+    0,112,118,101,108,111,99,105,116,220,2,54,98,111,120,58,0,115,76,105,
+    110,101,97,114,86,30,0,8,64,0,68,109,105,120,40,112,0,39,46,120,
+    89,0,9,25,0,27,121,25,0,9,93,0,96,65,110,103,108,101,40,66,
+    4,0,3,1,0,4,0,0,60,0,4,139,0,13,85,0,5,25,0,15,
+    85,0,13,40,117,108,179,0,3,130,0,2,98,1,2,50,7,16,32,171,
+    1,1,117,11,1,21,2,0,49,2,13,206,2,18,100,192,7,1,192,4,
+    11,209,2,3,69,0,1,60,0,16,99,93,11,48,95,105,102,19,8,176,
+    101,115,46,98,101,103,105,110,40,41,44,128,1,130,101,115,46,101,110,100,
+    40,41,127,12,0,223,0,13,4,0,50,91,93,40,136,1,8,232,1,67,
+    41,32,123,32,99,0,9,47,1,211,84,121,112,101,40,41,32,61,61,32,
+    98,50,95,159,0,0,29,2,50,59,32,125,157,3,15,1,4,0,5,121,
+    4,0,41,0,0,65,0,99,32,116,121,112,101,44,142,12,5,49,2,5,
+    17,0,0,202,7,119,69,120,116,101,110,116,115,106,13,0,116,5,36,111,
+    114,72,4,32,98,50,77,0,49,68,101,102,63,11,35,68,101,98,6,0,
+    110,2,64,68,101,102,46,97,0,33,32,61,104,0,2,207,2,4,25,0,
+    4,46,2,37,32,61,120,0,3,33,0,1,81,0,17,42,79,0,0,189,
+    11,0,163,12,112,46,67,114,101,97,116,101,106,0,35,40,38,66,0,4,
+    26,11,240,1,98,50,80,111,108,121,103,111,110,83,104,97,112,101,32,115,
+    6,0,2,74,0,1,11,0,96,46,83,101,116,65,115,213,10,7,206,0,
+    49,46,120,44,167,8,3,221,0,16,46,68,2,1,116,3,0,207,9,2,
+    179,0,1,88,1,6,5,11,8,103,3,0,129,0,34,45,62,147,0,145,
+    70,105,120,116,117,114,101,40,38,109,0,19,44,43,6,0,244,12,0,53,
+    6,80,32,100,101,110,115,73,3,0,197,3,19,97,87,7,1,218,0,1,
+    110,0,80,125,32,101,108,115,154,15,4,11,2,35,98,50,80,0,0,80,
+    1,18,102,91,0,5,83,1,0,37,0,6,20,0,17,46,113,0,50,32,
+    61,32,122,0,2,242,0,11,35,0,4,126,0,2,182,15,16,59,30,0,
+    0,154,0,19,68,149,0,112,116,111,32,99,97,108,99,16,16,97,101,32,
+    109,97,115,115,149,0,0,38,0,7,103,0,80,102,114,105,99,116,47,16,
+    97,61,32,48,46,51,102,69,0,67,47,47,32,70,23,0,15,51,0,1,
+    117,114,101,115,116,105,116,117,54,0,33,53,102,5,14,96,66,111,117,110,
+    99,105,1,14,5,53,0,15,74,1,2,6,125,0,5,173,3,1,49,0,
+    2,50,13,176,112,117,115,104,95,98,97,99,107,40,123,62,0,9,200,1,
+    18,44,155,2,2,1,3,0,251,95,47,47,32,84,101,115,116,115,32,102,
+    111,114,32,80,104,121,115,105,99,115,83,99,101,110,101,32,100,101,116,101,
+    114,109,105,110,105,115,109,32,97,110,100,32,116,104,101,32,104,101,97,100,
+    108,101,115,115,32,114,101,112,111,114,116,59,32,110,101,101,100,115,32,66,
+    111,120,50,68,10,47,47,32,98,117,116,32,110,111,32,119,105,110,100,111,
+    119,10,35,105,110,99,108,117,100,101,32,60,99,115,116,100,105,110,116,62,
+    19,0,56,108,105,98,19,0,166,105,111,115,116,114,101,97,109,62,10,40,
+    0,20,34,115,0,151,95,98,101,110,99,104,46,104,34,28,0,18,112,176,
+    0,32,95,115,177,0,0,27,0,255,37,10,115,116,97,116,105,99,32,105,
+    110,116,32,102,97,105,108,117,114,101,115,32,61,32,48,59,10,10,35,100,
+    101,102,105,110,101,32,67,72,69,67,75,40,99,111,110,100,105,116,105,111,
+    110,41,32,1,0,36,32,92,10,57,0,64,100,111,32,123,8,0,15,4,
+    0,49,2,82,0,0,74,0,87,105,102,32,40,33,164,0,31,41,101,0,
+    36,6,82,0,0,86,0,240,6,115,116,100,58,58,99,101,114,114,32,60,
+    60,32,95,95,70,73,76,69,95,95,12,0,48,39,58,39,7,0,83,95,
+    95,76,73,78,19,0,101,34,58,32,34,32,35,38,1,154,32,34,92,110,
+    34,59,32,32,32,82,0,36,43,43,101,1,0,28,0,0,100,0,15,4,
+    0,31,6,82,0,31,125,61,0,31,15,50,0,2,2,82,0,196,125,32,
+    119,104,105,108,101,32,40,48,41,10,23,2,1,2,1,240,4,117,105,110,
+    116,54,52,95,116,32,104,97,115,104,65,102,116,101,114,40,47,2,145,98,
+    111,120,67,111,117,110,116,44,61,2,129,116,105,99,107,115,41,32,123,229,
+    1,9,23,3,1,108,2,163,40,56,48,48,46,48,102,44,32,54,8,0,
+    4,62,0,33,41,59,50,0,0,77,3,1,86,0,0,72,0,1,129,2,
+    17,32,10,0,17,60,7,0,80,115,59,32,43,43,16,0,17,41,45,0,
+    0,197,0,1,86,0,99,46,115,116,101,112,40,67,0,116,114,101,116,117,
+    114,110,32,25,0,112,97,116,101,72,97,115,104,30,0,21,125,208,0,241,
+    3,118,111,105,100,32,116,101,115,116,73,100,101,110,116,105,99,97,108,187,
+    3,16,115,42,0,132,84,104,101,83,97,109,101,40,197,0,2,248,2,6,
+    244,0,199,50,48,48,44,32,49,50,48,41,32,61,61,11,1,5,23,0,
+    3,135,0,12,55,0,16,48,244,0,11,52,0,2,20,0,3,49,0,0,
+    81,4,0,42,4,177,97,115,104,32,102,111,108,108,111,119,115,59,4,0,
+    154,3,144,101,58,32,111,116,104,101,114,32,233,0,115,115,32,111,114,32,
+    97,110,17,0,0,194,3,113,32,100,105,102,102,101,114,21,1,12,120,0,
+    5,152,0,46,32,33,175,0,51,49,57,41,126,0,15,55,0,2,44,48,
+    41,53,0,64,49,44,32,48,51,0,15,75,1,0,19,72,227,4,241,3,
+    87,111,114,108,100,115,77,97,116,99,104,65,83,105,110,103,108,101,92,1,
+    5,80,1,4,40,0,32,79,112,71,4,50,115,32,111,8,0,2,0,2,
+    3,13,0,33,46,119,69,0,74,32,61,32,51,24,0,0,253,1,106,115,
+    32,61,32,54,48,24,0,65,98,111,100,105,178,4,43,49,48,26,0,96,
+    116,104,114,101,97,100,52,0,18,50,51,0,100,99,111,110,115,116,32,134,
+    0,17,82,144,5,3,151,5,100,32,61,32,114,117,110,27,0,19,40,141,
+    0,55,41,59,10,90,1,2,193,5,22,46,229,5,64,116,105,99,40,19,
+    1,0,142,2,2,70,1,3,35,0,0,51,2,96,101,115,46,115,105,122,
+    77,2,73,61,61,32,51,108,1,10,38,0,107,102,114,111,110,116,40,32,
+    2,16,49,107,2,17,54,113,1,13,94,0,131,100,121,110,97,109,105,99,
+    66,249,0,95,61,32,49,48,48,96,0,1,0,50,2,32,83,101,145,4,
+    9,139,0,79,32,42,32,54,48,0,2,5,48,1,111,61,32,50,41,59,
+    10,233,1,0,64,80,101,114,99,54,3,240,1,108,101,115,79,102,65,75,
+    110,111,119,110,83,97,109,112,108,230,0,2,248,3,4,66,1,9,93,1,
+    2,126,1,9,34,1,21,112,74,0,65,40,48,46,53,253,0,32,48,46,
+    150,0,1,112,1,5,12,4,160,105,32,61,32,49,59,32,105,32,60,230,
+    0,0,4,4,22,105,1,4,3,71,1,8,231,0,242,9,112,117,115,104,
+    95,98,97,99,107,40,105,41,59,32,47,47,32,87,104,111,108,101,32,115,
+    6,1,241,1,32,99,111,109,112,97,114,101,32,101,120,97,99,116,108,121,
+    108,0,15,151,0,7,2,232,3,16,49,151,0,0,75,0,241,10,78,101,
+    97,114,101,115,116,32,114,97,110,107,58,32,110,101,118,101,114,32,98,101,
+    108,111,119,172,3,113,102,105,114,115,116,32,115,14,1,15,88,0,12,2,
+    239,0,16,53,88,0,15,42,0,12,17,57,25,1,31,57,42,0,17,2,
+    43,0,18,49,69,1,13,51,2,7,111,1,0,208,0,0,192,4,3,43,
+    0,1,130,0,3,74,1,11,89,2,34,32,52,185,1,3,30,0,67,119,
+    97,108,108,79,2,83,32,61,32,50,46,110,3,9,64,1,194,98,111,100,
+    121,83,116,101,112,115,80,101,114,44,0,2,217,2,18,50,152,0,8,109,
+    0,2,36,3,112,32,61,32,123,55,44,32,3,0,18,125,110,0,9,80,
+    0,15,108,3,3,3,145,0,2,66,0,22,46,244,1,25,56,6,3,19,
+    33,39,0,14,68,0,48,125,10,10,191,6,69,109,97,105,110,156,4,15,
+    19,6,13,2,157,0,0,38,0,4,227,2,15,238,4,6,6,43,0,15,
+    48,3,8,2,37,0,0,182,8,4,16,8,68,32,62,32,48,122,6,0,
+    193,1,54,115,116,100,124,8,5,37,0,209,60,60,32,34,32,99,104,101,
+    99,107,40,115,41,177,9,32,101,100,105,8,1,91,1,0,55,0,3,5,
+    7,194,69,88,73,84,95,70,65,73,76,85,82,69,108,0,17,125,35,0,
+    2,86,0,48,111,117,116,191,8,70,34,65,108,108,161,10,0,221,0,103,
+    115,32,112,97,115,115,83,0,8,79,0,112,83,85,67,67,69,83,83,27,
+    4,0,
+};
+extern const std::size_t cppstarter_template_blob_size = 99182;
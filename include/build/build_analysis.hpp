@@ -0,0 +1,96 @@
+#ifndef BUILD_ANALYSIS_HPP
+#define BUILD_ANALYSIS_HPP
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace build {
+    namespace fs = std::filesystem;
+
+    // One #include as the compiler processed it
+    struct Inclusion {
+        std::string header;
+        unsigned depth = 1;     // 1 = included by the source itself
+        double offset = 0.0;    // Seconds after the compiler started
+        double seconds = 0.0;   // Parsing it and everything it includes
+    };
+
+    // Cost of compiling one translation unit
+    struct UnitAnalysis {
+        fs::path source;
+        double start = 0.0;             // Seconds after the build started
+        double seconds = 0.0;           // Wall time of the compiler process
+        long max_rss_kb = 0;            // Peak RSS of the compiler process
+        double frontend_seconds = 0.0;  // Preprocessing, parsing, template instantiation
+        double backend_seconds = 0.0;   // Optimisation and code generation
+        unsigned worker = 0;            // Build job slot, from 1
+        std::vector<Inclusion> includes;    // In inclusion order
+    };
+
+    // Filled by BuildEngine::build() when passed in BuildOptions::analysis
+    struct BuildAnalysis {
+        bool clang = false;                 // -ftime-trace instead of -H -ftime-report
+        std::vector<UnitAnalysis> units;    // In completion order
+    };
+
+    // `compiler --version` mentions clang
+    bool compiler_is_clang(const std::string& compiler);
+
+    // Extra compile flags that make the compiler report where its time goes
+    std::vector<std::string> analysis_flags(bool clang);
+
+    // Fill `unit` from the -H include tree and the -ftime-report table GCC
+    // printed to stderr, and return the rest of `output` (the diagnostics).
+    // GCC does not time individual headers, so each inclusion gets a share
+    // of the frontend time proportional to its size in bytes: an estimate
+    // that ranks heavy headers well but is not a measurement.
+    std::string parse_gcc_analysis(std::string_view output, UnitAnalysis& unit);
+
+    // Fill `unit` from the JSON clang writes next to the object for
+    // -ftime-trace: "Source" events are timed inclusions, "Total Frontend"
+    // and "Total Backend" the phases.
+    void parse_clang_time_trace(std::string_view json, UnitAnalysis& unit);
+
+    struct HeaderCost {
+        std::string header;
+        double seconds = 0.0;   // Summed over every inclusion in every unit
+        size_t units = 0;       // Translation units that include it, directly or not
+        size_t inclusions = 0;
+    };
+
+    // Headers by aggregated inclusion cost, most expensive first
+    std::vector<HeaderCost> rank_headers(const std::vector<UnitAnalysis>& units);
+
+    // Chrome trace event JSON (chrome://tracing, Perfetto, speedscope): one
+    // row per build job, with each compile split into its phases and includes
+    std::string chrome_trace(const std::vector<UnitAnalysis>& units);
+
+    // One line of the build history
+    struct BuildRecord {
+        long long timestamp = 0;    // Unix seconds
+        std::string commit;         // Short hash, "+" appended with local changes; "-" outside git
+        std::string configuration;
+        size_t units = 0;
+        double wall_seconds = 0.0;  // The whole build, link included
+        double cpu_seconds = 0.0;   // Compiler process wall times, summed
+        long peak_rss_kb = 0;       // Largest compiler process
+        std::string top_header;     // Most expensive header
+    };
+
+    BuildRecord summarize_build(const BuildAnalysis& analysis, const std::string& configuration,
+                                double wall_seconds);
+
+    // HEAD as BuildRecord::commit describes it
+    std::string current_commit();
+
+    // Kept outside build/ so `make clean` does not reset the trend
+    fs::path build_history_path();
+
+    // Tab-separated, one line per analysed build; a missing file is an empty history
+    std::vector<BuildRecord> load_build_history(const fs::path& path);
+    void append_build_history(const fs::path& path, const BuildRecord& record);
+}
+
+#endif // BUILD_ANALYSIS_HPP
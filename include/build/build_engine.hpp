@@ -0,0 +1,120 @@
+#ifndef BUILD_ENGINE_HPP
+#define BUILD_ENGINE_HPP
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/thread_pool.hpp"
+
+namespace build {
+    namespace fs = std::filesystem;
+
+    // The configurations the generated Makefiles know about. Each one keeps
+    // its objects and binary under its own build/<name>/ tree.
+    // Bench always uses the release flags, like the generated `bench` target.
+    enum class Configuration { Debug, Release, Test, Bench };
+
+    struct BuildConfig {
+        std::string name;                        // "debug", "release", "test", ...
+        std::string compiler = "g++";
+        std::vector<std::string> compile_flags;  // $(CXXFLAGS) $(DBG_FLAGS) equivalent
+        std::vector<std::string> link_flags;     // Placed before the objects on the link line
+        std::vector<std::string> libs;           // Placed after the objects ($(LIBS_DEBUG) ...)
+        std::vector<fs::path> sources;
+        std::vector<fs::path> original_sources;  // Pre-unity list; empty unless sources were merged
+        fs::path obj_dir;                        // build/<name>/obj
+        fs::path binary;                         // build/<name>/bin/<project>
+        bool precompiled_header = false;         // Build build/<name>/pch/pch.hpp.gch and -include it
+        std::vector<fs::path> extra_inputs;      // Files every object depends on (e.g. a PGO profile stamp)
+        bool gtest = false;                      // Tests include <gtest/gtest.h>
+        // When set, the objects of library_sources go into this shared
+        // library instead of the binary, which links against it
+        fs::path shared_library;
+        std::vector<fs::path> library_sources;
+    };
+
+    class CompileCache;
+    struct BuildAnalysis;
+
+    // Default configuration for the project in the current directory,
+    // matching the flags of the Makefile written by `cppstarter new`.
+    BuildConfig make_config(Configuration configuration);
+
+    // All *.cpp files directly inside `dir`, sorted (same as $(wildcard dir/*.cpp))
+    std::vector<fs::path> scan_sources(const fs::path& dir);
+
+    // System headers (`#include <...>`) used by at least a quarter of `sources`,
+    // most frequent first, at most `max_headers` of them. These go into the
+    // generated precompiled header.
+    std::vector<std::string> detect_common_headers(const std::vector<fs::path>& sources,
+                                                   size_t max_headers = 16);
+
+    struct BuildOptions {
+        unsigned jobs = utils::default_job_count();
+        bool verbose = false;   // Echo full compiler command lines
+        CompileCache* cache = nullptr;  // Shared object cache, or nullptr to always compile
+        // Record what every compile costs. Recompiles every translation
+        // unit and bypasses the cache, so each one is measured.
+        BuildAnalysis* analysis = nullptr;
+    };
+
+    struct BuildResult {
+        bool success = true;
+        size_t compiled = 0;    // Translation units recompiled this run
+        size_t up_to_date = 0;  // Translation units skipped
+        size_t cache_hits = 0;  // Recompiles served from the object cache
+        bool linked = false;
+        double seconds = 0.0;
+        double link_seconds = 0.0;  // Wall time of the link steps
+    };
+
+    // Incremental build driver. Dependencies come from the depfiles the
+    // compiler writes next to each object; only translation units whose
+    // source, headers or flags changed since the last run are recompiled.
+    // One engine can be reused for repeated builds and keeps the dependency
+    // graph in memory between them.
+    class BuildEngine {
+    public:
+        explicit BuildEngine(BuildConfig config);
+
+        BuildResult build(const BuildOptions& options = {});
+
+        // Sources whose object depends on `file` according to the last known depfiles
+        std::vector<fs::path> dependents_of(const fs::path& file) const;
+
+        // Object file of every translation unit, in source order
+        std::vector<fs::path> objects() const;
+
+        const BuildConfig& config() const { return config_; }
+
+        // Link line of the binary, and of the shared library (empty without one)
+        std::vector<std::string> link_command() const;
+        std::vector<std::string> library_link_command() const;
+
+    private:
+        struct TranslationUnit {
+            fs::path source;
+            fs::path object;
+            fs::path depfile;
+            std::vector<fs::path> inputs;   // Source plus every header from the depfile
+            bool inputs_known = false;
+            bool in_library = false;        // Linked into config.shared_library
+        };
+
+        fs::path object_path_for(const fs::path& source) const;
+        std::vector<std::string> effective_flags() const;
+        std::vector<std::string> compile_command(const TranslationUnit& unit) const;
+        bool update_precompiled_header(const BuildOptions& options, bool flags_changed, bool& rebuilt);
+        std::string signature() const;
+        bool signature_changed() const;
+        void write_signature() const;
+
+        BuildConfig config_;
+        std::vector<TranslationUnit> units_;
+        std::vector<std::string> pch_flags_;    // -include build/<name>/pch/pch.hpp when active
+    };
+}
+
+#endif // BUILD_ENGINE_HPP
@@ -0,0 +1,94 @@
+#ifndef COMPILE_CACHE_HPP
+#define COMPILE_CACHE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace build {
+    namespace fs = std::filesystem;
+
+    struct CacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t files = 0;
+        uint64_t size_bytes = 0;
+    };
+
+    // $CPPSTARTER_CACHE_DIR, else $XDG_CACHE_HOME/cppstarter, else ~/.cache/cppstarter
+    fs::path default_cache_dir();
+
+    // "500M", "5G", "1024" (bytes) -> bytes; throws std::invalid_argument on bad input
+    uint64_t parse_size(std::string_view text);
+    std::string format_size(uint64_t bytes);
+
+    // Flags that only influence preprocessing (-I, -D, -MF, ...) are already
+    // reflected in the preprocessed source and are left out of the key.
+    std::vector<std::string> key_flags(const std::vector<std::string>& compile_flags);
+
+    // Content-addressed object cache shared by every project and configuration.
+    // Objects are keyed on the SHA-256 of the preprocessed source, the compiler
+    // identity and the code-generation flags, so identical compiles in
+    // build/debug and build/test, on another branch or in a sibling project
+    // turn into a file copy (or a hardlink with CPPSTARTER_CACHE_HARDLINK=1).
+    // Entries are evicted least-recently-used first once the size cap is hit.
+    class CompileCache {
+    public:
+        explicit CompileCache(fs::path root = default_cache_dir());
+
+        struct Lookup {
+            bool hit = false;
+            std::string key;     // Empty when the source could not be preprocessed
+            std::string output;  // Diagnostics recorded when the object was first built
+        };
+
+        // Preprocess `source` (writing `depfile` as a side effect) and, on a hit,
+        // materialise the cached object at `object`. Profile-guided compiles
+        // (-fprofile-use) are never cached and return an empty key.
+        Lookup lookup(const std::string& compiler, const std::vector<std::string>& compile_flags,
+                      const fs::path& source, const fs::path& object, const fs::path& depfile);
+
+        // Record a freshly compiled object under `key`
+        void store(const std::string& key, const fs::path& object, const std::string& output);
+
+        // Merge this process' counters into the on-disk statistics and trim the
+        // cache when it grew past the size limit
+        void flush();
+
+        CacheStats stats() const;
+        void zero_stats();
+        void clear();
+
+        uint64_t max_size() const;
+        void set_max_size(uint64_t bytes);
+
+        // Evict least-recently-used entries until the cache is below 90% of the limit.
+        // Returns the number of evicted objects.
+        size_t cleanup();
+
+        const fs::path& root() const { return root_; }
+
+    private:
+        fs::path entry_path(const std::string& key, std::string_view extension) const;
+        std::string compiler_identity(const std::string& compiler);
+        CacheStats read_stats() const;
+        void write_stats(const CacheStats& stats) const;
+
+        fs::path root_;
+        bool hardlink_ = false;
+        bool hash_dir_ = true;
+        std::atomic<uint64_t> pending_hits_{0};
+        std::atomic<uint64_t> pending_misses_{0};
+        std::atomic<uint64_t> pending_files_{0};
+        std::atomic<uint64_t> pending_bytes_{0};
+        std::mutex identity_mutex_;
+        std::unordered_map<std::string, std::string> identities_;
+    };
+}
+
+#endif // COMPILE_CACHE_HPP
@@ -0,0 +1,19 @@
+#ifndef DEPFILE_HPP
+#define DEPFILE_HPP
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace build {
+    // Prerequisites of the first rule in a Make-style depfile as emitted by
+    // `-MMD -MP`. Phony header rules added by -MP are ignored, line
+    // continuations and escaped spaces are handled.
+    std::vector<std::string> parse_depfile(std::string_view content);
+
+    // Read and parse a depfile from disk; returns an empty list when missing
+    std::vector<std::string> read_depfile(const std::filesystem::path& path);
+}
+
+#endif // DEPFILE_HPP
@@ -0,0 +1,67 @@
+#ifndef FAST_LINK_HPP
+#define FAST_LINK_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "build/build_engine.hpp"
+
+namespace build {
+    struct Linker {
+        std::string name;       // "mold", "lld", "gold", or "default" for the compiler's own ld
+        std::string flag;       // -fuse-ld=<name>; empty for the default
+        std::string version;    // First line of `-Wl,--version`
+        bool gdb_index = false; // Understands --gdb-index (GNU ld does not)
+    };
+
+    // Linkers `compiler` can drive, fastest first: mold, lld, gold, then the
+    // default. Detected once per compiler and process.
+    std::vector<Linker> detect_linkers(const std::string& compiler);
+
+    // True for the version line of gold, LLD or mold, the linkers that
+    // understand --gdb-index; false for GNU ld and anything unrecognized
+    bool supports_gdb_index(std::string_view version);
+
+    // "auto" picks the first (fastest) of `linkers`; any other name must be
+    // among them. Throws std::runtime_error otherwise.
+    Linker select_linker(const std::vector<Linker>& linkers, std::string_view name);
+
+    struct FastLinkOptions {
+        std::string linker = "auto";
+        bool split_dwarf = true;   // Debug info goes to .dwo files the linker never reads
+        bool shared = false;       // Project code in build/<name>/lib/lib<project>.so
+    };
+
+    // Turn a debug or test configuration into the fast-link profile:
+    //  - -gsplit-dwarf, so the linker only sees skeleton debug info;
+    //  - -fuse-ld=<linker>, plus --gdb-index (and -ggnu-pubnames, which the
+    //    index is built from) when the linker supports it;
+    //  - with `shared`, every non-test source except main.cpp is compiled
+    //    with -fPIC and linked into a shared library the binary loads via
+    //    its rpath. A one-file change then relinks only the library.
+    // Apply after apply_unity_build(), which rewrites the source list.
+    void apply_fast_link(BuildConfig& config, const Linker& linker, const FastLinkOptions& options);
+
+    // `command` (a link line) redone with `linker`, writing to `output`
+    std::vector<std::string> relink_with(const std::vector<std::string>& command, const Linker& linker,
+                                         const fs::path& output);
+
+    struct LinkTiming {
+        std::string linker;
+        double seconds = 0.0;   // Median over the runs, every link step included
+        uintmax_t bytes = 0;    // Size of the final output
+        std::string error;      // Linker output when a step failed
+    };
+
+    // Redo the link steps of a finished build (`commands`, in order) with each
+    // of `linkers`, `runs` times, writing below `scratch`. The build's own
+    // outputs are left alone.
+    std::vector<LinkTiming> compare_linkers(const std::vector<std::vector<std::string>>& commands,
+                                            const std::vector<Linker>& linkers, const fs::path& scratch,
+                                            unsigned runs);
+}
+
+#endif // FAST_LINK_HPP
@@ -0,0 +1,56 @@
+#ifndef FILE_WATCHER_HPP
+#define FILE_WATCHER_HPP
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace build {
+    namespace fs = std::filesystem;
+
+    // One debounced burst of file system events
+    struct ChangeSet {
+        std::vector<fs::path> paths;    // Changed, created or removed files, sorted, no duplicates
+        std::chrono::steady_clock::time_point first_event;
+        bool overflowed = false;        // The kernel dropped events; `paths` may be incomplete
+    };
+
+    // inotify watches on a set of directory trees. Subdirectories created
+    // later are picked up automatically, and the files already inside them
+    // are reported as changed.
+    class FileWatcher {
+    public:
+        // Directories that do not exist are skipped. Throws std::runtime_error
+        // when inotify is unavailable (it is Linux only).
+        explicit FileWatcher(const std::vector<fs::path>& roots);
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        // Block until something changes, then keep collecting events until
+        // none has arrived for `debounce`, so one editor save (write to a
+        // temporary, rename over the original) is reported once. Returns an
+        // empty change set when `timeout` passes without any event.
+        ChangeSet wait(std::chrono::milliseconds debounce,
+                       std::chrono::milliseconds timeout = std::chrono::milliseconds::max());
+
+        size_t watched_directories() const { return directories_.size(); }
+
+    private:
+        // Watch `root` and its subdirectories; regular files found on the
+        // way are appended to `files` when given
+        void add_tree(const fs::path& root, std::vector<fs::path>* files = nullptr);
+        void add_directory(const fs::path& dir);
+        // Read the pending events; false when `timeout_ms` passes without any
+        bool read_events(int timeout_ms, ChangeSet& changes);
+
+        int fd_ = -1;
+        std::vector<fs::path> roots_;
+        std::unordered_map<int, fs::path> directories_;     // Watch descriptor -> directory
+    };
+}
+
+#endif // FILE_WATCHER_HPP
@@ -0,0 +1,100 @@
+#ifndef FLAG_TUNING_HPP
+#define FLAG_TUNING_HPP
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "build/build_engine.hpp"
+#include "perf/perfgate.hpp"
+
+namespace build {
+    // A named compiler and optimization flags for release and bench builds.
+    // Stored as profiles/<name>.mk, which the Makefiles include for
+    // `make release PROFILE=<name>`; `release_profile` in cppstarter.conf
+    // selects one by default.
+    struct ReleaseProfile {
+        std::string name;
+        std::string compiler;               // Empty keeps $CXX or g++
+        std::vector<std::string> flags;     // Replace -O2 (OPTIMIZATION_LEVEL)
+    };
+
+    fs::path release_profile_path(const std::string& name);
+
+    // Throws std::runtime_error when the profile does not exist
+    ReleaseProfile load_release_profile(const std::string& name);
+
+    // `comment` lines go at the top of the file, each prefixed with "# "
+    void save_release_profile(const ReleaseProfile& profile, const std::vector<std::string>& comment);
+
+    // Swap the -O level of a release or bench configuration for the
+    // profile's flags and compiler; other configurations are left alone
+    void apply_release_profile(BuildConfig& config, const ReleaseProfile& profile);
+
+    struct FlagVariant {
+        std::string compiler;
+        std::vector<std::string> flags;
+
+        std::string label() const;          // "clang++ -O3 -march=native"
+    };
+
+    // g++ and clang++ (and $CXX) when installed, one per distinct compiler
+    std::vector<std::string> available_compilers();
+
+    // LTO as `compiler` spells it: -flto=auto for GCC, -flto=thin for clang,
+    // which rejects -flto=auto
+    std::string lto_flag(const std::string& compiler);
+
+    // Per compiler: -O2 (the baseline; first overall), -O3, -march=native
+    // and lto_flag() on their own and combined, and -O3 -march=native -flto
+    // with -fno-plt -fno-semantic-interposition. `extra` flag sets are
+    // tried with every compiler.
+    std::vector<FlagVariant> tuning_matrix(const std::vector<std::string>& compilers,
+                                           const std::vector<std::vector<std::string>>& extra = {});
+
+    // Geometric mean of the median_ns of every benchmark in a bench runner
+    // JSON report (--json); 0 when it lists none
+    double bench_score(std::string_view json);
+
+    enum class TuneWorkload {
+        Bench,      // bench/ built with the variant's flags; scored by bench_score()
+        Binary,     // The release binary with `args`; scored by wall time
+        Command,    // `command` through /bin/sh, {bin} replaced by the release binary
+    };
+
+    struct TuneOptions {
+        std::vector<FlagVariant> variants; // From tuning_matrix(); the first is the baseline
+        BuildConfig base;                   // Release (or, for the Bench workload, bench) configuration
+                                            // of the project; each variant swaps in its own flags
+        TuneWorkload workload = TuneWorkload::Binary;
+        std::vector<std::string> args;      // For the bench runner or the binary
+        std::string command;
+        unsigned runs = 10;                 // Timed runs per variant, interleaved
+        unsigned warmup = 1;                // Untimed runs per variant first
+        double threshold = 0.02;            // Smallest median change that counts
+        BuildOptions build;
+    };
+
+    struct VariantResult {
+        FlagVariant variant;
+        std::vector<double> samples;        // One score per run; lower is faster
+        std::string error;                  // Set when the build or a run failed
+        perf::Comparison vs_baseline;
+    };
+
+    struct TuneReport {
+        std::vector<VariantResult> results; // Fastest median first, failures last
+        size_t winner = 0;                  // Fastest variant significantly faster than
+                                            // the baseline, otherwise the baseline
+        size_t baseline = 0;
+    };
+
+    // Build every variant under build/tune/<n>/, then run the workload
+    // round-robin across them (so drift in machine speed hits all alike)
+    // and compare each against the baseline with perf::compare().
+    // Throws std::runtime_error when the baseline fails to build or run.
+    TuneReport run_tuning(const TuneOptions& options);
+}
+
+#endif // FLAG_TUNING_HPP
@@ -0,0 +1,89 @@
+#ifndef GTEST_CACHE_HPP
+#define GTEST_CACHE_HPP
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace build {
+    namespace fs = std::filesystem;
+
+    // Release fetched by `cppstarter gtest --fetch` (and the root Makefile)
+    constexpr std::string_view GTEST_REPOSITORY = "https://github.com/google/googletest.git";
+    constexpr std::string_view GTEST_TAG = "v1.14.0";
+
+    // Flags that change what the gtest archives must be built with: the
+    // language standard, the standard library and its ABI macros, the target,
+    // sanitizers, exceptions/RTTI and threading. Sorted and de-duplicated so
+    // that "-pthread -std=c++17" and "-std=c++17 -pthread" share an entry.
+    std::vector<std::string> gtest_abi_flags(const std::vector<std::string>& flags);
+
+    // "set(GOOGLETEST_VERSION 1.14.0)" in a googletest CMakeLists.txt -> "1.14.0"
+    std::string parse_gtest_version(std::string_view cmakelists);
+
+    struct GtestEntry {
+        std::string key;
+        fs::path prefix;        // include/ and lib/libgtest{,_main}.a
+        std::string version;    // googletest version the archives were built from
+        std::string compiler;   // First line of `<compiler> --version`
+        std::string flags;
+    };
+
+    // Per-user store of googletest sources and of static libraries prebuilt
+    // from them, one entry per compiler, standard library and ABI flags:
+    //
+    //   <cache>/gtest/src/<version>/   seeded sources (include/ and src/)
+    //   <cache>/gtest/<version>-<key>/ include/, lib/, entry.txt
+    //
+    // Projects link against an entry through a symlink (build/gtest), so a
+    // fresh checkout or a new project never clones or compiles googletest
+    // once the entry exists.
+    class GtestCache {
+    public:
+        explicit GtestCache(fs::path root);   // <root>/gtest
+        GtestCache();                         // default_cache_dir()/gtest
+
+        const fs::path& root() const { return root_; }
+
+        // Import sources from a googletest checkout (the repository or its
+        // googletest/ subdirectory) or from a release tarball or zip.
+        // Works offline. Returns the version that was seeded.
+        std::string seed(const fs::path& source);
+
+        // Clone `tag` of `repository` and seed it. Needs network access.
+        std::string fetch(std::string_view repository = GTEST_REPOSITORY, std::string_view tag = GTEST_TAG);
+
+        // Seeded versions, newest first
+        std::vector<std::string> source_versions() const;
+
+        // Entry key for a compiler, its standard library and the ABI flags
+        // among `flags`, built from `version`
+        std::string key(const std::string& compiler, const std::vector<std::string>& flags,
+                        const std::string& version) const;
+
+        // Existing entry for the newest seeded version, without building
+        std::optional<GtestEntry> find(const std::string& compiler, const std::vector<std::string>& flags) const;
+
+        // Entry for the newest seeded version, compiling gtest-all.cc and
+        // gtest_main.cc into static archives first when it does not exist.
+        // Throws std::runtime_error when no sources were seeded or the
+        // build fails.
+        GtestEntry ensure(const std::string& compiler, const std::vector<std::string>& flags);
+
+        std::vector<GtestEntry> entries() const;
+
+        // Remove every prebuilt entry; seeded sources are kept
+        size_t clear();
+
+    private:
+        fs::path root_;
+    };
+
+    // Point the symlink `link` at `prefix`, replacing a previous link.
+    // Throws std::runtime_error when `link` exists and is not a symlink.
+    void link_gtest(const fs::path& prefix, const fs::path& link);
+}
+
+#endif // GTEST_CACHE_HPP
@@ -0,0 +1,58 @@
+#ifndef PGO_HPP
+#define PGO_HPP
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "build/build_engine.hpp"
+
+namespace build {
+    class CompileCache;
+
+    // Training workload that builds and runs an instrumented test runner
+    // instead of a shell command
+    constexpr char PGO_TEST_WORKLOAD[] = "test";
+
+    struct PgoOptions {
+        BuildConfig release;                // The project's release configuration (release_profile included)
+        std::vector<std::string> training;  // Shell commands or PGO_TEST_WORKLOAD; empty = run the binary
+        std::vector<std::string> run_args;  // Arguments for the default workload and the timing runs
+        bool lto = false;                   // Add -flto=auto (clang: -flto=thin) to the optimized build
+        bool reset = false;                 // Discard the recorded profile before training
+        unsigned timing_runs = 3;           // Runs per binary for the speedup report (0 = skip)
+        BuildOptions build;                 // Jobs, verbosity and cache for the builds
+    };
+
+    struct PgoReport {
+        fs::path binary;                    // Profile-optimized build/release binary
+        unsigned training_runs = 0;         // Workload runs merged into the profile so far
+        size_t profiled_units = 0;          // Release translation units with profile data
+        size_t total_units = 0;
+        bool stale_profile = false;         // Recorded profile was discarded because sources changed
+        double baseline_seconds = 0.0;      // Median wall time of the release binary without a profile
+        double optimized_seconds = 0.0;     // Median wall time of the PGO binary
+    };
+
+    // build/pgo-data: the recorded profile (.gcda files, or clang's .profraw
+    // files and their merged .profdata) and the source fingerprint
+    fs::path pgo_data_dir();
+
+    // Identifies the code a profile was recorded against: the compiler, the
+    // flags, the sources and every file under include/. A profile whose
+    // fingerprint no longer matches is stale.
+    std::string pgo_fingerprint(const BuildConfig& config);
+
+    // The whole workflow behind `run-release --pgo`:
+    //   1. plain release build, kept aside as the speedup baseline
+    //   2. instrumented build in build/pgo-gen (and build/pgo-test for the test workload)
+    //   3. training workloads; libgcov merges their counts into build/pgo-data
+    //      (with clang, llvm-profdata merges the .profraw files afterwards)
+    //   4. -fprofile-use or -fprofile-instr-use (+ LTO) rebuild into build/release
+    //   5. timing of both binaries
+    // Throws std::runtime_error when a build fails, or when clang is used and
+    // llvm-profdata is missing or fails.
+    PgoReport run_pgo_pipeline(const PgoOptions& options);
+}
+
+#endif // PGO_HPP
@@ -0,0 +1,62 @@
+#ifndef TEST_IMPACT_HPP
+#define TEST_IMPACT_HPP
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace build {
+    namespace fs = std::filesystem;
+
+    struct ObjectSymbols {
+        std::vector<std::string> defined;   // Strong global definitions
+        std::vector<std::string> undefined;
+    };
+
+    // Symbols per object from `nm -P -A` output. Weak and local definitions
+    // are ignored: inline functions and template instances are defined
+    // weakly in every object that uses them and say nothing about linkage.
+    std::unordered_map<std::string, ObjectSymbols> parse_nm_output(std::string_view output);
+
+    // Symbols of `objects`, reusing `cache_path` entries whose object has not
+    // changed since and running `nm` once for all the others. The cache is
+    // rewritten. Throws std::runtime_error when nm fails.
+    std::unordered_map<std::string, ObjectSymbols> load_object_symbols(const std::vector<fs::path>& objects,
+                                                                       const fs::path& cache_path);
+
+    // Object -> every other object it needs at link time, transitively
+    using LinkClosure = std::unordered_map<std::string, std::vector<std::string>>;
+    LinkClosure link_closure(const std::unordered_map<std::string, ObjectSymbols>& symbols);
+
+    // Test sources a change can affect:
+    //  - changed test sources themselves;
+    //  - test sources that include a changed header (`dependents`, from the depfiles);
+    //  - test sources whose object links, directly or transitively, against
+    //    the object of a changed source or of a source including a changed header.
+    // `object_of` maps every source to its object file.
+    std::vector<fs::path> impacted_tests(const std::vector<fs::path>& changed,
+                                         const std::vector<fs::path>& test_sources,
+                                         const std::function<std::vector<fs::path>(const fs::path&)>& dependents,
+                                         const std::unordered_map<std::string, std::string>& object_of,
+                                         const LinkClosure& closure);
+
+    // Names of the gtest suites defined in `source` (TEST, TEST_F, TEST_P, TYPED_TEST...)
+    std::vector<std::string> gtest_suites_in(const fs::path& source);
+
+    // --gtest_filter pattern selecting `suites`, including their
+    // value-parameterized ("Prefix/Suite") and typed ("Suite/0") instances
+    std::string gtest_filter_for(const std::vector<std::string>& suites);
+
+    // Files that differ from `ref` in the working tree, plus untracked ones,
+    // relative to the current directory. Throws std::runtime_error outside
+    // a git repository or for an unknown ref.
+    std::vector<fs::path> git_changed_files(const std::string& ref);
+
+    // Files below `dirs` modified after `stamp` was last written
+    std::vector<fs::path> files_changed_since(const fs::path& stamp, const std::vector<fs::path>& dirs);
+}
+
+#endif // TEST_IMPACT_HPP
@@ -0,0 +1,49 @@
+#ifndef TEST_SHARDS_HPP
+#define TEST_SHARDS_HPP
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace build {
+    namespace fs = std::filesystem;
+
+    // Full names ("Suite.Test", "Prefix/Suite.Test/3") from the output of
+    // `--gtest_list_tests`, in listing order
+    std::vector<std::string> parse_gtest_list(std::string_view output);
+
+    struct TestCaseResult {
+        std::string suite;      // gtest's classname, e.g. "Prefix/Suite"
+        std::string name;
+        double seconds = 0.0;
+        bool failed = false;
+        bool skipped = false;
+        std::string failure;    // Failure messages, one per line
+
+        std::string full_name() const { return suite + "." + name; }
+    };
+
+    // Every <testcase> of a gtest XML report (--gtest_output=xml)
+    std::vector<TestCaseResult> parse_gtest_xml(std::string_view xml);
+
+    // One gtest-style XML report with the cases grouped by suite, in the
+    // order the suites first appear
+    std::string format_gtest_xml(const std::vector<TestCaseResult>& cases);
+
+    // Seconds per test from earlier runs, keyed by full name
+    using TestDurations = std::unordered_map<std::string, double>;
+
+    // "seconds<TAB>name" lines; a missing file is an empty history
+    TestDurations load_test_durations(const fs::path& path);
+    void save_test_durations(const fs::path& path, const TestDurations& durations);
+
+    // Split `tests` into at most `shards` groups of similar expected run time:
+    // longest first, each into the currently lightest group. Tests without
+    // history count as the median known duration. Groups keep listing order.
+    std::vector<std::vector<std::string>> pack_tests(const std::vector<std::string>& tests,
+                                                     const TestDurations& durations, unsigned shards);
+}
+
+#endif // TEST_SHARDS_HPP
@@ -0,0 +1,39 @@
+#ifndef UNITY_BUILD_HPP
+#define UNITY_BUILD_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "build/build_engine.hpp"
+
+namespace build {
+    // Batches when UnityOptions::batches is 0: one per UNITY_BATCH_FILES
+    // files, at most UNITY_DEFAULT_BATCHES. Not tied to the job count, so
+    // every command and -j level merge the same batches and share objects.
+    constexpr unsigned UNITY_BATCH_FILES = 8;
+    constexpr unsigned UNITY_DEFAULT_BATCHES = 4;
+
+    struct UnityOptions {
+        unsigned batches = 0;               // Number of merged translation units (0 = automatic)
+        std::vector<std::string> exclude;   // File names or paths compiled on their own
+    };
+
+    struct UnityBatch {
+        std::vector<fs::path> sources;      // Sorted, so unchanged batches keep identical content
+        uintmax_t bytes = 0;
+    };
+
+    // Split `sources` into at most `batches` groups of similar total size
+    // (largest file first into the lightest batch). Empty batches are dropped.
+    std::vector<UnityBatch> plan_unity_batches(const std::vector<fs::path>& sources, unsigned batches);
+
+    // Rewrite the src/ files of config.sources into build/<name>/unity/unity_N.cpp
+    // files that #include them, plus the excluded files and tests/ and bench/
+    // (whose registration macros may clash when merged) unchanged.
+    // Unity files are only rewritten when their content changes.
+    void apply_unity_build(BuildConfig& config, const UnityOptions& options);
+}
+
+#endif // UNITY_BUILD_HPP
@@ -0,0 +1,56 @@
+#ifndef COUNTERS_HPP
+#define COUNTERS_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace perf {
+    // One measurement; counters the kernel refused to open stay empty
+    struct CounterSample {
+        double wall_seconds = 0.0;
+        std::optional<uint64_t> cycles;
+        std::optional<uint64_t> instructions;
+        std::optional<uint64_t> l1d_misses;         // L1 data cache read misses
+        std::optional<uint64_t> llc_misses;         // Last-level cache misses
+        std::optional<uint64_t> branch_misses;
+        std::optional<uint64_t> context_switches;
+
+        std::optional<double> ipc() const;          // Instructions per cycle
+    };
+
+    // "12.3 ms  cycles 41.2M  instr 98.1M  IPC 2.38  L1d miss 1.1M ..."
+    std::string format_counters(const CounterSample& sample);
+
+    // Hardware counters read with perf_event_open(2). The hardware events form
+    // one group so they are scheduled together and their ratios (IPC, miss
+    // rates) are consistent; values are scaled if the PMU was multiplexed.
+    // User-space only, so perf_event_paranoid <= 2 is enough.
+    class PerfCounters {
+    public:
+        // Count the calling thread; with `inherit`, also every process and
+        // thread it starts while the counters are running
+        explicit PerfCounters(bool inherit = false);
+        ~PerfCounters();
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        // False when no hardware counter could be opened; wall time still works
+        bool hardware_available() const { return fds_[0] >= 0; }
+        // Why hardware counters are missing (perf_event_paranoid, no PMU in a VM, ...)
+        const std::string& unavailable_reason() const { return reason_; }
+
+        void start();
+        CounterSample stop();
+
+    private:
+        static constexpr size_t EVENT_COUNT = 6;    // In CounterSample field order
+        std::array<int, EVENT_COUNT> fds_;
+        std::string reason_;
+        std::chrono::steady_clock::time_point started_;
+    };
+}
+
+#endif // COUNTERS_HPP
@@ -0,0 +1,40 @@
+#ifndef FLAMEGRAPH_HPP
+#define FLAMEGRAPH_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace perf {
+    // "main;run;parse" -> number of samples, the format flamegraph.pl reads
+    using FoldedStacks = std::map<std::string, uint64_t>;
+
+    // Add one stack, outermost frame first
+    void add_stack(FoldedStacks& stacks, const std::vector<std::string>& frames, uint64_t count = 1);
+
+    // Fold the default output of `perf script` (header line, then one
+    // indented line per frame, innermost first, samples separated by blank lines)
+    FoldedStacks fold_perf_script(std::string_view text);
+
+    // One "stack count" line per entry
+    std::string format_folded(const FoldedStacks& stacks);
+
+    uint64_t total_samples(const FoldedStacks& stacks);
+
+    struct HotFunction {
+        std::string name;
+        uint64_t self = 0;      // Samples where the function was the innermost frame
+        uint64_t total = 0;     // Samples where it was anywhere on the stack
+    };
+
+    // The `limit` functions with the most self samples
+    std::vector<HotFunction> hot_functions(const FoldedStacks& stacks, size_t limit);
+
+    // Self-contained SVG flame graph (no scripts or external resources);
+    // hovering a frame shows its name and sample share
+    std::string render_flamegraph(const FoldedStacks& stacks, const std::string& title);
+}
+
+#endif // FLAMEGRAPH_HPP
@@ -0,0 +1,63 @@
+#ifndef PERFGATE_HPP
+#define PERFGATE_HPP
+
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "perf/stats.hpp"
+
+namespace perf {
+    namespace fs = std::filesystem;
+
+    // Machine state that makes timings noisy, recorded with each baseline
+    struct Environment {
+        std::string governor;       // cpufreq scaling governor of cpu0, empty if unknown
+        int turbo = -1;             // 1 = boost enabled, 0 = disabled, -1 = unknown
+        double load = 0.0;          // 1-minute load average
+        unsigned cpus = 0;
+    };
+
+    Environment read_environment();
+
+    // Human-readable warnings about `now`, and about how it differs from the
+    // environment the baseline was recorded in (when given)
+    std::vector<std::string> noise_notes(const Environment& now, const Environment* baseline = nullptr);
+
+    struct Baseline {
+        Environment environment;
+        // Command line -> wall-clock seconds of each run, in recording order
+        std::vector<std::pair<std::string, std::vector<double>>> commands;
+
+        const std::vector<double>* find(const std::string& command) const;
+    };
+
+    // Baselines live outside build/ so `make clean` keeps them and CI can commit them
+    fs::path baseline_path(const std::string& name);
+
+    // Throws std::runtime_error when the baseline does not exist
+    Baseline load_baseline(const std::string& name);
+    void save_baseline(const std::string& name, const Baseline& baseline);
+
+    // Run `argv` `warmup` times untimed, then `runs` times; returns wall seconds.
+    // Output is discarded. Throws std::runtime_error if the command fails.
+    std::vector<double> measure(const std::vector<std::string>& argv, unsigned runs, unsigned warmup);
+
+    enum class Verdict { Unchanged, Faster, Slower };
+
+    struct Comparison {
+        Summary baseline;
+        Summary current;
+        double delta = 0.0;         // Relative change of the median, +0.10 = 10% slower
+        MannWhitney test;
+        Verdict verdict = Verdict::Unchanged;
+    };
+
+    // A command is Slower/Faster only when the median moved by more than
+    // `threshold` (a fraction) and the U test rejects "same distribution" at `alpha`.
+    Comparison compare(const std::vector<double>& baseline, const std::vector<double>& current,
+                       double threshold, double alpha = 0.05);
+}
+
+#endif // PERFGATE_HPP
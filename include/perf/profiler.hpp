@@ -0,0 +1,64 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "build/build_engine.hpp"
+#include "perf/flamegraph.hpp"
+
+namespace perf {
+    namespace fs = std::filesystem;
+
+    // One executable line of /proc/<pid>/maps
+    struct Mapping {
+        uint64_t start = 0;
+        uint64_t end = 0;
+        uint64_t offset = 0;    // File offset of `start`
+        std::string path;
+    };
+
+    // What the built-in sampler writes at exit: raw return-address stacks
+    // (innermost first) plus the process memory map to symbolize them
+    struct SamplerDump {
+        std::vector<std::vector<uint64_t>> stacks;
+        std::vector<Mapping> mappings;
+        uint64_t dropped = 0;   // Samples lost because the buffer was full
+    };
+
+    SamplerDump parse_sampler_dump(std::string_view text);
+
+    // Resolve addresses with addr2line, one batch per module. Frames that
+    // cannot be resolved become "[module]".
+    FoldedStacks symbolize(const SamplerDump& dump);
+
+    struct ProfileOptions {
+        build::BuildConfig config;      // The project's debug or release configuration; built
+                                        // under build/profile/ or build/profile-release/
+        std::vector<std::string> args;  // Program arguments
+        unsigned frequency = 997;       // Samples per second (odd, to avoid lockstep with timers)
+        bool builtin_sampler = false;   // Skip `perf record` even when it is available
+        size_t top = 15;                // Rows in the hot-function table
+        build::BuildOptions build;
+    };
+
+    struct ProfileResult {
+        std::string method;             // "perf" or "sampler"
+        FoldedStacks stacks;
+        fs::path folded;                // build/<config>/profile.folded
+        fs::path flamegraph;            // build/<config>/flamegraph.svg
+        int exit_code = 0;              // Of the profiled program
+    };
+
+    // Build build/profile (or build/profile-release) with frame pointers and
+    // symbols, run the program under `perf record`, falling back to the
+    // SIGPROF sampler linked into that build, and write the folded stacks and
+    // flame graph. Throws std::runtime_error when the build fails or no
+    // samples were collected.
+    ProfileResult run_profile(const ProfileOptions& options);
+}
+
+#endif // PROFILER_HPP
@@ -0,0 +1,33 @@
+#ifndef STATS_HPP
+#define STATS_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace perf {
+    struct Summary {
+        size_t count = 0;
+        double mean = 0.0;
+        double median = 0.0;
+        double stddev = 0.0;    // Sample standard deviation (n - 1)
+        double min = 0.0;
+        double max = 0.0;
+    };
+
+    Summary summarize(std::vector<double> samples);
+
+    // Percentile `p` in [0, 100] with linear interpolation between ranks
+    double percentile(std::vector<double> samples, double p);
+
+    struct MannWhitney {
+        double u = 0.0;         // U statistic of the first sample
+        double z = 0.0;         // Normal approximation, tie and continuity corrected
+        double p_value = 1.0;   // Two-sided
+    };
+
+    // Mann-Whitney U test: do `a` and `b` come from the same distribution?
+    // Makes no normality assumption, which suits skewed timing samples.
+    MannWhitney mann_whitney_u(const std::vector<double>& a, const std::vector<double>& b);
+}
+
+#endif // STATS_HPP
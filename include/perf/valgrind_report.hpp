@@ -0,0 +1,74 @@
+#ifndef VALGRIND_REPORT_HPP
+#define VALGRIND_REPORT_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace perf {
+    namespace fs = std::filesystem;
+
+    // Costs of one function, indexed like ValgrindProfile::events
+    struct FunctionCost {
+        std::string name;
+        std::string file;
+        std::vector<uint64_t> self;
+        std::vector<uint64_t> inclusive;    // Self plus the cost of its calls (callgrind only)
+    };
+
+    // A parsed cachegrind.out.* or callgrind.out.* file
+    struct ValgrindProfile {
+        std::string command;
+        std::vector<std::string> events;    // "Ir", "D1mr", "Bcm", ...
+        std::vector<uint64_t> totals;
+        std::vector<FunctionCost> functions;
+        bool has_calls = false;             // True for callgrind output with call records
+
+        // Sum of the named events in `costs`; missing events count as zero
+        uint64_t sum(const std::vector<uint64_t>& costs, std::initializer_list<std::string_view> names) const;
+        bool has_event(std::string_view name) const;
+    };
+
+    // Understands both formats, including callgrind's name compression
+    // ("fn=(12) name" / "fn=(12)") and relative positions. Costs of the same
+    // function name are merged across files.
+    ValgrindProfile parse_valgrind_profile(std::string_view text);
+
+    // Throws std::runtime_error when the file cannot be read
+    ValgrindProfile load_valgrind_profile(const fs::path& path);
+
+    // Rates derived from the simulated cache and branch events; -1 when the
+    // events were not collected
+    struct CacheRates {
+        double d1_miss = -1.0;      // (D1mr + D1mw) / (Dr + Dw)
+        double ll_miss = -1.0;      // (ILmr + DLmr + DLmw) / (Ir + Dr + Dw)
+        double mispredict = -1.0;   // (Bcm + Bim) / (Bc + Bi)
+        uint64_t mispredicts = 0;
+    };
+
+    CacheRates cache_rates(const ValgrindProfile& profile, const std::vector<uint64_t>& costs);
+
+    // Functions by descending self cost of `event` (Ir when empty)
+    std::vector<const FunctionCost*> hottest(const ValgrindProfile& profile, std::string_view event,
+                                             size_t limit);
+
+    struct FunctionDelta {
+        std::string name;
+        std::vector<uint64_t> before;       // Self costs, indexed like `events` of the diff
+        std::vector<uint64_t> after;
+    };
+
+    struct ProfileDiff {
+        std::vector<std::string> events;    // Events present in both profiles
+        std::vector<uint64_t> before_totals;
+        std::vector<uint64_t> after_totals;
+        std::vector<FunctionDelta> functions;   // Largest absolute Ir change first
+    };
+
+    ProfileDiff diff_profiles(const ValgrindProfile& before, const ValgrindProfile& after);
+}
+
+#endif // VALGRIND_REPORT_HPP
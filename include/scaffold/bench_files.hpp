@@ -0,0 +1,16 @@
+#ifndef BENCH_FILES_HPP
+#define BENCH_FILES_HPP
+
+#include <string_view>
+
+namespace scaffold {
+    // bench/bench.hpp: header-only microbenchmark library (BENCH registration,
+    // calibration, warmup, DoNotOptimize/ClobberMemory, ranges, JSON output)
+    extern const std::string_view BENCH_HARNESS_HPP;
+    // bench/bench_example.cpp: sample benchmarks showing ranges and counters
+    extern const std::string_view BENCH_EXAMPLE_CPP;
+    // bench/bench_main.cpp: BENCH_MAIN()
+    extern const std::string_view BENCH_MAIN_CPP;
+}
+
+#endif // BENCH_FILES_HPP
@@ -0,0 +1,33 @@
+#ifndef GIT_REPOSITORY_HPP
+#define GIT_REPOSITORY_HPP
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace scaffold {
+    namespace fs = std::filesystem;
+
+    // Who commits, and on which branch. Read once and shared by every
+    // repository of a batch.
+    struct GitIdentity {
+        std::string author;         // "Name <email> 1700000000 +0100", as printed by `git var`
+        std::string committer;
+        std::string branch = "master";
+    };
+
+    // Runs `git var GIT_AUTHOR_IDENT`/`GIT_COMMITTER_IDENT` and reads
+    // init.defaultBranch, so the result honours the same config and
+    // environment as `git commit`. Throws std::runtime_error when git is
+    // missing or no identity is configured.
+    GitIdentity read_git_identity();
+
+    // Same result as `git init && git add . && git commit -m <message>` in a
+    // freshly created project, written without running git: loose objects,
+    // the index, HEAD, the branch ref and its reflog. The top-level build/
+    // directory is left out, as the generated .gitignore does. Returns the
+    // commit id. Throws std::runtime_error on I/O errors.
+    std::string git_init_commit(const fs::path& root, const GitIdentity& identity, std::string_view message);
+}
+
+#endif // GIT_REPOSITORY_HPP
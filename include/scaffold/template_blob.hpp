@@ -0,0 +1,18 @@
+#ifndef TEMPLATE_BLOB_HPP
+#define TEMPLATE_BLOB_HPP
+
+#include <cstddef>
+#include <string_view>
+
+// Defined in build/generated/template_blob.cpp, which the Makefile generates
+// from templates/ with tools/pack_templates.cpp
+extern const unsigned char cppstarter_template_blob[];
+extern const std::size_t cppstarter_template_blob_size;
+
+namespace scaffold {
+    inline std::string_view embedded_templates() {
+        return {reinterpret_cast<const char*>(cppstarter_template_blob), cppstarter_template_blob_size};
+    }
+}
+
+#endif // TEMPLATE_BLOB_HPP
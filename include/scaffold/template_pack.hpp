@@ -0,0 +1,84 @@
+#ifndef TEMPLATE_PACK_HPP
+#define TEMPLATE_PACK_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace scaffold {
+    namespace fs = std::filesystem;
+
+    // LZ77 byte compression (LZ4-style sequences: a token with literal and
+    // match lengths, the literals, a 16-bit back offset). Small and fast to
+    // decode; good enough for source text.
+    std::string compress(std::string_view data);
+
+    // Throws std::runtime_error when `data` is corrupt or does not expand to `raw_size` bytes
+    std::string decompress(std::string_view data, size_t raw_size);
+
+    // Pack every file below each subdirectory of `dir` (one template per
+    // subdirectory) into a blob: a fixed-size index of templates and files,
+    // a string table with their names, then the file contents, each
+    // compressed on its own when that makes it smaller.
+    std::string pack_templates(const fs::path& dir);
+
+    // The C++ source that embeds `blob` as cppstarter_template_blob
+    std::string blob_to_cpp(std::string_view blob);
+
+    // "{{name}}" -> value
+    using Variables = std::vector<std::pair<std::string_view, std::string_view>>;
+
+    // Replace "{{name}}" placeholders in one pass; unknown names are kept verbatim
+    std::string substitute(std::string_view text, const Variables& variables);
+
+    struct TemplateFile {
+        std::string_view path;      // Relative to the project root
+        std::string_view stored;    // Bytes in the blob
+        uint32_t raw_size = 0;
+        bool compressed = false;
+        bool has_variables = false; // Contains "{{"; written after substitution
+        bool executable = false;
+
+        // The original file contents
+        std::string contents() const;
+    };
+
+    // Read-only view of a packed blob. Nothing is decoded up front: lookups
+    // walk the fixed-size index records in place.
+    class TemplatePack {
+    public:
+        // Throws std::runtime_error when the header is not a template blob
+        explicit TemplatePack(std::string_view blob);
+
+        std::vector<std::string_view> ids() const;
+        bool contains(std::string_view id) const;
+        // Throws std::runtime_error for an unknown template
+        std::vector<TemplateFile> files(std::string_view id) const;
+
+    private:
+        uint32_t read_u32(size_t offset) const;
+        std::string_view slice(uint32_t offset, uint32_t length) const;
+        // Index of the template record for `id`, or template_count_ if there is none
+        uint32_t find(std::string_view id) const;
+
+        std::string_view blob_;
+        uint32_t template_count_ = 0;
+        uint32_t file_count_ = 0;
+    };
+
+    // Create or replace `path` with one open/write(2) sequence (no iostreams).
+    // Throws std::runtime_error on failure.
+    void write_file(const fs::path& path, std::string_view data, bool executable = false);
+
+    // Write the files of template `id` below `destination`, creating
+    // directories as needed; returns the number of files written. Files
+    // without placeholders are written straight from the (decompressed)
+    // blob with a single write(2). Throws std::runtime_error on failure.
+    size_t write_template(const TemplatePack& pack, std::string_view id, const fs::path& destination,
+                          const Variables& variables);
+}
+
+#endif // TEMPLATE_PACK_HPP
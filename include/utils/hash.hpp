@@ -0,0 +1,63 @@
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace hash {
+    // Incremental SHA-256, used for content-addressed cache keys
+    class Sha256 {
+    public:
+        Sha256();
+
+        void update(const void* data, size_t length);
+        void update(std::string_view text) { update(text.data(), text.size()); }
+
+        // Finish the hash; the object must not be updated afterwards
+        std::array<uint8_t, 32> digest();
+        std::string hex_digest();
+
+    private:
+        void transform(const uint8_t* block);
+
+        std::array<uint32_t, 8> state_;
+        std::array<uint8_t, 64> buffer_{};
+        uint64_t total_length_ = 0;
+        size_t buffer_length_ = 0;
+    };
+
+    // Incremental SHA-1, only for git object ids
+    class Sha1 {
+    public:
+        Sha1();
+
+        void update(const void* data, size_t length);
+        void update(std::string_view text) { update(text.data(), text.size()); }
+
+        // Finish the hash; the object must not be updated afterwards
+        std::array<uint8_t, 20> digest();
+        std::string hex_digest();
+
+    private:
+        void transform(const uint8_t* block);
+
+        std::array<uint32_t, 5> state_;
+        std::array<uint8_t, 64> buffer_{};
+        uint64_t total_length_ = 0;
+        size_t buffer_length_ = 0;
+    };
+
+    // Lowercase hexadecimal representation of a byte range
+    std::string to_hex(const uint8_t* data, size_t length);
+
+    inline std::string sha256_hex(std::string_view text) {
+        Sha256 sha;
+        sha.update(text);
+        return sha.hex_digest();
+    }
+}
+
+#endif // HASH_HPP
@@ -0,0 +1,36 @@
+#ifndef PROCESS_HPP
+#define PROCESS_HPP
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace process {
+    // Outcome of a finished child process
+    struct Result {
+        int exit_code = -1;        // Exit status, or 128 + signal number when killed
+        std::string output;        // Combined stdout/stderr (only when captured)
+        double wall_seconds = 0.0; // Time from spawn to reap
+        long max_rss_kb = 0;       // Peak resident set size reported by wait4()
+    };
+
+    struct Options {
+        bool capture_output = true;          // Pipe stdout/stderr into Result::output
+        std::vector<std::string> extra_env;  // "KEY=VALUE" entries added to the environment
+        // Called with each captured line (without its newline) as it arrives
+        std::function<void(std::string_view line)> on_line;
+    };
+
+    // Spawn argv[0] (looked up in PATH) and block until it exits.
+    // Throws std::runtime_error when the process cannot be started.
+    Result run(const std::vector<std::string>& argv, const Options& options = {});
+
+    // Quote a single argument for display or for passing through /bin/sh
+    std::string shell_quote(const std::string& arg);
+
+    // Join an argv vector into a printable, shell-safe command line
+    std::string join_command(const std::vector<std::string>& argv);
+}
+
+#endif // PROCESS_HPP
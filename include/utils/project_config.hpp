@@ -0,0 +1,43 @@
+#ifndef PROJECT_CONFIG_HPP
+#define PROJECT_CONFIG_HPP
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace config {
+    // Per-project settings written by `cppstarter new` and read by the
+    // commands that drive the build. Plain `key = value` lines, `#` comments.
+    constexpr char PROJECT_CONFIG_FILE[] = "cppstarter.conf";
+
+    class ProjectConfig {
+    public:
+        // Missing files yield an empty configuration
+        static ProjectConfig load(const std::filesystem::path& path = PROJECT_CONFIG_FILE);
+
+        bool has(std::string_view key) const;
+        std::string get(std::string_view key, std::string_view fallback = "") const;
+        bool get_bool(std::string_view key, bool fallback) const;
+        int get_int(std::string_view key, int fallback) const;
+        // Whitespace-separated values
+        std::vector<std::string> get_list(std::string_view key) const;
+
+        // Replaces the value in place, or appends a new line for unknown keys
+        void set(std::string_view key, std::string_view value);
+        // Writes the file back, keeping comments and ordering
+        void save(const std::filesystem::path& path = PROJECT_CONFIG_FILE) const;
+
+    private:
+        struct Line {
+            std::string key;    // Empty for comments and blank lines
+            std::string value;
+            std::string raw;
+        };
+        const Line* find(std::string_view key) const;
+
+        std::vector<Line> lines_;
+    };
+}
+
+#endif // PROJECT_CONFIG_HPP
@@ -0,0 +1,96 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utils {
+    // Number of workers to use when the user did not ask for a specific count
+    inline unsigned default_job_count() {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Fixed-size worker pool. Jobs run in submission order; wait() blocks until
+    // the queue is drained and every worker is idle.
+    class ThreadPool {
+    public:
+        explicit ThreadPool(unsigned workers = default_job_count()) {
+            workers = std::max(1u, workers);
+            threads_.reserve(workers);
+            for (unsigned i = 0; i < workers; ++i) {
+                threads_.emplace_back([this] { worker_loop(); });
+            }
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopping_ = true;
+            }
+            wake_workers_.notify_all();
+            for (auto& thread : threads_) {
+                thread.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void submit(std::function<void()> job) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                jobs_.push_back(std::move(job));
+            }
+            wake_workers_.notify_one();
+        }
+
+        void wait() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            idle_.wait(lock, [this] { return jobs_.empty() && active_ == 0; });
+        }
+
+        unsigned size() const { return static_cast<unsigned>(threads_.size()); }
+
+    private:
+        void worker_loop() {
+            for (;;) {
+                std::function<void()> job;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    wake_workers_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+                    if (jobs_.empty()) {
+                        return;
+                    }
+                    job = std::move(jobs_.front());
+                    jobs_.pop_front();
+                    ++active_;
+                }
+
+                job();
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    --active_;
+                    if (jobs_.empty() && active_ == 0) {
+                        idle_.notify_all();
+                    }
+                }
+            }
+        }
+
+        std::vector<std::thread> threads_;
+        std::deque<std::function<void()>> jobs_;
+        std::mutex mutex_;
+        std::condition_variable wake_workers_;
+        std::condition_variable idle_;
+        unsigned active_ = 0;
+        bool stopping_ = false;
+    };
+}
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,467 @@
+#include "scaffold/bench_files.hpp"
+
+namespace scaffold {
+
+// Written verbatim to bench/ by `cppstarter new`. Kept dependency free so the
+// generated project builds benchmarks with nothing but the compiler.
+
+const std::string_view BENCH_HARNESS_HPP = R"BENCH(#pragma once
+
+// Minimal microbenchmark harness generated by cppstarter.
+//
+//   static void bm_sum(bench::State& state) {
+//       std::vector<int> data(state.range(0), 1);
+//       for (auto _ : state) {
+//           bench::DoNotOptimize(std::accumulate(data.begin(), data.end(), 0));
+//       }
+//       state.set_items_processed(state.iterations() * data.size());
+//   }
+//   BENCH(bm_sum)->range(8, 1 << 16);
+//
+// Each benchmark is warmed up, then the iteration count is calibrated so
+// that one sample takes at least --min-time seconds. Statistics are computed
+// over --samples samples. Run the binary with --help for all options.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// === Optimization barriers ===
+
+// Forces `value` to be materialized, so the computation producing it is not removed
+template <class T>
+inline void DoNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template <class T>
+inline void DoNotOptimize(T& value) {
+    asm volatile("" : "+r,m"(value) : : "memory");
+}
+
+// Forces pending writes to memory, so stores into buffers are not elided
+inline void ClobberMemory() {
+    asm volatile("" : : : "memory");
+}
+
+// === Benchmark state ===
+
+class State {
+public:
+    State(uint64_t iterations, std::vector<int64_t> args)
+        : iterations_(iterations), args_(std::move(args)) {}
+
+    // Parameter `index` of the current run (see Benchmark::range/arg)
+    int64_t range(size_t index = 0) const { return index < args_.size() ? args_[index] : 0; }
+    uint64_t iterations() const { return iterations_; }
+
+    // Totals over all iterations, used for the items/s and bytes/s columns
+    void set_items_processed(uint64_t items) { items_ = items; }
+    void set_bytes_processed(uint64_t bytes) { bytes_ = bytes; }
+    uint64_t items_processed() const { return items_; }
+    uint64_t bytes_processed() const { return bytes_; }
+
+    // Exclude setup work inside the loop from the measurement
+    void pause_timing() { paused_ += elapsed_since(clock::now()); running_ = false; }
+    void resume_timing() { start_ = clock::now(); running_ = true; }
+
+    // `for (auto _ : state)` runs the body iterations() times
+    struct Value { ~Value() {} };  // Non-trivial, so the unused loop variable does not warn
+    struct Iterator {
+        uint64_t remaining;
+        State* state;
+        bool operator!=(const Iterator&) const {
+            if (remaining != 0) {
+                return true;
+            }
+            state->finish();
+            return false;
+        }
+        void operator++() { --remaining; }
+        Value operator*() const { return {}; }
+    };
+    Iterator begin() { start(); return {iterations_, this}; }
+    Iterator end() { return {0, this}; }
+
+    // Alternative loop form: while (state.keep_running()) { ... }
+    bool keep_running() {
+        if (!started_) {
+            start();
+        }
+        if (remaining_ == 0) {
+            finish();
+            return false;
+        }
+        --remaining_;
+        return true;
+    }
+
+    double elapsed_seconds() const { return measured_; }
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    double elapsed_since(clock::time_point now) const {
+        return std::chrono::duration<double>(now - start_).count();
+    }
+    void start() {
+        started_ = true;
+        remaining_ = iterations_;
+        running_ = true;
+        start_ = clock::now();
+    }
+    void finish() {
+        if (running_) {
+            paused_ += elapsed_since(clock::now());
+            running_ = false;
+        }
+        measured_ = paused_;
+    }
+
+    uint64_t iterations_;
+    uint64_t remaining_ = 0;
+    std::vector<int64_t> args_;
+    uint64_t items_ = 0;
+    uint64_t bytes_ = 0;
+    bool started_ = false;
+    bool running_ = false;
+    clock::time_point start_;
+    double paused_ = 0.0;    // Accumulated running time
+    double measured_ = 0.0;
+};
+
+using Function = void (*)(State&);
+
+// === Registration ===
+
+class Benchmark {
+public:
+    Benchmark(std::string name, Function function) : name_(std::move(name)), function_(function) {}
+
+    // Run once per value
+    Benchmark* arg(int64_t value) { args_.push_back({value}); return this; }
+    Benchmark* args(std::vector<int64_t> values) { args_.push_back(std::move(values)); return this; }
+
+    // lo, lo*multiplier, ... up to and including hi
+    Benchmark* range(int64_t lo, int64_t hi, int64_t multiplier = 8) {
+        for (int64_t value = lo; value < hi; value *= std::max<int64_t>(2, multiplier)) {
+            args_.push_back({value});
+        }
+        args_.push_back({hi});
+        return this;
+    }
+
+    // Per-benchmark override of --min-time
+    Benchmark* min_time(double seconds) { min_time_ = seconds; return this; }
+
+    const std::string& name() const { return name_; }
+    Function function() const { return function_; }
+    const std::vector<std::vector<int64_t>>& arg_sets() const { return args_; }
+    double min_time() const { return min_time_; }
+
+private:
+    std::string name_;
+    Function function_;
+    std::vector<std::vector<int64_t>> args_;
+    double min_time_ = 0.0;
+};
+
+inline std::vector<std::unique_ptr<Benchmark>>& registry() {
+    static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+    return benchmarks;
+}
+
+inline Benchmark* register_benchmark(const char* name, Function function) {
+    registry().push_back(std::make_unique<Benchmark>(name, function));
+    return registry().back().get();
+}
+
+#define BENCH_CONCAT_INNER(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_INNER(a, b)
+
+// BENCH(function)->range(8, 4096);
+#define BENCH(function) \
+    [[maybe_unused]] static ::bench::Benchmark* BENCH_CONCAT(bench_registration_, __LINE__) = \
+        ::bench::register_benchmark(#function, function)
+
+// === Running ===
+
+struct Options {
+    std::string filter;         // Substring of the benchmark name
+    std::string json_path;      // Write results as JSON here ("-" = stdout)
+    double min_time = 0.01;     // Seconds per sample
+    double warmup = 0.05;       // Seconds of untimed runs before calibrating
+    unsigned samples = 20;
+    bool list = false;
+};
+
+struct Result {
+    std::string name;
+    uint64_t iterations = 0;    // Per sample
+    unsigned samples = 0;
+    double mean_ns = 0.0;       // Per iteration
+    double median_ns = 0.0;
+    double p99_ns = 0.0;
+    double stddev_ns = 0.0;
+    double items_per_second = 0.0;
+    double bytes_per_second = 0.0;
+};
+
+inline double run_once(Function function, const std::vector<int64_t>& args, uint64_t iterations,
+                       uint64_t* items = nullptr, uint64_t* bytes = nullptr) {
+    State state(iterations, args);
+    function(state);
+    if (items) *items = state.items_processed();
+    if (bytes) *bytes = state.bytes_processed();
+    return state.elapsed_seconds();
+}
+
+inline Result run_benchmark(const std::string& name, Function function,
+                            const std::vector<int64_t>& args, const Options& options) {
+    // Warm up caches, branch predictors and the CPU clock
+    const auto warmup_end = std::chrono::steady_clock::now() + std::chrono::duration<double>(options.warmup);
+    while (std::chrono::steady_clock::now() < warmup_end) {
+        run_once(function, args, 1);
+    }
+
+    // Grow the iteration count until one sample is long enough to time reliably
+    uint64_t iterations = 1;
+    for (;;) {
+        const double seconds = run_once(function, args, iterations);
+        if (seconds >= options.min_time || iterations >= (uint64_t(1) << 40)) {
+            break;
+        }
+        const double scale = seconds > 0 ? options.min_time * 1.4 / seconds : 10.0;
+        iterations = std::max(iterations + 1, uint64_t(iterations * std::min(scale, 10.0)));
+    }
+
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.samples = std::max(1u, options.samples);
+
+    std::vector<double> per_iteration;
+    uint64_t items = 0;
+    uint64_t bytes = 0;
+    for (unsigned i = 0; i < result.samples; ++i) {
+        per_iteration.push_back(run_once(function, args, iterations, &items, &bytes) * 1e9 / iterations);
+    }
+
+    std::sort(per_iteration.begin(), per_iteration.end());
+    const size_t n = per_iteration.size();
+    double sum = 0.0;
+    for (double value : per_iteration) sum += value;
+    result.mean_ns = sum / n;
+    result.median_ns = n % 2 ? per_iteration[n / 2] : (per_iteration[n / 2 - 1] + per_iteration[n / 2]) / 2;
+    result.p99_ns = per_iteration[std::min(n - 1, size_t(std::ceil(0.99 * n)) - 1)];
+    double variance = 0.0;
+    for (double value : per_iteration) variance += (value - result.mean_ns) * (value - result.mean_ns);
+    result.stddev_ns = n > 1 ? std::sqrt(variance / (n - 1)) : 0.0;
+
+    // Counters are totals over one sample's iterations
+    if (result.median_ns > 0) {
+        result.items_per_second = double(items) / iterations * 1e9 / result.median_ns;
+        result.bytes_per_second = double(bytes) / iterations * 1e9 / result.median_ns;
+    }
+    return result;
+}
+
+inline std::string format_time(double ns) {
+    char buffer[32];
+    if (ns < 1e3) std::snprintf(buffer, sizeof buffer, "%.2f ns", ns);
+    else if (ns < 1e6) std::snprintf(buffer, sizeof buffer, "%.2f us", ns / 1e3);
+    else if (ns < 1e9) std::snprintf(buffer, sizeof buffer, "%.2f ms", ns / 1e6);
+    else std::snprintf(buffer, sizeof buffer, "%.2f s", ns / 1e9);
+    return buffer;
+}
+
+inline std::string format_rate(double value, const char* unit) {
+    if (value <= 0) return "-";
+    const char* prefixes[] = {"", "k", "M", "G", "T"};
+    int prefix = 0;
+    while (value >= 1000 && prefix < 4) {
+        value /= 1000;
+        ++prefix;
+    }
+    char buffer[32];
+    std::snprintf(buffer, sizeof buffer, "%.2f %s%s/s", value, prefixes[prefix], unit);
+    return buffer;
+}
+
+inline std::string json_escape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+inline void write_json(std::ostream& out, const std::vector<Result>& results, const Options& options) {
+    char date[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof date, "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\n  \"context\": {\"date\": \"" << date << "\", \"samples\": " << options.samples
+        << ", \"min_time\": " << options.min_time << "},\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << (i ? ",\n" : "\n")
+            << "    {\"name\": \"" << json_escape(r.name) << "\", \"iterations\": " << r.iterations
+            << ", \"samples\": " << r.samples << ", \"mean_ns\": " << r.mean_ns
+            << ", \"median_ns\": " << r.median_ns << ", \"p99_ns\": " << r.p99_ns
+            << ", \"stddev_ns\": " << r.stddev_ns << ", \"items_per_second\": " << r.items_per_second
+            << ", \"bytes_per_second\": " << r.bytes_per_second << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+inline void print_usage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --filter <text>    Only run benchmarks whose name contains <text>\n"
+              << "  --json <file>      Also write results as JSON (- for stdout)\n"
+              << "  --min-time <s>     Minimum seconds per sample (default 0.01)\n"
+              << "  --warmup <s>       Untimed warmup seconds per benchmark (default 0.05)\n"
+              << "  --samples <n>      Samples per benchmark (default 20)\n"
+              << "  --list             List benchmark names and exit\n";
+}
+
+inline int run_main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--filter" && has_value) options.filter = argv[++i];
+        else if (arg == "--json" && has_value) options.json_path = argv[++i];
+        else if (arg == "--min-time" && has_value) options.min_time = std::atof(argv[++i]);
+        else if (arg == "--warmup" && has_value) options.warmup = std::atof(argv[++i]);
+        else if (arg == "--samples" && has_value) options.samples = unsigned(std::atoi(argv[++i]));
+        else if (arg == "--list") options.list = true;
+        else {
+            print_usage(argv[0]);
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    std::vector<Result> results;
+    const bool table = options.json_path != "-" && !options.list;
+    if (table) {
+        std::printf("%-32s %12s %12s %12s %12s %12s %16s %16s\n", "Benchmark", "Iterations",
+                    "Mean", "Median", "p99", "Stddev", "Items/s", "Bytes/s");
+        std::printf("%s\n", std::string(32 + 13 * 5 + 17 * 2, '-').c_str());
+    }
+
+    for (const auto& benchmark : registry()) {
+        std::vector<std::vector<int64_t>> arg_sets = benchmark->arg_sets();
+        if (arg_sets.empty()) {
+            arg_sets.push_back({});
+        }
+        for (const auto& args : arg_sets) {
+            std::string name = benchmark->name();
+            for (int64_t value : args) {
+                name += '/' + std::to_string(value);
+            }
+            if (name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+            if (options.list) {
+                std::cout << name << '\n';
+                continue;
+            }
+
+            Options run_options = options;
+            if (benchmark->min_time() > 0) {
+                run_options.min_time = benchmark->min_time();
+            }
+            Result r = run_benchmark(name, benchmark->function(), args, run_options);
+            if (table) {
+                std::printf("%-32s %12llu %12s %12s %12s %12s %16s %16s\n", r.name.c_str(),
+                            static_cast<unsigned long long>(r.iterations), format_time(r.mean_ns).c_str(),
+                            format_time(r.median_ns).c_str(), format_time(r.p99_ns).c_str(),
+                            format_time(r.stddev_ns).c_str(), format_rate(r.items_per_second, "").c_str(),
+                            format_rate(r.bytes_per_second, "B").c_str());
+                std::fflush(stdout);
+            }
+            results.push_back(r);
+        }
+    }
+
+    if (options.json_path == "-") {
+        write_json(std::cout, results, options);
+    } else if (!options.json_path.empty()) {
+        std::ofstream file(options.json_path);
+        if (!file) {
+            std::cerr << "Could not write " << options.json_path << '\n';
+            return 1;
+        }
+        write_json(file, results, options);
+    }
+    return 0;
+}
+
+} // namespace bench
+
+// Defines main() for the benchmark binary; used once, in bench_main.cpp
+#define BENCH_MAIN() \
+    int main(int argc, char* argv[]) { return ::bench::run_main(argc, argv); }
+)BENCH";
+
+const std::string_view BENCH_EXAMPLE_CPP = R"BENCH(#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// Sum a vector of range(0) ints: reports items/s and bytes/s
+static void bm_accumulate(bench::State& state) {
+    std::vector<int> data(static_cast<size_t>(state.range(0)), 1);
+    for (auto _ : state) {
+        int sum = std::accumulate(data.begin(), data.end(), 0);
+        bench::DoNotOptimize(sum);
+    }
+    state.set_items_processed(state.iterations() * data.size());
+    state.set_bytes_processed(state.iterations() * data.size() * sizeof(int));
+}
+BENCH(bm_accumulate)->range(64, 1 << 16);
+
+// Sort a fresh shuffled copy each iteration; the copy is not timed
+static void bm_sort(bench::State& state) {
+    std::vector<int> input(static_cast<size_t>(state.range(0)));
+    std::iota(input.begin(), input.end(), 0);
+    std::shuffle(input.begin(), input.end(), std::mt19937(42));
+
+    std::vector<int> data;
+    while (state.keep_running()) {
+        state.pause_timing();
+        data = input;
+        state.resume_timing();
+        std::sort(data.begin(), data.end());
+        bench::ClobberMemory();
+    }
+    state.set_items_processed(state.iterations() * input.size());
+}
+BENCH(bm_sort)->arg(1000)->arg(100000);
+)BENCH";
+
+const std::string_view BENCH_MAIN_CPP = R"BENCH(#include "bench.hpp"
+
+BENCH_MAIN()
+)BENCH";
+
+} // namespace scaffold
@@ -0,0 +1,469 @@
+#include "build/build_analysis.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "utils/process.hpp"
+
+namespace build {
+
+namespace {
+
+constexpr char HISTORY_HEADER[] =
+    "# cppstarter build history v1: time commit config units wall cpu peak_rss_kb top_header";
+
+// Inclusions shorter than this are left out of the Chrome trace; a TU
+// pulls in hundreds of tiny system headers
+constexpr double TRACE_MIN_SECONDS = 100e-6;
+
+std::vector<std::string_view> split_lines(std::string_view text) {
+    std::vector<std::string_view> lines;
+    for (size_t start = 0; start < text.size();) {
+        size_t end = text.find('\n', start);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        lines.push_back(text.substr(start, end - start));
+        start = end + 1;
+    }
+    return lines;
+}
+
+bool starts_with(std::string_view text, std::string_view prefix) {
+    return text.substr(0, prefix.size()) == prefix;
+}
+
+// Wall seconds of one -ftime-report row:
+// " phase parsing   :   0.51 ( 63%)   0.24 ( 80%)   0.77 ( 66%)    36M ( 70%)"
+// Columns are usr, sys, wall and GGC memory, each optionally with a percentage.
+double time_report_wall(std::string_view row) {
+    std::string values;
+    int parens = 0;
+    for (char c : row.substr(row.find(':') + 1)) {
+        if (c == '(') {
+            ++parens;
+        } else if (c == ')') {
+            --parens;
+        } else if (parens == 0) {
+            values += c;
+        }
+    }
+    std::istringstream columns(values);
+    std::string usr, sys, wall;
+    if (!(columns >> usr >> sys >> wall)) {
+        return 0.0;
+    }
+    try {
+        return std::stod(wall);
+    } catch (const std::exception&) {
+        return 0.0;
+    }
+}
+
+// Lay inclusions out in time: children start where their parent starts,
+// siblings follow each other. Used where the compiler gives durations only.
+void assign_offsets(std::vector<Inclusion>& includes, double start) {
+    struct Open {
+        unsigned depth;
+        double end;
+    };
+    std::vector<Open> open;
+    double cursor = start;
+    for (auto& inclusion : includes) {
+        while (!open.empty() && open.back().depth >= inclusion.depth) {
+            cursor = open.back().end;
+            open.pop_back();
+        }
+        inclusion.offset = cursor;
+        open.push_back({inclusion.depth, cursor + inclusion.seconds});
+    }
+}
+
+// Every top-level object of the JSON array that follows `key`
+std::vector<std::string_view> json_array_objects(std::string_view json, std::string_view key) {
+    std::vector<std::string_view> objects;
+    size_t pos = json.find("\"" + std::string(key) + "\"");
+    if (pos == std::string_view::npos || (pos = json.find('[', pos)) == std::string_view::npos) {
+        return objects;
+    }
+    int depth = 0;
+    bool in_string = false;
+    size_t object_start = 0;
+    for (size_t i = pos + 1; i < json.size(); ++i) {
+        const char c = json[i];
+        if (in_string) {
+            if (c == '\\') {
+                ++i;
+            } else if (c == '"') {
+                in_string = false;
+            }
+        } else if (c == '"') {
+            in_string = true;
+        } else if (c == '{' || c == '[') {
+            if (depth++ == 0) {
+                object_start = i;
+            }
+        } else if (c == '}' || c == ']') {
+            if (depth == 0) {
+                break;  // End of the array
+            }
+            if (--depth == 0) {
+                objects.push_back(json.substr(object_start, i - object_start + 1));
+            }
+        }
+    }
+    return objects;
+}
+
+// Value of the first `"key":` in `object`: a string's contents (unescaped)
+// or a number's text. Nested objects are searched too, which is how
+// args.detail is found.
+std::string json_value(std::string_view object, std::string_view key) {
+    const std::string quoted = "\"" + std::string(key) + "\"";
+    size_t pos = object.find(quoted);
+    if (pos == std::string_view::npos || (pos = object.find(':', pos + quoted.size())) == std::string_view::npos) {
+        return {};
+    }
+    pos = object.find_first_not_of(" \t\r\n", pos + 1);
+    if (pos == std::string_view::npos) {
+        return {};
+    }
+    std::string value;
+    if (object[pos] == '"') {
+        for (size_t i = pos + 1; i < object.size() && object[i] != '"'; ++i) {
+            if (object[i] == '\\' && i + 1 < object.size()) {
+                ++i;
+            }
+            value += object[i];
+        }
+        return value;
+    }
+    for (size_t i = pos; i < object.size() && object[i] != ',' && object[i] != '}'; ++i) {
+        value += object[i];
+    }
+    return value;
+}
+
+double json_number(std::string_view object, std::string_view key) {
+    try {
+        return std::stod(json_value(object, key));
+    } catch (const std::exception&) {
+        return 0.0;
+    }
+}
+
+std::string json_escape(std::string_view text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", c);
+            escaped += code;
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+} // namespace
+
+bool compiler_is_clang(const std::string& compiler) {
+    try {
+        return process::run({compiler, "--version"}).output.find("clang") != std::string::npos;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+std::vector<std::string> analysis_flags(bool clang) {
+    if (clang) {
+        return {"-ftime-trace"};
+    }
+    return {"-H", "-ftime-report"};
+}
+
+std::string parse_gcc_analysis(std::string_view output, UnitAnalysis& unit) {
+    std::vector<std::string> kept;
+    bool in_guard_list = false;
+    bool in_time_report = false;
+    bool have_time_report = false;
+    for (std::string_view line : split_lines(output)) {
+        if (in_guard_list) {
+            // "Multiple include guards may be useful for:" lists paths up to a blank line
+            in_guard_list = !line.empty();
+            continue;
+        }
+        if (in_time_report) {
+            if (starts_with(line, " phase parsing") || starts_with(line, " phase lang. deferred")) {
+                unit.frontend_seconds += time_report_wall(line);
+            } else if (starts_with(line, " phase opt and generate")) {
+                unit.backend_seconds += time_report_wall(line);
+            }
+            in_time_report = !starts_with(line, " TOTAL");
+            continue;
+        }
+        if (starts_with(line, "Time variable")) {
+            in_time_report = have_time_report = true;
+            if (!kept.empty() && kept.back().empty()) {
+                kept.pop_back();
+            }
+            continue;
+        }
+        if (line == "Multiple include guards may be useful for:") {
+            in_guard_list = true;
+            continue;
+        }
+        const size_t dots = line.find_first_not_of('.');
+        if (dots != std::string_view::npos && dots > 0 && line[dots] == ' ') {
+            Inclusion inclusion;
+            inclusion.header = line.substr(dots + 1);
+            inclusion.depth = static_cast<unsigned>(dots);
+            unit.includes.push_back(std::move(inclusion));
+            continue;
+        }
+        if (starts_with(line, "! ") || starts_with(line, "x ")) {
+            continue;   // -H reporting a (valid or rejected) precompiled header
+        }
+        kept.emplace_back(line);
+    }
+    if (!have_time_report) {
+        unit.frontend_seconds = unit.seconds;
+    }
+
+    // Share the frontend time out by bytes: every inclusion gets its own
+    // share plus those of everything it includes
+    std::error_code ec;
+    std::vector<double> bytes(unit.includes.size());
+    double total_bytes = static_cast<double>(fs::file_size(unit.source, ec));
+    if (ec) {
+        total_bytes = 0.0;
+    }
+    for (size_t i = 0; i < unit.includes.size(); ++i) {
+        const uintmax_t size = fs::file_size(unit.includes[i].header, ec);
+        bytes[i] = ec ? 0.0 : static_cast<double>(size);
+        total_bytes += bytes[i];
+    }
+    if (total_bytes > 0.0) {
+        std::vector<size_t> open;   // Indices of the inclusions enclosing the current one
+        for (size_t i = 0; i < unit.includes.size(); ++i) {
+            while (!open.empty() && unit.includes[open.back()].depth >= unit.includes[i].depth) {
+                open.pop_back();
+            }
+            const double share = unit.frontend_seconds * bytes[i] / total_bytes;
+            unit.includes[i].seconds += share;
+            for (size_t parent : open) {
+                unit.includes[parent].seconds += share;
+            }
+            open.push_back(i);
+        }
+    }
+    assign_offsets(unit.includes, 0.0);
+
+    std::string rest;
+    for (const auto& line : kept) {
+        rest += line;
+        rest += '\n';
+    }
+    return rest;
+}
+
+void parse_clang_time_trace(std::string_view json, UnitAnalysis& unit) {
+    struct Event {
+        double ts;
+        double dur;
+        std::string detail;
+    };
+    std::vector<Event> sources;
+    for (std::string_view event : json_array_objects(json, "traceEvents")) {
+        const std::string name = json_value(event, "name");
+        const double dur = json_number(event, "dur") / 1e6;
+        if (name == "Source") {
+            sources.push_back({json_number(event, "ts") / 1e6, dur, json_value(event, "detail")});
+        } else if (name == "Total Frontend") {
+            unit.frontend_seconds = dur;
+        } else if (name == "Total Backend") {
+            unit.backend_seconds = dur;
+        }
+    }
+
+    // Nesting follows from the time ranges; an event starting before the
+    // enclosing one has ended is included by it
+    std::stable_sort(sources.begin(), sources.end(), [](const Event& a, const Event& b) {
+        return a.ts < b.ts || (a.ts == b.ts && a.dur > b.dur);
+    });
+    std::vector<double> open_ends;
+    for (auto& source : sources) {
+        while (!open_ends.empty() && source.ts >= open_ends.back()) {
+            open_ends.pop_back();
+        }
+        Inclusion inclusion;
+        inclusion.header = std::move(source.detail);
+        inclusion.depth = static_cast<unsigned>(open_ends.size()) + 1;
+        inclusion.offset = source.ts;
+        inclusion.seconds = source.dur;
+        unit.includes.push_back(std::move(inclusion));
+        open_ends.push_back(source.ts + source.dur);
+    }
+}
+
+std::vector<HeaderCost> rank_headers(const std::vector<UnitAnalysis>& units) {
+    std::unordered_map<std::string, HeaderCost> costs;
+    for (const auto& unit : units) {
+        std::unordered_set<std::string> seen;
+        for (const auto& inclusion : unit.includes) {
+            HeaderCost& cost = costs[inclusion.header];
+            cost.header = inclusion.header;
+            cost.seconds += inclusion.seconds;
+            ++cost.inclusions;
+            if (seen.insert(inclusion.header).second) {
+                ++cost.units;
+            }
+        }
+    }
+    std::vector<HeaderCost> ranked;
+    ranked.reserve(costs.size());
+    for (auto& [header, cost] : costs) {
+        ranked.push_back(std::move(cost));
+    }
+    std::sort(ranked.begin(), ranked.end(), [](const HeaderCost& a, const HeaderCost& b) {
+        return a.seconds > b.seconds || (a.seconds == b.seconds && a.header < b.header);
+    });
+    return ranked;
+}
+
+std::string chrome_trace(const std::vector<UnitAnalysis>& units) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(0);
+    const char* separator = "\n";
+    auto event = [&](std::string_view name, std::string_view category, unsigned tid, double start,
+                     double seconds, const std::string& args) {
+        out << separator << "{\"name\":\"" << json_escape(name) << "\",\"cat\":\"" << category
+            << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << start * 1e6
+            << ",\"dur\":" << seconds * 1e6;
+        if (!args.empty()) {
+            out << ",\"args\":{" << args << '}';
+        }
+        out << '}';
+        separator = ",\n";
+    };
+
+    out << "{\"traceEvents\":[";
+    unsigned workers = 0;
+    for (const auto& unit : units) {
+        workers = std::max(workers, unit.worker);
+        event(unit.source.string(), "compile", unit.worker, unit.start, unit.seconds,
+              "\"max_rss_kb\":" + std::to_string(unit.max_rss_kb));
+        if (unit.frontend_seconds > 0.0) {
+            event("Frontend", "phase", unit.worker, unit.start, unit.frontend_seconds, "");
+        }
+        if (unit.backend_seconds > 0.0) {
+            event("Backend", "phase", unit.worker, unit.start + unit.frontend_seconds, unit.backend_seconds, "");
+        }
+        for (const auto& inclusion : unit.includes) {
+            if (inclusion.seconds >= TRACE_MIN_SECONDS) {
+                event(inclusion.header, "include", unit.worker, unit.start + inclusion.offset,
+                      inclusion.seconds, "");
+            }
+        }
+    }
+    for (unsigned worker = 1; worker <= workers; ++worker) {
+        out << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << worker
+            << ",\"args\":{\"name\":\"job " << worker << "\"}}";
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return out.str();
+}
+
+BuildRecord summarize_build(const BuildAnalysis& analysis, const std::string& configuration, double wall_seconds) {
+    BuildRecord record;
+    record.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    record.configuration = configuration;
+    record.units = analysis.units.size();
+    record.wall_seconds = wall_seconds;
+    for (const auto& unit : analysis.units) {
+        record.cpu_seconds += unit.seconds;
+        record.peak_rss_kb = std::max(record.peak_rss_kb, unit.max_rss_kb);
+    }
+    const auto headers = rank_headers(analysis.units);
+    record.top_header = headers.empty() ? "-" : headers.front().header;
+    return record;
+}
+
+std::string current_commit() {
+    const process::Result head = process::run({"git", "rev-parse", "--short", "HEAD"});
+    if (head.exit_code != 0) {
+        return "-";
+    }
+    std::string commit = head.output.substr(0, head.output.find('\n'));
+    if (process::run({"git", "diff", "--quiet", "HEAD", "--"}).exit_code != 0) {
+        commit += '+';
+    }
+    return commit;
+}
+
+fs::path build_history_path() {
+    return fs::path(".buildstats") / "history.tsv";
+}
+
+std::vector<BuildRecord> load_build_history(const fs::path& path) {
+    std::vector<BuildRecord> records;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        BuildRecord record;
+        std::string timestamp, units, wall, cpu, rss;
+        if (!std::getline(fields, timestamp, '\t') || !std::getline(fields, record.commit, '\t') ||
+            !std::getline(fields, record.configuration, '\t') || !std::getline(fields, units, '\t') ||
+            !std::getline(fields, wall, '\t') || !std::getline(fields, cpu, '\t') ||
+            !std::getline(fields, rss, '\t') || !std::getline(fields, record.top_header)) {
+            continue;
+        }
+        try {
+            record.timestamp = std::stoll(timestamp);
+            record.units = std::stoul(units);
+            record.wall_seconds = std::stod(wall);
+            record.cpu_seconds = std::stod(cpu);
+            record.peak_rss_kb = std::stol(rss);
+        } catch (const std::exception&) {
+            continue;   // Damaged line
+        }
+        records.push_back(std::move(record));
+    }
+    return records;
+}
+
+void append_build_history(const fs::path& path, const BuildRecord& record) {
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        fs::create_directories(path.parent_path(), ec);
+    }
+    const bool fresh = !fs::exists(path, ec);
+    std::ofstream file(path, std::ios::app);
+    if (!file) {
+        throw std::runtime_error("Cannot write " + path.string());
+    }
+    if (fresh) {
+        file << HISTORY_HEADER << '\n';
+    }
+    file << record.timestamp << '\t' << record.commit << '\t' << record.configuration << '\t' << record.units
+         << '\t' << std::fixed << std::setprecision(3) << record.wall_seconds << '\t' << record.cpu_seconds
+         << '\t' << record.peak_rss_kb << '\t' << record.top_header << '\n';
+}
+
+} // namespace build
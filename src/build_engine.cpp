@@ -0,0 +1,660 @@
+#include "build/build_engine.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "build/build_analysis.hpp"
+#include "build/compile_cache.hpp"
+#include "build/depfile.hpp"
+#include "build/gtest_cache.hpp"
+#include "utils/colors.hpp"
+#include "utils/process.hpp"
+
+namespace build {
+
+namespace {
+
+using file_time = fs::file_time_type;
+
+// Memoises mtimes for the duration of one build so that headers shared by
+// many translation units are stat()ed only once.
+class MtimeCache {
+public:
+    // Returns false when the file does not exist
+    bool get(const fs::path& path, file_time& out) {
+        auto it = times_.find(path.native());
+        if (it == times_.end()) {
+            std::error_code ec;
+            file_time time = fs::last_write_time(path, ec);
+            it = times_.emplace(path.native(), ec ? file_time::min() : time).first;
+        }
+        out = it->second;
+        return out != file_time::min();
+    }
+
+private:
+    std::unordered_map<std::string, file_time> times_;
+};
+
+bool uses_gtest(const std::vector<fs::path>& sources) {
+    for (const auto& source : sources) {
+        std::ifstream file(source);
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.find("#include") != std::string::npos &&
+                line.find("gtest/gtest.h") != std::string::npos) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// The project's link into the per-user gtest cache, created on first use
+// when the cache already holds archives for this compiler and these flags.
+// Empty when there is none and the system's libgtest has to do.
+fs::path project_gtest(const std::string& compiler, const std::vector<std::string>& flags) {
+    const fs::path link = "build/gtest";
+    if (fs::is_regular_file(link / "lib" / "libgtest.a")) {
+        return link;
+    }
+    try {
+        if (auto entry = GtestCache().find(compiler, flags)) {
+            link_gtest(entry->prefix, link);
+            return link;
+        }
+    } catch (const std::exception&) {
+        // Unusable cache or link location: fall back to the system library
+    }
+    return {};
+}
+
+} // namespace
+
+std::vector<fs::path> scan_sources(const fs::path& dir) {
+    std::vector<fs::path> sources;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(dir, ec)) {
+        if (entry.is_regular_file(ec) && entry.path().extension() == ".cpp") {
+            sources.push_back(entry.path());
+        }
+    }
+    std::sort(sources.begin(), sources.end());
+    return sources;
+}
+
+std::vector<std::string> detect_common_headers(const std::vector<fs::path>& sources, size_t max_headers) {
+    std::unordered_map<std::string, size_t> counts;
+    for (const auto& source : sources) {
+        std::ifstream file(source);
+        std::string line;
+        std::vector<std::string> seen;
+        while (std::getline(file, line)) {
+            size_t pos = line.find_first_not_of(" \t");
+            if (pos == std::string::npos || line[pos] != '#') {
+                continue;
+            }
+            pos = line.find_first_not_of(" \t", pos + 1);
+            if (pos == std::string::npos || line.compare(pos, 7, "include") != 0) {
+                continue;
+            }
+            const size_t open = line.find('<', pos + 7);
+            const size_t close = line.find('>', open);
+            if (open == std::string::npos || close == std::string::npos) {
+                continue;
+            }
+            std::string header = line.substr(open, close - open + 1);
+            if (std::find(seen.begin(), seen.end(), header) == seen.end()) {
+                seen.push_back(header);
+                ++counts[header];
+            }
+        }
+    }
+
+    std::vector<std::pair<std::string, size_t>> ranked(counts.begin(), counts.end());
+    std::sort(ranked.begin(), ranked.end(), [](const auto& a, const auto& b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+
+    std::vector<std::string> headers;
+    for (const auto& [header, count] : ranked) {
+        if (headers.size() >= max_headers || count * 4 < sources.size()) {
+            break;
+        }
+        headers.push_back(header);
+    }
+    return headers;
+}
+
+BuildConfig make_config(Configuration configuration) {
+    const std::string project_name = fs::current_path().filename().string();
+
+    BuildConfig config;
+    if (const char* cxx = std::getenv("CXX"); cxx && *cxx) {
+        config.compiler = cxx;
+    }
+
+    const std::vector<std::string> debug_flags = {
+        "-std=c++17", "-Wall", "-Wextra", "-Wpedantic", "-Iinclude", "-g", "-DDEBUG"
+    };
+    const std::vector<std::string> release_flags = {
+        "-std=c++17", "-Wall", "-Wextra", "-Iinclude", "-O2", "-DNDEBUG"
+    };
+
+    switch (configuration) {
+    case Configuration::Debug:
+        config.name = "debug";
+        config.compile_flags = debug_flags;
+        config.sources = scan_sources("src");
+        config.binary = fs::path("build/debug/bin") / project_name;
+        break;
+    case Configuration::Release:
+        config.name = "release";
+        config.compile_flags = release_flags;
+        config.sources = scan_sources("src");
+        config.binary = fs::path("build/release/bin") / project_name;
+        break;
+    case Configuration::Test: {
+        config.name = "test";
+        config.compile_flags = debug_flags;
+        config.compile_flags.push_back("-Itests");
+        for (const auto& source : scan_sources("src")) {
+            if (source.filename() != "main.cpp") {   // Same filter as TEST_MAIN_SRC
+                config.sources.push_back(source);
+            }
+        }
+        auto tests = scan_sources("tests");
+        if (uses_gtest(tests)) {
+            config.gtest = true;
+            config.compile_flags.push_back("-pthread");
+            const fs::path gtest = project_gtest(config.compiler, config.compile_flags);
+            if (gtest.empty()) {
+                config.libs = {"-lgtest", "-lgtest_main", "-pthread"};
+            } else {
+                config.compile_flags.insert(config.compile_flags.end(), {"-isystem", (gtest / "include").string()});
+                config.libs = {(gtest / "lib" / "libgtest.a").string(), (gtest / "lib" / "libgtest_main.a").string(),
+                               "-pthread"};
+            }
+        }
+        config.sources.insert(config.sources.end(), tests.begin(), tests.end());
+        config.binary = "build/test/bin/test_runner";
+        break;
+    }
+    case Configuration::Bench:
+        config.name = "bench";
+        config.compile_flags = release_flags;
+        config.compile_flags.push_back("-Ibench");
+        for (const auto& source : scan_sources("src")) {
+            if (source.filename() != "main.cpp") {   // bench/bench_main.cpp provides main()
+                config.sources.push_back(source);
+            }
+        }
+        for (const auto& source : scan_sources("bench")) {
+            config.sources.push_back(source);
+        }
+        config.binary = "build/bench/bin/bench_runner";
+        break;
+    }
+
+    config.obj_dir = fs::path("build") / config.name / "obj";
+    return config;
+}
+
+BuildEngine::BuildEngine(BuildConfig config) : config_(std::move(config)) {
+    units_.reserve(config_.sources.size());
+    for (const auto& source : config_.sources) {
+        TranslationUnit unit;
+        unit.source = source;
+        unit.object = object_path_for(source);
+        unit.depfile = fs::path(unit.object).replace_extension(".d");
+        unit.in_library = std::find(config_.library_sources.begin(), config_.library_sources.end(), source) !=
+                          config_.library_sources.end();
+        units_.push_back(std::move(unit));
+    }
+}
+
+fs::path BuildEngine::object_path_for(const fs::path& source) const {
+    // src/foo.cpp -> <obj_dir>/foo.o, tests/foo.cpp -> <obj_dir>/tests/foo.o,
+    // bench/foo.cpp -> <obj_dir>/bench/foo.o,
+    // build/<name>/unity/unity_1.cpp -> <obj_dir>/unity/unity_1.o
+    fs::path generated = source.lexically_relative(config_.obj_dir.parent_path());
+    if (!generated.empty() && *generated.begin() != "..") {
+        return (config_.obj_dir / generated).replace_extension(".o");
+    }
+
+    fs::path relative = source.lexically_relative(".");
+    auto it = relative.begin();
+    if (it != relative.end() && *it == "src") {
+        relative = relative.lexically_relative("src");
+    }
+    return (config_.obj_dir / relative).replace_extension(".o");
+}
+
+std::vector<std::string> BuildEngine::effective_flags() const {
+    std::vector<std::string> flags = config_.compile_flags;
+    flags.insert(flags.end(), pch_flags_.begin(), pch_flags_.end());
+    return flags;
+}
+
+std::vector<std::string> BuildEngine::compile_command(const TranslationUnit& unit) const {
+    std::vector<std::string> command = {config_.compiler};
+    auto flags = effective_flags();
+    command.insert(command.end(), flags.begin(), flags.end());
+    command.insert(command.end(), {
+        "-MMD", "-MP", "-MF", unit.depfile.string(),
+        "-c", unit.source.string(), "-o", unit.object.string()
+    });
+    return command;
+}
+
+std::vector<std::string> BuildEngine::link_command() const {
+    std::vector<std::string> command = {config_.compiler};
+    command.insert(command.end(), config_.compile_flags.begin(), config_.compile_flags.end());
+    command.insert(command.end(), config_.link_flags.begin(), config_.link_flags.end());
+    command.insert(command.end(), {"-o", config_.binary.string()});
+    for (const auto& unit : units_) {
+        if (!unit.in_library) {
+            command.push_back(unit.object.string());
+        }
+    }
+    if (!config_.shared_library.empty()) {
+        // Found next to the binary at run time: build/<name>/bin -> build/<name>/lib
+        const fs::path lib_dir = config_.shared_library.parent_path();
+        command.push_back(config_.shared_library.string());
+        command.push_back("-Wl,-rpath,$ORIGIN/" +
+                          lib_dir.lexically_relative(config_.binary.parent_path()).string());
+    }
+    command.insert(command.end(), config_.libs.begin(), config_.libs.end());
+    return command;
+}
+
+std::vector<std::string> BuildEngine::library_link_command() const {
+    if (config_.shared_library.empty()) {
+        return {};
+    }
+    std::vector<std::string> command = {config_.compiler};
+    command.insert(command.end(), config_.compile_flags.begin(), config_.compile_flags.end());
+    command.insert(command.end(), config_.link_flags.begin(), config_.link_flags.end());
+    command.insert(command.end(), {"-shared", "-o", config_.shared_library.string()});
+    for (const auto& unit : units_) {
+        if (unit.in_library) {
+            command.push_back(unit.object.string());
+        }
+    }
+    command.insert(command.end(), config_.libs.begin(), config_.libs.end());
+    return command;
+}
+
+std::string BuildEngine::signature() const {
+    std::ostringstream sig;
+    sig << "compiler " << config_.compiler << '\n';
+    sig << "compile";
+    for (const auto& flag : config_.compile_flags) sig << ' ' << flag;
+    sig << "\nlink";
+    for (const auto& flag : config_.link_flags) sig << ' ' << flag;
+    sig << "\nlibs";
+    for (const auto& lib : config_.libs) sig << ' ' << lib;
+    sig << "\npch " << (config_.precompiled_header ? "on" : "off") << '\n';
+    if (!config_.shared_library.empty()) {
+        sig << "shared " << config_.shared_library.string() << '\n';
+    }
+    return sig.str();
+}
+
+bool BuildEngine::signature_changed() const {
+    std::ifstream file(config_.obj_dir.parent_path() / "flags.sig");
+    if (!file) {
+        return true;
+    }
+    std::ostringstream stored;
+    stored << file.rdbuf();
+    return stored.str() != signature();
+}
+
+void BuildEngine::write_signature() const {
+    std::ofstream file(config_.obj_dir.parent_path() / "flags.sig", std::ios::trunc);
+    file << signature();
+}
+
+bool BuildEngine::update_precompiled_header(const BuildOptions& options, bool flags_changed, bool& rebuilt) {
+    rebuilt = false;
+    pch_flags_.clear();
+
+    // Only translation units this configuration compiles vote on the header list
+    const auto headers = detect_common_headers(
+        config_.original_sources.empty() ? config_.sources : config_.original_sources);
+    if (headers.empty()) {
+        return true;
+    }
+
+    const fs::path dir = config_.obj_dir.parent_path() / "pch";
+    const fs::path header = dir / "pch.hpp";
+    const fs::path gch = dir / "pch.hpp.gch";
+    const fs::path depfile = dir / "pch.hpp.d";
+
+    // The flags are recorded in the header itself so that changing them invalidates the .gch
+    std::ostringstream content;
+    content << "// Generated by cppstarter: most frequently included headers\n// flags:";
+    for (const auto& flag : config_.compile_flags) {
+        content << ' ' << flag;
+    }
+    content << '\n';
+    for (const auto& include : headers) {
+        content << "#include " << include << '\n';
+    }
+
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    bool stale = flags_changed;
+    {
+        std::ifstream existing(header);
+        std::ostringstream current;
+        current << existing.rdbuf();
+        if (!existing || current.str() != content.str()) {
+            std::ofstream(header, std::ios::trunc) << content.str();
+            stale = true;
+        }
+    }
+
+    if (!stale) {
+        const file_time gch_time = fs::last_write_time(gch, ec);
+        const auto inputs = read_depfile(depfile);
+        stale = ec || inputs.empty();
+        for (const auto& input : inputs) {
+            if (stale) {
+                break;
+            }
+            const file_time input_time = fs::last_write_time(input, ec);
+            stale = ec || input_time > gch_time;
+        }
+    }
+
+    if (stale) {
+        std::vector<std::string> command = {config_.compiler};
+        command.insert(command.end(), config_.compile_flags.begin(), config_.compile_flags.end());
+        command.insert(command.end(), {
+            "-x", "c++-header", "-MMD", "-MP", "-MF", depfile.string(),
+            header.string(), "-o", gch.string()
+        });
+
+        std::cout << colors::CYAN << "Precompiling " << header.string() << " (" << headers.size()
+                  << " headers)" << colors::RESET << '\n';
+        if (options.verbose) {
+            std::cout << process::join_command(command) << '\n';
+        }
+        process::Result compile = process::run(command);
+        if (!compile.output.empty()) {
+            std::cout << compile.output;
+        }
+        if (compile.exit_code != 0) {
+            fs::remove(gch, ec);
+            std::cout << colors::RED << "Error: Failed to precompile " << header.string()
+                      << colors::RESET << '\n';
+            return false;
+        }
+        rebuilt = true;
+    }
+
+    pch_flags_ = {"-include", header.string(), "-Winvalid-pch"};
+    return true;
+}
+
+BuildResult BuildEngine::build(const BuildOptions& options) {
+    const auto start = std::chrono::steady_clock::now();
+    BuildResult result;
+
+    if (units_.empty()) {
+        throw std::runtime_error("No sources found for the " + config_.name + " configuration");
+    }
+
+    // === Decide what is out of date ===
+    const bool flags_changed = signature_changed();
+    bool pch_rebuilt = false;
+    if (config_.precompiled_header) {
+        if (!update_precompiled_header(options, flags_changed, pch_rebuilt)) {
+            result.success = false;
+            return result;
+        }
+    }
+
+    MtimeCache mtimes;
+    std::vector<TranslationUnit*> dirty;
+
+    for (auto& unit : units_) {
+        file_time object_time;
+        bool stale = flags_changed || pch_rebuilt || options.analysis || !mtimes.get(unit.object, object_time);
+
+        if (!stale && !unit.inputs_known) {
+            auto prerequisites = read_depfile(unit.depfile);
+            if (prerequisites.empty()) {
+                stale = true;
+            } else {
+                unit.inputs.assign(prerequisites.begin(), prerequisites.end());
+                unit.inputs_known = true;
+            }
+        }
+
+        if (!stale) {
+            for (const auto& input : config_.extra_inputs) {
+                file_time input_time;
+                if (mtimes.get(input, input_time) && input_time > object_time) {
+                    stale = true;
+                    break;
+                }
+            }
+        }
+
+        if (!stale) {
+            for (const auto& input : unit.inputs) {
+                file_time input_time;
+                if (!mtimes.get(input, input_time) || input_time > object_time) {
+                    stale = true;
+                    break;
+                }
+            }
+        }
+
+        if (stale) {
+            dirty.push_back(&unit);
+        } else {
+            ++result.up_to_date;
+        }
+    }
+
+    // === Compile out-of-date translation units in parallel ===
+    if (!dirty.empty()) {
+        std::mutex output_mutex;
+        std::atomic<bool> failed{false};
+        std::atomic<size_t> finished{0};
+        std::atomic<size_t> cache_hits{0};
+        const size_t total = dirty.size();
+        // Job slots for the analysis trace, one per pool thread
+        std::unordered_map<std::thread::id, unsigned> workers;
+        const std::vector<std::string> extra_flags =
+            options.analysis ? analysis_flags(options.analysis->clang) : std::vector<std::string>{};
+
+        utils::ThreadPool pool(std::min<unsigned>(options.jobs, static_cast<unsigned>(total)));
+        for (TranslationUnit* unit : dirty) {
+            pool.submit([&, unit]() {
+                if (failed) {
+                    return;
+                }
+
+                std::error_code ec;
+                fs::create_directories(unit->object.parent_path(), ec);
+                // Never let the compiler write through an object hardlinked from the cache
+                fs::remove(unit->object, ec);
+                fs::remove(fs::path(unit->object).replace_extension(".dwo"), ec);
+
+                CompileCache::Lookup cached;
+                if (options.cache && !options.analysis) {
+                    cached = options.cache->lookup(config_.compiler, effective_flags(),
+                                                   unit->source, unit->object, unit->depfile);
+                }
+
+                auto command = compile_command(*unit);
+                command.insert(command.begin() + 1, extra_flags.begin(), extra_flags.end());
+                process::Result compile;
+                UnitAnalysis analysed;
+                if (cached.hit) {
+                    compile.exit_code = 0;
+                    compile.output = cached.output;
+                    ++cache_hits;
+                } else {
+                    analysed.start = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    compile = process::run(command);
+                    if (options.cache && !options.analysis && compile.exit_code == 0) {
+                        options.cache->store(cached.key, unit->object, compile.output);
+                    }
+                }
+                if (options.analysis) {
+                    analysed.source = unit->source;
+                    analysed.seconds = compile.wall_seconds;
+                    analysed.max_rss_kb = compile.max_rss_kb;
+                    if (options.analysis->clang) {
+                        const fs::path trace = fs::path(unit->object).replace_extension(".json");
+                        std::ifstream file(trace);
+                        std::ostringstream json;
+                        json << file.rdbuf();
+                        parse_clang_time_trace(json.str(), analysed);
+                        fs::remove(trace, ec);
+                    } else {
+                        compile.output = parse_gcc_analysis(compile.output, analysed);
+                    }
+                }
+                size_t index = ++finished;
+
+                std::lock_guard<std::mutex> lock(output_mutex);
+                if (options.analysis && compile.exit_code == 0) {
+                    auto slot = workers.emplace(std::this_thread::get_id(), workers.size() + 1).first;
+                    analysed.worker = slot->second;
+                    options.analysis->units.push_back(std::move(analysed));
+                }
+                std::cout << colors::CYAN << '[' << index << '/' << total << "] "
+                          << (cached.hit ? "Cached    " : "Compiling ") << unit->source.string()
+                          << colors::RESET << '\n';
+                if (options.verbose && !cached.hit) {
+                    std::cout << process::join_command(command) << '\n';
+                }
+                if (!compile.output.empty()) {
+                    std::cout << compile.output;
+                }
+
+                if (compile.exit_code != 0) {
+                    fs::remove(unit->object, ec);
+                    unit->inputs_known = false;
+                    failed = true;
+                    std::cout << colors::RED << "Error: Failed to compile " << unit->source.string()
+                              << colors::RESET << '\n';
+                    return;
+                }
+                auto prerequisites = read_depfile(unit->depfile);
+                unit->inputs.assign(prerequisites.begin(), prerequisites.end());
+                unit->inputs_known = !unit->inputs.empty();
+            });
+        }
+        pool.wait();
+
+        result.compiled = finished;
+        result.cache_hits = cache_hits;
+        if (failed) {
+            result.success = false;
+            result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            return result;
+        }
+    }
+
+    // === Link ===
+    // With a shared library, each output only depends on its own objects:
+    // the binary resolves the library's symbols when it is loaded, so a
+    // change to library code relinks the library alone.
+    auto needs_link = [&](const fs::path& output, bool library) {
+        file_time output_time;
+        if (flags_changed || !mtimes.get(output, output_time)) {
+            return true;
+        }
+        for (const TranslationUnit* unit : dirty) {
+            if (unit->in_library == library) {
+                return true;
+            }
+        }
+        for (const auto& unit : units_) {
+            file_time object_time;
+            if (unit.in_library == library && mtimes.get(unit.object, object_time) && object_time > output_time) {
+                return true;
+            }
+        }
+        return false;
+    };
+    auto link = [&](const fs::path& output, const std::vector<std::string>& command) {
+        std::error_code ec;
+        fs::create_directories(output.parent_path(), ec);
+        std::cout << colors::CYAN << "Linking " << output.string() << colors::RESET << '\n';
+        if (options.verbose) {
+            std::cout << process::join_command(command) << '\n';
+        }
+        process::Result linked = process::run(command);
+        result.link_seconds += linked.wall_seconds;
+        if (!linked.output.empty()) {
+            std::cout << linked.output;
+        }
+        if (linked.exit_code != 0) {
+            std::cout << colors::RED << "Error: Failed to link " << output.string() << colors::RESET << '\n';
+            result.success = false;
+            return false;
+        }
+        result.linked = true;
+        return true;
+    };
+
+    const bool shared = !config_.shared_library.empty();
+    if (shared && needs_link(config_.shared_library, true)) {
+        link(config_.shared_library, library_link_command());
+    }
+    if (result.success && needs_link(config_.binary, false)) {
+        link(config_.binary, link_command());
+    }
+
+    if (result.success && flags_changed) {
+        write_signature();
+    }
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+std::vector<fs::path> BuildEngine::objects() const {
+    std::vector<fs::path> objects;
+    for (const auto& unit : units_) {
+        objects.push_back(unit.object);
+    }
+    return objects;
+}
+
+std::vector<fs::path> BuildEngine::dependents_of(const fs::path& file) const {
+    const fs::path target = file.lexically_normal();
+    std::vector<fs::path> dependents;
+    for (const auto& unit : units_) {
+        if (unit.source.lexically_normal() == target) {
+            dependents.push_back(unit.source);
+            continue;
+        }
+        for (const auto& input : unit.inputs) {
+            if (input.lexically_normal() == target) {
+                dependents.push_back(unit.source);
+                break;
+            }
+        }
+    }
+    return dependents;
+}
+
+} // namespace build
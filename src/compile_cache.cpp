@@ -0,0 +1,453 @@
+#include "build/compile_cache.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <sys/file.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "utils/hash.hpp"
+#include "utils/process.hpp"
+
+namespace build {
+
+namespace {
+
+constexpr uint64_t DEFAULT_MAX_SIZE = 5ull * 1024 * 1024 * 1024;
+constexpr std::string_view KEY_VERSION = "cppstarter-cache-v1";
+
+bool env_equals(const char* name, std::string_view value) {
+    const char* current = std::getenv(name);
+    return current && value == current;
+}
+
+std::string read_file(const fs::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+// Holds an exclusive flock() on <cache>/stats.lock for its lifetime
+class StatsLock {
+public:
+    explicit StatsLock(const fs::path& root) {
+        std::error_code ec;
+        fs::create_directories(root, ec);
+        fd_ = ::open((root / "stats.lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd_ >= 0) {
+            ::flock(fd_, LOCK_EX);
+        }
+    }
+    ~StatsLock() {
+        if (fd_ >= 0) {
+            ::flock(fd_, LOCK_UN);
+            ::close(fd_);
+        }
+    }
+    StatsLock(const StatsLock&) = delete;
+    StatsLock& operator=(const StatsLock&) = delete;
+
+private:
+    int fd_ = -1;
+};
+
+} // namespace
+
+fs::path default_cache_dir() {
+    if (const char* dir = std::getenv("CPPSTARTER_CACHE_DIR"); dir && *dir) {
+        return dir;
+    }
+    if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg) {
+        return fs::path(xdg) / "cppstarter";
+    }
+    if (const char* home = std::getenv("HOME"); home && *home) {
+        return fs::path(home) / ".cache" / "cppstarter";
+    }
+    return fs::temp_directory_path() / "cppstarter-cache";
+}
+
+uint64_t parse_size(std::string_view text) {
+    size_t consumed = 0;
+    double value = 0.0;
+    try {
+        value = std::stod(std::string(text), &consumed);
+    } catch (const std::exception&) {
+        throw std::invalid_argument("Invalid size '" + std::string(text) + "'");
+    }
+
+    std::string_view suffix = text.substr(consumed);
+    double multiplier = 1.0;
+    if (suffix.empty() || suffix == "B") {
+        multiplier = 1.0;
+    } else if (suffix == "K" || suffix == "KB" || suffix == "KiB") {
+        multiplier = 1024.0;
+    } else if (suffix == "M" || suffix == "MB" || suffix == "MiB") {
+        multiplier = 1024.0 * 1024.0;
+    } else if (suffix == "G" || suffix == "GB" || suffix == "GiB") {
+        multiplier = 1024.0 * 1024.0 * 1024.0;
+    } else {
+        throw std::invalid_argument("Invalid size suffix '" + std::string(suffix) + "'");
+    }
+    if (value < 0) {
+        throw std::invalid_argument("Size cannot be negative");
+    }
+    return static_cast<uint64_t>(value * multiplier);
+}
+
+std::string format_size(uint64_t bytes) {
+    const char* units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+    double value = static_cast<double>(bytes);
+    int unit = 0;
+    while (value >= 1024.0 && unit < 4) {
+        value /= 1024.0;
+        ++unit;
+    }
+    std::ostringstream out;
+    out.precision(unit == 0 ? 0 : 1);
+    out << std::fixed << value << ' ' << units[unit];
+    return out.str();
+}
+
+std::vector<std::string> key_flags(const std::vector<std::string>& compile_flags) {
+    // Options followed by a separate argument that only affect preprocessing
+    static const std::vector<std::string_view> with_argument = {
+        "-I", "-D", "-U", "-MF", "-MT", "-MQ", "-include", "-isystem", "-iquote", "-idirafter"
+    };
+    // -pthread only defines _REENTRANT at compile time
+    static const std::vector<std::string_view> standalone = {"-MMD", "-MD", "-MP", "-M", "-MM", "-pthread"};
+
+    std::vector<std::string> kept;
+    for (size_t i = 0; i < compile_flags.size(); ++i) {
+        std::string_view flag = compile_flags[i];
+        if (std::find(standalone.begin(), standalone.end(), flag) != standalone.end()) {
+            continue;
+        }
+        bool skip = false;
+        for (std::string_view option : with_argument) {
+            if (flag == option) {
+                ++i;           // skip the separate argument too
+                skip = true;
+                break;
+            }
+            if (flag.substr(0, option.size()) == option && option.size() == 2) {
+                skip = true;   // joined form: -Iinclude, -DDEBUG
+                break;
+            }
+        }
+        if (!skip) {
+            kept.emplace_back(flag);
+        }
+    }
+    return kept;
+}
+
+CompileCache::CompileCache(fs::path root)
+    : root_(std::move(root)),
+      hardlink_(env_equals("CPPSTARTER_CACHE_HARDLINK", "1")),
+      hash_dir_(!env_equals("CPPSTARTER_CACHE_HASHDIR", "0")) {}
+
+fs::path CompileCache::entry_path(const std::string& key, std::string_view extension) const {
+    return root_ / "objects" / key.substr(0, 2) / (key.substr(2) + std::string(extension));
+}
+
+std::string CompileCache::compiler_identity(const std::string& compiler) {
+    std::lock_guard<std::mutex> lock(identity_mutex_);
+    auto it = identities_.find(compiler);
+    if (it == identities_.end()) {
+        process::Result version = process::run({compiler, "--version"});
+        it = identities_.emplace(compiler, compiler + '\n' + version.output).first;
+    }
+    return it->second;
+}
+
+CompileCache::Lookup CompileCache::lookup(const std::string& compiler,
+                                          const std::vector<std::string>& compile_flags,
+                                          const fs::path& source, const fs::path& object,
+                                          const fs::path& depfile) {
+    Lookup result;
+
+    // Profile-guided objects also depend on .gcda files that never show up in
+    // the preprocessed source, so they cannot be keyed safely
+    for (const auto& flag : compile_flags) {
+        if (flag.rfind("-fprofile-use", 0) == 0 || flag.rfind("-fauto-profile", 0) == 0) {
+            return result;
+        }
+    }
+
+    // Preprocess once: produces the key material and the depfile the engine needs
+    const fs::path preprocessed = fs::path(object).replace_extension(".ii");
+    std::vector<std::string> command = {compiler};
+    command.insert(command.end(), compile_flags.begin(), compile_flags.end());
+    command.insert(command.end(), {
+        "-E", "-MMD", "-MP", "-MF", depfile.string(), "-MT", object.string(),
+        source.string(), "-o", preprocessed.string()
+    });
+    process::Result preprocess = process::run(command);
+
+    std::error_code ec;
+    if (preprocess.exit_code != 0) {
+        fs::remove(preprocessed, ec);
+        return result;  // Let the real compile report the error
+    }
+
+    hash::Sha256 sha;
+    sha.update(KEY_VERSION);
+    sha.update("\n");
+    sha.update(compiler_identity(compiler));
+    bool has_debug_info = false;
+    bool split_dwarf = false;
+    for (const auto& flag : key_flags(compile_flags)) {
+        sha.update(flag);
+        sha.update("\0", 1);
+        has_debug_info = has_debug_info || flag.rfind("-g", 0) == 0;
+        split_dwarf = split_dwarf || flag == "-gsplit-dwarf";
+    }
+    if (has_debug_info && hash_dir_) {
+        // Debug info embeds the compilation directory
+        sha.update(fs::current_path().string());
+    }
+    if (split_dwarf) {
+        // The skeleton in the object names its .dwo by path
+        sha.update(object.string());
+    }
+    {
+        std::ifstream file(preprocessed, std::ios::binary);
+        char buffer[64 * 1024];
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+            sha.update(buffer, static_cast<size_t>(file.gcount()));
+        }
+    }
+    fs::remove(preprocessed, ec);
+    result.key = sha.hex_digest();
+
+    const fs::path entry = entry_path(result.key, ".o");
+    const fs::path dwo_entry = entry_path(result.key, ".dwo");
+    if (!fs::exists(entry, ec) || (split_dwarf && !fs::exists(dwo_entry, ec))) {
+        ++pending_misses_;
+        return result;
+    }
+
+    fs::remove(object, ec);
+    bool materialised = false;
+    if (hardlink_) {
+        fs::create_hard_link(entry, object, ec);
+        materialised = !ec;
+    }
+    if (!materialised) {
+        materialised = fs::copy_file(entry, object, fs::copy_options::overwrite_existing, ec);
+    }
+    if (materialised && split_dwarf) {
+        const fs::path dwo = fs::path(object).replace_extension(".dwo");
+        materialised = fs::copy_file(dwo_entry, dwo, fs::copy_options::overwrite_existing, ec);
+    }
+    if (!materialised) {
+        ++pending_misses_;
+        return result;
+    }
+
+    // Refresh the entry for LRU eviction; the object must also look newer than its inputs
+    fs::last_write_time(entry, fs::file_time_type::clock::now(), ec);
+    if (!hardlink_) {
+        fs::last_write_time(object, fs::file_time_type::clock::now(), ec);
+    }
+
+    const fs::path diagnostics = entry_path(result.key, ".stderr");
+    if (fs::exists(diagnostics, ec)) {
+        result.output = read_file(diagnostics);
+    }
+    result.hit = true;
+    ++pending_hits_;
+    return result;
+}
+
+void CompileCache::store(const std::string& key, const fs::path& object, const std::string& output) {
+    if (key.empty()) {
+        return;
+    }
+
+    const fs::path entry = entry_path(key, ".o");
+    std::error_code ec;
+    fs::create_directories(entry.parent_path(), ec);
+
+    // Write to a private temporary and rename so concurrent builds never see partial objects
+    std::ostringstream suffix;
+    suffix << ".tmp." << ::getpid() << '.' << std::hash<std::thread::id>{}(std::this_thread::get_id());
+    const fs::path temporary = entry.string() + suffix.str();
+
+    if (!fs::copy_file(object, temporary, fs::copy_options::overwrite_existing, ec)) {
+        return;
+    }
+    // A -gsplit-dwarf .dwo is stored first, so an entry's .o implies its .dwo
+    const fs::path dwo = fs::path(object).replace_extension(".dwo");
+    if (fs::exists(dwo, ec)) {
+        const fs::path dwo_temporary = entry_path(key, ".dwo").string() + suffix.str();
+        if (!fs::copy_file(dwo, dwo_temporary, fs::copy_options::overwrite_existing, ec)) {
+            fs::remove(temporary, ec);
+            return;
+        }
+        fs::rename(dwo_temporary, entry_path(key, ".dwo"), ec);
+        pending_bytes_ += fs::file_size(entry_path(key, ".dwo"), ec);
+    }
+    if (!output.empty()) {
+        std::ofstream(entry_path(key, ".stderr"), std::ios::binary) << output;
+    }
+    if (hardlink_) {
+        // Hardlinked objects share the inode; make accidental in-place writes fail loudly
+        fs::permissions(temporary, fs::perms::owner_read | fs::perms::group_read | fs::perms::others_read, ec);
+    }
+    fs::rename(temporary, entry, ec);
+    if (ec) {
+        fs::remove(temporary, ec);
+        return;
+    }
+
+    ++pending_files_;
+    pending_bytes_ += fs::file_size(entry, ec);
+}
+
+CacheStats CompileCache::read_stats() const {
+    CacheStats stats;
+    std::ifstream file(root_ / "stats");
+    std::string name;
+    uint64_t value = 0;
+    while (file >> name >> value) {
+        if (name == "hits") stats.hits = value;
+        else if (name == "misses") stats.misses = value;
+        else if (name == "files") stats.files = value;
+        else if (name == "size_bytes") stats.size_bytes = value;
+    }
+    return stats;
+}
+
+void CompileCache::write_stats(const CacheStats& stats) const {
+    std::error_code ec;
+    fs::create_directories(root_, ec);
+    std::ofstream file(root_ / "stats", std::ios::trunc);
+    file << "hits " << stats.hits << '\n'
+         << "misses " << stats.misses << '\n'
+         << "files " << stats.files << '\n'
+         << "size_bytes " << stats.size_bytes << '\n';
+}
+
+void CompileCache::flush() {
+    bool over_limit = false;
+    {
+        StatsLock lock(root_);
+        CacheStats stats = read_stats();
+        stats.hits += pending_hits_.exchange(0);
+        stats.misses += pending_misses_.exchange(0);
+        stats.files += pending_files_.exchange(0);
+        stats.size_bytes += pending_bytes_.exchange(0);
+        write_stats(stats);
+        over_limit = stats.size_bytes > max_size();
+    }
+    if (over_limit) {
+        cleanup();
+    }
+}
+
+CacheStats CompileCache::stats() const {
+    CacheStats stats = read_stats();
+    stats.hits += pending_hits_;
+    stats.misses += pending_misses_;
+    stats.files += pending_files_;
+    stats.size_bytes += pending_bytes_;
+    return stats;
+}
+
+void CompileCache::zero_stats() {
+    StatsLock lock(root_);
+    CacheStats stats = read_stats();
+    stats.hits = 0;
+    stats.misses = 0;
+    write_stats(stats);
+}
+
+void CompileCache::clear() {
+    StatsLock lock(root_);
+    std::error_code ec;
+    fs::remove_all(root_ / "objects", ec);
+    CacheStats stats = read_stats();
+    stats.files = 0;
+    stats.size_bytes = 0;
+    write_stats(stats);
+}
+
+uint64_t CompileCache::max_size() const {
+    if (const char* env = std::getenv("CPPSTARTER_CACHE_MAXSIZE"); env && *env) {
+        try {
+            return parse_size(env);
+        } catch (const std::invalid_argument&) {
+        }
+    }
+    std::ifstream file(root_ / "max_size");
+    uint64_t bytes = 0;
+    if (file >> bytes && bytes > 0) {
+        return bytes;
+    }
+    return DEFAULT_MAX_SIZE;
+}
+
+void CompileCache::set_max_size(uint64_t bytes) {
+    std::error_code ec;
+    fs::create_directories(root_, ec);
+    std::ofstream(root_ / "max_size", std::ios::trunc) << bytes << '\n';
+}
+
+size_t CompileCache::cleanup() {
+    StatsLock lock(root_);
+
+    struct Entry {
+        fs::file_time_type used;
+        fs::path path;
+        uint64_t size;
+    };
+    std::vector<Entry> entries;
+    uint64_t total = 0;
+
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(root_ / "objects", ec);
+         !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+        if (it->path().extension() != ".o" || !it->is_regular_file(ec)) {
+            continue;
+        }
+        Entry entry{it->last_write_time(ec), it->path(), it->file_size(ec)};
+        std::error_code dwo_ec;
+        const uintmax_t dwo_size = fs::file_size(fs::path(it->path()).replace_extension(".dwo"), dwo_ec);
+        entry.size += dwo_ec ? 0 : dwo_size;
+        total += entry.size;
+        entries.push_back(std::move(entry));
+    }
+
+    const uint64_t limit = max_size();
+    const uint64_t target = limit / 10 * 9;
+    size_t removed = 0;
+    if (total > limit) {
+        std::sort(entries.begin(), entries.end(),
+                  [](const Entry& a, const Entry& b) { return a.used < b.used; });
+        for (const auto& entry : entries) {
+            if (total <= target) {
+                break;
+            }
+            fs::remove(entry.path, ec);
+            fs::remove(fs::path(entry.path).replace_extension(".stderr"), ec);
+            fs::remove(fs::path(entry.path).replace_extension(".dwo"), ec);
+            total -= entry.size;
+            ++removed;
+        }
+    }
+
+    CacheStats stats = read_stats();
+    stats.files = entries.size() - removed;
+    stats.size_bytes = total;
+    write_stats(stats);
+    return removed;
+}
+
+} // namespace build
@@ -0,0 +1,193 @@
+#include "perf/counters.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace perf {
+
+namespace {
+
+std::string format_count(uint64_t value) {
+    std::ostringstream text;
+    if (value >= 10'000'000'000ull) {
+        text << std::fixed << std::setprecision(1) << value / 1e9 << 'G';
+    } else if (value >= 10'000'000ull) {
+        text << std::fixed << std::setprecision(1) << value / 1e6 << 'M';
+    } else if (value >= 10'000ull) {
+        text << std::fixed << std::setprecision(1) << value / 1e3 << 'k';
+    } else {
+        text << value;
+    }
+    return text.str();
+}
+
+#ifdef __linux__
+
+struct EventSpec {
+    uint32_t type;
+    uint64_t config;
+};
+
+// Same order as the CounterSample fields; the first event leads the hardware group
+constexpr EventSpec EVENTS[] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+};
+
+int open_event(const EventSpec& spec, bool inherit, int group_fd, bool exclude_kernel) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = spec.type;
+    attr.config = spec.config;
+    attr.disabled = group_fd < 0 ? 1 : 0;   // Members follow their leader
+    attr.inherit = inherit ? 1 : 0;
+    attr.exclude_kernel = exclude_kernel ? 1 : 0;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC));
+}
+
+std::string describe_open_error(int error) {
+    if (error == EACCES || error == EPERM) {
+        std::string level;
+        std::ifstream("/proc/sys/kernel/perf_event_paranoid") >> level;
+        return "kernel.perf_event_paranoid is " + (level.empty() ? std::string("unknown") : level) +
+               "; user-space counting needs 2 or lower, or CAP_PERFMON";
+    }
+    if (error == ENOENT || error == EOPNOTSUPP || error == ENODEV) {
+        return "no hardware PMU available (common in virtual machines and containers)";
+    }
+    if (error == ENOSYS) {
+        return "perf_event_open is not supported by this kernel";
+    }
+    return std::string("perf_event_open failed: ") + std::strerror(error);
+}
+
+// Scale for multiplexing; empty if the counter never ran
+std::optional<uint64_t> read_event(int fd) {
+    if (fd < 0) {
+        return std::nullopt;
+    }
+    uint64_t values[3] = {};    // value, time enabled, time running
+    if (read(fd, values, sizeof values) != static_cast<ssize_t>(sizeof values) || values[2] == 0) {
+        return std::nullopt;
+    }
+    if (values[2] < values[1]) {
+        return static_cast<uint64_t>(static_cast<double>(values[0]) * values[1] / values[2]);
+    }
+    return values[0];
+}
+
+#endif // __linux__
+
+} // namespace
+
+std::optional<double> CounterSample::ipc() const {
+    if (!cycles || !instructions || *cycles == 0) {
+        return std::nullopt;
+    }
+    return static_cast<double>(*instructions) / static_cast<double>(*cycles);
+}
+
+std::string format_counters(const CounterSample& sample) {
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(sample.wall_seconds < 0.01 ? 3 : 1)
+         << sample.wall_seconds * 1000 << " ms";
+    auto field = [&text](const char* name, const std::optional<uint64_t>& value) {
+        if (value) {
+            text << "  " << name << ' ' << format_count(*value);
+        }
+    };
+    field("cycles", sample.cycles);
+    field("instr", sample.instructions);
+    if (auto ipc = sample.ipc()) {
+        text << "  IPC " << std::setprecision(2) << *ipc;
+    }
+    field("L1d miss", sample.l1d_misses);
+    field("LLC miss", sample.llc_misses);
+    field("br miss", sample.branch_misses);
+    field("ctx sw", sample.context_switches);
+    return text.str();
+}
+
+PerfCounters::PerfCounters(bool inherit) {
+    fds_.fill(-1);
+#ifdef __linux__
+    fds_[0] = open_event(EVENTS[0], inherit, -1, true);
+    if (fds_[0] < 0) {
+        reason_ = describe_open_error(errno);
+    } else {
+        for (size_t i = 1; i + 1 < EVENT_COUNT; ++i) {
+            fds_[i] = open_event(EVENTS[i], inherit, fds_[0], true);
+        }
+    }
+    // Its own group, so it still works without a PMU. Context switches
+    // happen in the kernel; paranoid systems only allow the user-space view.
+    const size_t last = EVENT_COUNT - 1;
+    fds_[last] = open_event(EVENTS[last], inherit, -1, false);
+    if (fds_[last] < 0) {
+        fds_[last] = open_event(EVENTS[last], inherit, -1, true);
+    }
+#else
+    (void)inherit;
+    reason_ = "hardware counters are only supported on Linux";
+#endif
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+#endif
+}
+
+void PerfCounters::start() {
+#ifdef __linux__
+    for (size_t i : {size_t{0}, EVENT_COUNT - 1}) {
+        if (fds_[i] >= 0) {
+            ioctl(fds_[i], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fds_[i], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+#endif
+    started_ = std::chrono::steady_clock::now();
+}
+
+CounterSample PerfCounters::stop() {
+    CounterSample sample;
+    sample.wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started_).count();
+#ifdef __linux__
+    for (size_t i : {size_t{0}, EVENT_COUNT - 1}) {
+        if (fds_[i] >= 0) {
+            ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+    sample.cycles = read_event(fds_[0]);
+    sample.instructions = read_event(fds_[1]);
+    sample.l1d_misses = read_event(fds_[2]);
+    sample.llc_misses = read_event(fds_[3]);
+    sample.branch_misses = read_event(fds_[4]);
+    sample.context_switches = read_event(fds_[5]);
+#endif
+    return sample;
+}
+
+} // namespace perf
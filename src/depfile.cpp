@@ -0,0 +1,88 @@
+#include "build/depfile.hpp"
+
+#include <fstream>
+#include <sstream>
+
+namespace build {
+
+std::vector<std::string> parse_depfile(std::string_view content) {
+    std::vector<std::string> prerequisites;
+    std::string token;
+    bool in_prerequisites = false;
+
+    auto flush_token = [&]() {
+        if (!token.empty()) {
+            if (in_prerequisites) {
+                prerequisites.push_back(token);
+            }
+            token.clear();
+        }
+    };
+
+    for (size_t i = 0; i < content.size(); ++i) {
+        char c = content[i];
+
+        if (c == '\\' && i + 1 < content.size()) {
+            char next = content[i + 1];
+            if (next == '\n') {              // line continuation
+                flush_token();
+                ++i;
+                continue;
+            }
+            if (next == '\r' && i + 2 < content.size() && content[i + 2] == '\n') {
+                flush_token();
+                i += 2;
+                continue;
+            }
+            if (next == ' ' || next == '#' || next == '\\') {
+                token += next;
+                ++i;
+                continue;
+            }
+        }
+
+        if (c == '$' && i + 1 < content.size() && content[i + 1] == '$') {
+            token += '$';
+            ++i;
+            continue;
+        }
+
+        if (c == '\n') {
+            flush_token();
+            if (in_prerequisites) {
+                break;                       // end of the first rule
+            }
+            continue;
+        }
+
+        if (c == ' ' || c == '\t' || c == '\r') {
+            flush_token();
+            continue;
+        }
+
+        if (c == ':' && !in_prerequisites &&
+            (i + 1 == content.size() || content[i + 1] == ' ' || content[i + 1] == '\t' ||
+             content[i + 1] == '\n' || content[i + 1] == '\r')) {
+            token.clear();                   // drop the target name
+            in_prerequisites = true;
+            continue;
+        }
+
+        token += c;
+    }
+    flush_token();
+
+    return prerequisites;
+}
+
+std::vector<std::string> read_depfile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return {};
+    }
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    return parse_depfile(buffer.str());
+}
+
+} // namespace build
@@ -0,0 +1,195 @@
+#include "build/fast_link.hpp"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+#include "utils/process.hpp"
+
+namespace build {
+
+namespace {
+
+bool is_library_source(const fs::path& source) {
+    const fs::path relative = source.lexically_normal();
+    return relative.filename() != "main.cpp" && relative.begin() != relative.end() &&
+           *relative.begin() != "tests" && *relative.begin() != "bench";
+}
+
+} // namespace
+
+std::vector<Linker> detect_linkers(const std::string& compiler) {
+    static std::mutex mutex;
+    static std::map<std::string, std::vector<Linker>> detected;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = detected.find(compiler);
+    if (it != detected.end()) {
+        return it->second;
+    }
+
+    std::vector<Linker> linkers;
+    for (std::string_view name : {"mold", "lld", "gold", "default"}) {
+        Linker linker;
+        linker.name = name;
+        if (name != "default") {
+            linker.flag = "-fuse-ld=" + linker.name;
+        }
+        std::vector<std::string> command = {compiler};
+        if (!linker.flag.empty()) {
+            command.push_back(linker.flag);
+        }
+        command.push_back("-Wl,--version");
+        process::Result result;
+        try {
+            result = process::run(command);
+        } catch (const std::exception&) {
+            continue;
+        }
+        if (result.exit_code != 0) {
+            continue;
+        }
+        // The first line is collect2's when GCC drives the link
+        for (size_t start = 0; start < result.output.size();) {
+            const size_t end = std::min(result.output.find('\n', start), result.output.size());
+            const std::string line = result.output.substr(start, end - start);
+            if (!line.empty() && line.rfind("collect2", 0) != 0 && line.find(" -plugin ") == std::string::npos) {
+                linker.version = line;
+                break;
+            }
+            start = end + 1;
+        }
+        linker.gdb_index = supports_gdb_index(linker.version);
+        linkers.push_back(std::move(linker));
+    }
+    return detected.emplace(compiler, std::move(linkers)).first->second;
+}
+
+bool supports_gdb_index(std::string_view version) {
+    // "GNU gold (GNU Binutils 2.40) 1.16", "Ubuntu LLD 16.0.6 (compatible with
+    // GNU linkers)", "mold 2.4.0 (compatible with GNU ld)"
+    return version.find("GNU gold") != std::string_view::npos ||
+           version.find("LLD ") != std::string_view::npos || version.rfind("mold ", 0) == 0;
+}
+
+Linker select_linker(const std::vector<Linker>& linkers, std::string_view name) {
+    if (name == "auto" || name.empty()) {
+        if (linkers.empty()) {
+            throw std::runtime_error("The compiler cannot link at all");
+        }
+        return linkers.front();
+    }
+    for (const auto& linker : linkers) {
+        if (linker.name == name) {
+            return linker;
+        }
+    }
+    if (name != "mold" && name != "lld" && name != "gold" && name != "default") {
+        throw std::runtime_error("Unknown linker '" + std::string(name) + "' (use auto, mold, lld, gold or default)");
+    }
+    throw std::runtime_error("Linker '" + std::string(name) + "' is not installed for this compiler");
+}
+
+void apply_fast_link(BuildConfig& config, const Linker& linker, const FastLinkOptions& options) {
+    auto add_compile_flag = [&](const std::string& flag) {
+        if (std::find(config.compile_flags.begin(), config.compile_flags.end(), flag) == config.compile_flags.end()) {
+            config.compile_flags.push_back(flag);
+        }
+    };
+    if (options.split_dwarf) {
+        add_compile_flag("-gsplit-dwarf");
+    }
+    if (!linker.flag.empty()) {
+        config.link_flags.push_back(linker.flag);
+    }
+    if (linker.gdb_index) {
+        add_compile_flag("-ggnu-pubnames");
+        config.link_flags.push_back("-Wl,--gdb-index");
+    }
+
+    if (options.shared) {
+        config.library_sources.clear();
+        for (const auto& source : config.sources) {
+            if (is_library_source(source)) {
+                config.library_sources.push_back(source);
+            }
+        }
+        if (!config.library_sources.empty()) {
+            add_compile_flag("-fPIC");
+            const std::string project = fs::current_path().filename().string();
+            config.shared_library = config.obj_dir.parent_path() / "lib" / ("lib" + project + ".so");
+        }
+    }
+}
+
+std::vector<std::string> relink_with(const std::vector<std::string>& command, const Linker& linker,
+                                     const fs::path& output) {
+    std::vector<std::string> relinked;
+    for (size_t i = 0; i < command.size(); ++i) {
+        const std::string& arg = command[i];
+        if (arg.rfind("-fuse-ld=", 0) == 0 || arg == "-Wl,--gdb-index") {
+            continue;
+        }
+        relinked.push_back(arg);
+        if (i == 0) {
+            if (!linker.flag.empty()) {
+                relinked.push_back(linker.flag);
+            }
+            if (linker.gdb_index) {
+                relinked.push_back("-Wl,--gdb-index");
+            }
+        } else if (arg == "-o" && i + 1 < command.size()) {
+            relinked.push_back(output.string());
+            ++i;
+        }
+    }
+    return relinked;
+}
+
+std::vector<LinkTiming> compare_linkers(const std::vector<std::vector<std::string>>& commands,
+                                        const std::vector<Linker>& linkers, const fs::path& scratch,
+                                        unsigned runs) {
+    std::vector<LinkTiming> timings;
+    for (const auto& linker : linkers) {
+        LinkTiming timing;
+        timing.linker = linker.name;
+        const fs::path dir = scratch / linker.name;
+        std::error_code ec;
+        fs::create_directories(dir, ec);
+
+        std::vector<std::vector<std::string>> relinks;
+        fs::path output;
+        for (const auto& command : commands) {
+            auto out = std::find(command.begin(), command.end(), "-o");
+            output = dir / (out != command.end() && out + 1 != command.end() ? fs::path(*(out + 1)).filename()
+                                                                               : fs::path("a.out"));
+            relinks.push_back(relink_with(command, linker, output));
+        }
+
+        std::vector<double> samples;
+        for (unsigned run = 0; run < std::max(1u, runs) && timing.error.empty(); ++run) {
+            double seconds = 0.0;
+            for (const auto& relink : relinks) {
+                fs::remove(output, ec);
+                const process::Result result = process::run(relink);
+                if (result.exit_code != 0) {
+                    timing.error = result.output.empty() ? "link failed" : result.output;
+                    break;
+                }
+                seconds += result.wall_seconds;
+            }
+            samples.push_back(seconds);
+        }
+        if (timing.error.empty()) {
+            std::sort(samples.begin(), samples.end());
+            timing.seconds = samples[samples.size() / 2];
+            timing.bytes = fs::file_size(output, ec);
+        }
+        timings.push_back(std::move(timing));
+    }
+    std::error_code ec;
+    fs::remove_all(scratch, ec);    // Best effort; the timings are what matters
+    return timings;
+}
+
+} // namespace build
@@ -0,0 +1,160 @@
+#include "build/file_watcher.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace build {
+
+namespace {
+
+int poll_timeout(std::chrono::milliseconds timeout) {
+    if (timeout == std::chrono::milliseconds::max()) {
+        return -1;
+    }
+    return static_cast<int>(std::clamp<long long>(timeout.count(), 0, INT_MAX));
+}
+
+} // namespace
+
+#ifdef __linux__
+
+FileWatcher::FileWatcher(const std::vector<fs::path>& roots) : roots_(roots) {
+    fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd_ < 0) {
+        throw std::runtime_error(std::string("inotify_init1 failed: ") + std::strerror(errno));
+    }
+    for (const auto& root : roots) {
+        add_tree(root);
+    }
+}
+
+FileWatcher::~FileWatcher() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+void FileWatcher::add_tree(const fs::path& root, std::vector<fs::path>* files) {
+    std::error_code ec;
+    if (!fs::is_directory(root, ec)) {
+        return;
+    }
+    // Watch first, then list: a file created in between is reported by
+    // both, which the de-duplication in wait() absorbs
+    add_directory(root);
+    for (auto it = fs::recursive_directory_iterator(root, ec); !ec && it != fs::recursive_directory_iterator();
+         it.increment(ec)) {
+        if (it->is_directory(ec)) {
+            add_directory(it->path());
+        } else if (files && it->is_regular_file(ec)) {
+            files->push_back(it->path());
+        }
+    }
+}
+
+void FileWatcher::add_directory(const fs::path& dir) {
+    constexpr uint32_t mask = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+    const int wd = inotify_add_watch(fd_, dir.c_str(), mask);
+    if (wd < 0) {
+        if (errno == ENOSPC) {
+            throw std::runtime_error("Out of inotify watches; raise fs.inotify.max_user_watches");
+        }
+        return;     // Removed again before we got to it
+    }
+    directories_[wd] = dir;
+}
+
+bool FileWatcher::read_events(int timeout_ms, ChangeSet& changes) {
+    pollfd pending{fd_, POLLIN, 0};
+    const int ready = poll(&pending, 1, timeout_ms);
+    if (ready < 0 && errno != EINTR) {
+        throw std::runtime_error(std::string("poll on inotify failed: ") + std::strerror(errno));
+    }
+    if (ready <= 0) {
+        return false;
+    }
+
+    alignas(inotify_event) char buffer[64 * 1024];
+    for (;;) {
+        const ssize_t length = read(fd_, buffer, sizeof buffer);
+        if (length <= 0) {
+            break;
+        }
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                // Anything may have been missed, including new directories
+                changes.overflowed = true;
+                for (const auto& root : roots_) {
+                    add_tree(root);
+                }
+                continue;
+            }
+            auto it = directories_.find(event->wd);
+            if (event->mask & IN_IGNORED) {
+                if (it != directories_.end()) {
+                    directories_.erase(it);
+                }
+                continue;
+            }
+            if (it == directories_.end() || event->len == 0) {
+                continue;
+            }
+            const fs::path path = it->second / event->name;
+            if (event->mask & IN_ISDIR) {
+                // Files can land in it before the watch exists (mkdir -p
+                // and touch, cp -r, git checkout), so report those too
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                    add_tree(path, &changes.paths);
+                }
+                continue;
+            }
+            changes.paths.push_back(path);
+        }
+    }
+    return true;
+}
+
+#else
+
+FileWatcher::FileWatcher(const std::vector<fs::path>&) {
+    throw std::runtime_error("Watch mode needs inotify, which is only available on Linux");
+}
+
+FileWatcher::~FileWatcher() = default;
+
+void FileWatcher::add_tree(const fs::path&, std::vector<fs::path>*) {}
+
+void FileWatcher::add_directory(const fs::path&) {}
+
+bool FileWatcher::read_events(int, ChangeSet&) {
+    return false;
+}
+
+#endif // __linux__
+
+ChangeSet FileWatcher::wait(std::chrono::milliseconds debounce, std::chrono::milliseconds timeout) {
+    ChangeSet changes;
+    if (!read_events(poll_timeout(timeout), changes)) {
+        return changes;
+    }
+    changes.first_event = std::chrono::steady_clock::now();
+    while (read_events(poll_timeout(debounce), changes)) {
+    }
+    std::sort(changes.paths.begin(), changes.paths.end());
+    changes.paths.erase(std::unique(changes.paths.begin(), changes.paths.end()), changes.paths.end());
+    return changes;
+}
+
+} // namespace build
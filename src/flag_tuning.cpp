@@ -0,0 +1,294 @@
+#include "build/flag_tuning.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "build/build_analysis.hpp"
+#include "utils/colors.hpp"
+#include "utils/process.hpp"
+#include "utils/project_config.hpp"
+
+namespace build {
+
+namespace {
+
+bool is_optimization_level(const std::string& flag) {
+    return flag.size() >= 2 && flag.compare(0, 2, "-O") == 0;
+}
+
+std::string first_line(const std::string& text) {
+    return text.substr(0, text.find('\n'));
+}
+
+// One run of the workload against `binary`; returns its score
+double run_workload(const TuneOptions& options, const fs::path& binary, const fs::path& scratch) {
+    std::vector<std::string> command;
+    switch (options.workload) {
+    case TuneWorkload::Bench:
+        command = {binary.string()};
+        command.insert(command.end(), options.args.begin(), options.args.end());
+        command.insert(command.end(), {"--json", (scratch / "results.json").string()});
+        break;
+    case TuneWorkload::Binary:
+        command = {binary.string()};
+        command.insert(command.end(), options.args.begin(), options.args.end());
+        break;
+    case TuneWorkload::Command: {
+        std::string shell = options.command;
+        for (size_t pos = 0; (pos = shell.find("{bin}", pos)) != std::string::npos;) {
+            const std::string quoted = process::shell_quote(binary.string());
+            shell.replace(pos, 5, quoted);
+            pos += quoted.size();
+        }
+        command = {"/bin/sh", "-c", shell};
+        break;
+    }
+    }
+
+    const process::Result result = process::run(command);
+    if (result.exit_code != 0) {
+        throw std::runtime_error(process::join_command(command) + " exited with code " +
+                                 std::to_string(result.exit_code));
+    }
+    if (options.workload != TuneWorkload::Bench) {
+        return result.wall_seconds;
+    }
+    std::ifstream file(scratch / "results.json");
+    std::ostringstream json;
+    json << file.rdbuf();
+    const double score = bench_score(json.str());
+    if (score <= 0.0) {
+        throw std::runtime_error("The bench runner reported no benchmarks");
+    }
+    return score;
+}
+
+} // namespace
+
+fs::path release_profile_path(const std::string& name) {
+    return fs::path("profiles") / (name + ".mk");
+}
+
+ReleaseProfile load_release_profile(const std::string& name) {
+    const fs::path path = release_profile_path(name);
+    if (!fs::is_regular_file(path)) {
+        throw std::runtime_error("No release profile '" + name + "' (expected " + path.string() +
+                                 "); create one with 'cppstarter tune'");
+    }
+    const config::ProjectConfig file = config::ProjectConfig::load(path);
+    ReleaseProfile profile;
+    profile.name = name;
+    profile.compiler = file.get("PROFILE_CXX");
+    profile.flags = file.get_list("PROFILE_FLAGS");
+    return profile;
+}
+
+void save_release_profile(const ReleaseProfile& profile, const std::vector<std::string>& comment) {
+    const fs::path path = release_profile_path(profile.name);
+    std::error_code ec;
+    fs::create_directories(path.parent_path(), ec);
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Cannot write " + path.string());
+    }
+    for (const auto& line : comment) {
+        file << "# " << line << '\n';
+    }
+    file << "PROFILE_CXX = " << profile.compiler << '\n' << "PROFILE_FLAGS =";
+    for (const auto& flag : profile.flags) {
+        file << ' ' << flag;
+    }
+    file << '\n';
+}
+
+void apply_release_profile(BuildConfig& config, const ReleaseProfile& profile) {
+    if (config.name != "release" && config.name != "bench") {
+        return;
+    }
+    config.compile_flags.erase(std::remove_if(config.compile_flags.begin(), config.compile_flags.end(),
+                                              is_optimization_level),
+                               config.compile_flags.end());
+    config.compile_flags.insert(config.compile_flags.end(), profile.flags.begin(), profile.flags.end());
+    if (!profile.compiler.empty()) {
+        config.compiler = profile.compiler;
+    }
+}
+
+std::string FlagVariant::label() const {
+    std::string text = compiler;
+    for (const auto& flag : flags) {
+        text += ' ' + flag;
+    }
+    return text;
+}
+
+std::vector<std::string> available_compilers() {
+    std::vector<std::string> candidates;
+    if (const char* cxx = std::getenv("CXX"); cxx && *cxx) {
+        candidates.emplace_back(cxx);
+    }
+    candidates.insert(candidates.end(), {"g++", "clang++"});
+
+    std::vector<std::string> compilers;
+    std::vector<std::string> versions;
+    for (const auto& candidate : candidates) {
+        process::Result version;
+        try {
+            version = process::run({candidate, "--version"});
+        } catch (const std::exception&) {
+            continue;
+        }
+        // c++ and g++ are usually the same compiler
+        const std::string id = first_line(version.output);
+        if (version.exit_code == 0 && std::find(versions.begin(), versions.end(), id) == versions.end()) {
+            compilers.push_back(candidate);
+            versions.push_back(id);
+        }
+    }
+    return compilers;
+}
+
+std::string lto_flag(const std::string& compiler) {
+    const bool clang = fs::path(compiler).filename().string().find("clang") != std::string::npos ||
+                       compiler_is_clang(compiler);
+    return clang ? "-flto=thin" : "-flto=auto";
+}
+
+std::vector<FlagVariant> tuning_matrix(const std::vector<std::string>& compilers,
+                                       const std::vector<std::vector<std::string>>& extra) {
+    std::vector<FlagVariant> variants;
+    for (const auto& compiler : compilers) {
+        const std::string lto = lto_flag(compiler);
+        const std::vector<std::vector<std::string>> flag_sets = {
+            {"-O2"},
+            {"-O3"},
+            {"-O2", "-march=native"},
+            {"-O3", "-march=native"},
+            {"-O2", lto},
+            {"-O3", "-march=native", lto},
+            {"-O3", "-march=native", lto, "-fno-plt", "-fno-semantic-interposition"},
+        };
+        for (const auto& flags : flag_sets) {
+            variants.push_back({compiler, flags});
+        }
+        for (const auto& flags : extra) {
+            variants.push_back({compiler, flags});
+        }
+    }
+    return variants;
+}
+
+double bench_score(std::string_view json) {
+    constexpr std::string_view key = "\"median_ns\":";
+    double log_sum = 0.0;
+    size_t count = 0;
+    for (size_t pos = json.find(key); pos != std::string_view::npos; pos = json.find(key, pos)) {
+        pos += key.size();
+        const double value = std::strtod(std::string(json.substr(pos, 32)).c_str(), nullptr);
+        if (value > 0.0) {
+            log_sum += std::log(value);
+            ++count;
+        }
+    }
+    return count == 0 ? 0.0 : std::exp(log_sum / static_cast<double>(count));
+}
+
+TuneReport run_tuning(const TuneOptions& options) {
+    if (options.variants.empty()) {
+        throw std::runtime_error("No flag variants to try");
+    }
+
+    // === Build every variant ===
+    std::vector<VariantResult> results;
+    std::vector<fs::path> binaries;
+    for (size_t i = 0; i < options.variants.size(); ++i) {
+        VariantResult result;
+        result.variant = options.variants[i];
+
+        BuildConfig config = options.base;
+        apply_release_profile(config, {"", result.variant.compiler, result.variant.flags});
+        const fs::path tree = fs::path("build/tune") / std::to_string(i + 1);
+        config.obj_dir = tree / "obj";
+        config.binary = tree / "bin" / config.binary.filename();
+
+        std::cout << colors::CYAN << "[" << i + 1 << '/' << options.variants.size() << "] Building "
+                  << result.variant.label() << colors::RESET << '\n';
+        try {
+            BuildEngine engine(std::move(config));
+            if (!engine.build(options.build).success) {
+                result.error = "build failed";
+            }
+            binaries.push_back(engine.config().binary);
+        } catch (const std::exception& error) {
+            result.error = error.what();
+            binaries.emplace_back();
+        }
+        if (i == 0 && !result.error.empty()) {
+            throw std::runtime_error("The baseline (" + result.variant.label() + ") does not build: " + result.error);
+        }
+        results.push_back(std::move(result));
+    }
+
+    // === Run the workload round-robin ===
+    const unsigned rounds = options.warmup + std::max(2u, options.runs);
+    for (unsigned round = 0; round < rounds; ++round) {
+        const bool timed = round >= options.warmup;
+        std::cout << colors::CYAN << (timed ? "Timing run " : "Warmup run ")
+                  << (timed ? round - options.warmup + 1 : round + 1) << '/'
+                  << (timed ? rounds - options.warmup : options.warmup) << colors::RESET << '\n';
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (!results[i].error.empty()) {
+                continue;
+            }
+            try {
+                const double score = run_workload(options, binaries[i], binaries[i].parent_path());
+                if (timed) {
+                    results[i].samples.push_back(score);
+                }
+            } catch (const std::exception& error) {
+                if (i == 0) {
+                    throw std::runtime_error("The workload fails with the baseline: " + std::string(error.what()));
+                }
+                results[i].error = error.what();
+                results[i].samples.clear();
+            }
+        }
+    }
+
+    // === Compare and rank ===
+    for (auto& result : results) {
+        if (result.error.empty()) {
+            result.vs_baseline = perf::compare(results[0].samples, result.samples, options.threshold);
+        }
+    }
+    const FlagVariant baseline = results[0].variant;
+    std::stable_sort(results.begin(), results.end(), [](const VariantResult& a, const VariantResult& b) {
+        if (a.error.empty() != b.error.empty()) {
+            return a.error.empty();
+        }
+        return a.error.empty() && a.vs_baseline.current.median < b.vs_baseline.current.median;
+    });
+
+    TuneReport report;
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (results[i].variant.label() == baseline.label()) {
+            report.baseline = i;
+        }
+    }
+    report.winner = report.baseline;
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (results[i].error.empty() && results[i].vs_baseline.verdict == perf::Verdict::Faster) {
+            report.winner = i;
+            break;
+        }
+    }
+    report.results = std::move(results);
+    return report;
+}
+
+} // namespace build
@@ -0,0 +1,279 @@
+#include "perf/flamegraph.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace perf {
+
+namespace {
+
+std::vector<std::string> split_stack(const std::string& stack) {
+    std::vector<std::string> frames;
+    size_t start = 0;
+    for (;;) {
+        const size_t end = stack.find(';', start);
+        frames.push_back(stack.substr(start, end - start));
+        if (end == std::string::npos) {
+            return frames;
+        }
+        start = end + 1;
+    }
+}
+
+// "work(int)+0x1a" -> "work(int)"
+std::string strip_offset(std::string symbol) {
+    const size_t plus = symbol.rfind("+0x");
+    if (plus != std::string::npos && plus > 0) {
+        symbol.erase(plus);
+    }
+    return symbol;
+}
+
+std::string xml_escape(std::string_view text) {
+    std::string escaped;
+    for (char c : text) {
+        switch (c) {
+        case '&': escaped += "&amp;"; break;
+        case '<': escaped += "&lt;"; break;
+        case '>': escaped += "&gt;"; break;
+        case '"': escaped += "&quot;"; break;
+        default: escaped += c;
+        }
+    }
+    return escaped;
+}
+
+struct Node {
+    std::string name;
+    uint64_t value = 0;
+    std::map<std::string, std::unique_ptr<Node>> children;   // Sorted, like flamegraph.pl
+};
+
+// Warm palette with a stable colour per function name
+std::string frame_color(const std::string& name) {
+    uint32_t hash = 2166136261u;
+    for (unsigned char c : name) {
+        hash = (hash ^ c) * 16777619u;
+    }
+    const int red = 205 + static_cast<int>(hash % 50);
+    const int green = static_cast<int>((hash >> 8) % 190);
+    const int blue = static_cast<int>((hash >> 16) % 55);
+    return "rgb(" + std::to_string(red) + "," + std::to_string(green) + "," + std::to_string(blue) + ")";
+}
+
+constexpr double IMAGE_WIDTH = 1200.0;
+constexpr double PADDING = 10.0;
+constexpr double FRAME_HEIGHT = 16.0;
+constexpr double CHAR_WIDTH = 7.0;      // Approximate width of a 12px monospace glyph
+constexpr double MIN_WIDTH = 0.1;       // Frames narrower than this are not drawn
+
+void render_node(std::ostringstream& svg, const Node& node, double x, int depth, double scale,
+                 double image_height, uint64_t total) {
+    const double width = node.value * scale;
+    if (width < MIN_WIDTH) {
+        return;
+    }
+
+    if (depth >= 0) {
+        const double y = image_height - PADDING * 3 - (depth + 1) * FRAME_HEIGHT;
+        const double percent = 100.0 * node.value / total;
+        std::string label;
+        const size_t fits = static_cast<size_t>((width - 6) / CHAR_WIDTH);
+        if (fits >= 3) {
+            label = node.name.size() <= fits ? node.name : node.name.substr(0, fits - 2) + "..";
+        }
+
+        svg << "<g><title>" << xml_escape(node.name) << " (" << node.value << " samples, "
+            << std::fixed << std::setprecision(2) << percent << "%)</title>"
+            << "<rect x=\"" << std::setprecision(1) << x << "\" y=\"" << y << "\" width=\"" << width
+            << "\" height=\"" << FRAME_HEIGHT - 1 << "\" fill=\"" << frame_color(node.name)
+            << "\" rx=\"2\" ry=\"2\"/>";
+        if (!label.empty()) {
+            svg << "<text x=\"" << x + 3 << "\" y=\"" << y + 11.5 << "\">" << xml_escape(label) << "</text>";
+        }
+        svg << "</g>\n";
+    }
+
+    for (const auto& [name, child] : node.children) {
+        render_node(svg, *child, x, depth + 1, scale, image_height, total);
+        x += child->value * scale;
+    }
+}
+
+int max_depth(const Node& node) {
+    int depth = 0;
+    for (const auto& [name, child] : node.children) {
+        depth = std::max(depth, 1 + max_depth(*child));
+    }
+    return depth;
+}
+
+} // namespace
+
+void add_stack(FoldedStacks& stacks, const std::vector<std::string>& frames, uint64_t count) {
+    if (frames.empty() || count == 0) {
+        return;
+    }
+    std::string key;
+    for (const auto& frame : frames) {
+        if (!key.empty()) {
+            key += ';';
+        }
+        // ';' separates frames in the folded format
+        std::string name = frame;
+        std::replace(name.begin(), name.end(), ';', ':');
+        key += name;
+    }
+    stacks[key] += count;
+}
+
+FoldedStacks fold_perf_script(std::string_view text) {
+    FoldedStacks stacks;
+    std::vector<std::string> frames;   // Innermost first, as perf prints them
+    bool in_sample = false;
+
+    auto flush = [&]() {
+        if (!frames.empty()) {
+            std::reverse(frames.begin(), frames.end());
+            add_stack(stacks, frames);
+        }
+        frames.clear();
+        in_sample = false;
+    };
+
+    std::istringstream input{std::string(text)};
+    std::string line;
+    while (std::getline(input, line)) {
+        const size_t first = line.find_first_not_of(" \t");
+        if (first == std::string::npos) {
+            flush();
+            continue;
+        }
+        if (first == 0) {
+            flush();             // Sample header: "comm pid time: period event:"
+            in_sample = true;
+            continue;
+        }
+        if (!in_sample) {
+            continue;
+        }
+
+        // "    55d0c0a1 work(int)+0x1a (/path/to/binary)"
+        std::istringstream fields(line.substr(first));
+        std::string address;
+        fields >> address;
+        std::string rest;
+        std::getline(fields, rest);
+        rest.erase(0, rest.find_first_not_of(' '));
+
+        std::string module;
+        const size_t paren = rest.rfind(" (");
+        if (paren != std::string::npos && rest.back() == ')') {
+            module = rest.substr(paren + 2, rest.size() - paren - 3);
+            rest.erase(paren);
+        }
+        std::string symbol = strip_offset(rest);
+        if (symbol.empty() || symbol == "[unknown]") {
+            const size_t slash = module.rfind('/');
+            symbol = "[" + (module.empty() ? std::string("unknown") : module.substr(slash + 1)) + "]";
+        }
+        frames.push_back(symbol);
+    }
+    flush();
+    return stacks;
+}
+
+std::string format_folded(const FoldedStacks& stacks) {
+    std::ostringstream out;
+    for (const auto& [stack, count] : stacks) {
+        out << stack << ' ' << count << '\n';
+    }
+    return out.str();
+}
+
+uint64_t total_samples(const FoldedStacks& stacks) {
+    uint64_t total = 0;
+    for (const auto& [stack, count] : stacks) {
+        total += count;
+    }
+    return total;
+}
+
+std::vector<HotFunction> hot_functions(const FoldedStacks& stacks, size_t limit) {
+    std::unordered_map<std::string, HotFunction> functions;
+    for (const auto& [stack, count] : stacks) {
+        const auto frames = split_stack(stack);
+        std::unordered_set<std::string> seen;   // Recursion counts once toward the total
+        for (const auto& frame : frames) {
+            HotFunction& function = functions[frame];
+            function.name = frame;
+            if (seen.insert(frame).second) {
+                function.total += count;
+            }
+        }
+        functions[frames.back()].self += count;
+    }
+
+    std::vector<HotFunction> ranked;
+    for (auto& [name, function] : functions) {
+        ranked.push_back(std::move(function));
+    }
+    std::sort(ranked.begin(), ranked.end(), [](const HotFunction& a, const HotFunction& b) {
+        if (a.self != b.self) return a.self > b.self;
+        if (a.total != b.total) return a.total > b.total;
+        return a.name < b.name;
+    });
+    if (ranked.size() > limit) {
+        ranked.resize(limit);
+    }
+    return ranked;
+}
+
+std::string render_flamegraph(const FoldedStacks& stacks, const std::string& title) {
+    Node root;
+    root.name = "all";
+    for (const auto& [stack, count] : stacks) {
+        root.value += count;
+        Node* node = &root;
+        for (const auto& frame : split_stack(stack)) {
+            auto& child = node->children[frame];
+            if (!child) {
+                child = std::make_unique<Node>();
+                child->name = frame;
+            }
+            child->value += count;
+            node = child.get();
+        }
+    }
+
+    // The root "all" frame sits at depth 0, the bottom row
+    const int depth = max_depth(root) + 1;
+    const double image_height = depth * FRAME_HEIGHT + PADDING * 6;
+    const double scale = root.value ? (IMAGE_WIDTH - 2 * PADDING) / root.value : 0.0;
+
+    std::ostringstream svg;
+    svg << "<?xml version=\"1.0\" standalone=\"no\"?>\n"
+        << "<svg version=\"1.1\" width=\"" << IMAGE_WIDTH << "\" height=\"" << image_height
+        << "\" viewBox=\"0 0 " << IMAGE_WIDTH << ' ' << image_height
+        << "\" xmlns=\"http://www.w3.org/2000/svg\">\n"
+        << "<style>text { font-family: monospace; font-size: 12px; fill: #000; pointer-events: none; }\n"
+        << "g:hover rect { stroke: #000; stroke-width: 0.5; }</style>\n"
+        << "<rect x=\"0\" y=\"0\" width=\"100%\" height=\"100%\" fill=\"#f8f8f8\"/>\n"
+        << "<text x=\"" << IMAGE_WIDTH / 2 << "\" y=\"24\" text-anchor=\"middle\" style=\"font-size: 17px\">"
+        << xml_escape(title) << "</text>\n"
+        << "<text x=\"" << PADDING << "\" y=\"" << image_height - PADDING << "\">" << root.value
+        << " samples; hover a frame for details</text>\n";
+
+    Node all;
+    all.value = root.value;
+    all.children["all"] = std::make_unique<Node>(std::move(root));
+    render_node(svg, all, PADDING, -1, scale, image_height, std::max<uint64_t>(1, all.value));
+    svg << "</svg>\n";
+    return svg.str();
+}
+
+} // namespace perf
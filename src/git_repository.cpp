@@ -0,0 +1,281 @@
+#include "scaffold/git_repository.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <sys/stat.h>
+
+#include "scaffold/template_pack.hpp"
+#include "utils/hash.hpp"
+#include "utils/process.hpp"
+
+namespace scaffold {
+
+namespace {
+
+constexpr char ZERO_ID[] = "0000000000000000000000000000000000000000";
+
+using RawId = std::array<uint8_t, 20>;
+
+std::string trim(std::string text) {
+    text.erase(text.find_last_not_of(" \t\r\n") + 1);
+    return text;
+}
+
+void put_be32(std::string& out, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<char>((value >> shift) & 0xff));
+    }
+}
+
+uint32_t adler32(std::string_view data) {
+    uint32_t a = 1, b = 0;
+    while (!data.empty()) {
+        // 5552 is the most bytes that can be summed before the 32-bit sums may overflow
+        const size_t chunk = std::min<size_t>(data.size(), 5552);
+        for (size_t i = 0; i < chunk; ++i) {
+            a += static_cast<unsigned char>(data[i]);
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+        data.remove_prefix(chunk);
+    }
+    return (b << 16) | a;
+}
+
+// A zlib stream of stored (uncompressed) deflate blocks. Git inflates it like
+// any other object; `git gc` recompresses later if anyone cares.
+std::string zlib_stored(std::string_view data) {
+    std::string out = "\x78\x01";
+    const uint32_t checksum = adler32(data);
+    do {
+        const size_t length = std::min<size_t>(data.size(), 65535);
+        const bool final = length == data.size();
+        out.push_back(final ? 1 : 0);
+        out.push_back(static_cast<char>(length & 0xff));
+        out.push_back(static_cast<char>(length >> 8));
+        out.push_back(static_cast<char>(~length & 0xff));
+        out.push_back(static_cast<char>((~length >> 8) & 0xff));
+        out.append(data.substr(0, length));
+        data.remove_prefix(length);
+    } while (!data.empty());
+    put_be32(out, checksum);
+    return out;
+}
+
+std::string read_file(const fs::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Could not read " + path.string());
+    }
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+class ObjectWriter {
+public:
+    explicit ObjectWriter(fs::path objects) : objects_(std::move(objects)) {}
+
+    RawId write(std::string_view type, std::string_view content) {
+        std::string object(type);
+        object += ' ' + std::to_string(content.size());
+        object.push_back('\0');
+        object.append(content);
+
+        hash::Sha1 sha;
+        sha.update(object);
+        const RawId id = sha.digest();
+        const std::string hex = hash::to_hex(id.data(), id.size());
+
+        const fs::path dir = objects_ / hex.substr(0, 2);
+        std::error_code ec;
+        fs::create_directory(dir, ec);
+        const fs::path path = dir / hex.substr(2);
+        if (!fs::exists(path, ec)) {
+            write_file(path, zlib_stored(object));
+        }
+        return id;
+    }
+
+private:
+    fs::path objects_;
+};
+
+struct IndexEntry {
+    std::string path;
+    struct stat info;
+    uint32_t mode;
+    RawId id;
+};
+
+// Write the blobs and trees below `dir`; empty when nothing in it is tracked
+std::optional<RawId> write_tree(ObjectWriter& writer, const fs::path& dir, const std::string& prefix,
+                                std::vector<IndexEntry>& index) {
+    struct Child {
+        std::string name;
+        std::string sort_key;   // Git orders directories as if their name ended in '/'
+        bool directory;
+    };
+    std::vector<Child> children;
+    for (const auto& entry : fs::directory_iterator(dir)) {
+        const std::string name = entry.path().filename().string();
+        const bool directory = entry.is_directory() && !entry.is_symlink();
+        if (name == ".git" || (prefix.empty() && name == "build" && directory)) {
+            continue;
+        }
+        if (directory || (entry.is_regular_file() && !entry.is_symlink())) {
+            children.push_back({name, directory ? name + '/' : name, directory});
+        }
+    }
+    std::sort(children.begin(), children.end(),
+              [](const Child& a, const Child& b) { return a.sort_key < b.sort_key; });
+
+    std::string tree;
+    for (const auto& child : children) {
+        const fs::path path = dir / child.name;
+        const std::string relative = prefix + child.name;
+        RawId id;
+        std::string mode;
+        if (child.directory) {
+            std::optional<RawId> subtree = write_tree(writer, path, relative + '/', index);
+            if (!subtree) {
+                continue;
+            }
+            id = *subtree;
+            mode = "40000";
+        } else {
+            IndexEntry entry;
+            if (stat(path.c_str(), &entry.info) != 0) {
+                throw std::runtime_error("Could not stat " + path.string());
+            }
+            entry.mode = (entry.info.st_mode & S_IXUSR) ? 0100755 : 0100644;
+            entry.id = writer.write("blob", read_file(path));
+            entry.path = relative;
+            id = entry.id;
+            mode = entry.mode == 0100755 ? "100755" : "100644";
+            index.push_back(std::move(entry));
+        }
+        tree += mode + ' ' + child.name;
+        tree.push_back('\0');
+        tree.append(reinterpret_cast<const char*>(id.data()), id.size());
+    }
+    if (tree.empty()) {
+        return std::nullopt;
+    }
+    return writer.write("tree", tree);
+}
+
+// Version 2 index with real stat data, so `git status` does not rehash every file
+std::string build_index(std::vector<IndexEntry> entries) {
+    std::sort(entries.begin(), entries.end(),
+              [](const IndexEntry& a, const IndexEntry& b) { return a.path < b.path; });
+
+    std::string index = "DIRC";
+    put_be32(index, 2);
+    put_be32(index, static_cast<uint32_t>(entries.size()));
+    for (const auto& entry : entries) {
+        const struct stat& info = entry.info;
+        put_be32(index, static_cast<uint32_t>(info.st_ctim.tv_sec));
+        put_be32(index, static_cast<uint32_t>(info.st_ctim.tv_nsec));
+        put_be32(index, static_cast<uint32_t>(info.st_mtim.tv_sec));
+        put_be32(index, static_cast<uint32_t>(info.st_mtim.tv_nsec));
+        put_be32(index, static_cast<uint32_t>(info.st_dev));
+        put_be32(index, static_cast<uint32_t>(info.st_ino));
+        put_be32(index, entry.mode);
+        put_be32(index, static_cast<uint32_t>(info.st_uid));
+        put_be32(index, static_cast<uint32_t>(info.st_gid));
+        put_be32(index, static_cast<uint32_t>(info.st_size));
+        index.append(reinterpret_cast<const char*>(entry.id.data()), entry.id.size());
+        const size_t name_length = std::min<size_t>(entry.path.size(), 0xfff);
+        index.push_back(static_cast<char>(name_length >> 8));
+        index.push_back(static_cast<char>(name_length & 0xff));
+        index += entry.path;
+        // 62 fixed bytes plus the name, NUL-padded to a multiple of 8 (at least one NUL)
+        const size_t entry_length = 62 + entry.path.size();
+        index.append(8 - entry_length % 8, '\0');
+    }
+
+    hash::Sha1 sha;
+    sha.update(index);
+    const RawId checksum = sha.digest();
+    index.append(reinterpret_cast<const char*>(checksum.data()), checksum.size());
+    return index;
+}
+
+} // namespace
+
+GitIdentity read_git_identity() {
+    GitIdentity identity;
+    auto git = [](const std::vector<std::string>& args) {
+        try {
+            return process::run(args);
+        } catch (const std::runtime_error&) {
+            throw std::runtime_error("git is not installed; it is needed to read the commit identity");
+        }
+    };
+
+    for (auto [variable, target] : {std::pair{"GIT_AUTHOR_IDENT", &identity.author},
+                                    std::pair{"GIT_COMMITTER_IDENT", &identity.committer}}) {
+        process::Result result = git({"git", "var", variable});
+        if (result.exit_code != 0) {
+            throw std::runtime_error("git has no identity to commit with (set user.name and user.email): " +
+                                     trim(result.output));
+        }
+        *target = trim(result.output);
+    }
+
+    process::Result branch = git({"git", "config", "--get", "init.defaultBranch"});
+    if (branch.exit_code == 0 && !trim(branch.output).empty()) {
+        identity.branch = trim(branch.output);
+    }
+    return identity;
+}
+
+std::string git_init_commit(const fs::path& root, const GitIdentity& identity, std::string_view message) {
+    const fs::path git_dir = root / ".git";
+    for (const char* dir : {"objects/info", "objects/pack", "refs/tags", "info"}) {
+        fs::create_directories(git_dir / dir);
+    }
+    fs::create_directories((git_dir / "refs/heads" / identity.branch).parent_path());
+    fs::create_directories((git_dir / "logs/refs/heads" / identity.branch).parent_path());
+
+    write_file(git_dir / "HEAD", "ref: refs/heads/" + identity.branch + "\n");
+    write_file(git_dir / "config",
+               "[core]\n"
+               "\trepositoryformatversion = 0\n"
+               "\tfilemode = true\n"
+               "\tbare = false\n"
+               "\tlogallrefupdates = true\n");
+    write_file(git_dir / "description", "Unnamed repository; edit this file 'description' to name the repository.\n");
+
+    ObjectWriter writer(git_dir / "objects");
+    std::vector<IndexEntry> entries;
+    std::optional<RawId> tree = write_tree(writer, root, "", entries);
+    if (!tree) {
+        tree = writer.write("tree", "");
+    }
+
+    std::string commit = "tree " + hash::to_hex(tree->data(), tree->size()) + "\n" +
+                         "author " + identity.author + "\n" +
+                         "committer " + identity.committer + "\n\n" +
+                         std::string(message) + "\n";
+    const RawId commit_id = writer.write("commit", commit);
+    const std::string commit_hex = hash::to_hex(commit_id.data(), commit_id.size());
+
+    write_file(git_dir / "index", build_index(std::move(entries)));
+    write_file(git_dir / "refs/heads" / identity.branch, commit_hex + "\n");
+    const std::string reflog = std::string(ZERO_ID) + ' ' + commit_hex + ' ' + identity.committer +
+                               "\tcommit (initial): " + std::string(message) + "\n";
+    write_file(git_dir / "logs/HEAD", reflog);
+    write_file(git_dir / "logs/refs/heads" / identity.branch, reflog);
+    return commit_hex;
+}
+
+} // namespace scaffold
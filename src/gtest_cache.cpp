@@ -0,0 +1,445 @@
+#include "build/gtest_cache.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <sys/file.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "build/compile_cache.hpp"
+#include "utils/hash.hpp"
+#include "utils/process.hpp"
+
+namespace build {
+
+namespace {
+
+constexpr std::string_view KEY_VERSION = "cppstarter-gtest-v1";
+
+std::string read_file(const fs::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+// Holds an exclusive flock() on `path` for its lifetime, so that concurrent
+// `make test` runs in sibling projects build an entry only once
+class FileLock {
+public:
+    explicit FileLock(const fs::path& path) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd_ >= 0) {
+            ::flock(fd_, LOCK_EX);
+        }
+    }
+    ~FileLock() {
+        if (fd_ >= 0) {
+            ::flock(fd_, LOCK_UN);
+            ::close(fd_);
+        }
+    }
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+
+private:
+    int fd_ = -1;
+};
+
+// Scratch directory next to the final location, so the rename is atomic
+fs::path scratch_dir(const fs::path& parent, std::string_view what) {
+    return parent / ("." + std::string(what) + "-" + std::to_string(::getpid()));
+}
+
+// Numeric comparison of dotted versions ("1.10.0" > "1.9.1"); anything
+// that is not a number compares as text
+bool version_less(const std::string& a, const std::string& b) {
+    std::istringstream left(a), right(b);
+    std::string x, y;
+    while (true) {
+        const bool more_left = static_cast<bool>(std::getline(left, x, '.'));
+        const bool more_right = static_cast<bool>(std::getline(right, y, '.'));
+        if (!more_left || !more_right) {
+            return !more_left && more_right;
+        }
+        if (x == y) {
+            continue;
+        }
+        const bool numeric = !x.empty() && !y.empty() &&
+                             x.find_first_not_of("0123456789") == std::string::npos &&
+                             y.find_first_not_of("0123456789") == std::string::npos;
+        return numeric ? std::stoull(x) < std::stoull(y) : x < y;
+    }
+}
+
+// Directory holding include/gtest/gtest.h and src/gtest-all.cc: `dir`
+// itself, its googletest/ subdirectory, or either of those one level down
+// (the top directory of a release tarball)
+std::optional<fs::path> locate_googletest(const fs::path& dir) {
+    auto is_googletest = [](const fs::path& candidate) {
+        return fs::is_regular_file(candidate / "include" / "gtest" / "gtest.h") &&
+               fs::is_regular_file(candidate / "src" / "gtest-all.cc");
+    };
+    std::vector<fs::path> candidates = {dir, dir / "googletest"};
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(dir, ec)) {
+        if (entry.is_directory(ec)) {
+            candidates.push_back(entry.path());
+            candidates.push_back(entry.path() / "googletest");
+        }
+    }
+    for (const auto& candidate : candidates) {
+        if (is_googletest(candidate)) {
+            return candidate;
+        }
+    }
+    return std::nullopt;
+}
+
+std::string first_line(const std::string& text) {
+    return text.substr(0, text.find('\n'));
+}
+
+std::optional<GtestEntry> read_entry(const fs::path& prefix) {
+    std::ifstream file(prefix / "entry.txt");
+    if (!file || !fs::is_regular_file(prefix / "lib" / "libgtest.a")) {
+        return std::nullopt;
+    }
+    GtestEntry entry;
+    entry.prefix = prefix;
+    std::string line;
+    while (std::getline(file, line)) {
+        const size_t space = line.find(' ');
+        const std::string field = line.substr(0, space);
+        const std::string value = space == std::string::npos ? "" : line.substr(space + 1);
+        if (field == "key") {
+            entry.key = value;
+        } else if (field == "version") {
+            entry.version = value;
+        } else if (field == "compiler") {
+            entry.compiler = value;
+        } else if (field == "flags") {
+            entry.flags = value;
+        }
+    }
+    return entry;
+}
+
+std::string join_flags(const std::vector<std::string>& flags) {
+    std::string joined;
+    for (const auto& flag : flags) {
+        joined += (joined.empty() ? "" : " ") + flag;
+    }
+    return joined;
+}
+
+} // namespace
+
+std::vector<std::string> gtest_abi_flags(const std::vector<std::string>& flags) {
+    static const std::vector<std::string_view> prefixes = {
+        "-std=", "-stdlib=", "-m", "--target=", "-fsanitize=", "-D_GLIBCXX_", "-D_LIBCPP_", "-DGTEST_",
+    };
+    static const std::vector<std::string_view> exact = {
+        "-pthread", "-fexceptions", "-fno-exceptions", "-frtti", "-fno-rtti", "-fPIC", "-fpic",
+    };
+    std::vector<std::string> abi;
+    for (const auto& flag : flags) {
+        const bool keep = std::find(exact.begin(), exact.end(), flag) != exact.end() ||
+                          std::any_of(prefixes.begin(), prefixes.end(), [&](std::string_view prefix) {
+                              return flag.rfind(prefix, 0) == 0;
+                          });
+        if (keep) {
+            abi.push_back(flag);
+        }
+    }
+    std::sort(abi.begin(), abi.end());
+    abi.erase(std::unique(abi.begin(), abi.end()), abi.end());
+    return abi;
+}
+
+std::string parse_gtest_version(std::string_view cmakelists) {
+    const size_t name = cmakelists.find("GOOGLETEST_VERSION");
+    if (name == std::string_view::npos) {
+        return {};
+    }
+    const size_t start = cmakelists.find_first_not_of(" \t", name + std::string_view("GOOGLETEST_VERSION").size());
+    const size_t end = cmakelists.find_first_of(" \t)\n", start);
+    if (start == std::string_view::npos || end == std::string_view::npos || start == end) {
+        return {};
+    }
+    const std::string version(cmakelists.substr(start, end - start));
+    return version.find_first_not_of("0123456789.") == std::string::npos ? version : std::string{};
+}
+
+GtestCache::GtestCache(fs::path root) : root_(std::move(root)) {}
+
+GtestCache::GtestCache() : GtestCache(default_cache_dir() / "gtest") {}
+
+std::string GtestCache::seed(const fs::path& source) {
+    if (!fs::exists(source)) {
+        throw std::runtime_error("No such file or directory: " + source.string());
+    }
+    fs::create_directories(root_ / "src");
+
+    // Unpack archives into a scratch directory first
+    fs::path tree = source;
+    fs::path unpacked;
+    if (fs::is_regular_file(source)) {
+        unpacked = scratch_dir(root_, "unpack");
+        fs::remove_all(unpacked);
+        fs::create_directories(unpacked);
+        const std::string archive = fs::absolute(source).string();
+        const process::Result result = source.extension() == ".zip"
+            ? process::run({"unzip", "-q", archive, "-d", unpacked.string()})
+            : process::run({"tar", "-xf", archive, "-C", unpacked.string()});
+        if (result.exit_code != 0) {
+            fs::remove_all(unpacked);
+            throw std::runtime_error("Cannot unpack " + source.string() + ":\n" + result.output);
+        }
+        tree = unpacked;
+    }
+
+    const auto googletest = locate_googletest(tree);
+    if (!googletest) {
+        if (!unpacked.empty()) {
+            fs::remove_all(unpacked);
+        }
+        throw std::runtime_error(source.string() + " does not contain googletest sources "
+                                 "(include/gtest/gtest.h and src/gtest-all.cc)");
+    }
+
+    // The version is set by the repository's top-level CMakeLists.txt;
+    // trees without one are told apart by the content of gtest.h
+    std::string version = parse_gtest_version(read_file(googletest->parent_path() / "CMakeLists.txt"));
+    if (version.empty()) {
+        version = parse_gtest_version(read_file(*googletest / "CMakeLists.txt"));
+    }
+    if (version.empty()) {
+        version = "src-" + hash::sha256_hex(read_file(*googletest / "include" / "gtest" / "gtest.h")).substr(0, 8);
+    }
+
+    const fs::path staging = scratch_dir(root_ / "src", "seed");
+    fs::remove_all(staging);
+    fs::create_directories(staging);
+    fs::copy(*googletest / "include", staging / "include", fs::copy_options::recursive);
+    fs::copy(*googletest / "src", staging / "src", fs::copy_options::recursive);
+    if (!unpacked.empty()) {
+        fs::remove_all(unpacked);
+    }
+
+    const fs::path destination = root_ / "src" / version;
+    FileLock lock(root_ / ".lock");
+    fs::remove_all(destination);
+    fs::rename(staging, destination);
+    return version;
+}
+
+std::string GtestCache::fetch(std::string_view repository, std::string_view tag) {
+    fs::create_directories(root_);
+    const fs::path checkout = scratch_dir(root_, "fetch");
+    fs::remove_all(checkout);
+    const process::Result clone = process::run({"git", "clone", "--quiet", "--depth", "1", "--branch",
+                                                std::string(tag), std::string(repository), checkout.string()});
+    if (clone.exit_code != 0) {
+        fs::remove_all(checkout);
+        throw std::runtime_error("git clone of " + std::string(repository) + " failed:\n" + clone.output);
+    }
+    try {
+        const std::string version = seed(checkout);
+        fs::remove_all(checkout);
+        return version;
+    } catch (...) {
+        fs::remove_all(checkout);
+        throw;
+    }
+}
+
+std::vector<std::string> GtestCache::source_versions() const {
+    std::vector<std::string> versions;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(root_ / "src", ec)) {
+        const std::string name = entry.path().filename().string();
+        if (name[0] != '.' && fs::is_regular_file(entry.path() / "src" / "gtest-all.cc")) {
+            versions.push_back(name);
+        }
+    }
+    std::sort(versions.begin(), versions.end(),
+              [](const std::string& a, const std::string& b) { return version_less(b, a); });
+    return versions;
+}
+
+std::string GtestCache::key(const std::string& compiler, const std::vector<std::string>& flags,
+                            const std::string& version) const {
+    const std::vector<std::string> abi = gtest_abi_flags(flags);
+    const process::Result identity = process::run({compiler, "--version"});
+    if (identity.exit_code != 0) {
+        throw std::runtime_error("Cannot run '" + compiler + " --version':\n" + identity.output);
+    }
+
+    // The standard library is identified by its own version macros, which
+    // also reflect -stdlib= and the dual-ABI setting
+    std::vector<std::string> probe = {compiler};
+    probe.insert(probe.end(), abi.begin(), abi.end());
+    probe.insert(probe.end(), {"-x", "c++", "-E", "-dM", "-include", "cstddef", "/dev/null"});
+    std::string library;
+    std::istringstream macros(process::run(probe).output);
+    std::string line;
+    while (std::getline(macros, line)) {
+        for (std::string_view name : {"__GLIBCXX__ ", "_GLIBCXX_RELEASE ", "_GLIBCXX_USE_CXX11_ABI ",
+                                      "_LIBCPP_VERSION ", "_LIBCPP_ABI_VERSION "}) {
+            if (line.find(std::string("#define ") + std::string(name)) == 0) {
+                library += line + '\n';
+            }
+        }
+    }
+
+    hash::Sha256 sha;
+    sha.update(KEY_VERSION);
+    sha.update("\0", 1);
+    sha.update(version);
+    sha.update("\0", 1);
+    sha.update(identity.output);
+    sha.update("\0", 1);
+    sha.update(library);
+    for (const auto& flag : abi) {
+        sha.update("\0", 1);
+        sha.update(flag);
+    }
+    return sha.hex_digest().substr(0, 16);
+}
+
+std::optional<GtestEntry> GtestCache::find(const std::string& compiler,
+                                           const std::vector<std::string>& flags) const {
+    std::vector<std::string> versions = source_versions();
+    if (versions.empty()) {
+        // Sources may have been deleted after building; use the newest entry's version
+        for (const auto& entry : entries()) {
+            versions.push_back(entry.version);
+        }
+        std::sort(versions.begin(), versions.end(),
+                  [](const std::string& a, const std::string& b) { return version_less(b, a); });
+    }
+    if (versions.empty()) {
+        return std::nullopt;
+    }
+    return read_entry(root_ / (versions.front() + "-" + key(compiler, flags, versions.front())));
+}
+
+GtestEntry GtestCache::ensure(const std::string& compiler, const std::vector<std::string>& flags) {
+    const std::vector<std::string> versions = source_versions();
+    if (versions.empty()) {
+        if (auto entry = find(compiler, flags)) {
+            return *entry;
+        }
+        throw std::runtime_error("No googletest sources in " + (root_ / "src").string() +
+                                 "; seed them with 'cppstarter gtest --seed <dir|tarball>' "
+                                 "or 'cppstarter gtest --fetch'");
+    }
+    const std::string& version = versions.front();
+    const std::string entry_key = key(compiler, flags, version);
+    const fs::path prefix = root_ / (version + "-" + entry_key);
+
+    FileLock lock(root_ / ".lock");
+    if (auto entry = read_entry(prefix)) {
+        return *entry;
+    }
+
+    const fs::path sources = root_ / "src" / version;
+    const fs::path staging = scratch_dir(root_, "build");
+    fs::remove_all(staging);
+    fs::create_directories(staging / "lib");
+    fs::create_directories(staging / "obj");
+
+    const std::vector<std::string> abi = gtest_abi_flags(flags);
+    auto compile = [&](const std::string& unit) {
+        std::vector<std::string> command = {compiler};
+        command.insert(command.end(), abi.begin(), abi.end());
+        command.insert(command.end(), {"-O2", "-I" + (sources / "include").string(), "-I" + sources.string(),
+                                       "-c", (sources / "src" / (unit + ".cc")).string(),
+                                       "-o", (staging / "obj" / (unit + ".o")).string()});
+        return process::run(command);
+    };
+    // gtest-all.cc dominates; gtest_main.cc compiles alongside it
+    process::Result main_result;
+    std::thread main_thread([&] { main_result = compile("gtest_main"); });
+    process::Result all_result = compile("gtest-all");
+    main_thread.join();
+
+    for (const auto* result : {&all_result, &main_result}) {
+        if (result->exit_code != 0) {
+            fs::remove_all(staging);
+            throw std::runtime_error("Building googletest " + version + " with " + compiler + " failed:\n" +
+                                     result->output);
+        }
+    }
+    for (const std::string unit : {"gtest", "gtest_main"}) {
+        const std::string object = unit == "gtest" ? "gtest-all" : "gtest_main";
+        const process::Result archive = process::run({"ar", "rcs", (staging / "lib" / ("lib" + unit + ".a")).string(),
+                                                      (staging / "obj" / (object + ".o")).string()});
+        if (archive.exit_code != 0) {
+            fs::remove_all(staging);
+            throw std::runtime_error("ar failed:\n" + archive.output);
+        }
+    }
+    fs::remove_all(staging / "obj");
+    fs::copy(sources / "include", staging / "include", fs::copy_options::recursive);
+
+    const process::Result identity = process::run({compiler, "--version"});
+    std::ofstream(staging / "entry.txt") << "key " << entry_key << '\n'
+                                          << "version " << version << '\n'
+                                          << "compiler " << first_line(identity.output) << '\n'
+                                          << "flags " << join_flags(abi) << '\n';
+    fs::rename(staging, prefix);
+
+    auto entry = read_entry(prefix);
+    if (!entry) {
+        throw std::runtime_error("googletest entry " + prefix.string() + " is incomplete");
+    }
+    return *entry;
+}
+
+std::vector<GtestEntry> GtestCache::entries() const {
+    std::vector<GtestEntry> found;
+    std::error_code ec;
+    for (const auto& directory : fs::directory_iterator(root_, ec)) {
+        const std::string name = directory.path().filename().string();
+        if (name[0] == '.' || name == "src") {
+            continue;
+        }
+        if (auto entry = read_entry(directory.path())) {
+            found.push_back(std::move(*entry));
+        }
+    }
+    std::sort(found.begin(), found.end(),
+              [](const GtestEntry& a, const GtestEntry& b) { return a.prefix < b.prefix; });
+    return found;
+}
+
+size_t GtestCache::clear() {
+    FileLock lock(root_ / ".lock");
+    const auto existing = entries();
+    for (const auto& entry : existing) {
+        fs::remove_all(entry.prefix);
+    }
+    return existing.size();
+}
+
+void link_gtest(const fs::path& prefix, const fs::path& link) {
+    std::error_code ec;
+    const fs::file_status status = fs::symlink_status(link, ec);
+    if (fs::is_symlink(status)) {
+        fs::remove(link);
+    } else if (fs::exists(status)) {
+        throw std::runtime_error(link.string() + " exists and is not a symlink; remove it first");
+    }
+    if (link.has_parent_path()) {
+        fs::create_directories(link.parent_path());
+    }
+    fs::create_directory_symlink(fs::absolute(prefix), link);
+}
+
+} // namespace build
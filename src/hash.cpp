@@ -0,0 +1,234 @@
+#include "utils/hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace hash {
+
+namespace {
+
+constexpr std::array<uint32_t, 64> K256 = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+inline uint32_t rotr(uint32_t x, int n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+} // namespace
+
+Sha256::Sha256()
+    : state_{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+             0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19} {}
+
+void Sha256::transform(const uint8_t* block) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; ++i) {
+        w[i] = (uint32_t(block[i * 4]) << 24) | (uint32_t(block[i * 4 + 1]) << 16) |
+               (uint32_t(block[i * 4 + 2]) << 8) | uint32_t(block[i * 4 + 3]);
+    }
+    for (int i = 16; i < 64; ++i) {
+        uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3];
+    uint32_t e = state_[4], f = state_[5], g = state_[6], h = state_[7];
+
+    for (int i = 0; i < 64; ++i) {
+        uint32_t s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+        uint32_t ch = (e & f) ^ (~e & g);
+        uint32_t temp1 = h + s1 + ch + K256[i] + w[i];
+        uint32_t s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+        uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t temp2 = s0 + maj;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+
+    state_[0] += a; state_[1] += b; state_[2] += c; state_[3] += d;
+    state_[4] += e; state_[5] += f; state_[6] += g; state_[7] += h;
+}
+
+void Sha256::update(const void* data, size_t length) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    total_length_ += length;
+
+    if (buffer_length_ > 0) {
+        size_t take = std::min(length, buffer_.size() - buffer_length_);
+        std::memcpy(buffer_.data() + buffer_length_, bytes, take);
+        buffer_length_ += take;
+        bytes += take;
+        length -= take;
+        if (buffer_length_ == buffer_.size()) {
+            transform(buffer_.data());
+            buffer_length_ = 0;
+        }
+    }
+
+    while (length >= 64) {
+        transform(bytes);
+        bytes += 64;
+        length -= 64;
+    }
+
+    if (length > 0) {
+        std::memcpy(buffer_.data(), bytes, length);
+        buffer_length_ = length;
+    }
+}
+
+std::array<uint8_t, 32> Sha256::digest() {
+    const uint64_t bit_length = total_length_ * 8;
+
+    const uint8_t pad_start = 0x80;
+    update(&pad_start, 1);
+    const uint8_t zero = 0;
+    while (buffer_length_ != 56) {
+        update(&zero, 1);
+    }
+    uint8_t length_bytes[8];
+    for (int i = 0; i < 8; ++i) {
+        length_bytes[i] = static_cast<uint8_t>(bit_length >> (56 - 8 * i));
+    }
+    update(length_bytes, 8);
+
+    std::array<uint8_t, 32> out{};
+    for (int i = 0; i < 8; ++i) {
+        out[i * 4] = static_cast<uint8_t>(state_[i] >> 24);
+        out[i * 4 + 1] = static_cast<uint8_t>(state_[i] >> 16);
+        out[i * 4 + 2] = static_cast<uint8_t>(state_[i] >> 8);
+        out[i * 4 + 3] = static_cast<uint8_t>(state_[i]);
+    }
+    return out;
+}
+
+std::string Sha256::hex_digest() {
+    auto bytes = digest();
+    return to_hex(bytes.data(), bytes.size());
+}
+
+Sha1::Sha1() : state_{0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0} {}
+
+void Sha1::transform(const uint8_t* block) {
+    uint32_t w[80];
+    for (int i = 0; i < 16; ++i) {
+        w[i] = (uint32_t(block[i * 4]) << 24) | (uint32_t(block[i * 4 + 1]) << 16) |
+               (uint32_t(block[i * 4 + 2]) << 8) | uint32_t(block[i * 4 + 3]);
+    }
+    for (int i = 16; i < 80; ++i) {
+        w[i] = rotr(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 31);
+    }
+
+    uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3], e = state_[4];
+    for (int i = 0; i < 80; ++i) {
+        uint32_t f, k;
+        if (i < 20) {
+            f = (b & c) | (~b & d);
+            k = 0x5a827999;
+        } else if (i < 40) {
+            f = b ^ c ^ d;
+            k = 0x6ed9eba1;
+        } else if (i < 60) {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8f1bbcdc;
+        } else {
+            f = b ^ c ^ d;
+            k = 0xca62c1d6;
+        }
+        const uint32_t temp = rotr(a, 27) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = rotr(b, 2);
+        b = a;
+        a = temp;
+    }
+
+    state_[0] += a; state_[1] += b; state_[2] += c; state_[3] += d; state_[4] += e;
+}
+
+void Sha1::update(const void* data, size_t length) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    total_length_ += length;
+
+    if (buffer_length_ > 0) {
+        size_t take = std::min(length, buffer_.size() - buffer_length_);
+        std::memcpy(buffer_.data() + buffer_length_, bytes, take);
+        buffer_length_ += take;
+        bytes += take;
+        length -= take;
+        if (buffer_length_ == buffer_.size()) {
+            transform(buffer_.data());
+            buffer_length_ = 0;
+        }
+    }
+
+    while (length >= 64) {
+        transform(bytes);
+        bytes += 64;
+        length -= 64;
+    }
+
+    if (length > 0) {
+        std::memcpy(buffer_.data(), bytes, length);
+        buffer_length_ = length;
+    }
+}
+
+std::array<uint8_t, 20> Sha1::digest() {
+    const uint64_t bit_length = total_length_ * 8;
+
+    const uint8_t pad_start = 0x80;
+    update(&pad_start, 1);
+    const uint8_t zero = 0;
+    while (buffer_length_ != 56) {
+        update(&zero, 1);
+    }
+    uint8_t length_bytes[8];
+    for (int i = 0; i < 8; ++i) {
+        length_bytes[i] = static_cast<uint8_t>(bit_length >> (56 - 8 * i));
+    }
+    update(length_bytes, 8);
+
+    std::array<uint8_t, 20> out{};
+    for (int i = 0; i < 5; ++i) {
+        out[i * 4] = static_cast<uint8_t>(state_[i] >> 24);
+        out[i * 4 + 1] = static_cast<uint8_t>(state_[i] >> 16);
+        out[i * 4 + 2] = static_cast<uint8_t>(state_[i] >> 8);
+        out[i * 4 + 3] = static_cast<uint8_t>(state_[i]);
+    }
+    return out;
+}
+
+std::string Sha1::hex_digest() {
+    auto bytes = digest();
+    return to_hex(bytes.data(), bytes.size());
+}
+
+std::string to_hex(const uint8_t* data, size_t length) {
+    static constexpr char digits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(length * 2);
+    for (size_t i = 0; i < length; ++i) {
+        hex += digits[data[i] >> 4];
+        hex += digits[data[i] & 0x0f];
+    }
+    return hex;
+}
+
+} // namespace hash
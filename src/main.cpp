@@ -3,12 +3,47 @@
 #include <filesystem>
 #include <string>
 #include <cstdlib>
+#include <stdexcept>
 #include <string_view>
 #include <array>
 #include <unordered_map>
 #include <functional>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <optional>
+#include <mutex>
+#include <cerrno>
+#include <cmath>
+#include <limits>
 
+#include "build/build_analysis.hpp"
+#include "build/build_engine.hpp"
+#include "build/compile_cache.hpp"
+#include "build/fast_link.hpp"
+#include "build/file_watcher.hpp"
+#include "build/flag_tuning.hpp"
+#include "build/gtest_cache.hpp"
+#include "build/pgo.hpp"
+#include "build/test_impact.hpp"
+#include "build/test_shards.hpp"
+#include "build/unity_build.hpp"
+#include "perf/counters.hpp"
+#include "perf/perfgate.hpp"
+#include "perf/profiler.hpp"
+#include "perf/valgrind_report.hpp"
+#include "scaffold/bench_files.hpp"
+#include "scaffold/git_repository.hpp"
+#include "scaffold/template_blob.hpp"
+#include "scaffold/template_pack.hpp"
 #include "utils/colors.hpp"
+#include "utils/process.hpp"
+#include "utils/project_config.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace fs = std::filesystem;
 
@@ -19,37 +54,93 @@ constexpr std::string_view VERSION = "v2.3.0";
 void show_help(std::string_view program_name);
 void show_version(std::string_view program_name);
 void create_project_handler(std::string_view program_name);
-void run_build();
-void run_debug();
-void run_release();
-void run_tests();
-void run_valgrind();
+using CommandArgs = std::vector<std::string_view>;
+
+void run_build(const CommandArgs& args);
+void run_cache(const CommandArgs& args);
+void run_gtest(const CommandArgs& args);
+void run_debug(const CommandArgs& args);
+void run_release(const CommandArgs& args);
+void run_tests(const CommandArgs& args);
+void run_watch(const CommandArgs& args);
+void run_bench(const CommandArgs& args);
+void run_perfgate(const CommandArgs& args);
+void run_tune(const CommandArgs& args);
+void run_profile(const CommandArgs& args);
+void run_valgrind(const CommandArgs& args);
 void create_min_sh();
+void list_templates();
+void create_projects_from_manifest(const CommandArgs& args);
 
-// Command handler type
-using CommandHandler = std::function<void()>;
+// Command handler type; receives the arguments that follow the command name
+using CommandHandler = std::function<void(const CommandArgs&)>;
 
 // Command registry using unordered_map for O(1) lookup
 const std::unordered_map<std::string_view, CommandHandler> commands = {
-    {"--help", []() { show_help(PROGRAM_NAME); }},
-    {"--version", []() { show_version(PROGRAM_NAME); }},
+    {"--help", [](const CommandArgs&) { show_help(PROGRAM_NAME); }},
+    {"--version", [](const CommandArgs&) { show_version(PROGRAM_NAME); }},
     {"build", run_build},
+    {"cache", run_cache},
+    {"gtest", run_gtest},
     {"run", run_debug},
     {"run-release", run_release},
     {"test", run_tests},
+    {"watch", run_watch},
+    {"bench", run_bench},
+    {"perfgate", run_perfgate},
+    {"tune", run_tune},
+    {"profile", run_profile},
     {"valgrind", run_valgrind},
-    {"min", create_min_sh}
+    {"templates", [](const CommandArgs&) { list_templates(); }},
+    {"min", [](const CommandArgs&) { create_min_sh(); }}
 };
 
 void show_help(std::string_view program_name) {
     std::cout << colors::GREEN
               << "Usage:\n"
               << "  " << program_name << " new <ProjectName> [--init-git]    Create a new C++ project\n"
-              << "  " << program_name << " build                             Compile debug build\n"
-              << "  " << program_name << " run                               Run debug build\n"
+              << "  " << std::string(program_name.size(), ' ') << "     [--pch]                       Enable the precompiled header\n"
+              << "  " << std::string(program_name.size(), ' ') << "     [--template <id>]             Start from a bundled template\n"
+              << "  " << program_name << " new --from-manifest <file> [-j N] Create every project listed in a manifest\n"
+              << "  " << program_name << " templates                         List the bundled templates\n"
+              << "  " << program_name << " build [--release|--test] [-j N]   Incremental parallel build\n"
+              << "  " << std::string(program_name.size(), ' ') << "       [--no-cache]                Skip the shared object cache\n"
+              << "  " << std::string(program_name.size(), ' ') << "       [--pch|--no-pch]            Override the project's PCH setting\n"
+              << "  " << std::string(program_name.size(), ' ') << "       [--unity[=N]]               Merge sources into N unity batches\n"
+              << "  " << std::string(program_name.size(), ' ') << "       [--fast-link] [--shared]    mold/lld/gold, split DWARF, shared project lib\n"
+              << "  " << std::string(program_name.size(), ' ') << "       [--linker L] [--link-report[=N]]  Pick the linker; time every linker\n"
+              << "  " << std::string(program_name.size(), ' ') << "       [--analyze[=N]]             Per-TU/header cost report, trace, history\n"
+              << "  " << std::string(program_name.size(), ' ') << "       [--profile <name>]          Release flags written by 'tune'\n"
+              << "  " << program_name << " cache [--clear|--max-size <size>] Show or manage the object cache\n"
+              << "  " << program_name << " gtest [--seed <dir|tarball>]      Show or seed the prebuilt googletest cache\n"
+              << "  " << std::string(program_name.size(), ' ') << "       [--link <dir>|--prefix]     Build if needed; link or print the entry\n"
+              << "  " << std::string(program_name.size(), ' ') << "       [--fetch] [--cxx C] [-- flags]  Clone when nothing is seeded; key inputs\n"
+              << "  " << std::string(program_name.size(), ' ') << "       [--clear]                   Remove prebuilt entries, keep sources\n"
+              << "  " << program_name << " run [--counters] [-- args]        Run debug build\n"
               << "  " << program_name << " run-release                       Run release build\n"
+              << "  " << std::string(program_name.size(), ' ') << "             [--counters]          Report cycles, IPC, cache/branch misses\n"
+              << "  " << std::string(program_name.size(), ' ') << "             [--pgo] [--lto]       Profile-guided build (see README)\n"
+              << "  " << std::string(program_name.size(), ' ') << "             [--train <cmd>]       Training workload, repeatable\n"
+              << "  " << std::string(program_name.size(), ' ') << "             [-- args]             Arguments for the program\n"
               << "  " << program_name << " test                              Compile and run tests\n"
+              << "  " << program_name << " test -j N [--slowest N] [-- args] Run gtest shards in N parallel processes\n"
+              << "  " << std::string(program_name.size(), ' ') << "      [--changed [ref]]           Only tests affected by changes since ref\n"
+              << "  " << program_name << " watch [build|test|run] [-j N]     Rebuild (and rerun) on every save\n"
+              << "  " << std::string(program_name.size(), ' ') << "       [--debounce ms] [-- args]   Quiet period before a rebuild; program args\n"
+              << "  " << program_name << " bench [-j N] [bench options]      Build (release flags) and run benchmarks\n"
+              << "  " << program_name << " perfgate --save-baseline <name>  Time commands (default: release binary)\n"
+              << "  " << std::string(program_name.size(), ' ') << "          --compare <name>        Fail if slower than the baseline\n"
+              << "  " << std::string(program_name.size(), ' ') << "          [--runs N] [--threshold %] [-- cmd args [-- cmd2 ...]]\n"
+              << "  " << program_name << " tune [--runs N] [--cxx a,b]       Benchmark release flag combinations, save the winner\n"
+              << "  " << std::string(program_name.size(), ' ') << "      [--flags \"...\"] [--profile <name>]  Extra variant; profile to write (tuned)\n"
+              << "  " << std::string(program_name.size(), ' ') << "      [--bench|--run|--command <sh>] [-- args]  Workload ({bin} = binary)\n"
+              << "  " << program_name << " profile [--release] [-- args]     Sample the program, write a flame graph\n"
+              << "  " << std::string(program_name.size(), ' ') << "         [--top N] [-F hz]          Hot-function rows, sampling rate\n"
+              << "  " << std::string(program_name.size(), ' ') << "         [--builtin]                Skip perf, use the SIGPROF sampler\n"
               << "  " << program_name << " valgrind                          Run debug application with valgrind\n"
+              << "  " << std::string(program_name.size(), ' ') << "          [--cache|--calls]       Cachegrind/callgrind hotspot report\n"
+              << "  " << std::string(program_name.size(), ' ') << "          [--release] [--diff] [--sort EV] [--top N] [-- args]\n"
+              << "  " << program_name << " valgrind --diff <old> <new>       Compare two cachegrind/callgrind outputs\n"
               << "  " << program_name << " min                               Creates a minimal prompt script (min.sh)\n"
               << "  " << program_name << " --help                            Show this help message\n"
               << "  " << program_name << " --version                         Show version\n"
@@ -75,253 +166,2001 @@ bool execute_system_command(const std::string& command, const std::string& descr
     return true;
 }
 
-void run_build() {
-    execute_system_command("make", "Compiling debug build...");
+unsigned parse_job_count(std::string_view value) {
+    try {
+        int jobs = std::stoi(std::string(value));
+        if (jobs > 0) {
+            return static_cast<unsigned>(jobs);
+        }
+    } catch (const std::exception&) {
+    }
+    throw std::runtime_error("Invalid job count '" + std::string(value) + "'");
+}
+
+// Whole, non-negative count for options like --warmup
+unsigned parse_count(std::string_view option, std::string_view value) {
+    const std::string text(value);
+    char* end = nullptr;
+    errno = 0;
+    const long count = std::strtol(text.c_str(), &end, 10);
+    if (text.empty() || *end != '\0' || errno != 0 || count < 0 || count > std::numeric_limits<int>::max()) {
+        throw std::runtime_error("Invalid value '" + text + "' for " + std::string(option) +
+                                 " (expected a whole number >= 0)");
+    }
+    return static_cast<unsigned>(count);
 }
 
-void run_debug() {
-    execute_system_command("make run", "Running debug build...");
+// Non-negative percentage ("5" or "5%") as a fraction, for --threshold
+double parse_percentage(std::string_view option, std::string_view value) {
+    std::string text(value);
+    if (!text.empty() && text.back() == '%') {
+        text.pop_back();
+    }
+    char* end = nullptr;
+    errno = 0;
+    const double percent = std::strtod(text.c_str(), &end);
+    if (text.empty() || *end != '\0' || errno != 0 || !std::isfinite(percent) || percent < 0.0) {
+        throw std::runtime_error("Invalid value '" + std::string(value) + "' for " + std::string(option) +
+                                 " (expected a percentage >= 0)");
+    }
+    return percent / 100.0;
 }
 
-void run_release() {
-    execute_system_command("make run-release", "Running release build...");
+// Fast-link profile for debug and test builds, from cppstarter.conf
+// (fast_link, linker, fast_link_shared) unless the command line overrides it
+struct LinkProfile {
+    bool enabled = false;
+    build::FastLinkOptions options;
+};
+
+LinkProfile load_link_profile(const config::ProjectConfig& project) {
+    LinkProfile profile;
+    profile.enabled = project.get_bool("fast_link", false);
+    profile.options.linker = project.get("linker", "auto");
+    profile.options.shared = project.get_bool("fast_link_shared", false);
+    return profile;
 }
 
-void run_tests() {
-    execute_system_command("make test", "Running tests...");
+// Returns the linker in use, or nullopt when the profile does not apply
+std::optional<build::Linker> apply_link_profile(build::BuildConfig& config, const LinkProfile& profile) {
+    if (!profile.enabled || (config.name != "debug" && config.name != "test")) {
+        return std::nullopt;
+    }
+    const build::Linker linker = build::select_linker(build::detect_linkers(config.compiler), profile.options.linker);
+    build::apply_fast_link(config, linker, profile.options);
+    return linker;
 }
 
-void run_valgrind() {
-    execute_system_command("make valgrind", "Running with valgrind...");
+// The compile cache is on unless CPPSTARTER_NO_CACHE=1
+bool compile_cache_enabled() {
+    const char* no_cache = std::getenv("CPPSTARTER_NO_CACHE");
+    return !(no_cache && std::string_view(no_cache) == "1");
 }
 
-void create_file(const fs::path& path, std::string_view content) {
-    try {
-        std::ofstream file(path);
-        if (!file) {
-            throw std::runtime_error("Could not create file: " + path.string());
+// cppstarter.conf settings that shape an engine build. Every command builds
+// through project_build_config() so that they all write the same flags
+// signature into the shared build/<name>/ trees; one that left a setting out
+// would make the next 'build' recompile everything.
+struct BuildSettings {
+    bool pch = false;
+    bool unity = false;
+    build::UnityOptions unity_options;
+    LinkProfile link_profile;
+    std::string release_profile;    // profiles/<name>.mk for release and bench builds; empty keeps -O2
+};
+
+BuildSettings load_build_settings(const config::ProjectConfig& project) {
+    BuildSettings settings;
+    settings.pch = project.get_bool("pch", false);
+    settings.unity = project.get_bool("unity", false);
+    settings.unity_options.batches = static_cast<unsigned>(std::max(0, project.get_int("unity_batches", 0)));
+    settings.unity_options.exclude = project.get_list("unity_exclude");
+    settings.link_profile = load_link_profile(project);
+    settings.release_profile = project.get("release_profile");
+    return settings;
+}
+
+// make_config() plus `settings`. With `announce`, prints the release profile
+// and the fast-link setup in use. Throws when the release profile is missing.
+build::BuildConfig project_build_config(build::Configuration configuration, const BuildSettings& settings,
+                                        bool announce = false) {
+    build::BuildConfig config = build::make_config(configuration);
+    config.precompiled_header = settings.pch;
+    if (settings.unity) {
+        build::apply_unity_build(config, settings.unity_options);
+    }
+    if (!settings.release_profile.empty() &&
+        (configuration == build::Configuration::Release || configuration == build::Configuration::Bench)) {
+        const build::ReleaseProfile profile = build::load_release_profile(settings.release_profile);
+        build::apply_release_profile(config, profile);
+        if (announce) {
+            std::cout << colors::CYAN << "Release profile '" << profile.name << "': " << config.compiler;
+            for (const auto& flag : profile.flags) {
+                std::cout << ' ' << flag;
+            }
+            std::cout << colors::RESET << '\n';
         }
-        file << content;
-        file.close();
-    } catch (const std::exception& e) {
-        std::cout << colors::RED
-                  << "Error creating file " << path << ": " << e.what()
+    }
+    const auto linker = apply_link_profile(config, settings.link_profile);
+    if (linker && announce) {
+        std::cout << colors::CYAN << "Fast link: " << linker->name
+                  << (linker->gdb_index ? " with --gdb-index" : "") << ", split DWARF"
+                  << (config.shared_library.empty() ? "" : ", project code in " + config.shared_library.string())
                   << colors::RESET << '\n';
     }
+    return config;
 }
 
-bool create_directory(const fs::path& path) {
-    std::error_code ec;
-    if (!fs::create_directories(path, ec) && ec) {
-        std::cout << colors::YELLOW
-                  << "Warning: Could not create directory " << path << ": " << ec.message()
+// Time the link steps of `engine`'s last build with every installed linker
+void print_link_report(const build::BuildEngine& engine, unsigned runs) {
+    std::vector<std::vector<std::string>> commands;
+    if (!engine.config().shared_library.empty()) {
+        commands.push_back(engine.library_link_command());
+    }
+    commands.push_back(engine.link_command());
+    const auto linkers = build::detect_linkers(engine.config().compiler);
+    std::cout << colors::CYAN << "Relinking " << engine.config().name << " with " << linkers.size()
+              << " linkers, " << runs << " runs each..." << colors::RESET << '\n';
+    const auto timings = build::compare_linkers(commands, linkers,
+                                                engine.config().obj_dir.parent_path() / "link-report", runs);
+
+    double baseline = 0.0;
+    for (const auto& timing : timings) {
+        if (timing.linker == "default" && timing.error.empty()) {
+            baseline = timing.seconds;
+        }
+    }
+    std::cout << colors::BOLD << std::left << std::setw(10) << "Linker" << std::right << std::setw(12) << "Link"
+              << std::setw(14) << "Output" << std::setw(12) << "vs default" << "  Version" << colors::RESET << '\n';
+    for (size_t i = 0; i < timings.size(); ++i) {
+        const auto& timing = timings[i];
+        std::cout << std::left << std::setw(10) << timing.linker << std::right;
+        if (!timing.error.empty()) {
+            std::cout << colors::RED << "  failed: " << timing.error.substr(0, timing.error.find('\n'))
+                      << colors::RESET << '\n';
+            continue;
+        }
+        std::ostringstream speedup;
+        if (baseline > 0.0 && timing.seconds > 0.0) {
+            speedup << std::fixed << std::setprecision(2) << baseline / timing.seconds << 'x';
+        }
+        std::cout << std::setw(9) << static_cast<long>(timing.seconds * 1000) << " ms"
+                  << std::setw(14) << build::format_size(timing.bytes) << std::setw(12) << speedup.str()
+                  << "  " << linkers[i].version << '\n';
+    }
+}
+
+std::string format_ms(double seconds) {
+    return std::to_string(static_cast<long>(seconds * 1000)) + " ms";
+}
+
+// Slowest translation units, most expensive headers, the Chrome trace and
+// the build history trend of a `build --analyze` run
+void print_build_analysis(const build::BuildAnalysis& analysis, const build::BuildConfig& config,
+                          const build::BuildResult& result, unsigned rows) {
+    std::vector<build::UnitAnalysis> units = analysis.units;
+    std::sort(units.begin(), units.end(), [](const auto& a, const auto& b) { return a.seconds > b.seconds; });
+    std::cout << '\n' << colors::BOLD << "Slowest translation units" << colors::RESET << '\n'
+              << colors::BOLD << std::right << std::setw(10) << "Wall" << std::setw(11) << "Frontend"
+              << std::setw(11) << "Backend" << std::setw(11) << "Peak RSS" << std::setw(9) << "Headers"
+              << "  Source" << colors::RESET << '\n';
+    for (size_t i = 0; i < units.size() && i < rows; ++i) {
+        const auto& unit = units[i];
+        std::cout << std::setw(10) << format_ms(unit.seconds) << std::setw(11) << format_ms(unit.frontend_seconds)
+                  << std::setw(11) << format_ms(unit.backend_seconds)
+                  << std::setw(11) << build::format_size(static_cast<uint64_t>(unit.max_rss_kb) * 1024)
+                  << std::setw(9) << unit.includes.size() << "  " << unit.source.string() << '\n';
+    }
+
+    const auto headers = build::rank_headers(analysis.units);
+    std::cout << '\n' << colors::BOLD << "Most expensive headers"
+              << (analysis.clang ? " (-ftime-trace)" : " (estimated from -H and -ftime-report)")
+              << colors::RESET << '\n'
+              << colors::BOLD << std::setw(10) << "Total" << std::setw(10) << "Average" << std::setw(7) << "TUs"
+              << "  Header" << colors::RESET << '\n';
+    for (size_t i = 0; i < headers.size() && i < rows; ++i) {
+        const auto& header = headers[i];
+        std::cout << std::setw(10) << format_ms(header.seconds)
+                  << std::setw(10) << format_ms(header.seconds / static_cast<double>(header.inclusions))
+                  << std::setw(7) << header.units << "  " << header.header << '\n';
+    }
+
+    const fs::path trace_path = config.obj_dir.parent_path() / "analyze" / "trace.json";
+    fs::create_directories(trace_path.parent_path());
+    std::ofstream(trace_path) << build::chrome_trace(analysis.units);
+    std::cout << '\n' << colors::GREEN << "Chrome trace: " << trace_path.string()
+              << " (open in chrome://tracing or ui.perfetto.dev)" << colors::RESET << '\n';
+
+    // The trend: this build against the last few analysed builds of the same configuration
+    const fs::path history_path = build::build_history_path();
+    build::BuildRecord record = build::summarize_build(analysis, config.name, result.seconds);
+    record.commit = build::current_commit();
+    build::append_build_history(history_path, record);
+    std::vector<build::BuildRecord> history;
+    for (auto& entry : build::load_build_history(history_path)) {
+        if (entry.configuration == config.name) {
+            history.push_back(std::move(entry));
+        }
+    }
+    const size_t first = history.size() > 5 ? history.size() - 5 : 0;
+    std::cout << '\n' << colors::BOLD << "History (" << history_path.string() << ")" << colors::RESET << '\n'
+              << colors::BOLD << std::left << std::setw(18) << "When" << std::setw(12) << "Commit" << std::right
+              << std::setw(6) << "TUs" << std::setw(10) << "Wall" << std::setw(11) << "Compile"
+              << std::setw(9) << "Change" << std::setw(11) << "Peak RSS" << colors::RESET << '\n';
+    for (size_t i = first; i < history.size(); ++i) {
+        const auto& entry = history[i];
+        const std::time_t time = static_cast<std::time_t>(entry.timestamp);
+        std::ostringstream when;
+        when << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M");
+        std::ostringstream change;
+        if (i > 0 && history[i - 1].cpu_seconds > 0.0) {
+            change << std::showpos << std::fixed << std::setprecision(1)
+                   << (entry.cpu_seconds / history[i - 1].cpu_seconds - 1.0) * 100.0 << '%';
+        }
+        std::cout << std::left << std::setw(18) << when.str()
+                  << std::setw(12) << entry.commit << std::right << std::setw(6) << entry.units
+                  << std::setw(10) << format_ms(entry.wall_seconds) << std::setw(11) << format_ms(entry.cpu_seconds)
+                  << std::setw(9) << change.str()
+                  << std::setw(11) << build::format_size(static_cast<uint64_t>(entry.peak_rss_kb) * 1024) << '\n';
+    }
+}
+
+void run_build(const CommandArgs& args) {
+    build::Configuration configuration = build::Configuration::Debug;
+    build::BuildOptions options;
+    bool use_cache = compile_cache_enabled();
+    const config::ProjectConfig project = config::ProjectConfig::load();
+    BuildSettings settings = load_build_settings(project);
+    unsigned link_report_runs = 0;
+    unsigned analyze_rows = 0;
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        if (arg == "--release") {
+            configuration = build::Configuration::Release;
+        } else if (arg == "--test") {
+            configuration = build::Configuration::Test;
+        } else if (arg == "-j" && i + 1 < args.size()) {
+            options.jobs = parse_job_count(args[++i]);
+        } else if (arg.substr(0, 2) == "-j" && arg.size() > 2) {
+            options.jobs = parse_job_count(arg.substr(2));
+        } else if (arg == "--verbose" || arg == "-v") {
+            options.verbose = true;
+        } else if (arg == "--no-cache") {
+            use_cache = false;
+        } else if (arg == "--pch") {
+            settings.pch = true;
+        } else if (arg == "--no-pch") {
+            settings.pch = false;
+        } else if (arg == "--unity") {
+            settings.unity = true;
+        } else if (arg.substr(0, 8) == "--unity=") {
+            settings.unity = true;
+            settings.unity_options.batches = parse_job_count(arg.substr(8));
+        } else if (arg == "--no-unity") {
+            settings.unity = false;
+        } else if (arg == "--fast-link") {
+            settings.link_profile.enabled = true;
+        } else if (arg == "--no-fast-link") {
+            settings.link_profile.enabled = false;
+        } else if (arg == "--shared") {
+            settings.link_profile.enabled = true;
+            settings.link_profile.options.shared = true;
+        } else if (arg == "--linker" && i + 1 < args.size()) {
+            settings.link_profile.enabled = true;
+            settings.link_profile.options.linker = args[++i];
+        } else if (arg == "--link-report") {
+            link_report_runs = 3;
+        } else if (arg.substr(0, 14) == "--link-report=") {
+            link_report_runs = parse_job_count(arg.substr(14));
+        } else if (arg == "--profile" && i + 1 < args.size()) {
+            settings.release_profile = args[++i];
+        } else if (arg == "--analyze") {
+            analyze_rows = 10;
+        } else if (arg.substr(0, 10) == "--analyze=") {
+            analyze_rows = parse_job_count(arg.substr(10));
+        } else {
+            throw std::runtime_error("Unknown build option '" + std::string(arg) + "'");
+        }
+    }
+
+    if (!fs::is_directory("src")) {
+        throw std::runtime_error("No src/ directory found; run this inside a project created with 'new'");
+    }
+
+    build::CompileCache cache;
+    if (use_cache) {
+        options.cache = &cache;
+    }
+
+    build::BuildConfig config = project_build_config(configuration, settings, /*announce=*/true);
+
+    build::BuildAnalysis analysis;
+    if (analyze_rows > 0) {
+        analysis.clang = build::compiler_is_clang(config.compiler);
+        options.analysis = &analysis;
+    }
+
+    build::BuildEngine engine(std::move(config));
+    std::cout << colors::CYAN << "Compiling " << engine.config().name << " build..." << colors::RESET << '\n';
+
+    build::BuildResult result = engine.build(options);
+    if (use_cache) {
+        cache.flush();
+    }
+    if (!result.success) {
+        throw std::runtime_error(engine.config().name + " build failed");
+    }
+
+    std::cout << colors::GREEN
+              << "Build complete: " << engine.config().binary.string()
+              << " (" << result.compiled << " compiled, " << result.cache_hits << " from cache, "
+              << result.up_to_date << " up to date, "
+              << static_cast<int>(result.seconds * 1000) << " ms";
+    if (result.linked) {
+        std::cout << ", link " << static_cast<int>(result.link_seconds * 1000) << " ms";
+    }
+    std::cout << ")" << colors::RESET << '\n';
+
+    if (analyze_rows > 0) {
+        print_build_analysis(analysis, engine.config(), result, analyze_rows);
+    }
+    if (link_report_runs > 0) {
+        print_link_report(engine, link_report_runs);
+    }
+}
+
+void run_cache(const CommandArgs& args) {
+    build::CompileCache cache;
+    std::string_view action = args.empty() ? "--stats" : args[0];
+
+    if (action == "--clear") {
+        cache.clear();
+        std::cout << colors::GREEN << "Cache cleared: " << cache.root().string() << colors::RESET << '\n';
+        return;
+    }
+    if (action == "--zero-stats") {
+        cache.zero_stats();
+        std::cout << colors::GREEN << "Cache statistics reset" << colors::RESET << '\n';
+        return;
+    }
+    if (action == "--max-size") {
+        if (args.size() < 2) {
+            throw std::runtime_error("--max-size requires a size such as 500M or 10G");
+        }
+        cache.set_max_size(build::parse_size(args[1]));
+        size_t evicted = cache.cleanup();
+        std::cout << colors::GREEN << "Cache size limit set to " << build::format_size(cache.max_size())
+                  << " (" << evicted << " objects evicted)" << colors::RESET << '\n';
+        return;
+    }
+    if (action == "--cleanup") {
+        size_t evicted = cache.cleanup();
+        std::cout << colors::GREEN << evicted << " objects evicted" << colors::RESET << '\n';
+        return;
+    }
+    if (action != "--stats") {
+        throw std::runtime_error("Unknown cache option '" + std::string(action) + "'");
+    }
+
+    build::CacheStats stats = cache.stats();
+    const uint64_t lookups = stats.hits + stats.misses;
+    std::cout << colors::CYAN << "Cache directory: " << colors::RESET << cache.root().string() << '\n'
+              << colors::CYAN << "Hits:            " << colors::RESET << stats.hits;
+    if (lookups > 0) {
+        std::cout << " (" << (stats.hits * 100 / lookups) << "%)";
+    }
+    std::cout << '\n'
+              << colors::CYAN << "Misses:          " << colors::RESET << stats.misses << '\n'
+              << colors::CYAN << "Objects:         " << colors::RESET << stats.files << '\n'
+              << colors::CYAN << "Size:            " << colors::RESET << build::format_size(stats.size_bytes)
+              << " / " << build::format_size(cache.max_size()) << '\n';
+}
+
+// Per-user googletest archives: seed sources, build entries, link projects
+void run_gtest(const CommandArgs& args) {
+    build::GtestCache cache;
+    std::string action;
+    std::string argument;
+    std::string compiler = "g++";
+    std::vector<std::string> flags;
+    bool fetch = false;
+    for (size_t i = 0; i < args.size(); ++i) {
+        const std::string_view arg = args[i];
+        if (arg == "--seed" || arg == "--link") {
+            if (i + 1 >= args.size()) {
+                throw std::runtime_error(std::string(arg) + " requires a path");
+            }
+            action = arg;
+            argument = args[++i];
+        } else if (arg == "--prefix" || arg == "--clear") {
+            action = arg;
+        } else if (arg == "--fetch") {
+            fetch = true;
+        } else if (arg == "--cxx") {
+            if (i + 1 >= args.size()) {
+                throw std::runtime_error("--cxx requires a compiler");
+            }
+            compiler = args[++i];
+        } else if (arg == "--") {
+            // Compiler flags; only the ABI-relevant ones select the entry
+            for (++i; i < args.size(); ++i) {
+                std::istringstream words{std::string(args[i])};
+                std::string word;
+                while (words >> word) {
+                    flags.push_back(word);
+                }
+            }
+        } else {
+            throw std::runtime_error("Unknown gtest option '" + std::string(arg) + "'");
+        }
+    }
+    if (flags.empty()) {
+        flags = {"-std=c++17", "-pthread"};   // What projects created by 'new' use
+    }
+
+    if (action == "--seed") {
+        const std::string version = cache.seed(argument);
+        std::cout << colors::GREEN << "Seeded googletest " << version << " into "
+                  << (cache.root() / "src" / version).string() << colors::RESET << '\n';
+        return;
+    }
+    if (action == "--clear") {
+        const size_t removed = cache.clear();
+        std::cout << colors::GREEN << removed << " prebuilt googletest entries removed" << colors::RESET << '\n';
+        return;
+    }
+    if (action == "--link" || action == "--prefix") {
+        if (fetch && cache.source_versions().empty() && !cache.find(compiler, flags)) {
+            std::cout << colors::CYAN << "Fetching googletest " << build::GTEST_TAG << "..." << colors::RESET << '\n';
+            cache.fetch();
+        }
+        std::optional<build::GtestEntry> entry = cache.find(compiler, flags);
+        if (!entry) {
+            std::cout << colors::CYAN << "Building googletest for " << compiler << ' '
+                      << process::join_command(build::gtest_abi_flags(flags)) << " (once per compiler and flags)..."
+                      << colors::RESET << std::endl;
+            const auto start = std::chrono::steady_clock::now();
+            entry = cache.ensure(compiler, flags);
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            std::cout << colors::GREEN << "Built " << entry->prefix.string() << " in " << std::fixed
+                      << std::setprecision(1) << elapsed.count() << "s" << colors::RESET << '\n';
+        }
+        if (action == "--prefix") {
+            std::cout << entry->prefix.string() << '\n';
+        } else {
+            build::link_gtest(entry->prefix, argument);
+            std::cout << colors::GREEN << argument << " -> " << entry->prefix.string() << colors::RESET << '\n';
+        }
+        return;
+    }
+    if (fetch) {
+        const std::string version = cache.fetch();
+        std::cout << colors::GREEN << "Fetched googletest " << version << colors::RESET << '\n';
+        return;
+    }
+
+    std::cout << colors::CYAN << "googletest cache: " << colors::RESET << cache.root().string() << '\n';
+    const auto versions = cache.source_versions();
+    std::cout << colors::CYAN << "Sources:          " << colors::RESET;
+    if (versions.empty()) {
+        std::cout << "none (seed with --seed <dir|tarball>, or --fetch)";
+    }
+    for (size_t i = 0; i < versions.size(); ++i) {
+        std::cout << (i == 0 ? "" : ", ") << versions[i];
+    }
+    std::cout << '\n';
+    const auto entries = cache.entries();
+    if (entries.empty()) {
+        std::cout << colors::CYAN << "Prebuilt:         " << colors::RESET << "none" << '\n';
+        return;
+    }
+    std::cout << colors::BOLD << std::left << std::setw(18) << "Key" << std::setw(10) << "Version"
+              << std::setw(24) << "Flags" << "Compiler" << colors::RESET << '\n';
+    for (const auto& entry : entries) {
+        std::cout << std::left << std::setw(18) << entry.key << std::setw(10) << entry.version
+                  << std::setw(24) << entry.flags << entry.compiler << '\n';
+    }
+}
+
+// Build with `engine` (and the object cache) and return the binary path
+fs::path build_configuration(build::BuildEngine& engine, build::BuildOptions options) {
+    build::CompileCache cache;
+    const bool use_cache = compile_cache_enabled();
+    if (use_cache) {
+        options.cache = &cache;
+    }
+    std::cout << colors::CYAN << "Compiling " << engine.config().name << " build..." << colors::RESET << '\n';
+    const bool built = engine.build(options).success;
+    if (use_cache) {
+        cache.flush();
+    }
+    if (!built) {
+        throw std::runtime_error(engine.config().name + " build failed");
+    }
+    return engine.config().binary;
+}
+
+// Build `configuration` with the engine and return the binary path
+fs::path build_configuration(build::Configuration configuration, build::BuildOptions options) {
+    if (!fs::is_directory("src")) {
+        throw std::runtime_error("No src/ directory found; run this inside a project created with 'new'");
+    }
+    build::BuildEngine engine(project_build_config(configuration,
+                                                   load_build_settings(config::ProjectConfig::load())));
+    return build_configuration(engine, options);
+}
+
+// Run a program with hardware counters that also cover its children, then print them
+void run_with_counters(const std::vector<std::string>& command) {
+    perf::PerfCounters counters(/*inherit=*/true);
+    if (!counters.hardware_available()) {
+        std::cout << colors::YELLOW << "Hardware counters unavailable: " << counters.unavailable_reason()
+                  << "; reporting wall time only" << colors::RESET << '\n';
+    }
+    process::Options run_options;
+    run_options.capture_output = false;
+    counters.start();
+    const process::Result result = process::run(command, run_options);
+    const perf::CounterSample sample = counters.stop();
+
+    std::cout << colors::CYAN << "Counters: " << colors::RESET << perf::format_counters(sample) << '\n';
+    if (result.exit_code != 0) {
+        throw std::runtime_error("Program exited with code " + std::to_string(result.exit_code));
+    }
+}
+
+void run_debug(const CommandArgs& args) {
+    bool counters = false;
+    build::BuildOptions options;
+    std::vector<std::string> command;
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        if (arg == "--") {
+            command.assign(args.begin() + static_cast<std::ptrdiff_t>(i) + 1, args.end());
+            break;
+        } else if (arg == "--counters") {
+            counters = true;
+        } else if (arg == "-j" && i + 1 < args.size()) {
+            options.jobs = parse_job_count(args[++i]);
+        } else if (arg.substr(0, 2) == "-j" && arg.size() > 2) {
+            options.jobs = parse_job_count(arg.substr(2));
+        } else {
+            throw std::runtime_error("Unknown run option '" + std::string(arg) + "'");
+        }
+    }
+
+    if (!counters) {
+        if (!args.empty()) {
+            throw std::runtime_error("run options require --counters; without it, 'run' uses 'make run'");
+        }
+        execute_system_command("make run", "Running debug build...");
+        return;
+    }
+    command.insert(command.begin(), "./" + build_configuration(build::Configuration::Debug, options).string());
+    std::cout << colors::GREEN << "Running debug build..." << colors::RESET << '\n';
+    run_with_counters(command);
+}
+
+void run_release(const CommandArgs& args) {
+    const config::ProjectConfig project = config::ProjectConfig::load();
+    build::PgoOptions options;
+    options.lto = project.get_bool("pgo_lto", false);
+    options.timing_runs = static_cast<unsigned>(std::max(0, project.get_int("pgo_timing_runs", 3)));
+    bool pgo = false;
+    bool counters = false;
+    bool train_from_args = false;
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        if (arg == "--") {
+            options.run_args.assign(args.begin() + i + 1, args.end());
+            break;
+        } else if (arg == "--pgo") {
+            pgo = true;
+        } else if (arg == "--counters") {
+            counters = true;
+        } else if (arg == "--lto") {
+            options.lto = true;
+        } else if (arg == "--train" && i + 1 < args.size()) {
+            options.training.emplace_back(args[++i]);
+            train_from_args = true;
+        } else if (arg == "--pgo-reset") {
+            options.reset = true;
+        } else if (arg == "--runs" && i + 1 < args.size()) {
+            std::string_view runs = args[++i];
+            if (runs.empty() || runs.find_first_not_of("0123456789") != std::string_view::npos) {
+                throw std::runtime_error("Invalid run count '" + std::string(runs) + "'");
+            }
+            options.timing_runs = static_cast<unsigned>(std::stoul(std::string(runs)));
+        } else if (arg == "-j" && i + 1 < args.size()) {
+            options.build.jobs = parse_job_count(args[++i]);
+        } else if (arg.substr(0, 2) == "-j" && arg.size() > 2) {
+            options.build.jobs = parse_job_count(arg.substr(2));
+        } else {
+            throw std::runtime_error("Unknown run-release option '" + std::string(arg) + "'");
+        }
+    }
+
+    if (!pgo && counters) {
+        std::vector<std::string> command = {
+            "./" + build_configuration(build::Configuration::Release, options.build).string()};
+        command.insert(command.end(), options.run_args.begin(), options.run_args.end());
+        std::cout << colors::GREEN << "Running release build..." << colors::RESET << '\n';
+        run_with_counters(command);
+        return;
+    }
+    if (!pgo) {
+        if (!args.empty()) {
+            throw std::runtime_error("run-release options other than --pgo and --counters require --pgo");
+        }
+        execute_system_command("make run-release", "Running release build...");
+        return;
+    }
+    if (!fs::is_directory("src")) {
+        throw std::runtime_error("No src/ directory found; run this inside a project created with 'new'");
+    }
+
+    // Workloads are separated by ';' in cppstarter.conf; "test" runs the test suite
+    if (!train_from_args) {
+        std::istringstream workloads(project.get("pgo_train"));
+        std::string workload;
+        while (std::getline(workloads, workload, ';')) {
+            workload.erase(0, workload.find_first_not_of(" \t"));
+            workload.erase(workload.find_last_not_of(" \t") + 1);
+            if (!workload.empty()) {
+                options.training.push_back(workload);
+            }
+        }
+    }
+
+    // .gcda files are matched by object path, which differs for unity batches
+    // read from build/release/unity by the build/pgo-gen tree
+    BuildSettings settings = load_build_settings(project);
+    settings.unity = false;
+    options.release = project_build_config(build::Configuration::Release, settings);
+    build::CompileCache cache;
+    if (compile_cache_enabled()) {
+        options.build.cache = &cache;
+    }
+
+    build::PgoReport report = build::run_pgo_pipeline(options);
+    cache.flush();
+
+    std::cout << colors::GREEN << "PGO build complete: " << report.binary.string() << colors::RESET << '\n'
+              << colors::CYAN << "  Profile:   " << colors::RESET << build::pgo_data_dir().string()
+              << " (" << report.training_runs << " training runs merged, "
+              << report.profiled_units << '/' << report.total_units << " translation units covered)\n";
+    if (options.timing_runs > 0) {
+        const double speedup = report.optimized_seconds > 0 ? report.baseline_seconds / report.optimized_seconds : 0;
+        std::cout << std::fixed << std::setprecision(1)
+                  << colors::CYAN << "  Baseline:  " << colors::RESET
+                  << report.baseline_seconds * 1000 << " ms (median of " << options.timing_runs << ")\n"
+                  << colors::CYAN << "  PGO" << (options.lto ? "+LTO:   " : ":       ") << colors::RESET
+                  << report.optimized_seconds * 1000 << " ms\n"
+                  << colors::CYAN << "  Speedup:   " << colors::RESET
+                  << (speedup >= 1.0 ? colors::GREEN : colors::YELLOW) << std::setprecision(2)
+                  << speedup << 'x' << colors::RESET << '\n';
+    }
+
+    std::vector<std::string> command = {report.binary.string()};
+    command.insert(command.end(), options.run_args.begin(), options.run_args.end());
+    std::cout << colors::CYAN << "Running release build..." << colors::RESET << '\n';
+    if (counters) {
+        run_with_counters(command);
+        return;
+    }
+    process::Options run_options;
+    run_options.capture_output = false;
+    const process::Result result = process::run(command, run_options);
+    if (result.exit_code != 0) {
+        throw std::runtime_error("Program exited with code " + std::to_string(result.exit_code));
+    }
+}
+
+// Streams one runner's gtest output: a test's lines are held back until it
+// finishes and then printed as one block, so parallel shards never interleave
+// inside a test. Passing tests print only their "[ OK ]" line.
+class ShardOutput {
+public:
+    explicit ShardOutput(std::mutex& output_mutex) : output_mutex_(output_mutex) {}
+
+    void line(std::string_view text) {
+        if (text.rfind("[ RUN      ]", 0) == 0) {
+            pending_.clear();
+            in_test_ = true;
+        } else if (!in_test_) {
+            return;     // gtest's own banners and summary; ours replaces them
+        } else if (text.rfind("[       OK ]", 0) == 0) {
+            finish(colors::GREEN, text, false);
+        } else if (text.rfind("[  SKIPPED ]", 0) == 0) {
+            finish(colors::YELLOW, text, false);
+        } else if (text.rfind("[  FAILED  ]", 0) == 0) {
+            finish(colors::RED, text, true);
+        } else {
+            pending_.emplace_back(text);
+        }
+    }
+
+    // The runner died inside a test: show what it printed
+    void crashed(int exit_code) {
+        if (in_test_) {
+            finish(colors::RED, "[  CRASHED ] exit code " + std::to_string(exit_code), true);
+        }
+    }
+
+private:
+    void finish(const char* color, std::string_view text, bool show_output) {
+        std::lock_guard<std::mutex> lock(output_mutex_);
+        if (show_output) {
+            for (const auto& line : pending_) {
+                std::cout << line << '\n';
+            }
+        }
+        std::cout << color << text << colors::RESET << '\n';
+        pending_.clear();
+        in_test_ = false;
+    }
+
+    std::mutex& output_mutex_;
+    std::vector<std::string> pending_;
+    bool in_test_ = false;
+};
+
+// --gtest_filter value for the tests affected by the changes since `ref`
+// (or, outside git, since the last run). Empty runs every test; nothing
+// means no test is affected.
+std::optional<std::string> changed_tests_filter(const build::BuildEngine& engine, const std::string& ref) {
+    const fs::path stamp = "build/test/last_run";
+    std::vector<fs::path> changed;
+    std::string since;
+    try {
+        changed = build::git_changed_files(ref.empty() ? "HEAD" : ref);
+        since = ref.empty() ? "HEAD" : ref;
+    } catch (const std::exception&) {
+        if (!ref.empty()) {
+            throw;
+        }
+        if (!fs::exists(stamp)) {
+            std::cout << colors::YELLOW << "Not a git repository and no earlier test run to compare with; "
+                      << "running every test" << colors::RESET << '\n';
+            return std::string();
+        }
+        changed = build::files_changed_since(stamp, {"src", "include", "tests"});
+        since = "the last test run";
+    }
+    for (const auto& path : changed) {
+        // Build settings reach every object
+        if (path == "cppstarter.conf" || path == "Makefile") {
+            std::cout << colors::YELLOW << path.string() << " changed; running every test" << colors::RESET << '\n';
+            return std::string();
+        }
+    }
+
+    const auto& sources = engine.config().sources;
+    const std::vector<fs::path> objects = engine.objects();
+    std::unordered_map<std::string, std::string> object_of;
+    std::vector<fs::path> test_sources;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        object_of[sources[i].string()] = objects[i].string();
+        if (sources[i].parent_path() == "tests") {
+            test_sources.push_back(sources[i]);
+        }
+    }
+    const build::LinkClosure closure =
+        build::link_closure(build::load_object_symbols(objects, "build/test/link_map.cache"));
+    const std::vector<fs::path> impacted = build::impacted_tests(
+        changed, test_sources, [&engine](const fs::path& file) { return engine.dependents_of(file); },
+        object_of, closure);
+
+    std::cout << colors::CYAN << changed.size() << " files changed since " << since << "; "
+              << impacted.size() << " of " << test_sources.size() << " test files affected" << colors::RESET << '\n';
+    if (impacted.empty()) {
+        return std::nullopt;
+    }
+    std::vector<std::string> suites;
+    for (const auto& test : impacted) {
+        std::cout << "  " << test.string() << '\n';
+        const auto more = build::gtest_suites_in(test);
+        if (more.empty()) {
+            return std::string();   // Tests we cannot name; run them all
+        }
+        suites.insert(suites.end(), more.begin(), more.end());
+    }
+    return build::gtest_filter_for(suites);
+}
+
+// test [-j N] [--slowest N] [--changed [ref]] [-- gtest args]
+void run_tests(const CommandArgs& args) {
+    if (args.empty()) {
+        execute_system_command("make test", "Running tests...");
+        return;
+    }
+
+    build::BuildOptions options;
+    size_t slowest = 10;
+    std::vector<std::string> test_args;
+    bool changed_only = false;
+    std::string changed_ref;
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        if (arg == "--") {
+            test_args.assign(args.begin() + static_cast<std::ptrdiff_t>(i) + 1, args.end());
+            break;
+        } else if (arg == "--changed") {
+            changed_only = true;
+            if (i + 1 < args.size() && !args[i + 1].empty() && args[i + 1][0] != '-') {
+                changed_ref = args[++i];
+            }
+        } else if (arg == "-j" && i + 1 < args.size()) {
+            options.jobs = parse_job_count(args[++i]);
+        } else if (arg.substr(0, 2) == "-j" && arg.size() > 2) {
+            options.jobs = parse_job_count(arg.substr(2));
+        } else if (arg == "--slowest" && i + 1 < args.size()) {
+            slowest = parse_job_count(args[++i]);
+        } else {
+            throw std::runtime_error("Unknown test option '" + std::string(arg) + "'");
+        }
+    }
+    if (!fs::is_directory("src")) {
+        throw std::runtime_error("No src/ directory found; run this inside a project created with 'new'");
+    }
+    build::BuildEngine engine(project_build_config(build::Configuration::Test,
+                                                   load_build_settings(config::ProjectConfig::load())));
+    const fs::path binary = build_configuration(engine, options);
+    const std::string runner = "./" + binary.string();
+    if (!engine.config().gtest) {
+        std::cout << colors::YELLOW << "The tests do not use gtest; running all of them in one process"
                   << colors::RESET << '\n';
+        std::vector<std::string> command{runner};
+        command.insert(command.end(), test_args.begin(), test_args.end());
+        process::Options run_options;
+        run_options.capture_output = false;
+        if (process::run(command, run_options).exit_code != 0) {
+            throw std::runtime_error("Tests failed");
+        }
+        return;
+    }
+
+    const bool user_filter = std::any_of(test_args.begin(), test_args.end(), [](const std::string& arg) {
+        return arg.rfind("--gtest_filter", 0) == 0;
+    });
+    if (changed_only) {
+        if (user_filter) {
+            throw std::runtime_error("--changed selects the tests itself; drop --gtest_filter");
+        }
+        const std::optional<std::string> filter = changed_tests_filter(engine, changed_ref);
+        if (!filter) {
+            std::cout << colors::GREEN << "No tests affected; nothing to run" << colors::RESET << '\n';
+            return;
+        }
+        if (!filter->empty()) {
+            test_args.push_back("--gtest_filter=" + *filter);
+        }
+    }
+
+    std::vector<std::string> list_command{runner, "--gtest_list_tests"};
+    list_command.insert(list_command.end(), test_args.begin(), test_args.end());
+    const process::Result listing = process::run(list_command);
+    if (listing.exit_code != 0) {
+        throw std::runtime_error("Could not list the tests:\n" + listing.output);
+    }
+    const std::vector<std::string> tests = build::parse_gtest_list(listing.output);
+    if (tests.empty()) {
+        std::cout << colors::YELLOW << "No tests to run" << colors::RESET << '\n';
+        return;
+    }
+
+    // With a duration history, bin-pack individual tests so every shard
+    // finishes at about the same time. Without one (or when the user
+    // filters, or a filter would get too long for one argument) let gtest
+    // deal them out with GTEST_TOTAL_SHARDS/GTEST_SHARD_INDEX.
+    const fs::path durations_path = "build/test/durations.tsv";
+    build::TestDurations durations = build::load_test_durations(durations_path);
+    const unsigned shard_count = std::min<unsigned>(options.jobs, static_cast<unsigned>(tests.size()));
+    std::vector<std::string> filters;
+    if (!durations.empty() && !user_filter) {
+        for (const auto& group : build::pack_tests(tests, durations, shard_count)) {
+            std::string filter = "--gtest_filter=";
+            for (size_t i = 0; i < group.size(); ++i) {
+                filter += (i ? ":" : "") + group[i];
+            }
+            filters.push_back(std::move(filter));
+        }
+        // Linux caps a single argument at 128 KiB
+        if (std::any_of(filters.begin(), filters.end(), [](const std::string& f) { return f.size() > 100'000; })) {
+            filters.clear();
+        }
+    }
+    const unsigned shards = filters.empty() ? shard_count : static_cast<unsigned>(filters.size());
+
+    const fs::path shard_dir = "build/test/shards";
+    fs::remove_all(shard_dir);
+    fs::create_directories(shard_dir);
+    std::cout << colors::CYAN << "Running " << tests.size() << " tests in " << shards << " shard"
+              << (shards == 1 ? "" : "s") << (filters.empty() ? " (gtest sharding)" : " (packed by duration)")
+              << "..." << colors::RESET << '\n';
+
+    const auto started = std::chrono::steady_clock::now();
+    std::mutex output_mutex;
+    std::vector<int> exit_codes(shards, 0);
+    {
+        utils::ThreadPool pool(shards);
+        for (unsigned shard = 0; shard < shards; ++shard) {
+            pool.submit([&, shard] {
+                std::vector<std::string> command{runner};
+                command.insert(command.end(), test_args.begin(), test_args.end());
+                command.push_back("--gtest_output=xml:" + (shard_dir / ("shard-" + std::to_string(shard) + ".xml")).string());
+                process::Options run_options;
+                if (filters.empty()) {
+                    run_options.extra_env = {"GTEST_TOTAL_SHARDS=" + std::to_string(shards),
+                                             "GTEST_SHARD_INDEX=" + std::to_string(shard)};
+                } else {
+                    command.push_back(filters[shard]);
+                }
+                ShardOutput output(output_mutex);
+                run_options.on_line = [&output](std::string_view line) { output.line(line); };
+                const process::Result result = process::run(command, run_options);
+                exit_codes[shard] = result.exit_code;
+                if (result.exit_code > 1) {
+                    output.crashed(result.exit_code);
+                }
+            });
+        }
+        pool.wait();
+    }
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    // Merge the per-shard reports; a shard that crashed may not have written one
+    std::vector<build::TestCaseResult> results;
+    std::vector<std::string> crashed;
+    for (unsigned shard = 0; shard < shards; ++shard) {
+        std::ifstream file(shard_dir / ("shard-" + std::to_string(shard) + ".xml"));
+        std::ostringstream xml;
+        xml << file.rdbuf();
+        const auto cases = build::parse_gtest_xml(xml.str());
+        results.insert(results.end(), cases.begin(), cases.end());
+        if (exit_codes[shard] > 1) {    // gtest exits with 1 when tests fail
+            crashed.push_back("shard " + std::to_string(shard) + " (exit code " + std::to_string(exit_codes[shard]) + ")");
+        }
+    }
+    std::ofstream("build/test/results.xml") << build::format_gtest_xml(results);
+
+    size_t failed = 0, skipped = 0;
+    double test_seconds = 0.0;
+    for (const auto& result : results) {
+        failed += result.failed ? 1 : 0;
+        skipped += result.skipped ? 1 : 0;
+        test_seconds += result.seconds;
+        if (!result.skipped) {
+            durations[result.full_name()] = result.seconds;
+        }
+    }
+    build::save_test_durations(durations_path, durations);
+    std::ofstream("build/test/last_run") << "Changes since this file was written are tested by 'test --changed'\n";
+
+    std::vector<const build::TestCaseResult*> ranked;
+    for (const auto& result : results) {
+        ranked.push_back(&result);
+    }
+    std::sort(ranked.begin(), ranked.end(), [](const build::TestCaseResult* a, const build::TestCaseResult* b) {
+        return a->seconds > b->seconds;
+    });
+    ranked.resize(std::min(ranked.size(), slowest));
+    if (!ranked.empty()) {
+        std::cout << '\n' << colors::BOLD << std::right << std::setw(10) << "Time" << "  Slowest tests"
+                  << colors::RESET << '\n';
+        for (const auto* result : ranked) {
+            std::cout << std::setw(7) << static_cast<long>(result->seconds * 1000) << " ms  " << result->full_name() << '\n';
+        }
+    }
+
+    std::cout << '\n' << (failed || !crashed.empty() ? colors::RED : colors::GREEN) << results.size() << " tests, "
+              << failed << " failed, " << skipped << " skipped in " << std::fixed << std::setprecision(2) << wall
+              << "s wall (" << test_seconds << "s of test time over " << shards << " shards)" << colors::RESET << '\n';
+    std::cout << colors::CYAN << "Results: build/test/results.xml" << colors::RESET << '\n';
+    for (const auto& result : results) {
+        if (result.failed) {
+            std::cout << colors::RED << "  FAILED " << result.full_name() << colors::RESET << '\n';
+        }
+    }
+    for (const auto& shard : crashed) {
+        std::cout << colors::RED << "  CRASHED " << shard << colors::RESET << '\n';
+    }
+    if (results.size() < tests.size()) {
+        std::cout << colors::RED << "  " << tests.size() - results.size() << " of " << tests.size()
+                  << " tests did not report a result" << colors::RESET << '\n';
+    }
+    if (failed || !crashed.empty()) {
+        throw std::runtime_error(std::to_string(failed) + " tests failed" +
+                                 (crashed.empty() ? "" : ", " + std::to_string(crashed.size()) + " shards crashed"));
+    }
+}
+
+// Source or header the build cares about; editor swap, backup and hidden files are not
+bool is_watched_source(const fs::path& path) {
+    const std::string name = path.filename().string();
+    if (name.empty() || name[0] == '.' || name.back() == '~') {
         return false;
     }
-    return true;
+    const std::string extension = path.extension().string();
+    for (std::string_view known : {".cpp", ".cc", ".cxx", ".h", ".hpp", ".hh", ".hxx", ".ipp", ".inl", ".tpp"}) {
+        if (extension == known) {
+            return true;
+        }
+    }
+    return false;
 }
 
-void create_project(const std::string& project_name, bool init_git = false) {
-    if (project_name.empty()) {
-        std::cout << colors::RED << "Error: Project name cannot be empty" << colors::RESET << '\n';
+std::string format_ms(std::chrono::steady_clock::duration elapsed) {
+    return std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()) + " ms";
+}
+
+// Resident edit-compile(-test|-run) loop. One engine stays alive between
+// iterations, so the dependency graph is never re-read from the depfiles.
+// Only a source being added or removed rebuilds it.
+void run_watch(const CommandArgs& args) {
+    std::string_view mode = "build";
+    build::BuildOptions options;
+    bool use_cache = compile_cache_enabled();
+    std::chrono::milliseconds debounce{100};
+    std::vector<std::string> program_args;
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        if (i == 0 && (arg == "build" || arg == "test" || arg == "run")) {
+            mode = arg;
+        } else if (arg == "--") {
+            program_args.assign(args.begin() + static_cast<std::ptrdiff_t>(i) + 1, args.end());
+            break;
+        } else if (arg == "-j" && i + 1 < args.size()) {
+            options.jobs = parse_job_count(args[++i]);
+        } else if (arg.substr(0, 2) == "-j" && arg.size() > 2) {
+            options.jobs = parse_job_count(arg.substr(2));
+        } else if (arg == "--no-cache") {
+            use_cache = false;
+        } else if (arg == "--debounce" && i + 1 < args.size()) {
+            debounce = std::chrono::milliseconds(parse_job_count(args[++i]));
+        } else {
+            throw std::runtime_error("Unknown watch option '" + std::string(arg) + "'");
+        }
+    }
+    if (mode == "build" && !program_args.empty()) {
+        throw std::runtime_error("Program arguments need 'watch run' or 'watch test'");
+    }
+    if (!fs::is_directory("src")) {
+        throw std::runtime_error("No src/ directory found; run this inside a project created with 'new'");
+    }
+
+    const config::ProjectConfig project = config::ProjectConfig::load();
+    const build::Configuration configuration =
+        mode == "test" ? build::Configuration::Test : build::Configuration::Debug;
+    const BuildSettings settings = load_build_settings(project);
+    auto make_engine = [&] {
+        return std::make_unique<build::BuildEngine>(project_build_config(configuration, settings));
+    };
+    std::unique_ptr<build::BuildEngine> engine = make_engine();
+
+    build::CompileCache cache;
+    if (use_cache) {
+        options.cache = &cache;
+    }
+
+    build::FileWatcher watcher({"src", "include", "tests"});
+    std::cout << colors::CYAN << "Watching src/, include/ and tests/ (" << watcher.watched_directories()
+              << " directories); " << mode << " on every change, Ctrl-C to stop" << colors::RESET << '\n';
+
+    // Build, then rerun the program or tests when the binary changed.
+    // `only_tests` narrows the test run to those files' suites.
+    auto iterate = [&](std::chrono::steady_clock::time_point since, bool force_run,
+                       const std::vector<fs::path>& only_tests) {
+        const auto build_start = std::chrono::steady_clock::now();
+        const build::BuildResult result = engine->build(options);
+        if (use_cache) {
+            cache.flush();
+        }
+        const auto build_time = std::chrono::steady_clock::now() - build_start;
+        if (!result.success) {
+            std::cout << colors::RED << "Build failed after " << format_ms(build_time)
+                      << "; waiting for the next change" << colors::RESET << '\n';
+            return;
+        }
+
+        std::string summary = "build " + format_ms(build_time) + ", " + std::to_string(result.compiled) +
+                              " compiled, " + std::to_string(result.cache_hits) + " from cache";
+        bool passed = true;
+        const bool binary_changed = result.compiled > 0 || result.linked;
+        if (mode != "build" && (binary_changed || force_run)) {
+            std::vector<std::string> command{"./" + engine->config().binary.string()};
+            command.insert(command.end(), program_args.begin(), program_args.end());
+            std::vector<std::string> suites;
+            for (const auto& source : only_tests) {
+                const auto more = build::gtest_suites_in(source);
+                suites.insert(suites.end(), more.begin(), more.end());
+            }
+            const std::string filter = build::gtest_filter_for(suites);
+            if (!filter.empty()) {
+                command.push_back("--gtest_filter=" + filter);
+            }
+            std::cout << colors::CYAN << (mode == "test" ? "Running tests" : "Running ")
+                      << (mode == "test" ? (filter.empty() ? "..." : " (changed suites only)...")
+                                         : engine->config().binary.string() + "...")
+                      << colors::RESET << '\n';
+            process::Options run_options;
+            run_options.capture_output = false;
+            const process::Result run = process::run(command, run_options);
+            passed = run.exit_code == 0;
+            summary += ", " + std::string(mode == "test" ? "tests " : "run ") +
+                       std::to_string(static_cast<long>(run.wall_seconds * 1000)) + " ms" +
+                       (passed ? "" : " (exit code " + std::to_string(run.exit_code) + ")");
+        } else if (!binary_changed) {
+            summary += ", binary unchanged";
+        }
+        std::cout << (passed ? colors::GREEN : colors::RED)
+                  << (passed ? "Ready " : "Failed ") << format_ms(std::chrono::steady_clock::now() - since)
+                  << " after the change (" << summary << ")" << colors::RESET << '\n';
+    };
+
+    iterate(std::chrono::steady_clock::now(), /*force_run=*/true, {});
+    for (;;) {
+        const build::ChangeSet changes = watcher.wait(debounce);
+        if (changes.overflowed) {
+            // Events were lost: rescan the sources and let the engine's
+            // timestamps and dependency graph decide what to rebuild
+            std::cout << colors::YELLOW << "Too many changes at once for inotify; checking every file"
+                      << colors::RESET << '\n';
+            engine = make_engine();
+            iterate(changes.first_event, /*force_run=*/false, {});
+            continue;
+        }
+        std::vector<fs::path> relevant;
+        for (const auto& path : changes.paths) {
+            if (is_watched_source(path)) {
+                relevant.push_back(path);
+            }
+        }
+        if (relevant.empty()) {
+            continue;
+        }
+
+        // A translation unit appearing or disappearing changes the source
+        // list; anything else is handled by the engine's dependency graph.
+        const auto& sources = engine->config().sources;
+        bool sources_changed = false;
+        bool tests_only = engine->config().gtest;
+        for (const auto& path : relevant) {
+            const bool known = std::find(sources.begin(), sources.end(), path) != sources.end();
+            const bool is_unit = path.extension() == ".cpp" &&
+                                 (path.parent_path() == "src" || path.parent_path() == "tests");
+            sources_changed = sources_changed || (is_unit && known != fs::exists(path));
+            tests_only = tests_only && known && path.parent_path() == "tests";
+            std::cout << colors::CYAN << "Changed: " << path.string();
+            if (!is_unit) {
+                std::cout << " (" << engine->dependents_of(path).size() << " dependent translation units)";
+            }
+            std::cout << colors::RESET << '\n';
+        }
+        if (sources_changed) {
+            engine = make_engine();
+            tests_only = false;
+        }
+        iterate(changes.first_event, /*force_run=*/false, tests_only ? relevant : std::vector<fs::path>{});
+    }
+}
+
+void run_bench(const CommandArgs& args) {
+    build::BuildOptions options;
+    bool use_cache = compile_cache_enabled();
+    const config::ProjectConfig project = config::ProjectConfig::load();
+    bool json_requested = false;
+    std::vector<std::string> bench_args;
+
+    // Everything cppstarter does not recognise goes to the benchmark binary
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        if (arg == "-j" && i + 1 < args.size()) {
+            options.jobs = parse_job_count(args[++i]);
+        } else if (arg.substr(0, 2) == "-j" && arg.size() > 2) {
+            options.jobs = parse_job_count(arg.substr(2));
+        } else if (arg == "--no-cache") {
+            use_cache = false;
+        } else {
+            json_requested = json_requested || arg == "--json";
+            bench_args.emplace_back(arg);
+        }
+    }
+
+    if (!fs::is_directory("bench")) {
+        throw std::runtime_error("No bench/ directory found; projects created with 'new' include one");
+    }
+
+    build::CompileCache cache;
+    if (use_cache) {
+        options.cache = &cache;
+    }
+
+    build::BuildEngine engine(project_build_config(build::Configuration::Bench, load_build_settings(project)));
+    std::cout << colors::CYAN << "Compiling bench build..." << colors::RESET << '\n';
+    build::BuildResult result = engine.build(options);
+    if (use_cache) {
+        cache.flush();
+    }
+    if (!result.success) {
+        throw std::runtime_error("bench build failed");
+    }
+
+    // Keep the latest results machine-readable for scripts and CI
+    const std::string json_path = "build/bench/results.json";
+    if (!json_requested) {
+        bench_args.insert(bench_args.end(), {"--json", json_path});
+    }
+
+    std::vector<std::string> command = {engine.config().binary.string()};
+    command.insert(command.end(), bench_args.begin(), bench_args.end());
+    std::cout << colors::CYAN << "Running benchmarks..." << colors::RESET << '\n';
+    process::Options run_options;
+    run_options.capture_output = false;
+    process::Result run = process::run(command, run_options);
+    if (run.exit_code != 0) {
+        throw std::runtime_error("bench_runner exited with code " + std::to_string(run.exit_code));
+    }
+    if (!json_requested) {
+        std::cout << colors::GREEN << "Results written to " << json_path << colors::RESET << '\n';
+    }
+}
+
+void run_perfgate(const CommandArgs& args) {
+    const config::ProjectConfig project = config::ProjectConfig::load();
+    std::string save_name;
+    std::string compare_name;
+    unsigned runs = static_cast<unsigned>(std::max(2, project.get_int("perfgate_runs", 10)));
+    unsigned warmup = static_cast<unsigned>(std::max(0, project.get_int("perfgate_warmup", 1)));
+    double threshold = project.get_int("perfgate_threshold", 5) / 100.0;
+    std::vector<std::vector<std::string>> commands;
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        const bool has_value = i + 1 < args.size();
+        if (arg == "--") {
+            // Each further "--" starts another command
+            commands.emplace_back();
+            while (++i < args.size() && args[i] != "--") {
+                commands.back().emplace_back(args[i]);
+            }
+            if (commands.back().empty()) {
+                throw std::runtime_error("Empty command after '--'");
+            }
+            --i;
+        } else if (arg == "--save-baseline" && has_value) {
+            save_name = args[++i];
+        } else if (arg == "--compare" && has_value) {
+            compare_name = args[++i];
+        } else if (arg == "--runs" && has_value) {
+            runs = std::max(2u, parse_job_count(args[++i]));
+        } else if (arg == "--warmup" && has_value) {
+            warmup = parse_count(arg, args[++i]);
+        } else if (arg == "--threshold" && has_value) {
+            threshold = parse_percentage(arg, args[++i]);
+        } else {
+            throw std::runtime_error("Unknown perfgate option '" + std::string(arg) + "'");
+        }
+    }
+    if (save_name.empty() == compare_name.empty()) {
+        throw std::runtime_error("perfgate needs exactly one of --save-baseline <name> or --compare <name>");
+    }
+
+    // Default: the release binary that 'run-release' runs
+    if (commands.empty()) {
+        if (!fs::is_directory("src")) {
+            throw std::runtime_error("No command given and no src/ directory to build a release binary from");
+        }
+        build::CompileCache cache;
+        build::BuildOptions options;
+        if (compile_cache_enabled()) {
+            options.cache = &cache;
+        }
+        build::BuildEngine engine(project_build_config(build::Configuration::Release,
+                                                       load_build_settings(project)));
+        std::cout << colors::CYAN << "Compiling release build..." << colors::RESET << '\n';
+        const bool built = engine.build(options).success;
+        cache.flush();
+        if (!built) {
+            throw std::runtime_error("release build failed");
+        }
+        commands.push_back({"./" + engine.config().binary.string()});
+    }
+
+    const perf::Environment environment = perf::read_environment();
+    perf::Baseline baseline;
+    if (!compare_name.empty()) {
+        baseline = perf::load_baseline(compare_name);
+    }
+    for (const auto& note : perf::noise_notes(environment, compare_name.empty() ? nullptr : &baseline.environment)) {
+        std::cout << colors::YELLOW << "Note: " << note << colors::RESET << '\n';
+    }
+
+    perf::Baseline current;
+    current.environment = environment;
+    for (const auto& command : commands) {
+        std::cout << colors::CYAN << "Timing " << process::join_command(command) << " (" << runs
+                  << " runs)..." << colors::RESET << '\n';
+        current.commands.push_back({process::join_command(command), perf::measure(command, runs, warmup)});
+    }
+
+    if (!save_name.empty()) {
+        perf::save_baseline(save_name, current);
+        std::cout << colors::GREEN << "Baseline '" << save_name << "' saved to "
+                  << perf::baseline_path(save_name).string() << colors::RESET << '\n';
         return;
     }
 
-    if (fs::exists(project_name)) {
-        std::cout << colors::RED 
-                  << "Error: Directory '" << project_name << "' already exists" 
+    // === Delta table ===
+    auto ms = [](double seconds) {
+        std::ostringstream text;
+        text << std::fixed << std::setprecision(seconds < 0.01 ? 3 : 1) << seconds * 1000 << " ms";
+        return text.str();
+    };
+    size_t width = 7;
+    for (const auto& [command, samples] : current.commands) {
+        width = std::max(width, command.size());
+    }
+
+    std::cout << '\n' << colors::BOLD << std::left << std::setw(static_cast<int>(width)) << "Command"
+              << std::right << std::setw(14) << "Baseline" << std::setw(14) << "Current"
+              << std::setw(10) << "Delta" << std::setw(10) << "p-value" << "  Verdict" << colors::RESET << '\n';
+
+    size_t regressions = 0;
+    size_t compared = 0;
+    for (const auto& [command, samples] : current.commands) {
+        std::cout << std::left << std::setw(static_cast<int>(width)) << command << std::right;
+        const std::vector<double>* recorded = baseline.find(command);
+        if (!recorded) {
+            std::cout << std::setw(14) << "-" << std::setw(14) << ms(perf::summarize(samples).median)
+                      << colors::YELLOW << "  not in baseline '" << compare_name << "'" << colors::RESET << '\n';
+            continue;
+        }
+
+        const perf::Comparison result = perf::compare(*recorded, samples, threshold);
+        ++compared;
+        std::ostringstream delta;
+        delta << std::showpos << std::fixed << std::setprecision(1) << result.delta * 100 << '%';
+        std::ostringstream p_value;
+        p_value << std::fixed << std::setprecision(3) << result.test.p_value;
+
+        const char* color = colors::RESET;
+        std::string verdict = "unchanged";
+        if (result.verdict == perf::Verdict::Slower) {
+            color = colors::RED;
+            verdict = "REGRESSION";
+            ++regressions;
+        } else if (result.verdict == perf::Verdict::Faster) {
+            color = colors::GREEN;
+            verdict = "faster";
+        }
+        std::cout << std::setw(14) << ms(result.baseline.median) << std::setw(14) << ms(result.current.median)
+                  << color << std::setw(10) << delta.str() << colors::RESET
+                  << std::setw(10) << p_value.str() << "  " << color << verdict << colors::RESET << '\n';
+    }
+
+    std::cout << colors::CYAN << "Medians of " << runs << " runs; a change counts when it exceeds "
+              << threshold * 100 << "% and the Mann-Whitney U test gives p < 0.05" << colors::RESET << '\n';
+    if (compared == 0) {
+        throw std::runtime_error("None of the commands were recorded in baseline '" + compare_name + "'");
+    }
+    if (regressions > 0) {
+        throw std::runtime_error(std::to_string(regressions) + " command(s) regressed against baseline '" +
+                                 compare_name + "'");
+    }
+    std::cout << colors::GREEN << "No performance regressions against baseline '" << compare_name << "'"
+              << colors::RESET << '\n';
+}
+
+// Build the release binary (or the benchmarks) under a matrix of compilers
+// and flags, time a workload against each, and save the fastest as a profile
+void run_tune(const CommandArgs& args) {
+    build::TuneOptions options;
+    bool use_cache = compile_cache_enabled();
+    std::vector<std::string> compilers;
+    std::vector<std::vector<std::string>> extra_flags;
+    std::string profile_name = "tuned";
+    bool save = true;
+    bool workload_given = false;
+    auto split_words = [](std::string_view text, char separator) {
+        std::vector<std::string> words;
+        std::istringstream stream{std::string(text)};
+        std::string word;
+        while (separator == ' ' ? static_cast<bool>(stream >> word)
+                                : static_cast<bool>(std::getline(stream, word, separator))) {
+            if (!word.empty()) {
+                words.push_back(word);
+            }
+        }
+        return words;
+    };
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        const bool has_value = i + 1 < args.size();
+        if (arg == "--") {
+            options.args.assign(args.begin() + static_cast<std::ptrdiff_t>(i) + 1, args.end());
+            break;
+        } else if (arg == "--runs" && has_value) {
+            options.runs = std::max(2u, parse_job_count(args[++i]));
+        } else if (arg == "--warmup" && has_value) {
+            options.warmup = parse_count(arg, args[++i]);
+        } else if (arg == "--threshold" && has_value) {
+            options.threshold = parse_percentage(arg, args[++i]);
+        } else if (arg == "--cxx" && has_value) {
+            const auto listed = split_words(args[++i], ',');
+            compilers.insert(compilers.end(), listed.begin(), listed.end());
+        } else if (arg == "--flags" && has_value) {
+            extra_flags.push_back(split_words(args[++i], ' '));
+        } else if (arg == "--profile" && has_value) {
+            profile_name = args[++i];
+        } else if (arg == "--no-save") {
+            save = false;
+        } else if (arg == "--bench") {
+            options.workload = build::TuneWorkload::Bench;
+            workload_given = true;
+        } else if (arg == "--run") {
+            options.workload = build::TuneWorkload::Binary;
+            workload_given = true;
+        } else if (arg == "--command" && has_value) {
+            options.workload = build::TuneWorkload::Command;
+            options.command = args[++i];
+            workload_given = true;
+        } else if (arg == "-j" && has_value) {
+            options.build.jobs = parse_job_count(args[++i]);
+        } else if (arg.substr(0, 2) == "-j" && arg.size() > 2) {
+            options.build.jobs = parse_job_count(arg.substr(2));
+        } else if (arg == "--no-cache") {
+            use_cache = false;
+        } else {
+            throw std::runtime_error("Unknown tune option '" + std::string(arg) + "'");
+        }
+    }
+    if (!fs::is_directory("src")) {
+        throw std::runtime_error("No src/ directory found; run this inside a project created with 'new'");
+    }
+    // The project's benchmarks measure throughput more precisely than the
+    // program's wall time, so they are the default when there are any
+    if (!workload_given && !build::scan_sources("bench").empty()) {
+        options.workload = build::TuneWorkload::Bench;
+    }
+
+    if (compilers.empty()) {
+        compilers = build::available_compilers();
+    }
+    if (compilers.empty()) {
+        throw std::runtime_error("No C++ compiler found (tried $CXX, g++ and clang++)");
+    }
+    options.variants = build::tuning_matrix(compilers, extra_flags);
+    // The variants replace the flags of release_profile, so start from plain -O2
+    BuildSettings settings = load_build_settings(config::ProjectConfig::load());
+    settings.release_profile.clear();
+    options.base = project_build_config(options.workload == build::TuneWorkload::Bench
+                                            ? build::Configuration::Bench
+                                            : build::Configuration::Release,
+                                        settings);
+
+    build::CompileCache cache;
+    if (use_cache) {
+        options.build.cache = &cache;
+    }
+    for (const auto& note : perf::noise_notes(perf::read_environment())) {
+        std::cout << colors::YELLOW << "Note: " << note << colors::RESET << '\n';
+    }
+    const char* workload_name = options.workload == build::TuneWorkload::Bench  ? "the benchmarks"
+                                : options.workload == build::TuneWorkload::Binary ? "the release binary"
+                                                                                  : "the command";
+    std::cout << colors::CYAN << "Tuning " << options.variants.size() << " flag variants against "
+              << workload_name << ", " << options.runs << " runs each" << colors::RESET << '\n';
+
+    const build::TuneReport report = build::run_tuning(options);
+    if (use_cache) {
+        cache.flush();
+    }
+
+    // === Ranked table ===
+    const bool bench = options.workload == build::TuneWorkload::Bench;
+    auto score = [bench](double value) {
+        std::ostringstream text;
+        if (bench) {
+            text << std::fixed << std::setprecision(value < 100 ? 2 : 0) << value << " ns";
+        } else {
+            text << std::fixed << std::setprecision(value < 0.01 ? 3 : 1) << value * 1000 << " ms";
+        }
+        return text.str();
+    };
+    size_t width = 7;
+    for (const auto& result : report.results) {
+        width = std::max(width, result.variant.label().size());
+    }
+    const std::string baseline_label = report.results[report.baseline].variant.label();
+    std::cout << '\n' << colors::BOLD << std::right << std::setw(4) << "#" << "  " << std::left
+              << std::setw(static_cast<int>(width)) << "Variant" << std::right
+              << std::setw(13) << (bench ? "Geomean" : "Median") << std::setw(9) << "Spread"
+              << std::setw(10) << "vs base" << std::setw(10) << "p-value" << "  Verdict" << colors::RESET << '\n';
+    for (size_t i = 0; i < report.results.size(); ++i) {
+        const auto& result = report.results[i];
+        std::cout << std::setw(4) << i + 1 << "  " << std::left << std::setw(static_cast<int>(width))
+                  << result.variant.label() << std::right;
+        if (!result.error.empty()) {
+            std::cout << colors::RED << "  failed: " << result.error.substr(0, result.error.find('\n'))
+                      << colors::RESET << '\n';
+            continue;
+        }
+        const perf::Summary& current = result.vs_baseline.current;
+        std::ostringstream spread, delta, p_value;
+        spread << "±" << std::fixed << std::setprecision(1)
+               << (current.mean > 0 ? current.stddev / current.mean * 100 : 0.0) << '%';
+        delta << std::showpos << std::fixed << std::setprecision(1) << result.vs_baseline.delta * 100 << '%';
+        p_value << std::fixed << std::setprecision(3) << result.vs_baseline.test.p_value;
+
+        const char* color = colors::RESET;
+        std::string verdict = "same";
+        if (i == report.baseline) {
+            verdict = "baseline";
+        } else if (result.vs_baseline.verdict == perf::Verdict::Faster) {
+            color = colors::GREEN;
+            verdict = "faster";
+        } else if (result.vs_baseline.verdict == perf::Verdict::Slower) {
+            color = colors::RED;
+            verdict = "slower";
+        }
+        // setw() counts the two bytes of "±", hence one column more than the header
+        std::cout << std::setw(13) << score(current.median) << std::setw(10) << spread.str()
+                  << color << std::setw(10) << delta.str() << colors::RESET << std::setw(10) << p_value.str()
+                  << "  " << color << verdict << colors::RESET << (i == report.winner ? "  <- winner" : "") << '\n';
+    }
+    std::cout << colors::CYAN << (bench ? "Geometric mean of the benchmark medians (ns per iteration)"
+                                        : "Median wall time")
+              << " over " << options.runs << " interleaved runs; a variant wins when it beats " << baseline_label
+              << " by more than " << options.threshold * 100 << "% with Mann-Whitney p < 0.05"
+              << colors::RESET << '\n';
+
+    const build::VariantResult& winner = report.results[report.winner];
+    if (report.winner == report.baseline) {
+        std::cout << colors::YELLOW << "No variant is significantly faster than " << baseline_label
                   << colors::RESET << '\n';
+    }
+    if (!save) {
         return;
     }
 
-    std::cout << colors::CYAN << "Creating project '" << project_name << "'..." << colors::RESET << '\n';
+    // === Write the winner back ===
+    build::ReleaseProfile profile{profile_name, winner.variant.compiler, winner.variant.flags};
+    std::ostringstream summary;
+    summary << winner.variant.label() << ": " << std::showpos << std::fixed << std::setprecision(1)
+            << winner.vs_baseline.delta * 100 << std::noshowpos << "% vs " << baseline_label << " (p = "
+            << std::setprecision(3) << winner.vs_baseline.test.p_value << ", " << options.runs << " runs of "
+            << workload_name << ")";
+    std::time_t now = std::time(nullptr);
+    std::ostringstream date;
+    date << std::put_time(std::localtime(&now), "%Y-%m-%d");
+    build::save_release_profile(profile, {"Release profile '" + profile_name + "', written by `cppstarter tune` on " +
+                                              date.str(),
+                                          summary.str()});
+    config::ProjectConfig project = config::ProjectConfig::load();
+    project.set("release_profile", profile_name);
+    project.save();
+    std::cout << colors::GREEN << "Profile '" << profile_name << "' (" << winner.variant.label() << ") written to "
+              << build::release_profile_path(profile_name).string()
+              << "; release_profile in cppstarter.conf now selects it for 'build --release', 'bench' and 'make release'"
+              << colors::RESET << '\n';
+}
 
-    // Create directory structure
-    const std::vector<std::string> directories = {
-        project_name + "/src",
-        project_name + "/include", 
-        project_name + "/tests",
-        project_name + "/build"
+void run_profile(const CommandArgs& args) {
+    perf::ProfileOptions options;
+    bool release = false;
+    bool use_cache = compile_cache_enabled();
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        const bool has_value = i + 1 < args.size();
+        if (arg == "--") {
+            options.args.assign(args.begin() + static_cast<std::ptrdiff_t>(i) + 1, args.end());
+            break;
+        } else if (arg == "--release") {
+            release = true;
+        } else if (arg == "--builtin") {
+            options.builtin_sampler = true;
+        } else if ((arg == "-F" || arg == "--frequency") && has_value) {
+            options.frequency = parse_job_count(args[++i]);
+        } else if (arg == "--top" && has_value) {
+            options.top = parse_job_count(args[++i]);
+        } else if (arg == "-j" && has_value) {
+            options.build.jobs = parse_job_count(args[++i]);
+        } else if (arg.substr(0, 2) == "-j" && arg.size() > 2) {
+            options.build.jobs = parse_job_count(arg.substr(2));
+        } else if (arg == "--no-cache") {
+            use_cache = false;
+        } else {
+            throw std::runtime_error("Unknown profile option '" + std::string(arg) + "'");
+        }
+    }
+    if (!fs::is_directory("src")) {
+        throw std::runtime_error("No src/ directory found; run 'profile' from a project root");
+    }
+    // build/profile/ is a tree of its own: a fast-link shared library would land in build/debug/
+    BuildSettings settings = load_build_settings(config::ProjectConfig::load());
+    settings.link_profile.enabled = false;
+    options.config = project_build_config(release ? build::Configuration::Release : build::Configuration::Debug,
+                                          settings);
+
+    build::CompileCache cache;
+    if (use_cache) {
+        options.build.cache = &cache;
+    }
+    const perf::ProfileResult result = perf::run_profile(options);
+    if (use_cache) {
+        cache.flush();
+    }
+
+    // === Hot functions ===
+    const uint64_t total = perf::total_samples(result.stacks);
+    auto percent = [total](uint64_t samples) {
+        std::ostringstream text;
+        text << std::fixed << std::setprecision(1) << 100.0 * samples / total << '%';
+        return text.str();
+    };
+
+    std::cout << '\n' << colors::BOLD << std::right << std::setw(8) << "Self" << std::setw(8) << "Total"
+              << std::setw(9) << "Samples" << "  Function" << colors::RESET << '\n';
+    for (const auto& function : perf::hot_functions(result.stacks, options.top)) {
+        const double share = static_cast<double>(function.self) / total;
+        const char* color = share >= 0.2 ? colors::RED : share >= 0.05 ? colors::YELLOW : colors::RESET;
+        std::cout << color << std::setw(8) << percent(function.self) << colors::RESET
+                  << std::setw(8) << percent(function.total) << std::setw(9) << function.self
+                  << "  " << function.name << '\n';
+    }
+
+    std::cout << colors::CYAN << total << " samples via " << result.method << "; program exited with code "
+              << result.exit_code << colors::RESET << '\n'
+              << colors::GREEN << "Flame graph:   " << result.flamegraph.string() << '\n'
+              << "Folded stacks: " << result.folded.string() << colors::RESET << '\n';
+}
+
+std::string format_rate(double rate) {
+    if (rate < 0) {
+        return "-";
+    }
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(2) << rate * 100 << '%';
+    return text.str();
+}
+
+void print_valgrind_report(const perf::ValgrindProfile& profile, std::string_view sort, size_t top) {
+    const uint64_t total_ir = std::max<uint64_t>(1, profile.sum(profile.totals, {"Ir"}));
+    auto share = [total_ir](uint64_t value) {
+        std::ostringstream text;
+        text << std::fixed << std::setprecision(1) << 100.0 * value / total_ir << '%';
+        return text.str();
+    };
+
+    std::cout << '\n' << colors::BOLD << std::right << std::setw(14) << "Ir" << std::setw(8) << "Self";
+    if (profile.has_calls) {
+        std::cout << std::setw(8) << "Incl";
+    }
+    std::cout << std::setw(10) << "D1 miss" << std::setw(10) << "LL miss" << std::setw(12) << "Mispredicts"
+              << std::setw(10) << "Br miss" << "  Function" << colors::RESET << '\n';
+
+    for (const perf::FunctionCost* function : perf::hottest(profile, sort, top)) {
+        const uint64_t ir = profile.sum(function->self, {"Ir"});
+        const perf::CacheRates rates = perf::cache_rates(profile, function->self);
+        const char* color = ir * 5 >= total_ir ? colors::RED : ir * 20 >= total_ir ? colors::YELLOW : colors::RESET;
+        std::cout << std::setw(14) << ir << color << std::setw(8) << share(ir) << colors::RESET;
+        if (profile.has_calls) {
+            std::cout << std::setw(8) << share(profile.sum(function->inclusive, {"Ir"}));
+        }
+        std::cout << std::setw(10) << format_rate(rates.d1_miss) << std::setw(10) << format_rate(rates.ll_miss)
+                  << std::setw(12) << (rates.mispredict < 0 ? "-" : std::to_string(rates.mispredicts))
+                  << std::setw(10) << format_rate(rates.mispredict) << "  " << function->name << '\n';
+    }
+
+    const perf::CacheRates totals = perf::cache_rates(profile, profile.totals);
+    std::cout << colors::CYAN << "Total: " << profile.sum(profile.totals, {"Ir"}) << " instructions; D1 miss "
+              << format_rate(totals.d1_miss) << ", LL miss " << format_rate(totals.ll_miss)
+              << ", branch mispredict " << format_rate(totals.mispredict) << colors::RESET << '\n';
+}
+
+void print_valgrind_diff(const perf::ProfileDiff& diff, size_t top) {
+    auto event_index = [&diff](std::string_view name) {
+        auto it = std::find(diff.events.begin(), diff.events.end(), name);
+        return it == diff.events.end() ? SIZE_MAX : static_cast<size_t>(it - diff.events.begin());
+    };
+    auto delta = [&](const std::vector<uint64_t>& before, const std::vector<uint64_t>& after,
+                     std::initializer_list<std::string_view> names) -> std::string {
+        int64_t change = 0;
+        bool found = false;
+        for (std::string_view name : names) {
+            const size_t index = event_index(name);
+            if (index != SIZE_MAX) {
+                change += static_cast<int64_t>(after[index]) - static_cast<int64_t>(before[index]);
+                found = true;
+            }
+        }
+        if (!found) {
+            return "-";
+        }
+        return (change > 0 ? "+" : "") + std::to_string(change);
+    };
+    auto print_row = [&](const std::vector<uint64_t>& before, const std::vector<uint64_t>& after,
+                         const std::string& name) {
+        // The first shared event ranks the rows; it is Ir whenever both runs have it
+        const int64_t change = static_cast<int64_t>(after[0]) - static_cast<int64_t>(before[0]);
+        std::ostringstream percent;
+        if (before[0] > 0) {
+            percent << std::showpos << std::fixed << std::setprecision(1) << 100.0 * change / before[0] << '%';
+        } else {
+            percent << "new";
+        }
+        const char* color = change > 0 ? colors::RED : change < 0 ? colors::GREEN : colors::RESET;
+        std::cout << std::setw(14) << before[0] << std::setw(14) << after[0] << color << std::setw(9)
+                  << percent.str() << colors::RESET << std::setw(12) << delta(before, after, {"D1mr", "D1mw"})
+                  << std::setw(12) << delta(before, after, {"ILmr", "DLmr", "DLmw"})
+                  << std::setw(12) << delta(before, after, {"Bcm", "Bim"}) << "  " << name << '\n';
     };
 
-    for (const auto& dir : directories) {
-        if (!create_directory(dir)) {
+    std::cout << '\n' << colors::BOLD << std::right << std::setw(14) << diff.events[0] + " before"
+              << std::setw(14) << "after" << std::setw(9) << "change" << std::setw(12) << "D1 misses"
+              << std::setw(12) << "LL misses" << std::setw(12) << "Mispredicts" << "  Function"
+              << colors::RESET << '\n';
+    print_row(diff.before_totals, diff.after_totals, "(total)");
+    for (size_t i = 0; i < diff.functions.size() && i < top; ++i) {
+        print_row(diff.functions[i].before, diff.functions[i].after, diff.functions[i].name);
+    }
+    if (diff.functions.empty()) {
+        std::cout << colors::GREEN << "No per-function differences" << colors::RESET << '\n';
+    }
+}
+
+void run_valgrind(const CommandArgs& args) {
+    std::string tool;               // "cachegrind" or "callgrind"; memcheck via the Makefile otherwise
+    bool release = false;
+    bool diff = false;
+    std::vector<std::string> diff_files;
+    std::string sort;
+    size_t top = 20;
+    std::vector<std::string> program_args;
+    build::BuildOptions options;
+    bool use_cache = compile_cache_enabled();
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        const bool has_value = i + 1 < args.size();
+        if (arg == "--") {
+            program_args.assign(args.begin() + static_cast<std::ptrdiff_t>(i) + 1, args.end());
+            break;
+        } else if (arg == "--cache") {
+            tool = "cachegrind";
+        } else if (arg == "--calls") {
+            tool = "callgrind";
+        } else if (arg == "--release") {
+            release = true;
+        } else if (arg == "--diff") {
+            diff = true;
+            while (diff_files.size() < 2 && i + 1 < args.size() && args[i + 1].substr(0, 1) != "-") {
+                diff_files.emplace_back(args[++i]);
+            }
+        } else if (arg == "--sort" && has_value) {
+            sort = args[++i];
+        } else if (arg == "--top" && has_value) {
+            top = parse_job_count(args[++i]);
+        } else if (arg == "-j" && has_value) {
+            options.jobs = parse_job_count(args[++i]);
+        } else if (arg.substr(0, 2) == "-j" && arg.size() > 2) {
+            options.jobs = parse_job_count(arg.substr(2));
+        } else if (arg == "--no-cache") {
+            use_cache = false;
+        } else {
+            throw std::runtime_error("Unknown valgrind option '" + std::string(arg) + "'");
+        }
+    }
+
+    // Comparing two existing output files needs no build
+    if (!diff_files.empty()) {
+        if (diff_files.size() != 2 || !tool.empty()) {
+            throw std::runtime_error("Usage: valgrind --diff <old.out> <new.out>");
+        }
+        print_valgrind_diff(perf::diff_profiles(perf::load_valgrind_profile(diff_files[0]),
+                                                perf::load_valgrind_profile(diff_files[1])), top);
+        return;
+    }
+    if (tool.empty()) {
+        if (diff || release || !program_args.empty() || !sort.empty()) {
+            throw std::runtime_error("--release, --diff, --sort and program arguments need --cache or --calls");
+        }
+        execute_system_command("make valgrind", "Running with valgrind...");
+        return;
+    }
+
+    // Optimised code is what matters for cache behaviour; keep -g for function names
+    build::BuildConfig config = project_build_config(release ? build::Configuration::Release
+                                                             : build::Configuration::Debug,
+                                                     load_build_settings(config::ProjectConfig::load()));
+    if (release) {
+        config.name = "valgrind-release";
+        config.compile_flags.push_back("-g");
+        config.obj_dir = fs::path("build") / config.name / "obj";
+        config.binary = fs::path("build") / config.name / "bin" / config.binary.filename();
+    }
+    build::CompileCache cache;
+    if (use_cache) {
+        options.cache = &cache;
+    }
+    build::BuildEngine engine(std::move(config));
+    std::cout << colors::CYAN << "Compiling " << engine.config().name << " build..." << colors::RESET << '\n';
+    const bool built = engine.build(options).success;
+    if (use_cache) {
+        cache.flush();
+    }
+    if (!built) {
+        throw std::runtime_error(engine.config().name + " build failed");
+    }
+
+    // Keep the previous run next to the new one so --diff has something to compare with
+    const fs::path out_dir = "build/valgrind";
+    const fs::path output = out_dir / (tool + ".out");
+    const fs::path previous = out_dir / (tool + ".out.prev");
+    std::error_code ec;
+    fs::create_directories(out_dir, ec);
+    if (fs::exists(output, ec)) {
+        fs::rename(output, previous, ec);
+    }
+
+    std::vector<std::string> command = {"valgrind", "--tool=" + tool, "--cache-sim=yes", "--branch-sim=yes",
+                                        "--" + tool + "-out-file=" + output.string(),
+                                        "./" + engine.config().binary.string()};
+    command.insert(command.end(), program_args.begin(), program_args.end());
+    std::cout << colors::CYAN << "Running with " << tool << " (simulated caches and branch predictor)..."
+              << colors::RESET << '\n';
+    process::Options run_options;
+    run_options.capture_output = false;
+    const process::Result run = process::run(command, run_options);
+    if (!fs::exists(output, ec)) {
+        throw std::runtime_error(tool + " wrote no output (valgrind exited with code " +
+                                 std::to_string(run.exit_code) + ")");
+    }
+    if (run.exit_code != 0) {
+        std::cout << colors::YELLOW << "Warning: program exited with code " << run.exit_code
+                  << colors::RESET << '\n';
+    }
+
+    const perf::ValgrindProfile profile = perf::load_valgrind_profile(output);
+    print_valgrind_report(profile, sort, top);
+    std::cout << colors::GREEN << "Raw output: " << output.string() << colors::RESET << '\n';
+
+    if (diff) {
+        if (!fs::exists(previous, ec)) {
+            std::cout << colors::YELLOW << "No previous " << tool << " run to compare with" << colors::RESET << '\n';
             return;
         }
+        std::cout << colors::CYAN << "Compared with the previous run (" << previous.string() << "):"
+                  << colors::RESET << '\n';
+        print_valgrind_diff(perf::diff_profiles(perf::load_valgrind_profile(previous), profile), top);
     }
+}
 
-    // Create main.cpp
-    create_file(project_name + "/src/main.cpp",
-        "#include <iostream>\n\n"
-        "int main(int argc, char* argv[]) {\n"
-        "    // Suppress unused parameter warnings\n"
-        "    (void)argc;\n"
-        "    (void)argv;\n"
-        "    \n"
-        "    std::cout << \"Hello, " + project_name + "!\" << std::endl;\n"
-        "    return 0;\n"
-        "}\n"
-    );
+// Both throw std::runtime_error, so that batch creation (new --from-manifest)
+// can count the failures instead of reporting them from the worker threads
+void create_file(const fs::path& path, std::string_view content) {
+    std::ofstream file(path);
+    if (!file) {
+        throw std::runtime_error("Could not create file " + path.string());
+    }
+    file << content;
+    file.close();
+    if (!file) {
+        throw std::runtime_error("Could not write file " + path.string());
+    }
+}
 
-    // Create Makefile
-    const std::string makefile_content = 
-        "CXX = g++\n"
-        "CXXFLAGS = -std=c++17\n"
-        "SRC = $(wildcard src/*.cpp)\n"
-        "INCLUDES = -Iinclude\n\n"
-
-        "# === Debug configuration ===\n"
-        "DBG_FLAGS = -Wall -Wextra -Wpedantic $(INCLUDES) -g -DDEBUG\n"
-        "DBG_OBJ = $(patsubst src/%.cpp, build/debug/obj/%.o, $(SRC))\n"
-        "DBG_BIN = build/debug/bin/" + project_name + "\n\n"
-
-        "# === Release configuration ===\n"
-        "REL_FLAGS = -Wall -Wextra $(INCLUDES) -O2 -DNDEBUG\n"
-        "REL_OBJ = $(patsubst src/%.cpp, build/release/obj/%.o, $(SRC))\n"
-        "REL_BIN = build/release/bin/" + project_name + "\n\n"
-
-        "# Libraries\n"
-        "LIBS_DEBUG = \n"
-        "LIBS_RELEASE = \n\n"
-
-        "# Default target\n"
-        ".PHONY: all clean run run-release test valgrind\n\n"
-
-        "all: $(DBG_BIN)\n\n"
-
-        "# Debug build\n"
-        "$(DBG_BIN): $(DBG_OBJ)\n"
-        "\t@mkdir -p $(dir $@)\n"
-        "\t$(CXX) $(CXXFLAGS) $(DBG_FLAGS) -o $@ $^ $(LIBS_DEBUG)\n"
-        "\t@echo \"Debug build complete: $@\"\n\n"
-
-        "build/debug/obj/%.o: src/%.cpp\n"
-        "\t@mkdir -p $(dir $@)\n"
-        "\t$(CXX) $(CXXFLAGS) $(DBG_FLAGS) -c $< -o $@\n\n"
-
-        "# Release build\n"
-        "release: $(REL_BIN)\n\n"
-
-        "$(REL_BIN): $(REL_OBJ)\n"
-        "\t@mkdir -p $(dir $@)\n"
-        "\t$(CXX) $(CXXFLAGS) $(REL_FLAGS) -o $@ $^ $(LIBS_RELEASE)\n"
-        "\t@echo \"Release build complete: $@\"\n\n"
-
-        "build/release/obj/%.o: src/%.cpp\n"
-        "\t@mkdir -p $(dir $@)\n"
-        "\t$(CXX) $(CXXFLAGS) $(REL_FLAGS) -c $< -o $@\n\n"
-
-        "# Test target\n"
-        "test: build/debug/bin/test_runner\n"
-        "\t@echo \"Running tests...\"\n"
-        "\t@./build/debug/bin/test_runner\n\n"
-
-        "build/debug/bin/test_runner: tests/test_math.cpp\n"
-        "\t@mkdir -p $(dir $@)\n"
-        "\t$(CXX) $(CXXFLAGS) $(DBG_FLAGS) -Itests -o $@ $<\n\n"
-
-        "# Valgrind target\n"
-        "valgrind: $(DBG_BIN)\n"
-        "\t@echo \"Running with valgrind...\"\n"
-        "\tvalgrind --leak-check=full --track-origins=yes --show-leak-kinds=all ./$(DBG_BIN)\n\n"
-
-        "# Run targets\n"
-        "run: $(DBG_BIN)\n"
-        "\t@echo \"Running debug build...\"\n"
-        "\t@./$(DBG_BIN)\n\n"
-
-        "run-release: $(REL_BIN)\n"
-        "\t@echo \"Running release build...\"\n"
-        "\t@./$(REL_BIN)\n\n"
-
-        "# Clean target\n"
-        "clean:\n"
-        "\t@echo \"Cleaning build files...\"\n"
-        "\t@rm -rf build\n\n"
-
-        "# Help target\n"
-        "help:\n"
-        "\t@echo \"Available targets:\"\n"
-        "\t@echo \"  all        - Build debug version (default)\"\n"
-        "\t@echo \"  release    - Build release version\"\n"
-        "\t@echo \"  run        - Build and run debug version\"\n"
-        "\t@echo \"  run-release- Build and run release version\"\n"
-        "\t@echo \"  test       - Build and run tests\"\n"
-        "\t@echo \"  valgrind   - Run debug build with valgrind\"\n"
-        "\t@echo \"  clean      - Remove build files\"\n"
-        "\t@echo \"  help       - Show this help\"\n";
-
-    create_file(project_name + "/Makefile", makefile_content);
-
-    // Create test file
-    create_file(project_name + "/tests/test_math.cpp",
-        "#include <cassert>\n"
-        "#include <iostream>\n\n"
-        "// Simple test framework\n"
-        "void test_basic_math() {\n"
-        "    assert(2 + 2 == 4);\n"
-        "    assert(5 * 3 == 15);\n"
-        "    assert(10 - 7 == 3);\n"
-        "    std::cout << \"✓ Basic math tests passed\" << std::endl;\n"
-        "}\n\n"
-        "int main() {\n"
-        "    std::cout << \"Running tests...\" << std::endl;\n"
-        "    \n"
-        "    try {\n"
-        "        test_basic_math();\n"
-        "        std::cout << \"\\n✅ All tests passed!\" << std::endl;\n"
-        "        return 0;\n"
-        "    } catch (const std::exception& e) {\n"
-        "        std::cout << \"❌ Test failed: \" << e.what() << std::endl;\n"
-        "        return 1;\n"
-        "    }\n"
-        "}\n"
-    );
+void create_directory(const fs::path& path) {
+    std::error_code ec;
+    if (!fs::create_directories(path, ec) && ec) {
+        throw std::runtime_error("Could not create directory " + path.string() + ": " + ec.message());
+    }
+}
+
+// templates/default: what 'new' writes without --template
+constexpr char DEFAULT_TEMPLATE[] = "default";
+// templates/_common: files written into every project (cppstarter.mk, the
+// Makefile rules shared by all templates). Ids starting with '_' are not
+// templates of their own.
+constexpr char COMMON_TEMPLATE[] = "_common";
+
+bool is_shared_template(std::string_view id) {
+    return !id.empty() && id.front() == '_';
+}
+
+// Options accepted by 'new' after the project name
+struct ProjectOptions {
+    bool init_git = false;
+    bool pch = false;       // Enable the precompiled header in the Makefile and cppstarter.conf
+    std::string template_id;    // Bundled template from templates/; empty for the default project
+    bool quiet = false;         // Batch mode: no progress or next-steps output
+    const scaffold::GitIdentity* git_identity = nullptr;    // Shared by a batch; read on demand otherwise
+};
+
+ProjectOptions parse_project_options(const CommandArgs& args) {
+    ProjectOptions options;
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        if (arg == "--init-git") {
+            options.init_git = true;
+        } else if (arg == "--pch") {
+            options.pch = true;
+        } else if (arg == "--template" && i + 1 < args.size()) {
+            options.template_id = args[++i];
+        } else {
+            throw std::runtime_error("Unknown option for 'new': '" + std::string(arg) + "'");
+        }
+    }
+    if (is_shared_template(options.template_id)) {
+        throw std::runtime_error("'" + options.template_id + "' holds files shared by every project; it is not a template");
+    }
+    if (options.pch && !options.template_id.empty() && options.template_id != DEFAULT_TEMPLATE) {
+        throw std::runtime_error("--pch applies to the default project; templates take 'make PCH=1'");
+    }
+    return options;
+}
+
+void list_templates() {
+    const scaffold::TemplatePack pack(scaffold::embedded_templates());
+    std::cout << colors::GREEN << "Bundled templates (cppstarter new <name> --template <id>):" << colors::RESET << '\n';
+    for (std::string_view id : pack.ids()) {
+        if (is_shared_template(id)) {
+            continue;
+        }
+        std::cout << "  " << id << " (" << pack.files(id).size() << " files)\n";
+    }
+}
+
+void finish_project(const std::string& project_name, const ProjectOptions& options);
+
+// Throws std::runtime_error when the project cannot be created
+void create_project(const std::string& project_name, const ProjectOptions& options = {}) {
+    if (project_name.empty()) {
+        throw std::runtime_error("Project name cannot be empty");
+    }
+
+    if (fs::exists(project_name)) {
+        throw std::runtime_error("Directory '" + project_name + "' already exists");
+    }
+
+    const std::string template_id = options.template_id.empty() ? DEFAULT_TEMPLATE : options.template_id;
+    const scaffold::TemplatePack pack(scaffold::embedded_templates());
+    pack.files(template_id);    // Unknown ids fail before anything is created
+    if (!options.quiet) {
+        std::cout << colors::CYAN << "Creating project '" << project_name << "'";
+        if (!options.template_id.empty()) {
+            std::cout << " from template '" << template_id << "'";
+        }
+        std::cout << "..." << colors::RESET << '\n';
+    }
+    const scaffold::Variables variables = {{"project_name", project_name},
+                                           {"pch", options.pch ? "1" : "0"},
+                                           {"pch_enabled", options.pch ? "true" : "false"}};
+    scaffold::write_template(pack, template_id, project_name, variables);
+    scaffold::write_template(pack, COMMON_TEMPLATE, project_name, variables);
 
-    // Create README
-    const std::string readme_content = "# " + project_name + "\n\n"
-        "This is an automatically generated C++ project using modern C++17 standards.\n\n"
-        "## Quick Start\n\n"
-        "```bash\n"
-        "# Build and run debug version\n"
-        "make run\n\n"
-        "# Build and run release version\n"
-        "make run-release\n\n"
-        "# Run tests\n"
-        "make test\n\n"
-        "# Memory analysis with valgrind\n"
-        "make valgrind\n"
-        "```\n\n"
-        "## Build System\n\n"
-        "This project uses a Makefile with the following targets:\n\n"
-        "- `make` or `make all` - Build debug version\n"
-        "- `make release` - Build optimized release version\n"
-        "- `make run` - Build and run debug version\n"
-        "- `make run-release` - Build and run release version\n"
-        "- `make test` - Build and run tests\n"
-        "- `make valgrind` - Run debug build with memory analysis\n"
-        "- `make clean` - Remove all build files\n"
-        "- `make help` - Show available targets\n\n"
-        "## Project Structure\n\n"
-        "```\n" + project_name + "/\n"
-        "├── src/           # Source files\n"
-        "├── include/       # Header files\n"
-        "├── tests/         # Test files\n"
-        "├── build/         # Build artifacts (auto-generated)\n"
-        "├── Makefile       # Build configuration\n"
-        "└── README.md      # This file\n"
-        "```\n\n"
-        "## Compiler Flags\n\n"
-        "- **Debug**: `-Wall -Wextra -Wpedantic -g -DDEBUG`\n"
-        "- **Release**: `-Wall -Wextra -O2 -DNDEBUG`\n"
-        "- **Standard**: C++17\n\n"
-        "## Dependencies\n\n"
-        "- GCC/Clang with C++17 support\n"
-        "- Make\n"
-        "- Valgrind (optional, for memory analysis)\n";
-
-    create_file(project_name + "/README.md", readme_content);
+    if (template_id == DEFAULT_TEMPLATE) {
+        // Empty directories have no files in the blob
+        create_directory(project_name + "/include");
+        create_directory(project_name + "/build");
+        // The benchmark harness stays in bench_files.cpp, where its tests compile it
+        create_directory(project_name + "/bench");
+        scaffold::write_file(project_name + "/bench/bench.hpp", scaffold::BENCH_HARNESS_HPP);
+        scaffold::write_file(project_name + "/bench/bench_example.cpp", scaffold::BENCH_EXAMPLE_CPP);
+        scaffold::write_file(project_name + "/bench/bench_main.cpp", scaffold::BENCH_MAIN_CPP);
+    }
+    finish_project(project_name, options);
+}
 
+// Steps shared by the default project and the bundled templates
+void finish_project(const std::string& project_name, const ProjectOptions& options) {
     // Create .gitignore
     create_file(project_name + "/.gitignore", 
         "# Build artifacts\n"
@@ -349,17 +2188,37 @@ void create_project(const std::string& project_name, bool init_git = false) {
 
         "# Temporary files\n"
         "*.tmp\n"
-        "*.temp\n"
+        "*.temp\n\n"
+
+        "# Local build history (cppstarter build --analyze)\n"
+        "/.buildstats/\n"
     );
 
-    // Initialize git if requested
-    if (init_git) {
-        std::string git_cmd = "cd " + project_name + " && git init && git add . && git commit -m \"Initial commit\"";
-        if (execute_system_command(git_cmd, "Initializing git repository...")) {
-            std::cout << colors::GREEN << "Git repository initialized with initial commit" << colors::RESET << '\n';
+    // Initialize git if requested. The repository is written directly
+    // (objects, index, refs) instead of forking git three times per project.
+    if (options.init_git) {
+        try {
+            scaffold::GitIdentity identity;
+            if (!options.git_identity) {
+                identity = scaffold::read_git_identity();
+            }
+            scaffold::git_init_commit(project_name, options.git_identity ? *options.git_identity : identity,
+                                      "Initial commit");
+            if (!options.quiet) {
+                std::cout << colors::GREEN << "Git repository initialized with initial commit" << colors::RESET << '\n';
+            }
+        } catch (const std::exception& e) {
+            if (options.quiet) {
+                throw;
+            }
+            std::cout << colors::RED << "Error: Could not initialize git repository: " << e.what()
+                      << colors::RESET << '\n';
         }
     }
 
+    if (options.quiet) {
+        return;
+    }
     std::cout << colors::GREEN 
               << "✅ Project '" << project_name << "' created successfully!" << colors::RESET << '\n';
     std::cout << colors::CYAN 
@@ -368,6 +2227,163 @@ void create_project(const std::string& project_name, bool init_git = false) {
               << "  make run" << colors::RESET << '\n';
 }
 
+// One manifest line: "<name> [new options...]"
+struct ManifestEntry {
+    std::string name;
+    ProjectOptions options;
+};
+
+std::vector<ManifestEntry> read_manifest(const fs::path& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Could not read manifest " + path.string());
+    }
+    std::vector<ManifestEntry> entries;
+    std::unordered_map<std::string, size_t> seen;
+    std::string line;
+    for (size_t number = 1; std::getline(file, line); ++number) {
+        line = line.substr(0, line.find('#'));
+        std::istringstream words_in(line);
+        std::vector<std::string> words;
+        for (std::string word; words_in >> word;) {
+            words.push_back(word);
+        }
+        if (words.empty()) {
+            continue;
+        }
+        const std::string where = path.string() + ":" + std::to_string(number) + ": ";
+        try {
+            entries.push_back({words[0], parse_project_options(CommandArgs(words.begin() + 1, words.end()))});
+        } catch (const std::exception& e) {
+            throw std::runtime_error(where + e.what());
+        }
+        if (!seen.emplace(words[0], number).second) {
+            throw std::runtime_error(where + "'" + words[0] + "' is already listed on line " +
+                                     std::to_string(seen[words[0]]));
+        }
+        if (fs::exists(words[0])) {
+            throw std::runtime_error(where + "directory '" + words[0] + "' already exists");
+        }
+    }
+    if (entries.empty()) {
+        throw std::runtime_error("Manifest " + path.string() + " lists no projects");
+    }
+    return entries;
+}
+
+// Workspace Makefile that builds every member in parallel under one jobserver
+// (`make -j8`, `make -j8 test`). Written to Makefile, or to workspace.mk when
+// the directory already has a Makefile that is not ours.
+void write_workspace_makefile(const std::vector<ManifestEntry>& entries, const fs::path& manifest) {
+    const std::string marker = "# Generated by cppstarter new --from-manifest";
+    auto is_ours = [&marker](const fs::path& path) {
+        std::ifstream file(path);
+        std::string first_line;
+        return !file || (std::getline(file, first_line) && first_line.rfind(marker, 0) == 0);
+    };
+    fs::path target = "Makefile";
+    if (!is_ours(target)) {
+        target = "workspace.mk";
+        if (!is_ours(target)) {
+            std::cout << colors::YELLOW << "Warning: Makefile and workspace.mk exist and were not generated by "
+                      << "cppstarter; no workspace Makefile written" << colors::RESET << '\n';
+            return;
+        }
+    }
+
+    std::string projects;
+    for (const auto& entry : entries) {
+        projects += " \\\n    " + entry.name;
+    }
+    create_file(target,
+        marker + " " + manifest.string() + "\n"
+        "# `make -jN [all|release|test|clean]` runs that target in every project.\n\n"
+        "PROJECTS :=" + projects + "\n\n"
+        "MEMBER_GOAL ?= all\n\n"
+        ".PHONY: all release test clean $(PROJECTS)\n\n"
+        "all: $(PROJECTS)\n\n"
+        "release test clean:\n"
+        "\t+@$(MAKE) --no-print-directory -f $(firstword $(MAKEFILE_LIST)) MEMBER_GOAL=$@ $(PROJECTS)\n\n"
+        "$(PROJECTS):\n"
+        "\t+$(MAKE) -C $@ $(MEMBER_GOAL)\n"
+    );
+    std::cout << colors::CYAN << "Workspace Makefile: " << target.string()
+              << (target == "Makefile" ? "" : " (make -f workspace.mk)") << colors::RESET << '\n';
+}
+
+// new --from-manifest <file> [-j N]
+void create_projects_from_manifest(const CommandArgs& args) {
+    fs::path manifest;
+    unsigned jobs = utils::default_job_count();
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string_view arg = args[i];
+        if (arg == "-j" && i + 1 < args.size()) {
+            jobs = parse_job_count(args[++i]);
+        } else if (arg.size() > 2 && arg.substr(0, 2) == "-j") {
+            jobs = parse_job_count(arg.substr(2));
+        } else if (manifest.empty() && !arg.empty() && arg[0] != '-') {
+            manifest = arg;
+        } else {
+            throw std::runtime_error("Unknown option for 'new --from-manifest': '" + std::string(arg) + "'");
+        }
+    }
+    if (manifest.empty()) {
+        throw std::runtime_error("'new --from-manifest' requires a manifest file");
+    }
+
+    const auto started = std::chrono::steady_clock::now();
+    std::vector<ManifestEntry> entries = read_manifest(manifest);
+
+    // Checked up front so a bad template or missing identity fails before anything is created
+    const scaffold::TemplatePack pack(scaffold::embedded_templates());
+    bool init_git = false;
+    for (const auto& entry : entries) {
+        if (!entry.options.template_id.empty()) {
+            pack.files(entry.options.template_id);
+        }
+        init_git = init_git || entry.options.init_git;
+    }
+    scaffold::GitIdentity identity;
+    if (init_git) {
+        identity = scaffold::read_git_identity();
+    }
+
+    std::cout << colors::CYAN << "Creating " << entries.size() << " projects from " << manifest.string()
+              << " with " << jobs << " worker" << (jobs == 1 ? "" : "s") << "..." << colors::RESET << '\n';
+
+    std::mutex errors_mutex;
+    std::vector<std::string> errors;
+    {
+        utils::ThreadPool pool(jobs);
+        for (auto& entry : entries) {
+            entry.options.quiet = true;
+            entry.options.git_identity = &identity;
+            pool.submit([&entry, &errors, &errors_mutex] {
+                try {
+                    create_project(entry.name, entry.options);
+                } catch (const std::exception& e) {
+                    std::lock_guard<std::mutex> lock(errors_mutex);
+                    errors.push_back(entry.name + ": " + e.what());
+                }
+            });
+        }
+        pool.wait();
+    }
+
+    write_workspace_makefile(entries, manifest);
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    if (!errors.empty()) {
+        for (const auto& error : errors) {
+            std::cout << colors::RED << "  " << error << colors::RESET << '\n';
+        }
+        throw std::runtime_error(std::to_string(errors.size()) + " of " + std::to_string(entries.size()) +
+                                 " projects failed");
+    }
+    std::cout << colors::GREEN << "✅ Created " << entries.size() << " projects in " << std::fixed
+              << std::setprecision(2) << seconds << "s" << colors::RESET << '\n';
+}
+
 void create_min_sh() {
     try {
         std::ofstream script("min.sh");
@@ -415,15 +2431,23 @@ int main(int argc, char* argv[]) {
         if (argc < 3) {
             std::cout << colors::RED 
                       << "Error: 'new' command requires a project name\n"
-                      << "Usage: " << argv[0] << " new <ProjectName> [--init-git]"
+                      << "Usage: " << argv[0] << " new <ProjectName> [--init-git] [--pch] [--template <id>]\n"
+                      << "       " << argv[0] << " new --from-manifest <file> [-j N]"
                       << colors::RESET << '\n';
             return 1;
         }
         
         std::string project_name = argv[2];
-        bool init_git = (argc > 3 && std::string(argv[3]) == "--init-git");
-        
-        create_project(project_name, init_git);
+        try {
+            if (project_name == "--from-manifest") {
+                create_projects_from_manifest(CommandArgs(argv + 3, argv + argc));
+                return 0;
+            }
+            create_project(project_name, parse_project_options(CommandArgs(argv + 3, argv + argc)));
+        } catch (const std::exception& e) {
+            std::cout << colors::RED << "Error: " << e.what() << colors::RESET << '\n';
+            return 1;
+        }
         return 0;
     }
 
@@ -431,7 +2455,7 @@ int main(int argc, char* argv[]) {
     auto it = commands.find(command);
     if (it != commands.end()) {
         try {
-            it->second(); // Execute the command handler
+            it->second(CommandArgs(argv + 2, argv + argc)); // Execute the command handler
         } catch (const std::exception& e) {
             std::cout << colors::RED 
                       << "Error executing command: " << e.what() 
@@ -0,0 +1,178 @@
+#include "perf/perfgate.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "utils/process.hpp"
+
+namespace perf {
+
+namespace {
+
+constexpr char BASELINE_HEADER[] = "# cppstarter perfgate baseline v1";
+
+std::string read_first_line(const fs::path& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+} // namespace
+
+Environment read_environment() {
+    Environment environment;
+    environment.governor = read_first_line("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor");
+
+    // intel_pstate reports the inverse ("no_turbo"); acpi-cpufreq and amd-pstate expose "boost"
+    const std::string no_turbo = read_first_line("/sys/devices/system/cpu/intel_pstate/no_turbo");
+    const std::string boost = read_first_line("/sys/devices/system/cpu/cpufreq/boost");
+    if (!no_turbo.empty()) {
+        environment.turbo = no_turbo == "0" ? 1 : 0;
+    } else if (!boost.empty()) {
+        environment.turbo = boost == "1" ? 1 : 0;
+    }
+
+    std::istringstream(read_first_line("/proc/loadavg")) >> environment.load;
+    environment.cpus = std::max(1u, std::thread::hardware_concurrency());
+    return environment;
+}
+
+std::vector<std::string> noise_notes(const Environment& now, const Environment* baseline) {
+    std::vector<std::string> notes;
+    if (!now.governor.empty() && now.governor != "performance") {
+        notes.push_back("CPU governor is '" + now.governor + "'; frequency scaling adds variance "
+                        "(use 'cpupower frequency-set -g performance' on benchmark machines)");
+    }
+    if (now.turbo == 1) {
+        notes.push_back("Turbo boost is enabled; clock speed depends on temperature and other load");
+    }
+    if (now.load > 0.5 * now.cpus) {
+        std::ostringstream note;
+        note << "Load average is " << now.load << " on " << now.cpus
+             << " CPUs; other processes (noisy neighbours) may skew the timings";
+        notes.push_back(note.str());
+    }
+    if (baseline) {
+        if (baseline->governor != now.governor) {
+            notes.push_back("Baseline was recorded with governor '" + baseline->governor +
+                            "', now '" + now.governor + "'");
+        }
+        if (baseline->turbo != now.turbo) {
+            notes.push_back("Turbo boost setting differs from when the baseline was recorded");
+        }
+        if (baseline->cpus != now.cpus) {
+            notes.push_back("Baseline was recorded on a machine with " + std::to_string(baseline->cpus) +
+                            " CPUs, this one has " + std::to_string(now.cpus));
+        }
+    }
+    return notes;
+}
+
+const std::vector<double>* Baseline::find(const std::string& command) const {
+    for (const auto& [line, samples] : commands) {
+        if (line == command) {
+            return &samples;
+        }
+    }
+    return nullptr;
+}
+
+fs::path baseline_path(const std::string& name) {
+    return fs::path(".perfgate") / (name + ".baseline");
+}
+
+Baseline load_baseline(const std::string& name) {
+    const fs::path path = baseline_path(name);
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("No baseline '" + name + "' (expected " + path.string() +
+                                 "); record one with --save-baseline");
+    }
+
+    Baseline baseline;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        fields >> key;
+        if (key == "governor") {
+            fields >> baseline.environment.governor;
+        } else if (key == "turbo") {
+            fields >> baseline.environment.turbo;
+        } else if (key == "load") {
+            fields >> baseline.environment.load;
+        } else if (key == "cpus") {
+            fields >> baseline.environment.cpus;
+        } else if (key == "command") {
+            baseline.commands.push_back({line.substr(key.size() + 1), {}});
+        } else if (key == "samples" && !baseline.commands.empty()) {
+            double value = 0.0;
+            while (fields >> value) {
+                baseline.commands.back().second.push_back(value);
+            }
+        }
+    }
+    return baseline;
+}
+
+void save_baseline(const std::string& name, const Baseline& baseline) {
+    const fs::path path = baseline_path(name);
+    std::error_code ec;
+    fs::create_directories(path.parent_path(), ec);
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Could not write " + path.string());
+    }
+    file << BASELINE_HEADER << '\n'
+         << "governor " << baseline.environment.governor << '\n'
+         << "turbo " << baseline.environment.turbo << '\n'
+         << "load " << baseline.environment.load << '\n'
+         << "cpus " << baseline.environment.cpus << '\n';
+    file.precision(9);
+    for (const auto& [command, samples] : baseline.commands) {
+        file << "command " << command << "\nsamples";
+        for (double value : samples) {
+            file << ' ' << value;
+        }
+        file << '\n';
+    }
+}
+
+std::vector<double> measure(const std::vector<std::string>& argv, unsigned runs, unsigned warmup) {
+    std::vector<double> samples;
+    for (unsigned i = 0; i < warmup + runs; ++i) {
+        process::Result result = process::run(argv);
+        if (result.exit_code != 0) {
+            throw std::runtime_error("'" + process::join_command(argv) + "' exited with code " +
+                                     std::to_string(result.exit_code));
+        }
+        if (i >= warmup) {
+            samples.push_back(result.wall_seconds);
+        }
+    }
+    return samples;
+}
+
+Comparison compare(const std::vector<double>& baseline, const std::vector<double>& current,
+                   double threshold, double alpha) {
+    Comparison comparison;
+    comparison.baseline = summarize(baseline);
+    comparison.current = summarize(current);
+    comparison.test = mann_whitney_u(baseline, current);
+    if (comparison.baseline.median > 0) {
+        comparison.delta = comparison.current.median / comparison.baseline.median - 1.0;
+    }
+
+    if (comparison.test.p_value < alpha && std::abs(comparison.delta) > threshold) {
+        comparison.verdict = comparison.delta > 0 ? Verdict::Slower : Verdict::Faster;
+    }
+    return comparison;
+}
+
+} // namespace perf
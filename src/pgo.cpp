@@ -0,0 +1,306 @@
+#include "build/pgo.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "build/build_analysis.hpp"
+#include "utils/colors.hpp"
+#include "utils/hash.hpp"
+#include "utils/process.hpp"
+
+namespace build {
+
+namespace {
+
+// Instrumented and baseline trees live next to the regular configurations
+BuildConfig derived_config(const BuildConfig& release, const std::string& name) {
+    BuildConfig config = release;
+    config.name = name;
+    config.obj_dir = fs::path("build") / name / "obj";
+    config.binary = fs::path("build") / name / "bin" / config.binary.filename();
+    return config;
+}
+
+// The test runner needs the release compiler and flags too, or its profile
+// would not match the release objects; keep only what the test configuration adds.
+BuildConfig instrumented_test_config(const BuildConfig& release) {
+    BuildConfig config = make_config(Configuration::Test);
+    config.name = "pgo-test";
+    config.obj_dir = fs::path("build") / config.name / "obj";
+    config.binary = fs::path("build") / config.name / "bin" / config.binary.filename();
+    config.compiler = release.compiler;
+    const auto debug_flags = make_config(Configuration::Debug).compile_flags;
+    std::vector<std::string> flags = release.compile_flags;
+    for (const auto& flag : config.compile_flags) {
+        if (std::find(debug_flags.begin(), debug_flags.end(), flag) == debug_flags.end()) {
+            flags.push_back(flag);
+        }
+    }
+    config.compile_flags = flags;
+    return config;
+}
+
+// GCC: .gcda names are the object paths with the tree prefix stripped and
+// '/' mangled to '#', so build/pgo-gen/obj/foo.o and build/release/obj/foo.o
+// both map to build/pgo-data/obj#foo.gcda, and libgcov merges every run
+// into them. Clang: each run writes a .profraw (LLVM_PROFILE_FILE) that
+// llvm-profdata merges into one .profdata before the optimized build.
+std::vector<std::string> generate_flags(bool clang, const fs::path& tree) {
+    if (clang) {
+        return {"-fprofile-instr-generate"};
+    }
+    return {
+        "-fprofile-generate",
+        "-fprofile-dir=" + fs::absolute(pgo_data_dir()).string(),
+        "-fprofile-prefix-path=" + fs::absolute(tree).string(),
+        "-fprofile-update=atomic"
+    };
+}
+
+fs::path merged_profile() {
+    return pgo_data_dir() / "merged.profdata";
+}
+
+std::vector<std::string> use_flags(bool clang, const fs::path& tree) {
+    if (clang) {
+        return {
+            "-fprofile-instr-use=" + fs::absolute(merged_profile()).string(),
+            "-Wno-profile-instr-unprofiled",
+            "-Wno-profile-instr-out-of-date"
+        };
+    }
+    return {
+        "-fprofile-use",
+        "-fprofile-dir=" + fs::absolute(pgo_data_dir()).string(),
+        "-fprofile-prefix-path=" + fs::absolute(tree).string(),
+        "-fprofile-partial-training",
+        "-Wno-missing-profile"
+    };
+}
+
+fs::path profile_path_for(const fs::path& object, const fs::path& tree) {
+    std::string mangled = object.lexically_relative(tree).replace_extension(".gcda").generic_string();
+    std::replace(mangled.begin(), mangled.end(), '/', '#');
+    return pgo_data_dir() / mangled;
+}
+
+std::vector<fs::path> recorded_profiles() {
+    std::vector<fs::path> profiles;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(pgo_data_dir(), ec)) {
+        const fs::path extension = entry.path().extension();
+        if (extension == ".gcda" || extension == ".profraw" || extension == ".profdata") {
+            profiles.push_back(entry.path());
+        }
+    }
+    return profiles;
+}
+
+// llvm-profdata from the compiler's own LLVM release first: clang++-14 pairs with llvm-profdata-14
+std::string find_llvm_profdata(const std::string& compiler) {
+    std::vector<std::string> candidates;
+    const std::string name = fs::path(compiler).filename().string();
+    if (const size_t dash = name.rfind('-'); dash != std::string::npos) {
+        candidates.push_back("llvm-profdata" + name.substr(dash));
+    }
+    candidates.emplace_back("llvm-profdata");
+    for (const auto& candidate : candidates) {
+        try {
+            if (process::run({candidate, "--version"}).exit_code == 0) {
+                return candidate;
+            }
+        } catch (const std::exception&) {
+            // Not installed; try the next one
+        }
+    }
+    throw std::runtime_error("PGO with clang needs llvm-profdata, which was not found in PATH");
+}
+
+std::string read_file(const fs::path& path) {
+    std::ifstream file(path);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+void build_or_throw(BuildConfig config, const BuildOptions& options) {
+    BuildEngine engine(std::move(config));
+    std::cout << colors::CYAN << "Compiling " << engine.config().name << " build..." << colors::RESET << '\n';
+    if (!engine.build(options).success) {
+        throw std::runtime_error(engine.config().name + " build failed");
+    }
+}
+
+double median_run_seconds(const fs::path& binary, const std::vector<std::string>& args, unsigned runs) {
+    std::vector<std::string> command = {fs::absolute(binary).string()};
+    command.insert(command.end(), args.begin(), args.end());
+
+    std::vector<double> times;
+    for (unsigned i = 0; i < runs; ++i) {
+        times.push_back(process::run(command).wall_seconds);
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+} // namespace
+
+fs::path pgo_data_dir() {
+    return "build/pgo-data";
+}
+
+std::string pgo_fingerprint(const BuildConfig& config) {
+    hash::Sha256 sha;
+    sha.update(config.compiler);
+    for (const auto& flag : config.compile_flags) {
+        sha.update("\0", 1);
+        sha.update(flag);
+    }
+
+    std::vector<fs::path> files = config.sources;
+    std::error_code ec;
+    for (const auto& entry : fs::recursive_directory_iterator("include", ec)) {
+        if (entry.is_regular_file(ec)) {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    for (const auto& file : files) {
+        sha.update("\0", 1);
+        sha.update(file.generic_string());
+        sha.update("\0", 1);
+        sha.update(read_file(file));
+    }
+    return sha.hex_digest();
+}
+
+PgoReport run_pgo_pipeline(const PgoOptions& options) {
+    PgoReport report;
+    const fs::path data = pgo_data_dir();
+    const fs::path fingerprint_file = data / "fingerprint";
+    const fs::path runs_file = data / "training-runs";
+    const fs::path stamp_file = data / "profile.stamp";
+    std::error_code ec;
+    fs::create_directories(data, ec);
+
+    const bool clang = compiler_is_clang(options.release.compiler);
+    const std::string profdata = clang ? find_llvm_profdata(options.release.compiler) : "";
+    BuildConfig release = options.release;
+    if (options.lto) {
+        release.compile_flags.push_back(clang ? "-flto=thin" : "-flto=auto");
+    }
+
+    // === Stale profile detection ===
+    const std::string fingerprint = pgo_fingerprint(options.release);
+    auto profiles = recorded_profiles();
+    if (!profiles.empty() && (options.reset || read_file(fingerprint_file) != fingerprint)) {
+        report.stale_profile = !options.reset;
+        if (report.stale_profile) {
+            std::cout << colors::YELLOW << "Warning: Sources changed since the profile was recorded; "
+                      << "discarding " << profiles.size() << " stale profile files" << colors::RESET << '\n';
+        }
+        for (const auto& profile : profiles) {
+            fs::remove(profile, ec);
+        }
+        fs::remove(runs_file, ec);
+    }
+    std::ofstream(fingerprint_file, std::ios::trunc) << fingerprint;
+
+    // === Baseline and instrumented builds ===
+    if (options.timing_runs > 0) {
+        build_or_throw(derived_config(options.release, "pgo-baseline"), options.build);
+    }
+
+    BuildConfig generate = derived_config(options.release, "pgo-gen");
+    auto flags = generate_flags(clang, fs::path("build") / generate.name);
+    generate.compile_flags.insert(generate.compile_flags.end(), flags.begin(), flags.end());
+    const fs::path instrumented = generate.binary;
+    build_or_throw(std::move(generate), options.build);
+
+    // === Training ===
+    std::vector<std::string> workloads = options.training;
+    if (workloads.empty()) {
+        workloads.push_back(process::join_command({instrumented.string()}));
+        for (const auto& arg : options.run_args) {
+            workloads.back() += ' ' + process::shell_quote(arg);
+        }
+    }
+
+    report.training_runs = static_cast<unsigned>(std::max(0, std::atoi(read_file(runs_file).c_str())));
+    for (const auto& workload : workloads) {
+        std::vector<std::string> command = {"/bin/sh", "-c", workload};
+        if (workload == PGO_TEST_WORKLOAD) {
+            BuildConfig tests = instrumented_test_config(options.release);
+            flags = generate_flags(clang, fs::path("build") / tests.name);
+            tests.compile_flags.insert(tests.compile_flags.end(), flags.begin(), flags.end());
+            command = {tests.binary.string()};
+            build_or_throw(std::move(tests), options.build);
+        }
+
+        std::cout << colors::CYAN << "Training: " << workload << colors::RESET << '\n';
+        process::Options run_options;
+        run_options.capture_output = false;
+        run_options.extra_env = {"CPPSTARTER_PGO_BINARY=" + fs::absolute(instrumented).string()};
+        if (clang) {
+            // %p: one file per process, so parallel children never share one
+            run_options.extra_env.push_back("LLVM_PROFILE_FILE=" + fs::absolute(data / "%p.profraw").string());
+        }
+        process::Result result = process::run(command, run_options);
+        if (result.exit_code != 0) {
+            // Counts are still written on a normal exit, so a failing test run is usable
+            std::cout << colors::YELLOW << "Warning: Training workload exited with code "
+                      << result.exit_code << colors::RESET << '\n';
+        }
+        ++report.training_runs;
+    }
+    std::ofstream(runs_file, std::ios::trunc) << report.training_runs << '\n';
+    std::ofstream(stamp_file, std::ios::trunc) << report.training_runs << '\n';
+
+    if (clang) {
+        std::vector<std::string> merge = {profdata, "merge", "-o", merged_profile().string()};
+        for (const auto& profile : recorded_profiles()) {
+            if (profile.extension() == ".profraw") {
+                merge.push_back(profile.string());
+            }
+        }
+        const process::Result merged = process::run(merge);
+        if (merged.exit_code != 0) {
+            throw std::runtime_error("llvm-profdata merge failed: " + merged.output);
+        }
+    }
+
+    // === Profile-guided release build ===
+    flags = use_flags(clang, "build/release");
+    release.compile_flags.insert(release.compile_flags.end(), flags.begin(), flags.end());
+    release.extra_inputs.push_back(stamp_file);   // New counts recompile every object
+
+    BuildEngine engine(release);
+    report.binary = engine.config().binary;
+    for (const auto& object : engine.objects()) {
+        ++report.total_units;
+        // The merged clang profile covers the whole program
+        if (clang ? fs::exists(merged_profile(), ec) : fs::exists(profile_path_for(object, "build/release"), ec)) {
+            ++report.profiled_units;
+        }
+    }
+    std::cout << colors::CYAN << "Compiling release build with profile data..." << colors::RESET << '\n';
+    if (!engine.build(options.build).success) {
+        throw std::runtime_error("release build failed");
+    }
+
+    // === Speedup ===
+    if (options.timing_runs > 0) {
+        std::cout << colors::CYAN << "Timing baseline and PGO binaries (" << options.timing_runs
+                  << " runs each)..." << colors::RESET << '\n';
+        report.baseline_seconds = median_run_seconds(
+            derived_config(options.release, "pgo-baseline").binary, options.run_args, options.timing_runs);
+        report.optimized_seconds = median_run_seconds(report.binary, options.run_args, options.timing_runs);
+    }
+    return report;
+}
+
+} // namespace build
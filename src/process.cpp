@@ -0,0 +1,171 @@
+#include "utils/process.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+namespace process {
+
+namespace {
+
+std::vector<std::string> build_environment(const std::vector<std::string>& extra_env) {
+    std::vector<std::string> env;
+    for (char** entry = environ; entry && *entry; ++entry) {
+        std::string_view current(*entry);
+        std::string_view key = current.substr(0, current.find('='));
+        bool overridden = false;
+        for (const auto& extra : extra_env) {
+            if (extra.compare(0, key.size() + 1, std::string(key) + "=") == 0) {
+                overridden = true;
+                break;
+            }
+        }
+        if (!overridden) {
+            env.emplace_back(current);
+        }
+    }
+    env.insert(env.end(), extra_env.begin(), extra_env.end());
+    return env;
+}
+
+std::vector<char*> to_c_array(std::vector<std::string>& strings) {
+    std::vector<char*> pointers;
+    pointers.reserve(strings.size() + 1);
+    for (auto& s : strings) {
+        pointers.push_back(s.data());
+    }
+    pointers.push_back(nullptr);
+    return pointers;
+}
+
+} // namespace
+
+Result run(const std::vector<std::string>& argv, const Options& options) {
+    if (argv.empty()) {
+        throw std::runtime_error("process::run called with an empty command");
+    }
+
+    std::vector<std::string> args = argv;
+    std::vector<char*> c_args = to_c_array(args);
+
+    std::vector<std::string> env;
+    std::vector<char*> c_env;
+    if (!options.extra_env.empty()) {
+        env = build_environment(options.extra_env);
+        c_env = to_c_array(env);
+    }
+
+    int pipe_fds[2] = {-1, -1};
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+
+    if (options.capture_output) {
+        if (pipe2(pipe_fds, O_CLOEXEC) != 0) {
+            posix_spawn_file_actions_destroy(&actions);
+            throw std::runtime_error(std::string("pipe2 failed: ") + std::strerror(errno));
+        }
+        posix_spawn_file_actions_adddup2(&actions, pipe_fds[1], STDOUT_FILENO);
+        posix_spawn_file_actions_adddup2(&actions, pipe_fds[1], STDERR_FILENO);
+    } else {
+        // The child writes straight to our stdout; keep it after what we already printed
+        std::cout.flush();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    pid_t pid = 0;
+    int rc = posix_spawnp(&pid, c_args[0], &actions, nullptr, c_args.data(),
+                          c_env.empty() ? environ : c_env.data());
+    posix_spawn_file_actions_destroy(&actions);
+
+    if (options.capture_output) {
+        close(pipe_fds[1]);
+    }
+    if (rc != 0) {
+        if (options.capture_output) {
+            close(pipe_fds[0]);
+        }
+        throw std::runtime_error("Could not start '" + argv[0] + "': " + std::strerror(rc));
+    }
+
+    Result result;
+    if (options.capture_output) {
+        char buffer[8192];
+        size_t line_start = 0;
+        for (;;) {
+            ssize_t n = read(pipe_fds[0], buffer, sizeof(buffer));
+            if (n > 0) {
+                result.output.append(buffer, static_cast<size_t>(n));
+                if (options.on_line) {
+                    for (size_t end; (end = result.output.find('\n', line_start)) != std::string::npos;) {
+                        options.on_line(std::string_view(result.output).substr(line_start, end - line_start));
+                        line_start = end + 1;
+                    }
+                }
+            } else if (n == 0 || errno != EINTR) {
+                break;
+            }
+        }
+        if (options.on_line && line_start < result.output.size()) {
+            options.on_line(std::string_view(result.output).substr(line_start));
+        }
+        close(pipe_fds[0]);
+    }
+
+    int status = 0;
+    struct rusage usage {};
+    while (wait4(pid, &status, 0, &usage) < 0) {
+        if (errno != EINTR) {
+            throw std::runtime_error(std::string("wait4 failed: ") + std::strerror(errno));
+        }
+    }
+
+    result.wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.max_rss_kb = usage.ru_maxrss;
+    if (WIFEXITED(status)) {
+        result.exit_code = WEXITSTATUS(status);
+    } else if (WIFSIGNALED(status)) {
+        result.exit_code = 128 + WTERMSIG(status);
+    }
+    return result;
+}
+
+std::string shell_quote(const std::string& arg) {
+    if (!arg.empty() && arg.find_first_not_of(
+            "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_-+=/.,:@%") == std::string::npos) {
+        return arg;
+    }
+    std::string quoted = "'";
+    for (char c : arg) {
+        if (c == '\'') {
+            quoted += "'\\''";
+        } else {
+            quoted += c;
+        }
+    }
+    quoted += '\'';
+    return quoted;
+}
+
+std::string join_command(const std::vector<std::string>& argv) {
+    std::string command;
+    for (const auto& arg : argv) {
+        if (!command.empty()) {
+            command += ' ';
+        }
+        command += shell_quote(arg);
+    }
+    return command;
+}
+
+} // namespace process
@@ -0,0 +1,408 @@
+#include "perf/profiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "utils/colors.hpp"
+#include "utils/process.hpp"
+
+namespace perf {
+
+namespace {
+
+// Compiled into profiling builds only. Without perf, SIGPROF fires every
+// 1/hz seconds of CPU time and the handler walks the frame-pointer chain
+// into a preallocated buffer; the stacks are written out at exit.
+constexpr std::string_view SAMPLER_SOURCE = R"SAMPLER(// Generated by cppstarter profile: built-in SIGPROF stack sampler.
+// Linked into profiling builds only; inactive unless CPPSTARTER_PROFILE_OUT is set.
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <pthread.h>
+#include <sys/time.h>
+#include <ucontext.h>
+
+namespace cppstarter_sampler {
+namespace {
+
+constexpr size_t MAX_DEPTH = 128;
+constexpr size_t BUFFER_WORDS = size_t(1) << 22;    // 32 MiB of return addresses, touched lazily
+
+uintptr_t buffer[BUFFER_WORDS];
+std::atomic<size_t> used{0};
+std::atomic<size_t> dropped{0};
+uintptr_t main_stack_low = 0;
+uintptr_t main_stack_high = 0;
+
+void handler(int, siginfo_t*, void* context) {
+    const ucontext_t* uc = static_cast<const ucontext_t*>(context);
+#if defined(__x86_64__)
+    uintptr_t pc = uintptr_t(uc->uc_mcontext.gregs[REG_RIP]);
+    uintptr_t fp = uintptr_t(uc->uc_mcontext.gregs[REG_RBP]);
+    uintptr_t sp = uintptr_t(uc->uc_mcontext.gregs[REG_RSP]);
+#elif defined(__aarch64__)
+    uintptr_t pc = uintptr_t(uc->uc_mcontext.pc);
+    uintptr_t fp = uintptr_t(uc->uc_mcontext.regs[29]);
+    uintptr_t sp = uintptr_t(uc->uc_mcontext.sp);
+#else
+    (void)uc;
+    return;
+#endif
+
+    // Only follow frame pointers that stay on this thread's stack, so code
+    // built without frame pointers (which uses the register freely) cannot
+    // send the walk into unmapped memory
+    uintptr_t high = sp + (uintptr_t(8) << 20);
+    if (sp >= main_stack_low && sp < main_stack_high) {
+        high = main_stack_high;
+    }
+
+    uintptr_t frames[MAX_DEPTH];
+    size_t depth = 0;
+    frames[depth++] = pc;
+    while (depth < MAX_DEPTH && fp >= sp && fp + 2 * sizeof(uintptr_t) <= high && fp % sizeof(uintptr_t) == 0) {
+        const uintptr_t* frame = reinterpret_cast<const uintptr_t*>(fp);
+        const uintptr_t next = frame[0];
+        const uintptr_t ret = frame[1];
+        if (ret == 0) {
+            break;
+        }
+        frames[depth++] = ret;
+        if (next <= fp) {
+            break;
+        }
+        fp = next;
+    }
+
+    const size_t start = used.fetch_add(depth + 1, std::memory_order_relaxed);
+    if (start + depth + 1 > BUFFER_WORDS) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    buffer[start] = depth;
+    std::memcpy(&buffer[start + 1], frames, depth * sizeof(uintptr_t));
+}
+
+void dump() {
+    const char* path = std::getenv("CPPSTARTER_PROFILE_OUT");
+    struct itimerval off = {};
+    setitimer(ITIMER_PROF, &off, nullptr);
+    std::FILE* out = std::fopen(path, "w");
+    if (!out) {
+        return;
+    }
+
+    std::fprintf(out, "# cppstarter sampler v1\ndropped %zu\n", dropped.load());
+    const size_t end = std::min(used.load(), BUFFER_WORDS);
+    for (size_t i = 0; i < end;) {
+        const size_t depth = buffer[i];
+        if (depth == 0 || i + 1 + depth > end) {
+            break;
+        }
+        std::fputc('s', out);
+        for (size_t j = 0; j < depth; ++j) {
+            std::fprintf(out, " %zx", size_t(buffer[i + 1 + j]));
+        }
+        std::fputc('\n', out);
+        i += depth + 1;
+    }
+
+    // The memory map lets cppstarter turn addresses into module offsets
+    if (std::FILE* maps = std::fopen("/proc/self/maps", "r")) {
+        char line[4096];
+        while (std::fgets(line, sizeof line, maps)) {
+            std::fprintf(out, "m %s", line);
+        }
+        std::fclose(maps);
+    }
+    std::fclose(out);
+}
+
+__attribute__((constructor)) void start() {
+    if (!std::getenv("CPPSTARTER_PROFILE_OUT")) {
+        return;
+    }
+
+    pthread_attr_t attr;
+    if (pthread_getattr_np(pthread_self(), &attr) == 0) {
+        void* base = nullptr;
+        size_t size = 0;
+        pthread_attr_getstack(&attr, &base, &size);
+        main_stack_low = uintptr_t(base);
+        main_stack_high = uintptr_t(base) + size;
+        pthread_attr_destroy(&attr);
+    }
+
+    struct sigaction action = {};
+    action.sa_sigaction = handler;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGPROF, &action, nullptr);
+
+    const char* hz_env = std::getenv("CPPSTARTER_PROFILE_HZ");
+    const long hz = hz_env ? std::max(1L, std::atol(hz_env)) : 997;
+    struct itimerval timer = {};
+    timer.it_interval.tv_usec = 1000000 / hz;
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    std::atexit(dump);
+}
+
+} // namespace
+} // namespace cppstarter_sampler
+)SAMPLER";
+
+constexpr size_t ADDR2LINE_BATCH = 4096;
+
+std::string read_file(const fs::path& path) {
+    std::ifstream file(path);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+void write_if_changed(const fs::path& path, std::string_view content) {
+    if (read_file(path) != content) {
+        std::error_code ec;
+        fs::create_directories(path.parent_path(), ec);
+        std::ofstream(path, std::ios::trunc) << content;
+    }
+}
+
+// Executables (ET_EXEC) are symbolized by absolute address, shared objects
+// and PIE binaries (ET_DYN) by file offset
+bool is_position_independent(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    unsigned char header[18] = {};
+    file.read(reinterpret_cast<char*>(header), sizeof header);
+    return file && header[16] == 3;   // ET_DYN, little endian
+}
+
+std::string module_label(const std::string& path) {
+    const size_t slash = path.rfind('/');
+    return "[" + (slash == std::string::npos ? path : path.substr(slash + 1)) + "]";
+}
+
+bool perf_available() {
+    try {
+        return process::run({"perf", "--version"}).exit_code == 0;
+    } catch (const std::runtime_error&) {
+        return false;
+    }
+}
+
+} // namespace
+
+SamplerDump parse_sampler_dump(std::string_view text) {
+    SamplerDump dump;
+    std::istringstream input{std::string(text)};
+    std::string line;
+    while (std::getline(input, line)) {
+        if (line.rfind("s ", 0) == 0) {
+            std::istringstream fields(line.substr(2));
+            std::vector<uint64_t> stack;
+            uint64_t address = 0;
+            while (fields >> std::hex >> address) {
+                stack.push_back(address);
+            }
+            if (!stack.empty()) {
+                dump.stacks.push_back(std::move(stack));
+            }
+        } else if (line.rfind("m ", 0) == 0) {
+            // "m 559c3f13e000-559c3f13f000 r-xp 00001000 fe:00 13533392   /tmp/w"
+            std::istringstream fields(line.substr(2));
+            std::string range, permissions, offset, device, inode, path;
+            fields >> range >> permissions >> offset >> device >> inode;
+            std::getline(fields >> std::ws, path);
+            const size_t dash = range.find('-');
+            if (permissions.size() < 3 || permissions[2] != 'x' || dash == std::string::npos) {
+                continue;
+            }
+            Mapping mapping;
+            mapping.start = std::stoull(range.substr(0, dash), nullptr, 16);
+            mapping.end = std::stoull(range.substr(dash + 1), nullptr, 16);
+            mapping.offset = std::stoull(offset, nullptr, 16);
+            mapping.path = path;
+            dump.mappings.push_back(std::move(mapping));
+        } else if (line.rfind("dropped ", 0) == 0) {
+            dump.dropped = std::stoull(line.substr(8));
+        }
+    }
+    std::sort(dump.mappings.begin(), dump.mappings.end(),
+              [](const Mapping& a, const Mapping& b) { return a.start < b.start; });
+    return dump;
+}
+
+FoldedStacks symbolize(const SamplerDump& dump) {
+    // Return addresses point after the call; step back into the call instruction
+    auto lookup_address = [](const std::vector<uint64_t>& stack, size_t index) {
+        return index == 0 ? stack[index] : stack[index] - 1;
+    };
+    auto find_mapping = [&](uint64_t address) -> const Mapping* {
+        auto it = std::upper_bound(dump.mappings.begin(), dump.mappings.end(), address,
+                                   [](uint64_t value, const Mapping& m) { return value < m.start; });
+        if (it == dump.mappings.begin()) {
+            return nullptr;
+        }
+        --it;
+        return address < it->end ? &*it : nullptr;
+    };
+
+    // Group unique addresses by module
+    std::map<std::string, std::map<uint64_t, uint64_t>> by_module;   // path -> address -> module address
+    std::unordered_map<std::string, bool> pic;
+    for (const auto& stack : dump.stacks) {
+        for (size_t i = 0; i < stack.size(); ++i) {
+            const uint64_t address = lookup_address(stack, i);
+            const Mapping* mapping = find_mapping(address);
+            if (!mapping || mapping->path.empty() || mapping->path[0] != '/') {
+                continue;
+            }
+            auto [it, inserted] = pic.try_emplace(mapping->path, false);
+            if (inserted) {
+                it->second = is_position_independent(mapping->path);
+            }
+            by_module[mapping->path][address] =
+                it->second ? address - mapping->start + mapping->offset : address;
+        }
+    }
+
+    std::unordered_map<uint64_t, std::string> names;
+    for (const auto& [path, addresses] : by_module) {
+        std::vector<std::pair<uint64_t, uint64_t>> pending(addresses.begin(), addresses.end());
+        for (size_t begin = 0; begin < pending.size(); begin += ADDR2LINE_BATCH) {
+            const size_t end = std::min(pending.size(), begin + ADDR2LINE_BATCH);
+            std::vector<std::string> command = {"addr2line", "-f", "-C", "-e", path};
+            for (size_t i = begin; i < end; ++i) {
+                std::ostringstream hex;
+                hex << "0x" << std::hex << pending[i].second;
+                command.push_back(hex.str());
+            }
+
+            std::istringstream output(process::run(command).output);
+            std::string function, location;
+            for (size_t i = begin; i < end && std::getline(output, function) && std::getline(output, location); ++i) {
+                names[pending[i].first] = function == "??" ? module_label(path) : function;
+            }
+        }
+    }
+
+    FoldedStacks stacks;
+    for (const auto& stack : dump.stacks) {
+        std::vector<std::string> frames;
+        for (size_t i = stack.size(); i-- > 0;) {
+            const uint64_t address = lookup_address(stack, i);
+            auto it = names.find(address);
+            if (it != names.end()) {
+                frames.push_back(it->second);
+            } else {
+                const Mapping* mapping = find_mapping(address);
+                frames.push_back(mapping && !mapping->path.empty() ? module_label(mapping->path) : "[unknown]");
+            }
+        }
+        add_stack(stacks, frames);
+    }
+    return stacks;
+}
+
+ProfileResult run_profile(const ProfileOptions& options) {
+    build::BuildConfig config = options.config;
+    config.name = config.name == "release" ? "profile-release" : "profile";
+    const fs::path dir = fs::path("build") / config.name;
+    config.obj_dir = dir / "obj";
+    config.binary = dir / "bin" / config.binary.filename();
+
+    // Frame pointers make both perf's fp unwinder and the built-in sampler work
+    if (std::find(config.compile_flags.begin(), config.compile_flags.end(), "-g") == config.compile_flags.end()) {
+        config.compile_flags.push_back("-g");
+    }
+    config.compile_flags.insert(config.compile_flags.end(),
+                                {"-fno-omit-frame-pointer", "-mno-omit-leaf-frame-pointer"});
+    config.libs.push_back("-pthread");
+
+    const fs::path sampler = dir / "sampler" / "cppstarter_sampler.cpp";
+    write_if_changed(sampler, SAMPLER_SOURCE);
+    config.sources.push_back(sampler);
+
+    build::BuildEngine engine(std::move(config));
+    std::cout << colors::CYAN << "Compiling " << engine.config().name << " build..." << colors::RESET << '\n';
+    if (!engine.build(options.build).success) {
+        throw std::runtime_error(engine.config().name + " build failed");
+    }
+
+    std::vector<std::string> program = {fs::absolute(engine.config().binary).string()};
+    program.insert(program.end(), options.args.begin(), options.args.end());
+    process::Options run_options;
+    run_options.capture_output = false;
+
+    ProfileResult result;
+    if (!options.builtin_sampler && perf_available()) {
+        const fs::path data = dir / "perf.data";
+        std::error_code ec;
+        fs::remove(data, ec);
+
+        std::vector<std::string> record = {"perf", "record", "-F", std::to_string(options.frequency),
+                                           "--call-graph", "fp", "-o", data.string(), "--"};
+        record.insert(record.end(), program.begin(), program.end());
+        std::cout << colors::CYAN << "Profiling with perf record..." << colors::RESET << '\n';
+        result.exit_code = process::run(record, run_options).exit_code;
+
+        if (fs::exists(data, ec)) {
+            process::Result script = process::run({"perf", "script", "-i", data.string()});
+            if (script.exit_code == 0) {
+                result.stacks = fold_perf_script(script.output);
+                result.method = "perf";
+            }
+        }
+        if (result.stacks.empty()) {
+            std::cout << colors::YELLOW << "perf recorded no samples (check kernel.perf_event_paranoid); "
+                      << "falling back to the built-in sampler" << colors::RESET << '\n';
+        }
+    }
+
+    if (result.stacks.empty()) {
+        const fs::path samples = dir / "samples.txt";
+        std::error_code ec;
+        fs::remove(samples, ec);
+
+        run_options.extra_env = {
+            "CPPSTARTER_PROFILE_OUT=" + fs::absolute(samples).string(),
+            "CPPSTARTER_PROFILE_HZ=" + std::to_string(options.frequency)
+        };
+        std::cout << colors::CYAN << "Profiling with the built-in SIGPROF sampler..." << colors::RESET << '\n';
+        result.exit_code = process::run(program, run_options).exit_code;
+
+        const SamplerDump dump = parse_sampler_dump(read_file(samples));
+        if (dump.dropped > 0) {
+            std::cout << colors::YELLOW << "Warning: " << dump.dropped
+                      << " samples dropped (sample buffer full)" << colors::RESET << '\n';
+        }
+        result.stacks = symbolize(dump);
+        result.method = "sampler";
+    }
+
+    if (result.stacks.empty()) {
+        throw std::runtime_error("No samples collected; the program must run for at least a few "
+                                 "milliseconds of CPU time and exit normally");
+    }
+
+    result.folded = dir / "profile.folded";
+    result.flamegraph = dir / "flamegraph.svg";
+    std::ofstream(result.folded, std::ios::trunc) << format_folded(result.stacks);
+    std::ofstream(result.flamegraph, std::ios::trunc)
+        << render_flamegraph(result.stacks, engine.config().binary.filename().string() + " (" +
+                             engine.config().name + ", " + result.method + ")");
+    return result;
+}
+
+} // namespace perf
@@ -0,0 +1,113 @@
+#include "utils/project_config.hpp"
+
+#include <fstream>
+#include <sstream>
+
+namespace config {
+
+namespace {
+
+std::string trim(std::string_view text) {
+    const size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string_view::npos) {
+        return "";
+    }
+    const size_t end = text.find_last_not_of(" \t\r");
+    return std::string(text.substr(begin, end - begin + 1));
+}
+
+} // namespace
+
+ProjectConfig ProjectConfig::load(const std::filesystem::path& path) {
+    ProjectConfig config;
+    std::ifstream file(path);
+    std::string raw;
+    while (std::getline(file, raw)) {
+        Line line;
+        line.raw = raw;
+        const std::string content = trim(raw);
+        const size_t equals = content.find('=');
+        if (!content.empty() && content[0] != '#' && equals != std::string::npos) {
+            line.key = trim(std::string_view(content).substr(0, equals));
+            line.value = trim(std::string_view(content).substr(equals + 1));
+        }
+        config.lines_.push_back(std::move(line));
+    }
+    return config;
+}
+
+const ProjectConfig::Line* ProjectConfig::find(std::string_view key) const {
+    // Later assignments win, like in a Makefile
+    for (auto it = lines_.rbegin(); it != lines_.rend(); ++it) {
+        if (it->key == key) {
+            return &*it;
+        }
+    }
+    return nullptr;
+}
+
+bool ProjectConfig::has(std::string_view key) const {
+    return find(key) != nullptr;
+}
+
+std::string ProjectConfig::get(std::string_view key, std::string_view fallback) const {
+    const Line* line = find(key);
+    return line ? line->value : std::string(fallback);
+}
+
+bool ProjectConfig::get_bool(std::string_view key, bool fallback) const {
+    const Line* line = find(key);
+    if (!line) {
+        return fallback;
+    }
+    const std::string& value = line->value;
+    if (value == "true" || value == "yes" || value == "on" || value == "1") {
+        return true;
+    }
+    if (value == "false" || value == "no" || value == "off" || value == "0") {
+        return false;
+    }
+    return fallback;
+}
+
+int ProjectConfig::get_int(std::string_view key, int fallback) const {
+    const Line* line = find(key);
+    if (!line) {
+        return fallback;
+    }
+    try {
+        return std::stoi(line->value);
+    } catch (const std::exception&) {
+        return fallback;
+    }
+}
+
+std::vector<std::string> ProjectConfig::get_list(std::string_view key) const {
+    std::vector<std::string> values;
+    std::istringstream stream(get(key));
+    std::string value;
+    while (stream >> value) {
+        values.push_back(value);
+    }
+    return values;
+}
+
+void ProjectConfig::set(std::string_view key, std::string_view value) {
+    for (auto it = lines_.rbegin(); it != lines_.rend(); ++it) {
+        if (it->key == key) {
+            it->value = std::string(value);
+            it->raw = std::string(key) + " = " + std::string(value);
+            return;
+        }
+    }
+    lines_.push_back({std::string(key), std::string(value), std::string(key) + " = " + std::string(value)});
+}
+
+void ProjectConfig::save(const std::filesystem::path& path) const {
+    std::ofstream file(path, std::ios::trunc);
+    for (const auto& line : lines_) {
+        file << line.raw << '\n';
+    }
+}
+
+} // namespace config
@@ -0,0 +1,91 @@
+#include "perf/stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+namespace perf {
+
+Summary summarize(std::vector<double> samples) {
+    Summary summary;
+    summary.count = samples.size();
+    if (samples.empty()) {
+        return summary;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const size_t n = samples.size();
+    summary.min = samples.front();
+    summary.max = samples.back();
+    summary.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / n;
+    summary.median = n % 2 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+
+    if (n > 1) {
+        double squares = 0.0;
+        for (double value : samples) {
+            squares += (value - summary.mean) * (value - summary.mean);
+        }
+        summary.stddev = std::sqrt(squares / (n - 1));
+    }
+    return summary;
+}
+
+double percentile(std::vector<double> samples, double p) {
+    if (samples.empty()) {
+        return 0.0;
+    }
+    std::sort(samples.begin(), samples.end());
+    const double rank = std::clamp(p, 0.0, 100.0) / 100.0 * (samples.size() - 1);
+    const size_t lower = static_cast<size_t>(rank);
+    const size_t upper = std::min(lower + 1, samples.size() - 1);
+    return samples[lower] + (samples[upper] - samples[lower]) * (rank - lower);
+}
+
+MannWhitney mann_whitney_u(const std::vector<double>& a, const std::vector<double>& b) {
+    MannWhitney result;
+    const double n1 = static_cast<double>(a.size());
+    const double n2 = static_cast<double>(b.size());
+    if (a.empty() || b.empty()) {
+        return result;
+    }
+
+    // Rank the pooled samples, giving tied values the average of their ranks
+    std::vector<std::pair<double, bool>> pooled;   // value, belongs to `a`
+    for (double value : a) pooled.emplace_back(value, true);
+    for (double value : b) pooled.emplace_back(value, false);
+    std::sort(pooled.begin(), pooled.end());
+
+    double rank_sum_a = 0.0;
+    double tie_term = 0.0;   // sum(t^3 - t) over groups of t tied values
+    for (size_t i = 0; i < pooled.size();) {
+        size_t j = i;
+        while (j < pooled.size() && pooled[j].first == pooled[i].first) {
+            ++j;
+        }
+        const double average_rank = (i + 1 + j) / 2.0;   // Ranks i+1 .. j
+        for (size_t k = i; k < j; ++k) {
+            if (pooled[k].second) {
+                rank_sum_a += average_rank;
+            }
+        }
+        const double t = static_cast<double>(j - i);
+        tie_term += t * t * t - t;
+        i = j;
+    }
+
+    result.u = rank_sum_a - n1 * (n1 + 1) / 2;
+    const double n = n1 + n2;
+    const double mean = n1 * n2 / 2;
+    const double variance = n1 * n2 / 12 * ((n + 1) - tie_term / (n * (n - 1)));
+    if (variance <= 0) {
+        return result;   // Every value identical: no evidence of a difference
+    }
+
+    const double distance = std::max(0.0, std::abs(result.u - mean) - 0.5);
+    result.z = (result.u < mean ? -distance : distance) / std::sqrt(variance);
+    result.p_value = std::erfc(std::abs(result.z) / std::sqrt(2.0));
+    return result;
+}
+
+} // namespace perf
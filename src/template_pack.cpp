@@ -0,0 +1,425 @@
+#include "scaffold/template_pack.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace scaffold {
+
+namespace {
+
+constexpr char MAGIC[4] = {'C', 'P', 'T', 'B'};
+constexpr uint32_t VERSION = 1;
+constexpr size_t HEADER_SIZE = 16;          // magic, version, template count, file count
+constexpr size_t TEMPLATE_RECORD = 16;      // name offset, name length, first file, file count
+constexpr size_t FILE_RECORD = 24;          // path offset, path length, data offset, stored size, raw size, flags
+
+constexpr uint32_t FLAG_COMPRESSED = 1;
+constexpr uint32_t FLAG_VARIABLES = 2;
+constexpr uint32_t FLAG_EXECUTABLE = 4;
+
+constexpr size_t MIN_MATCH = 4;
+constexpr size_t MAX_OFFSET = 65535;
+constexpr int HASH_BITS = 14;
+
+void put_u32(std::string& out, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        out.push_back(static_cast<char>((value >> shift) & 0xff));
+    }
+}
+
+void set_u32(std::string& out, size_t offset, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        out[offset + static_cast<size_t>(shift / 8)] = static_cast<char>((value >> shift) & 0xff);
+    }
+}
+
+std::string read_file(const fs::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Could not read " + path.string());
+    }
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+} // namespace
+
+void write_file(const fs::path& path, std::string_view data, bool executable) {
+    const int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, executable ? 0755 : 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Could not create " + path.string() + ": " + std::strerror(errno));
+    }
+    while (!data.empty()) {
+        const ssize_t written = write(fd, data.data(), data.size());
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            const int error = errno;
+            close(fd);
+            throw std::runtime_error("Could not write " + path.string() + ": " + std::strerror(error));
+        }
+        data.remove_prefix(static_cast<size_t>(written));
+    }
+    close(fd);
+}
+
+std::string compress(std::string_view data) {
+    std::string out;
+    std::vector<int64_t> table(size_t{1} << HASH_BITS, -1);
+    size_t anchor = 0;      // Start of the pending literals
+    size_t pos = 0;
+
+    auto hash = [&data](size_t at) {
+        uint32_t value = 0;
+        std::memcpy(&value, data.data() + at, sizeof value);
+        return (value * 2654435761u) >> (32 - HASH_BITS);
+    };
+    auto put_length = [&out](size_t length) {
+        for (; length >= 255; length -= 255) {
+            out.push_back(static_cast<char>(255));
+        }
+        out.push_back(static_cast<char>(length));
+    };
+    // A match length of 0 ends the stream: literals only, no offset
+    auto emit = [&](size_t literal_end, size_t match, size_t offset) {
+        const size_t literals = literal_end - anchor;
+        const size_t match_code = match ? match - MIN_MATCH : 0;
+        out.push_back(static_cast<char>((std::min<size_t>(literals, 15) << 4) | std::min<size_t>(match_code, 15)));
+        if (literals >= 15) {
+            put_length(literals - 15);
+        }
+        out.append(data.substr(anchor, literals));
+        if (match) {
+            out.push_back(static_cast<char>(offset & 0xff));
+            out.push_back(static_cast<char>(offset >> 8));
+            if (match_code >= 15) {
+                put_length(match_code - 15);
+            }
+        }
+    };
+
+    while (pos + MIN_MATCH <= data.size()) {
+        const uint32_t slot = hash(pos);
+        const int64_t candidate = table[slot];
+        table[slot] = static_cast<int64_t>(pos);
+        if (candidate >= 0 && pos - static_cast<size_t>(candidate) <= MAX_OFFSET &&
+            std::memcmp(data.data() + candidate, data.data() + pos, MIN_MATCH) == 0) {
+            const size_t from = static_cast<size_t>(candidate);
+            size_t length = MIN_MATCH;
+            while (pos + length < data.size() && data[from + length] == data[pos + length]) {
+                ++length;
+            }
+            emit(pos, length, pos - from);
+            pos += length;
+            anchor = pos;
+        } else {
+            ++pos;
+        }
+    }
+    emit(data.size(), 0, 0);
+    return out;
+}
+
+std::string decompress(std::string_view data, size_t raw_size) {
+    std::string out;
+    out.reserve(raw_size);
+    size_t pos = 0;
+
+    auto corrupt = []() { return std::runtime_error("Corrupt compressed template data"); };
+    auto read_length = [&](size_t length) {
+        if (length == 15) {
+            unsigned char byte = 255;
+            while (byte == 255) {
+                if (pos >= data.size()) {
+                    throw corrupt();
+                }
+                byte = static_cast<unsigned char>(data[pos++]);
+                length += byte;
+            }
+        }
+        return length;
+    };
+
+    while (pos < data.size()) {
+        const auto token = static_cast<unsigned char>(data[pos++]);
+        const size_t literals = read_length(token >> 4);
+        if (literals > data.size() - pos || out.size() + literals > raw_size) {
+            throw corrupt();
+        }
+        out.append(data.substr(pos, literals));
+        pos += literals;
+        if (pos == data.size()) {
+            break;
+        }
+
+        if (data.size() - pos < 2) {
+            throw corrupt();
+        }
+        const size_t offset = static_cast<unsigned char>(data[pos]) |
+                              static_cast<size_t>(static_cast<unsigned char>(data[pos + 1])) << 8;
+        pos += 2;
+        const size_t length = read_length(token & 15) + MIN_MATCH;
+        if (offset == 0 || offset > out.size() || out.size() + length > raw_size) {
+            throw corrupt();
+        }
+        // Byte by byte: the match may overlap the bytes it produces
+        for (size_t i = 0; i < length; ++i) {
+            const char byte = out[out.size() - offset];
+            out.push_back(byte);
+        }
+    }
+    if (out.size() != raw_size) {
+        throw corrupt();
+    }
+    return out;
+}
+
+std::string pack_templates(const fs::path& dir) {
+    struct Entry {
+        std::string path;
+        std::string data;
+        uint32_t raw_size;
+        uint32_t flags;
+    };
+    std::vector<std::pair<std::string, std::vector<Entry>>> templates;
+
+    std::vector<fs::path> roots;
+    for (const auto& entry : fs::directory_iterator(dir)) {
+        if (entry.is_directory()) {
+            roots.push_back(entry.path());
+        }
+    }
+    std::sort(roots.begin(), roots.end());
+
+    for (const auto& root : roots) {
+        std::vector<fs::path> paths;
+        for (const auto& entry : fs::recursive_directory_iterator(root)) {
+            if (entry.is_regular_file()) {
+                paths.push_back(entry.path());
+            }
+        }
+        std::sort(paths.begin(), paths.end());
+
+        std::vector<Entry> files;
+        for (const auto& path : paths) {
+            Entry file;
+            file.path = path.lexically_relative(root).generic_string();
+            const std::string raw = read_file(path);
+            file.raw_size = static_cast<uint32_t>(raw.size());
+            file.flags = raw.find("{{") != std::string::npos ? FLAG_VARIABLES : 0;
+            if ((fs::status(path).permissions() & fs::perms::owner_exec) != fs::perms::none) {
+                file.flags |= FLAG_EXECUTABLE;
+            }
+            std::string packed = compress(raw);
+            if (packed.size() < raw.size()) {
+                file.data = std::move(packed);
+                file.flags |= FLAG_COMPRESSED;
+            } else {
+                file.data = raw;
+            }
+            files.push_back(std::move(file));
+        }
+        templates.push_back({root.filename().string(), std::move(files)});
+    }
+
+    size_t file_count = 0;
+    for (const auto& [name, files] : templates) {
+        file_count += files.size();
+    }
+
+    // Index first, then names, then contents; offsets are patched as the tail grows
+    std::string blob(MAGIC, sizeof MAGIC);
+    put_u32(blob, VERSION);
+    put_u32(blob, static_cast<uint32_t>(templates.size()));
+    put_u32(blob, static_cast<uint32_t>(file_count));
+    blob.resize(HEADER_SIZE + templates.size() * TEMPLATE_RECORD + file_count * FILE_RECORD, '\0');
+
+    size_t file_index = 0;
+    for (size_t t = 0; t < templates.size(); ++t) {
+        const auto& [name, files] = templates[t];
+        const size_t record = HEADER_SIZE + t * TEMPLATE_RECORD;
+        set_u32(blob, record, static_cast<uint32_t>(blob.size()));
+        set_u32(blob, record + 4, static_cast<uint32_t>(name.size()));
+        set_u32(blob, record + 8, static_cast<uint32_t>(file_index));
+        set_u32(blob, record + 12, static_cast<uint32_t>(files.size()));
+        blob += name;
+        for (const auto& file : files) {
+            const size_t file_record = HEADER_SIZE + templates.size() * TEMPLATE_RECORD + file_index++ * FILE_RECORD;
+            set_u32(blob, file_record, static_cast<uint32_t>(blob.size()));
+            set_u32(blob, file_record + 4, static_cast<uint32_t>(file.path.size()));
+            blob += file.path;
+        }
+    }
+
+    file_index = 0;
+    for (const auto& [name, files] : templates) {
+        for (const auto& file : files) {
+            const size_t file_record = HEADER_SIZE + templates.size() * TEMPLATE_RECORD + file_index++ * FILE_RECORD;
+            set_u32(blob, file_record + 8, static_cast<uint32_t>(blob.size()));
+            set_u32(blob, file_record + 12, static_cast<uint32_t>(file.data.size()));
+            set_u32(blob, file_record + 16, file.raw_size);
+            set_u32(blob, file_record + 20, file.flags);
+            blob += file.data;
+        }
+    }
+    return blob;
+}
+
+std::string blob_to_cpp(std::string_view blob) {
+    std::ostringstream out;
+    out << "// Generated from templates/ by pack_templates; do not edit\n"
+        << "#include <cstddef>\n\n"
+        << "extern const unsigned char cppstarter_template_blob[] = {";
+    for (size_t i = 0; i < blob.size(); ++i) {
+        out << (i % 20 == 0 ? "\n    " : "") << static_cast<unsigned>(static_cast<unsigned char>(blob[i])) << ',';
+    }
+    out << "\n};\n"
+        << "extern const std::size_t cppstarter_template_blob_size = " << blob.size() << ";\n";
+    return out.str();
+}
+
+std::string substitute(std::string_view text, const Variables& variables) {
+    std::string out;
+    out.reserve(text.size());
+    size_t pos = 0;
+    for (;;) {
+        const size_t open = text.find("{{", pos);
+        const size_t close = open == std::string_view::npos ? open : text.find("}}", open + 2);
+        if (close == std::string_view::npos) {
+            out.append(text.substr(pos));
+            return out;
+        }
+
+        const std::string_view name = text.substr(open + 2, close - open - 2);
+        auto it = std::find_if(variables.begin(), variables.end(),
+                               [name](const auto& variable) { return variable.first == name; });
+        if (it != variables.end()) {
+            out.append(text.substr(pos, open - pos));
+            out.append(it->second);
+            pos = close + 2;
+        } else {
+            out.append(text.substr(pos, open + 2 - pos));
+            pos = open + 2;
+        }
+    }
+}
+
+std::string TemplateFile::contents() const {
+    return compressed ? decompress(stored, raw_size) : std::string(stored);
+}
+
+TemplatePack::TemplatePack(std::string_view blob) : blob_(blob) {
+    if (blob_.size() < HEADER_SIZE || blob_.substr(0, sizeof MAGIC) != std::string_view(MAGIC, sizeof MAGIC) ||
+        read_u32(4) != VERSION) {
+        throw std::runtime_error("Embedded template data is missing or has an unknown format");
+    }
+    template_count_ = read_u32(8);
+    file_count_ = read_u32(12);
+    if (blob_.size() < HEADER_SIZE + template_count_ * TEMPLATE_RECORD + file_count_ * FILE_RECORD) {
+        throw std::runtime_error("Embedded template index is truncated");
+    }
+}
+
+uint32_t TemplatePack::read_u32(size_t offset) const {
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        value |= static_cast<uint32_t>(static_cast<unsigned char>(blob_[offset + i])) << (8 * i);
+    }
+    return value;
+}
+
+std::string_view TemplatePack::slice(uint32_t offset, uint32_t length) const {
+    if (offset > blob_.size() || length > blob_.size() - offset) {
+        throw std::runtime_error("Embedded template index points outside the blob");
+    }
+    return blob_.substr(offset, length);
+}
+
+uint32_t TemplatePack::find(std::string_view id) const {
+    for (uint32_t t = 0; t < template_count_; ++t) {
+        const size_t record = HEADER_SIZE + t * TEMPLATE_RECORD;
+        if (slice(read_u32(record), read_u32(record + 4)) == id) {
+            return t;
+        }
+    }
+    return template_count_;
+}
+
+std::vector<std::string_view> TemplatePack::ids() const {
+    std::vector<std::string_view> ids;
+    for (uint32_t t = 0; t < template_count_; ++t) {
+        const size_t record = HEADER_SIZE + t * TEMPLATE_RECORD;
+        ids.push_back(slice(read_u32(record), read_u32(record + 4)));
+    }
+    return ids;
+}
+
+bool TemplatePack::contains(std::string_view id) const {
+    return find(id) < template_count_;
+}
+
+std::vector<TemplateFile> TemplatePack::files(std::string_view id) const {
+    const uint32_t t = find(id);
+    if (t == template_count_) {
+        std::string available;
+        for (std::string_view name : ids()) {
+            available += (available.empty() ? "" : ", ") + std::string(name);
+        }
+        throw std::runtime_error("Unknown template '" + std::string(id) + "' (available: " + available + ")");
+    }
+
+    const size_t record = HEADER_SIZE + t * TEMPLATE_RECORD;
+    const uint32_t first = read_u32(record + 8);
+    const uint32_t count = read_u32(record + 12);
+    if (first > file_count_ || count > file_count_ - first) {
+        throw std::runtime_error("Embedded template index is corrupt");
+    }
+
+    std::vector<TemplateFile> files;
+    for (uint32_t f = first; f < first + count; ++f) {
+        const size_t file_record = HEADER_SIZE + template_count_ * TEMPLATE_RECORD + f * FILE_RECORD;
+        const uint32_t flags = read_u32(file_record + 20);
+        TemplateFile file;
+        file.path = slice(read_u32(file_record), read_u32(file_record + 4));
+        file.stored = slice(read_u32(file_record + 8), read_u32(file_record + 12));
+        file.raw_size = read_u32(file_record + 16);
+        file.compressed = flags & FLAG_COMPRESSED;
+        file.has_variables = flags & FLAG_VARIABLES;
+        file.executable = flags & FLAG_EXECUTABLE;
+        files.push_back(file);
+    }
+    return files;
+}
+
+size_t write_template(const TemplatePack& pack, std::string_view id, const fs::path& destination,
+                      const Variables& variables) {
+    const std::vector<TemplateFile> files = pack.files(id);
+    for (const auto& file : files) {
+        const fs::path path = destination / fs::path(std::string(file.path));
+        std::error_code ec;
+        fs::create_directories(path.parent_path(), ec);
+        if (ec) {
+            throw std::runtime_error("Could not create " + path.parent_path().string() + ": " + ec.message());
+        }
+
+        if (file.has_variables) {
+            write_file(path, substitute(file.contents(), variables), file.executable);
+        } else if (file.compressed) {
+            write_file(path, file.contents(), file.executable);
+        } else {
+            write_file(path, file.stored, file.executable);   // Straight from read-only data
+        }
+    }
+    return files.size();
+}
+
+} // namespace scaffold
@@ -0,0 +1,284 @@
+#include "build/test_impact.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "utils/process.hpp"
+
+namespace build {
+
+namespace {
+
+// Object mtime as a cache validator
+std::string object_stamp(const fs::path& object) {
+    std::error_code ec;
+    const auto time = fs::last_write_time(object, ec);
+    const auto size = fs::file_size(object, ec);
+    if (ec) {
+        return {};
+    }
+    return std::to_string(time.time_since_epoch().count()) + ":" + std::to_string(size);
+}
+
+std::vector<fs::path> lines_to_paths(std::string_view output) {
+    std::vector<fs::path> paths;
+    std::istringstream input{std::string(output)};
+    std::string line;
+    while (std::getline(input, line)) {
+        if (!line.empty()) {
+            paths.emplace_back(line);
+        }
+    }
+    return paths;
+}
+
+} // namespace
+
+std::unordered_map<std::string, ObjectSymbols> parse_nm_output(std::string_view output) {
+    std::unordered_map<std::string, ObjectSymbols> objects;
+    std::istringstream input{std::string(output)};
+    std::string line;
+    while (std::getline(input, line)) {
+        // "<object>: <symbol> <type> [<value> <size>]"
+        const size_t colon = line.find(": ");
+        if (colon == std::string::npos) {
+            continue;
+        }
+        std::istringstream fields(line.substr(colon + 2));
+        std::string symbol, type;
+        if (!(fields >> symbol >> type) || type.size() != 1) {
+            continue;
+        }
+        ObjectSymbols& object = objects[line.substr(0, colon)];
+        if (type == "U") {
+            object.undefined.push_back(symbol);
+        } else if (std::string_view("TDBRGSCu").find(type[0]) != std::string_view::npos) {
+            object.defined.push_back(symbol);
+        }
+    }
+    return objects;
+}
+
+std::unordered_map<std::string, ObjectSymbols> load_object_symbols(const std::vector<fs::path>& objects,
+                                                                   const fs::path& cache_path) {
+    // Cache format: "O <stamp> <object>" followed by its "D <symbol>" and "U <symbol>" lines
+    std::unordered_map<std::string, std::pair<std::string, ObjectSymbols>> cached;
+    {
+        std::ifstream file(cache_path);
+        std::string line;
+        std::pair<std::string, ObjectSymbols>* current = nullptr;
+        while (std::getline(file, line)) {
+            if (line.size() < 3 || line[1] != ' ') {
+                continue;
+            }
+            if (line[0] == 'O') {
+                const size_t space = line.find(' ', 2);
+                if (space == std::string::npos) {
+                    current = nullptr;
+                    continue;
+                }
+                current = &cached[line.substr(space + 1)];
+                current->first = line.substr(2, space - 2);
+            } else if (current && line[0] == 'D') {
+                current->second.defined.push_back(line.substr(2));
+            } else if (current && line[0] == 'U') {
+                current->second.undefined.push_back(line.substr(2));
+            }
+        }
+    }
+
+    std::unordered_map<std::string, ObjectSymbols> symbols;
+    std::unordered_map<std::string, std::string> stamps;
+    std::vector<std::string> command{"nm", "-P", "-A"};
+    for (const auto& object : objects) {
+        const std::string key = object.string();
+        stamps[key] = object_stamp(object);
+        auto it = cached.find(key);
+        if (it != cached.end() && !stamps[key].empty() && it->second.first == stamps[key]) {
+            symbols[key] = std::move(it->second.second);
+        } else if (!stamps[key].empty()) {
+            command.push_back(key);
+        }
+    }
+    if (command.size() > 3) {
+        const process::Result nm = process::run(command);
+        if (nm.exit_code != 0) {
+            throw std::runtime_error("nm failed:\n" + nm.output);
+        }
+        for (auto& [object, object_symbols] : parse_nm_output(nm.output)) {
+            symbols[object] = std::move(object_symbols);
+        }
+        for (size_t i = 3; i < command.size(); ++i) {
+            symbols.try_emplace(command[i]);    // No global symbols at all
+        }
+    }
+
+    std::error_code ec;
+    fs::create_directories(cache_path.parent_path(), ec);
+    std::ofstream file(cache_path);
+    for (const auto& [object, object_symbols] : symbols) {
+        file << "O " << stamps[object] << ' ' << object << '\n';
+        for (const auto& symbol : object_symbols.defined) {
+            file << "D " << symbol << '\n';
+        }
+        for (const auto& symbol : object_symbols.undefined) {
+            file << "U " << symbol << '\n';
+        }
+    }
+    return symbols;
+}
+
+LinkClosure link_closure(const std::unordered_map<std::string, ObjectSymbols>& symbols) {
+    std::unordered_map<std::string, std::string> definer;
+    for (const auto& [object, object_symbols] : symbols) {
+        for (const auto& symbol : object_symbols.defined) {
+            definer.emplace(symbol, object);
+        }
+    }
+
+    std::unordered_map<std::string, std::vector<std::string>> direct;
+    for (const auto& [object, object_symbols] : symbols) {
+        auto& needs = direct[object];
+        for (const auto& symbol : object_symbols.undefined) {
+            auto it = definer.find(symbol);
+            if (it != definer.end() && it->second != object &&
+                std::find(needs.begin(), needs.end(), it->second) == needs.end()) {
+                needs.push_back(it->second);
+            }
+        }
+    }
+
+    LinkClosure closure;
+    for (const auto& [object, needs] : direct) {
+        std::unordered_set<std::string> seen{object};
+        std::vector<std::string> pending = needs;
+        auto& reached = closure[object];
+        while (!pending.empty()) {
+            std::string next = std::move(pending.back());
+            pending.pop_back();
+            if (!seen.insert(next).second) {
+                continue;
+            }
+            const auto& more = direct[next];
+            pending.insert(pending.end(), more.begin(), more.end());
+            reached.push_back(std::move(next));
+        }
+        std::sort(reached.begin(), reached.end());
+    }
+    return closure;
+}
+
+std::vector<fs::path> impacted_tests(const std::vector<fs::path>& changed,
+                                     const std::vector<fs::path>& test_sources,
+                                     const std::function<std::vector<fs::path>(const fs::path&)>& dependents,
+                                     const std::unordered_map<std::string, std::string>& object_of,
+                                     const LinkClosure& closure) {
+    // Objects whose code changed: changed sources and sources including a changed file
+    std::unordered_set<std::string> affected;
+    for (const auto& file : changed) {
+        const fs::path normal = file.lexically_normal();
+        affected.insert(normal.string());
+        for (const auto& dependent : dependents(normal)) {
+            affected.insert(dependent.lexically_normal().string());
+        }
+    }
+    std::unordered_set<std::string> affected_objects;
+    for (const auto& [source, object] : object_of) {
+        if (affected.count(fs::path(source).lexically_normal().string())) {
+            affected_objects.insert(object);
+        }
+    }
+
+    std::vector<fs::path> impacted;
+    for (const auto& test : test_sources) {
+        bool hit = affected.count(test.lexically_normal().string()) > 0;
+        auto object = object_of.find(test.string());
+        if (!hit && object != object_of.end()) {
+            auto reached = closure.find(object->second);
+            if (reached != closure.end()) {
+                hit = std::any_of(reached->second.begin(), reached->second.end(),
+                                  [&](const std::string& needed) { return affected_objects.count(needed) > 0; });
+            }
+        }
+        if (hit) {
+            impacted.push_back(test);
+        }
+    }
+    return impacted;
+}
+
+std::vector<std::string> gtest_suites_in(const fs::path& source) {
+    std::ifstream file(source);
+    std::vector<std::string> suites;
+    std::string line;
+    while (std::getline(file, line)) {
+        const size_t start = line.find_first_not_of(" \t");
+        size_t open = std::string::npos;
+        for (std::string_view macro : {"TEST(", "TEST_F(", "TEST_P(", "TYPED_TEST(", "TYPED_TEST_P("}) {
+            if (start != std::string::npos && line.compare(start, macro.size(), macro) == 0) {
+                open = start + macro.size() - 1;
+                break;
+            }
+        }
+        if (open == std::string::npos) {
+            continue;
+        }
+        const size_t first = line.find_first_not_of(" \t", open + 1);
+        const size_t last = line.find_first_of(" \t,", first);
+        if (first == std::string::npos || last == std::string::npos) {
+            continue;
+        }
+        std::string suite = line.substr(first, last - first);
+        if (std::find(suites.begin(), suites.end(), suite) == suites.end()) {
+            suites.push_back(std::move(suite));
+        }
+    }
+    return suites;
+}
+
+std::string gtest_filter_for(const std::vector<std::string>& suites) {
+    std::string filter;
+    for (const auto& suite : suites) {
+        filter += (filter.empty() ? "" : ":") + suite + ".*:*/" + suite + ".*:" + suite + "/*";
+    }
+    return filter;
+}
+
+std::vector<fs::path> git_changed_files(const std::string& ref) {
+    const process::Result diff = process::run({"git", "diff", "--name-only", "--relative", ref, "--"});
+    if (diff.exit_code != 0) {
+        throw std::runtime_error("git diff against '" + ref + "' failed:\n" + diff.output);
+    }
+    std::vector<fs::path> changed = lines_to_paths(diff.output);
+    const process::Result untracked = process::run({"git", "ls-files", "--others", "--exclude-standard"});
+    if (untracked.exit_code == 0) {
+        const auto more = lines_to_paths(untracked.output);
+        changed.insert(changed.end(), more.begin(), more.end());
+    }
+    std::sort(changed.begin(), changed.end());
+    changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+    return changed;
+}
+
+std::vector<fs::path> files_changed_since(const fs::path& stamp, const std::vector<fs::path>& dirs) {
+    std::error_code ec;
+    const auto since = fs::last_write_time(stamp, ec);
+    std::vector<fs::path> changed;
+    for (const auto& dir : dirs) {
+        for (auto it = fs::recursive_directory_iterator(dir, ec); !ec && it != fs::recursive_directory_iterator();
+             it.increment(ec)) {
+            std::error_code entry_ec;
+            if (it->is_regular_file(entry_ec) && it->last_write_time(entry_ec) > since) {
+                changed.push_back(it->path());
+            }
+        }
+        ec.clear();
+    }
+    std::sort(changed.begin(), changed.end());
+    return changed;
+}
+
+} // namespace build
@@ -0,0 +1,288 @@
+#include "build/test_shards.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
+namespace build {
+
+namespace {
+
+std::string_view trim(std::string_view text) {
+    const size_t first = text.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos) {
+        return {};
+    }
+    return text.substr(first, text.find_last_not_of(" \t\r") - first + 1);
+}
+
+std::string xml_unescape(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    for (size_t i = 0; i < text.size(); ++i) {
+        const size_t end = text[i] == '&' ? text.find(';', i) : std::string_view::npos;
+        if (end == std::string_view::npos) {
+            out += text[i];
+            continue;
+        }
+        const std::string_view entity = text.substr(i + 1, end - i - 1);
+        if (entity == "lt") out += '<';
+        else if (entity == "gt") out += '>';
+        else if (entity == "amp") out += '&';
+        else if (entity == "quot") out += '"';
+        else if (entity == "apos") out += '\'';
+        else if (entity.size() > 1 && entity[0] == '#') {
+            // Malformed ones (&#; &#xZZ;) are kept as written
+            const bool hex = entity[1] == 'x' || entity[1] == 'X';
+            const std::string digits(entity.substr(hex ? 2 : 1));
+            char* digits_end = nullptr;
+            const unsigned long code = std::strtoul(digits.c_str(), &digits_end, hex ? 16 : 10);
+            if (digits.empty() || !std::isxdigit(static_cast<unsigned char>(digits[0])) || *digits_end != '\0') {
+                out.append(text.substr(i, end - i + 1));
+            } else {
+                out += code < 0x80 ? static_cast<char>(code) : '?';
+            }
+        } else {
+            out.append(text.substr(i, end - i + 1));
+        }
+        i = end;
+    }
+    return out;
+}
+
+std::string xml_escape(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    for (char c : text) {
+        switch (c) {
+        case '<': out += "&lt;"; break;
+        case '>': out += "&gt;"; break;
+        case '&': out += "&amp;"; break;
+        case '"': out += "&quot;"; break;
+        case '\n': out += "&#x0A;"; break;
+        default: out += c;
+        }
+    }
+    return out;
+}
+
+// Value of attribute `name` in the tag text `tag` (between '<' and '>'), unescaped
+std::string attribute(std::string_view tag, std::string_view name) {
+    for (size_t pos = 0; (pos = tag.find(name, pos)) != std::string_view::npos; pos += name.size()) {
+        const bool starts_word = pos > 0 && (tag[pos - 1] == ' ' || tag[pos - 1] == '\t' || tag[pos - 1] == '\n');
+        const size_t quote = pos + name.size() + 1;
+        if (starts_word && quote < tag.size() && tag[quote - 1] == '=' && tag[quote] == '"') {
+            const size_t end = tag.find('"', quote + 1);
+            return xml_unescape(tag.substr(quote + 1, end - quote - 1));
+        }
+    }
+    return {};
+}
+
+// End of the tag starting at `open` ('<'), skipping '>' inside quoted values
+size_t tag_end(std::string_view xml, size_t open) {
+    bool quoted = false;
+    for (size_t i = open; i < xml.size(); ++i) {
+        if (xml[i] == '"') {
+            quoted = !quoted;
+        } else if (xml[i] == '>' && !quoted) {
+            return i;
+        }
+    }
+    return std::string_view::npos;
+}
+
+std::string format_seconds(double seconds) {
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(3) << seconds;
+    return text.str();
+}
+
+} // namespace
+
+std::vector<std::string> parse_gtest_list(std::string_view output) {
+    std::vector<std::string> tests;
+    std::string suite;
+    std::istringstream input{std::string(output)};
+    std::string line;
+    while (std::getline(input, line)) {
+        // Value-parameterized and typed tests carry "# GetParam() = ..." comments
+        const std::string_view name = trim(std::string_view(line).substr(0, line.find('#')));
+        if (name.empty()) {
+            continue;
+        }
+        if (line[0] != ' ') {
+            // Other top-level lines ("Running main() from ...") are not suites
+            suite = name.back() == '.' ? std::string(name) : std::string();
+        } else if (!suite.empty()) {
+            tests.push_back(suite + std::string(name));
+        }
+    }
+    return tests;
+}
+
+std::vector<TestCaseResult> parse_gtest_xml(std::string_view xml) {
+    std::vector<TestCaseResult> cases;
+    for (size_t open = xml.find("<testcase"); open != std::string_view::npos;
+         open = xml.find("<testcase", open + 1)) {
+        const size_t end = tag_end(xml, open);
+        if (end == std::string_view::npos) {
+            break;
+        }
+        const std::string_view tag = xml.substr(open, end - open);
+        TestCaseResult result;
+        result.name = attribute(tag, "name");
+        result.suite = attribute(tag, "classname");
+        const std::string time = attribute(tag, "time");
+        result.seconds = time.empty() ? 0.0 : std::stod(time);
+        result.skipped = attribute(tag, "result") == "skipped" || attribute(tag, "status") == "notrun";
+
+        if (tag.back() != '/') {
+            const size_t close = xml.find("</testcase>", end);
+            const std::string_view body = xml.substr(end, close == std::string_view::npos ? close : close - end);
+            for (size_t failure = body.find("<failure"); failure != std::string_view::npos;
+                 failure = body.find("<failure", failure + 1)) {
+                result.failed = true;
+                const std::string message = attribute(body.substr(failure, tag_end(body, failure) - failure), "message");
+                result.failure += (result.failure.empty() ? "" : "\n") + message;
+            }
+            result.skipped = result.skipped || body.find("<skipped") != std::string_view::npos;
+        }
+        cases.push_back(std::move(result));
+    }
+    return cases;
+}
+
+std::string format_gtest_xml(const std::vector<TestCaseResult>& cases) {
+    std::vector<std::string> suites;
+    std::unordered_map<std::string, std::vector<const TestCaseResult*>> by_suite;
+    size_t failures = 0;
+    double total = 0.0;
+    for (const auto& test : cases) {
+        auto [it, inserted] = by_suite.try_emplace(test.suite);
+        if (inserted) {
+            suites.push_back(test.suite);
+        }
+        it->second.push_back(&test);
+        failures += test.failed ? 1 : 0;
+        total += test.seconds;
+    }
+
+    std::ostringstream xml;
+    xml << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<testsuites tests=\"" << cases.size() << "\" failures=\"" << failures
+        << "\" disabled=\"0\" errors=\"0\" time=\"" << format_seconds(total) << "\" name=\"AllTests\">\n";
+    for (const auto& suite : suites) {
+        const auto& members = by_suite[suite];
+        size_t suite_failures = 0, skipped = 0;
+        double suite_time = 0.0;
+        for (const TestCaseResult* test : members) {
+            suite_failures += test->failed ? 1 : 0;
+            skipped += test->skipped ? 1 : 0;
+            suite_time += test->seconds;
+        }
+        xml << "  <testsuite name=\"" << xml_escape(suite) << "\" tests=\"" << members.size()
+            << "\" failures=\"" << suite_failures << "\" disabled=\"0\" skipped=\"" << skipped
+            << "\" errors=\"0\" time=\"" << format_seconds(suite_time) << "\">\n";
+        for (const TestCaseResult* test : members) {
+            xml << "    <testcase name=\"" << xml_escape(test->name) << "\" status=\"run\" result=\""
+                << (test->skipped ? "skipped" : "completed") << "\" time=\"" << format_seconds(test->seconds)
+                << "\" classname=\"" << xml_escape(test->suite) << "\"";
+            if (!test->failed) {
+                xml << " />\n";
+                continue;
+            }
+            xml << ">\n      <failure message=\"" << xml_escape(test->failure) << "\" type=\"\"></failure>\n"
+                << "    </testcase>\n";
+        }
+        xml << "  </testsuite>\n";
+    }
+    xml << "</testsuites>\n";
+    return xml.str();
+}
+
+TestDurations load_test_durations(const fs::path& path) {
+    TestDurations durations;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        const size_t tab = line.find('\t');
+        if (tab == std::string::npos) {
+            continue;
+        }
+        try {
+            durations[line.substr(tab + 1)] = std::stod(line.substr(0, tab));
+        } catch (const std::exception&) {
+            // Skip damaged lines; the next run rewrites the file
+        }
+    }
+    return durations;
+}
+
+void save_test_durations(const fs::path& path, const TestDurations& durations) {
+    std::vector<std::pair<std::string, double>> sorted(durations.begin(), durations.end());
+    std::sort(sorted.begin(), sorted.end());
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        fs::create_directories(path.parent_path(), ec);
+    }
+    std::ofstream file(path);
+    for (const auto& [name, seconds] : sorted) {
+        file << std::fixed << std::setprecision(6) << seconds << '\t' << name << '\n';
+    }
+}
+
+std::vector<std::vector<std::string>> pack_tests(const std::vector<std::string>& tests,
+                                                 const TestDurations& durations, unsigned shards) {
+    shards = std::max(1u, std::min<unsigned>(shards, static_cast<unsigned>(tests.size())));
+
+    std::vector<double> known;
+    for (const auto& test : tests) {
+        auto it = durations.find(test);
+        if (it != durations.end()) {
+            known.push_back(it->second);
+        }
+    }
+    double fallback = 1.0;
+    if (!known.empty()) {
+        std::nth_element(known.begin(), known.begin() + static_cast<std::ptrdiff_t>(known.size() / 2), known.end());
+        fallback = known[known.size() / 2];
+    }
+
+    std::vector<double> weights;
+    for (const auto& test : tests) {
+        auto it = durations.find(test);
+        weights.push_back(it != durations.end() ? it->second : fallback);
+    }
+    std::vector<size_t> order(tests.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&weights](size_t a, size_t b) { return weights[a] > weights[b]; });
+
+    std::vector<std::vector<size_t>> groups(shards);
+    std::vector<double> loads(shards, 0.0);
+    for (size_t index : order) {
+        const size_t lightest = static_cast<size_t>(std::min_element(loads.begin(), loads.end()) - loads.begin());
+        groups[lightest].push_back(index);
+        loads[lightest] += weights[index];
+    }
+
+    std::vector<std::vector<std::string>> packed;
+    for (auto& group : groups) {
+        if (group.empty()) {
+            continue;
+        }
+        std::sort(group.begin(), group.end());
+        std::vector<std::string> names;
+        for (size_t index : group) {
+            names.push_back(tests[index]);
+        }
+        packed.push_back(std::move(names));
+    }
+    return packed;
+}
+
+} // namespace build
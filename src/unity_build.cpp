@@ -0,0 +1,119 @@
+#include "build/unity_build.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+
+namespace build {
+
+namespace {
+
+bool is_excluded(const fs::path& source, const std::vector<std::string>& exclude) {
+    const fs::path normal = source.lexically_normal();
+    if (normal.begin() == normal.end() || *normal.begin() != "src") {
+        return true;
+    }
+    const std::string relative = normal.string();
+    const std::string name = source.filename().string();
+    return std::any_of(exclude.begin(), exclude.end(), [&](const std::string& pattern) {
+        return pattern == name || fs::path(pattern).lexically_normal().string() == relative;
+    });
+}
+
+void write_if_changed(const fs::path& path, const std::string& content) {
+    std::ifstream existing(path);
+    if (existing) {
+        std::ostringstream current;
+        current << existing.rdbuf();
+        if (current.str() == content) {
+            return;  // Keep the mtime so the batch is not recompiled
+        }
+    }
+    std::ofstream(path, std::ios::trunc) << content;
+}
+
+} // namespace
+
+std::vector<UnityBatch> plan_unity_batches(const std::vector<fs::path>& sources, unsigned batches) {
+    struct Sized {
+        fs::path path;
+        uintmax_t bytes;
+    };
+    std::vector<Sized> sized;
+    for (const auto& source : sources) {
+        std::error_code ec;
+        uintmax_t bytes = fs::file_size(source, ec);
+        sized.push_back({source, ec ? 0 : bytes});
+    }
+    std::sort(sized.begin(), sized.end(), [](const Sized& a, const Sized& b) {
+        return a.bytes != b.bytes ? a.bytes > b.bytes : a.path < b.path;
+    });
+
+    std::vector<UnityBatch> plan(std::max(1u, batches));
+    for (const auto& file : sized) {
+        auto lightest = std::min_element(plan.begin(), plan.end(),
+            [](const UnityBatch& a, const UnityBatch& b) { return a.bytes < b.bytes; });
+        lightest->sources.push_back(file.path);
+        lightest->bytes += file.bytes;
+    }
+
+    plan.erase(std::remove_if(plan.begin(), plan.end(),
+                              [](const UnityBatch& batch) { return batch.sources.empty(); }),
+               plan.end());
+    for (auto& batch : plan) {
+        std::sort(batch.sources.begin(), batch.sources.end());
+    }
+    return plan;
+}
+
+void apply_unity_build(BuildConfig& config, const UnityOptions& options) {
+    std::vector<fs::path> merged;
+    std::vector<fs::path> standalone;
+    for (const auto& source : config.sources) {
+        (is_excluded(source, options.exclude) ? standalone : merged).push_back(source);
+    }
+    if (merged.size() < 2) {
+        return;  // Nothing to merge
+    }
+
+    const unsigned batches = options.batches > 0
+                                 ? options.batches
+                                 : std::clamp<unsigned>(static_cast<unsigned>(merged.size()) / UNITY_BATCH_FILES,
+                                                        1, UNITY_DEFAULT_BATCHES);
+    const auto plan = plan_unity_batches(merged, std::min<unsigned>(batches, merged.size()));
+
+    const fs::path dir = config.obj_dir.parent_path() / "unity";
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+
+    // Drop batches left over from a previous run with more batches
+    for (const auto& entry : fs::directory_iterator(dir, ec)) {
+        const std::string name = entry.path().filename().string();
+        if (name.rfind("unity_", 0) == 0) {
+            const std::string index = name.substr(6, name.find('.') - 6);
+            if (!index.empty() && std::all_of(index.begin(), index.end(), ::isdigit) &&
+                std::stoul(index) > plan.size()) {
+                fs::remove(entry.path(), ec);
+            }
+        }
+    }
+
+    config.original_sources = config.sources;
+    config.sources.clear();
+    for (size_t i = 0; i < plan.size(); ++i) {
+        std::ostringstream content;
+        content << "// Generated by cppstarter: unity batch " << i + 1 << '/' << plan.size()
+                << " (" << plan[i].bytes << " bytes)\n";
+        for (const auto& source : plan[i].sources) {
+            // Relative include keeps the batch identical across checkouts for the object cache
+            content << "#include \"" << source.lexically_proximate(dir).generic_string() << "\"\n";
+        }
+        const fs::path unity_file = dir / ("unity_" + std::to_string(i + 1) + ".cpp");
+        write_if_changed(unity_file, content.str());
+        config.sources.push_back(unity_file);
+    }
+    config.sources.insert(config.sources.end(), standalone.begin(), standalone.end());
+}
+
+} // namespace build
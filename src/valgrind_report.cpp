@@ -0,0 +1,296 @@
+#include "perf/valgrind_report.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace perf {
+
+namespace {
+
+std::vector<std::string> split_words(std::string_view text) {
+    std::istringstream input{std::string(text)};
+    std::vector<std::string> words;
+    std::string word;
+    while (input >> word) {
+        words.push_back(word);
+    }
+    return words;
+}
+
+// Callgrind name compression: "(3) foo" defines id 3, a later "(3)" refers to it
+std::string resolve_name(std::unordered_map<std::string, std::string>& names, std::string_view value) {
+    if (value.empty() || value[0] != '(') {
+        return std::string(value);
+    }
+    const size_t close = value.find(')');
+    if (close == std::string_view::npos) {
+        return std::string(value);
+    }
+    const std::string id(value.substr(0, close + 1));
+    std::string_view rest = value.substr(close + 1);
+    rest.remove_prefix(std::min(rest.size(), rest.find_first_not_of(' ')));
+    if (!rest.empty()) {
+        return names[id] = std::string(rest);
+    }
+    auto it = names.find(id);
+    return it != names.end() ? it->second : id;
+}
+
+bool is_cost_line(std::string_view line) {
+    return !line.empty() && (std::isdigit(static_cast<unsigned char>(line[0])) ||
+                             line[0] == '+' || line[0] == '-' || line[0] == '*');
+}
+
+void add_costs(std::vector<uint64_t>& into, const std::vector<uint64_t>& costs) {
+    into.resize(std::max(into.size(), costs.size()), 0);
+    for (size_t i = 0; i < costs.size(); ++i) {
+        into[i] += costs[i];
+    }
+}
+
+int64_t signed_delta(uint64_t before, uint64_t after) {
+    return static_cast<int64_t>(after) - static_cast<int64_t>(before);
+}
+
+} // namespace
+
+uint64_t ValgrindProfile::sum(const std::vector<uint64_t>& costs,
+                              std::initializer_list<std::string_view> names) const {
+    uint64_t total = 0;
+    for (std::string_view name : names) {
+        auto it = std::find(events.begin(), events.end(), name);
+        const size_t index = static_cast<size_t>(it - events.begin());
+        if (it != events.end() && index < costs.size()) {
+            total += costs[index];
+        }
+    }
+    return total;
+}
+
+bool ValgrindProfile::has_event(std::string_view name) const {
+    return std::find(events.begin(), events.end(), name) != events.end();
+}
+
+ValgrindProfile parse_valgrind_profile(std::string_view text) {
+    ValgrindProfile profile;
+    size_t positions = 1;       // "positions: line" unless the header says otherwise
+    std::unordered_map<std::string, std::string> file_names, function_names, object_names;
+    std::unordered_map<std::string, size_t> function_index;
+    std::string file;
+    std::string call_target;
+    size_t current = SIZE_MAX;
+    bool call_cost_pending = false;
+    std::vector<uint64_t> summary;
+
+    auto cost_fields = [&](std::string_view line) {
+        std::vector<uint64_t> costs;
+        const auto words = split_words(line);
+        for (size_t i = positions; i < words.size(); ++i) {
+            costs.push_back(std::stoull(words[i]));
+        }
+        return costs;
+    };
+
+    std::istringstream input{std::string(text)};
+    std::string line;
+    while (std::getline(input, line)) {
+        if (is_cost_line(line)) {
+            if (current == SIZE_MAX) {
+                continue;
+            }
+            FunctionCost& function = profile.functions[current];
+            const auto costs = cost_fields(line);
+            if (call_cost_pending) {
+                // Inclusive cost of a call; direct recursion would count twice
+                if (call_target != function.name) {
+                    add_costs(function.inclusive, costs);
+                }
+                call_cost_pending = false;
+            } else {
+                add_costs(function.self, costs);
+                add_costs(function.inclusive, costs);
+            }
+            continue;
+        }
+
+        const size_t separator = line.find_first_of(":=");
+        if (separator == std::string::npos) {
+            continue;
+        }
+        const std::string key = line.substr(0, separator);
+        std::string_view value = std::string_view(line).substr(separator + 1);
+        value.remove_prefix(std::min(value.size(), value.find_first_not_of(' ')));
+
+        if (key == "events") {
+            profile.events = split_words(value);
+        } else if (key == "positions") {
+            positions = split_words(value).size();
+        } else if (key == "cmd") {
+            profile.command = std::string(value);
+        } else if (key == "summary" || key == "totals") {
+            summary.clear();
+            for (const auto& word : split_words(value)) {
+                summary.push_back(std::stoull(word));
+            }
+        } else if (key == "fl" || key == "fi" || key == "fe") {
+            file = resolve_name(file_names, value);
+        } else if (key == "cfi" || key == "cfl") {
+            resolve_name(file_names, value);
+        } else if (key == "ob" || key == "cob") {
+            resolve_name(object_names, value);
+        } else if (key == "fn") {
+            const std::string name = resolve_name(function_names, value);
+            auto [it, inserted] = function_index.try_emplace(name, profile.functions.size());
+            if (inserted) {
+                profile.functions.push_back({name, file, {}, {}});
+            }
+            current = it->second;
+        } else if (key == "cfn") {
+            call_target = resolve_name(function_names, value);
+        } else if (key == "calls") {
+            call_cost_pending = true;
+            profile.has_calls = true;
+        }
+    }
+
+    if (!summary.empty()) {
+        profile.totals = summary;
+    } else {
+        for (const auto& function : profile.functions) {
+            add_costs(profile.totals, function.self);
+        }
+    }
+    // Trailing zero costs may be omitted
+    profile.totals.resize(profile.events.size(), 0);
+    for (auto& function : profile.functions) {
+        function.self.resize(profile.events.size(), 0);
+        function.inclusive.resize(profile.events.size(), 0);
+    }
+    return profile;
+}
+
+ValgrindProfile load_valgrind_profile(const fs::path& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Could not read " + path.string());
+    }
+    std::ostringstream content;
+    content << file.rdbuf();
+    ValgrindProfile profile = parse_valgrind_profile(content.str());
+    if (profile.events.empty()) {
+        throw std::runtime_error(path.string() + " is not a cachegrind or callgrind output file");
+    }
+    return profile;
+}
+
+CacheRates cache_rates(const ValgrindProfile& profile, const std::vector<uint64_t>& costs) {
+    CacheRates rates;
+    auto ratio = [](uint64_t part, uint64_t whole) {
+        return whole ? static_cast<double>(part) / static_cast<double>(whole) : 0.0;
+    };
+    if (profile.has_event("D1mr")) {
+        rates.d1_miss = ratio(profile.sum(costs, {"D1mr", "D1mw"}), profile.sum(costs, {"Dr", "Dw"}));
+    }
+    if (profile.has_event("DLmr")) {
+        rates.ll_miss = ratio(profile.sum(costs, {"ILmr", "DLmr", "DLmw"}),
+                              profile.sum(costs, {"Ir", "Dr", "Dw"}));
+    }
+    if (profile.has_event("Bc")) {
+        rates.mispredicts = profile.sum(costs, {"Bcm", "Bim"});
+        rates.mispredict = ratio(rates.mispredicts, profile.sum(costs, {"Bc", "Bi"}));
+    }
+    return rates;
+}
+
+std::vector<const FunctionCost*> hottest(const ValgrindProfile& profile, std::string_view event,
+                                         size_t limit) {
+    if (event.empty()) {
+        event = "Ir";
+    }
+    auto it = std::find(profile.events.begin(), profile.events.end(), event);
+    if (it == profile.events.end()) {
+        std::string available;
+        for (const auto& name : profile.events) {
+            available += (available.empty() ? "" : ", ") + name;
+        }
+        throw std::runtime_error("Event '" + std::string(event) + "' is not in the profile (have: " +
+                                 available + ")");
+    }
+    const size_t index = static_cast<size_t>(it - profile.events.begin());
+
+    std::vector<const FunctionCost*> ranked;
+    for (const auto& function : profile.functions) {
+        if (function.self[index] > 0) {
+            ranked.push_back(&function);
+        }
+    }
+    std::sort(ranked.begin(), ranked.end(), [index](const FunctionCost* a, const FunctionCost* b) {
+        if (a->self[index] != b->self[index]) return a->self[index] > b->self[index];
+        return a->name < b->name;
+    });
+    if (ranked.size() > limit) {
+        ranked.resize(limit);
+    }
+    return ranked;
+}
+
+ProfileDiff diff_profiles(const ValgrindProfile& before, const ValgrindProfile& after) {
+    ProfileDiff diff;
+    std::vector<size_t> before_index, after_index;
+    for (size_t i = 0; i < after.events.size(); ++i) {
+        auto it = std::find(before.events.begin(), before.events.end(), after.events[i]);
+        if (it != before.events.end()) {
+            diff.events.push_back(after.events[i]);
+            before_index.push_back(static_cast<size_t>(it - before.events.begin()));
+            after_index.push_back(i);
+        }
+    }
+    if (diff.events.empty()) {
+        throw std::runtime_error("The two profiles have no events in common");
+    }
+
+    auto project = [](const std::vector<uint64_t>& costs, const std::vector<size_t>& indices) {
+        std::vector<uint64_t> projected;
+        for (size_t index : indices) {
+            projected.push_back(index < costs.size() ? costs[index] : 0);
+        }
+        return projected;
+    };
+    diff.before_totals = project(before.totals, before_index);
+    diff.after_totals = project(after.totals, after_index);
+
+    std::unordered_map<std::string, size_t> by_name;
+    const std::vector<uint64_t> zeros(diff.events.size(), 0);
+    for (const auto& function : before.functions) {
+        by_name[function.name] = diff.functions.size();
+        diff.functions.push_back({function.name, project(function.self, before_index), zeros});
+    }
+    for (const auto& function : after.functions) {
+        auto [it, inserted] = by_name.try_emplace(function.name, diff.functions.size());
+        if (inserted) {
+            diff.functions.push_back({function.name, zeros, zeros});
+        }
+        diff.functions[it->second].after = project(function.self, after_index);
+    }
+
+    diff.functions.erase(std::remove_if(diff.functions.begin(), diff.functions.end(),
+                                        [](const FunctionDelta& d) { return d.before == d.after; }),
+                         diff.functions.end());
+
+    // Rank by the first shared event, normally Ir
+    std::sort(diff.functions.begin(), diff.functions.end(), [](const FunctionDelta& a, const FunctionDelta& b) {
+        const int64_t da = std::abs(signed_delta(a.before[0], a.after[0]));
+        const int64_t db = std::abs(signed_delta(b.before[0], b.after[0]));
+        if (da != db) return da > db;
+        return a.name < b.name;
+    });
+    return diff;
+}
+
+} // namespace perf
@@ -0,0 +1,43 @@
+# Rules shared by the Makefiles that `cppstarter new` writes. Include it
+# once the release variables exist, with PROFILE_TARGETS set to the targets
+# a profile's compiler builds; the includer provides DEPFLAGS and FORCE.
+
+# === Tuned release profile (make release PROFILE=<name>) ===
+# `cppstarter tune` writes the fastest compiler and flags it measured to
+# profiles/<name>.mk; release_profile in cppstarter.conf is the default.
+PROFILE ?= $(shell sed -n 's/^release_profile *= *//p' cppstarter.conf 2>/dev/null)
+ifneq ($(PROFILE),)
+include profiles/$(PROFILE).mk
+OPTIMIZATION_LEVEL = $(PROFILE_FLAGS)
+ifneq ($(PROFILE_CXX),)
+$(PROFILE_TARGETS): CXX = $(PROFILE_CXX)
+endif
+endif
+
+# === Precompiled header (make PCH=1) ===
+PCH ?= 0
+PCH_MAX ?= 16
+
+# Most frequently included system headers of the given sources
+pch_headers = $(shell grep -ho '^[[:space:]]*\#[[:space:]]*include[[:space:]]*<[^>]*>' $(1) 2>/dev/null | sed 's/.*</</' | sort | uniq -c | sort -rn | head -n $(PCH_MAX) | awk '{print $$2}')
+
+# One header per configuration; the flags are written into it so that
+# changing them rebuilds the .gch and every object that uses it.
+# $(1) = variable prefix, $(2) = build directory, $(3) = sources, $(4) = flags
+define PCH_RULES
+ifeq ($(PCH),1)
+$(1)_PCH_GCH = $(2)/pch/pch.hpp.gch
+$(1)_PCH_FLAGS = -include $(2)/pch/pch.hpp -Winvalid-pch
+
+$(2)/pch/pch.hpp: FORCE
+	@mkdir -p $$(dir $$@)
+	@echo '// flags: $(4)' > $$@.tmp
+	@for h in $(foreach h,$(call pch_headers,$(3)),'$(h)'); do echo "#include $$$$h"; done >> $$@.tmp
+	@cmp -s $$@.tmp $$@ && rm -f $$@.tmp || mv $$@.tmp $$@
+
+$(2)/pch/pch.hpp.gch: $(2)/pch/pch.hpp
+	$$(CXX) $(4) $$(DEPFLAGS) -x c++-header $$< -o $$@
+
+-include $(2)/pch/pch.hpp.d
+endif
+endef
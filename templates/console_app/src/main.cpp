@@ -2,7 +2,7 @@
 #include "functions.h"
 
 int main() {
-    std::cout << "Hello from console_app" << std::endl;
+    std::cout << "Hello from {{project_name}}" << std::endl;
     greet();
     
     return 0;
@@ -0,0 +1,10 @@
+#include <iostream>
+
+int main(int argc, char* argv[]) {
+    // Suppress unused parameter warnings
+    (void)argc;
+    (void)argv;
+    
+    std::cout << "Hello, {{project_name}}!" << std::endl;
+    return 0;
+}
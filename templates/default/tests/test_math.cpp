@@ -0,0 +1,23 @@
+#include <cassert>
+#include <iostream>
+
+// Simple test framework
+void test_basic_math() {
+    assert(2 + 2 == 4);
+    assert(5 * 3 == 15);
+    assert(10 - 7 == 3);
+    std::cout << "✓ Basic math tests passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running tests..." << std::endl;
+    
+    try {
+        test_basic_math();
+        std::cout << "\n✅ All tests passed!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,48 @@
+// Cost per entity of one movement tick over a large world, single-threaded
+// and on every core; needs no SFML:
+//   make bench [ENTITIES=1000000] [TICKS=100]
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "components.h"
+#include "registry.h"
+#include "systems.h"
+#include "thread_pool.h"
+
+// Best-of-`ticks` time of one movementSystem call, in nanoseconds
+static double bestTick(Registry& registry, int ticks, ThreadPool* threads) {
+    const Bounds bounds = {1280.0f, 720.0f};
+    double best = 1e30;
+    for (int tick = 0; tick < ticks; ++tick) {
+        const auto start = std::chrono::steady_clock::now();
+        movementSystem(registry, 1.0f / 60.0f, bounds, threads);
+        best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t entities = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    const int ticks = argc > 2 ? std::atoi(argv[2]) : 100;
+
+    Registry registry;
+    spawnEntities(registry, entities, {1280.0f, 720.0f});
+    ThreadPool threads;
+
+    const double parallel = bestTick(registry, ticks, &threads);
+    const double serial = bestTick(registry, ticks, nullptr);
+
+    std::cout << entities << " entities, best of " << ticks << " ticks:\n" << std::fixed << std::setprecision(3)
+              << "  1 thread    " << std::setw(8) << serial / 1e6 << " ms/tick  "
+              << serial / entities << " ns/entity\n"
+              << "  " << threads.size() << " thread(s) " << std::setw(8) << parallel / 1e6 << " ms/tick  "
+              << parallel / entities << " ns/entity  (" << std::setprecision(2) << serial / parallel << "x)\n";
+
+    // Use the result so the updates cannot be optimized away
+    float checksum = 0.0f;
+    registry.each<Position>([&](Entity, const Position& position) { checksum += position.x; });
+    return checksum < 0.0f ? 1 : 0;
+}
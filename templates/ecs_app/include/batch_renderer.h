@@ -0,0 +1,21 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include "registry.h"
+
+// Draws every entity with a Position and a Tint as a small square, all of
+// them in one draw call: the squares are written straight from the packed
+// component columns into one vertex array, which keeps its storage from
+// frame to frame.
+class BatchRenderer {
+public:
+    explicit BatchRenderer(float size = 2.0f);
+
+    // Returns the number of draw calls issued
+    unsigned draw(Registry& registry, sf::RenderTarget& target);
+
+private:
+    sf::VertexArray vertices;
+    float half;
+};
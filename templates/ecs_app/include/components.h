@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+// Components are plain data; behaviour lives in the systems
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;     // Units per second
+};
+
+struct Tint {
+    std::uint8_t r, g, b, a;
+};
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+// An entity is only an id; its data lives in one ComponentPool per
+// component type. Ids of destroyed entities are reused, so do not hold
+// on to an id after destroying it.
+using Entity = std::uint32_t;
+
+// The part of a pool the registry needs without knowing the component type
+class PoolBase {
+public:
+    virtual ~PoolBase() = default;
+    virtual void remove(Entity entity) = 0;
+};
+
+// Sparse set of one component type. The components are packed into one
+// contiguous column with no gaps (a second column holds the owning entity
+// of each slot), so systems stream through them in order; `sparse` maps an
+// entity to its slot. Removal moves the last slot into the hole.
+template <typename T>
+class ComponentPool : public PoolBase {
+public:
+    bool contains(Entity entity) const {
+        return entity < sparse.size() && sparse[entity] != EMPTY;
+    }
+
+    T& add(Entity entity, T component) {
+        if (entity >= sparse.size())
+            sparse.resize(entity + 1, EMPTY);
+        if (sparse[entity] != EMPTY)
+            return components[sparse[entity]] = std::move(component);
+        sparse[entity] = static_cast<std::uint32_t>(entities.size());
+        entities.push_back(entity);
+        components.push_back(std::move(component));
+        return components.back();
+    }
+
+    void remove(Entity entity) override {
+        if (!contains(entity))
+            return;
+        const std::uint32_t slot = sparse[entity];
+        const Entity last = entities.back();
+        entities[slot] = last;
+        components[slot] = std::move(components.back());
+        sparse[last] = slot;
+        entities.pop_back();
+        components.pop_back();
+        sparse[entity] = EMPTY;
+    }
+
+    T& get(Entity entity) { return components[sparse[entity]]; }
+
+    // The entity's component or nullptr. Checks `slot` first: pools filled
+    // in the same entity order line up slot for slot, and then joining them
+    // reads only packed columns, never the sparse array.
+    T* find(Entity entity, std::size_t slot) {
+        if (slot < entities.size() && entities[slot] == entity)
+            return &components[slot];
+        return contains(entity) ? &components[sparse[entity]] : nullptr;
+    }
+
+    // Packed order: slot i holds the component of entityAt(i)
+    std::size_t size() const { return components.size(); }
+    Entity entityAt(std::size_t slot) const { return entities[slot]; }
+    T& at(std::size_t slot) { return components[slot]; }
+
+    void reserve(std::size_t count) {
+        entities.reserve(count);
+        components.reserve(count);
+    }
+
+private:
+    static constexpr std::uint32_t EMPTY = std::numeric_limits<std::uint32_t>::max();
+
+    std::vector<std::uint32_t> sparse;
+    std::vector<Entity> entities;
+    std::vector<T> components;
+};
+
+class Registry {
+public:
+    Entity create() {
+        if (!freeIds.empty()) {
+            const Entity entity = freeIds.back();
+            freeIds.pop_back();
+            alive[entity] = true;
+            return entity;
+        }
+        alive.push_back(true);
+        return static_cast<Entity>(alive.size() - 1);
+    }
+
+    void destroy(Entity entity) {
+        if (!isAlive(entity))
+            return;
+        for (const std::unique_ptr<PoolBase>& pool : pools) {
+            if (pool)
+                pool->remove(entity);
+        }
+        alive[entity] = false;
+        freeIds.push_back(entity);
+    }
+
+    bool isAlive(Entity entity) const { return entity < alive.size() && alive[entity]; }
+    std::size_t size() const { return alive.size() - freeIds.size(); }
+
+    template <typename T>
+    T& add(Entity entity, T component = {}) { return pool<T>().add(entity, std::move(component)); }
+
+    template <typename T>
+    void remove(Entity entity) { pool<T>().remove(entity); }
+
+    template <typename T>
+    bool has(Entity entity) { return pool<T>().contains(entity); }
+
+    template <typename T>
+    T& get(Entity entity) { return pool<T>().get(entity); }
+
+    template <typename T>
+    ComponentPool<T>& pool() {
+        const std::size_t id = componentId<T>();
+        if (id >= pools.size())
+            pools.resize(id + 1);
+        if (!pools[id])
+            pools[id] = std::make_unique<ComponentPool<T>>();
+        return static_cast<ComponentPool<T>&>(*pools[id]);
+    }
+
+    // Calls f(entity, First&, Rest&...) for every entity that has all of the
+    // components, walking First's packed column; put the rarest component
+    // first. f may change the components but must not add or remove any.
+    template <typename First, typename... Rest, typename F>
+    void each(F&& f) {
+        each<First, Rest...>(0, pool<First>().size(), f);
+    }
+
+    // Same, for slots [begin, end) of First's column only. Disjoint ranges
+    // touch disjoint entities, so they can run on different threads once
+    // every pool involved exists (see ThreadPool::parallelFor).
+    template <typename First, typename... Rest, typename F>
+    void each(std::size_t begin, std::size_t end, F&& f) {
+        ComponentPool<First>& lead = pool<First>();
+        [[maybe_unused]] std::tuple<ComponentPool<Rest>&...> others(pool<Rest>()...);
+        end = std::min(end, lead.size());
+        for (std::size_t slot = begin; slot < end; ++slot) {
+            const Entity entity = lead.entityAt(slot);
+            [[maybe_unused]] const std::tuple<Rest*...> found(std::get<ComponentPool<Rest>&>(others).find(entity, slot)...);
+            if ((std::get<Rest*>(found) && ...))
+                f(entity, lead.at(slot), *std::get<Rest*>(found)...);
+        }
+    }
+
+private:
+    static std::size_t nextComponentId() {
+        static std::atomic<std::size_t> next(0);
+        return next++;
+    }
+
+    template <typename T>
+    static std::size_t componentId() {
+        static const std::size_t id = nextComponentId();
+        return id;
+    }
+
+    std::vector<std::unique_ptr<PoolBase>> pools;  // Indexed by componentId<T>()
+    std::vector<bool> alive;
+    std::vector<Entity> freeIds;
+};
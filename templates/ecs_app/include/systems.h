@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "registry.h"
+#include "thread_pool.h"
+
+struct Bounds {
+    float width, height;
+};
+
+// Creates `count` entities with a Position, Velocity and Tint, scattered
+// over `bounds` with random directions; the same seed gives the same world
+void spawnEntities(Registry& registry, std::size_t count, Bounds bounds, std::uint32_t seed = 1);
+
+// Moves every entity with a Position and a Velocity by dt seconds and
+// bounces it off the edges of `bounds`. With a thread pool the packed
+// Position column is split into chunks that run in parallel.
+void movementSystem(Registry& registry, float dt, Bounds bounds, ThreadPool* threads = nullptr);
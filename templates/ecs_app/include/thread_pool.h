@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads for data-parallel loops. The calling thread
+// works too, so ThreadPool(1) starts no threads and runs everything inline.
+class ThreadPool {
+public:
+    // 0 uses one thread per hardware thread
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+    // Calls f(begin, end) for consecutive chunks of at most `chunk` indices
+    // covering [0, count), spread over all threads, and returns when every
+    // chunk is done. Chunks are handed out on demand, so uneven ones balance.
+    void parallelFor(std::size_t count, std::size_t chunk, const std::function<void(std::size_t, std::size_t)>& f);
+
+private:
+    void workerLoop();
+    void runChunks();
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+
+    // The current job; written under `mutex` before `generation` changes
+    const std::function<void(std::size_t, std::size_t)>* job = nullptr;
+    std::size_t jobCount = 0;
+    std::size_t jobChunk = 1;
+    std::atomic<std::size_t> nextChunk{0};
+    unsigned busy = 0;              // Workers not yet finished with the job
+    std::uint64_t generation = 0;
+    bool stopping = false;
+};
@@ -0,0 +1,33 @@
+#include "batch_renderer.h"
+
+#include "components.h"
+
+BatchRenderer::BatchRenderer(float size) : vertices(sf::Triangles), half(size / 2.0f) {}
+
+unsigned BatchRenderer::draw(Registry& registry, sf::RenderTarget& target) {
+    // Two triangles per entity; resize() only allocates when the count grows
+    vertices.resize(registry.pool<Position>().size() * 6);
+    std::size_t count = 0;
+    registry.each<Position, Tint>([&](Entity, const Position& position, const Tint& tint) {
+        const sf::Color color(tint.r, tint.g, tint.b, tint.a);
+        const sf::Vector2f corners[4] = {
+            {position.x - half, position.y - half},
+            {position.x + half, position.y - half},
+            {position.x + half, position.y + half},
+            {position.x - half, position.y + half},
+        };
+        sf::Vertex* quad = &vertices[count * 6];
+        quad[0] = sf::Vertex(corners[0], color);
+        quad[1] = sf::Vertex(corners[1], color);
+        quad[2] = sf::Vertex(corners[2], color);
+        quad[3] = sf::Vertex(corners[0], color);
+        quad[4] = sf::Vertex(corners[2], color);
+        quad[5] = sf::Vertex(corners[3], color);
+        ++count;
+    });
+    if (count == 0)
+        return 0;
+    vertices.resize(count * 6);
+    target.draw(vertices);
+    return 1;
+}
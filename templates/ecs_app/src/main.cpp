@@ -0,0 +1,83 @@
+#include <SFML/Graphics.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#include "batch_renderer.h"
+#include "registry.h"
+#include "systems.h"
+#include "thread_pool.h"
+
+static void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [--entities N] [--threads N]\n"
+              << "  --entities N  Number of moving entities (default 50000)\n"
+              << "  --threads N   Threads for the systems (default: one per core)\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t entityCount = 50000;
+    unsigned threadCount = 0;
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--entities") == 0 && hasValue) {
+            entityCount = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            threadCount = static_cast<unsigned>(std::atoi(argv[++i]));
+        } else {
+            printUsage(argv[0]);
+            return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    const Bounds bounds = {1280.0f, 720.0f};
+    sf::RenderWindow window(sf::VideoMode(1280, 720), "ECS");
+    window.setVerticalSyncEnabled(true);
+
+    Registry registry;
+    spawnEntities(registry, entityCount, bounds);
+    ThreadPool threads(threadCount);
+    BatchRenderer renderer;
+
+    // Update and render times, printed once per second
+    sf::Clock frameClock;
+    sf::Clock reportClock;
+    sf::Time updateTime;
+    sf::Time renderTime;
+    unsigned frames = 0;
+    unsigned drawCalls = 0;
+
+    while (window.isOpen()) {
+        sf::Event event;
+        while (window.pollEvent(event)) {
+            if (event.type == sf::Event::Closed)
+                window.close();
+        }
+
+        sf::Clock clock;
+        const float dt = std::min(frameClock.restart().asSeconds(), 0.1f);
+        movementSystem(registry, dt, bounds, &threads);
+        updateTime += clock.restart();
+
+        window.clear();
+        drawCalls += renderer.draw(registry, window);
+        renderTime += clock.getElapsedTime();
+        window.display();
+
+        ++frames;
+        if (reportClock.getElapsedTime() >= sf::seconds(1.0f)) {
+            std::cout << std::fixed << std::setprecision(2)
+                      << registry.size() << " entities on " << threads.size() << " thread(s): "
+                      << "update " << updateTime.asSeconds() * 1000.0f / frames << " ms"
+                      << "  render " << renderTime.asSeconds() * 1000.0f / frames << " ms"
+                      << "  draw calls " << drawCalls / frames << "/frame\n";
+            updateTime = renderTime = sf::Time::Zero;
+            frames = drawCalls = 0;
+            reportClock.restart();
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include "systems.h"
+
+#include <cmath>
+#include <random>
+
+#include "components.h"
+
+namespace {
+
+// Entities per parallel task: large enough that handing out a chunk costs
+// nothing next to processing it, small enough to balance across threads
+const std::size_t CHUNK = 16384;
+
+} // namespace
+
+void spawnEntities(Registry& registry, std::size_t count, Bounds bounds, std::uint32_t seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_int_distribution<int> channel(64, 255);
+
+    registry.pool<Position>().reserve(registry.pool<Position>().size() + count);
+    registry.pool<Velocity>().reserve(registry.pool<Velocity>().size() + count);
+    registry.pool<Tint>().reserve(registry.pool<Tint>().size() + count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Entity entity = registry.create();
+        const float angle = unit(random) * 6.2831853f;
+        const float speed = 20.0f + unit(random) * 80.0f;
+        registry.add(entity, Position{unit(random) * bounds.width, unit(random) * bounds.height});
+        registry.add(entity, Velocity{std::cos(angle) * speed, std::sin(angle) * speed});
+        registry.add(entity, Tint{static_cast<std::uint8_t>(channel(random)), static_cast<std::uint8_t>(channel(random)),
+                                  static_cast<std::uint8_t>(channel(random)), 255});
+    }
+}
+
+void movementSystem(Registry& registry, float dt, Bounds bounds, ThreadPool* threads) {
+    auto step = [dt, bounds](Entity, Position& position, Velocity& velocity) {
+        position.x += velocity.x * dt;
+        position.y += velocity.y * dt;
+        if (position.x < 0.0f || position.x > bounds.width) {
+            velocity.x = -velocity.x;
+            position.x = std::fmin(std::fmax(position.x, 0.0f), bounds.width);
+        }
+        if (position.y < 0.0f || position.y > bounds.height) {
+            velocity.y = -velocity.y;
+            position.y = std::fmin(std::fmax(position.y, 0.0f), bounds.height);
+        }
+    };
+
+    if (!threads) {
+        registry.each<Position, Velocity>(step);
+        return;
+    }
+    // Create both pools before the workers look them up
+    registry.pool<Velocity>();
+    threads->parallelFor(registry.pool<Position>().size(), CHUNK, [&](std::size_t begin, std::size_t end) {
+        registry.each<Position, Velocity>(begin, end, step);
+    });
+}
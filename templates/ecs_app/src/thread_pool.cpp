@@ -0,0 +1,73 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned threads) {
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned i = 1; i < threads; ++i)
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+void ThreadPool::parallelFor(std::size_t count, std::size_t chunk,
+                             const std::function<void(std::size_t, std::size_t)>& f) {
+    chunk = std::max<std::size_t>(chunk, 1);
+    if (workers.empty() || count <= chunk) {
+        if (count > 0)
+            f(0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &f;
+        jobCount = count;
+        jobChunk = chunk;
+        nextChunk = 0;
+        busy = static_cast<unsigned>(workers.size());
+        ++generation;
+    }
+    wake.notify_all();
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return busy == 0; });
+    job = nullptr;
+}
+
+void ThreadPool::runChunks() {
+    for (;;) {
+        const std::size_t begin = nextChunk++ * jobChunk;
+        if (begin >= jobCount)
+            return;
+        (*job)(begin, std::min(begin + jobChunk, jobCount));
+    }
+}
+
+void ThreadPool::workerLoop() {
+    std::uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping)
+                return;
+            seen = generation;
+        }
+        runChunks();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--busy == 0)
+            done.notify_one();
+    }
+}
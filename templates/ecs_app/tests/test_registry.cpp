@@ -0,0 +1,121 @@
+// Tests for the registry, the thread pool and the movement system; needs no SFML
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "components.h"
+#include "registry.h"
+#include "systems.h"
+#include "thread_pool.h"
+
+static int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::cerr << __FILE__ << ':' << __LINE__ << ": " #condition "\n";   \
+            ++failures;                                                         \
+        }                                                                       \
+    } while (0)
+
+static void testRemovalKeepsColumnsPacked() {
+    Registry registry;
+    const Entity a = registry.create();
+    const Entity b = registry.create();
+    const Entity c = registry.create();
+    registry.add(a, Position{1, 1});
+    registry.add(b, Position{2, 2});
+    registry.add(c, Position{3, 3});
+
+    registry.remove<Position>(a);
+    ComponentPool<Position>& positions = registry.pool<Position>();
+    CHECK(positions.size() == 2);
+    CHECK(!registry.has<Position>(a));
+    CHECK(positions.entityAt(0) == c); // The last slot filled the hole
+    CHECK(registry.get<Position>(c).x == 3 && registry.get<Position>(b).x == 2);
+}
+
+static void testEachJoinsComponents() {
+    Registry registry;
+    std::vector<Entity> moving;
+    for (int i = 0; i < 10; ++i) {
+        const Entity entity = registry.create();
+        registry.add(entity, Position{float(i), 0});
+        if (i % 3 == 0) {
+            registry.add(entity, Velocity{1, 0});
+            moving.push_back(entity);
+        }
+    }
+    std::vector<Entity> visited;
+    registry.each<Position, Velocity>([&](Entity entity, Position& position, Velocity& velocity) {
+        CHECK(position.x == float(entity) && velocity.x == 1);
+        visited.push_back(entity);
+    });
+    CHECK(visited == moving);
+}
+
+static void testDestroyRemovesComponentsAndRecyclesIds() {
+    Registry registry;
+    const Entity a = registry.create();
+    registry.add(a, Position{});
+    registry.add(a, Tint{});
+    registry.create();
+    registry.destroy(a);
+    CHECK(!registry.isAlive(a));
+    CHECK(registry.size() == 1);
+    CHECK(registry.pool<Position>().size() == 0 && registry.pool<Tint>().size() == 0);
+    CHECK(registry.create() == a);
+}
+
+static void testParallelForCoversEveryIndexOnce() {
+    ThreadPool threads(4);
+    std::vector<std::atomic<int>> hits(100003);
+    for (int round = 0; round < 3; ++round) {
+        threads.parallelFor(hits.size(), 1000, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+                ++hits[i];
+        });
+    }
+    bool all = true;
+    for (const std::atomic<int>& count : hits)
+        all = all && count == 3;
+    CHECK(all);
+}
+
+static void testParallelMovementMatchesSerial() {
+    const Bounds bounds = {100.0f, 50.0f};
+    Registry serial;
+    Registry parallel;
+    spawnEntities(serial, 50000, bounds, 7);
+    spawnEntities(parallel, 50000, bounds, 7);
+    ThreadPool threads(3);
+    for (int tick = 0; tick < 120; ++tick) {
+        movementSystem(serial, 0.1f, bounds);
+        movementSystem(parallel, 0.1f, bounds, &threads);
+    }
+    bool same = true;
+    bool inside = true;
+    serial.each<Position>([&](Entity entity, Position& position) {
+        const Position& other = parallel.get<Position>(entity);
+        same = same && position.x == other.x && position.y == other.y;
+        inside = inside && position.x >= 0 && position.x <= bounds.width && position.y >= 0 &&
+                 position.y <= bounds.height;
+    });
+    CHECK(same);
+    CHECK(inside);
+}
+
+int main() {
+    testRemovalKeepsColumnsPacked();
+    testEachJoinsComponents();
+    testDestroyRemovesComponentsAndRecyclesIds();
+    testParallelForCoversEveryIndexOnce();
+    testParallelMovementMatchesSerial();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "All ECS tests passed\n";
+    return EXIT_SUCCESS;
+}
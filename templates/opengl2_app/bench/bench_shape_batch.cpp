@@ -0,0 +1,37 @@
+// Cost of building a frame of shapes on the CPU, without OpenGL:
+//   make bench [SHAPES=100000] [FRAMES=200]
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "shape_batch.hpp"
+
+int main(int argc, char* argv[]) {
+    const int shapes = argc > 1 ? std::atoi(argv[1]) : 100000;
+    const int frames = argc > 2 ? std::atoi(argv[2]) : 200;
+
+    ShapeBatch batch;
+    std::size_t vertices = 0;
+    double fastest = 1e30;
+    for (int frame = 0; frame < frames; ++frame) {
+        const auto start = std::chrono::steady_clock::now();
+        batch.clear();
+        for (int i = 0; i < shapes; ++i) {
+            const float x = (i % 1000) * 0.002f - 1.0f;
+            const float y = (i / 1000 % 1000) * 0.002f - 1.0f;
+            batch.setColor(x, y, 0.5f);
+            if (i % 2)
+                batch.addCircle(x, y, 0.01f, 16);
+            else
+                batch.addSquare(x, y, 0.01f);
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        fastest = std::min(fastest, seconds);
+        vertices = batch.triangles().size();
+    }
+
+    std::cout << shapes << " shapes (" << vertices << " vertices) per frame, best of " << frames << ":\n"
+              << "  " << fastest * 1e3 << " ms/frame, " << fastest * 1e9 / shapes << " ns/shape\n";
+    return 0;
+}
@@ -0,0 +1,28 @@
+#ifndef GL_BATCH_RENDERER_HPP
+#define GL_BATCH_RENDERER_HPP
+
+#include <GL/gl.h>
+
+#include "shape_batch.hpp"
+
+// Uploads a ShapeBatch into vertex buffer objects and draws it with one
+// glDrawArrays per primitive type, through the OpenGL 2.1 fixed-function
+// vertex and color arrays. Needs a current context for its whole lifetime.
+class GlBatchRenderer {
+public:
+    GlBatchRenderer();
+    ~GlBatchRenderer();
+
+    GlBatchRenderer(const GlBatchRenderer&) = delete;
+    GlBatchRenderer& operator=(const GlBatchRenderer&) = delete;
+
+    // Returns the number of draw calls issued (empty types are skipped)
+    int draw(const ShapeBatch& batch);
+
+private:
+    int submit(GLuint buffer, GLenum mode, const std::vector<BatchVertex>& vertices);
+
+    GLuint buffers[2];  // Triangles, lines
+};
+
+#endif // GL_BATCH_RENDERER_HPP
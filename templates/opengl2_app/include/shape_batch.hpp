@@ -0,0 +1,59 @@
+#ifndef SHAPE_BATCH_HPP
+#define SHAPE_BATCH_HPP
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+// Interleaved vertex as uploaded to the GPU: position, then RGBA color
+struct BatchVertex {
+    float x, y;
+    std::uint8_t r, g, b, a;
+};
+
+// cos/sin of the corners of a regular polygon with `segments` sides,
+// computed once per segment count instead of on every draw
+class CircleTables {
+public:
+    struct Point {
+        float x, y;
+    };
+
+    const std::vector<Point>& get(int segments);
+
+private:
+    std::map<int, std::vector<Point>> tables;
+};
+
+// Retained-mode shape list. Shapes are appended as triangles (or lines)
+// into one CPU vertex array per primitive type, so a frame of any number
+// of shapes is submitted with one draw call per type (see
+// GlBatchRenderer). Uses no OpenGL, so it can be tested and benchmarked
+// without a context. clear() keeps the storage for the next frame.
+class ShapeBatch {
+public:
+    void clear();
+
+    // Color of the shapes added after this call, components in [0, 1]
+    void setColor(float r, float g, float b, float a = 1.0f);
+
+    // Same geometry as the immediate-mode functions in shapes.hpp
+    void addTriangle(float x, float y, float size);
+    void addSquare(float x, float y, float size);
+    void addRectangle(float x, float y, float width, float height);
+    void addCircle(float x, float y, float radius, int segments = 32);
+    void addLine(float x1, float y1, float x2, float y2);
+
+    const std::vector<BatchVertex>& triangles() const { return triangleVertices; }
+    const std::vector<BatchVertex>& lines() const { return lineVertices; }
+
+private:
+    void vertex(std::vector<BatchVertex>& vertices, float x, float y);
+
+    std::vector<BatchVertex> triangleVertices;
+    std::vector<BatchVertex> lineVertices;
+    std::uint8_t color[4] = {255, 255, 255, 255};
+    CircleTables circles;
+};
+
+#endif // SHAPE_BATCH_HPP
@@ -2,7 +2,12 @@
 #define SHAPES_HPP
 
 #include <GLFW/glfw3.h>
-#include <cmath>
+
+#include "shape_batch.hpp"
+
+// Immediate-mode helpers: one glBegin/glEnd per shape. Fine for a handful
+// of shapes; for many, add them to a ShapeBatch and draw it with
+// GlBatchRenderer instead.
 
 // Draw a triangle centered at (x, y)
 inline void drawTriangle(float x, float y, float size) {
@@ -39,13 +44,13 @@ inline void drawRectangle(float x, float y, float width, float height) {
 
 // Draw a circle centered at (x, y)
 inline void drawCircle(float x, float y, float radius, int segments = 32) {
+    static CircleTables circles; // GL calls come from one thread
+    const std::vector<CircleTables::Point>& table = circles.get(segments);
     glBegin(GL_TRIANGLE_FAN);
         glVertex2f(x, y); // center
         for (int i = 0; i <= segments; ++i) {
-            float angle = i * 2.0f * M_PI / segments;
-            float dx = cosf(angle) * radius;
-            float dy = sinf(angle) * radius;
-            glVertex2f(x + dx, y + dy);
+            const CircleTables::Point& point = table[i % segments];
+            glVertex2f(x + point.x * radius, y + point.y * radius);
         }
     glEnd();
 }
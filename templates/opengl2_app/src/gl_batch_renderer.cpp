@@ -0,0 +1,41 @@
+// glGenBuffers and friends are OpenGL 1.5; libGL exports them directly
+#define GL_GLEXT_PROTOTYPES
+
+#include "gl_batch_renderer.hpp"
+
+#include <GL/glext.h>
+#include <cstddef>
+
+GlBatchRenderer::GlBatchRenderer() {
+    glGenBuffers(2, buffers);
+}
+
+GlBatchRenderer::~GlBatchRenderer() {
+    glDeleteBuffers(2, buffers);
+}
+
+int GlBatchRenderer::draw(const ShapeBatch& batch) {
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    int calls = submit(buffers[0], GL_TRIANGLES, batch.triangles());
+    calls += submit(buffers[1], GL_LINES, batch.lines());
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return calls;
+}
+
+int GlBatchRenderer::submit(GLuint buffer, GLenum mode, const std::vector<BatchVertex>& vertices) {
+    if (vertices.empty())
+        return 0;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    // Respecifying the whole store every frame lets the driver hand out
+    // fresh memory instead of waiting for the previous frame's draw
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(BatchVertex), vertices.data(), GL_STREAM_DRAW);
+    glVertexPointer(2, GL_FLOAT, sizeof(BatchVertex),
+                    reinterpret_cast<const void*>(offsetof(BatchVertex, x)));
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(BatchVertex),
+                   reinterpret_cast<const void*>(offsetof(BatchVertex, r)));
+    glDrawArrays(mode, 0, static_cast<GLsizei>(vertices.size()));
+    return 1;
+}
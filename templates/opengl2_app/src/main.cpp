@@ -1,7 +1,8 @@
 #include <GLFW/glfw3.h>
 #include <iostream>
 
-#include "shapes.hpp"
+#include "gl_batch_renderer.hpp"
+#include "shape_batch.hpp"
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
     glViewport(0, 0, width, height);
@@ -32,18 +33,29 @@ int main() {
     glfwGetFramebufferSize(window, &width, &height);
     framebuffer_size_callback(window, width, height);
 
-    // Main render loop
-    while (!glfwWindowShouldClose(window)) {
-        glClear(GL_COLOR_BUFFER_BIT);
+    // Shapes are collected on the CPU each frame and drawn in one call
+    // per primitive type. The renderer is scoped so that its buffers are
+    // deleted while the context still exists.
+    ShapeBatch batch;
+    {
+        GlBatchRenderer renderer;
 
-        glColor3f(1, 0, 0);
-        drawSquare(0.0f, 0.0f, 0.5f);
+        // Main render loop
+        while (!glfwWindowShouldClose(window)) {
+            glClear(GL_COLOR_BUFFER_BIT);
 
-        glColor3f(0, 1, 0);
-        drawCircle(-0.5f, -0.5f, 0.2f);
+            batch.clear();
+            batch.setColor(1, 0, 0);
+            batch.addSquare(0.0f, 0.0f, 0.5f);
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+            batch.setColor(0, 1, 0);
+            batch.addCircle(-0.5f, -0.5f, 0.2f);
+
+            renderer.draw(batch);
+
+            glfwSwapBuffers(window);
+            glfwPollEvents();
+        }
     }
 
     glfwDestroyWindow(window);
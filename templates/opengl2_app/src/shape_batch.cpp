@@ -0,0 +1,89 @@
+#include "shape_batch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+std::uint8_t toByte(float component) {
+    return static_cast<std::uint8_t>(std::clamp(component, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+} // namespace
+
+const std::vector<CircleTables::Point>& CircleTables::get(int segments) {
+    std::vector<Point>& table = tables[segments];
+    if (table.empty()) {
+        table.reserve(segments);
+        for (int i = 0; i < segments; ++i) {
+            const double angle = i * 2.0 * M_PI / segments;
+            table.push_back({static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle))});
+        }
+    }
+    return table;
+}
+
+void ShapeBatch::clear() {
+    triangleVertices.clear();
+    lineVertices.clear();
+}
+
+void ShapeBatch::setColor(float r, float g, float b, float a) {
+    color[0] = toByte(r);
+    color[1] = toByte(g);
+    color[2] = toByte(b);
+    color[3] = toByte(a);
+}
+
+void ShapeBatch::vertex(std::vector<BatchVertex>& vertices, float x, float y) {
+    vertices.push_back({x, y, color[0], color[1], color[2], color[3]});
+}
+
+void ShapeBatch::addTriangle(float x, float y, float size) {
+    float half = size / 2.0f;
+    vertex(triangleVertices, x, y + half);
+    vertex(triangleVertices, x - half, y - half);
+    vertex(triangleVertices, x + half, y - half);
+}
+
+void ShapeBatch::addSquare(float x, float y, float size) {
+    addRectangle(x, y, size, size);
+}
+
+void ShapeBatch::addRectangle(float x, float y, float width, float height) {
+    float hw = width / 2.0f;
+    float hh = height / 2.0f;
+    // Two triangles; GL_QUADS would need its own draw call
+    vertex(triangleVertices, x - hw, y - hh);
+    vertex(triangleVertices, x + hw, y - hh);
+    vertex(triangleVertices, x + hw, y + hh);
+    vertex(triangleVertices, x - hw, y - hh);
+    vertex(triangleVertices, x + hw, y + hh);
+    vertex(triangleVertices, x - hw, y + hh);
+}
+
+void ShapeBatch::addCircle(float x, float y, float radius, int segments) {
+    if (segments < 3)
+        return;
+    // The fan of shapes.hpp, unrolled into separate triangles so that
+    // circles share the draw call with everything else
+    const std::vector<CircleTables::Point>& table = circles.get(segments);
+    // Written through a pointer after one resize: this loop dominates the
+    // cost of a frame full of circles
+    const std::size_t first = triangleVertices.size();
+    triangleVertices.resize(first + 3 * segments);
+    BatchVertex* out = triangleVertices.data() + first;
+    const BatchVertex center = {x, y, color[0], color[1], color[2], color[3]};
+    for (int i = 0; i < segments; ++i) {
+        const CircleTables::Point& a = table[i];
+        const CircleTables::Point& b = table[i + 1 == segments ? 0 : i + 1];
+        *out++ = center;
+        *out++ = {x + a.x * radius, y + a.y * radius, color[0], color[1], color[2], color[3]};
+        *out++ = {x + b.x * radius, y + b.y * radius, color[0], color[1], color[2], color[3]};
+    }
+}
+
+void ShapeBatch::addLine(float x1, float y1, float x2, float y2) {
+    vertex(lineVertices, x1, y1);
+    vertex(lineVertices, x2, y2);
+}
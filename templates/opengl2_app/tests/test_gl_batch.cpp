@@ -0,0 +1,93 @@
+// Renders a ShapeBatch through GlBatchRenderer into an offscreen EGL
+// pbuffer and reads the pixels back. Runs without a display on Mesa's
+// software rasterizer (llvmpipe):
+//   make test-gl
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <cstdlib>
+#include <iostream>
+
+#include "gl_batch_renderer.hpp"
+
+static const int SIZE = 64;
+
+static int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::cerr << __FILE__ << ':' << __LINE__ << ": " #condition "\n";   \
+            ++failures;                                                         \
+        }                                                                       \
+    } while (0)
+
+// A desktop GL context on a surfaceless Mesa display, if there is one
+static bool createOffscreenContext() {
+    auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+        eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    EGLDisplay display = getPlatformDisplay
+        ? getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr)
+        : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr) || !eglBindAPI(EGL_OPENGL_API))
+        return false;
+
+    const EGLint configAttributes[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_NONE,
+    };
+    EGLConfig config;
+    EGLint count = 0;
+    if (!eglChooseConfig(display, configAttributes, &config, 1, &count) || count == 0)
+        return false;
+
+    const EGLint surfaceAttributes[] = {EGL_WIDTH, SIZE, EGL_HEIGHT, SIZE, EGL_NONE};
+    EGLSurface surface = eglCreatePbufferSurface(display, config, surfaceAttributes);
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, nullptr);
+    return surface != EGL_NO_SURFACE && context != EGL_NO_CONTEXT &&
+           eglMakeCurrent(display, surface, surface, context);
+}
+
+// Color of the pixel at (x, y), counted from the bottom left
+static unsigned pixel(int x, int y) {
+    unsigned char rgba[4];
+    glReadPixels(x, y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+    return rgba[0] << 16 | rgba[1] << 8 | rgba[2];
+}
+
+int main() {
+    if (!createOffscreenContext()) {
+        std::cerr << "No offscreen OpenGL context (is Mesa's EGL installed?)\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "Renderer: " << glGetString(GL_RENDERER) << '\n';
+    glViewport(0, 0, SIZE, SIZE);
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    ShapeBatch batch;
+    batch.setColor(1, 0, 0);
+    batch.addSquare(0.0f, 0.0f, 0.5f);
+    batch.setColor(0, 1, 0);
+    batch.addCircle(-0.5f, -0.5f, 0.2f);
+    batch.setColor(0, 0, 1);
+    batch.addLine(-1.0f, 0.765625f, 1.0f, 0.765625f); // Through the middle of row 56
+
+    {
+        GlBatchRenderer renderer;
+        CHECK(renderer.draw(batch) == 2);
+        glFinish();
+        CHECK(glGetError() == GL_NO_ERROR);
+    }
+
+    CHECK(pixel(32, 32) == 0xff0000); // Square
+    CHECK(pixel(16, 16) == 0x00ff00); // Circle
+    CHECK(pixel(8, 56) == 0x0000ff);  // Line
+    CHECK(pixel(60, 8) == 0x000000);  // Background
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "All GL batch tests passed\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+// Tests for ShapeBatch; needs no OpenGL context
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "shape_batch.hpp"
+
+static int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::cerr << __FILE__ << ':' << __LINE__ << ": " #condition "\n";   \
+            ++failures;                                                         \
+        }                                                                       \
+    } while (0)
+
+static void testRectangleIsTwoTriangles() {
+    ShapeBatch batch;
+    batch.setColor(1, 0, 0);
+    batch.addRectangle(0.0f, 0.0f, 2.0f, 1.0f);
+    CHECK(batch.triangles().size() == 6);
+    CHECK(batch.lines().empty());
+    for (const BatchVertex& v : batch.triangles()) {
+        CHECK(std::fabs(v.x) == 1.0f && std::fabs(v.y) == 0.5f);
+        CHECK(v.r == 255 && v.g == 0 && v.b == 0 && v.a == 255);
+    }
+}
+
+static void testCircleUsesTableAndCloses() {
+    ShapeBatch batch;
+    batch.addCircle(1.0f, 2.0f, 0.5f, 16);
+    const auto& vertices = batch.triangles();
+    CHECK(vertices.size() == 16 * 3);
+    for (const BatchVertex& v : vertices) {
+        const float distance = std::hypot(v.x - 1.0f, v.y - 2.0f);
+        CHECK(distance == 0.0f || std::fabs(distance - 0.5f) < 1e-5f);
+    }
+    // The last triangle ends where the first one starts
+    CHECK(vertices.back().x == vertices[1].x && vertices.back().y == vertices[1].y);
+}
+
+static void testColorsAndLinesAccumulateUntilClear() {
+    ShapeBatch batch;
+    batch.setColor(0, 1, 0, 0.5f);
+    batch.addTriangle(0, 0, 1);
+    batch.addLine(0, 0, 1, 1);
+    batch.setColor(0, 0, 1);
+    batch.addSquare(0, 0, 1);
+    CHECK(batch.triangles().size() == 9);
+    CHECK(batch.lines().size() == 2);
+    CHECK(batch.triangles()[0].g == 255 && batch.triangles()[0].a == 128);
+    CHECK(batch.triangles()[8].b == 255 && batch.triangles()[8].g == 0);
+
+    const std::size_t capacity = batch.triangles().capacity();
+    batch.clear();
+    CHECK(batch.triangles().empty() && batch.lines().empty());
+    CHECK(batch.triangles().capacity() == capacity);
+}
+
+int main() {
+    testRectangleIsTwoTriangles();
+    testCircleUsesTableAndCloses();
+    testColorsAndLinesAccumulateUntilClear();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "All shape batch tests passed\n";
+    return EXIT_SUCCESS;
+}
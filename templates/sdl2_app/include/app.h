@@ -2,9 +2,18 @@
 
 #include <SDL.h>
 
+#include <string>
+
+struct AppOptions {
+    int frames = 0;         // Quit after this many frames; 0 runs until closed
+    double fps = 60.0;      // Frame pacing without vsync; 0 runs uncapped
+    bool vsync = true;      // Let SDL_RenderPresent pace frames when it can
+    std::string csvPath;    // Frame-time histogram written here on exit
+};
+
 class App {
 public:
-    App();
+    explicit App(AppOptions options = {});
     ~App();
 
     bool init();
@@ -12,10 +21,18 @@ public:
 
 private:
     void handleEvents();
-    void update();
-    void render();
+    void update(double dt);
+    void render(double alpha);
 
+    AppOptions options;
     SDL_Window* window;
     SDL_Renderer* renderer;
     bool running;
+    bool vsync;
+
+    // Simulation state: the previous and current update, so that render()
+    // can interpolate between them
+    double previousX;
+    double currentX;
+    double velocity;
 };
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Time source for FrameScheduler. App wires it to SDL_GetPerformanceCounter,
+// SDL_GetPerformanceFrequency and SDL_Delay; tests use a fake clock, so
+// nothing here depends on SDL.
+struct FrameClock {
+    std::function<std::uint64_t()> now;         // Counter ticks
+    std::uint64_t frequency;                    // Ticks per second
+    std::function<void(std::uint32_t)> sleepMs; // May oversleep by a few ms
+};
+
+// Frame times of the last `capacity` frames
+class FrameStats {
+public:
+    // Frames longer than 1.5 x `nominalPeriod` count as dropped
+    FrameStats(std::size_t capacity, double nominalPeriod);
+
+    void record(double seconds);
+
+    std::size_t frames() const { return count; }   // In the window
+    std::size_t dropped() const;
+    double percentile(double p) const;              // p in [0, 1]; seconds
+    double max() const { return percentile(1.0); }
+
+    // Histogram of the window in 1 ms buckets as "frame_ms,frames" lines;
+    // the last bucket also holds everything slower. Returns false when
+    // the file cannot be written.
+    bool writeCsv(const std::string& path, int buckets = 50) const;
+
+private:
+    std::vector<double> samples;    // Ring buffer
+    std::size_t next = 0;
+    std::size_t count = 0;
+    double nominalPeriod;
+};
+
+// Fixed-timestep loop timing. Each frame, beginFrame() says how many
+// update(dt) steps to run to catch the simulation up with real time and
+// how far between the last two states to interpolate when rendering.
+// endFrame() then waits for the next frame deadline: a coarse sleep until
+// about 2 ms before it, then spinning on the counter, so frames land on
+// time instead of drifting by the sleep granularity. With a frame period of
+// 0 it does not wait (vsync'd present, or an uncapped benchmark).
+class FrameScheduler {
+public:
+    struct Frame {
+        int updates;    // Number of fixed steps to run now
+        double alpha;   // Fraction of a step since the last one, in [0, 1)
+    };
+
+    FrameScheduler(FrameClock clock, double updateRate, double frameRate, std::size_t statsWindow = 600);
+
+    Frame beginFrame();
+    void endFrame();
+
+    double updateDelta() const { return updateStep; }
+    const FrameStats& stats() const { return frameStats; }
+
+private:
+    double seconds(std::uint64_t ticks) const;
+
+    FrameClock clock;
+    double updateStep;
+    std::uint64_t framePeriod;  // Ticks; 0 means no pacing
+    std::uint64_t lastFrame = 0;
+    std::uint64_t deadline = 0;
+    double accumulator = 0.0;
+    bool started = false;
+    FrameStats frameStats;
+};
@@ -1,7 +1,29 @@
 #include "app.h"
+#include <cstring>
+#include <iomanip>
 #include <iostream>
+#include <utility>
 
-App::App() : window(nullptr), renderer(nullptr), running(false) {}
+#include "frame_scheduler.h"
+
+namespace {
+
+// Fixed simulation rate; rendering runs at whatever rate the display allows
+const double UPDATE_RATE = 60.0;
+
+FrameClock sdlClock() {
+    return {
+        [] { return static_cast<std::uint64_t>(SDL_GetPerformanceCounter()); },
+        static_cast<std::uint64_t>(SDL_GetPerformanceFrequency()),
+        [](std::uint32_t ms) { SDL_Delay(ms); },
+    };
+}
+
+} // namespace
+
+App::App(AppOptions options)
+    : options(std::move(options)), window(nullptr), renderer(nullptr), running(false), vsync(false),
+      previousX(350.0), currentX(350.0), velocity(200.0) {}
 
 App::~App() {
     SDL_DestroyRenderer(renderer);
@@ -27,22 +49,51 @@ bool App::init() {
         return false;
     }
 
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    const Uint32 vsyncFlag = options.vsync ? SDL_RENDERER_PRESENTVSYNC : 0;
+    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | vsyncFlag);
+    if (!renderer) {
+        // No GPU renderer, e.g. under SDL_VIDEODRIVER=dummy in CI
+        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE | vsyncFlag);
+    }
     if (!renderer) {
         std::cerr << "Renderer could not be created: " << SDL_GetError() << std::endl;
         return false;
     }
 
+    // Trust vsync only when the renderer reports it and there is a real
+    // display to sync with; otherwise the scheduler paces frames itself
+    SDL_RendererInfo info;
+    const char* driver = SDL_GetCurrentVideoDriver();
+    vsync = SDL_GetRendererInfo(renderer, &info) == 0 && (info.flags & SDL_RENDERER_PRESENTVSYNC) &&
+            !(driver && std::strcmp(driver, "dummy") == 0);
+
     running = true;
     return true;
 }
 
 void App::run() {
-    while (running) {
+    FrameScheduler scheduler(sdlClock(), UPDATE_RATE, vsync ? 0.0 : options.fps);
+
+    for (int frame = 0; running && (options.frames == 0 || frame < options.frames); ++frame) {
+        const FrameScheduler::Frame timing = scheduler.beginFrame();
         handleEvents();
-        update();
-        render();
-        SDL_Delay(16); // ~60 FPS
+        for (int i = 0; i < timing.updates; ++i) {
+            update(scheduler.updateDelta());
+        }
+        render(timing.alpha);
+        scheduler.endFrame();
+    }
+
+    const FrameStats& stats = scheduler.stats();
+    std::cout << std::fixed << std::setprecision(3)
+              << "Last " << stats.frames() << " frames:"
+              << "  p50 " << stats.percentile(0.50) * 1000.0 << " ms"
+              << "  p99 " << stats.percentile(0.99) * 1000.0 << " ms"
+              << "  max " << stats.max() * 1000.0 << " ms"
+              << "  dropped " << stats.dropped()
+              << (vsync ? "  (vsync)" : "") << std::endl;
+    if (!options.csvPath.empty() && !stats.writeCsv(options.csvPath)) {
+        std::cerr << "Could not write " << options.csvPath << std::endl;
     }
 }
 
@@ -55,16 +106,25 @@ void App::handleEvents() {
     }
 }
 
-void App::update() {
-    // Game logic goes here
+void App::update(double dt) {
+    // Game logic goes here; dt is always the fixed step
+    previousX = currentX;
+    currentX += velocity * dt;
+    if (currentX < 0.0 || currentX > 700.0) {
+        velocity = -velocity;
+        currentX = currentX < 0.0 ? -currentX : 1400.0 - currentX;
+    }
 }
 
-void App::render() {
+void App::render(double alpha) {
     SDL_SetRenderDrawColor(renderer, 30, 30, 30, 255);
     SDL_RenderClear(renderer);
 
     SDL_SetRenderDrawColor(renderer, 255, 100, 100, 255);
-    SDL_Rect rect = { 350, 250, 100, 100 };
+    // Draw between the last two updates so motion stays smooth when the
+    // frame rate and the update rate differ
+    const double x = previousX + (currentX - previousX) * alpha;
+    SDL_Rect rect = { static_cast<int>(x), 250, 100, 100 };
     SDL_RenderFillRect(renderer, &rect);
 
     SDL_RenderPresent(renderer);
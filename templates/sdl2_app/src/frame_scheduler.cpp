@@ -0,0 +1,109 @@
+#include "frame_scheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace {
+
+// Longest real time one frame may feed into the simulation. After a stall
+// (a breakpoint, a dragged window) the game slows down instead of running
+// hundreds of updates to catch up, each making the next frame later still.
+const double MAX_FRAME_TIME = 0.25;
+
+// How long before the deadline endFrame() stops sleeping and starts spinning
+const std::uint64_t SPIN_MS = 2;
+
+} // namespace
+
+FrameStats::FrameStats(std::size_t capacity, double nominalPeriod)
+    : samples(std::max<std::size_t>(capacity, 1)), nominalPeriod(nominalPeriod) {}
+
+void FrameStats::record(double seconds) {
+    samples[next] = seconds;
+    next = (next + 1) % samples.size();
+    count = std::min(count + 1, samples.size());
+}
+
+std::size_t FrameStats::dropped() const {
+    return std::count_if(samples.begin(), samples.begin() + count,
+                         [this](double seconds) { return seconds > nominalPeriod * 1.5; });
+}
+
+double FrameStats::percentile(double p) const {
+    if (count == 0)
+        return 0.0;
+    std::vector<double> sorted(samples.begin(), samples.begin() + count);
+    const std::size_t rank = static_cast<std::size_t>(std::ceil(p * count));
+    const auto nth = sorted.begin() + (std::clamp<std::size_t>(rank, 1, count) - 1);
+    std::nth_element(sorted.begin(), nth, sorted.end());
+    return *nth;
+}
+
+bool FrameStats::writeCsv(const std::string& path, int buckets) const {
+    std::vector<std::size_t> histogram(std::max(buckets, 1));
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t bucket = static_cast<std::size_t>(samples[i] * 1000.0);
+        ++histogram[std::min(bucket, histogram.size() - 1)];
+    }
+
+    std::ofstream file(path);
+    file << "frame_ms,frames\n";
+    for (std::size_t ms = 0; ms < histogram.size(); ++ms)
+        file << ms << ',' << histogram[ms] << '\n';
+    return static_cast<bool>(file);
+}
+
+FrameScheduler::FrameScheduler(FrameClock clock, double updateRate, double frameRate, std::size_t statsWindow)
+    : clock(std::move(clock)),
+      updateStep(1.0 / updateRate),
+      framePeriod(frameRate > 0.0 ? static_cast<std::uint64_t>(this->clock.frequency / frameRate) : 0),
+      frameStats(statsWindow, frameRate > 0.0 ? 1.0 / frameRate : updateStep) {}
+
+double FrameScheduler::seconds(std::uint64_t ticks) const {
+    return static_cast<double>(ticks) / clock.frequency;
+}
+
+FrameScheduler::Frame FrameScheduler::beginFrame() {
+    const std::uint64_t now = clock.now();
+    if (!started) {
+        started = true;
+        lastFrame = now;
+        deadline = now + framePeriod;
+        return {0, 0.0};
+    }
+
+    const double elapsed = seconds(now - lastFrame);
+    lastFrame = now;
+    frameStats.record(elapsed);
+
+    accumulator += std::min(elapsed, MAX_FRAME_TIME);
+    Frame frame = {0, 0.0};
+    while (accumulator >= updateStep) {
+        accumulator -= updateStep;
+        ++frame.updates;
+    }
+    frame.alpha = accumulator / updateStep;
+    return frame;
+}
+
+void FrameScheduler::endFrame() {
+    if (framePeriod == 0)
+        return;
+
+    std::uint64_t now = clock.now();
+    if (now >= deadline) {
+        // Missed it: start the next frame now and give it a full period,
+        // rather than rushing the following frames to make up for this one
+        deadline = now + framePeriod;
+        return;
+    }
+
+    const std::uint64_t spin = clock.frequency * SPIN_MS / 1000;
+    if (deadline - now > spin)
+        clock.sleepMs(static_cast<std::uint32_t>((deadline - now - spin) * 1000 / clock.frequency));
+    while (clock.now() < deadline) {
+        // Spin for the last stretch: sleeps are only accurate to a few ms
+    }
+    deadline += framePeriod;
+}
@@ -1,11 +1,42 @@
 #include "app.h"
 
-int main() {
-    App app;
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+static void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [--frames N] [--fps N] [--no-vsync] [--csv FILE]\n"
+              << "  --frames N   Quit after N frames (with SDL_VIDEODRIVER=dummy this runs\n"
+              << "               without a display)\n"
+              << "  --fps N      Frame rate to pace to without vsync (default 60; 0 = uncapped)\n"
+              << "  --no-vsync   Pace frames with the performance counter instead\n"
+              << "  --csv FILE   Write the frame-time histogram to FILE on exit\n";
+}
+
+int main(int argc, char* argv[]) {
+    AppOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--frames") == 0 && hasValue) {
+            options.frames = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--fps") == 0 && hasValue) {
+            options.fps = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--no-vsync") == 0) {
+            options.vsync = false;
+        } else if (std::strcmp(argv[i], "--csv") == 0 && hasValue) {
+            options.csvPath = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    App app(options);
     
-    if (app.init()) {
-        app.run();
+    if (!app.init()) {
+        return 1;
     }
+    app.run();
 
     return 0;
 }
@@ -0,0 +1,115 @@
+// Tests for FrameScheduler and FrameStats against a fake clock; needs no SDL
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "frame_scheduler.h"
+
+static int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::cerr << __FILE__ << ':' << __LINE__ << ": " #condition "\n";   \
+            ++failures;                                                         \
+        }                                                                       \
+    } while (0)
+
+// Microsecond ticks. Every read advances 1 us so that spinning makes
+// progress; sleeps overshoot by 1 ms like a real scheduler might.
+static std::uint64_t ticks = 0;
+
+static FrameClock fakeClock() {
+    return {[] { return ticks++; }, 1000000, [](std::uint32_t ms) { ticks += (ms + 1) * 1000; }};
+}
+
+static void testPacesFramesToTheTargetRate() {
+    FrameScheduler scheduler(fakeClock(), 60.0, 60.0);
+    int updates = 0;
+    for (int frame = 0; frame < 121; ++frame) {
+        updates += scheduler.beginFrame().updates;
+        ticks += 5000; // 5 ms of work
+        scheduler.endFrame();
+    }
+    const FrameStats& stats = scheduler.stats();
+    CHECK(stats.frames() == 120);
+    CHECK(std::fabs(stats.percentile(0.5) - 1.0 / 60.0) < 0.0001);
+    CHECK(stats.max() < 1.0 / 60.0 + 0.0001);
+    CHECK(stats.dropped() == 0);
+    CHECK(updates >= 119 && updates <= 120);
+}
+
+static void testSlowFramesRunSeveralUpdatesAndCountAsDropped() {
+    FrameScheduler scheduler(fakeClock(), 100.0, 60.0);
+    scheduler.beginFrame();
+    scheduler.endFrame();
+    int updates = 0;
+    for (int frame = 0; frame < 10; ++frame) {
+        FrameScheduler::Frame timing = scheduler.beginFrame();
+        CHECK(timing.alpha >= 0.0 && timing.alpha < 1.0);
+        updates += timing.updates;
+        ticks += 40000; // 40 ms of work: every deadline is missed
+        scheduler.endFrame();
+    }
+    // The first frame was paced to 16.7 ms; the others take 40 ms, 4 updates each
+    CHECK(scheduler.stats().dropped() == 9);
+    CHECK(std::fabs(scheduler.stats().percentile(0.9) - 0.04) < 0.0001);
+    CHECK(updates >= 37 && updates <= 38);
+}
+
+static void testUnpacedFramesAccumulateFractionalSteps() {
+    FrameScheduler scheduler(fakeClock(), 100.0, 0.0);
+    scheduler.beginFrame();
+    ticks += 25000;
+    FrameScheduler::Frame first = scheduler.beginFrame();
+    ticks += 25000;
+    FrameScheduler::Frame second = scheduler.beginFrame();
+    CHECK(first.updates == 2 && std::fabs(first.alpha - 0.5) < 0.01);
+    CHECK(second.updates == 3 && second.alpha < 0.01);
+    CHECK(scheduler.updateDelta() == 0.01);
+}
+
+static void testHistogramCsv() {
+    FrameStats stats(4, 1.0 / 60.0);
+    for (double seconds : {0.0161, 0.0165, 0.0330, 0.5, 0.0162})
+        stats.record(seconds); // The first one falls out of the window
+    CHECK(stats.frames() == 4);
+    CHECK(stats.dropped() == 2);
+    CHECK(stats.percentile(0.5) == 0.0165);
+    CHECK(stats.max() == 0.5);
+
+    const std::string path = "build/test_frame_histogram.csv";
+    CHECK(stats.writeCsv(path, 40));
+    std::ifstream file(path);
+    std::string line;
+    int lines = 0;
+    std::getline(file, line);
+    CHECK(line == "frame_ms,frames");
+    while (std::getline(file, line)) {
+        if (lines == 16)
+            CHECK(line == "16,2");
+        if (lines == 33)
+            CHECK(line == "33,1");
+        if (lines == 39)
+            CHECK(line == "39,1"); // 500 ms lands in the last bucket
+        ++lines;
+    }
+    CHECK(lines == 40);
+    std::remove(path.c_str());
+}
+
+int main() {
+    testPacesFramesToTheTargetRate();
+    testSlowFramesRunSeveralUpdatesAndCountAsDropped();
+    testUnpacedFramesAccumulateFractionalSteps();
+    testHistogramCsv();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "All frame scheduler tests passed\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+// Closed-loop HTTP load generator over loopback. Starts the server in this
+// process on a free port (or targets --port of one already running), keeps
+// --connections keep-alive connections busy for --seconds, each sending the
+// next request as soon as the previous response arrives, and reports
+// requests/sec and latency percentiles:
+//   make bench [CONNECTIONS=64] [DURATION=5] [BACKEND=auto]
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "http.h"
+#include "server.h"
+
+using Clock = std::chrono::steady_clock;
+
+static const std::string REQUEST = "GET / HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n";
+
+static int connectTo(std::uint16_t port) {
+    const int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof address) < 0) {
+        std::cerr << "connect to 127.0.0.1:" << port << " failed: " << std::strerror(errno) << '\n';
+        std::exit(1);
+    }
+    const int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof one);
+    return fd;
+}
+
+// One connection: request, wait for the whole response, repeat. Appends
+// each round trip in nanoseconds to `latencies`; returns false on error.
+static bool runClient(std::uint16_t port, const std::atomic<bool>& done, std::vector<std::uint32_t>& latencies) {
+    const int fd = connectTo(port);
+    char buffer[4096];
+    bool ok = true;
+    while (ok && !done.load(std::memory_order_relaxed)) {
+        const Clock::time_point start = Clock::now();
+        ok = send(fd, REQUEST.data(), REQUEST.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(REQUEST.size());
+        std::size_t filled = 0;
+        while (ok && responseLength({buffer, filled}) == 0) {
+            const ssize_t received = recv(fd, buffer + filled, sizeof buffer - filled, 0);
+            ok = received > 0;
+            filled += ok ? received : 0;
+        }
+        if (ok)
+            latencies.push_back(static_cast<std::uint32_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()));
+    }
+    close(fd);
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    unsigned connections = 64;
+    double seconds = 5.0;
+    std::uint16_t port = 0;
+    ServerOptions options;
+    options.port = 0;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string flag = argv[i];
+        if (flag == "--connections")
+            connections = std::max(1, std::atoi(argv[i + 1]));
+        else if (flag == "--seconds")
+            seconds = std::atof(argv[i + 1]);
+        else if (flag == "--port")
+            port = static_cast<std::uint16_t>(std::atoi(argv[i + 1]));
+        else if (flag == "--threads")
+            options.threads = static_cast<unsigned>(std::atoi(argv[i + 1]));
+        else if (flag == "--backend")
+            options.backend = parseBackend(argv[i + 1]);
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--connections N] [--seconds S] [--port N | --threads N --backend NAME]\n";
+            return 1;
+        }
+    }
+
+    std::unique_ptr<Server> server;
+    if (port == 0) {
+        server = std::make_unique<Server>(options);
+        server->start();
+        port = server->port();
+        std::cout << "Server: " << server->threads() << " thread(s), " << server->backend() << ", port " << port << '\n';
+    }
+
+    std::atomic<bool> done(false);
+    std::atomic<unsigned> failed(0);
+    std::vector<std::vector<std::uint32_t>> latencies(connections);
+    std::vector<std::thread> clients;
+    const Clock::time_point start = Clock::now();
+    for (unsigned i = 0; i < connections; ++i) {
+        latencies[i].reserve(1 << 16);
+        clients.emplace_back([&, i] {
+            if (!runClient(port, done, latencies[i]))
+                ++failed;
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    done = true;
+    for (std::thread& client : clients)
+        client.join();
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    server.reset();
+
+    std::vector<std::uint32_t> all;
+    for (const auto& samples : latencies)
+        all.insert(all.end(), samples.begin(), samples.end());
+    std::sort(all.begin(), all.end());
+    if (all.empty()) {
+        std::cerr << "No request completed\n";
+        return 1;
+    }
+    const auto percentile = [&all](double p) {
+        const std::size_t rank = static_cast<std::size_t>(p * (all.size() - 1) + 0.5);
+        return all[rank] / 1000.0;
+    };
+
+    std::cout << std::fixed << std::setprecision(1)
+              << connections << " connection(s), " << elapsed << " s: " << all.size() << " requests, "
+              << all.size() / elapsed << " requests/sec\n"
+              << "latency us: p50 " << percentile(0.50) << "  p90 " << percentile(0.90) << "  p99 "
+              << percentile(0.99) << "  p99.9 " << percentile(0.999) << "  max " << all.back() / 1000.0 << '\n';
+    if (failed > 0) {
+        std::cerr << failed << " connection(s) failed\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Fixed-size I/O buffers recycled through a free list, so a busy server
+// stops allocating once it has seen its peak number of connections. One
+// pool per event loop; not thread-safe.
+class BufferPool {
+public:
+    // Returns itself to the pool when destroyed
+    class Buffer {
+    public:
+        Buffer(BufferPool& pool, std::unique_ptr<char[]> memory) : pool(&pool), memory(std::move(memory)) {}
+        Buffer(Buffer&& other) noexcept = default;
+        Buffer& operator=(Buffer&&) = delete;
+        ~Buffer() {
+            if (memory)
+                pool->release(std::move(memory));
+        }
+
+        char* data() { return memory.get(); }
+        std::size_t size() const { return pool->bufferSize; }
+
+    private:
+        BufferPool* pool;
+        std::unique_ptr<char[]> memory;
+    };
+
+    explicit BufferPool(std::size_t bufferSize = 16384) : bufferSize(bufferSize) {}
+
+    Buffer acquire();
+
+    std::size_t allocated() const { return allocatedCount; } // Ever allocated
+    std::size_t available() const { return freeList.size(); }
+
+private:
+    void release(std::unique_ptr<char[]> memory) { freeList.push_back(std::move(memory)); }
+
+    std::size_t bufferSize;
+    std::size_t allocatedCount = 0;
+    std::vector<std::unique_ptr<char[]>> freeList;
+};
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "buffer_pool.h"
+
+enum class Backend {
+    Auto,       // io_uring when the kernel allows it, otherwise epoll
+    IoUring,
+    Epoll,
+};
+
+// Parses "auto", "io_uring" or "epoll"; throws std::invalid_argument otherwise
+Backend parseBackend(const std::string& name);
+
+// One socket operation a coroutine is suspended on. Pending operations are
+// kept in an intrusive list so that the loop can destroy their coroutines
+// when it shuts down.
+struct Operation {
+    enum class Kind { Accept, Read, Write };
+
+    Kind kind;
+    int fd;
+    void* buffer;
+    std::size_t length;
+    int result = 0;                     // As from the syscall, or -errno
+    std::coroutine_handle<> waiter;
+    Operation* prev = nullptr;
+    Operation* next = nullptr;
+};
+
+// Single-threaded event loop that resumes coroutines when their socket
+// operation completes. Create one per thread with EventLoop::create(); every
+// coroutine using a loop must run on that loop's thread.
+//
+//     int client = co_await loop.accept(listener);
+//     ssize_t n = co_await loop.read(client, buffer, size);
+//
+// Results follow the syscalls, except that errors are returned as -errno.
+class EventLoop {
+public:
+    struct Awaitable {
+        Awaitable(EventLoop& loop, Operation::Kind kind, int fd, void* buffer, std::size_t length)
+            : loop(loop) {
+            operation.kind = kind;
+            operation.fd = fd;
+            operation.buffer = buffer;
+            operation.length = length;
+        }
+
+        EventLoop& loop;
+        Operation operation;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> waiter) {
+            operation.waiter = waiter;
+            return !loop.start(operation);  // Completed inline: do not suspend
+        }
+        int await_resume() const noexcept { return operation.result; }
+    };
+
+    // Throws std::runtime_error when the backend is unavailable
+    static std::unique_ptr<EventLoop> create(Backend backend = Backend::Auto);
+
+    virtual ~EventLoop();
+
+    virtual const char* name() const = 0;
+
+    // The fds must be non-blocking (accept() returns non-blocking sockets)
+    Awaitable accept(int listener) { return {*this, Operation::Kind::Accept, listener, nullptr, 0}; }
+    Awaitable read(int fd, void* buffer, std::size_t length) {
+        return {*this, Operation::Kind::Read, fd, buffer, length};
+    }
+    Awaitable write(int fd, const void* buffer, std::size_t length) {
+        return {*this, Operation::Kind::Write, fd, const_cast<void*>(buffer), length};
+    }
+
+    // Runs until stop() is called
+    void run();
+
+    // Safe to call from any thread
+    void stop();
+
+    BufferPool& buffers() { return bufferPool; }
+
+protected:
+    EventLoop();
+
+    // Begin an operation; returns true if it already completed (with
+    // operation.result set), false if complete() will be called later
+    virtual bool start(Operation& operation) = 0;
+
+    // Block until at least one operation completes or wake() is called,
+    // completing what is ready
+    virtual void poll() = 0;
+
+    // Record the result and resume the waiting coroutine
+    void complete(Operation& operation, int result);
+
+    // Track an operation that did not complete inline
+    void addPending(Operation& operation);
+
+    // Calls function(Operation&) for every pending operation, oldest first
+    template <typename Function>
+    void forEachPending(Function function) {
+        for (Operation* operation = pending.next; operation != &pending; operation = operation->next)
+            function(*operation);
+    }
+
+    // Destroy the coroutines still waiting; for the backend's destructor,
+    // after it has stopped all I/O on their buffers
+    void destroyPending();
+
+    // Eventfd that stop() writes to; the backend must wake poll() on it
+    int wakeFd;
+
+private:
+    std::atomic<bool> stopping{false};
+    Operation pending;              // Sentinel of a circular list
+    BufferPool bufferPool;
+};
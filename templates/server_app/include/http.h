@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+// Just enough HTTP/1.1 for a keep-alive service and its load generator:
+// requests are taken to end at the blank line after the headers (no
+// request bodies), and every request gets the same small response.
+
+// The response sent to every request
+extern const std::string_view HTTP_RESPONSE;
+
+// Number of complete requests at the start of `data`; `consumed` is set to
+// the bytes they span. Pipelined requests are counted individually.
+std::size_t countRequests(std::string_view data, std::size_t& consumed);
+
+// Length of the complete response at the start of `data` (headers plus
+// Content-Length bytes of body), or 0 if more bytes are needed
+std::size_t responseLength(std::string_view data);
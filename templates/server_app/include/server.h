@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "event_loop.h"
+
+struct ServerOptions {
+    std::string host = "127.0.0.1";
+    std::uint16_t port = 8080;      // 0 picks a free port; see Server::port()
+    unsigned threads = 0;           // Shards; 0 uses one per hardware thread
+    Backend backend = Backend::Auto;
+};
+
+// Keep-alive HTTP service sharded across threads. Each shard owns one
+// thread (pinned to a core), its own SO_REUSEPORT listener on the shared
+// port and its own EventLoop and buffers. The kernel spreads incoming
+// connections across the listeners, so shards never share state or locks.
+class Server {
+public:
+    explicit Server(ServerOptions options);
+    ~Server();
+
+    Server(const Server&) = delete;
+    Server& operator=(const Server&) = delete;
+
+    // Binds the listeners and starts the shard threads. Throws
+    // std::runtime_error when the address or the backend is unavailable.
+    void start();
+
+    // Stops the shards and closes every connection; safe to call twice
+    void stop();
+
+    std::uint16_t port() const { return boundPort; }
+    unsigned threads() const { return static_cast<unsigned>(shards.size()); }
+    const char* backend() const;
+
+private:
+    struct Shard {
+        std::unique_ptr<EventLoop> loop;
+        int listener = -1;
+        std::thread thread;
+    };
+
+    ServerOptions options;
+    std::uint16_t boundPort = 0;
+    std::vector<Shard> shards;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+
+// Fire-and-forget coroutine: it starts running as soon as it is called and
+// frees its own frame when it finishes. The accept loop and every
+// connection are one each; nothing waits for them. A Task that is still
+// suspended when its EventLoop is destroyed is destroyed by the loop.
+struct Task {
+    struct promise_type {
+        Task get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
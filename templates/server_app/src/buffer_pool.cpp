@@ -0,0 +1,11 @@
+#include "buffer_pool.h"
+
+BufferPool::Buffer BufferPool::acquire() {
+    if (freeList.empty()) {
+        ++allocatedCount;
+        return Buffer(*this, std::make_unique_for_overwrite<char[]>(bufferSize));
+    }
+    std::unique_ptr<char[]> memory = std::move(freeList.back());
+    freeList.pop_back();
+    return Buffer(*this, std::move(memory));
+}
@@ -0,0 +1,95 @@
+#include "event_loop.h"
+
+#include <cerrno>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+// Readiness-based backend: try the syscall straight away, and only if the
+// socket is not ready wait for epoll to report it and try again. Each
+// socket has at most one operation pending, armed with EPOLLONESHOT.
+class EpollLoop : public EventLoop {
+public:
+    EpollLoop() : epollFd(epoll_create1(EPOLL_CLOEXEC)) {
+        if (epollFd < 0)
+            throw std::runtime_error("epoll_create1 failed");
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.ptr = nullptr;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+    }
+
+    ~EpollLoop() override {
+        destroyPending();
+        close(epollFd);
+    }
+
+    const char* name() const override { return "epoll"; }
+
+protected:
+    bool start(Operation& operation) override {
+        const int result = perform(operation);
+        if (result != -EAGAIN && result != -EWOULDBLOCK) {
+            operation.result = result;
+            return true;
+        }
+        arm(operation);
+        addPending(operation);
+        return false;
+    }
+
+    void poll() override {
+        epoll_event events[128];
+        const int count = epoll_wait(epollFd, events, 128, -1);
+        for (int i = 0; i < count; ++i) {
+            auto* operation = static_cast<Operation*>(events[i].data.ptr);
+            if (!operation) {
+                std::uint64_t value;
+                [[maybe_unused]] ssize_t drained = ::read(wakeFd, &value, sizeof value);
+                continue;
+            }
+            const int result = perform(*operation);
+            if (result == -EAGAIN || result == -EWOULDBLOCK)
+                arm(*operation);    // Spurious wakeup
+            else
+                complete(*operation, result);
+        }
+    }
+
+private:
+    static int perform(Operation& operation) {
+        ssize_t result = 0;
+        switch (operation.kind) {
+        case Operation::Kind::Accept:
+            result = accept4(operation.fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            break;
+        case Operation::Kind::Read:
+            result = recv(operation.fd, operation.buffer, operation.length, 0);
+            break;
+        case Operation::Kind::Write:
+            result = send(operation.fd, operation.buffer, operation.length, MSG_NOSIGNAL);
+            break;
+        }
+        return result < 0 ? -errno : static_cast<int>(result);
+    }
+
+    void arm(Operation& operation) {
+        epoll_event event = {};
+        event.events = (operation.kind == Operation::Kind::Write ? EPOLLOUT : EPOLLIN) | EPOLLONESHOT;
+        event.data.ptr = &operation;
+        // A socket is registered on its first wait; closing it unregisters it
+        if (epoll_ctl(epollFd, EPOLL_CTL_MOD, operation.fd, &event) < 0 && errno == ENOENT)
+            epoll_ctl(epollFd, EPOLL_CTL_ADD, operation.fd, &event);
+    }
+
+    int epollFd;
+};
+
+} // namespace
+
+std::unique_ptr<EventLoop> createEpollLoop() {
+    return std::make_unique<EpollLoop>();
+}
@@ -0,0 +1,88 @@
+#include "event_loop.h"
+
+#include <stdexcept>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+// Defined by the backends (epoll_loop.cpp, uring_loop.cpp). createUringLoop
+// throws std::runtime_error when the kernel refuses io_uring.
+std::unique_ptr<EventLoop> createEpollLoop();
+std::unique_ptr<EventLoop> createUringLoop();
+
+Backend parseBackend(const std::string& name) {
+    if (name == "auto")
+        return Backend::Auto;
+    if (name == "io_uring")
+        return Backend::IoUring;
+    if (name == "epoll")
+        return Backend::Epoll;
+    throw std::invalid_argument("Unknown backend '" + name + "' (expected auto, io_uring or epoll)");
+}
+
+std::unique_ptr<EventLoop> EventLoop::create(Backend backend) {
+    switch (backend) {
+    case Backend::IoUring:
+        return createUringLoop();
+    case Backend::Epoll:
+        return createEpollLoop();
+    case Backend::Auto:
+        break;
+    }
+    // io_uring can be compiled out of the kernel, disabled by sysctl or
+    // blocked by seccomp in containers
+    try {
+        return createUringLoop();
+    } catch (const std::runtime_error&) {
+        return createEpollLoop();
+    }
+}
+
+EventLoop::EventLoop() : wakeFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+    if (wakeFd < 0)
+        throw std::runtime_error("eventfd failed");
+    pending.prev = pending.next = &pending;
+}
+
+EventLoop::~EventLoop() {
+    close(wakeFd);
+}
+
+void EventLoop::run() {
+    while (!stopping.load(std::memory_order_acquire))
+        poll();
+}
+
+void EventLoop::stop() {
+    stopping.store(true, std::memory_order_release);
+    const std::uint64_t one = 1;
+    [[maybe_unused]] ssize_t written = ::write(wakeFd, &one, sizeof one);
+}
+
+void EventLoop::addPending(Operation& operation) {
+    operation.prev = pending.prev;
+    operation.next = &pending;
+    pending.prev->next = &operation;
+    pending.prev = &operation;
+}
+
+void EventLoop::complete(Operation& operation, int result) {
+    if (operation.prev) {
+        operation.prev->next = operation.next;
+        operation.next->prev = operation.prev;
+        operation.prev = operation.next = nullptr;
+    }
+    operation.result = result;
+    operation.waiter.resume();
+}
+
+void EventLoop::destroyPending() {
+    // Destroying a coroutine frame destroys the Operation inside it, so
+    // unlink each one first
+    while (pending.next != &pending) {
+        Operation& operation = *pending.next;
+        pending.next = operation.next;
+        operation.next->prev = &pending;
+        operation.prev = operation.next = nullptr;
+        operation.waiter.destroy();
+    }
+}
@@ -0,0 +1,33 @@
+#include "http.h"
+
+#include <cstdlib>
+
+const std::string_view HTTP_RESPONSE =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/plain\r\n"
+    "Content-Length: 13\r\n"
+    "\r\n"
+    "Hello, world\n";
+
+std::size_t countRequests(std::string_view data, std::size_t& consumed) {
+    std::size_t count = 0;
+    consumed = 0;
+    for (std::size_t end; (end = data.find("\r\n\r\n", consumed)) != std::string_view::npos;) {
+        consumed = end + 4;
+        ++count;
+    }
+    return count;
+}
+
+std::size_t responseLength(std::string_view data) {
+    const std::size_t headerEnd = data.find("\r\n\r\n");
+    if (headerEnd == std::string_view::npos)
+        return 0;
+    std::size_t body = 0;
+    const std::string_view headers = data.substr(0, headerEnd);
+    const std::size_t field = headers.find("Content-Length:");
+    if (field != std::string_view::npos)
+        body = std::strtoul(headers.data() + field + 15, nullptr, 10);
+    const std::size_t total = headerEnd + 4 + body;
+    return data.size() >= total ? total : 0;
+}
@@ -0,0 +1,58 @@
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+#include "server.h"
+
+static void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [--host ADDR] [--port N] [--threads N] [--backend NAME]\n"
+              << "  --host ADDR     IPv4 address to listen on (default 127.0.0.1)\n"
+              << "  --port N        Port (default 8080; 0 picks a free one)\n"
+              << "  --threads N     Shards, one event loop per thread (default: one per core)\n"
+              << "  --backend NAME  auto, io_uring or epoll (default auto)\n";
+}
+
+int main(int argc, char* argv[]) {
+    ServerOptions options;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const bool hasValue = i + 1 < argc;
+            if (std::strcmp(argv[i], "--host") == 0 && hasValue) {
+                options.host = argv[++i];
+            } else if (std::strcmp(argv[i], "--port") == 0 && hasValue) {
+                options.port = static_cast<std::uint16_t>(std::atoi(argv[++i]));
+            } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+                options.threads = static_cast<unsigned>(std::atoi(argv[++i]));
+            } else if (std::strcmp(argv[i], "--backend") == 0 && hasValue) {
+                options.backend = parseBackend(argv[++i]);
+            } else {
+                printUsage(argv[0]);
+                return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+            }
+        }
+
+        // Block SIGINT and SIGTERM in every thread so that only the
+        // sigwait() below sees them
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGINT);
+        sigaddset(&signals, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+        Server server(options);
+        server.start();
+        std::cout << "{{project_name}} listening on http://" << options.host << ':' << server.port() << " ("
+                  << server.threads() << " thread(s), " << server.backend() << ")" << std::endl;
+
+        int signal = 0;
+        sigwait(&signals, &signal);
+        std::cout << "Shutting down" << std::endl;
+        server.stop();
+    } catch (const std::exception& error) {
+        std::cerr << "Error: " << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,175 @@
+#include "server.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "http.h"
+#include "task.h"
+
+namespace {
+
+// Closes the fd when the connection's coroutine finishes or is destroyed
+class Socket {
+public:
+    explicit Socket(int fd) : fd(fd) {}
+    ~Socket() { close(fd); }
+    Socket(const Socket&) = delete;
+    Socket& operator=(const Socket&) = delete;
+
+private:
+    int fd;
+};
+
+Task serveConnection(EventLoop& loop, int fd) {
+    Socket socket(fd);
+    BufferPool::Buffer input = loop.buffers().acquire();
+    BufferPool::Buffer output = loop.buffers().acquire();
+    std::size_t filled = 0;
+
+    for (;;) {
+        const int received = co_await loop.read(fd, input.data() + filled, input.size() - filled);
+        if (received <= 0)
+            co_return;      // Closed by the client, or an error
+        filled += received;
+
+        std::size_t consumed = 0;
+        std::size_t requests = countRequests({input.data(), filled}, consumed);
+        if (requests == 0 && filled == input.size())
+            co_return;      // Headers larger than a buffer
+
+        // Answer every complete request, pipelined ones in as few writes
+        // as the output buffer allows
+        while (requests > 0) {
+            std::size_t length = 0;
+            for (; requests > 0 && length + HTTP_RESPONSE.size() <= output.size(); --requests) {
+                std::memcpy(output.data() + length, HTTP_RESPONSE.data(), HTTP_RESPONSE.size());
+                length += HTTP_RESPONSE.size();
+            }
+            for (std::size_t sent = 0; sent < length;) {
+                const int written = co_await loop.write(fd, output.data() + sent, length - sent);
+                if (written <= 0)
+                    co_return;
+                sent += written;
+            }
+        }
+
+        // Keep a partial request for the next read
+        std::memmove(input.data(), input.data() + consumed, filled - consumed);
+        filled -= consumed;
+    }
+}
+
+Task acceptConnections(EventLoop& loop, int listener) {
+    for (;;) {
+        const int fd = co_await loop.accept(listener);
+        if (fd == -ECONNABORTED || fd == -EINTR)
+            continue;
+        if (fd < 0) {
+            // Out of fds or memory: retrying at once would only spin
+            std::cerr << "accept failed: " << std::strerror(-fd) << ", no longer accepting\n";
+            co_return;
+        }
+        const int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof one);
+        serveConnection(loop, fd);
+    }
+}
+
+int openListener(const std::string& host, std::uint16_t port) {
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    if (inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1)
+        throw std::runtime_error("Invalid IPv4 address '" + host + "'");
+
+    const int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+        throw std::runtime_error(std::string("socket failed: ") + std::strerror(errno));
+    const int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof one);
+    setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof one);
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof address) < 0 || listen(fd, SOMAXCONN) < 0) {
+        const int error = errno;
+        close(fd);
+        throw std::runtime_error("Cannot listen on " + host + ":" + std::to_string(port) + ": " +
+                                 std::strerror(error));
+    }
+    return fd;
+}
+
+std::uint16_t localPort(int fd) {
+    sockaddr_in address = {};
+    socklen_t length = sizeof address;
+    getsockname(fd, reinterpret_cast<sockaddr*>(&address), &length);
+    return ntohs(address.sin_port);
+}
+
+// Best effort: a shard that stays on one core keeps its caches warm
+void pinToCore(std::thread& thread, unsigned core) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(core % std::max(1u, std::thread::hardware_concurrency()), &cpus);
+    pthread_setaffinity_np(thread.native_handle(), sizeof cpus, &cpus);
+}
+
+} // namespace
+
+Server::Server(ServerOptions options) : options(std::move(options)) {}
+
+Server::~Server() {
+    stop();
+}
+
+void Server::start() {
+    const unsigned count = options.threads > 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    try {
+        boundPort = options.port;
+        shards.resize(count);
+        for (Shard& shard : shards) {
+            shard.listener = openListener(options.host, boundPort);
+            boundPort = localPort(shard.listener);  // Port 0: the others join the first
+            shard.loop = EventLoop::create(options.backend);
+        }
+    } catch (...) {
+        stop();
+        throw;
+    }
+
+    for (unsigned i = 0; i < count; ++i) {
+        Shard& shard = shards[i];
+        shard.thread = std::thread([&shard] {
+            acceptConnections(*shard.loop, shard.listener);
+            shard.loop->run();
+        });
+        pinToCore(shard.thread, i);
+    }
+}
+
+void Server::stop() {
+    for (Shard& shard : shards) {
+        if (shard.loop)
+            shard.loop->stop();
+    }
+    for (Shard& shard : shards) {
+        if (shard.thread.joinable())
+            shard.thread.join();
+        shard.loop.reset();     // Destroys the suspended coroutines, closing their sockets
+        if (shard.listener >= 0)
+            close(shard.listener);
+    }
+    shards.clear();
+}
+
+const char* Server::backend() const {
+    return shards.empty() ? "none" : shards.front().loop->name();
+}
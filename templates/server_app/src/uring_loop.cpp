@@ -0,0 +1,250 @@
+#include "event_loop.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+// Ring entries; every connection has at most one operation in flight, and
+// the completion ring is twice this size
+const unsigned RING_ENTRIES = 4096;
+
+// user_data of the read on the wake eventfd; operations use their address
+const std::uint64_t WAKE_TAG = 0;
+// Set in user_data for the poll that precedes retrying an operation
+const std::uint64_t POLL_TAG = 1;
+// user_data of cancel requests; never an operation's (they are aligned)
+const std::uint64_t CANCEL_TAG = 2;
+
+int ioUringSetup(unsigned entries, io_uring_params* params) {
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int ioUringEnter(int fd, unsigned submit, unsigned waitFor, unsigned flags) {
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, submit, waitFor, flags, nullptr, 0));
+}
+
+// Completion-based backend on the raw io_uring syscalls (no liburing).
+// Operations are queued as submission entries and handed to the kernel in
+// one io_uring_enter per loop iteration, which also waits for completions.
+class UringLoop : public EventLoop {
+public:
+    UringLoop() {
+        io_uring_params params = {};
+        ringFd = ioUringSetup(RING_ENTRIES, &params);
+        if (ringFd < 0)
+            throw std::runtime_error(std::string("io_uring_setup failed: ") + std::strerror(errno));
+
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (singleMap)
+            sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+        sqRing = map(sqRingSize, IORING_OFF_SQ_RING);
+        cqRing = singleMap ? sqRing : map(cqRingSize, IORING_OFF_CQ_RING);
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe*>(map(sqesSize, IORING_OFF_SQES));
+
+        auto* sq = static_cast<char*>(sqRing);
+        sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sqEntries = params.sq_entries;
+        // Slot i of the array always names entry i; entries are used in order
+        auto* array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        for (unsigned i = 0; i < sqEntries; ++i)
+            array[i] = i;
+        localTail = *sqTail;
+
+        auto* cq = static_cast<char*>(cqRing);
+        cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        armWake();
+    }
+
+    ~UringLoop() override {
+        // The kernel may still write into the coroutines' buffers and into
+        // wakeValue until their operations complete (closing the ring fd
+        // alone does not stop them while the rings are mapped), so cancel
+        // and reap everything before freeing any of it
+        drain();
+        destroyPending();
+        munmap(sqes, sqesSize);
+        if (cqRing != sqRing)
+            munmap(cqRing, cqRingSize);
+        munmap(sqRing, sqRingSize);
+        close(ringFd);
+    }
+
+    const char* name() const override { return "io_uring"; }
+
+protected:
+    bool start(Operation& operation) override {
+        prepare(operation);
+        addPending(operation);
+        return false;
+    }
+
+    void poll() override {
+        const unsigned toSubmit = localTail - *sqTail;
+        __atomic_store_n(sqTail, localTail, __ATOMIC_RELEASE);
+        if (ioUringEnter(ringFd, toSubmit, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+            throw std::runtime_error(std::string("io_uring_enter failed: ") + std::strerror(errno));
+
+        unsigned head = *cqHead;
+        const unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+            const io_uring_cqe cqe = cqes[head & cqMask];
+            // Hand the slot back before resuming, which may queue more work
+            __atomic_store_n(cqHead, head + 1, __ATOMIC_RELEASE);
+            if (cqe.user_data == WAKE_TAG) {
+                armWake();
+                continue;
+            }
+            auto* operation = reinterpret_cast<Operation*>(cqe.user_data & ~POLL_TAG);
+            if (cqe.user_data & POLL_TAG)
+                prepare(*operation);            // Ready now: retry
+            else if (cqe.res == -EAGAIN)
+                preparePoll(*operation);        // Some kernels do not wait on O_NONBLOCK sockets
+            else
+                complete(*operation, cqe.res);
+        }
+    }
+
+private:
+    void* map(std::size_t size, off_t offset) {
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, offset);
+        if (memory == MAP_FAILED) {
+            close(ringFd);
+            throw std::runtime_error("io_uring mmap failed");
+        }
+        return memory;
+    }
+
+    // Next free submission entry, cleared
+    io_uring_sqe& nextEntry() {
+        if (localTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) == sqEntries) {
+            // Full: let the kernel consume what is queued
+            const unsigned toSubmit = localTail - *sqTail;
+            __atomic_store_n(sqTail, localTail, __ATOMIC_RELEASE);
+            ioUringEnter(ringFd, toSubmit, 0, 0);
+        }
+        io_uring_sqe& entry = sqes[localTail++ & sqMask];
+        std::memset(&entry, 0, sizeof entry);
+        return entry;
+    }
+
+    void prepare(Operation& operation) {
+        io_uring_sqe& entry = nextEntry();
+        entry.fd = operation.fd;
+        entry.user_data = reinterpret_cast<std::uint64_t>(&operation);
+        switch (operation.kind) {
+        case Operation::Kind::Accept:
+            entry.opcode = IORING_OP_ACCEPT;
+            entry.accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+            break;
+        case Operation::Kind::Read:
+            entry.opcode = IORING_OP_RECV;
+            entry.addr = reinterpret_cast<std::uint64_t>(operation.buffer);
+            entry.len = static_cast<unsigned>(operation.length);
+            break;
+        case Operation::Kind::Write:
+            entry.opcode = IORING_OP_SEND;
+            entry.addr = reinterpret_cast<std::uint64_t>(operation.buffer);
+            entry.len = static_cast<unsigned>(operation.length);
+            entry.msg_flags = MSG_NOSIGNAL;
+            break;
+        }
+    }
+
+    void preparePoll(Operation& operation) {
+        io_uring_sqe& entry = nextEntry();
+        entry.opcode = IORING_OP_POLL_ADD;
+        entry.fd = operation.fd;
+        entry.poll32_events = operation.kind == Operation::Kind::Write ? POLLOUT : POLLIN;
+        entry.user_data = reinterpret_cast<std::uint64_t>(&operation) | POLL_TAG;
+    }
+
+    void cancel(std::uint64_t userData) {
+        io_uring_sqe& entry = nextEntry();
+        entry.opcode = IORING_OP_ASYNC_CANCEL;
+        entry.fd = -1;
+        entry.addr = userData;
+        entry.user_data = CANCEL_TAG;
+    }
+
+    // Cancels every operation in flight and waits until each has posted
+    // its completion; the coroutines stay suspended for destroyPending()
+    void drain() {
+        // Each pending operation has either itself or its poll in flight,
+        // and the read on the wake eventfd is always armed
+        unsigned inFlight = 1;
+        forEachPending([this, &inFlight](Operation& operation) {
+            const auto address = reinterpret_cast<std::uint64_t>(&operation);
+            cancel(address);
+            cancel(address | POLL_TAG);
+            ++inFlight;
+        });
+        cancel(WAKE_TAG);
+
+        while (inFlight > 0) {
+            const unsigned toSubmit = localTail - *sqTail;
+            __atomic_store_n(sqTail, localTail, __ATOMIC_RELEASE);
+            if (ioUringEnter(ringFd, toSubmit, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+                return;
+
+            unsigned head = *cqHead;
+            const unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+            for (; head != tail; ++head) {
+                if (cqes[head & cqMask].user_data != CANCEL_TAG)
+                    --inFlight;
+            }
+            __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+        }
+    }
+
+    void armWake() {
+        io_uring_sqe& entry = nextEntry();
+        entry.opcode = IORING_OP_READ;
+        entry.fd = wakeFd;
+        entry.addr = reinterpret_cast<std::uint64_t>(&wakeValue);
+        entry.len = sizeof wakeValue;
+        entry.user_data = WAKE_TAG;
+    }
+
+    int ringFd = -1;
+    void* sqRing = nullptr;
+    void* cqRing = nullptr;
+    std::size_t sqRingSize = 0;
+    std::size_t cqRingSize = 0;
+    std::size_t sqesSize = 0;
+    io_uring_sqe* sqes = nullptr;
+    io_uring_cqe* cqes = nullptr;
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned sqMask = 0;
+    unsigned cqMask = 0;
+    unsigned sqEntries = 0;
+    unsigned localTail = 0;         // Entries prepared, not all published yet
+    std::uint64_t wakeValue = 0;
+};
+
+} // namespace
+
+std::unique_ptr<EventLoop> createUringLoop() {
+    return std::make_unique<UringLoop>();
+}
@@ -0,0 +1,147 @@
+// Tests for the HTTP framing, the buffer pool and the server over loopback
+// with each event loop backend
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <netinet/in.h>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+#include "buffer_pool.h"
+#include "http.h"
+#include "server.h"
+
+static int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::cerr << __FILE__ << ':' << __LINE__ << ": " #condition "\n";   \
+            ++failures;                                                         \
+        }                                                                       \
+    } while (0)
+
+static const std::string REQUEST = "GET / HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n";
+
+static void testCountRequestsHandlesPipelinedAndPartial() {
+    std::size_t consumed = 0;
+    CHECK(countRequests("", consumed) == 0 && consumed == 0);
+    CHECK(countRequests(REQUEST + REQUEST + "GET / HT", consumed) == 2);
+    CHECK(consumed == 2 * REQUEST.size());
+    CHECK(countRequests(REQUEST.substr(0, REQUEST.size() - 1), consumed) == 0 && consumed == 0);
+}
+
+static void testResponseLengthWaitsForTheBody() {
+    const std::string response(HTTP_RESPONSE);
+    CHECK(responseLength(response) == response.size());
+    CHECK(responseLength(response + response) == response.size());
+    CHECK(responseLength(response.substr(0, response.size() - 1)) == 0);
+    CHECK(responseLength(response.substr(0, 10)) == 0);
+}
+
+static void testBufferPoolRecyclesBuffers() {
+    BufferPool pool(64);
+    char* first = nullptr;
+    {
+        BufferPool::Buffer a = pool.acquire();
+        BufferPool::Buffer b = pool.acquire();
+        first = a.data();
+        CHECK(a.size() == 64);
+        CHECK(pool.allocated() == 2 && pool.available() == 0);
+    }
+    CHECK(pool.available() == 2);
+    BufferPool::Buffer again = pool.acquire();
+    CHECK(pool.allocated() == 2 && pool.available() == 1);
+    CHECK(again.data() == first); // Most recently released first
+}
+
+static int connectTo(std::uint16_t port) {
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof address) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Reads until `count` complete responses have arrived; returns how many did
+static int readResponses(int fd, int count) {
+    std::string received;
+    int responses = 0;
+    char chunk[4096];
+    while (responses < count) {
+        const ssize_t n = recv(fd, chunk, sizeof chunk, 0);
+        if (n <= 0)
+            break;
+        received.append(chunk, static_cast<std::size_t>(n));
+        for (std::size_t length; (length = responseLength(received)) != 0; ++responses)
+            received.erase(0, length);
+    }
+    return responses;
+}
+
+static void testServerAnswersOverLoopback(Backend backend, const char* name) {
+    ServerOptions options;
+    options.port = 0;
+    options.threads = 2;
+    options.backend = backend;
+    Server server(options);
+    try {
+        server.start();
+    } catch (const std::runtime_error& error) {
+        std::cout << "Skipping " << name << ": " << error.what() << '\n';
+        return;
+    }
+    CHECK(server.port() != 0);
+    CHECK(std::strcmp(server.backend(), name) == 0);
+
+    // Pipelined requests on one connection
+    const int first = connectTo(server.port());
+    CHECK(first >= 0);
+    const std::string pipelined = REQUEST + REQUEST + REQUEST;
+    CHECK(send(first, pipelined.data(), pipelined.size(), 0) == static_cast<ssize_t>(pipelined.size()));
+    CHECK(readResponses(first, 3) == 3);
+
+    // A request split across writes makes the server wait for readiness
+    const int second = connectTo(server.port());
+    CHECK(second >= 0);
+    CHECK(send(second, REQUEST.data(), 10, 0) == 10);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    CHECK(send(second, REQUEST.data() + 10, REQUEST.size() - 10, 0) == static_cast<ssize_t>(REQUEST.size() - 10));
+    CHECK(readResponses(second, 1) == 1);
+
+    // The first connection is still served after the second came and went
+    close(second);
+    CHECK(send(first, REQUEST.data(), REQUEST.size(), 0) == static_cast<ssize_t>(REQUEST.size()));
+    CHECK(readResponses(first, 1) == 1);
+
+    // Stopping closes open connections and is idempotent
+    server.stop();
+    char byte;
+    CHECK(recv(first, &byte, 1, 0) <= 0);
+    close(first);
+    server.stop();
+}
+
+int main() {
+    testCountRequestsHandlesPipelinedAndPartial();
+    testResponseLengthWaitsForTheBody();
+    testBufferPoolRecyclesBuffers();
+    testServerAnswersOverLoopback(Backend::Epoll, "epoll");
+    testServerAnswersOverLoopback(Backend::IoUring, "io_uring");
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "All server tests passed\n";
+    return EXIT_SUCCESS;
+}
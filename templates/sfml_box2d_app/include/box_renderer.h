@@ -0,0 +1,30 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <vector>
+
+#include "physics_scene.h"
+
+// Draws every body of a scene with one draw call. Each box owns six
+// vertices (two triangles) at a fixed offset; update() rewrites their
+// positions in place from the Box2D transforms, so nothing is allocated
+// per frame. The vertices go through a streamed sf::VertexBuffer when the
+// driver supports it, otherwise through the sf::VertexArray directly.
+class BoxRenderer {
+public:
+    explicit BoxRenderer(const std::vector<BoxBody>& bodies);
+
+    // Sleeping and static bodies keep their last vertices
+    void update(const std::vector<BoxBody>& bodies);
+
+    // Returns the number of draw calls issued
+    unsigned draw(sf::RenderTarget& target);
+
+private:
+    void writeBox(std::size_t index, const BoxBody& box);
+
+    sf::VertexArray vertices;
+    sf::VertexBuffer buffer;
+    bool useBuffer;
+};
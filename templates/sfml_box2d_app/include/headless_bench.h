@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Steps independent PhysicsScene worlds without a window, for measuring
+// physics cost on machines without a display and for batch simulations.
+struct HeadlessOptions {
+    int worlds = 1;      // Independent b2World instances
+    int ticks = 600;     // Fixed 1/60 s steps per world
+    int bodies = 1000;   // Boxes per world
+    int threads = 0;     // Worker threads; 0 uses one per hardware thread
+};
+
+struct HeadlessReport {
+    std::vector<std::uint64_t> hashes; // Final state hash per world
+    std::vector<double> stepSeconds;    // Every step of every world, sorted
+    double wallSeconds = 0.0;
+    std::size_t dynamicBodies = 0;      // Per world
+    int threads = 0;
+
+    double percentile(double p) const;  // Of stepSeconds, p in [0, 1]
+    double bodyStepsPerSecond() const;  // dynamicBodies x ticks x worlds / wall time
+    bool deterministic() const;         // Every world ended in the same state
+};
+
+// One task per world, taken from a shared queue by `threads` workers. Every
+// world is built from the same scene, so their final hashes must agree;
+// comparing the hash across runs and machines checks reproducibility.
+HeadlessReport runHeadless(const HeadlessOptions& options);
+
+void printHeadlessReport(const HeadlessOptions& options, const HeadlessReport& report);
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <box2d/box2d.h>
+
+#include <cstdint>
+#include <vector>
+
+// Pixels per Box2D meter
+constexpr float SCALE = 30.0f;
+
+// One box-shaped body. The scene keeps them in a contiguous array so the
+// renderer can walk them in order and give each box a fixed slot in its
+// vertex array.
+struct BoxBody {
+    b2Body* body;
+    b2Vec2 halfExtents; // Meters
+    sf::Color color;
+};
+
+class PhysicsScene {
+public:
+    // A container of ground and two walls. With boxCount == 0 a single box
+    // drops onto the ground; otherwise boxCount smaller boxes are stacked
+    // in columns above it.
+    PhysicsScene(float widthPixels, float heightPixels, int boxCount);
+
+    // Advance the world by one fixed 1/60 s step
+    void step();
+
+    // FNV-1a hash of every body's position, angle and velocities, in array
+    // order. Identical scenes stepped identically hash the same.
+    std::uint64_t stateHash() const;
+
+    // Bodies that move (everything but the container)
+    std::size_t dynamicCount() const;
+
+    const std::vector<BoxBody>& bodies() const { return boxes; }
+
+private:
+    void addBox(b2BodyType type, b2Vec2 position, b2Vec2 halfExtents, sf::Color color);
+
+    b2World world;
+    std::vector<BoxBody> boxes;
+};
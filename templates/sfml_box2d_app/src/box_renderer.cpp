@@ -0,0 +1,70 @@
+#include "box_renderer.h"
+
+namespace {
+
+// Two triangles per box: corners 0-1-2 and 0-2-3
+const int VERTICES_PER_BOX = 6;
+const int CORNER_OF_VERTEX[VERTICES_PER_BOX] = {0, 1, 2, 0, 2, 3};
+
+} // namespace
+
+BoxRenderer::BoxRenderer(const std::vector<BoxBody>& bodies)
+    : vertices(sf::Triangles, bodies.size() * VERTICES_PER_BOX),
+      buffer(sf::Triangles, sf::VertexBuffer::Stream),
+      useBuffer(sf::VertexBuffer::isAvailable())
+{
+    // Colors never change; positions are written for every body once here
+    // and afterwards only for bodies that moved
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+        for (int v = 0; v < VERTICES_PER_BOX; ++v)
+            vertices[i * VERTICES_PER_BOX + v].color = bodies[i].color;
+        writeBox(i, bodies[i]);
+    }
+    if (useBuffer)
+        useBuffer = buffer.create(vertices.getVertexCount()) && buffer.update(&vertices[0]);
+}
+
+void BoxRenderer::update(const std::vector<BoxBody>& bodies)
+{
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+        if (bodies[i].body->IsAwake())
+            writeBox(i, bodies[i]);
+    }
+    if (useBuffer && vertices.getVertexCount() > 0)
+        buffer.update(&vertices[0]);
+}
+
+unsigned BoxRenderer::draw(sf::RenderTarget& target)
+{
+    if (vertices.getVertexCount() == 0)
+        return 0;
+    if (useBuffer)
+        target.draw(buffer);
+    else
+        target.draw(vertices);
+    return 1;
+}
+
+void BoxRenderer::writeBox(std::size_t index, const BoxBody& box)
+{
+    // Box2D gives the center and rotation in meters; rotate the corners
+    // here rather than through an sf::Transform per body
+    const b2Transform& transform = box.body->GetTransform();
+    const float cx = transform.p.x * SCALE;
+    const float cy = transform.p.y * SCALE;
+    const float c = transform.q.c;
+    const float s = transform.q.s;
+    const float hx = box.halfExtents.x * SCALE;
+    const float hy = box.halfExtents.y * SCALE;
+
+    const sf::Vector2f corners[4] = {
+        sf::Vector2f(cx + c * -hx - s * -hy, cy + s * -hx + c * -hy),
+        sf::Vector2f(cx + c * hx - s * -hy, cy + s * hx + c * -hy),
+        sf::Vector2f(cx + c * hx - s * hy, cy + s * hx + c * hy),
+        sf::Vector2f(cx + c * -hx - s * hy, cy + s * -hx + c * hy),
+    };
+
+    sf::Vertex* quad = &vertices[index * VERTICES_PER_BOX];
+    for (int v = 0; v < VERTICES_PER_BOX; ++v)
+        quad[v].position = corners[CORNER_OF_VERTEX[v]];
+}
@@ -0,0 +1,102 @@
+#include "headless_bench.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#include "physics_scene.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+} // namespace
+
+double HeadlessReport::percentile(double p) const
+{
+    if (stepSeconds.empty())
+        return 0.0;
+    const std::size_t index = static_cast<std::size_t>(std::ceil(p * stepSeconds.size()));
+    return stepSeconds[std::min(stepSeconds.size(), std::max<std::size_t>(index, 1)) - 1];
+}
+
+double HeadlessReport::bodyStepsPerSecond() const
+{
+    return wallSeconds > 0.0 ? dynamicBodies * static_cast<double>(stepSeconds.size()) / wallSeconds : 0.0;
+}
+
+bool HeadlessReport::deterministic() const
+{
+    return std::adjacent_find(hashes.begin(), hashes.end(), std::not_equal_to<>()) == hashes.end();
+}
+
+HeadlessReport runHeadless(const HeadlessOptions& options)
+{
+    HeadlessReport report;
+    report.threads = options.threads > 0 ? options.threads
+                                         : std::max(1u, std::thread::hardware_concurrency());
+    report.threads = std::min(report.threads, std::max(options.worlds, 1));
+    report.hashes.resize(options.worlds);
+
+    std::atomic<int> nextWorld(0);
+    std::mutex resultsMutex;
+    auto worker = [&]() {
+        std::vector<double> steps;
+        steps.reserve(options.ticks);
+        for (int world = nextWorld++; world < options.worlds; world = nextWorld++) {
+            PhysicsScene scene(800.0f, 600.0f, options.bodies);
+            steps.clear();
+            for (int tick = 0; tick < options.ticks; ++tick) {
+                const Clock::time_point start = Clock::now();
+                scene.step();
+                steps.push_back(secondsSince(start));
+            }
+
+            std::lock_guard<std::mutex> lock(resultsMutex);
+            report.hashes[world] = scene.stateHash();
+            report.dynamicBodies = scene.dynamicCount();
+            report.stepSeconds.insert(report.stepSeconds.end(), steps.begin(), steps.end());
+        }
+    };
+
+    const Clock::time_point start = Clock::now();
+    std::vector<std::thread> workers;
+    for (int i = 1; i < report.threads; ++i)
+        workers.emplace_back(worker);
+    worker(); // The calling thread is a worker too
+    for (std::thread& thread : workers)
+        thread.join();
+    report.wallSeconds = secondsSince(start);
+
+    std::sort(report.stepSeconds.begin(), report.stepSeconds.end());
+    return report;
+}
+
+void printHeadlessReport(const HeadlessOptions& options, const HeadlessReport& report)
+{
+    const auto ms = [](double seconds) { return seconds * 1000.0; };
+    std::cout << std::fixed << std::setprecision(3)
+              << options.worlds << " world(s) x " << report.dynamicBodies << " bodies x "
+              << options.ticks << " ticks on " << report.threads << " thread(s)\n"
+              << "  wall        " << report.wallSeconds << " s\n"
+              << "  step p50    " << ms(report.percentile(0.50)) << " ms\n"
+              << "  step p90    " << ms(report.percentile(0.90)) << " ms\n"
+              << "  step p99    " << ms(report.percentile(0.99)) << " ms\n"
+              << "  step max    " << ms(report.percentile(1.00)) << " ms\n"
+              << std::setprecision(0)
+              << "  throughput  " << report.bodyStepsPerSecond() << " body-steps/s\n"
+              << "  state hash  " << std::hex << std::setw(16) << std::setfill('0')
+              << (report.hashes.empty() ? 0 : report.hashes.front()) << std::dec << std::setfill(' ')
+              << (report.deterministic() ? "" : "  (worlds DIVERGED)") << '\n';
+}
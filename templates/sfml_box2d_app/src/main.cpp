@@ -1,57 +1,100 @@
 #include <SFML/Graphics.hpp> // For SFML graphics
-#include <box2d/box2d.h>     // For Box2D physics
 
-// Define a scale ratio to convert Box2D units (meters) to SFML pixels
-const float SCALE = 30.0f; // 30 pixels per meter
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
 
-int main()
+#include "box_renderer.h"
+#include "headless_bench.h"
+#include "physics_scene.h"
+
+namespace {
+
+void printUsage(const char* program)
+{
+    std::cout << "Usage: " << program << " [--bodies N]\n"
+              << "       " << program << " --headless [--bodies N] [--worlds W] [--ticks T] [--threads J]\n"
+              << "                [--expect-hash HEX]\n"
+              << "  --bodies N       Stress mode: drop N boxes and print frame time,\n"
+              << "                   physics step time and draw calls every second\n"
+              << "  --headless       No window: step W worlds of N boxes (default 1000)\n"
+              << "                   for T ticks (default 600) on J threads, then print\n"
+              << "                   step latency percentiles, throughput and a hash\n"
+              << "                   of the final state\n"
+              << "  --expect-hash H  Exit with 1 unless the final state hashes to H\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
 {
+    int bodyCount = 0;
+    bool headless = false;
+    HeadlessOptions headlessOptions;
+    const char* expectedHash = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--bodies") == 0 && hasValue) {
+            bodyCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (std::strcmp(argv[i], "--worlds") == 0 && hasValue) {
+            headlessOptions.worlds = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--ticks") == 0 && hasValue) {
+            headlessOptions.ticks = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            headlessOptions.threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--expect-hash") == 0 && hasValue) {
+            expectedHash = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    // --- Headless benchmark: no window, no rendering ---
+    if (headless) {
+        if (bodyCount > 0)
+            headlessOptions.bodies = bodyCount;
+        if (headlessOptions.worlds < 1 || headlessOptions.ticks < 1) {
+            std::cerr << "--worlds and --ticks must be at least 1\n";
+            return 1;
+        }
+        const HeadlessReport report = runHeadless(headlessOptions);
+        printHeadlessReport(headlessOptions, report);
+        if (!report.deterministic())
+            return 1;
+        if (expectedHash && std::strtoull(expectedHash, nullptr, 16) != report.hashes.front()) {
+            std::cerr << "State hash differs from the expected " << expectedHash << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    const bool stress = bodyCount > 0;
+
     // --- SFML Setup ---
     sf::RenderWindow window(sf::VideoMode(800, 600), "SFML + Box2D Demo");
-    window.setFramerateLimit(60); // Limit FPS to 60 for smoother simulation
-    
+    // Limit FPS to 60 for smoother simulation; stress mode runs unthrottled
+    // so that the frame time it reports is the real cost of a frame
+    window.setFramerateLimit(stress ? 0 : 60);
+
     // --- Box2D Setup ---
-    // Define gravity (positive Y vector points downwards)
-    b2Vec2 gravity(0.0f, 9.8f);
-    // Create the Box2D world
-    b2World world(gravity);
-    
-    // --- Create the ground (static Body) ---
-    b2BodyDef groundBodyDef;
-    groundBodyDef.position.Set(400.0f / SCALE, 550.0f / SCALE); // Position in meters
-    
-    b2Body* groundBody = world.CreateBody(&groundBodyDef);
-    
-    b2PolygonShape groundBox;
-    // Ground dimensions: 380 pixels wide, 10 pixels high
-    groundBox.SetAsBox(380.0f / SCALE, 10.0f / SCALE); // Half-width, half-height in meters
-    
-    groundBody->CreateFixture(&groundBox, 0.0f); // 0.0f density for a static body
-    
-    // --- Create a dynamic box (dynamic Body) ---
-    b2BodyDef dynamicBoxDef;
-    dynamicBoxDef.type = b2_dynamicBody; // It's a dynamic body, affected by gravity
-    dynamicBoxDef.position.Set(400.0f / SCALE, 100.0f / SCALE); // Initial position in meters
-    
-    b2Body* dynamicBoxBody = world.CreateBody(&dynamicBoxDef);
-    
-    b2PolygonShape dynamicBox;
-    // Box dimensions: 40 pixels wide, 40 pixels high
-    dynamicBox.SetAsBox(20.0f / SCALE, 20.0f / SCALE); // Half-width, half-height in meters
-    
-    b2FixtureDef fixtureDef;
-    fixtureDef.shape = &dynamicBox;
-    fixtureDef.density = 1.0f;    // Density to calculate mass
-    fixtureDef.friction = 0.3f;   // Friction
-    fixtureDef.restitution = 0.5f; // Bounciness
-    
-    dynamicBoxBody->CreateFixture(&fixtureDef);
-    
+    PhysicsScene scene(800.0f, 600.0f, bodyCount);
+    BoxRenderer renderer(scene.bodies());
+
+    // --- Stress statistics, printed once per second ---
+    sf::Clock frameClock;
+    sf::Clock reportClock;
+    sf::Time frameTime;
+    sf::Time stepTime;
+    unsigned drawCalls = 0;
+    unsigned frames = 0;
+    if (stress)
+        std::cout << "Simulating " << scene.bodies().size() << " bodies\n";
+
     // --- Main game loop ---
-    float timeStep = 1.0f / 60.0f; // 60 simulation steps per second
-    int velocityIterations = 8;    // How many velocity iterations
-    int positionIterations = 3;    // How many position iterations
-    
     while (window.isOpen())
     {
         sf::Event event;
@@ -60,33 +103,31 @@ int main()
             if (event.type == sf::Event::Closed)
                 window.close();
         }
-        
+
         // --- Update the Box2D world ---
-        world.Step(timeStep, velocityIterations, positionIterations);
-        
-        // --- Render (draw) with SFML ---
+        sf::Clock stepClock;
+        scene.step();
+        stepTime += stepClock.getElapsedTime();
+
+        // --- Render (draw) every body in one batch ---
+        renderer.update(scene.bodies());
         window.clear(sf::Color(100, 100, 250)); // Clear the window with light blue
-        
-        // Draw the ground (Box2D has center position, SFML uses top-left corner)
-        sf::RectangleShape groundShape(sf::Vector2f(760.0f, 20.0f)); // Size in pixels
-        // Convert Box2D center position to SFML top-left corner
-        groundShape.setPosition(groundBody->GetPosition().x * SCALE - 380.0f,
-                                groundBody->GetPosition().y * SCALE - 10.0f);
-        groundShape.setFillColor(sf::Color(50, 150, 50)); // Dark green
-        window.draw(groundShape);
-        
-        // Draw the dynamic box
-        sf::RectangleShape dynamicBoxShape(sf::Vector2f(40.0f, 40.0f)); // Size in pixels
-        // Convert Box2D center position to SFML top-left corner
-        dynamicBoxShape.setPosition(dynamicBoxBody->GetPosition().x * SCALE - 20.0f,
-                                    dynamicBoxBody->GetPosition().y * SCALE - 20.0f);
-        // Set rotation (Box2D uses radians, SFML uses degrees)
-        dynamicBoxShape.setRotation(dynamicBoxBody->GetAngle() * 180 / b2_pi);
-        dynamicBoxShape.setFillColor(sf::Color::Red);
-        window.draw(dynamicBoxShape);
-        
+        drawCalls += renderer.draw(window);
         window.display();
+
+        frameTime += frameClock.restart();
+        ++frames;
+        if (stress && reportClock.getElapsedTime() >= sf::seconds(1.0f)) {
+            std::cout << std::fixed << std::setprecision(2)
+                      << "frame " << frameTime.asSeconds() * 1000.0f / frames << " ms"
+                      << "  step " << stepTime.asSeconds() * 1000.0f / frames << " ms"
+                      << "  draw calls " << drawCalls / frames << "/frame"
+                      << "  (" << frames << " frames)\n";
+            frameTime = stepTime = sf::Time::Zero;
+            drawCalls = frames = 0;
+            reportClock.restart();
+        }
     }
-    
+
     return 0;
 }
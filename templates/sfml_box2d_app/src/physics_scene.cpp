@@ -0,0 +1,126 @@
+#include "physics_scene.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+// Simulation settings: 60 steps per second
+const float TIME_STEP = 1.0f / 60.0f;
+const int VELOCITY_ITERATIONS = 8;
+const int POSITION_ITERATIONS = 3;
+
+const sf::Color PALETTE[] = {
+    sf::Color(230, 57, 70), sf::Color(241, 250, 238), sf::Color(168, 218, 220),
+    sf::Color(69, 123, 157), sf::Color(244, 162, 97), sf::Color(233, 196, 106),
+};
+
+b2Vec2 toMeters(float x, float y)
+{
+    return b2Vec2(x / SCALE, y / SCALE);
+}
+
+} // namespace
+
+PhysicsScene::PhysicsScene(float widthPixels, float heightPixels, int boxCount)
+    : world(b2Vec2(0.0f, 9.8f)) // Positive Y points downwards, as in SFML
+{
+    const float wall = 10.0f; // Half-thickness in pixels
+    const float floorY = heightPixels - 50.0f;
+    const float left = 20.0f;
+    const float right = widthPixels - 20.0f;
+
+    // One static body per side, plus the boxes; reserve up front so the
+    // array never reallocates while it is filled
+    boxes.reserve(3 + std::max(boxCount, 1));
+
+    // --- Container: ground and two walls (static bodies) ---
+    const sf::Color green(50, 150, 50);
+    addBox(b2_staticBody, toMeters(widthPixels / 2.0f, floorY), toMeters((right - left) / 2.0f, wall), green);
+    addBox(b2_staticBody, toMeters(left, floorY / 2.0f), toMeters(wall, floorY / 2.0f), green);
+    addBox(b2_staticBody, toMeters(right, floorY / 2.0f), toMeters(wall, floorY / 2.0f), green);
+
+    if (boxCount <= 0) {
+        addBox(b2_dynamicBody, toMeters(widthPixels / 2.0f, 100.0f), toMeters(20.0f, 20.0f), sf::Color::Red);
+        return;
+    }
+
+    // --- Stress mode: boxCount boxes in loose columns ---
+    // Size the boxes so that, once settled, they fill about half of the
+    // container; the gaps and the offset of every other row make them
+    // tumble instead of landing as one stack.
+    const float innerLeft = left + wall;
+    const float innerWidth = (right - wall) - innerLeft;
+    const float innerHeight = floorY - wall;
+    const float side = std::clamp(std::sqrt(innerWidth * innerHeight * 0.5f / boxCount), 4.0f, 40.0f);
+    const float spacing = side * 1.5f;
+    const int columns = std::max(1, static_cast<int>((innerWidth - spacing / 2.0f) / spacing));
+
+    for (int i = 0; i < boxCount; ++i) {
+        const int row = i / columns;
+        const int column = i % columns;
+        const float x = innerLeft + spacing * (column + 0.5f) + (row % 2 ? spacing / 4.0f : 0.0f);
+        const float y = floorY - wall - spacing * (row + 0.5f);
+        addBox(b2_dynamicBody, toMeters(x, y), toMeters(side / 2.0f, side / 2.0f), PALETTE[i % 6]);
+    }
+}
+
+void PhysicsScene::step()
+{
+    world.Step(TIME_STEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
+}
+
+std::uint64_t PhysicsScene::stateHash() const
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](float value) {
+        unsigned char bytes[sizeof value];
+        std::memcpy(bytes, &value, sizeof value);
+        for (unsigned char byte : bytes) {
+            hash ^= byte;
+            hash *= 1099511628211ull;
+        }
+    };
+    for (const BoxBody& box : boxes) {
+        const b2Vec2& position = box.body->GetPosition();
+        const b2Vec2& velocity = box.body->GetLinearVelocity();
+        mix(position.x);
+        mix(position.y);
+        mix(box.body->GetAngle());
+        mix(velocity.x);
+        mix(velocity.y);
+        mix(box.body->GetAngularVelocity());
+    }
+    return hash;
+}
+
+std::size_t PhysicsScene::dynamicCount() const
+{
+    return std::count_if(boxes.begin(), boxes.end(),
+                         [](const BoxBody& box) { return box.body->GetType() == b2_dynamicBody; });
+}
+
+void PhysicsScene::addBox(b2BodyType type, b2Vec2 position, b2Vec2 halfExtents, sf::Color color)
+{
+    b2BodyDef bodyDef;
+    bodyDef.type = type;
+    bodyDef.position = position;
+    b2Body* body = world.CreateBody(&bodyDef);
+
+    b2PolygonShape shape;
+    shape.SetAsBox(halfExtents.x, halfExtents.y);
+
+    if (type == b2_staticBody) {
+        body->CreateFixture(&shape, 0.0f); // 0.0f density for a static body
+    } else {
+        b2FixtureDef fixtureDef;
+        fixtureDef.shape = &shape;
+        fixtureDef.density = 1.0f;     // Density to calculate mass
+        fixtureDef.friction = 0.3f;    // Friction
+        fixtureDef.restitution = 0.5f; // Bounciness
+        body->CreateFixture(&fixtureDef);
+    }
+
+    boxes.push_back({body, halfExtents, color});
+}
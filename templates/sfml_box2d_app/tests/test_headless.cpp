@@ -0,0 +1,83 @@
+// Tests for PhysicsScene determinism and the headless report; needs Box2D
+// but no window
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include "headless_bench.h"
+#include "physics_scene.h"
+
+static int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::cerr << __FILE__ << ':' << __LINE__ << ": " #condition "\n";   \
+            ++failures;                                                         \
+        }                                                                       \
+    } while (0)
+
+static std::uint64_t hashAfter(int boxCount, int ticks) {
+    PhysicsScene scene(800.0f, 600.0f, boxCount);
+    for (int tick = 0; tick < ticks; ++tick)
+        scene.step();
+    return scene.stateHash();
+}
+
+static void testIdenticalScenesHashTheSame() {
+    CHECK(hashAfter(200, 120) == hashAfter(200, 120));
+    CHECK(hashAfter(0, 60) == hashAfter(0, 60));
+    // The hash follows the state: other steps or another scene differ
+    CHECK(hashAfter(200, 120) != hashAfter(200, 119));
+    CHECK(hashAfter(200, 0) != hashAfter(201, 0));
+}
+
+static void testHeadlessWorldsMatchASingleScene() {
+    HeadlessOptions options;
+    options.worlds = 3;
+    options.ticks = 60;
+    options.bodies = 100;
+    options.threads = 2;
+    const HeadlessReport report = runHeadless(options);
+
+    CHECK(report.deterministic());
+    CHECK(report.hashes.size() == 3);
+    CHECK(report.hashes.front() == hashAfter(100, 60));
+    CHECK(report.dynamicBodies == 100);
+    CHECK(report.stepSeconds.size() == 3 * 60);
+    CHECK(report.threads == 2);
+}
+
+static void testPercentilesOfAKnownSample() {
+    HeadlessReport report;
+    CHECK(report.percentile(0.5) == 0.0);
+
+    for (int i = 1; i <= 10; ++i)
+        report.stepSeconds.push_back(i); // Whole seconds compare exactly
+    CHECK(report.percentile(0.0) == 1.0); // Nearest rank: never below the first sample
+    CHECK(report.percentile(0.5) == 5.0);
+    CHECK(report.percentile(0.9) == 9.0);
+    CHECK(report.percentile(0.99) == 10.0);
+    CHECK(report.percentile(1.0) == 10.0);
+
+    report.dynamicBodies = 4;
+    report.wallSeconds = 2.0;
+    CHECK(report.bodyStepsPerSecond() == 20.0);
+
+    report.hashes = {7, 7, 7};
+    CHECK(report.deterministic());
+    report.hashes.push_back(8);
+    CHECK(!report.deterministic());
+}
+
+int main() {
+    testIdenticalScenesHashTheSame();
+    testHeadlessWorldsMatchASingleScene();
+    testPercentilesOfAKnownSample();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "All headless tests passed\n";
+    return EXIT_SUCCESS;
+}
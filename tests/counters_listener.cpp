@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "perf/counters.hpp"
+
+// Per-test hardware counters, enabled with CPPSTARTER_COUNTERS=1 (make test-counters).
+// Values are printed after each test and recorded as properties, so they
+// also end up in the XML report.
+namespace {
+
+class CountersListener : public ::testing::EmptyTestEventListener {
+public:
+    CountersListener() {
+        if (!counters_.hardware_available()) {
+            std::cout << "[ COUNTERS ] Hardware counters unavailable: " << counters_.unavailable_reason()
+                      << "; reporting wall time only\n";
+        }
+    }
+
+    void OnTestStart(const ::testing::TestInfo&) override { counters_.start(); }
+
+    void OnTestEnd(const ::testing::TestInfo&) override {
+        const perf::CounterSample sample = counters_.stop();
+        std::cout << "[ COUNTERS ] " << perf::format_counters(sample) << '\n';
+
+        auto record = [](const char* key, const std::optional<uint64_t>& value) {
+            if (value) {
+                ::testing::Test::RecordProperty(key, std::to_string(*value));
+            }
+        };
+        record("cycles", sample.cycles);
+        record("instructions", sample.instructions);
+        record("l1d_misses", sample.l1d_misses);
+        record("llc_misses", sample.llc_misses);
+        record("branch_misses", sample.branch_misses);
+        record("context_switches", sample.context_switches);
+        if (auto ipc = sample.ipc()) {
+            ::testing::Test::RecordProperty("ipc", std::to_string(*ipc));
+        }
+    }
+
+private:
+    perf::PerfCounters counters_;
+};
+
+// Registered before gtest_main's InitGoogleTest; listeners may be added any time before RUN_ALL_TESTS
+const bool registered = [] {
+    const char* enabled = std::getenv("CPPSTARTER_COUNTERS");
+    if (enabled && std::string(enabled) == "1") {
+        ::testing::UnitTest::GetInstance()->listeners().Append(new CountersListener);
+    }
+    return true;
+}();
+
+} // namespace
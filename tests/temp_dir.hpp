@@ -0,0 +1,46 @@
+#ifndef TEMP_DIR_HPP
+#define TEMP_DIR_HPP
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+
+// Fixture base for tests that work on real files: each test gets an empty
+// directory, cppstarter_<suite>_<pid> under the system temp directory, that
+// is removed again afterwards.
+class TempDirTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const std::string suite = ::testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+        dir = std::filesystem::temp_directory_path() / ("cppstarter_" + suite + "_" + std::to_string(::getpid()));
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(dir, ec);
+    }
+
+    // Writes dir/name, creating its parent directories
+    std::filesystem::path write(const std::string& name, const std::string& content) const {
+        const std::filesystem::path path = dir / name;
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream(path, std::ios::binary) << content;
+        return path;
+    }
+
+    static std::string read(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::ostringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    std::filesystem::path dir;
+};
+
+#endif // TEMP_DIR_HPP
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <string>
+
+#include "build/flag_tuning.hpp"
+#include "scaffold/bench_files.hpp"
+#include "temp_dir.hpp"
+#include "utils/process.hpp"
+
+namespace fs = std::filesystem;
+
+class BenchHarnessTest : public TempDirTest {};
+
+// Builds the harness `cppstarter new` writes with two trivial benchmarks and
+// checks calibration, --filter and the --json report that `tune` scores
+TEST_F(BenchHarnessTest, GeneratedHarnessCalibratesFiltersAndWritesJson) {
+    write("bench.hpp", std::string(scaffold::BENCH_HARNESS_HPP));
+    write("bench_main.cpp", std::string(scaffold::BENCH_MAIN_CPP));
+    write("bench_trivial.cpp",
+          "#include \"bench.hpp\"\n"
+          "static void bm_add(bench::State& state) {\n"
+          "    int x = 0;\n"
+          "    for (auto _ : state) { bench::DoNotOptimize(x += 1); }\n"
+          "}\n"
+          "BENCH(bm_add);\n"
+          "static void bm_skipped(bench::State& state) {\n"
+          "    for (auto _ : state) { bench::ClobberMemory(); }\n"
+          "}\n"
+          "BENCH(bm_skipped);\n");
+    const fs::path binary = dir / "bench";
+    const process::Result compile = process::run({"g++", "-std=c++17", "-O1", (dir / "bench_main.cpp").string(),
+                                                  (dir / "bench_trivial.cpp").string(), "-o", binary.string()});
+    ASSERT_EQ(compile.exit_code, 0) << compile.output;
+
+    const fs::path report = dir / "results.json";
+    const process::Result run = process::run({binary.string(), "--filter", "bm_add", "--json", report.string(),
+                                              "--min-time", "0.001", "--warmup", "0", "--samples", "3"});
+    ASSERT_EQ(run.exit_code, 0) << run.output;
+
+    const std::string json = read(report);
+    EXPECT_NE(json.find("\"name\": \"bm_add\""), std::string::npos);
+    EXPECT_EQ(json.find("bm_skipped"), std::string::npos);
+    EXPECT_NE(json.find("\"samples\": 3"), std::string::npos);
+
+    // Calibration runs many iterations per sample of a nanosecond-scale body
+    const size_t iterations = json.find("\"iterations\": ");
+    ASSERT_NE(iterations, std::string::npos);
+    EXPECT_GT(std::strtoull(json.c_str() + iterations + 14, nullptr, 10), 1000u);
+
+    ASSERT_NE(json.find("\"median_ns\": "), std::string::npos);
+    EXPECT_GT(build::bench_score(json), 0.0);
+}
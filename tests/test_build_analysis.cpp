@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+
+#include "build/build_analysis.hpp"
+#include "temp_dir.hpp"
+
+namespace fs = std::filesystem;
+
+class BuildAnalysisTest : public TempDirTest {
+protected:
+    fs::path write(const std::string& name, size_t bytes) {
+        return TempDirTest::write(name, std::string(bytes, 'x'));
+    }
+};
+
+// Sizes 100 (source) + 300 + 500 + 100: a.hpp includes b.hpp, c.hpp is separate
+TEST_F(BuildAnalysisTest, GccReportSharesFrontendTimeBySize) {
+    build::UnitAnalysis unit;
+    unit.source = write("main.cpp", 100);
+    const std::string a = write("a.hpp", 300).string();
+    const std::string b = write("b.hpp", 500).string();
+    const std::string c = write("c.hpp", 100).string();
+    const std::string output =
+        ". " + a + "\n.. " + b + "\n. " + c + "\n"
+        "Multiple include guards may be useful for:\n" + c + "\n\n"
+        "src/main.cpp:3:5: warning: unused variable 'x'\n\n"
+        "Time variable                                   usr           sys          wall           GGC\n"
+        " phase setup                        :   0.01 (  1%)   0.00 (  0%)   0.01 (  1%)  1446k (  3%)\n"
+        " phase parsing                      :   0.51 ( 63%)   0.24 ( 80%)   0.80 ( 66%)    36M ( 70%)\n"
+        " phase lang. deferred               :   0.08 ( 10%)   0.02 (  7%)   0.20 (  9%)  5269k ( 10%)\n"
+        " phase opt and generate             :   0.21 ( 26%)   0.04 ( 13%)   0.27 ( 23%)  9182k ( 17%)\n"
+        " TOTAL                              :   0.81          0.30          1.28           51M\n";
+
+    EXPECT_EQ(build::parse_gcc_analysis(output, unit), "src/main.cpp:3:5: warning: unused variable 'x'\n");
+    EXPECT_DOUBLE_EQ(unit.frontend_seconds, 1.0);
+    EXPECT_DOUBLE_EQ(unit.backend_seconds, 0.27);
+    ASSERT_EQ(unit.includes.size(), 3u);
+    EXPECT_EQ(unit.includes[1].depth, 2u);
+    EXPECT_NEAR(unit.includes[0].seconds, 0.8, 1e-9);   // Itself and b.hpp
+    EXPECT_NEAR(unit.includes[1].seconds, 0.5, 1e-9);
+    EXPECT_NEAR(unit.includes[2].seconds, 0.1, 1e-9);
+    EXPECT_NEAR(unit.includes[2].offset, 0.8, 1e-9);    // After a.hpp's subtree
+}
+
+TEST(BuildAnalysisClangTest, TimeTraceNestsSourceEvents) {
+    const std::string json = R"({"traceEvents":[
+        {"pid":1,"tid":1,"ph":"X","ts":100,"dur":5000,"name":"Source","args":{"detail":"/usr/include/vector"}},
+        {"pid":1,"tid":1,"ph":"X","ts":200,"dur":1000,"name":"Source","args":{"detail":"/usr/include/bits/a.h"}},
+        {"pid":1,"tid":1,"ph":"X","ts":6000,"dur":2000,"name":"Source","args":{"detail":"app.hpp"}},
+        {"pid":1,"tid":1,"ph":"X","ts":0,"dur":9000,"name":"Total Frontend","args":{"count":1,"avg ms":9}},
+        {"pid":1,"tid":1,"ph":"X","ts":0,"dur":3000,"name":"Total Backend","args":{"count":1,"avg ms":3}}
+    ],"beginningOfTime":1700000000})";
+    build::UnitAnalysis unit;
+    build::parse_clang_time_trace(json, unit);
+
+    EXPECT_DOUBLE_EQ(unit.frontend_seconds, 0.009);
+    EXPECT_DOUBLE_EQ(unit.backend_seconds, 0.003);
+    ASSERT_EQ(unit.includes.size(), 3u);
+    EXPECT_EQ(unit.includes[0].header, "/usr/include/vector");
+    EXPECT_EQ(unit.includes[1].depth, 2u);
+    EXPECT_EQ(unit.includes[2].header, "app.hpp");
+    EXPECT_EQ(unit.includes[2].depth, 1u);
+    EXPECT_DOUBLE_EQ(unit.includes[2].seconds, 0.002);
+}
+
+TEST_F(BuildAnalysisTest, RanksHeadersAndKeepsHistory) {
+    build::BuildAnalysis analysis;
+    build::UnitAnalysis first;
+    first.source = "src/a.cpp";
+    first.seconds = 2.0;
+    first.max_rss_kb = 1000;
+    first.includes = {{"vector", 1, 0.0, 0.5}, {"app.hpp", 1, 0.5, 0.25}};
+    build::UnitAnalysis second = first;
+    second.source = "src/b.cpp";
+    second.max_rss_kb = 3000;
+    second.includes = {{"vector", 1, 0.0, 0.75}};
+    analysis.units = {first, second};
+
+    const auto headers = build::rank_headers(analysis.units);
+    ASSERT_EQ(headers.size(), 2u);
+    EXPECT_EQ(headers[0].header, "vector");
+    EXPECT_DOUBLE_EQ(headers[0].seconds, 1.25);
+    EXPECT_EQ(headers[0].units, 2u);
+
+    const std::string trace = build::chrome_trace(analysis.units);
+    EXPECT_NE(trace.find("\"name\":\"src/b.cpp\",\"cat\":\"compile\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"app.hpp\",\"cat\":\"include\""), std::string::npos);
+
+    build::BuildRecord record = build::summarize_build(analysis, "debug", 3.5);
+    record.commit = "abc1234+";
+    EXPECT_DOUBLE_EQ(record.cpu_seconds, 4.0);
+    EXPECT_EQ(record.peak_rss_kb, 3000);
+    EXPECT_EQ(record.top_header, "vector");
+
+    const fs::path history = dir / "stats/history.tsv";
+    EXPECT_TRUE(build::load_build_history(history).empty());
+    build::append_build_history(history, record);
+    build::append_build_history(history, record);
+    const auto loaded = build::load_build_history(history);
+    ASSERT_EQ(loaded.size(), 2u);
+    EXPECT_EQ(loaded[1].commit, "abc1234+");
+    EXPECT_EQ(loaded[1].units, 2u);
+    EXPECT_DOUBLE_EQ(loaded[1].wall_seconds, 3.5);
+    EXPECT_EQ(loaded[1].top_header, "vector");
+}
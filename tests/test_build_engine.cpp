@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "build/build_engine.hpp"
+#include "build/pgo.hpp"
+#include "build/unity_build.hpp"
+#include "temp_dir.hpp"
+
+namespace fs = std::filesystem;
+
+class BuildEngineTest : public TempDirTest {
+protected:
+    // The engine works with project-relative paths (src/..., build/...),
+    // so the build tests run from inside the temporary directory
+    void enter() {
+        previous = fs::current_path();
+        fs::current_path(dir);
+    }
+
+    void TearDown() override {
+        if (!previous.empty()) {
+            fs::current_path(previous);
+        }
+        TempDirTest::TearDown();
+    }
+
+    // Two translation units, only main.cpp includes the header
+    static build::BuildConfig two_file_config() {
+        build::BuildConfig config;
+        config.name = "debug";
+        config.compile_flags = {"-Iinclude"};
+        config.sources = {"src/main.cpp", "src/other.cpp"};
+        config.obj_dir = "build/debug/obj";
+        config.binary = "build/debug/bin/app";
+        return config;
+    }
+
+    // Moves every file an hour back, so a later write is newer than any object
+    void age_files() {
+        const auto past = fs::file_time_type::clock::now() - std::chrono::hours(1);
+        for (const auto& entry : fs::recursive_directory_iterator(dir)) {
+            if (entry.is_regular_file()) {
+                fs::last_write_time(entry.path(), past);
+            }
+        }
+    }
+
+    fs::path previous;
+};
+
+TEST_F(BuildEngineTest, DetectCommonHeadersRanksByUse) {
+    std::vector<fs::path> sources = {
+        write("a.cpp", "#include <vector>\n#include <string>\n#include \"local.hpp\"\n"),
+        write("b.cpp", "#include <vector>\n  #  include <map>\n"),
+        write("c.cpp", "#include <vector>\n#include <string>\n"),
+        write("d.cpp", "int main() { return 0; }\n"),
+    };
+
+    std::vector<std::string> expected = {"<vector>", "<string>", "<map>"};
+    EXPECT_EQ(build::detect_common_headers(sources), expected);
+    EXPECT_EQ(build::detect_common_headers(sources, 1), std::vector<std::string>{"<vector>"});
+}
+
+TEST_F(BuildEngineTest, UnityBatchesAreBalancedBySize) {
+    std::vector<fs::path> sources = {
+        write("big.cpp", std::string(900, ' ')),
+        write("mid.cpp", std::string(500, ' ')),
+        write("small1.cpp", std::string(300, ' ')),
+        write("small2.cpp", std::string(200, ' ')),
+    };
+
+    auto plan = build::plan_unity_batches(sources, 2);
+    ASSERT_EQ(plan.size(), 2u);
+    EXPECT_EQ(plan[0].bytes, 900u);
+    EXPECT_EQ(plan[1].bytes, 500u + 300u + 200u);
+    EXPECT_EQ(plan[0].sources, std::vector<fs::path>{dir / "big.cpp"});
+
+    // More batches than files: empty batches are dropped
+    EXPECT_EQ(build::plan_unity_batches(sources, 8).size(), 4u);
+}
+
+TEST_F(BuildEngineTest, UnityMergesOnlySourcesWithAFixedDefaultBatchCount) {
+    enter();
+    build::BuildConfig config;
+    config.name = "test";
+    config.obj_dir = "build/test/obj";
+    for (int i = 0; i < 20; ++i) {
+        const std::string name = "src/file" + std::to_string(i) + ".cpp";
+        write(name, "int f" + std::to_string(i) + "() { return 0; }\n");
+        config.sources.emplace_back(name);
+    }
+    write("tests/test_a.cpp", "int main() { return 0; }\n");
+    config.sources.emplace_back("tests/test_a.cpp");
+
+    build::UnityOptions options;
+    options.exclude = {"file3.cpp"};
+    build::apply_unity_build(config, options);
+
+    // 19 merged files: one batch per 8, whatever the job count
+    const std::vector<fs::path> expected = {
+        "build/test/unity/unity_1.cpp", "build/test/unity/unity_2.cpp", "src/file3.cpp", "tests/test_a.cpp"};
+    EXPECT_EQ(config.sources, expected);
+    EXPECT_EQ(config.original_sources.size(), 21u);
+}
+
+TEST_F(BuildEngineTest, PgoFingerprintTracksSourcesAndFlags) {
+    build::BuildConfig config;
+    config.sources = {write("a.cpp", "int a() { return 1; }\n")};
+    config.compile_flags = {"-O2"};
+    const std::string original = build::pgo_fingerprint(config);
+    EXPECT_EQ(build::pgo_fingerprint(config), original);
+
+    config.compile_flags.push_back("-DNDEBUG");
+    EXPECT_NE(build::pgo_fingerprint(config), original);
+
+    config.compile_flags.pop_back();
+    write("a.cpp", "int a() { return 2; }\n");
+    EXPECT_NE(build::pgo_fingerprint(config), original);
+}
+
+TEST_F(BuildEngineTest, RebuildsOnlyWhatChanged) {
+    write("src/main.cpp", "#include \"shared.hpp\"\nint other();\nint main() { return value() + other(); }\n");
+    write("src/other.cpp", "int other() { return 0; }\n");
+    write("include/shared.hpp", "inline int value() { return 0; }\n");
+    enter();
+
+    build::BuildEngine engine(two_file_config());
+    build::BuildResult result = engine.build();
+    ASSERT_TRUE(result.success);
+    EXPECT_EQ(result.compiled, 2u);
+    EXPECT_TRUE(result.linked);
+    EXPECT_TRUE(fs::exists("build/debug/bin/app"));
+
+    // Nothing changed: no compile, no link, also for a fresh engine that
+    // has to read the dependency graph back from the depfiles
+    result = engine.build();
+    EXPECT_EQ(result.compiled, 0u);
+    EXPECT_EQ(result.up_to_date, 2u);
+    EXPECT_FALSE(result.linked);
+    EXPECT_EQ(build::BuildEngine(two_file_config()).build().compiled, 0u);
+    EXPECT_EQ(engine.dependents_of("include/shared.hpp"), std::vector<fs::path>{"src/main.cpp"});
+
+    // A header edit recompiles only the translation unit that includes it
+    age_files();
+    write("include/shared.hpp", "inline int value() { return 1 - 1; }\n");
+    result = engine.build();
+    ASSERT_TRUE(result.success);
+    EXPECT_EQ(result.compiled, 1u);
+    EXPECT_EQ(result.up_to_date, 1u);
+    EXPECT_TRUE(result.linked);
+
+    // Different flags (flags.sig) recompile everything, once
+    build::BuildConfig changed = two_file_config();
+    changed.compile_flags.push_back("-DCHANGED");
+    build::BuildEngine rebuilt(changed);
+    EXPECT_EQ(rebuilt.build().compiled, 2u);
+    EXPECT_EQ(rebuilt.build().compiled, 0u);
+}
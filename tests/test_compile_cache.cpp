@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "build/compile_cache.hpp"
+#include "temp_dir.hpp"
+#include "utils/hash.hpp"
+#include "utils/process.hpp"
+
+namespace fs = std::filesystem;
+
+TEST(HashTest, Sha256KnownVectors) {
+    EXPECT_EQ(hash::sha256_hex(""),
+              "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    EXPECT_EQ(hash::sha256_hex("abc"),
+              "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+    // Longer than one block, fed in uneven pieces
+    const std::string text(1000, 'a');
+    hash::Sha256 sha;
+    sha.update(text.substr(0, 3));
+    sha.update(text.substr(3, 500));
+    sha.update(text.substr(503));
+    EXPECT_EQ(sha.hex_digest(), hash::sha256_hex(text));
+}
+
+TEST(HashTest, Sha1KnownVectors) {
+    hash::Sha1 empty;
+    EXPECT_EQ(empty.hex_digest(), "da39a3ee5e6b4b0d3255bfef95601890afd80709");
+    hash::Sha1 abc;
+    abc.update("abc");
+    EXPECT_EQ(abc.hex_digest(), "a9993e364706816aba3e25717850c26c9cd0d89d");
+
+    // The id git gives an empty blob
+    hash::Sha1 blob;
+    blob.update(std::string_view("blob 0\0", 7));
+    EXPECT_EQ(blob.hex_digest(), "e69de29bb2d1d6434b8b29ae775ad8c2e48c5391");
+}
+
+// Debug and test configurations differ only in preprocessor flags, so they share keys
+TEST(CompileCacheTest, KeyFlagsDropPreprocessorOptions) {
+    const std::vector<std::string> debug = {"-std=c++17", "-Wall", "-Iinclude", "-g", "-DDEBUG"};
+    const std::vector<std::string> test = {"-std=c++17", "-Wall", "-Iinclude", "-g", "-DDEBUG",
+                                           "-Itests", "-pthread", "-isystem", "/opt/gtest/include"};
+
+    EXPECT_EQ(build::key_flags(debug), build::key_flags(test));
+    EXPECT_EQ(build::key_flags(debug), (std::vector<std::string>{"-std=c++17", "-Wall", "-g"}));
+}
+
+TEST(CompileCacheTest, ParseSize) {
+    EXPECT_EQ(build::parse_size("1024"), 1024u);
+    EXPECT_EQ(build::parse_size("2K"), 2048u);
+    EXPECT_EQ(build::parse_size("5G"), 5ull * 1024 * 1024 * 1024);
+    EXPECT_THROW(build::parse_size("lots"), std::invalid_argument);
+    EXPECT_THROW(build::parse_size("5X"), std::invalid_argument);
+}
+
+class CompileCacheStoreTest : public TempDirTest {
+protected:
+    void SetUp() override {
+        TempDirTest::SetUp();
+        const char* previous = std::getenv("CPPSTARTER_CACHE_DIR");
+        saved_env = previous ? previous : "";
+        had_env = previous != nullptr;
+        ::setenv("CPPSTARTER_CACHE_DIR", (dir / "cache").c_str(), 1);
+        fs::create_directories(dir / "obj");
+    }
+
+    void TearDown() override {
+        if (had_env) {
+            ::setenv("CPPSTARTER_CACHE_DIR", saved_env.c_str(), 1);
+        } else {
+            ::unsetenv("CPPSTARTER_CACHE_DIR");
+        }
+        TempDirTest::TearDown();
+    }
+
+    // Looks `name`.cpp up and, on a miss, compiles and stores it the way
+    // BuildEngine does
+    build::CompileCache::Lookup compile(build::CompileCache& cache, const std::string& name,
+                                        const std::vector<std::string>& flags, const std::string& compiler = "g++") {
+        const fs::path source = dir / (name + ".cpp");
+        const fs::path object = dir / "obj" / (name + ".o");
+        auto lookup = cache.lookup(compiler, flags, source, object, dir / "obj" / (name + ".d"));
+        if (!lookup.hit) {
+            std::vector<std::string> command = {compiler};
+            command.insert(command.end(), flags.begin(), flags.end());
+            command.insert(command.end(), {"-c", source.string(), "-o", object.string()});
+            EXPECT_EQ(process::run(command).exit_code, 0);
+            cache.store(lookup.key, object, "note: " + name + "\n");
+        }
+        return lookup;
+    }
+
+    std::string saved_env;
+    bool had_env = false;
+};
+
+TEST_F(CompileCacheStoreTest, StoreThenLookupRestoresObjectAndDwo) {
+    build::CompileCache cache;
+    ASSERT_EQ(cache.root(), dir / "cache");
+    write("a.cpp", "int a() { return 1; }\n");
+    const std::vector<std::string> flags = {"-O0", "-g", "-gsplit-dwarf"};
+
+    const auto miss = compile(cache, "a", flags);
+    EXPECT_FALSE(miss.hit);
+    ASSERT_FALSE(miss.key.empty());
+    ASSERT_TRUE(fs::exists(dir / "obj/a.dwo"));
+    const std::string object = read(dir / "obj/a.o");
+    const std::string dwo = read(dir / "obj/a.dwo");
+
+    fs::remove(dir / "obj/a.o");
+    fs::remove(dir / "obj/a.dwo");
+    const auto hit = compile(cache, "a", flags);
+    EXPECT_TRUE(hit.hit);
+    EXPECT_EQ(hit.key, miss.key);
+    EXPECT_EQ(hit.output, "note: a\n");
+    EXPECT_EQ(read(dir / "obj/a.o"), object);
+    EXPECT_EQ(read(dir / "obj/a.dwo"), dwo);
+
+    // Another compiler or code-generation flag is another key
+    if (process::run({"c++", "--version"}).exit_code == 0) {
+        EXPECT_NE(cache.lookup("c++", flags, dir / "a.cpp", dir / "obj/a.o", dir / "obj/a.d").key, miss.key);
+    }
+    const auto optimized = cache.lookup("g++", {"-O2", "-g", "-gsplit-dwarf"}, dir / "a.cpp", dir / "obj/a.o",
+                                        dir / "obj/a.d");
+    EXPECT_FALSE(optimized.hit);
+    EXPECT_NE(optimized.key, miss.key);
+
+    // Profile-guided compiles are never cached
+    const auto profiled = cache.lookup("g++", {"-O2", "-fprofile-use"}, dir / "a.cpp", dir / "obj/a.o",
+                                       dir / "obj/a.d");
+    EXPECT_FALSE(profiled.hit);
+    EXPECT_TRUE(profiled.key.empty());
+
+    cache.flush();
+    EXPECT_EQ(cache.stats().hits, 1u);
+}
+
+TEST_F(CompileCacheStoreTest, CleanupEvictsLeastRecentlyUsed) {
+    build::CompileCache cache;
+    const std::vector<std::string> flags = {"-O0"};
+    for (const std::string name : {"a", "b", "c"}) {
+        write(name + ".cpp", "int " + name + "() { return 0; }\n");
+        compile(cache, name, flags);
+    }
+    // Hits refresh an entry: b is now the least recently used
+    EXPECT_TRUE(compile(cache, "c", flags).hit);
+    EXPECT_TRUE(compile(cache, "a", flags).hit);
+
+    cache.flush();
+    EXPECT_EQ(cache.cleanup(), 0u);     // Recounts the entries on disk
+    const uint64_t total = cache.stats().size_bytes;
+    ASSERT_GT(total, 0u);
+    cache.set_max_size(total - 1);
+    EXPECT_EQ(cache.cleanup(), 1u);
+    EXPECT_EQ(cache.stats().files, 2u);
+    EXPECT_FALSE(compile(cache, "b", flags).hit);
+    EXPECT_TRUE(compile(cache, "a", flags).hit);
+}
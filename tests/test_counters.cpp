@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "perf/counters.hpp"
+
+TEST(CountersTest, FormatsOnlyCollectedCounters) {
+    perf::CounterSample sample;
+    sample.wall_seconds = 0.25;
+    EXPECT_EQ(perf::format_counters(sample), "250.0 ms");
+    EXPECT_FALSE(sample.ipc());
+
+    sample.cycles = 40'000'000;
+    sample.instructions = 100'000'000;
+    sample.branch_misses = 12'345;
+    sample.context_switches = 3;
+    ASSERT_TRUE(sample.ipc());
+    EXPECT_DOUBLE_EQ(*sample.ipc(), 2.5);
+    EXPECT_EQ(perf::format_counters(sample),
+              "250.0 ms  cycles 40.0M  instr 100.0M  IPC 2.50  br miss 12.3k  ctx sw 3");
+}
+
+TEST(CountersTest, DegradesToWallTimeWithoutCounters) {
+    // Whatever the kernel allows, start/stop must work and time the region
+    perf::PerfCounters counters;
+    if (!counters.hardware_available()) {
+        EXPECT_FALSE(counters.unavailable_reason().empty());
+    }
+    counters.start();
+    volatile uint64_t sum = 0;
+    for (uint64_t i = 0; i < 100000; ++i) {
+        sum = sum + i;
+    }
+    perf::CounterSample sample = counters.stop();
+    EXPECT_GT(sample.wall_seconds, 0.0);
+    if (sample.instructions) {
+        EXPECT_GT(*sample.instructions, 100000u);
+    }
+}
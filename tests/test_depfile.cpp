@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "build/depfile.hpp"
+
+// Output of `g++ -MMD -MP` for a file with two headers
+TEST(DepfileTest, ParsesFirstRuleAndIgnoresPhonyTargets) {
+    const std::string content =
+        "build/debug/obj/main.o: src/main.cpp include/a.hpp \\\n"
+        " include/b.hpp\n"
+        "include/a.hpp:\n"
+        "include/b.hpp:\n";
+
+    std::vector<std::string> expected = {"src/main.cpp", "include/a.hpp", "include/b.hpp"};
+    EXPECT_EQ(build::parse_depfile(content), expected);
+}
+
+TEST(DepfileTest, HandlesEscapedSpacesAndDollars) {
+    const std::string content = "obj/x.o: src/my\\ file.cpp include/$$cost.hpp\n";
+
+    std::vector<std::string> expected = {"src/my file.cpp", "include/$cost.hpp"};
+    EXPECT_EQ(build::parse_depfile(content), expected);
+}
+
+TEST(DepfileTest, EmptyOrMissingContent) {
+    EXPECT_TRUE(build::parse_depfile("").empty());
+    EXPECT_TRUE(build::read_depfile("does/not/exist.d").empty());
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "build/fast_link.hpp"
+
+namespace fs = std::filesystem;
+
+TEST(FastLinkTest, SelectLinkerByName) {
+    const std::vector<build::Linker> linkers = {{"gold", "-fuse-ld=gold", "GNU gold 1.16", true},
+                                                {"default", "", "GNU ld 2.40", false}};
+    EXPECT_EQ(build::select_linker(linkers, "auto").name, "gold");
+    EXPECT_EQ(build::select_linker(linkers, "default").name, "default");
+    EXPECT_THROW(build::select_linker(linkers, "mold"), std::runtime_error);
+    EXPECT_THROW(build::select_linker(linkers, "ld.bfd"), std::runtime_error);
+    EXPECT_THROW(build::select_linker({}, "auto"), std::runtime_error);
+}
+
+TEST(FastLinkTest, RelinkSwapsLinkerAndOutput) {
+    const std::vector<std::string> command = {"g++", "-fuse-ld=gold", "-Wl,--gdb-index", "a.o", "b.o",
+                                              "-o", "build/debug/bin/app", "-lpthread"};
+    const build::Linker ld{"default", "", "GNU ld 2.40", false};
+    EXPECT_EQ(build::relink_with(command, ld, "/tmp/scratch/app"),
+              (std::vector<std::string>{"g++", "a.o", "b.o", "-o", "/tmp/scratch/app", "-lpthread"}));
+
+    const build::Linker lld{"lld", "-fuse-ld=lld", "LLD 16", true};
+    EXPECT_EQ(build::relink_with(command, lld, "app"),
+              (std::vector<std::string>{"g++", "-fuse-ld=lld", "-Wl,--gdb-index", "a.o", "b.o", "-o", "app",
+                                        "-lpthread"}));
+}
+
+// Only the project's own code goes into the shared library
+TEST(FastLinkTest, SharedProfileSplitsOutMain) {
+    build::BuildConfig config;
+    config.obj_dir = "build/debug/obj";
+    config.compile_flags = {"-std=c++17", "-g"};
+    config.sources = {"src/main.cpp", "src/app.cpp", "src/util/strings.cpp", "tests/test_app.cpp"};
+
+    build::FastLinkOptions options;
+    options.shared = true;
+    build::apply_fast_link(config, {"gold", "-fuse-ld=gold", "GNU gold 1.16", true}, options);
+
+    EXPECT_EQ(config.library_sources, (std::vector<fs::path>{"src/app.cpp", "src/util/strings.cpp"}));
+    EXPECT_EQ(config.shared_library.parent_path(), fs::path("build/debug/lib"));
+    EXPECT_EQ(config.compile_flags, (std::vector<std::string>{"-std=c++17", "-g", "-gsplit-dwarf",
+                                                              "-ggnu-pubnames", "-fPIC"}));
+    EXPECT_EQ(config.link_flags, (std::vector<std::string>{"-fuse-ld=gold", "-Wl,--gdb-index"}));
+}
+
+TEST(FastLinkTest, GdbIndexNeedsARecognizedLinker) {
+    EXPECT_TRUE(build::supports_gdb_index("GNU gold (GNU Binutils for Ubuntu 2.42) 1.16"));
+    EXPECT_TRUE(build::supports_gdb_index("Ubuntu LLD 18.1.3 (compatible with GNU linkers)"));
+    EXPECT_TRUE(build::supports_gdb_index("mold 2.30.0 (compatible with GNU ld)"));
+    EXPECT_FALSE(build::supports_gdb_index("GNU ld (GNU Binutils for Ubuntu) 2.42"));
+    EXPECT_FALSE(build::supports_gdb_index(""));
+    EXPECT_FALSE(build::supports_gdb_index("Apple ld-1115.7.3"));
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "build/file_watcher.hpp"
+#include "temp_dir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std::chrono_literals;
+
+class FileWatcherTest : public TempDirTest {
+protected:
+    void SetUp() override {
+        TempDirTest::SetUp();
+        fs::create_directories(dir / "src");
+    }
+};
+
+TEST_F(FileWatcherTest, ReportsOneBurstOnceAndFollowsNewDirectories) {
+    build::FileWatcher watcher({dir / "src", dir / "missing"});
+    EXPECT_EQ(watcher.watched_directories(), 1u);
+    EXPECT_TRUE(watcher.wait(20ms, 0ms).paths.empty());
+
+    // An editor-style save: write a temporary, rename it over the file, write again
+    std::ofstream(dir / "src/main.cpp.tmp") << "int main() {}\n";
+    fs::rename(dir / "src/main.cpp.tmp", dir / "src/main.cpp");
+    std::ofstream(dir / "src/main.cpp") << "int main() { return 0; }\n";
+    const build::ChangeSet changes = watcher.wait(50ms, 1000ms);
+    ASSERT_EQ(changes.paths.size(), 2u);
+    EXPECT_EQ(changes.paths[0], dir / "src/main.cpp");
+    EXPECT_EQ(changes.paths[1], dir / "src/main.cpp.tmp");
+    EXPECT_TRUE(watcher.wait(20ms, 0ms).paths.empty());
+
+    fs::create_directories(dir / "src/detail");
+    watcher.wait(50ms, 1000ms);
+    EXPECT_EQ(watcher.watched_directories(), 2u);
+    std::ofstream(dir / "src/detail/util.hpp") << "#pragma once\n";
+    EXPECT_EQ(watcher.wait(50ms, 1000ms).paths, std::vector<fs::path>{dir / "src/detail/util.hpp"});
+}
+
+TEST_F(FileWatcherTest, ReportsFilesInDirectoriesThatArriveFilled) {
+    build::FileWatcher watcher({dir / "src"});
+
+    // Like `mkdir -p src/a/b && touch src/a/b/x.cpp`: the files exist before
+    // the watches on the new directories do
+    fs::create_directories(dir / "src/a/b");
+    std::ofstream(dir / "src/a/b/x.cpp") << "int x;\n";
+    std::ofstream(dir / "src/a/y.hpp") << "#pragma once\n";
+    const build::ChangeSet changes = watcher.wait(50ms, 1000ms);
+    EXPECT_EQ(watcher.watched_directories(), 3u);
+    EXPECT_NE(std::find(changes.paths.begin(), changes.paths.end(), dir / "src/a/b/x.cpp"), changes.paths.end());
+    EXPECT_NE(std::find(changes.paths.begin(), changes.paths.end(), dir / "src/a/y.hpp"), changes.paths.end());
+    EXPECT_FALSE(changes.overflowed);
+}
+
+TEST_F(FileWatcherTest, FlagsQueueOverflow) {
+    std::ifstream limit_file("/proc/sys/fs/inotify/max_queued_events");
+    size_t limit = 0;
+    if (!(limit_file >> limit) || limit > 100000) {
+        GTEST_SKIP() << "inotify queue limit unknown or too large to fill";
+    }
+    build::FileWatcher watcher({dir / "src"});
+    // Alternate two files: identical consecutive events are merged
+    for (size_t i = 0; i <= limit; ++i) {
+        std::ofstream(dir / (i % 2 ? "src/a.cpp" : "src/b.cpp")) << i;
+    }
+    EXPECT_TRUE(watcher.wait(20ms, 1000ms).overflowed);
+}
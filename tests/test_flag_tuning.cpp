@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "build/flag_tuning.hpp"
+
+TEST(FlagTuningTest, MatrixStartsWithTheBaseline) {
+    const auto variants = build::tuning_matrix({"g++", "clang++"}, {{"-O3", "-funroll-loops"}});
+    ASSERT_EQ(variants.size(), 16u);
+    EXPECT_EQ(variants[0].label(), "g++ -O2");
+    EXPECT_EQ(variants[7].label(), "g++ -O3 -funroll-loops");
+    EXPECT_EQ(variants[8].label(), "clang++ -O2");
+    EXPECT_EQ(variants[4].label(), "g++ -O2 -flto=auto");
+    EXPECT_EQ(variants[12].label(), "clang++ -O2 -flto=thin");
+    EXPECT_EQ(variants[14].label(), "clang++ -O3 -march=native -flto=thin -fno-plt -fno-semantic-interposition");
+}
+
+TEST(FlagTuningTest, ProfileReplacesOptimizationLevelOfReleaseOnly) {
+    const build::ReleaseProfile profile{"tuned", "clang++", {"-O3", "-march=native"}};
+
+    build::BuildConfig release;
+    release.name = "release";
+    release.compile_flags = {"-std=c++17", "-Wall", "-O2", "-DNDEBUG"};
+    build::apply_release_profile(release, profile);
+    EXPECT_EQ(release.compiler, "clang++");
+    EXPECT_EQ(release.compile_flags,
+              (std::vector<std::string>{"-std=c++17", "-Wall", "-DNDEBUG", "-O3", "-march=native"}));
+
+    build::BuildConfig debug;
+    debug.name = "debug";
+    debug.compile_flags = {"-g"};
+    build::apply_release_profile(debug, profile);
+    EXPECT_EQ(debug.compiler, "g++");
+    EXPECT_EQ(debug.compile_flags, (std::vector<std::string>{"-g"}));
+}
+
+TEST(FlagTuningTest, BenchScoreIsGeometricMeanOfMedians) {
+    const std::string json = R"({
+  "context": {"date": "2026-01-01T00:00:00", "samples": 20, "min_time": 0.010},
+  "benchmarks": [
+    {"name": "a", "iterations": 10, "samples": 20, "mean_ns": 5.000, "median_ns": 4.000, "p99_ns": 9.000},
+    {"name": "b", "iterations": 10, "samples": 20, "mean_ns": 5.000, "median_ns": 16.000, "p99_ns": 9.000}
+  ]
+})";
+    EXPECT_DOUBLE_EQ(build::bench_score(json), 8.0);
+    EXPECT_EQ(build::bench_score("{\"benchmarks\": []}"), 0.0);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "perf/flamegraph.hpp"
+#include "perf/profiler.hpp"
+
+TEST(FlameGraphTest, FoldsPerfScriptOutput) {
+    const std::string script =
+        "app 1234 100.000001:     1001001 cpu-clock:pppH:\n"
+        "\t    55d0c0a1 work(int)+0x1a (/tmp/app)\n"
+        "\t    55d0c0f2 main+0x22 (/tmp/app)\n"
+        "\t    7f00aa10 [unknown] (/usr/lib/libc.so.6)\n"
+        "\n"
+        "app 1234 100.001002:     1001001 cpu-clock:pppH:\n"
+        "\t    55d0c0a3 work(int)+0x1c (/tmp/app)\n"
+        "\t    55d0c0f2 main+0x22 (/tmp/app)\n"
+        "\t    7f00aa10 [unknown] (/usr/lib/libc.so.6)\n"
+        "\n"
+        "app 1234 100.002003:     1001001 cpu-clock:pppH:\n"
+        "\t    55d0c0f0 main+0x20 (/tmp/app)\n"
+        "\t    7f00aa10 [unknown] (/usr/lib/libc.so.6)\n";
+
+    perf::FoldedStacks stacks = perf::fold_perf_script(script);
+    ASSERT_EQ(stacks.size(), 2u);
+    EXPECT_EQ(stacks["[libc.so.6];main;work(int)"], 2u);
+    EXPECT_EQ(stacks["[libc.so.6];main"], 1u);
+    EXPECT_EQ(perf::total_samples(stacks), 3u);
+    EXPECT_EQ(perf::format_folded(stacks), "[libc.so.6];main 1\n[libc.so.6];main;work(int) 2\n");
+}
+
+TEST(FlameGraphTest, HotFunctionsCountRecursionOnce) {
+    perf::FoldedStacks stacks;
+    perf::add_stack(stacks, {"main", "fib", "fib", "fib"}, 6);
+    perf::add_stack(stacks, {"main", "parse;lex"}, 3);
+    perf::add_stack(stacks, {"main"}, 1);
+
+    auto hot = perf::hot_functions(stacks, 2);
+    ASSERT_EQ(hot.size(), 2u);
+    EXPECT_EQ(hot[0].name, "fib");
+    EXPECT_EQ(hot[0].self, 6u);
+    EXPECT_EQ(hot[0].total, 6u);
+    EXPECT_EQ(hot[1].name, "parse:lex");
+    EXPECT_EQ(hot[1].total, 3u);
+
+    const std::string svg = perf::render_flamegraph(stacks, "test <app>");
+    EXPECT_NE(svg.find("<title>fib (6 samples, 60.00%)</title>"), std::string::npos);
+    EXPECT_NE(svg.find("test &lt;app&gt;"), std::string::npos);
+}
+
+TEST(FlameGraphTest, ParsesSamplerDump) {
+    perf::SamplerDump dump = perf::parse_sampler_dump(
+        "# cppstarter sampler v1\n"
+        "dropped 2\n"
+        "s 401136 401180 7f0000001234\n"
+        "s 401140\n"
+        "m 7f0000000000-7f0000010000 r-xp 00002000 fe:00 42   /usr/lib/libc.so.6\n"
+        "m 00400000-00401000 r--p 00000000 fe:00 7   /tmp/app\n"
+        "m 00401000-00402000 r-xp 00001000 fe:00 7   /tmp/app\n");
+    EXPECT_EQ(dump.dropped, 2u);
+    ASSERT_EQ(dump.stacks.size(), 2u);
+    EXPECT_EQ(dump.stacks[0], (std::vector<uint64_t>{0x401136, 0x401180, 0x7f0000001234}));
+
+    // Only executable mappings are kept, sorted by address
+    ASSERT_EQ(dump.mappings.size(), 2u);
+    EXPECT_EQ(dump.mappings[0].start, 0x401000u);
+    EXPECT_EQ(dump.mappings[0].offset, 0x1000u);
+    EXPECT_EQ(dump.mappings[1].path, "/usr/lib/libc.so.6");
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+
+#include "scaffold/git_repository.hpp"
+#include "temp_dir.hpp"
+
+namespace fs = std::filesystem;
+
+class GitRepositoryTest : public TempDirTest {};
+
+// The expected ids come from `git add hello.txt tools && git commit` on the
+// same files with the same author, committer and dates.
+TEST_F(GitRepositoryTest, WritesTheSameCommitAsGit) {
+    write("hello.txt", "hello\n");
+    write("tools/run.sh", "#!/bin/sh\necho hi\n");
+    fs::permissions(dir / "tools/run.sh", fs::perms::owner_exec, fs::perm_options::add);
+    write("build/ignored.o", "x\n");
+
+    scaffold::GitIdentity identity;
+    identity.author = "A U Thor <a@example.com> 1700000000 +0000";
+    identity.committer = identity.author;
+    identity.branch = "main";
+
+    const std::string commit = scaffold::git_init_commit(dir, identity, "Initial commit");
+    EXPECT_EQ(commit, "83c08f98308a1bb7820e751bec9b46ccc89a8f19");
+    EXPECT_EQ(read(dir / ".git/HEAD"), "ref: refs/heads/main\n");
+    EXPECT_EQ(read(dir / ".git/refs/heads/main"), commit + "\n");
+    EXPECT_TRUE(fs::exists(dir / ".git/objects/65/855368991c9222cc0ff72115f0e7daf96def43"));   // Root tree
+    EXPECT_TRUE(fs::exists(dir / ".git/objects/ce/013625030ba8dba906f756967f9e9ca394464a"));   // "hello\n"
+
+    // Two tracked files; build/ is left out
+    const std::string index = read(dir / ".git/index");
+    ASSERT_GE(index.size(), 12u);
+    EXPECT_EQ(index.substr(0, 4), "DIRC");
+    EXPECT_EQ(index.substr(4, 8), std::string("\0\0\0\2\0\0\0\2", 8));
+    EXPECT_EQ(index.find("build/"), std::string::npos);
+}
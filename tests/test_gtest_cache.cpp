@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "build/gtest_cache.hpp"
+#include "temp_dir.hpp"
+
+namespace fs = std::filesystem;
+
+class GtestCacheTest : public TempDirTest {
+protected:
+    // Minimal googletest repository layout
+    fs::path fake_checkout(const std::string& name, const std::string& version) {
+        const fs::path root = dir / name;
+        fs::create_directories(root / "googletest/include/gtest");
+        fs::create_directories(root / "googletest/src");
+        std::ofstream(root / "CMakeLists.txt") << "project(googletest-distribution)\n"
+                                               << "set(GOOGLETEST_VERSION " << version << ")\n";
+        std::ofstream(root / "googletest/include/gtest/gtest.h") << "#pragma once\n";
+        std::ofstream(root / "googletest/src/gtest-all.cc") << "#include \"gtest/gtest.h\"\n";
+        std::ofstream(root / "googletest/src/gtest_main.cc") << "int main() { return 0; }\n";
+        return root;
+    }
+
+};
+
+TEST(GtestAbiFlagsTest, KeepsOnlyFlagsThatChangeTheArchives) {
+    const std::vector<std::string> flags = {"-Wall", "-std=c++17", "-O2", "-Iinclude", "-pthread", "-g",
+                                            "-D_GLIBCXX_DEBUG", "-DNDEBUG", "-fsanitize=address", "-std=c++17"};
+    const std::vector<std::string> expected = {"-D_GLIBCXX_DEBUG", "-fsanitize=address", "-pthread", "-std=c++17"};
+    EXPECT_EQ(build::gtest_abi_flags(flags), expected);
+    EXPECT_EQ(build::parse_gtest_version("set(GOOGLETEST_VERSION 1.14.0)\n"), "1.14.0");
+    EXPECT_EQ(build::parse_gtest_version("set(GOOGLETEST_VERSION ${VERSION})\n"), "");
+}
+
+TEST_F(GtestCacheTest, SeedsCheckoutsAndTarballsNewestFirst) {
+    build::GtestCache cache(dir / "cache");
+    EXPECT_TRUE(cache.source_versions().empty());
+    EXPECT_FALSE(cache.find("g++", {"-std=c++17"}).has_value());
+
+    EXPECT_EQ(cache.seed(fake_checkout("checkout", "1.9.0")), "1.9.0");
+    // A release tarball unpacks into googletest-<version>/
+    fake_checkout("googletest-1.14.0", "1.14.0");
+    ASSERT_EQ(std::system(("tar -czf " + (dir / "release.tar.gz").string() + " -C " + dir.string() +
+                           " googletest-1.14.0").c_str()), 0);
+    EXPECT_EQ(cache.seed(dir / "release.tar.gz"), "1.14.0");
+
+    EXPECT_EQ(cache.source_versions(), (std::vector<std::string>{"1.14.0", "1.9.0"}));
+    EXPECT_TRUE(fs::is_regular_file(dir / "cache/src/1.14.0/include/gtest/gtest.h"));
+    EXPECT_TRUE(cache.entries().empty());
+    EXPECT_THROW(cache.seed(dir / "cache/src/1.14.0/include"), std::runtime_error);
+}
+
+TEST_F(GtestCacheTest, LinkReplacesOnlySymlinks) {
+    fs::create_directories(dir / "entry_a");
+    fs::create_directories(dir / "entry_b");
+    build::link_gtest(dir / "entry_a", dir / "project/build/gtest");
+    build::link_gtest(dir / "entry_b", dir / "project/build/gtest");
+    EXPECT_EQ(fs::read_symlink(dir / "project/build/gtest"), dir / "entry_b");
+
+    fs::create_directories(dir / "project/build/googletest");
+    EXPECT_THROW(build::link_gtest(dir / "entry_a", dir / "project/build/googletest"), std::runtime_error);
+}
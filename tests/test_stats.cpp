@@ -0,0 +1,34 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "perf/stats.hpp"
+
+TEST(StatsTest, SummarizeComputesMedianAndSampleStddev) {
+    perf::Summary summary = perf::summarize({4.0, 1.0, 3.0, 2.0});
+    EXPECT_EQ(summary.count, 4u);
+    EXPECT_DOUBLE_EQ(summary.mean, 2.5);
+    EXPECT_DOUBLE_EQ(summary.median, 2.5);
+    EXPECT_DOUBLE_EQ(summary.min, 1.0);
+    EXPECT_DOUBLE_EQ(summary.max, 4.0);
+    EXPECT_NEAR(summary.stddev, 1.290994, 1e-6);
+
+    EXPECT_DOUBLE_EQ(perf::percentile({1.0, 2.0, 3.0, 4.0, 5.0}, 50), 3.0);
+    EXPECT_DOUBLE_EQ(perf::percentile({1.0, 2.0, 3.0, 4.0, 5.0}, 99), 4.96);
+}
+
+TEST(StatsTest, MannWhitneySeparatedSamplesAreSignificant) {
+    // Reference values from scipy.stats.mannwhitneyu(method="asymptotic")
+    perf::MannWhitney test = perf::mann_whitney_u({1, 2, 3, 4, 5}, {6, 7, 8, 9, 10});
+    EXPECT_DOUBLE_EQ(test.u, 0.0);
+    EXPECT_LT(test.z, 0.0);
+    EXPECT_NEAR(test.p_value, 0.01219, 1e-4);
+}
+
+TEST(StatsTest, MannWhitneyHandlesTiesAndIdenticalSamples) {
+    perf::MannWhitney overlapping = perf::mann_whitney_u({1, 2, 2, 3}, {2, 3, 3, 4});
+    EXPECT_DOUBLE_EQ(overlapping.u, 3.0);
+    EXPECT_GT(overlapping.p_value, 0.05);
+
+    perf::MannWhitney identical = perf::mann_whitney_u({5, 5, 5}, {5, 5, 5});
+    EXPECT_DOUBLE_EQ(identical.p_value, 1.0);
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+
+#include "scaffold/template_pack.hpp"
+#include "temp_dir.hpp"
+
+namespace fs = std::filesystem;
+
+class TemplatePackTest : public TempDirTest {
+protected:
+    // Files of the fake templates/ tree
+    void write(const std::string& name, const std::string& content) {
+        TempDirTest::write("templates/" + name, content);
+    }
+};
+
+TEST(TemplateCompressionTest, RoundTripsAndShrinksRepetitiveText) {
+    std::string makefile;
+    for (int i = 0; i < 50; ++i) {
+        makefile += "build/debug/obj/%.o: src/%.cpp\n\t$(CXX) $(DBG_FLAGS) -c $< -o $@\n";
+    }
+    for (const std::string& text : {std::string(), std::string("abc"), std::string(300, 'x'), makefile}) {
+        const std::string packed = scaffold::compress(text);
+        EXPECT_EQ(scaffold::decompress(packed, text.size()), text);
+    }
+    EXPECT_LT(scaffold::compress(makefile).size(), makefile.size() / 10);
+
+    const std::string packed = scaffold::compress(makefile);
+    EXPECT_THROW(scaffold::decompress(packed, makefile.size() + 1), std::runtime_error);
+    EXPECT_THROW(scaffold::decompress(packed.substr(0, packed.size() / 2), makefile.size()), std::runtime_error);
+}
+
+TEST(TemplateCompressionTest, SubstitutesKnownVariablesInOnePass) {
+    const scaffold::Variables variables = {{"project_name", "demo"}, {"x", "{{project_name}}"}};
+    EXPECT_EQ(scaffold::substitute("bin/{{project_name}} lib{{project_name}}.a", variables),
+              "bin/demo libdemo.a");
+    // Values are not rescanned and unknown or unterminated placeholders stay as they are
+    EXPECT_EQ(scaffold::substitute("{{x}} {{other}} {{project_name", variables),
+              "{{project_name}} {{other}} {{project_name");
+}
+
+TEST_F(TemplatePackTest, PacksIndexesAndWritesTemplates) {
+    std::string body;
+    for (int i = 0; i < 20; ++i) {
+        body += "std::cout << \"line " + std::to_string(i) + "\" << std::endl;\n";
+    }
+    write("app/Makefile", "DBG_BIN = build/debug/bin/{{project_name}}\n");
+    write("app/src/main.cpp", body);
+    write("app/include/tiny.h", "#pragma once\n");
+    write("lib/README.md", "# Library\n");
+
+    const std::string blob = scaffold::pack_templates(dir / "templates");
+    const scaffold::TemplatePack pack(blob);
+    ASSERT_EQ(pack.ids(), (std::vector<std::string_view>{"app", "lib"}));
+    EXPECT_TRUE(pack.contains("lib"));
+    EXPECT_FALSE(pack.contains("ap"));
+    EXPECT_THROW(pack.files("missing"), std::runtime_error);
+
+    const auto files = pack.files("app");
+    ASSERT_EQ(files.size(), 3u);
+    EXPECT_EQ(files[0].path, "Makefile");
+    EXPECT_TRUE(files[0].has_variables);
+    EXPECT_EQ(files[1].path, "include/tiny.h");
+    EXPECT_FALSE(files[1].compressed);      // Too small to gain anything
+    EXPECT_EQ(files[2].path, "src/main.cpp");
+    EXPECT_TRUE(files[2].compressed);
+    EXPECT_EQ(files[2].contents(), body);
+
+    const fs::path project = dir / "demo";
+    EXPECT_EQ(scaffold::write_template(pack, "app", project, {{"project_name", "demo"}}), 3u);
+    EXPECT_EQ(read(project / "Makefile"), "DBG_BIN = build/debug/bin/demo\n");
+    EXPECT_EQ(read(project / "src/main.cpp"), body);
+    EXPECT_EQ(read(project / "include/tiny.h"), "#pragma once\n");
+
+    EXPECT_THROW(scaffold::TemplatePack(std::string_view("not a blob")), std::runtime_error);
+}
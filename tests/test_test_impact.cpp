@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "build/test_impact.hpp"
+
+namespace fs = std::filesystem;
+
+TEST(TestImpactTest, ParsesStrongGlobalSymbolsFromNm) {
+    const std::string output =
+        "obj/math.o: _Z3addii T 0 14\n"
+        "obj/math.o: _ZN4util6helperEv W 0 8\n"     // Inline function: weak, ignored
+        "obj/math.o: _ZL5cache b 0 4\n"             // Local, ignored
+        "obj/math.o: counter B 0 4\n"
+        "obj/test.o: _Z3addii U\n"
+        "obj/test.o: _ZN4util6helperEv W 0 8\n";
+    const auto symbols = build::parse_nm_output(output);
+    ASSERT_EQ(symbols.size(), 2u);
+    EXPECT_EQ(symbols.at("obj/math.o").defined, (std::vector<std::string>{"_Z3addii", "counter"}));
+    EXPECT_TRUE(symbols.at("obj/math.o").undefined.empty());
+    EXPECT_EQ(symbols.at("obj/test.o").undefined, std::vector<std::string>{"_Z3addii"});
+    EXPECT_TRUE(symbols.at("obj/test.o").defined.empty());
+}
+
+TEST(TestImpactTest, SelectsTestsThroughIncludesAndLinkage) {
+    // test_a -> a.o -> b.o; test_b uses nothing; test_c includes config.hpp
+    std::unordered_map<std::string, build::ObjectSymbols> symbols;
+    symbols["a.o"] = {{"a"}, {"b"}};
+    symbols["b.o"] = {{"b"}, {}};
+    symbols["test_a.o"] = {{"TestA"}, {"a"}};
+    symbols["test_b.o"] = {{"TestB"}, {}};
+    symbols["test_c.o"] = {{"TestC"}, {}};
+    const build::LinkClosure closure = build::link_closure(symbols);
+    EXPECT_EQ(closure.at("test_a.o"), (std::vector<std::string>{"a.o", "b.o"}));
+
+    const std::unordered_map<std::string, std::string> object_of = {
+        {"src/a.cpp", "a.o"}, {"src/b.cpp", "b.o"}, {"tests/test_a.cpp", "test_a.o"},
+        {"tests/test_b.cpp", "test_b.o"}, {"tests/test_c.cpp", "test_c.o"}};
+    const std::vector<fs::path> tests = {"tests/test_a.cpp", "tests/test_b.cpp", "tests/test_c.cpp"};
+    auto dependents = [](const fs::path& file) {
+        if (file == "include/b.hpp") return std::vector<fs::path>{"src/b.cpp"};
+        if (file == "include/config.hpp") return std::vector<fs::path>{"tests/test_c.cpp"};
+        return std::vector<fs::path>{};
+    };
+    auto impacted = [&](const std::vector<fs::path>& changed) {
+        return build::impacted_tests(changed, tests, dependents, object_of, closure);
+    };
+
+    EXPECT_EQ(impacted({"src/b.cpp"}), std::vector<fs::path>{"tests/test_a.cpp"});
+    EXPECT_EQ(impacted({"include/b.hpp"}), std::vector<fs::path>{"tests/test_a.cpp"});
+    EXPECT_EQ(impacted({"./include/config.hpp", "tests/test_b.cpp"}),
+              (std::vector<fs::path>{"tests/test_b.cpp", "tests/test_c.cpp"}));
+    EXPECT_TRUE(impacted({"README.md"}).empty());
+}
+
+TEST(TestImpactTest, FilterCoversParameterizedAndTypedSuites) {
+    EXPECT_EQ(build::gtest_filter_for({"Math", "Slow"}),
+              "Math.*:*/Math.*:Math/*:Slow.*:*/Slow.*:Slow/*");
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "build/test_shards.hpp"
+
+TEST(TestShardsTest, ParsesGtestListIncludingParameterizedTests) {
+    const std::string listing =
+        "Running main() from ./googletest/src/gtest_main.cc\n"
+        "MathTest.\n"
+        "  Addition\n"
+        "  Division\n"
+        "Values/ParametrizedTest.\n"
+        "  IsEven/0  # GetParam() = 2\n"
+        "  IsEven/1  # GetParam() = 4\n"
+        "TypedTest/0.  # TypeParam = int\n"
+        "  Works\n";
+    const std::vector<std::string> expected = {"MathTest.Addition", "MathTest.Division",
+                                               "Values/ParametrizedTest.IsEven/0",
+                                               "Values/ParametrizedTest.IsEven/1", "TypedTest/0.Works"};
+    EXPECT_EQ(build::parse_gtest_list(listing), expected);
+}
+
+TEST(TestShardsTest, MergedXmlRoundTrips) {
+    std::vector<build::TestCaseResult> cases(3);
+    cases[0] = {"MathTest", "Addition", 0.002, false, false, ""};
+    cases[1] = {"Values/ParametrizedTest", "IsEven/1", 1.5, true, false, "Expected: \"a\" < b\nActual: 3 & 4"};
+    cases[2] = {"MathTest", "Skipped", 0.0, false, true, ""};
+
+    const std::string xml = build::format_gtest_xml(cases);
+    EXPECT_NE(xml.find("<testsuites tests=\"3\" failures=\"1\""), std::string::npos);
+    // Suites are grouped: both MathTest cases come first
+    EXPECT_LT(xml.find("name=\"Skipped\""), xml.find("name=\"IsEven/1\""));
+
+    const auto parsed = build::parse_gtest_xml(xml);
+    ASSERT_EQ(parsed.size(), 3u);
+    EXPECT_EQ(parsed[2].full_name(), "Values/ParametrizedTest.IsEven/1");
+    EXPECT_TRUE(parsed[2].failed);
+    EXPECT_EQ(parsed[2].failure, cases[1].failure);
+    EXPECT_DOUBLE_EQ(parsed[2].seconds, 1.5);
+    EXPECT_TRUE(parsed[1].skipped);
+    EXPECT_FALSE(parsed[0].failed);
+}
+
+TEST(TestShardsTest, KeepsMalformedCharacterReferences) {
+    const std::string xml =
+        "<testsuites><testsuite name=\"S\"><testcase name=\"A&#x41;&#;&#x;&#xZZ;&#12a;\" classname=\"S\" "
+        "time=\"0\"/></testsuite></testsuites>";
+    const auto parsed = build::parse_gtest_xml(xml);
+    ASSERT_EQ(parsed.size(), 1u);
+    EXPECT_EQ(parsed[0].name, "AA&#;&#x;&#xZZ;&#12a;");
+}
+
+TEST(TestShardsTest, PacksLongestTestsIntoTheLightestShard) {
+    const std::vector<std::string> tests = {"A.a", "A.b", "A.c", "A.d", "A.e", "A.new"};
+    const build::TestDurations durations = {{"A.a", 8.0}, {"A.b", 4.0}, {"A.c", 4.0}, {"A.d", 1.0}, {"A.e", 1.0}};
+
+    const auto shards = build::pack_tests(tests, durations, 2);
+    ASSERT_EQ(shards.size(), 2u);
+    // 8 + 4 (the test without history counts as the median, 4) vs 4 + 4 + 1 + 1
+    EXPECT_EQ(shards[0], (std::vector<std::string>{"A.a", "A.new"}));
+    EXPECT_EQ(shards[1], (std::vector<std::string>{"A.b", "A.c", "A.d", "A.e"}));
+
+    // Never more shards than tests, and no history means an even split
+    EXPECT_EQ(build::pack_tests({"A.a", "A.b"}, {}, 8).size(), 2u);
+}
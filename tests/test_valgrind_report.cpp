@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "perf/valgrind_report.hpp"
+
+namespace {
+
+const char* CACHEGRIND_OUT =
+    "desc: I1 cache:         32768 B, 64 B, 8-way associative\n"
+    "desc: D1 cache:         32768 B, 64 B, 8-way associative\n"
+    "desc: LL cache:         8388608 B, 64 B, 16-way associative\n"
+    "cmd: ./build/debug/bin/app\n"
+    "events: Ir I1mr ILmr Dr D1mr DLmr Dw D1mw DLmw Bc Bcm Bi Bim\n"
+    "fl=/tmp/app/src/main.cpp\n"
+    "fn=sum(std::vector<int> const&)\n"
+    "5 1000 1 1 400 100 10 0 0 0 200 20\n"
+    "6 500 0 0 100 0 0 100 25 5\n"
+    "fn=main\n"
+    "12 100 2 2 20 1 1 10\n"
+    "fl=/usr/include/c++/12/bits/stl_vector.h\n"
+    "fn=sum(std::vector<int> const&)\n"
+    "1046 400 0 0 200 50 0\n"
+    "summary: 2000 3 3 720 151 11 110 25 5 200 20 0 0\n";
+
+const char* CALLGRIND_OUT =
+    "version: 1\n"
+    "creator: callgrind-3.21.0\n"
+    "cmd: ./app\n"
+    "positions: line\n"
+    "events: Ir Dr Dw D1mr D1mw\n"
+    "fl=(1) /tmp/app/src/main.cpp\n"
+    "fn=(1) main\n"
+    "10 50 10 5 1\n"
+    "cfn=(2) fib(int)\n"
+    "calls=1 3\n"
+    "11 900 300 100 3\n"
+    "fn=(2)\n"
+    "3 600 200 100 2 1\n"
+    "cfn=(2)\n"
+    "calls=2 3\n"
+    "+1 850 290 95 2 1\n"
+    "totals: 650 210 105 4 2\n";
+
+} // namespace
+
+TEST(ValgrindReportTest, ParsesCachegrindAndMergesFunctionsAcrossFiles) {
+    perf::ValgrindProfile profile = perf::parse_valgrind_profile(CACHEGRIND_OUT);
+    EXPECT_EQ(profile.command, "./build/debug/bin/app");
+    ASSERT_EQ(profile.events.size(), 13u);
+    ASSERT_EQ(profile.functions.size(), 2u);
+    EXPECT_FALSE(profile.has_calls);
+
+    const perf::FunctionCost& sum = profile.functions[0];
+    EXPECT_EQ(sum.file, "/tmp/app/src/main.cpp");
+    EXPECT_EQ(profile.sum(sum.self, {"Ir"}), 1900u);
+    EXPECT_EQ(profile.sum(sum.self, {"D1mr", "D1mw"}), 175u);   // Trailing zeros were omitted
+
+    perf::CacheRates rates = perf::cache_rates(profile, sum.self);
+    EXPECT_DOUBLE_EQ(rates.d1_miss, 175.0 / 800.0);
+    EXPECT_DOUBLE_EQ(rates.ll_miss, 16.0 / 2700.0);
+    EXPECT_EQ(rates.mispredicts, 20u);
+    EXPECT_DOUBLE_EQ(rates.mispredict, 0.1);
+
+    auto hot = perf::hottest(profile, "", 10);
+    ASSERT_EQ(hot.size(), 2u);
+    EXPECT_EQ(hot[0]->name, "sum(std::vector<int> const&)");
+    EXPECT_EQ(perf::hottest(profile, "D1mw", 10).size(), 1u);
+    EXPECT_THROW(perf::hottest(profile, "Cycles", 10), std::runtime_error);
+}
+
+TEST(ValgrindReportTest, ParsesCallgrindCompressedNamesAndCallCosts) {
+    perf::ValgrindProfile profile = perf::parse_valgrind_profile(CALLGRIND_OUT);
+    ASSERT_EQ(profile.functions.size(), 2u);
+    EXPECT_TRUE(profile.has_calls);
+    EXPECT_EQ(profile.totals[0], 650u);
+
+    const perf::FunctionCost& main = profile.functions[0];
+    const perf::FunctionCost& fib = profile.functions[1];
+    EXPECT_EQ(fib.name, "fib(int)");
+    EXPECT_EQ(profile.sum(main.self, {"Ir"}), 50u);
+    EXPECT_EQ(profile.sum(main.inclusive, {"Ir"}), 950u);
+    // The recursive call is not added to fib's own inclusive cost
+    EXPECT_EQ(profile.sum(fib.self, {"Ir"}), 600u);
+    EXPECT_EQ(profile.sum(fib.inclusive, {"Ir"}), 600u);
+    EXPECT_LT(perf::cache_rates(profile, fib.self).ll_miss, 0.0);   // No LL events collected
+}
+
+TEST(ValgrindReportTest, DiffRanksFunctionsByInstructionChange) {
+    perf::ValgrindProfile before = perf::parse_valgrind_profile(CACHEGRIND_OUT);
+    perf::ValgrindProfile after = perf::parse_valgrind_profile(
+        "events: Ir D1mr\n"
+        "fl=main.cpp\n"
+        "fn=sum(std::vector<int> const&)\n"
+        "5 700 10\n"
+        "fn=main\n"
+        "12 100 1\n"
+        "fn=helper()\n"
+        "20 40 0\n");
+
+    perf::ProfileDiff diff = perf::diff_profiles(before, after);
+    ASSERT_EQ(diff.events, (std::vector<std::string>{"Ir", "D1mr"}));
+    EXPECT_EQ(diff.before_totals[0], 2000u);
+    EXPECT_EQ(diff.after_totals[0], 840u);
+
+    // main is unchanged and left out
+    ASSERT_EQ(diff.functions.size(), 2u);
+    EXPECT_EQ(diff.functions[0].name, "sum(std::vector<int> const&)");
+    EXPECT_EQ(diff.functions[0].before[0], 1900u);
+    EXPECT_EQ(diff.functions[0].after[0], 700u);
+    EXPECT_EQ(diff.functions[1].name, "helper()");
+    EXPECT_EQ(diff.functions[1].before[0], 0u);
+}
@@ -0,0 +1,29 @@
+// Build-time helper: packs templates/ into a C++ source that embeds the blob.
+// Usage: pack_templates <templates dir> <output.cpp>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "scaffold/template_pack.hpp"
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <templates dir> <output.cpp>\n";
+        return 2;
+    }
+    try {
+        const std::string source = scaffold::blob_to_cpp(scaffold::pack_templates(argv[1]));
+
+        // Leave the output untouched when nothing changed, so it is not recompiled
+        std::ifstream existing(argv[2], std::ios::binary);
+        std::ostringstream current;
+        current << existing.rdbuf();
+        if (current.str() != source) {
+            std::ofstream(argv[2], std::ios::binary | std::ios::trunc) << source;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "pack_templates: " << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}